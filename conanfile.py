@@ -84,6 +84,8 @@ def requirements(self):
         self.requires("nlohmann_json/3.11.3")
         self.requires("paho-mqtt-c/1.3.13")
         self.requires("paho-mqtt-cpp/1.4.0")
+        # also required by gRPC, so its version is left to the one gRPC requires
+        self.requires("zlib/[>=1.2.11 <2]")
 
     def build_requirements(self):
         # Declare both, grpc and protobuf, here to enable proper x-build (w/o using qemu)
@@ -22,6 +22,7 @@
 
 #include "vehicle/Cabin/Seat/Seat.h"
 
+#include <cstddef>
 #include <stdexcept>
 
 namespace velocitas::vehicle {
@@ -35,21 +36,21 @@ public:
     public:
         class RowType : public ParentClass {
         public:
-            RowType(const std::string& name, ParentClass* parent)
+            RowType(const std::string& name, ParentClass* parent, size_t signalIndex)
                 : ParentClass(name, parent)
-                , DriverSide("DriverSide", this)
-                , Middle("Middle", this)
-                , PassengerSide("PassengerSide", this) {}
+                , DriverSide("DriverSide", this, signalIndex)
+                , Middle("Middle", this, signalIndex + 1)
+                , PassengerSide("PassengerSide", this, signalIndex + 2) {}
 
             vehicle::cabin::Seat DriverSide;
             vehicle::cabin::Seat Middle;
             vehicle::cabin::Seat PassengerSide;
         };
 
-        explicit SeatCollection(ParentClass* parent)
+        SeatCollection(ParentClass* parent, size_t signalIndex)
             : ParentClass("Seat", parent)
-            , Row1("Row1", this)
-            , Row2("Row2", this) {}
+            , Row1("Row1", this, signalIndex)
+            , Row2("Row2", this, signalIndex + 3) {}
 
         RowType& Row(int index) {
             if (index == 1) {
@@ -65,9 +66,9 @@ public:
         RowType Row2;
     };
 
-    Cabin(const std::string& name, ParentClass* parent)
+    Cabin(const std::string& name, ParentClass* parent, size_t signalIndex)
         : ParentClass(name, parent)
-        , Seat(this) {}
+        , Seat(this, signalIndex) {}
 
     /**
      * Seat: branch
@@ -20,6 +20,8 @@
 #include "sdk/DataPoint.h"
 #include "sdk/Model.h"
 
+#include "vehicle/VehicleSignals.h"
+
 namespace velocitas::vehicle::cabin {
 
 using ParentClass = Model;
@@ -27,9 +29,9 @@ using ParentClass = Model;
 /** Seat model. */
 class Seat : public ParentClass {
 public:
-    Seat(const std::string& name, ParentClass* parent)
+    Seat(const std::string& name, ParentClass* parent, size_t signalIndex)
         : ParentClass(name, parent)
-        , Position("Position", this) {}
+        , Position(getSignalTable(), signalIndex, this) {}
 
     /**
      * Position: actuator
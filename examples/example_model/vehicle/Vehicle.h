@@ -21,6 +21,7 @@
 #include "sdk/Model.h"
 
 #include "vehicle/Cabin/Cabin.h"
+#include "vehicle/VehicleSignals.h"
 
 namespace velocitas {
 
@@ -31,8 +32,8 @@ class Vehicle : public ParentClass {
 public:
     Vehicle()
         : ParentClass("Vehicle")
-        , Speed("Speed", this)
-        , Cabin("Cabin", this) {}
+        , Speed(vehicle::getSignalTable(), vehicle::SIGNAL_INDEX_SPEED, this)
+        , Cabin("Cabin", this, vehicle::SIGNAL_INDEX_CABIN) {}
 
     /**
      * Speed: sensor
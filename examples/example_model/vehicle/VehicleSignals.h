@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VMDL_EXAMPLE_VEHICLE_SIGNALS_H
+#define VMDL_EXAMPLE_VEHICLE_SIGNALS_H
+
+#include "sdk/SignalTable.h"
+
+#include <array>
+#include <cstddef>
+
+namespace velocitas::vehicle {
+
+/**
+ * All signals of the model in depth-first order, so the signals of each branch occupy a
+ * contiguous range. Branches are constructed with the index of their first signal.
+ */
+constexpr std::array<SignalDescriptor, 7> SIGNAL_DESCRIPTORS{{
+    {"Vehicle.Speed", DataPointValue::Type::FLOAT, Node::Type::SENSOR},
+    {"Vehicle.Cabin.Seat.Row1.DriverSide.Position", DataPointValue::Type::UINT32,
+     Node::Type::ACTUATOR},
+    {"Vehicle.Cabin.Seat.Row1.Middle.Position", DataPointValue::Type::UINT32,
+     Node::Type::ACTUATOR},
+    {"Vehicle.Cabin.Seat.Row1.PassengerSide.Position", DataPointValue::Type::UINT32,
+     Node::Type::ACTUATOR},
+    {"Vehicle.Cabin.Seat.Row2.DriverSide.Position", DataPointValue::Type::UINT32,
+     Node::Type::ACTUATOR},
+    {"Vehicle.Cabin.Seat.Row2.Middle.Position", DataPointValue::Type::UINT32,
+     Node::Type::ACTUATOR},
+    {"Vehicle.Cabin.Seat.Row2.PassengerSide.Position", DataPointValue::Type::UINT32,
+     Node::Type::ACTUATOR},
+}};
+
+/** Index of Vehicle.Speed */
+constexpr size_t SIGNAL_INDEX_SPEED = 0;
+/** Index of the first signal of Vehicle.Cabin */
+constexpr size_t SIGNAL_INDEX_CABIN = 1;
+
+/**
+ * @brief Get the signal table of the model; pass it to VehicleApp::declareSignals to resolve
+ * the numeric ids of all signals at startup.
+ */
+inline const SignalTable& getSignalTable() {
+    static const SignalTable table(SIGNAL_DESCRIPTORS);
+    return table;
+}
+
+} // namespace velocitas::vehicle
+
+#endif // VMDL_EXAMPLE_VEHICLE_SIGNALS_H
@@ -15,8 +15,8 @@
  */
 
 #include "SeatsServiceImpl.h"
+#include <sdk/grpc/GrpcServer.h>
 #include <sdk/middleware/Middleware.h>
-#include <services/seats/SeatsServiceServerFactory.h>
 
 #include "vehicle/Vehicle.hpp"
 
@@ -25,15 +25,17 @@
 using namespace velocitas;
 
 int main(int argc, char** argv) {
-    auto seatsImpl = std::make_shared<SeatsService>();
+    // SDV_GRPC_SERVER_MAX_THREADS and SDV_GRPC_SERVER_MESSAGE_POOL_SIZE tune the server
+    const auto config    = GrpcServerConfig::fromEnvironment();
+    auto       seatsImpl = std::make_shared<SeatsService>(config);
 
     velocitas::VehicleModelContext::getInstance().setVdbc(
         velocitas::IVehicleDataBrokerClient::createInstance("vehicledatabroker"));
 
-    auto seatServer = SeatsServiceServerFactory::create(Middleware::getInstance(), seatsImpl);
-
-    seatServer->Wait();
+    auto seatServer = startGrpcServer(Middleware::getInstance().getServiceLocation("seats"),
+                                      *seatsImpl, config);
 
     std::cout << "Waiting!" << std::endl;
+    seatServer->Wait();
     return 0;
 }
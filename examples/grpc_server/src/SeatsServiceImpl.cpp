@@ -21,54 +21,54 @@
 
 namespace velocitas {
 
-::grpc::Status SeatsService::Move(::grpc::ServerContext*                              context,
-                                  const ::sdv::edge::comfort::seats::v1::MoveRequest* request,
-                                  ::sdv::edge::comfort::seats::v1::MoveReply*         response) {
+SeatsService::SeatsService(const GrpcServerConfig& config)
+    : m_moveAllocator(config.m_messagePoolSize)
+    , m_currentPositionAllocator(config.m_messagePoolSize) {
+    SetMessageAllocatorFor_Move(&m_moveAllocator);
+    SetMessageAllocatorFor_CurrentPosition(&m_currentPositionAllocator);
+}
+
+::grpc::ServerUnaryReactor*
+SeatsService::Move(::grpc::CallbackServerContext*                      context,
+                   const ::sdv::edge::comfort::seats::v1::MoveRequest* request,
+                   ::sdv::edge::comfort::seats::v1::MoveReply*         response) {
     (void)context;
-    (void)request;
     (void)response;
-    auto seat     = request->seat();
-    auto location = seat.location();
-    auto row      = location.row();
-    auto pos      = location.index();
+    auto seat = request->seat();
 
     std::cout << "Got Move Request!" << std::endl;
 
-    try {
-        auto status =
-            vehicle.Cabin.Seat.Row1.DriverSide.Position.set(seat.position().base())->await();
-
-        if (status.ok()) {
-            std::cout << "OK!" << std::endl;
-            return ::grpc::Status(::grpc::StatusCode::OK, "");
-        } else {
+    // If the result fails, this could typically be that Databroker is not running or not
+    // reachable or that your Velocitas environment uses an API incompatible with what your
+    // Databroker instance supports. The call is then finished with UNAVAILABLE.
+    return finishOnResult(
+        vehicle.Cabin.Seat.Row1.DriverSide.Position.set(seat.position().base()),
+        [](const Status& status) {
+            if (status.ok()) {
+                std::cout << "OK!" << std::endl;
+                return ::grpc::Status(::grpc::StatusCode::OK, "");
+            }
             std::cout << "Some error!" << std::endl;
             // This could for instance happen if datapoint is not known by databroker
             // then message will be UNKNOWN_DATAPOINT.
             return ::grpc::Status(::grpc::StatusCode::CANCELLED, status.errorMessage());
-        }
-    } catch (AsyncException& e) {
-        std::cout << "Async Exception!" << std::endl;
-        // This could typically be that Databroker is not running or not reachable
-        // or that your Velocitas environment uses an API incompatible with what your Databroker
-        // instance supports
-        return ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, "");
-    }
+        });
 }
 
-::grpc::Status
-SeatsService::MoveComponent(::grpc::ServerContext*                                       context,
+::grpc::ServerUnaryReactor*
+SeatsService::MoveComponent(::grpc::CallbackServerContext*                               context,
                             const ::sdv::edge::comfort::seats::v1::MoveComponentRequest* request,
                             ::sdv::edge::comfort::seats::v1::MoveComponentReply*         response) {
-    (void)context;
     (void)request;
     (void)response;
     // This is an example of an unimplemented method
-    return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    auto* reactor = context->DefaultReactor();
+    reactor->Finish(::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, ""));
+    return reactor;
 }
 
-::grpc::Status SeatsService::CurrentPosition(
-    ::grpc::ServerContext*                                         context,
+::grpc::ServerUnaryReactor* SeatsService::CurrentPosition(
+    ::grpc::CallbackServerContext*                                 context,
     const ::sdv::edge::comfort::seats::v1::CurrentPositionRequest* request,
     ::sdv::edge::comfort::seats::v1::CurrentPositionReply*         response) {
     (void)context;
@@ -76,26 +76,18 @@ SeatsService::MoveComponent(::grpc::ServerContext*
 
     std::cout << "Got CurrentPosition Request!" << std::endl;
 
-    auto seat          = response->mutable_seat();
-    auto seat_position = seat->mutable_position();
-    try {
-        auto seatPos = vehicle.Cabin.Seat.Row1.DriverSide.Position.get()->await().value();
-
-        std::cout << "Success!!" << std::endl;
-        seat_position->set_base(seatPos);
-        return ::grpc::Status(::grpc::StatusCode::OK, "");
-    } catch (AsyncException& e) {
-        std::cout << "Async Exception!" << std::endl;
-        // This could typically be that Databroker is not running or not reachable
-        // or that your Velocitas environment uses an API incompatible with what your Databroker
-        // instance supports
-        return ::grpc::Status(::grpc::StatusCode::OK, "");
-    } catch (InvalidValueException& e) {
-        std::cout << "Invalid Value!" << std::endl;
-        // This could be given if Databroker has no current value for Position
-        // (Have you set it manually using kuksa-client or databroker-cli?)
-        return ::grpc::Status(::grpc::StatusCode::OK, "");
-    }
+    return finishOnResult(
+        vehicle.Cabin.Seat.Row1.DriverSide.Position.get(), [response](const auto& position) {
+            try {
+                response->mutable_seat()->mutable_position()->set_base(position.value());
+                std::cout << "Success!!" << std::endl;
+            } catch (InvalidValueException& e) {
+                std::cout << "Invalid Value!" << std::endl;
+                // This could be given if Databroker has no current value for Position
+                // (Have you set it manually using kuksa-client or databroker-cli?)
+            }
+            return ::grpc::Status(::grpc::StatusCode::OK, "");
+        });
 }
 
 } // namespace velocitas
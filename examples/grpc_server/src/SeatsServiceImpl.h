@@ -19,31 +19,42 @@
 
 #include "vehicle/Vehicle.hpp"
 #include <grpc/grpc.h>
+#include <sdk/grpc/GrpcServer.h>
 #include <services/seats/seats.grpc.pb.h>
 
 namespace velocitas {
 
-class SeatsService final : public sdv::edge::comfort::seats::v1::Seats::Service {
+/**
+ * Callback based, so the handlers return right away and the calls are finished once the
+ * databroker answered, instead of blocking a server thread per pending request.
+ */
+class SeatsService final : public sdv::edge::comfort::seats::v1::Seats::CallbackService {
 public:
-    SeatsService(){};
-    virtual ~SeatsService(){};
+    explicit SeatsService(const GrpcServerConfig& config = GrpcServerConfig::fromEnvironment());
 
     // <auto-generated>
-    ::grpc::Status Move(::grpc::ServerContext*                              context,
-                        const ::sdv::edge::comfort::seats::v1::MoveRequest* request,
-                        ::sdv::edge::comfort::seats::v1::MoveReply*         response) override;
-    ::grpc::Status
-    MoveComponent(::grpc::ServerContext*                                       context,
+    ::grpc::ServerUnaryReactor* Move(::grpc::CallbackServerContext*                      context,
+                                     const ::sdv::edge::comfort::seats::v1::MoveRequest* request,
+                                     ::sdv::edge::comfort::seats::v1::MoveReply* response) override;
+    ::grpc::ServerUnaryReactor*
+    MoveComponent(::grpc::CallbackServerContext*                               context,
                   const ::sdv::edge::comfort::seats::v1::MoveComponentRequest* request,
                   ::sdv::edge::comfort::seats::v1::MoveComponentReply*         response) override;
-    ::grpc::Status
-    CurrentPosition(::grpc::ServerContext*                                         context,
+    ::grpc::ServerUnaryReactor*
+    CurrentPosition(::grpc::CallbackServerContext*                                 context,
                     const ::sdv::edge::comfort::seats::v1::CurrentPositionRequest* request,
                     ::sdv::edge::comfort::seats::v1::CurrentPositionReply* response) override;
     // </auto-generated>
 
 private:
     vehicle::Vehicle vehicle;
+
+    PooledMessageAllocator<sdv::edge::comfort::seats::v1::MoveRequest,
+                           sdv::edge::comfort::seats::v1::MoveReply>
+        m_moveAllocator;
+    PooledMessageAllocator<sdv::edge::comfort::seats::v1::CurrentPositionRequest,
+                           sdv::edge::comfort::seats::v1::CurrentPositionReply>
+        m_currentPositionAllocator;
 };
 
 } // namespace velocitas
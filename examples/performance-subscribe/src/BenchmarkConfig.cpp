@@ -0,0 +1,128 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "BenchmarkConfig.h"
+#include "sdk/Logger.h"
+
+#include <nlohmann/json.hpp>
+
+#include <fstream>
+#include <map>
+#include <stdexcept>
+
+namespace example {
+
+namespace {
+
+using velocitas::DataPointValue;
+
+SubscriptionTopology parseTopology(const std::string& topology) {
+    if (topology == "per-signal") {
+        return SubscriptionTopology::PER_SIGNAL;
+    }
+    if (topology == "multiplexed") {
+        return SubscriptionTopology::MULTIPLEXED;
+    }
+    throw std::runtime_error("Unknown subscription topology '" + topology +
+                             "' (expected 'per-signal' or 'multiplexed')");
+}
+
+// type names as used by the VSS
+DataPointValue::Type parseType(const std::string& type) {
+    static const std::map<std::string, DataPointValue::Type> TYPES{
+        {"boolean", DataPointValue::Type::BOOL},    {"int8", DataPointValue::Type::INT8},
+        {"int16", DataPointValue::Type::INT16},     {"int32", DataPointValue::Type::INT32},
+        {"int64", DataPointValue::Type::INT64},     {"uint8", DataPointValue::Type::UINT8},
+        {"uint16", DataPointValue::Type::UINT16},   {"uint32", DataPointValue::Type::UINT32},
+        {"uint64", DataPointValue::Type::UINT64},   {"float", DataPointValue::Type::FLOAT},
+        {"double", DataPointValue::Type::DOUBLE},   {"string", DataPointValue::Type::STRING},
+    };
+    const auto iter = TYPES.find(type);
+    if (iter == TYPES.end()) {
+        throw std::runtime_error("Unsupported feeder signal type '" + type + "'");
+    }
+    return iter->second;
+}
+
+std::vector<std::string> parseSignals(const nlohmann::json& signalList) {
+    std::vector<std::string> signalNames;
+    signalNames.reserve(signalList.size());
+    for (const auto& signal : signalList) {
+        const std::string& signalName = signal["path"];
+        if (!signalName.empty()) {
+            velocitas::logger().debug("{}", signalName);
+            signalNames.push_back(signalName);
+        } else {
+            velocitas::logger().warn("Signal entry without 'path' found!");
+        }
+    }
+    return signalNames;
+}
+
+FeederConfig parseFeeder(const nlohmann::json& feeder) {
+    FeederConfig config;
+    config.m_isEnabled = feeder.value("enabled", config.m_isEnabled);
+    config.m_rate      = feeder.value("rate", config.m_rate);
+    if (config.m_rate <= 0.0) {
+        throw std::runtime_error("The feeder rate needs to be positive");
+    }
+    for (const auto& signal : feeder.value("signals", nlohmann::json::array())) {
+        config.m_signals.push_back(
+            FeederSignal{signal.at("path"), parseType(signal.value("type", "float"))});
+    }
+    return config;
+}
+
+} // anonymous namespace
+
+BenchmarkConfig BenchmarkConfig::fromFile(const std::string& configFile) {
+    velocitas::logger().info("Reading benchmark configuration from file {}.", configFile);
+    const auto config = nlohmann::json::parse(std::ifstream(configFile));
+
+    BenchmarkConfig benchmarkConfig;
+    benchmarkConfig.m_signals = parseSignals(config["signals"]);
+
+    const auto benchmark = config.value("benchmark", nlohmann::json::object());
+    benchmarkConfig.m_label = benchmark.value("label", benchmarkConfig.m_label);
+    if (benchmark.contains("topology")) {
+        benchmarkConfig.m_topology = parseTopology(benchmark["topology"]);
+    }
+    benchmarkConfig.m_warmUpDuration = std::chrono::seconds{
+        benchmark.value("warmUpSeconds", benchmarkConfig.m_warmUpDuration.count())};
+    benchmarkConfig.m_measurementDuration = std::chrono::seconds{
+        benchmark.value("measurementSeconds", benchmarkConfig.m_measurementDuration.count())};
+    benchmarkConfig.m_latencyTracingInterval =
+        benchmark.value("latencyTracingInterval", benchmarkConfig.m_latencyTracingInterval);
+    benchmarkConfig.m_isPrintingValues =
+        benchmark.value("printValues", benchmarkConfig.m_isPrintingValues);
+    benchmarkConfig.m_reportFile = benchmark.value("reportFile", benchmarkConfig.m_reportFile);
+    if (benchmark.contains("feeder")) {
+        benchmarkConfig.m_feeder = parseFeeder(benchmark["feeder"]);
+    }
+    return benchmarkConfig;
+}
+
+std::string toString(SubscriptionTopology topology) {
+    switch (topology) {
+    case SubscriptionTopology::PER_SIGNAL:
+        return "per-signal";
+    case SubscriptionTopology::MULTIPLEXED:
+        return "multiplexed";
+    }
+    return "unknown";
+}
+
+} // namespace example
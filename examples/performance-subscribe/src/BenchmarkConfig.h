@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_BENCHMARKCONFIG_H
+#define VEHICLE_APP_SDK_BENCHMARKCONFIG_H
+
+#include "sdk/DataPointValue.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace example {
+
+/**
+ * @brief How the signals are distributed over subscriptions.
+ */
+enum class SubscriptionTopology {
+    PER_SIGNAL, // One subscription (and databroker stream) per signal
+    MULTIPLEXED // One subscription containing all signals
+};
+
+/**
+ * @brief A signal published by the feeder.
+ */
+struct FeederSignal {
+    std::string                     m_path;
+    velocitas::DataPointValue::Type m_type{velocitas::DataPointValue::Type::FLOAT};
+};
+
+/**
+ * @brief Configuration of the feeder publishing values of the signals during the benchmark.
+ */
+struct FeederConfig {
+    bool                      m_isEnabled{false};
+    /** Number of publish requests per second, each containing all feeder signals */
+    double                    m_rate{100.0};
+    std::vector<FeederSignal> m_signals;
+};
+
+/**
+ * @brief Configuration of a benchmark run, read from subscription_signals.json.
+ */
+struct BenchmarkConfig {
+    /** Free text identifying the run in the report, e.g. the SDK version and preset used */
+    std::string              m_label;
+    std::vector<std::string> m_signals;
+    SubscriptionTopology     m_topology{SubscriptionTopology::PER_SIGNAL};
+    /** Duration before the measurement starts, e.g. to get the connection and caches warm */
+    std::chrono::seconds     m_warmUpDuration{5};
+    /** Duration of the measurement; zero measures until the app gets terminated */
+    std::chrono::seconds     m_measurementDuration{0};
+    /** See SubscriptionOptions::m_latencyTracingInterval */
+    uint32_t                 m_latencyTracingInterval{1};
+    /** Print each received value to the console (as the example did before) */
+    bool                     m_isPrintingValues{false};
+    /** File the JSON report is written to; empty to print it to the console */
+    std::string              m_reportFile;
+    FeederConfig             m_feeder;
+
+    /**
+     * @brief Read the configuration from the given file. Only "signals" is mandatory, all
+     *        settings of the optional "benchmark" object default to the values above.
+     *
+     * @throw std::runtime_error if the file contains invalid settings.
+     */
+    static BenchmarkConfig fromFile(const std::string& configFile);
+};
+
+[[nodiscard]] std::string toString(SubscriptionTopology topology);
+
+} // namespace example
+
+#endif // VEHICLE_APP_SDK_BENCHMARKCONFIG_H
@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "Feeder.h"
+#include "sdk/Logger.h"
+
+#include <chrono>
+#include <string>
+#include <utility>
+
+namespace example {
+
+namespace {
+
+using velocitas::DataPointValue;
+using velocitas::TypedDataPointValue;
+
+template <typename T>
+std::unique_ptr<DataPointValue> createValue(const std::string& path, T value) {
+    return std::make_unique<TypedDataPointValue<T>>(path, std::move(value));
+}
+
+// Each tick changes the values, so the updates are not dropped as duplicates anywhere.
+std::unique_ptr<DataPointValue> createValue(const FeederSignal& signal, uint64_t tick) {
+    const auto& path = signal.m_path;
+    switch (signal.m_type) {
+    case DataPointValue::Type::BOOL:
+        return createValue(path, tick % 2 == 1);
+    case DataPointValue::Type::INT8:
+        return createValue(path, static_cast<int8_t>(tick % 100));
+    case DataPointValue::Type::INT16:
+        return createValue(path, static_cast<int16_t>(tick % 10000));
+    case DataPointValue::Type::INT32:
+        return createValue(path, static_cast<int32_t>(tick % 1000000));
+    case DataPointValue::Type::INT64:
+        return createValue(path, static_cast<int64_t>(tick));
+    case DataPointValue::Type::UINT8:
+        return createValue(path, static_cast<uint8_t>(tick % 200));
+    case DataPointValue::Type::UINT16:
+        return createValue(path, static_cast<uint16_t>(tick % 60000));
+    case DataPointValue::Type::UINT32:
+        return createValue(path, static_cast<uint32_t>(tick % 1000000));
+    case DataPointValue::Type::UINT64:
+        return createValue(path, static_cast<uint64_t>(tick));
+    case DataPointValue::Type::DOUBLE:
+        return createValue(path, static_cast<double>(tick % 1000000) / 10.0);
+    case DataPointValue::Type::STRING:
+        return createValue(path, std::to_string(tick));
+    default:
+        return createValue(path, static_cast<float>(tick % 10000) / 10.0F);
+    }
+}
+
+} // anonymous namespace
+
+Feeder::Feeder(std::shared_ptr<velocitas::IVehicleDataBrokerClient> client, FeederConfig config)
+    : m_client(std::move(client))
+    , m_config(std::move(config)) {}
+
+Feeder::~Feeder() { stop(); }
+
+void Feeder::start() {
+    velocitas::logger().info("Feeding {} signal(s) at {} requests/s", m_config.m_signals.size(),
+                             m_config.m_rate);
+    m_thread = std::thread([this]() { run(); });
+}
+
+void Feeder::stop() {
+    {
+        std::lock_guard lock(m_mutex);
+        m_isStopping = true;
+    }
+    m_stopCondition.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+void Feeder::run() {
+    const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>{1.0 / m_config.m_rate});
+    const auto startTime = std::chrono::steady_clock::now();
+    for (uint64_t tick = 0;; ++tick) {
+        {
+            // fixed schedule, so a late tick does not shift the following ones
+            std::unique_lock lock(m_mutex);
+            if (m_stopCondition.wait_until(lock, startTime + tick * period,
+                                           [this]() { return m_isStopping; })) {
+                return;
+            }
+        }
+        m_client->setDatapoints(createValues(tick), velocitas::SetMode::PUBLISH)
+            ->onResult([this](const auto& errors) {
+                ++m_numPublished;
+                if (!errors.empty()) {
+                    ++m_numFailed;
+                    velocitas::logger().warn("Feeder: publishing {} failed: {}",
+                                             errors.begin()->first, errors.begin()->second);
+                }
+            })
+            ->onError([this](const velocitas::Status& status) {
+                ++m_numFailed;
+                velocitas::logger().warn("Feeder: publishing failed: {}", status.errorMessage());
+            });
+    }
+}
+
+std::vector<std::unique_ptr<DataPointValue>> Feeder::createValues(uint64_t tick) const {
+    std::vector<std::unique_ptr<DataPointValue>> values;
+    values.reserve(m_config.m_signals.size());
+    for (const auto& signal : m_config.m_signals) {
+        values.push_back(createValue(signal, tick));
+    }
+    return values;
+}
+
+} // namespace example
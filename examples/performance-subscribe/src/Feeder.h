@@ -0,0 +1,75 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_FEEDER_H
+#define VEHICLE_APP_SDK_FEEDER_H
+
+#include "BenchmarkConfig.h"
+#include "sdk/vdb/IVehicleDataBrokerClient.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace example {
+
+/**
+ * @brief Publishes changing values of the configured signals at a fixed rate, acting as the
+ * provider of the signals the benchmark subscribes to. It uses a client of its own, so its
+ * requests do not share a connection with the measured subscriptions.
+ */
+class Feeder {
+public:
+    Feeder(std::shared_ptr<velocitas::IVehicleDataBrokerClient> client, FeederConfig config);
+    ~Feeder();
+
+    void start();
+    void stop();
+
+    /** Number of completed publish requests */
+    [[nodiscard]] uint64_t getNumPublished() const { return m_numPublished.load(); }
+
+    /** Number of failed publish requests, including ones with errors for single signals */
+    [[nodiscard]] uint64_t getNumFailed() const { return m_numFailed.load(); }
+
+    Feeder(const Feeder&)            = delete;
+    Feeder(Feeder&&)                 = delete;
+    Feeder& operator=(const Feeder&) = delete;
+    Feeder& operator=(Feeder&&)      = delete;
+
+private:
+    void run();
+
+    [[nodiscard]] std::vector<std::unique_ptr<velocitas::DataPointValue>>
+    createValues(uint64_t tick) const;
+
+    std::shared_ptr<velocitas::IVehicleDataBrokerClient> m_client;
+    const FeederConfig                                   m_config;
+    std::thread                                          m_thread;
+    std::mutex                                           m_mutex;
+    std::condition_variable                              m_stopCondition;
+    bool                                                 m_isStopping{false};
+    std::atomic<uint64_t>                                m_numPublished{0};
+    std::atomic<uint64_t>                                m_numFailed{0};
+};
+
+} // namespace example
+
+#endif // VEHICLE_APP_SDK_FEEDER_H
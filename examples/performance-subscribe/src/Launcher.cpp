@@ -14,17 +14,14 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include "BenchmarkConfig.h"
 #include "PerformanceTestApp.h"
 #include "sdk/Logger.h"
 
-#include <nlohmann/json.hpp>
-
 #include <csignal>
 #include <filesystem>
-#include <fstream>
 #include <memory>
 #include <string>
-#include <vector>
 
 namespace {
 
@@ -43,25 +40,6 @@ std::string getDefaultConfigFilePath(const char* appBinaryPath) {
     return std::string{path};
 }
 
-std::vector<std::string> readSignalNameFromFiles(const std::string& configFile) {
-    velocitas::logger().info("Reading signal list from file {}.", configFile);
-    const auto  config     = nlohmann::json::parse(std::ifstream(configFile));
-    const auto& signalList = config["signals"];
-
-    std::vector<std::string> signalNames;
-    signalNames.reserve(signalList.size());
-    for (const auto& signal : signalList) {
-        const std::string& signalName = signal["path"];
-        if (!signalName.empty()) {
-            velocitas::logger().debug("{}", signalName);
-            signalNames.push_back(signalName);
-        } else {
-            velocitas::logger().warn("Signal entry without 'path' found!");
-        }
-    }
-    return signalNames;
-}
-
 } // anonymous namespace
 
 int main(int argc, char** argv) {
@@ -69,9 +47,12 @@ int main(int argc, char** argv) {
 
     const auto configFile =
         (argc > 1) ? std::filesystem::path(argv[1]).string() : getDefaultConfigFilePath(argv[0]);
-    auto signalList = readSignalNameFromFiles(configFile);
+    auto config = example::BenchmarkConfig::fromFile(configFile);
+    if (argc > 2) {
+        config.m_reportFile = argv[2];
+    }
 
-    myApp = std::make_unique<example::PerformanceTestApp>(std::move(signalList));
+    myApp = std::make_unique<example::PerformanceTestApp>(std::move(config));
     myApp->run();
     return 0;
 }
@@ -15,19 +15,30 @@
  */
 
 #include "PerformanceTestApp.h"
-#include "sdk/IPubSubClient.h"
 #include "sdk/Logger.h"
 #include "sdk/vdb/IVehicleDataBrokerClient.h"
 
 #include <fmt/chrono.h>
 #include <fmt/core.h>
 
+#include <algorithm>
 #include <chrono>
+#include <fstream>
+#include <optional>
+#include <string>
 #include <utility>
 
 namespace example {
 
 namespace {
+
+// Longer than the coalescing delay of the kuksa.val.v2 client, so each subscription of the
+// per-signal topology opens a stream of its own instead of sharing one.
+constexpr std::chrono::milliseconds PER_SIGNAL_SUBSCRIBE_INTERVAL{25};
+
+// Latencies recorded beyond are counted but not kept, bounding the memory used by long runs
+constexpr size_t MAX_LATENCY_SAMPLES = 10'000'000;
+
 std::string getValueRepresentation(const velocitas::DataPointValue& value) {
     if (!value.isValid()) {
         return toString(value.getFailure());
@@ -41,26 +52,306 @@ template <typename TTimeBase> TTimeBase getTimestamp() {
     return std::chrono::duration_cast<TTimeBase>(timeSinceEpoch);
 }
 
+double toMicroseconds(uint64_t nanoseconds) { return static_cast<double>(nanoseconds) / 1000.0; }
+
+// expects the latencies to be sorted
+nlohmann::json createLatencyReport(const std::vector<uint64_t>& latencies) {
+    if (latencies.empty()) {
+        return {{"count", 0}};
+    }
+    const auto getPercentile = [&latencies](double percentile) {
+        const auto index = static_cast<size_t>(percentile / 100.0 *
+                                               static_cast<double>(latencies.size()));
+        return toMicroseconds(latencies[std::min(index, latencies.size() - 1)]);
+    };
+    uint64_t sum{0};
+    for (const auto latency : latencies) {
+        sum += latency;
+    }
+    return {{"count", latencies.size()},
+            {"meanUs", toMicroseconds(sum) / static_cast<double>(latencies.size())},
+            {"p50Us", getPercentile(50.0)},
+            {"p99Us", getPercentile(99.0)},
+            {"p999Us", getPercentile(99.9)},
+            {"maxUs", toMicroseconds(latencies.back())}};
+}
+
+// The percentiles of histograms are the upper bounds of their (power of 2 sized) buckets.
+nlohmann::json createLatencyReport(const velocitas::HistogramSnapshot& histogram) {
+    return {{"count", histogram.count},
+            {"meanUs", histogram.getMean() / 1000.0},
+            {"p50Us", toMicroseconds(histogram.getPercentile(50.0))},
+            {"p99Us", toMicroseconds(histogram.getPercentile(99.0))},
+            {"p999Us", toMicroseconds(histogram.getPercentile(99.9))},
+            {"maxUs", toMicroseconds(histogram.max)}};
+}
+
+void merge(velocitas::HistogramSnapshot& target, const velocitas::HistogramSnapshot& source) {
+    if (source.count == 0) {
+        return;
+    }
+    target.min = target.count == 0 ? source.min : std::min(target.min, source.min);
+    target.max = std::max(target.max, source.max);
+    target.count += source.count;
+    target.sum += source.sum;
+    for (size_t i = 0; i < target.buckets.size(); ++i) {
+        target.buckets[i] += source.buckets[i];
+    }
+}
+
+void merge(velocitas::LatencyMetrics& target, const velocitas::LatencyMetrics& source) {
+    target.numUpdates += source.numUpdates;
+    target.numTracedUpdates += source.numTracedUpdates;
+    merge(target.brokerLatency, source.brokerLatency);
+    merge(target.decodeLatency, source.decodeLatency);
+    merge(target.enqueueLatency, source.enqueueLatency);
+    merge(target.dispatchLatency, source.dispatchLatency);
+    merge(target.executionTime, source.executionTime);
+    merge(target.totalLatency, source.totalLatency);
+}
+
 } // anonymous namespace
 
-PerformanceTestApp::PerformanceTestApp(std::vector<std::string> signalList)
+PerformanceTestApp::PerformanceTestApp(BenchmarkConfig config)
     : VehicleApp(velocitas::IVehicleDataBrokerClient::createInstance("vehicledatabroker"))
-    , m_signalList{std::move(signalList)} {}
+    , m_config{std::move(config)}
+    , m_clockOffsetEstimator(getVehicleDataBrokerClient()->getClockOffsetEstimator()) {
+    if (m_config.m_feeder.m_isEnabled) {
+        m_feeder = std::make_unique<Feeder>(
+            velocitas::IVehicleDataBrokerClient::createInstance("vehicledatabroker"),
+            m_config.m_feeder);
+    }
+}
+
+PerformanceTestApp::~PerformanceTestApp() {
+    onStop();
+    if (m_phaseController.joinable()) {
+        m_phaseController.join();
+    }
+}
 
 void PerformanceTestApp::onStart() {
-    velocitas::logger().info("Subscribing to signals ...");
-    for (auto path : m_signalList) {
-        subscribeDataPoints("SELECT " + path)
-            ->onItem([path](const velocitas::DataPointReply& reply) {
-                const auto value     = getValueRepresentation(*reply.getUntyped(path));
-                const auto timestamp = getTimestamp<std::chrono::microseconds>();
-                fmt::print("{:%T} - {} - {}\n", timestamp, path, value);
-            })
-            ->onError([path](const velocitas::Status& status) {
-                velocitas::logger().error("Error on subscription for data point {}: {}", path,
-                                          status.errorMessage());
-            });
+    m_phaseController = std::thread([this]() { runPhases(); });
+}
+
+void PerformanceTestApp::onStop() {
+    {
+        std::lock_guard lock(m_stopMutex);
+        m_isStopping = true;
+    }
+    m_stopCondition.notify_all();
+}
+
+void PerformanceTestApp::runPhases() {
+    subscribe();
+    if (m_feeder) {
+        m_feeder->start();
+    }
+    velocitas::logger().info("Warming up for {} s ...", m_config.m_warmUpDuration.count());
+    bool                         isStopped = waitFor(m_config.m_warmUpDuration);
+    std::optional<ResourceUsage> endUsage;
+    if (!isStopped) {
+        startMeasurement();
+        isStopped     = waitFor(m_config.m_measurementDuration);
+        m_isMeasuring = false;
+        endUsage      = ResourceUsage::sample();
+    }
+    if (m_feeder) {
+        m_feeder->stop();
+    }
+    // a run stopped during the warm-up has nothing to report
+    if (endUsage) {
+        writeReport(createReport(*endUsage));
+    }
+    if (!isStopped) {
+        stop();
+    }
+}
+
+void PerformanceTestApp::subscribe() {
+    velocitas::logger().info("Subscribing to {} signals ({}) ...", m_config.m_signals.size(),
+                             toString(m_config.m_topology));
+    if (m_config.m_topology == SubscriptionTopology::MULTIPLEXED) {
+        std::string query;
+        for (const auto& path : m_config.m_signals) {
+            query += query.empty() ? "SELECT " : ", ";
+            query += path;
+        }
+        subscribe(query);
+        return;
+    }
+    for (const auto& path : m_config.m_signals) {
+        subscribe("SELECT " + path);
+        std::this_thread::sleep_for(PER_SIGNAL_SUBSCRIBE_INTERVAL);
+    }
+}
+
+void PerformanceTestApp::subscribe(const std::string& query) {
+    velocitas::SubscriptionOptions options;
+    options.m_latencyTracingInterval = m_config.m_latencyTracingInterval;
+    auto subscription                = subscribeDataPoints(query, options);
+    subscription->onItem([this](const velocitas::DataPointReply& reply) { onReply(reply); })
+        ->onError([query](const velocitas::Status& status) {
+            velocitas::logger().error("Error on subscription {}: {}", query,
+                                      status.errorMessage());
+        });
+    m_subscriptions.push_back(std::move(subscription));
+}
+
+void PerformanceTestApp::onReply(const velocitas::DataPointReply& reply) {
+    const auto receivedAt       = std::chrono::steady_clock::now();
+    const auto systemReceivedAt = std::chrono::system_clock::now();
+    if (m_config.m_isPrintingValues) {
+        const auto timestamp = getTimestamp<std::chrono::microseconds>();
+        for (const auto& entry : reply) {
+            if (velocitas::DataPointReply::wasUpdated(entry)) {
+                fmt::print("{:%T} - {} - {}\n", timestamp, entry.getPath(),
+                           getValueRepresentation(*velocitas::DataPointReply::getUntyped(entry)));
+            }
+        }
+    }
+    if (!m_isMeasuring.load()) {
+        return;
+    }
+    ++m_numReplies;
+
+    // full state replies contain the signals which did not change as well
+    std::vector<uint64_t> latencies;
+    for (const auto& entry : reply) {
+        if (!velocitas::DataPointReply::wasUpdated(entry)) {
+            continue;
+        }
+        ++m_numValues;
+        const auto& timestamp = velocitas::DataPointReply::getSample(entry).getTimestamp();
+        if (timestamp.seconds == 0 && timestamp.nanos == 0) {
+            continue;
+        }
+        // the broker's clock is only compared against the system clock if not estimated yet
+        auto latency = m_clockOffsetEstimator
+                           ? m_clockOffsetEstimator->getLatency(timestamp, receivedAt)
+                           : std::nullopt;
+        if (!latency) {
+            const std::chrono::system_clock::time_point sentAt{
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                    std::chrono::seconds{timestamp.seconds} +
+                    std::chrono::nanoseconds{timestamp.nanos})};
+            latency =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(systemReceivedAt - sentAt);
+        }
+        latencies.push_back(static_cast<uint64_t>(std::max<int64_t>(0, latency->count())));
+    }
+    std::lock_guard lock(m_latencyMutex);
+    const auto numKept = std::min(latencies.size(), MAX_LATENCY_SAMPLES - m_latencies.size());
+    m_latencies.insert(m_latencies.end(), latencies.begin(), latencies.begin() + numKept);
+}
+
+void PerformanceTestApp::startMeasurement() {
+    if (m_config.m_measurementDuration.count() > 0) {
+        velocitas::logger().info("Measuring for {} s ...", m_config.m_measurementDuration.count());
+    } else {
+        velocitas::logger().info("Measuring until the app is stopped ...");
+    }
+    for (const auto& subscription : m_subscriptions) {
+        if (const auto& tracer = subscription->getLatencyTracer()) {
+            tracer->reset();
+        }
+    }
+    {
+        std::lock_guard lock(m_latencyMutex);
+        m_latencies.clear();
+    }
+    m_numReplies  = 0;
+    m_numValues   = 0;
+    m_startUsage  = ResourceUsage::sample();
+    m_isMeasuring = true;
+}
+
+bool PerformanceTestApp::waitFor(std::chrono::seconds duration) {
+    std::unique_lock lock(m_stopMutex);
+    if (duration.count() == 0) {
+        m_stopCondition.wait(lock, [this]() { return m_isStopping; });
+        return true;
+    }
+    return m_stopCondition.wait_for(lock, duration, [this]() { return m_isStopping; });
+}
+
+nlohmann::json PerformanceTestApp::createReport(const ResourceUsage& endUsage) {
+    const auto duration =
+        std::chrono::duration<double>(endUsage.m_sampledAt - m_startUsage.m_sampledAt).count();
+    std::vector<uint64_t> latencies;
+    {
+        std::lock_guard lock(m_latencyMutex);
+        latencies.swap(m_latencies);
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    velocitas::LatencyMetrics sdkLatencies;
+    for (const auto& subscription : m_subscriptions) {
+        if (const auto& tracer = subscription->getLatencyTracer()) {
+            merge(sdkLatencies, tracer->getMetrics());
+        }
+    }
+
+    const auto cpuTime = std::chrono::duration<double>(
+        (endUsage.m_userCpuTime - m_startUsage.m_userCpuTime) +
+        (endUsage.m_systemCpuTime - m_startUsage.m_systemCpuTime));
+    const auto toSeconds = [](std::chrono::microseconds time) {
+        return std::chrono::duration<double>(time).count();
+    };
+
+    nlohmann::json report;
+    report["label"]  = m_config.m_label;
+    report["config"] = {
+        {"topology", toString(m_config.m_topology)},
+        {"numSignals", m_config.m_signals.size()},
+        {"numSubscriptions", m_subscriptions.size()},
+        {"warmUpSeconds", m_config.m_warmUpDuration.count()},
+        {"latencyTracingInterval", m_config.m_latencyTracingInterval},
+        {"feeder",
+         {{"enabled", m_config.m_feeder.m_isEnabled},
+          {"rate", m_config.m_feeder.m_rate},
+          {"numSignals", m_config.m_feeder.m_signals.size()}}}};
+    report["durationSeconds"] = duration;
+    report["throughput"]      = {
+        {"replies", m_numReplies.load()},
+        {"values", m_numValues.load()},
+        {"repliesPerSecond", static_cast<double>(m_numReplies.load()) / duration},
+        {"valuesPerSecond", static_cast<double>(m_numValues.load()) / duration}};
+    report["latency"]    = createLatencyReport(latencies);
+    if (const auto offset =
+            m_clockOffsetEstimator ? m_clockOffsetEstimator->getOffset() : std::nullopt) {
+        report["clockOffset"] = {{"estimatedNanos", offset->count()},
+                                 {"numSamples", m_clockOffsetEstimator->getNumSamples()}};
+    }
+    report["sdkLatency"] = {
+        {"numTracedUpdates", sdkLatencies.numTracedUpdates},
+        {"broker", createLatencyReport(sdkLatencies.brokerLatency)},
+        {"decode", createLatencyReport(sdkLatencies.decodeLatency)},
+        {"enqueue", createLatencyReport(sdkLatencies.enqueueLatency)},
+        {"dispatch", createLatencyReport(sdkLatencies.dispatchLatency)},
+        {"callback", createLatencyReport(sdkLatencies.executionTime)},
+        {"total", createLatencyReport(sdkLatencies.totalLatency)}};
+    if (m_feeder) {
+        report["feeder"] = {{"published", m_feeder->getNumPublished()},
+                            {"failed", m_feeder->getNumFailed()}};
+    }
+    report["resources"] = {
+        {"cpuUserSeconds", toSeconds(endUsage.m_userCpuTime - m_startUsage.m_userCpuTime)},
+        {"cpuSystemSeconds", toSeconds(endUsage.m_systemCpuTime - m_startUsage.m_systemCpuTime)},
+        {"cpuUtilizationPercent", 100.0 * cpuTime.count() / duration},
+        {"rssKiB", endUsage.m_rssKiB},
+        {"maxRssKiB", endUsage.m_maxRssKiB}};
+    return report;
+}
+
+void PerformanceTestApp::writeReport(const nlohmann::json& report) const {
+    const auto text = report.dump(2);
+    if (m_config.m_reportFile.empty()) {
+        fmt::print("{}\n", text);
+        return;
     }
+    std::ofstream(m_config.m_reportFile) << text << '\n';
+    velocitas::logger().info("Benchmark report written to {}", m_config.m_reportFile);
 }
 
 } // namespace example
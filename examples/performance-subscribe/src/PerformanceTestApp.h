@@ -17,24 +17,75 @@
 #ifndef VEHICLE_APP_SDK_PERFORMANCETESTAPP_H
 #define VEHICLE_APP_SDK_PERFORMANCETESTAPP_H
 
+#include "BenchmarkConfig.h"
+#include "Feeder.h"
+#include "ResourceUsage.h"
+#include "sdk/ClockOffsetEstimator.h"
 #include "sdk/VehicleApp.h"
 
-#include <string>
+#include <nlohmann/json.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 namespace example {
 
 /**
- * @brief
+ * @brief Benchmark of the subscription path: subscribes to the configured signals, optionally
+ * feeds them itself and, after a warm-up phase, measures throughput, latency and resource usage
+ * of the updates. The results are reported as JSON once the measurement phase ends or the app
+ * gets stopped.
  */
 class PerformanceTestApp : public velocitas::VehicleApp {
 public:
-    explicit PerformanceTestApp(std::vector<std::string> signalList);
+    explicit PerformanceTestApp(BenchmarkConfig config);
+    ~PerformanceTestApp() override;
 
     void onStart() override;
+    void onStop() override;
+
+    PerformanceTestApp(const PerformanceTestApp&)            = delete;
+    PerformanceTestApp(PerformanceTestApp&&)                 = delete;
+    PerformanceTestApp& operator=(const PerformanceTestApp&) = delete;
+    PerformanceTestApp& operator=(PerformanceTestApp&&)      = delete;
 
 private:
-    std::vector<std::string> m_signalList;
+    void runPhases();
+    void subscribe();
+    void subscribe(const std::string& query);
+    void onReply(const velocitas::DataPointReply& reply);
+    void startMeasurement();
+    /** @return true if the app got stopped while waiting */
+    bool waitFor(std::chrono::seconds duration);
+
+    [[nodiscard]] nlohmann::json createReport(const ResourceUsage& endUsage);
+    void                         writeReport(const nlohmann::json& report) const;
+
+    using SubscriptionPtr_t = velocitas::AsyncSubscriptionPtr_t<velocitas::DataPointReply>;
+
+    const BenchmarkConfig          m_config;
+    std::unique_ptr<Feeder>        m_feeder;
+    std::vector<SubscriptionPtr_t> m_subscriptions;
+    std::thread                    m_phaseController;
+    std::mutex                     m_stopMutex;
+    std::condition_variable        m_stopCondition;
+    bool                           m_isStopping{false};
+
+    std::atomic_bool      m_isMeasuring{false};
+    std::atomic<uint64_t> m_numReplies{0};
+    std::atomic<uint64_t> m_numValues{0};
+    ResourceUsage         m_startUsage;
+    // broker timestamp until the callback, in nanoseconds
+    std::mutex            m_latencyMutex;
+    std::vector<uint64_t> m_latencies;
+
+    // converts the broker timestamps to the local clock; nullptr if the client has none
+    const velocitas::ClockOffsetEstimatorPtr_t m_clockOffsetEstimator;
 };
 
 } // namespace example
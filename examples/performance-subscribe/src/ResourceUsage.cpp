@@ -0,0 +1,59 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ResourceUsage.h"
+
+#include <sys/resource.h>
+
+#include <fstream>
+#include <string>
+
+namespace example {
+
+namespace {
+
+std::chrono::microseconds toDuration(const timeval& time) {
+    return std::chrono::seconds{time.tv_sec} + std::chrono::microseconds{time.tv_usec};
+}
+
+uint64_t readCurrentRssKiB() {
+    std::ifstream status("/proc/self/status");
+    std::string   line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmRSS:", 0) == 0) {
+            return std::stoull(line.substr(line.find_first_of("0123456789")));
+        }
+    }
+    return 0;
+}
+
+} // anonymous namespace
+
+ResourceUsage ResourceUsage::sample() {
+    ResourceUsage usage;
+    usage.m_sampledAt = std::chrono::steady_clock::now();
+    rusage rawUsage{};
+    if (getrusage(RUSAGE_SELF, &rawUsage) == 0) {
+        usage.m_userCpuTime   = toDuration(rawUsage.ru_utime);
+        usage.m_systemCpuTime = toDuration(rawUsage.ru_stime);
+        // given in KiB on Linux
+        usage.m_maxRssKiB = static_cast<uint64_t>(rawUsage.ru_maxrss);
+    }
+    usage.m_rssKiB = readCurrentRssKiB();
+    return usage;
+}
+
+} // namespace example
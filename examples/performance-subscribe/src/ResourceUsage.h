@@ -0,0 +1,42 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_RESOURCEUSAGE_H
+#define VEHICLE_APP_SDK_RESOURCEUSAGE_H
+
+#include <chrono>
+#include <cstdint>
+
+namespace example {
+
+/**
+ * @brief Resources used by this process up to the point in time the usage was sampled.
+ */
+struct ResourceUsage {
+    std::chrono::steady_clock::time_point m_sampledAt;
+    std::chrono::microseconds             m_userCpuTime{0};
+    std::chrono::microseconds             m_systemCpuTime{0};
+    /** Current resident set size; 0 if unknown */
+    uint64_t                              m_rssKiB{0};
+    /** Peak resident set size */
+    uint64_t                              m_maxRssKiB{0};
+
+    static ResourceUsage sample();
+};
+
+} // namespace example
+
+#endif // VEHICLE_APP_SDK_RESOURCEUSAGE_H
@@ -42,7 +42,9 @@ const auto STATUS_FAIL = 1;
 SeatAdjusterApp::SeatAdjusterApp()
     : VehicleApp(velocitas::IVehicleDataBrokerClient::createInstance("vehicledatabroker"),
                  velocitas::IPubSubClient::createInstance("SeatAdjusterApp"))
-    , m_vehicleModel(std::make_shared<velocitas::Vehicle>()) {}
+    , m_vehicleModel(std::make_shared<velocitas::Vehicle>()) {
+    declareSignals(velocitas::vehicle::getSignalTable());
+}
 
 void SeatAdjusterApp::onStart() {
     velocitas::logger().info("Subscribe for data points!");
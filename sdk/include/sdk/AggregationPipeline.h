@@ -0,0 +1,222 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_AGGREGATIONPIPELINE_H
+#define VEHICLE_APP_SDK_AGGREGATIONPIPELINE_H
+
+#include "sdk/AsyncResult.h"
+#include "sdk/DataPointReply.h"
+#include "sdk/DataPointSample.h"
+#include "sdk/SignalPathRegistry.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace velocitas {
+
+class IPubSubClient;
+class PeriodicJob;
+class ThreadPool;
+
+/**
+ * @brief Aggregates of the valid numeric values a signal got within a window.
+ */
+struct SignalWindowAggregates {
+    std::string path;
+    size_t      count{0};
+    double      sum{0.0};
+    double      mean{0.0};
+    double      min{0.0};
+    double      max{0.0};
+    /** The first and the last value received within the window */
+    double first{0.0};
+    double last{0.0};
+};
+
+/**
+ * @brief The aggregates of all signals having received values within a window of an
+ * AggregationPipeline.
+ */
+struct AggregationWindow {
+    /** Wall clock times the window started and ended at */
+    Timestamp start;
+    Timestamp end;
+    /** The aggregates per signal, ordered by path */
+    std::vector<SignalWindowAggregates> signals;
+};
+
+/**
+ * @brief Serializes a window into the payload to publish.
+ */
+using WindowSerializer_t = std::function<std::string(const AggregationWindow&)>;
+
+/**
+ * @brief Configuration of an AggregationPipeline.
+ */
+struct AggregationPipelineConfig {
+    /** Topic the windows are published to */
+    std::string m_topic;
+
+    /** Length of the windows */
+    std::chrono::milliseconds m_window{1000};
+
+    /** Serializer of the windows; nullptr for AggregationPipeline::toJson */
+    WindowSerializer_t m_serializer;
+
+    /** Whether to publish windows without any value received */
+    bool m_isPublishingEmptyWindows{false};
+
+    /** Maximum number of publishes in flight; 1 publishes the windows strictly in order */
+    size_t m_maxInFlightPublishes{1};
+
+    /** Maximum number of serialized windows waiting for a publish to complete; if it is exceeded,
+     * the oldest waiting window is dropped */
+    size_t m_maxQueuedWindows{8};
+
+    /** Maximum time for a publish to complete, zero for not timing out */
+    std::chrono::milliseconds m_publishTimeout{0};
+};
+
+/**
+ * @brief Counters of an AggregationPipeline since its creation.
+ */
+struct AggregationPipelineMetrics {
+    /** Number of subscription updates received */
+    uint64_t numUpdates{0};
+    /** Number of windows closed, including empty ones not published */
+    uint64_t numWindows{0};
+    uint64_t numPublishedWindows{0};
+    /** Number of windows whose publish failed or timed out */
+    uint64_t numFailedWindows{0};
+    /** Number of windows dropped due to the publisher not keeping up */
+    uint64_t numDroppedWindows{0};
+};
+
+/**
+ * @brief Pipeline aggregating the updates of a subscription per time window and publishing the
+ * serialized aggregates of each window, e.g. to downsample high rate signals for a backend.
+ *
+ * The subscription callbacks only add the received values to the running aggregates of their
+ * signals; each window is closed, serialized and published as a whole by a periodic job of the
+ * SDK's thread pool. The publisher exerts backpressure: at most m_maxInFlightPublishes windows are
+ * published at once, further ones wait in a bounded queue, dropping the oldest one when full, so a
+ * slow or disconnected broker neither blocks the subscription nor lets memory grow.
+ */
+class AggregationPipeline final : public std::enable_shared_from_this<AggregationPipeline> {
+public:
+    /**
+     * @brief Create a pipeline and start aggregating. The pipeline registers the item and error
+     * callbacks of the subscription, which must not have callbacks yet.
+     *
+     * @param subscription  Subscription providing the values, e.g. of
+     *                      VehicleApp::subscribeDataPoints.
+     * @param publisher     Client publishing the windows, e.g. of VehicleApp::getPubSubClient.
+     * @param config        Window, serialization and backpressure of the pipeline.
+     * @param threadPool    Pool executing the window job; nullptr for the default pool.
+     * @throw InvalidValueException if an argument is invalid.
+     */
+    static std::shared_ptr<AggregationPipeline>
+    create(AsyncSubscriptionPtr_t<DataPointReply> subscription,
+           std::shared_ptr<IPubSubClient> publisher, AggregationPipelineConfig config,
+           std::shared_ptr<ThreadPool> threadPool = nullptr);
+
+    /**
+     * @brief Stops the pipeline, see stop.
+     */
+    ~AggregationPipeline();
+
+    /**
+     * @brief Close the current window right away and publish it; the next window starts now.
+     */
+    void flush();
+
+    /**
+     * @brief Cancel the subscription and stop closing windows, after publishing the current
+     * window. Publishes in flight or queued are still completed.
+     */
+    void stop();
+
+    [[nodiscard]] AggregationPipelineMetrics getMetrics() const;
+
+    /**
+     * @brief Serialize a window to a JSON object of the form
+     *        {"start": <ms since epoch>, "end": <ms since epoch>,
+     *         "signals": {"<path>": {"count", "sum", "mean", "min", "max", "first", "last"}}}
+     */
+    [[nodiscard]] static std::string toJson(const AggregationWindow& window);
+
+    AggregationPipeline(const AggregationPipeline&)            = delete;
+    AggregationPipeline(AggregationPipeline&&)                 = delete;
+    AggregationPipeline& operator=(const AggregationPipeline&) = delete;
+    AggregationPipeline& operator=(AggregationPipeline&&)      = delete;
+
+private:
+    struct Accumulator {
+        size_t count{0};
+        double sum{0.0};
+        double min{0.0};
+        double max{0.0};
+        double first{0.0};
+        double last{0.0};
+    };
+
+    AggregationPipeline(AsyncSubscriptionPtr_t<DataPointReply> subscription,
+                        std::shared_ptr<IPubSubClient> publisher, AggregationPipelineConfig config);
+
+    void start(const std::shared_ptr<ThreadPool>& threadPool);
+    void accumulate(const DataPointReply& reply);
+    void closeWindow();
+    void enqueue(std::string payload);
+    void publish(std::string payload);
+    void onPublished(bool isSuccessful);
+
+    const AggregationPipelineConfig        m_config;
+    AsyncSubscriptionPtr_t<DataPointReply> m_subscription;
+    std::shared_ptr<IPubSubClient>         m_publisher;
+    std::shared_ptr<PeriodicJob>           m_windowJob;
+
+    std::mutex                                      m_windowMutex;
+    Timestamp                                       m_windowStart;
+    std::unordered_map<SignalHandle_t, Accumulator> m_accumulators;
+    bool                                            m_isStopped{false};
+
+    // serializes the closing of windows; the accumulators of the window being closed
+    std::mutex                                      m_closeMutex;
+    std::unordered_map<SignalHandle_t, Accumulator> m_closedAccumulators;
+
+    std::mutex              m_publishMutex;
+    size_t                  m_numInFlightPublishes{0};
+    std::deque<std::string> m_queuedWindows;
+
+    std::atomic<uint64_t> m_numUpdates{0};
+    std::atomic<uint64_t> m_numWindows{0};
+    std::atomic<uint64_t> m_numPublishedWindows{0};
+    std::atomic<uint64_t> m_numFailedWindows{0};
+    std::atomic<uint64_t> m_numDroppedWindows{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_AGGREGATIONPIPELINE_H
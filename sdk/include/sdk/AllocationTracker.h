@@ -0,0 +1,196 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_ALLOCATIONTRACKER_H
+#define VEHICLE_APP_SDK_ALLOCATIONTRACKER_H
+
+#include "sdk/BuildProfile.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+// the embedded profile tracks the allocations to enforce the memory limit
+#ifndef VELOCITAS_ALLOCATION_TRACKING
+#define VELOCITAS_ALLOCATION_TRACKING VELOCITAS_EMBEDDED_PROFILE
+#endif
+
+namespace velocitas {
+
+/**
+ * @brief Subsystems of the SDK whose heap allocations are accounted separately.
+ */
+enum class AllocationDomain {
+    SUBSCRIPTION_BUFFERS, // Buffers of AsyncSubscription
+    METADATA_CACHE,       // Cached signal metadata and its indices
+    REPLY_MAPS,           // Data point storage of DataPointReply
+    GRPC_CALLS,           // Objects of the active gRPC calls
+    JOBS                  // Jobs submitted to thread pools
+};
+
+constexpr size_t NUM_ALLOCATION_DOMAINS = static_cast<size_t>(AllocationDomain::JOBS) + 1;
+
+/**
+ * @brief Indicates if the SDK subsystems allocate via TrackingAllocator. Set by the CMake option
+ * SDK_ALLOCATION_TRACKING (passed to the compiler as VELOCITAS_ALLOCATION_TRACKING) or implied by
+ * the embedded profile; if off, they use std::allocator and tracking does not cost anything.
+ */
+constexpr bool IS_ALLOCATION_TRACKING_ENABLED = VELOCITAS_ALLOCATION_TRACKING != 0;
+
+/**
+ * @brief Point in time copy of the allocations accounted to one domain.
+ */
+struct AllocationStatistics {
+    uint64_t numAllocations{0};
+    uint64_t numDeallocations{0};
+    /** Sum of the sizes of all allocations */
+    uint64_t allocatedBytes{0};
+    /** Size of the memory currently held, i.e. allocated but not yet deallocated */
+    uint64_t heldBytes{0};
+    /** Maximum of heldBytes since the start of the process or the last reset */
+    uint64_t peakHeldBytes{0};
+};
+
+/**
+ * @brief Process wide accounting of the allocations done via TrackingAllocator.
+ *
+ * Recording is lock-free (a few relaxed atomic operations per allocation). The statistics are
+ * also reported to the MetricsRegistry as sdv_allocations_total, sdv_deallocations_total,
+ * sdv_allocated_bytes_total, sdv_allocation_held_bytes and sdv_allocation_peak_held_bytes,
+ * labeled by subsystem.
+ *
+ * A limit of the bytes held by all domains together caps the heap of the SDK subsystems: an
+ * allocation exceeding it throws MemoryLimitExceededException instead of letting the process grow
+ * until the OS kills it.
+ */
+class AllocationTracker final {
+public:
+    static void recordAllocation(AllocationDomain domain, size_t numBytes) noexcept;
+    static void recordDeallocation(AllocationDomain domain, size_t numBytes) noexcept;
+
+    /**
+     * @brief Check that allocating numBytes for the domain keeps the held bytes of all domains
+     * within the limit. The check is not atomic with the allocation, so concurrent allocations
+     * may exceed the limit by their sizes.
+     *
+     * @throw MemoryLimitExceededException if the limit would be exceeded.
+     */
+    static void checkLimit(AllocationDomain domain, size_t numBytes);
+
+    /**
+     * @brief Set the maximum number of bytes held by all domains together; zero for no limit.
+     * Initially taken from the env var SDV_MEMORY_LIMIT (in bytes, unset for no limit). Only
+     * enforced if allocation tracking is enabled.
+     */
+    static void setLimit(uint64_t maxHeldBytes) noexcept;
+
+    [[nodiscard]] static uint64_t getLimit() noexcept;
+
+    /**
+     * @brief Get the bytes currently held by all domains together.
+     */
+    [[nodiscard]] static uint64_t getTotalHeldBytes() noexcept;
+
+    [[nodiscard]] static AllocationStatistics getStatistics(AllocationDomain domain) noexcept;
+
+    /**
+     * @brief Get the name of the domain, as used for the "subsystem" label of the metrics.
+     */
+    [[nodiscard]] static std::string_view getName(AllocationDomain domain) noexcept;
+
+    /**
+     * @brief Reset the counters of all domains. The held bytes are kept, as the memory is still
+     * held; the peak is set to them.
+     */
+    static void reset() noexcept;
+
+    AllocationTracker() = delete;
+};
+
+/**
+ * @brief Standard conforming allocator accounting its allocations to a domain of the
+ * AllocationTracker. Allocation itself is done via std::allocator.
+ *
+ * @tparam T        Type of the allocated objects.
+ * @tparam TDomain  Domain to account the allocations to.
+ */
+template <typename T, AllocationDomain TDomain> class TrackingAllocator {
+public:
+    using value_type = T;
+
+    template <typename U> struct rebind {
+        using other = TrackingAllocator<U, TDomain>;
+    };
+
+    TrackingAllocator() noexcept = default;
+
+    template <typename U>
+    TrackingAllocator(const TrackingAllocator<U, TDomain>& /*other*/) noexcept {} // NOLINT
+
+    [[nodiscard]] T* allocate(size_t numObjects) {
+        AllocationTracker::checkLimit(TDomain, numObjects * sizeof(T));
+        T* const objects = std::allocator<T>{}.allocate(numObjects);
+        AllocationTracker::recordAllocation(TDomain, numObjects * sizeof(T));
+        return objects;
+    }
+
+    void deallocate(T* objects, size_t numObjects) noexcept {
+        AllocationTracker::recordDeallocation(TDomain, numObjects * sizeof(T));
+        std::allocator<T>{}.deallocate(objects, numObjects);
+    }
+
+    template <typename U>
+    friend bool operator==(const TrackingAllocator& /*lhs*/,
+                           const TrackingAllocator<U, TDomain>& /*rhs*/) noexcept {
+        return true;
+    }
+
+    template <typename U>
+    friend bool operator!=(const TrackingAllocator& /*lhs*/,
+                           const TrackingAllocator<U, TDomain>& /*rhs*/) noexcept {
+        return false;
+    }
+};
+
+/**
+ * @brief Allocator the SDK subsystems use for the given domain: TrackingAllocator if allocation
+ * tracking is enabled, std::allocator otherwise.
+ */
+template <typename T, AllocationDomain TDomain>
+using DomainAllocator_t = std::conditional_t<IS_ALLOCATION_TRACKING_ENABLED,
+                                             TrackingAllocator<T, TDomain>, std::allocator<T>>;
+
+/**
+ * @brief Create a shared object like std::make_shared does, accounting the allocation of object
+ * and control block to the given domain if allocation tracking is enabled.
+ */
+template <AllocationDomain TDomain, typename T, typename... TArgs>
+std::shared_ptr<T> makeSharedIn(TArgs&&... args) {
+    if constexpr (IS_ALLOCATION_TRACKING_ENABLED) {
+        return std::allocate_shared<T>(TrackingAllocator<T, TDomain>{},
+                                       std::forward<TArgs>(args)...);
+    } else {
+        return std::make_shared<T>(std::forward<TArgs>(args)...);
+    }
+}
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_ALLOCATIONTRACKER_H
@@ -17,14 +17,33 @@
 #ifndef VEHICLE_APP_SDK_ASYNCRESULT_H
 #define VEHICLE_APP_SDK_ASYNCRESULT_H
 
+#include "sdk/AllocationTracker.h"
+#include "sdk/BuildProfile.h"
+#include "sdk/CallbackExecutor.h"
 #include "sdk/Exceptions.h"
+#include "sdk/LatencyTracer.h"
+#include "sdk/Metrics.h"
+#include "sdk/RingBuffer.h"
 #include "sdk/Status.h"
+#include "sdk/Strand.h"
+#include "sdk/ThreadPool.h"
+#include "sdk/TraceEvents.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace velocitas {
 
@@ -65,7 +84,8 @@ enum class CallState { ONGOING, CANCELING, COMPLETED, FAILED };
 enum PublishStatus {
     Success, // Message was published successfully
     Timeout, // Publish operation timed out
-    Failure  // Publish operation failed (e.g., exception thrown)
+    Failure, // Publish operation failed (e.g., exception thrown)
+    Queued   // Message was queued offline, to be published after (re)connecting
 };
 
 /**
@@ -74,49 +94,50 @@ enum PublishStatus {
  *
  * @tparam TResultType  Result type of the async operation.
  */
-template <typename TResultType> class AsyncResult {
+template <typename TResultType>
+class AsyncResult : public std::enable_shared_from_this<AsyncResult<TResultType>> {
 public:
+    using ResultType_t     = TResultType;
     using ResultCallback_t = std::function<void(const TResultType&)>;
     using ErrorCallback_t  = std::function<void(Status)>;
 
-    AsyncResult() {
-        // initially lock the mutex until we have written the result.
-        // this will cause await() to block until the result is available.
-        m_mutex.lock();
-    };
+    AsyncResult()                              = default;
+    AsyncResult(const AsyncResult&)            = delete;
+    AsyncResult(AsyncResult&&)                 = delete;
+    AsyncResult& operator=(const AsyncResult&) = delete;
+    AsyncResult& operator=(AsyncResult&&)      = delete;
 
     /**
-     * @brief Inserts the result and notifies any waiters.
+     * @brief Inserts the result and notifies any waiters. Only the first result or error
+     *        inserted is taken into account, further ones are ignored.
      *
      * @param result  Result to insert.
      */
     void insertResult(TResultType&& result) {
-        m_callState = CallState::COMPLETED;
-        if (m_callback != nullptr) {
-            m_callback(result);
-        } else {
-            m_result = std::move(result);
+        if (!claimCompletion()) {
+            return;
         }
-        m_mutex.unlock();
+        m_result = std::move(result);
+        complete(COMPLETED);
     }
 
     /**
-     * @brief Inserts a new error and notifies any waiters.
+     * @brief Inserts a new error and notifies any waiters. Only the first result or error
+     *        inserted is taken into account, further ones are ignored.
      *
      * @param error Status containing error information.
      */
     void insertError(Status&& error) {
-        m_callState = CallState::FAILED;
-        if (m_errorCallback != nullptr) {
-            m_errorCallback(error);
-        } else {
-            m_status = error;
+        if (!claimCompletion()) {
+            return;
         }
-        m_mutex.unlock();
+        m_status = std::move(error);
+        complete(FAILED);
     }
 
     /**
-     * @brief Blocks the calling thread until the result is available.
+     * @brief Blocks the calling thread until the result is available. The result is moved out
+     *        to the caller, hence a result can only be awaited once.
      *
      * @throw AsyncException     if there is any issues during async invocation.
      * @throw std::runtime_error if the API usage is wrong.
@@ -124,63 +145,142 @@ public:
      * @return TResultType    Result of the async operation once it completes.
      */
     TResultType await() {
-        if (m_callback) {
+        auto state = m_state.load(std::memory_order_acquire);
+        if ((state & RESULT_CALLBACK) != 0) {
             throw std::runtime_error(
                 "Invalid usage: Either call await() or register an onResult callback!");
         }
 
-        {
-            ScopedBoolInverter           boolInverter{m_awaiting};
-            std::unique_lock<std::mutex> lock(m_mutex);
+        m_awaiting.store(true);
+        if ((state & (COMPLETED | FAILED)) == 0) {
+            std::unique_lock<std::mutex> lock(m_waitMutex);
+            m_state.fetch_or(WAITING, std::memory_order_acq_rel);
+            m_waitCondition.wait(lock, [this, &state]() {
+                state = m_state.load(std::memory_order_acquire);
+                return (state & (COMPLETED | FAILED)) != 0;
+            });
+        }
+        m_awaiting.store(false);
 
-            if (m_status.ok()) {
-                return m_result;
-            }
-            throw AsyncException(m_status.errorMessage());
+        if ((state & COMPLETED) != 0) {
+            return std::move(m_result);
         }
+        throw AsyncException(m_status.errorMessage());
     }
 
     /**
-     * @brief Calls the specified callback when the result is available.
-     *        The callback invocation is done by a worker thread.
+     * @brief Calls the specified callback when the result is available. If the result is
+     *        already available, the callback is invoked immediately by the calling thread,
+     *        otherwise by the thread inserting the result. Only one callback can be registered.
      *
      * @param callback      The callback to invoke.
+     * @throw std::runtime_error if the result is awaited or a callback is already registered.
      * @return AsyncResult* This for method chaining.
      */
     AsyncResult* onResult(ResultCallback_t callback) {
-        if (m_awaiting) {
+        if (m_awaiting.load()) {
             throw std::runtime_error(
                 "Invalid usage: Either call await() or register an onResult callback!");
         }
-        m_callback = callback;
-        if (m_callState == CallState::COMPLETED) {
-            m_callback(m_result);
+        if ((m_state.load(std::memory_order_acquire) & RESULT_CALLBACK) != 0) {
+            throw std::runtime_error("Invalid usage: onResult callback is already registered!");
+        }
+        m_callback = std::move(callback);
+        if ((m_state.fetch_or(RESULT_CALLBACK, std::memory_order_acq_rel) & COMPLETED) != 0) {
+            invokeResultCallback();
         }
         return this;
     }
 
     /**
-     * @brief Calls the specified callback when an error occurrs during async execution.
-     *        The callback invocation is done by a worker thread.
+     * @brief Calls the specified callback when an error occurrs during async execution. If the
+     *        error is already available, the callback is invoked immediately by the calling
+     *        thread, otherwise by the thread inserting the error. Only one callback can be
+     *        registered.
      *
      * @param callback      The callback to invoke.
+     * @throw std::runtime_error if a callback is already registered.
      * @return AsyncResult* This for method chaining.
      */
     AsyncResult* onError(ErrorCallback_t callback) {
-        m_errorCallback = callback;
-        if (m_callState == CallState::FAILED) {
-            m_errorCallback(m_status);
+        if ((m_state.load(std::memory_order_acquire) & ERROR_CALLBACK) != 0) {
+            throw std::runtime_error("Invalid usage: onError callback is already registered!");
+        }
+        m_errorCallback = std::move(callback);
+        if ((m_state.fetch_or(ERROR_CALLBACK, std::memory_order_acq_rel) & FAILED) != 0) {
+            invokeErrorCallback();
         }
         return this;
     }
 
+    /**
+     * @brief Set the executor running the onResult and onError callbacks. Needs to be set before
+     *        registering the callbacks. If none is set, the callbacks are invoked inline as
+     *        described for onResult and onError. Executors dispatching to a pool hand a copy of
+     *        the result or error to the callback.
+     *
+     * @param executor  The executor to use; nullptr for the default behavior.
+     */
+    void setCallbackExecutor(CallbackExecutorPtr_t executor) {
+        m_callbackExecutor = std::move(executor);
+    }
+
+    [[nodiscard]] const CallbackExecutorPtr_t& getCallbackExecutor() const {
+        return m_callbackExecutor;
+    }
+
+    /**
+     * @brief Cancel the operation providing the result. The result fails right away, and the
+     *        producer is asked to abort the operation and to release the resources held for it
+     *        (e.g. the underlying gRPC call). Has no effect if the result is already available.
+     */
+    void cancel() {
+        if (!claimCompletion()) {
+            return;
+        }
+        std::function<void()> cancellationHandler;
+        {
+            std::lock_guard<std::mutex> lock(m_cancellationMutex);
+            m_isCancelled       = true;
+            cancellationHandler = std::move(m_cancellationHandler);
+        }
+        m_status = Status("Operation cancelled");
+        complete(FAILED);
+        if (cancellationHandler) {
+            cancellationHandler();
+        }
+    }
+
+    /**
+     * @brief Check if the result was cancelled via cancel().
+     */
+    [[nodiscard]] bool isCancelled() const { return m_isCancelled.load(); }
+
+    /**
+     * @brief Set the function aborting the operation if the result is cancelled; to be called by
+     *        producers of the result. If the result is cancelled already, the handler is invoked
+     *        immediately by the calling thread.
+     *
+     * @param handler  The function aborting the operation.
+     */
+    void setCancellationHandler(std::function<void()> handler) {
+        {
+            std::lock_guard<std::mutex> lock(m_cancellationMutex);
+            if (!m_isCancelled) {
+                m_cancellationHandler = std::move(handler);
+                return;
+            }
+        }
+        handler();
+    }
+
     /**
      * @brief Return if the result is currently being awaited.
      *
      * @return true
      * @return false
      */
-    [[nodiscard]] bool isInAwaitingState() const { return m_awaiting; }
+    [[nodiscard]] bool isInAwaitingState() const { return m_awaiting.load(); }
 
     /**
      * @brief Map the result to a different type using the provided mapper function.
@@ -192,48 +292,417 @@ public:
      */
     template <typename TNewType>
     std::shared_ptr<AsyncResult<TNewType>> map(std::function<TNewType(const TResultType&)> mapper) {
-        auto mappedResult = std::make_shared<AsyncResult<TNewType>>();
+        return then(std::move(mapper));
+    }
 
-        onResult([mappedResult, mapper](auto item) { mappedResult->insertResult(mapper(item)); });
+    /**
+     * @brief Continue with the given function once the result is available. Errors are
+     *        propagated to the returned result, exceptions thrown by the function turn into
+     *        errors of the returned result. As only one result callback can be registered, call
+     *        this method at most once per result.
+     *
+     * @tparam TFun     Type of the function; needs to be invocable with const TResultType&.
+     * @param fun       The function to call with the result.
+     * @param executor  Pool to run the function on. If nullptr (default), the function is run
+     *                  inline by the thread completing this result, avoiding a thread hop.
+     * @return AsyncResultPtr_t of the type returned by the function.
+     */
+    template <typename TFun>
+    std::shared_ptr<AsyncResult<std::invoke_result_t<TFun, const TResultType&>>>
+    then(TFun fun, std::shared_ptr<ThreadPool> executor = nullptr) {
+        using TNewType = std::invoke_result_t<TFun, const TResultType&>;
+        auto next      = std::make_shared<AsyncResult<TNewType>>();
+        propagateCancellation(*next);
+        onError([next](Status status) { next->insertError(std::move(status)); });
+        auto continuation = std::make_shared<TFun>(std::move(fun));
+        onResult([next, continuation, executor](const TResultType& item) {
+            if (!executor) {
+                applyThen(*continuation, item, *next);
+                return;
+            }
+            // only a hop to the pool needs its own copy of the result
+            executor->post([next, continuation, item]() { applyThen(*continuation, item, *next); });
+        });
+        return next;
+    }
+
+    /**
+     * @brief Continue with the given asynchronous operation once the result is available. The
+     *        returned result completes with the result of the operation started by the function.
+     *
+     * @tparam TFun     Type of the function; needs to be invocable with const TResultType& and
+     *                  to return an AsyncResultPtr_t.
+     * @param fun       The function starting the next operation.
+     * @param executor  Pool to run the function on. If nullptr (default), the function is run
+     *                  inline by the thread completing this result.
+     * @return AsyncResultPtr_t with the result type of the operation started by the function.
+     */
+    template <typename TFun>
+    std::invoke_result_t<TFun, const TResultType&>
+    flatMap(TFun fun, std::shared_ptr<ThreadPool> executor = nullptr) {
+        using TNextResult = std::invoke_result_t<TFun, const TResultType&>;
+        using TNewType    = typename TNextResult::element_type::ResultType_t;
+        auto next         = std::make_shared<AsyncResult<TNewType>>();
+        propagateCancellation(*next);
+        onError([next](Status status) { next->insertError(std::move(status)); });
+        auto continuation = std::make_shared<TFun>(std::move(fun));
+        onResult([next, continuation, executor](const TResultType& item) {
+            if (!executor) {
+                applyFlatMap(*continuation, item, next);
+                return;
+            }
+            executor->post(
+                [next, continuation, item]() { applyFlatMap(*continuation, item, next); });
+        });
+        return next;
+    }
+
+private:
+    template <typename> friend class AsyncResult;
+
+    // cancelling a continuation's result cancels this result, if it is shared
+    template <typename TNewType> void propagateCancellation(AsyncResult<TNewType>& next) {
+        next.setCancellationHandler([weakThis = this->weak_from_this()]() {
+            if (auto thisPtr = weakThis.lock()) {
+                thisPtr->cancel();
+            }
+        });
+    }
+
+    template <typename TFun, typename TNewType>
+    static void applyThen(TFun& fun, const TResultType& item, AsyncResult<TNewType>& next) {
+        try {
+            next.insertResult(fun(item));
+        } catch (const std::exception& e) {
+            next.insertError(Status(e.what()));
+        }
+    }
+
+    template <typename TFun, typename TNewType>
+    static void applyFlatMap(TFun& fun, const TResultType& item,
+                             const std::shared_ptr<AsyncResult<TNewType>>& next) {
+        std::invoke_result_t<TFun, const TResultType&> innerResult;
+        try {
+            innerResult = fun(item);
+        } catch (const std::exception& e) {
+            next->insertError(Status(e.what()));
+            return;
+        }
+        next->setCancellationHandler(
+            [weakInner = std::weak_ptr<AsyncResult<TNewType>>(innerResult)]() {
+                if (auto inner = weakInner.lock()) {
+                    inner->cancel();
+                }
+            });
+        innerResult->forwardTo(next);
+    }
+
+    // Completes next with the outcome of this result. The forwarding callback is the only
+    // consumer of the result, hence the value is moved on instead of being copied while this
+    // result is alive. A callback executor dispatching to a pool may run the callback after this
+    // result is gone; the callback then gets a copy of its own, which is forwarded.
+    void forwardTo(const std::shared_ptr<AsyncResult>& next) {
+        onError([next](Status status) { next->insertError(std::move(status)); });
+        onResult([weakThis = this->weak_from_this(), next](const TResultType& item) {
+            if (auto thisPtr = weakThis.lock()) {
+                next->insertResult(std::move(thisPtr->m_result));
+            } else {
+                next->insertResult(TResultType(item));
+            }
+        });
+    }
+
+    // Bits of m_state. Completion is claimed first, so only a single thread writes the result
+    // or status. Whoever sets the second one of a DONE / CALLBACK pair invokes the callback.
+    static constexpr uint32_t CLAIMED         = 1U << 0U;
+    static constexpr uint32_t COMPLETED       = 1U << 1U;
+    static constexpr uint32_t FAILED          = 1U << 2U;
+    static constexpr uint32_t RESULT_CALLBACK = 1U << 3U;
+    static constexpr uint32_t ERROR_CALLBACK  = 1U << 4U;
+    static constexpr uint32_t WAITING         = 1U << 5U;
 
-        onError([mappedResult](auto status) { mappedResult->insertError(std::move(status)); });
+    bool claimCompletion() {
+        return (m_state.fetch_or(CLAIMED, std::memory_order_acq_rel) & CLAIMED) == 0;
+    }
 
-        if (m_mutex.try_lock()) {
-            // result already available?!
-            if (m_status.ok()) {
-                mappedResult->insertResult(mapper(m_result));
+    // Callbacks dispatched to a pool get copies, as this result may be gone once they are run.
+    void invokeResultCallback() {
+        if (!m_callbackExecutor) {
+            m_callback(m_result);
+        } else if constexpr (std::is_copy_constructible_v<TResultType>) {
+            if (m_callbackExecutor->getExecution() == CallbackExecution::INLINE) {
+                m_callbackExecutor->execute([this]() { m_callback(m_result); });
             } else {
-                mappedResult->insertError(std::move(m_status));
+                m_callbackExecutor->execute(
+                    [callback = m_callback, result = m_result]() { callback(result); });
             }
+        } else {
+            m_callback(m_result);
         }
+    }
 
-        return mappedResult;
+    void invokeErrorCallback() {
+        if (!m_callbackExecutor) {
+            m_errorCallback(m_status);
+        } else if (m_callbackExecutor->getExecution() == CallbackExecution::INLINE) {
+            m_callbackExecutor->execute([this]() { m_errorCallback(m_status); });
+        } else {
+            m_callbackExecutor->execute(
+                [callback = m_errorCallback, status = m_status]() { callback(status); });
+        }
     }
 
-private:
-    CallState        m_callState{CallState::ONGOING};
-    TResultType      m_result;
-    ResultCallback_t m_callback;
-    ErrorCallback_t  m_errorCallback;
-    std::mutex       m_mutex;
-    bool             m_awaiting{false};
-    Status           m_status{};
+    void complete(uint32_t doneFlag) {
+        const auto previous = m_state.fetch_or(doneFlag, std::memory_order_acq_rel);
+        if (doneFlag == COMPLETED && (previous & RESULT_CALLBACK) != 0) {
+            invokeResultCallback();
+        } else if (doneFlag == FAILED && (previous & ERROR_CALLBACK) != 0) {
+            invokeErrorCallback();
+        }
+        // Only touch the mutex if await() is blocking; keep this last as the awaiter may
+        // release this result as soon as it is woken up.
+        if ((previous & WAITING) != 0) {
+            std::lock_guard<std::mutex> lock(m_waitMutex);
+            m_waitCondition.notify_all();
+        }
+    }
+
+    std::atomic<uint32_t>   m_state{0};
+    std::atomic<bool>       m_awaiting{false};
+    TResultType             m_result{};
+    Status                  m_status{};
+    ResultCallback_t        m_callback;
+    ErrorCallback_t         m_errorCallback;
+    CallbackExecutorPtr_t   m_callbackExecutor;
+    std::mutex              m_waitMutex;
+    std::condition_variable m_waitCondition;
+    std::atomic<bool>       m_isCancelled{false};
+    std::mutex              m_cancellationMutex;
+    std::function<void()>   m_cancellationHandler;
 };
 
 template <typename T> using AsyncResultPtr_t = std::shared_ptr<AsyncResult<T>>;
 
+/**
+ * @brief Shared state of the results combined via whenAll / whenAny. The combined result is part
+ *        of the state, so combining takes a single allocation.
+ *
+ * @tparam TCombined  Result type of the combined result.
+ * @tparam TValues    Type of the values collected from the single results.
+ */
+template <typename TCombined, typename TValues> class CombinedResultState {
+public:
+    explicit CombinedResultState(size_t numPending, TValues values = {})
+        : m_values(std::move(values))
+        , m_numPending(numPending) {}
+
+    [[nodiscard]] AsyncResultPtr_t<TCombined> getCombined(
+        const std::shared_ptr<CombinedResultState>& self) {
+        // aliasing constructor: the combined result keeps the whole state alive
+        return AsyncResultPtr_t<TCombined>(self, &m_combined);
+    }
+
+    AsyncResult<TCombined> m_combined;
+    TValues                m_values;
+    std::atomic_size_t     m_numPending;
+    std::atomic_bool       m_isDone{false};
+};
+
+template <typename... T, size_t... INDICES>
+void registerWhenAllCallbacks(
+    const std::shared_ptr<CombinedResultState<std::tuple<T...>, std::tuple<T...>>>& state,
+    std::index_sequence<INDICES...> /*unused*/, const AsyncResultPtr_t<T>&... results) {
+    (results->onError([state](Status status) {
+        if (!state->m_isDone.exchange(true)) {
+            state->m_combined.insertError(std::move(status));
+        }
+    }),
+     ...);
+    (results->onResult([state](const T& value) {
+        std::get<INDICES>(state->m_values) = value;
+        if (state->m_numPending.fetch_sub(1, std::memory_order_acq_rel) == 1 &&
+            !state->m_isDone.exchange(true)) {
+            state->m_combined.insertResult(std::move(state->m_values));
+        }
+    }),
+     ...);
+}
+
+/**
+ * @brief Combine the given results into one which completes once all of them completed. The
+ *        combined result fails with the first error of any of the given results. The
+ *        continuations are run inline by the completing threads.
+ *
+ * @tparam T        Result types of the given results.
+ * @param results   The results to combine.
+ * @return AsyncResultPtr_t<std::tuple<T...>> holding the results in the order of the arguments.
+ */
+template <typename... T>
+AsyncResultPtr_t<std::tuple<T...>> whenAll(const AsyncResultPtr_t<T>&... results) {
+    using State_t = CombinedResultState<std::tuple<T...>, std::tuple<T...>>;
+    auto state    = std::make_shared<State_t>(sizeof...(T));
+    auto combined = state->getCombined(state);
+    if constexpr (sizeof...(T) == 0) {
+        combined->insertResult({});
+    } else {
+        registerWhenAllCallbacks(state, std::index_sequence_for<T...>{}, results...);
+    }
+    return combined;
+}
+
+/**
+ * @brief Combine the given results of the same type into one which completes once all of them
+ *        completed. The combined result fails with the first error of any of the given results.
+ *
+ * @tparam T        Result type of the given results.
+ * @param results   The results to combine.
+ * @return AsyncResultPtr_t<std::vector<T>> holding the results in the order of the given ones.
+ */
+template <typename T>
+AsyncResultPtr_t<std::vector<T>> whenAll(const std::vector<AsyncResultPtr_t<T>>& results) {
+    using State_t = CombinedResultState<std::vector<T>, std::vector<T>>;
+    auto state    = std::make_shared<State_t>(results.size(), std::vector<T>(results.size()));
+    auto combined = state->getCombined(state);
+    if (results.empty()) {
+        combined->insertResult({});
+        return combined;
+    }
+    for (size_t index = 0; index < results.size(); ++index) {
+        results[index]->onError([state](Status status) {
+            if (!state->m_isDone.exchange(true)) {
+                state->m_combined.insertError(std::move(status));
+            }
+        });
+        results[index]->onResult([state, index](const T& value) {
+            state->m_values[index] = value;
+            if (state->m_numPending.fetch_sub(1, std::memory_order_acq_rel) == 1 &&
+                !state->m_isDone.exchange(true)) {
+                state->m_combined.insertResult(std::move(state->m_values));
+            }
+        });
+    }
+    return combined;
+}
+
+/**
+ * @brief Combine the given results into one which completes with the first of them completing
+ *        successfully. The combined result only fails if all given results failed (with the
+ *        error of the last one).
+ *
+ * @tparam T        Result type of the given results.
+ * @param results   The results to combine.
+ * @return AsyncResultPtr_t<std::pair<size_t, T>> holding the index of the first completed result
+ *         and its value.
+ */
+template <typename T>
+AsyncResultPtr_t<std::pair<size_t, T>> whenAny(const std::vector<AsyncResultPtr_t<T>>& results) {
+    using State_t = CombinedResultState<std::pair<size_t, T>, VoidResult>;
+    auto state    = std::make_shared<State_t>(results.size());
+    auto combined = state->getCombined(state);
+    if (results.empty()) {
+        combined->insertError(Status("whenAny: No results given"));
+        return combined;
+    }
+    for (size_t index = 0; index < results.size(); ++index) {
+        results[index]->onError([state](Status status) {
+            if (state->m_numPending.fetch_sub(1, std::memory_order_acq_rel) == 1 &&
+                !state->m_isDone.exchange(true)) {
+                state->m_combined.insertError(std::move(status));
+            }
+        });
+        results[index]->onResult([state, index](const T& value) {
+            if (!state->m_isDone.exchange(true)) {
+                state->m_combined.insertResult(std::make_pair(index, value));
+            }
+        });
+    }
+    return combined;
+}
+
+/**
+ * @brief Behaviour of a subscription if items arrive faster than they are consumed via next().
+ */
+enum class OverflowPolicy {
+    /** If the buffer is full, the oldest buffered item is dropped */
+    DROP_OLDEST,
+    /** If the buffer is full, the new item is dropped */
+    DROP_NEWEST,
+    /**
+     * All pending items are conflated into a single one holding the latest state. Items providing
+     * a method merge(T&&) (like DataPointReply) are merged, as are shared items pointing to such
+     * items, all others are replaced. This also applies to item callbacks run by an executor:
+     * while an invocation is queued or running, new items are conflated into one pending item,
+     * which is delivered once the invocation returned.
+     */
+    CONFLATE_LATEST
+};
+
+/**
+ * @brief Detects if items of type T can be merged via T::merge(T&&).
+ */
+template <typename T, typename = void> struct IsMergeable : std::false_type {};
+template <typename T>
+struct IsMergeable<T, std::void_t<decltype(std::declval<T&>().merge(std::declval<T&&>()))>>
+    : std::true_type {};
+
+/**
+ * @brief Detects shared immutable items (as delivered by MulticastSubscription) whose pointee
+ *        can be merged; they are conflated into a merged copy.
+ */
+template <typename T> struct IsSharedMergeable : std::false_type {};
+template <typename T> struct IsSharedMergeable<std::shared_ptr<const T>> : IsMergeable<T> {};
+
 /**
  * @brief An asynchronous subscription to a data source which provides
  *        items of type TResultType.
  *
  * @tparam TResultType  Item type of the async subscription.
  */
+namespace detail {
+
+/**
+ * @brief Metrics shared by all subscriptions buffering items for consumers using next().
+ */
+struct SubscriptionBufferMetrics {
+    /** Number of items buffered by a subscription, sampled whenever an item is buffered */
+    Histogram& m_depth;
+    Counter&   m_numDroppedItems;
+
+    static SubscriptionBufferMetrics& get() {
+        static SubscriptionBufferMetrics metrics{
+            MetricsRegistry::getInstance().getHistogram(
+                "sdv_subscription_buffer_depth",
+                "Number of items buffered by a subscription, sampled when buffering an item"),
+            MetricsRegistry::getInstance().getCounter(
+                "sdv_subscription_dropped_items_total",
+                "Number of subscription items dropped because the buffer was full")};
+        return metrics;
+    }
+};
+
+} // namespace detail
+
 template <typename TResultType> class AsyncSubscription {
 public:
-    using ItemCallback_t  = std::function<void(const TResultType&)>;
-    using ErrorCallback_t = std::function<void(Status)>;
+    using ItemCallback_t           = std::function<void(const TResultType&)>;
+    using MovingItemCallback_t     = std::function<void(TResultType&&)>;
+    using SharedItemCallback_t     = std::function<void(std::shared_ptr<const TResultType>)>;
+    using ErrorCallback_t          = std::function<void(Status)>;
+    using SharedSnapshotProvider_t = std::function<std::shared_ptr<const TResultType>()>;
+
+    /** Default number of items buffered for consumers using next() */
+    static constexpr size_t DEFAULT_BUFFER_CAPACITY = PROFILE_SUBSCRIPTION_BUFFER_CAPACITY;
 
-    AsyncSubscription() noexcept = default;
+    /**
+     * @brief Construct a new subscription.
+     *
+     * @param bufferCapacity  Maximum number of items buffered for consumers using next().
+     * @param overflowPolicy  What to do with new items if the buffer is full.
+     */
+    explicit AsyncSubscription(size_t         bufferCapacity = DEFAULT_BUFFER_CAPACITY,
+                               OverflowPolicy overflowPolicy = OverflowPolicy::DROP_OLDEST)
+        : m_bufferedItems(bufferCapacity)
+        , m_overflowPolicy(overflowPolicy) {}
 
     /**
      * @brief Blocks the calling thread until the next item is available
@@ -241,17 +710,82 @@ public:
      * @throw AsyncException if there is any issues during async invocation.
      */
     TResultType next() {
-        std::unique_lock<std::mutex> lock(m_bufferMutex);
-        if (m_bufferedItems.empty()) {
-            m_cv.wait(lock);
+        while (true) {
+            auto item = tryNext();
+            if (item) {
+                return std::move(*item);
+            }
+            std::unique_lock<std::mutex> lock(m_bufferMutex);
+            waitForItem(lock, std::nullopt);
         }
+    }
 
-        if (m_status.ok()) {
-            auto temp = m_bufferedItems.back();
-            m_bufferedItems.pop_back();
-            return temp;
+    /**
+     * @brief Returns the next item if one is available, without blocking.
+     * @throw AsyncException if there is any issues during async invocation.
+     *
+     * @return std::optional<TResultType>  The next item, std::nullopt if none is available.
+     */
+    std::optional<TResultType> tryNext() {
+        throwIfFailed();
+        auto item = m_bufferedItems.tryPop();
+        if (item) {
+            return item;
         }
-        throw AsyncException(m_status.errorMessage());
+        std::lock_guard<std::mutex> lock(m_bufferMutex);
+        return takeConflatedItem();
+    }
+
+    /**
+     * @brief Blocks the calling thread until the next item is available or the timeout expired.
+     * @throw AsyncException if there is any issues during async invocation.
+     *
+     * @param timeout  Maximum time to wait for an item.
+     * @return std::optional<TResultType>  The next item, std::nullopt if the timeout expired.
+     */
+    std::optional<TResultType> nextFor(std::chrono::milliseconds timeout) {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (true) {
+            auto item = tryNext();
+            if (item) {
+                return item;
+            }
+            std::unique_lock<std::mutex> lock(m_bufferMutex);
+            if (!waitForItem(lock, deadline)) {
+                lock.unlock();
+                return tryNext();
+            }
+        }
+    }
+
+    /**
+     * @brief Returns all currently available items (up to the given maximum) at once, without
+     *        blocking.
+     * @throw AsyncException if there is any issues during async invocation.
+     *
+     * @param maxItems  Maximum number of items to return.
+     * @return std::vector<TResultType>  The items in the order they arrived; empty if there are
+     *                                   none.
+     */
+    std::vector<TResultType> drain(size_t maxItems = std::numeric_limits<size_t>::max()) {
+        throwIfFailed();
+        std::vector<TResultType> items;
+        items.reserve(std::min(maxItems, m_bufferedItems.size()));
+        while (items.size() < maxItems) {
+            auto item = m_bufferedItems.tryPop();
+            if (!item) {
+                break;
+            }
+            items.push_back(std::move(*item));
+        }
+        if (items.size() < maxItems) {
+            std::lock_guard<std::mutex> lock(m_bufferMutex);
+            auto                        conflatedItem = takeConflatedItem();
+            if (conflatedItem) {
+                items.push_back(std::move(*conflatedItem));
+            }
+        }
+        return items;
     }
 
     /**
@@ -262,7 +796,38 @@ public:
      * @return AsyncSubscription*   This subscription for method chaining.
      */
     AsyncSubscription* onItem(ItemCallback_t callback) {
-        m_callback = callback;
+        m_callback = std::make_shared<MovingItemCallback_t>(
+            [callback = std::move(callback)](TResultType&& item) { callback(item); });
+        return this;
+    }
+
+    /**
+     * @brief Calls the specified callback whenever a new item is available, handing over the
+     *        ownership of the item. Use this instead of onItem() if the callback keeps the item,
+     *        to avoid copying it. The callback invocation is done by a worker thread.
+     *
+     * @param callback              The callback to invoke.
+     * @return AsyncSubscription*   This subscription for method chaining.
+     */
+    AsyncSubscription* onItemMoved(MovingItemCallback_t callback) {
+        m_callback = std::make_shared<MovingItemCallback_t>(std::move(callback));
+        return this;
+    }
+
+    /**
+     * @brief Calls the specified callback whenever a new item is available, passing the item as
+     *        an immutable, reference counted object. Use this if the item is handed on to
+     *        several consumers or kept beyond the callback, so it is never copied.
+     *        The callback invocation is done by a worker thread.
+     *
+     * @param callback              The callback to invoke.
+     * @return AsyncSubscription*   This subscription for method chaining.
+     */
+    AsyncSubscription* onItemShared(SharedItemCallback_t callback) {
+        m_callback = std::make_shared<MovingItemCallback_t>(
+            [callback = std::move(callback)](TResultType&& item) {
+                callback(std::make_shared<const TResultType>(std::move(item)));
+            });
         return this;
     }
 
@@ -279,23 +844,89 @@ public:
         return this;
     }
 
+    /**
+     * @brief Set the executor running the item and error callbacks. Needs to be set before
+     *        registering the callbacks. If none is set, the callbacks are invoked inline by the
+     *        thread inserting the items. With a POOL executor the subscription dispatches via
+     *        its own strand of the pool, so its items are still delivered in order.
+     *
+     * @param executor  The executor to use; nullptr for the default behavior.
+     */
+    void setCallbackExecutor(CallbackExecutorPtr_t executor) {
+        m_callbackStrand = nullptr;
+        if (executor && executor->getExecution() == CallbackExecution::POOL) {
+            m_callbackStrand = Strand::create(executor->getThreadPool(), executor->getPriority());
+        }
+        m_callbackExecutor = std::move(executor);
+    }
+
+    [[nodiscard]] const CallbackExecutorPtr_t& getCallbackExecutor() const {
+        return m_callbackExecutor;
+    }
+
+    /**
+     * @brief Indicates if item callbacks are invoked by the thread inserting the items, i.e.
+     *        if they have returned once insertNewItem returns.
+     */
+    [[nodiscard]] bool isDispatchingInline() const {
+        return !m_callbackExecutor ||
+               m_callbackExecutor->getExecution() == CallbackExecution::INLINE;
+    }
+
     /**
      * @brief Inserts new data into the subscription. Notifies any waiters.
      *
      * @param result  Result to insert.
      */
-    void insertNewItem(TResultType&& result) {
-        if (m_callback != nullptr) {
-            m_callback(result);
-        } else {
-            {
-                std::lock_guard<std::mutex> lock(m_bufferMutex);
-                m_bufferedItems.insert(m_bufferedItems.begin(), result);
+    void insertNewItem(TResultType&& result) { insertNewItem(std::move(result), nullptr); }
+
+    /**
+     * @brief Inserts new data into the subscription. Notifies any waiters.
+     *
+     * @param result       Result to insert.
+     * @param onDelivered  Called once the item was handed over, i.e. after the item callback
+     *                     returned or after the item was buffered. Lets producers tell when
+     *                     they may modify shared parts of the item again.
+     */
+    void insertNewItem(TResultType&& result, JobFunction onDelivered) {
+        if (isCancelled()) {
+            if (onDelivered) {
+                onDelivered();
             }
-            m_cv.notify_all();
+            return;
+        }
+        if (m_callback) {
+            dispatchItem(std::move(result), std::move(onDelivered));
+            return;
+        }
+        bufferItem(std::move(result));
+        if (onDelivered) {
+            onDelivered();
         }
     }
 
+    /**
+     * @brief Inserts new data into the subscription, completing the passed trace of it with the
+     *        remaining stages up to the end of the item callback. The trace is recorded by the
+     *        latency tracer of the subscription, or dropped if none is set.
+     *
+     * @param result       Result to insert.
+     * @param onDelivered  See insertNewItem(TResultType&&, JobFunction).
+     * @param trace        The stages passed by the result so far.
+     */
+    void insertNewItem(TResultType&& result, JobFunction onDelivered, LatencyTrace trace) {
+        trace.stamp(LatencyStage::ENQUEUED);
+        // a coalesced item has no invocation of its own, so its trace ends when it is enqueued
+        if (!m_latencyTracer || !m_callback || isCoalescingDeliveries() || isCancelled()) {
+            insertNewItem(std::move(result), std::move(onDelivered));
+            if (m_latencyTracer) {
+                m_latencyTracer->record(trace);
+            }
+            return;
+        }
+        dispatchTracedItem(std::move(result), std::move(onDelivered), trace);
+    }
+
     /**
      * @brief Inserts a new error into the subscription. Notifies any waiters.
      *
@@ -303,27 +934,514 @@ public:
      */
     void insertError(Status&& error) {
         if (m_errorCallback != nullptr) {
-            m_errorCallback(error);
+            if (isDispatchingInline()) {
+                m_errorCallback(error);
+            } else {
+                m_callbackExecutor->execute(
+                    [callback = m_errorCallback, error]() { callback(error); }, m_callbackStrand);
+            }
         } else {
-            m_status = error;
-            m_cv.notify_all();
+            {
+                std::lock_guard<std::mutex> lock(m_bufferMutex);
+                m_status   = error;
+                m_isFailed = true;
+            }
+            notifyWaiters();
+        }
+    }
+
+    /**
+     * @brief Register a function to be called once when the next item (or an error) is
+     *        available for tryNext(). This is meant for asynchronous consumers like coroutines,
+     *        which must not block a thread in next(). Only one function can be registered at a
+     *        time; it is called by the thread inserting the item.
+     *
+     * @param notifier  The function to call.
+     * @return true if the function was registered, false if an item or error is available
+     *         already (the function is not called in this case).
+     */
+    bool notifyOnNextItem(std::function<void()> notifier) {
+        std::lock_guard<std::mutex> lock(m_bufferMutex);
+        if (hasItemOrError()) {
+            return false;
+        }
+        m_numWaiters.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (hasItemOrError()) {
+            m_numWaiters.fetch_sub(1);
+            return false;
+        }
+        m_itemNotifier = std::move(notifier);
+        return true;
+    }
+
+    /**
+     * @brief Cancels the subscription. Buffered items are dropped, new ones are ignored, and the
+     *        producer is asked to stop the underlying stream and to release the resources held
+     *        for the subscription.
+     */
+    void cancel() {
+        std::function<void()> cancellationHandler;
+        {
+            std::lock_guard<std::mutex> lock(m_cancellationMutex);
+            if (m_cancelled.exchange(true)) {
+                return;
+            }
+            cancellationHandler = std::move(m_cancellationHandler);
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_bufferMutex);
+            while (m_bufferedItems.tryPop()) {
+            }
+            m_conflatedItem.reset();
+        }
+        if (cancellationHandler) {
+            cancellationHandler();
+        }
+    }
+
+    /**
+     * @brief Check if the subscription was cancelled. Producers stop delivering items to
+     *        cancelled subscriptions and may release the resources held for them.
+     */
+    [[nodiscard]] bool isCancelled() const { return m_cancelled.load(); }
+
+    /**
+     * @brief Set the function stopping the production of items if the subscription is cancelled;
+     *        to be called by producers of the subscription. If the subscription is cancelled
+     *        already, the handler is invoked immediately by the calling thread.
+     *
+     * @param handler  The function stopping the production.
+     */
+    void setCancellationHandler(std::function<void()> handler) {
+        {
+            std::lock_guard<std::mutex> lock(m_cancellationMutex);
+            if (!m_cancelled) {
+                m_cancellationHandler = std::move(handler);
+                return;
+            }
+        }
+        handler();
+    }
+
+    /**
+     * @brief Check if nobody is able to consume the items of the passed subscription anymore: it
+     *        is cancelled, or no item callback is set and the reference checked is the only one
+     *        left (i.e. the one held by the producer). Producers release such subscriptions like
+     *        cancelled ones, so dropping a subscription consumed via next() stops it as well.
+     */
+    [[nodiscard]] static bool isAbandoned(const std::shared_ptr<AsyncSubscription>& subscription) {
+        return subscription->isCancelled() ||
+               (subscription.use_count() == 1 && !subscription->m_callback);
+    }
+
+    /**
+     * @brief Change the behaviour if items arrive faster than they are consumed via next(), or
+     *        with CONFLATE_LATEST, faster than an item callback run by an executor returns.
+     *
+     * @param overflowPolicy  The new policy.
+     */
+    void setOverflowPolicy(OverflowPolicy overflowPolicy) { m_overflowPolicy = overflowPolicy; }
+
+    [[nodiscard]] OverflowPolicy getOverflowPolicy() const { return m_overflowPolicy.load(); }
+
+    [[nodiscard]] size_t getBufferCapacity() const { return m_bufferedItems.capacity(); }
+
+    /**
+     * @brief Get the number of items dropped because the buffer was full.
+     */
+    [[nodiscard]] uint64_t getNumDroppedItems() const {
+        return m_numDroppedItems.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the number of items which got conflated into a pending one.
+     */
+    [[nodiscard]] uint64_t getNumConflatedItems() const {
+        return m_numConflatedItems.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the strand the items of this subscription are dispatched on. Producers
+     *        delivering items from worker threads post them via this strand, so
+     *        callbacks of one subscription are invoked in order and never concurrently.
+     *        If none was set, a strand on the default thread pool is created.
+     *
+     * @return StrandPtr_t
+     */
+    StrandPtr_t getStrand() {
+        std::lock_guard<std::mutex> lock(m_bufferMutex);
+        if (!m_strand) {
+            m_strand = Strand::create();
+        }
+        return m_strand;
+    }
+
+    /**
+     * @brief Set the strand the items of this subscription are dispatched on.
+     *
+     * @param strand  The strand to use.
+     */
+    void setStrand(StrandPtr_t strand) {
+        std::lock_guard<std::mutex> lock(m_bufferMutex);
+        m_strand = std::move(strand);
+    }
+
+    /**
+     * @brief Get the full current state of the subscribed data source. This is meant for
+     *        producers delivering changes only, so consumers can still query the whole state.
+     *
+     * @return std::optional<TResultType>  The current state, std::nullopt if the producer of
+     *                                     the subscription does not provide one.
+     */
+    std::optional<TResultType> getSnapshot() {
+        auto snapshot = getSharedSnapshot();
+        if (!snapshot) {
+            return std::nullopt;
+        }
+        return *snapshot;
+    }
+
+    /**
+     * @brief Get the full current state like getSnapshot(), but without copying it if the
+     *        producer keeps its state copy-on-write (see setSharedSnapshotProvider). The returned
+     *        state is immutable and stays consistent while the producer continues updating, so it
+     *        can be kept (e.g. to compare the last states) or handed to another thread cheaply.
+     *
+     * @return std::shared_ptr<const TResultType>  The current state, nullptr if the producer of
+     *                                             the subscription does not provide one.
+     */
+    std::shared_ptr<const TResultType> getSharedSnapshot() {
+        SharedSnapshotProvider_t snapshotProvider;
+        {
+            std::lock_guard<std::mutex> lock(m_bufferMutex);
+            snapshotProvider = m_snapshotProvider;
         }
+        if (!snapshotProvider) {
+            return nullptr;
+        }
+        return snapshotProvider();
+    }
+
+    /**
+     * @brief Set the function providing the full current state for getSnapshot(). To be called
+     *        by the producer of the subscription.
+     *
+     * @param snapshotProvider  The function to call; it may be called by any thread.
+     */
+    void setSnapshotProvider(std::function<TResultType()> snapshotProvider) {
+        if (!snapshotProvider) {
+            setSharedSnapshotProvider(nullptr);
+            return;
+        }
+        setSharedSnapshotProvider([snapshotProvider = std::move(snapshotProvider)]() {
+            return std::make_shared<const TResultType>(snapshotProvider());
+        });
     }
 
     /**
-     * @brief Cancels the subscription.
+     * @brief Set the function sharing the full current state for getSnapshot() and
+     *        getSharedSnapshot(). To be called by producers keeping their state copy-on-write,
+     *        i.e. copying it before an update only while a snapshot of it is still referenced.
      *
+     * @param snapshotProvider  The function to call; it may be called by any thread.
      */
-    void cancel() { m_cancelled = true; }
+    void setSharedSnapshotProvider(SharedSnapshotProvider_t snapshotProvider) {
+        std::lock_guard<std::mutex> lock(m_bufferMutex);
+        m_snapshotProvider = std::move(snapshotProvider);
+    }
+
+    /**
+     * @brief Set the tracer recording the latencies of the items of this subscription. To be
+     *        called by the producer of the subscription before inserting the first item.
+     *
+     * @param latencyTracer  The tracer to use; nullptr if the items are not traced.
+     */
+    void setLatencyTracer(LatencyTracerPtr_t latencyTracer) {
+        m_latencyTracer = std::move(latencyTracer);
+    }
+
+    /**
+     * @brief Get the tracer recording the latencies of the items of this subscription, see
+     *        SubscriptionOptions::m_latencyTracingInterval.
+     *
+     * @return LatencyTracerPtr_t  The tracer, nullptr if the items are not traced.
+     */
+    [[nodiscard]] const LatencyTracerPtr_t& getLatencyTracer() const { return m_latencyTracer; }
 
 private:
-    std::vector<TResultType> m_bufferedItems;
-    ItemCallback_t           m_callback;
-    ErrorCallback_t          m_errorCallback;
-    std::mutex               m_bufferMutex;
-    bool                     m_cancelled{false};
-    Status                   m_status{};
-    std::condition_variable  m_cv;
+    // deliveries to an item callback run by an executor with CONFLATE_LATEST
+    struct CoalescedDelivery {
+        std::mutex                 m_mutex;
+        bool                       m_isInFlight{false};
+        std::optional<TResultType> m_pendingItem;
+        // of the items conflated into the pending one
+        std::vector<JobFunction>   m_pendingOnDelivered;
+    };
+
+    void dispatchItem(TResultType&& item, JobFunction onDelivered) {
+        if (!m_callbackExecutor) {
+            VELOCITAS_TRACE_SPAN("app", "AsyncSubscription::callback");
+            (*m_callback)(std::move(item));
+            if (onDelivered) {
+                onDelivered();
+            }
+            return;
+        }
+        if (isCoalescingDeliveries()) {
+            dispatchCoalescedItem(std::move(item), std::move(onDelivered));
+            return;
+        }
+        m_callbackExecutor->execute(
+            [callback = m_callback, item = std::move(item),
+             onDelivered = std::move(onDelivered)]() mutable {
+                VELOCITAS_TRACE_SPAN("app", "AsyncSubscription::callback");
+                (*callback)(std::move(item));
+                if (onDelivered) {
+                    onDelivered();
+                }
+            },
+            m_callbackStrand);
+    }
+
+    [[nodiscard]] bool isCoalescingDeliveries() const {
+        return m_overflowPolicy.load() == OverflowPolicy::CONFLATE_LATEST && !isDispatchingInline();
+    }
+
+    void dispatchCoalescedItem(TResultType&& item, JobFunction onDelivered) {
+        std::shared_ptr<CoalescedDelivery> delivery;
+        {
+            std::lock_guard<std::mutex> lock(m_bufferMutex);
+            if (!m_coalescedDelivery) {
+                m_coalescedDelivery = std::make_shared<CoalescedDelivery>();
+            }
+            delivery = m_coalescedDelivery;
+        }
+        {
+            std::lock_guard<std::mutex> lock(delivery->m_mutex);
+            if (delivery->m_isInFlight) {
+                if (mergeInto(delivery->m_pendingItem, std::move(item))) {
+                    m_numConflatedItems.fetch_add(1, std::memory_order_relaxed);
+                }
+                // the contents are handed over with the pending item
+                if (onDelivered) {
+                    delivery->m_pendingOnDelivered.push_back(std::move(onDelivered));
+                }
+                return;
+            }
+            delivery->m_isInFlight = true;
+        }
+        deliverCoalesced(std::move(delivery), m_callback, m_callbackExecutor, m_callbackStrand,
+                         std::move(item), std::move(onDelivered));
+    }
+
+    // runs the callback for the item and afterwards for the item pending by then, if any; the
+    // invocations may outlive the subscription, so they get all they need passed
+    static void deliverCoalesced(std::shared_ptr<CoalescedDelivery>    delivery,
+                                 std::shared_ptr<MovingItemCallback_t> callback,
+                                 CallbackExecutorPtr_t executor, StrandPtr_t strand,
+                                 TResultType&& item, JobFunction onDelivered) {
+        // the executor is moved into the invocation, which keeps it alive
+        auto& executorRef = *executor;
+        executorRef.execute(
+            [delivery = std::move(delivery), callback = std::move(callback),
+             executor = std::move(executor), strand, item = std::move(item),
+             onDelivered = std::move(onDelivered)]() mutable {
+                try {
+                    VELOCITAS_TRACE_SPAN("app", "AsyncSubscription::callback");
+                    (*callback)(std::move(item));
+                } catch (...) {
+                    completeCoalescedDelivery(delivery, callback, executor, strand);
+                    throw;
+                }
+                if (onDelivered) {
+                    onDelivered();
+                }
+                completeCoalescedDelivery(delivery, callback, executor, strand);
+            },
+            strand);
+    }
+
+    static void completeCoalescedDelivery(const std::shared_ptr<CoalescedDelivery>&    delivery,
+                                          const std::shared_ptr<MovingItemCallback_t>& callback,
+                                          const CallbackExecutorPtr_t&                 executor,
+                                          const StrandPtr_t&                           strand) {
+        std::optional<TResultType> pendingItem;
+        std::vector<JobFunction>   pendingOnDelivered;
+        {
+            std::lock_guard<std::mutex> lock(delivery->m_mutex);
+            pendingItem.swap(delivery->m_pendingItem);
+            pendingOnDelivered.swap(delivery->m_pendingOnDelivered);
+            delivery->m_isInFlight = pendingItem.has_value();
+        }
+        if (!pendingItem) {
+            return;
+        }
+        JobFunction onDelivered;
+        if (!pendingOnDelivered.empty()) {
+            onDelivered = [pendingOnDelivered = std::move(pendingOnDelivered)]() mutable {
+                for (auto& function : pendingOnDelivered) {
+                    function();
+                }
+            };
+        }
+        deliverCoalesced(delivery, callback, executor, strand, std::move(*pendingItem),
+                         std::move(onDelivered));
+    }
+
+    void dispatchTracedItem(TResultType&& item, JobFunction onDelivered, LatencyTrace trace) {
+        auto invocation = [callback = m_callback, tracer = m_latencyTracer, item = std::move(item),
+                           onDelivered = std::move(onDelivered), trace]() mutable {
+            trace.stamp(LatencyStage::CALLBACK_START);
+            {
+                VELOCITAS_TRACE_SPAN("app", "AsyncSubscription::callback");
+                (*callback)(std::move(item));
+            }
+            trace.stamp(LatencyStage::CALLBACK_END);
+            tracer->record(trace);
+            if (onDelivered) {
+                onDelivered();
+            }
+        };
+        if (!m_callbackExecutor) {
+            invocation();
+            return;
+        }
+        m_callbackExecutor->execute(std::move(invocation), m_callbackStrand);
+    }
+
+    void bufferItem(TResultType&& result) {
+        auto& metrics = detail::SubscriptionBufferMetrics::get();
+        switch (m_overflowPolicy.load()) {
+        case OverflowPolicy::DROP_OLDEST:
+            while (!m_bufferedItems.tryPush(std::move(result))) {
+                if (m_bufferedItems.tryPop()) {
+                    m_numDroppedItems.fetch_add(1, std::memory_order_relaxed);
+                    metrics.m_numDroppedItems.increment();
+                }
+            }
+            metrics.m_depth.record(m_bufferedItems.size());
+            break;
+        case OverflowPolicy::DROP_NEWEST:
+            if (!m_bufferedItems.tryPush(std::move(result))) {
+                m_numDroppedItems.fetch_add(1, std::memory_order_relaxed);
+                metrics.m_numDroppedItems.increment();
+                return;
+            }
+            metrics.m_depth.record(m_bufferedItems.size());
+            break;
+        case OverflowPolicy::CONFLATE_LATEST:
+            conflateItem(std::move(result));
+            break;
+        }
+        // Pairs with the increment of m_numWaiters by the consumers: either we see the waiter
+        // here or the waiter sees our item before going to sleep.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_numWaiters.load() > 0) {
+            notifyWaiters();
+        }
+    }
+
+    std::optional<TResultType> takeConflatedItem() {
+        std::optional<TResultType> item;
+        item.swap(m_conflatedItem);
+        return item;
+    }
+
+    // returns false if the deadline expired before an item became available
+    bool waitForItem(std::unique_lock<std::mutex>&                        lock,
+                     std::optional<std::chrono::steady_clock::time_point> deadline) {
+        const auto hasItemOrError = [this]() { return this->hasItemOrError(); };
+        m_numWaiters.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        bool hasItem = true;
+        if (deadline) {
+            hasItem = m_cv.wait_until(lock, *deadline, hasItemOrError);
+        } else {
+            m_cv.wait(lock, hasItemOrError);
+        }
+        m_numWaiters.fetch_sub(1);
+        return hasItem;
+    }
+
+    // to be called with m_bufferMutex being locked
+    [[nodiscard]] bool hasItemOrError() const {
+        return m_isFailed.load() || !m_bufferedItems.empty() || m_conflatedItem.has_value();
+    }
+
+    void notifyWaiters() {
+        std::function<void()> itemNotifier;
+        {
+            std::lock_guard<std::mutex> lock(m_bufferMutex);
+            m_cv.notify_all();
+            if (m_itemNotifier) {
+                itemNotifier   = std::move(m_itemNotifier);
+                m_itemNotifier = nullptr;
+                m_numWaiters.fetch_sub(1);
+            }
+        }
+        if (itemNotifier) {
+            itemNotifier();
+        }
+    }
+
+    void conflateItem(TResultType&& item) {
+        std::lock_guard<std::mutex> lock(m_bufferMutex);
+        if (mergeInto(m_conflatedItem, std::move(item))) {
+            m_numConflatedItems.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // returns false if there was no pending item to conflate the item into
+    static bool mergeInto(std::optional<TResultType>& pendingItem, TResultType&& item) {
+        if (!pendingItem) {
+            pendingItem.emplace(std::move(item));
+            return false;
+        }
+        if constexpr (IsMergeable<TResultType>::value) {
+            pendingItem->merge(std::move(item));
+        } else if constexpr (IsSharedMergeable<TResultType>::value) {
+            using Item_t = typename TResultType::element_type;
+            auto merged  = std::make_shared<std::remove_const_t<Item_t>>(**pendingItem);
+            merged->merge(std::remove_const_t<Item_t>(*item));
+            *pendingItem = std::move(merged);
+        } else {
+            *pendingItem = std::move(item);
+        }
+        return true;
+    }
+
+    void throwIfFailed() {
+        if (m_isFailed.load()) {
+            std::lock_guard<std::mutex> lock(m_bufferMutex);
+            throw AsyncException(m_status.errorMessage());
+        }
+    }
+
+    RingBuffer<TResultType,
+               DomainAllocator_t<TResultType, AllocationDomain::SUBSCRIPTION_BUFFERS>>
+                                          m_bufferedItems;
+    std::optional<TResultType>            m_conflatedItem;
+    std::atomic<OverflowPolicy>           m_overflowPolicy;
+    std::atomic<uint64_t>                 m_numDroppedItems{0};
+    std::atomic<uint64_t>                 m_numConflatedItems{0};
+    std::shared_ptr<MovingItemCallback_t> m_callback;
+    ErrorCallback_t                       m_errorCallback;
+    CallbackExecutorPtr_t                 m_callbackExecutor;
+    StrandPtr_t                           m_callbackStrand;
+    std::mutex                            m_bufferMutex;
+    std::atomic_bool                      m_cancelled{false};
+    std::mutex                            m_cancellationMutex;
+    std::function<void()>                 m_cancellationHandler;
+    Status                                m_status{};
+    std::atomic_bool                      m_isFailed{false};
+    std::atomic_size_t                    m_numWaiters{0};
+    std::condition_variable               m_cv;
+    std::function<void()>                 m_itemNotifier;
+    StrandPtr_t                           m_strand;
+    SharedSnapshotProvider_t              m_snapshotProvider;
+    LatencyTracerPtr_t                    m_latencyTracer;
+    std::shared_ptr<CoalescedDelivery>    m_coalescedDelivery;
 };
 
 template <typename T> using AsyncSubscriptionPtr_t = std::shared_ptr<AsyncSubscription<T>>;
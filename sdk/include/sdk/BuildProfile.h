@@ -0,0 +1,59 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_BUILDPROFILE_H
+#define VEHICLE_APP_SDK_BUILDPROFILE_H
+
+#include <cstddef>
+
+#ifndef VELOCITAS_EMBEDDED_PROFILE
+#define VELOCITAS_EMBEDDED_PROFILE 0
+#endif
+
+namespace velocitas {
+
+/**
+ * @brief Indicates if the SDK is built with the low-footprint profile for small ECUs. Set by the
+ * CMake option SDK_PROFILE=embedded (passed to the compiler as VELOCITAS_EMBEDDED_PROFILE).
+ *
+ * The embedded profile shrinks the defaults below and enables allocation tracking, so the heap
+ * held by the SDK subsystems can be capped via AllocationTracker::setLimit.
+ */
+constexpr bool IS_EMBEDDED_PROFILE = VELOCITAS_EMBEDDED_PROFILE != 0;
+
+/**
+ * @brief Name of the profile the SDK is built with, e.g. for labelling measurements.
+ */
+constexpr const char* BUILD_PROFILE_NAME = IS_EMBEDDED_PROFILE ? "embedded" : "default";
+
+/**
+ * @brief Default number of items buffered by a subscription.
+ */
+constexpr size_t PROFILE_SUBSCRIPTION_BUFFER_CAPACITY = IS_EMBEDDED_PROFILE ? 16 : 256;
+
+/**
+ * @brief Default number of worker threads of a thread pool.
+ */
+constexpr size_t PROFILE_NUM_WORKER_THREADS = IS_EMBEDDED_PROFILE ? 1 : 2;
+
+/**
+ * @brief Number of jobs the job pool grows by when it is exhausted.
+ */
+constexpr size_t PROFILE_JOB_POOL_GROWTH = IS_EMBEDDED_PROFILE ? 16 : 64;
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_BUILDPROFILE_H
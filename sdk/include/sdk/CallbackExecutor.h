@@ -0,0 +1,223 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_CALLBACKEXECUTOR_H
+#define VEHICLE_APP_SDK_CALLBACKEXECUTOR_H
+
+#include "sdk/EventLoop.h"
+#include "sdk/Executor.h"
+#include "sdk/Histogram.h"
+#include "sdk/JobFunction.h"
+#include "sdk/Strand.h"
+#include "sdk/ThreadPool.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace velocitas {
+
+/**
+ * @brief Where the callbacks of results and subscriptions are executed.
+ */
+enum class CallbackExecution {
+    INLINE, // By the thread delivering the result or item, e.g. a gRPC thread: lowest latency,
+            // but a slow callback delays all further deliveries of that thread
+    POOL,   // By the workers of a thread pool, isolating the callbacks from the delivering
+            // threads; the items of a subscription are still delivered in order
+    STRAND,    // Via a strand shared by all users of the executor, so their callbacks are executed
+               // in order and never concurrently
+    EVENT_LOOP, // By the thread running an event loop, so all callbacks (and everything else
+                // posted to the loop) run on one thread in the order they were delivered
+    EXECUTOR    // By an executor of the app, e.g. wrapping the io_context of another framework;
+                // the order of the callbacks is the one the executor runs posted functions in
+};
+
+/**
+ * @brief Snapshot of the metrics collected by a callback executor since its creation or the last
+ * call of CallbackExecutor::resetMetrics. Durations are given in nanoseconds.
+ */
+struct CallbackExecutorMetrics {
+    /** Time from a result or item being delivered until its callback started */
+    HistogramSnapshot dispatchLatency;
+    /** Duration of the callback executions */
+    HistogramSnapshot executionTime;
+};
+
+/**
+ * @brief Execution policy of the callbacks of results and subscriptions.
+ *
+ * An executor can be shared by any number of results, subscriptions and clients. It measures the
+ * dispatch latency and the execution time of all callbacks executed by it, so the metrics of
+ * executors used for different groups of signals show which policy suits each group.
+ */
+class CallbackExecutor final : public std::enable_shared_from_this<CallbackExecutor> {
+public:
+    using Clock_t = std::chrono::steady_clock;
+
+    /**
+     * @brief Create an executor running the callbacks inline by the delivering threads.
+     */
+    static std::shared_ptr<CallbackExecutor> createInline();
+
+    /**
+     * @brief Create an executor running the callbacks on the given named thread pool.
+     *
+     * @param poolName  Name of the pool, see ThreadPool::getInstance.
+     * @param priority  Priority class the callbacks are scheduled with on the pool.
+     */
+    static std::shared_ptr<CallbackExecutor>
+    createPool(const std::string& poolName = ThreadPool::DEFAULT_POOL,
+               JobPriority        priority = JobPriority::NORMAL);
+
+    /**
+     * @brief Get the executor shared by all subscriptions declaring the given priority class
+     * without an executor of their own, running the callbacks on the default pool. Sharing it
+     * makes its metrics show the dispatch latency of the whole class.
+     *
+     * @param priority  The priority class.
+     */
+    static const std::shared_ptr<CallbackExecutor>& getPriorityInstance(JobPriority priority);
+
+    /**
+     * @brief Create an executor running the callbacks serialized via the given strand.
+     *
+     * @param strand  The strand to use. If nullptr, a new strand on the default pool is used.
+     */
+    static std::shared_ptr<CallbackExecutor> createStrand(StrandPtr_t strand = nullptr);
+
+    /**
+     * @brief Create an executor running the callbacks by the given event loop.
+     *
+     * @param eventLoop  The loop to post the callbacks to.
+     */
+    static std::shared_ptr<CallbackExecutor> createEventLoop(EventLoopPtr_t eventLoop);
+
+    /**
+     * @brief Create an executor posting the callbacks to the given executor.
+     *
+     * @param executor  The executor to post the callbacks to.
+     * @throw InvalidValueException if no executor is passed.
+     */
+    static std::shared_ptr<CallbackExecutor> createExecutor(ExecutorPtr_t executor);
+
+    [[nodiscard]] CallbackExecution getExecution() const { return m_execution; }
+
+    /**
+     * @brief Get the priority class the callbacks are scheduled with; NORMAL unless executed by
+     * a pool or strand of another class.
+     */
+    [[nodiscard]] JobPriority getPriority() const { return m_priority; }
+
+    /**
+     * @brief Get the pool executing the callbacks; nullptr if they are executed inline or by an
+     * event loop.
+     */
+    [[nodiscard]] const std::shared_ptr<ThreadPool>& getThreadPool() const { return m_threadPool; }
+
+    /**
+     * @brief Get the event loop executing the callbacks; nullptr for all other executions.
+     */
+    [[nodiscard]] const EventLoopPtr_t& getEventLoop() const { return m_eventLoop; }
+
+    /**
+     * @brief Get the executor the callbacks are posted to; nullptr for all other executions.
+     */
+    [[nodiscard]] const ExecutorPtr_t& getExecutor() const { return m_executor; }
+
+    /**
+     * @brief Execute the given callback according to the execution policy.
+     *
+     * @tparam TFun    Type of the callback; invocable without arguments.
+     * @param fun      The callback to execute.
+     * @param strand   Only used by POOL executors: if not nullptr, the callback is posted via
+     *                 this strand of the pool, keeping the order of the callbacks of one result
+     *                 or subscription.
+     */
+    template <typename TFun> void execute(TFun&& fun, const StrandPtr_t& strand = nullptr) {
+        const auto deliveredAt = Clock_t::now();
+        if (m_execution == CallbackExecution::INLINE) {
+            invoke(fun, deliveredAt);
+            return;
+        }
+        post(
+            [self = shared_from_this(), fun = std::forward<TFun>(fun), deliveredAt]() mutable {
+                self->invoke(fun, deliveredAt);
+            },
+            strand);
+    }
+
+    /**
+     * @brief Get the metrics collected by the executor. They are recorded using lock-free
+     * histograms, so they are cheap enough to be always enabled.
+     *
+     * @return CallbackExecutorMetrics
+     */
+    [[nodiscard]] CallbackExecutorMetrics getMetrics() const;
+
+    /**
+     * @brief Restart collecting metrics, e.g. at the start of a new monitoring interval.
+     */
+    void resetMetrics();
+
+    CallbackExecutor(const CallbackExecutor&)            = delete;
+    CallbackExecutor(CallbackExecutor&&)                 = delete;
+    CallbackExecutor& operator=(const CallbackExecutor&) = delete;
+    CallbackExecutor& operator=(CallbackExecutor&&)      = delete;
+
+    ~CallbackExecutor() = default;
+
+private:
+    CallbackExecutor(CallbackExecution execution, std::shared_ptr<ThreadPool> threadPool,
+                     StrandPtr_t strand, EventLoopPtr_t eventLoop = nullptr,
+                     JobPriority priority = JobPriority::NORMAL, ExecutorPtr_t executor = nullptr);
+
+    template <typename TFun> void invoke(TFun& fun, Clock_t::time_point deliveredAt) {
+        const auto startedAt = Clock_t::now();
+        m_dispatchLatency.record(toNanoseconds(startedAt - deliveredAt));
+        try {
+            fun();
+        } catch (...) {
+            m_executionTime.record(toNanoseconds(Clock_t::now() - startedAt));
+            throw;
+        }
+        m_executionTime.record(toNanoseconds(Clock_t::now() - startedAt));
+    }
+
+    void post(JobFunction job, const StrandPtr_t& strand);
+
+    static uint64_t toNanoseconds(Clock_t::duration duration) {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    }
+
+    const CallbackExecution           m_execution;
+    const std::shared_ptr<ThreadPool> m_threadPool;
+    const StrandPtr_t                 m_strand;
+    const EventLoopPtr_t              m_eventLoop;
+    const JobPriority                 m_priority;
+    const ExecutorPtr_t               m_executor;
+    Histogram                         m_dispatchLatency;
+    Histogram                         m_executionTime;
+};
+
+using CallbackExecutorPtr_t = std::shared_ptr<CallbackExecutor>;
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_CALLBACKEXECUTOR_H
@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#ifndef VEHICLE_APP_SDK_CLOCKOFFSETESTIMATOR_H
+#define VEHICLE_APP_SDK_CLOCKOFFSETESTIMATOR_H
+
+#include "sdk/DataPointValue.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace velocitas {
+
+/**
+ * @brief Estimates the offset between the wall clock the databroker's timestamps are taken from
+ * and the local monotonic clock, to convert broker timestamps to local time points, e.g. for
+ * measuring the latency of updates without relying on the system clocks being in sync.
+ *
+ * Each sample is a broker timestamp and the local time its message was received at. As the
+ * timestamp was taken before the message was received, every sample bounds the offset from
+ * below; the estimate is the tightest bound, i.e. the one of the sample with the least delay,
+ * plus half of the shortest round trip seen (samples of a request's response, e.g. GetValues,
+ * also provide the time it was sent at). Stale timestamps (e.g. of signals not updated lately)
+ * only loosen their own bound, so they do not distort the estimate.
+ *
+ * Only the samples of the latest window are considered, so the estimate follows the clocks
+ * drifting apart, or the broker's clock being set.
+ */
+class ClockOffsetEstimator final {
+public:
+    using Clock_t = std::chrono::steady_clock;
+
+    static constexpr std::chrono::seconds DEFAULT_WINDOW{60};
+
+    /**
+     * @brief Construct a new estimator.
+     *
+     * @param window  Time the samples are considered for, relative to the latest sample.
+     * @throw InvalidValueException if the window is shorter than a millisecond.
+     */
+    explicit ClockOffsetEstimator(Clock_t::duration window = DEFAULT_WINDOW);
+
+    /**
+     * @brief Add the sample of a response, whose broker timestamp was taken before it was
+     * received (not necessarily after the request was sent).
+     *
+     * @param sentAt      Time the request was sent at.
+     * @param brokerTime  The newest broker timestamp contained in the response.
+     * @param receivedAt  Time the response was received at.
+     */
+    void addRoundTrip(Clock_t::time_point sentAt, const Timestamp& brokerTime,
+                      Clock_t::time_point receivedAt);
+
+    /**
+     * @brief Add the sample of an unsolicited message, e.g. a subscription update.
+     *
+     * @param brokerTime  The newest broker timestamp contained in the message.
+     * @param receivedAt  Time the message was received at.
+     */
+    void addOneWay(const Timestamp& brokerTime, Clock_t::time_point receivedAt);
+
+    /**
+     * @brief Get the estimated offset: the broker time since the epoch minus the local time since
+     * the epoch of Clock_t.
+     *
+     * @return std::nullopt if there is no sample within the window.
+     */
+    [[nodiscard]] std::optional<std::chrono::nanoseconds> getOffset() const;
+
+    /**
+     * @brief Convert a broker timestamp to the local time point it was taken at.
+     *
+     * @return std::nullopt if there is no estimate yet, or the timestamp is not set.
+     */
+    [[nodiscard]] std::optional<Clock_t::time_point> toLocal(const Timestamp& brokerTime) const;
+
+    /**
+     * @brief Get the time between a broker timestamp and a local time point, e.g. the latency of
+     * an update received at that time point.
+     *
+     * @return std::nullopt if there is no estimate yet, or the timestamp is not set.
+     */
+    [[nodiscard]] std::optional<std::chrono::nanoseconds>
+    getLatency(const Timestamp& brokerTime, Clock_t::time_point receivedAt) const;
+
+    [[nodiscard]] uint64_t getNumSamples() const;
+
+    ClockOffsetEstimator(const ClockOffsetEstimator&)            = delete;
+    ClockOffsetEstimator(ClockOffsetEstimator&&)                 = delete;
+    ClockOffsetEstimator& operator=(const ClockOffsetEstimator&) = delete;
+    ClockOffsetEstimator& operator=(ClockOffsetEstimator&&)      = delete;
+    ~ClockOffsetEstimator()                                      = default;
+
+private:
+    // the window slides in steps of a bucket, so expiring samples costs no more than a bucket
+    static constexpr size_t NUM_BUCKETS = 8;
+
+    struct Bucket {
+        int64_t                index{-1};
+        int64_t                maxLowerBound{0};
+        std::optional<int64_t> minRoundTrip;
+    };
+
+    void addSample(int64_t lowerBound, std::optional<int64_t> roundTrip,
+                   Clock_t::time_point receivedAt);
+
+    const int64_t                   m_bucketNanos;
+    mutable std::mutex              m_mutex;
+    std::array<Bucket, NUM_BUCKETS> m_buckets;
+    int64_t                         m_latestIndex{-1};
+    uint64_t                        m_numSamples{0};
+};
+
+using ClockOffsetEstimatorPtr_t = std::shared_ptr<ClockOffsetEstimator>;
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_CLOCKOFFSETESTIMATOR_H
@@ -0,0 +1,293 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_COLUMNARBATCH_H
+#define VEHICLE_APP_SDK_COLUMNARBATCH_H
+
+#include "sdk/DataPointSample.h"
+#include "sdk/DataPointValue.h"
+#include "sdk/SignalPathRegistry.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+// Structures of the Arrow C data interface, see
+// https://arrow.apache.org/docs/format/CDataInterface.html. They are ABI stable and meant to be
+// copied verbatim, guarded by ARROW_C_DATA_INTERFACE to coexist with other definitions.
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+extern "C" {
+
+struct ArrowSchema {
+    // Array type description
+    const char*          format;
+    const char*          name;
+    const char*          metadata;
+    int64_t              flags;
+    int64_t              n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema*  dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowSchema*);
+    // Opaque producer-specific data
+    void* private_data;
+};
+
+struct ArrowArray {
+    // Array data description
+    int64_t             length;
+    int64_t             null_count;
+    int64_t             offset;
+    int64_t             n_buffers;
+    int64_t             n_children;
+    const void**        buffers;
+    struct ArrowArray** children;
+    struct ArrowArray*  dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowArray*);
+    // Opaque producer-specific data
+    void* private_data;
+};
+
+} // extern "C"
+
+#endif // ARROW_C_DATA_INTERFACE
+
+namespace velocitas {
+
+class DataPointReply;
+
+/**
+ * @brief Column oriented batch of data point samples, for consumers processing signal data in
+ *        bulk (e.g. analytics or upload). Samples are appended to one column per signal, which
+ *        stores the timestamps, a validity bitmap and the values in contiguous buffers laid out
+ *        as specified by the Arrow columnar format, without any per-value allocation.
+ *
+ *        The buffers of a column are:
+ *        - timestamps: nanoseconds since the epoch, one per row
+ *        - validity:   bitmap (least significant bit first), bit set if the row holds a value
+ *        - values:     fixed width values (bools as bitmap); of the elements for array types
+ *        - offsets:    strings: row to char data offsets; arrays: row to element offsets
+ *        - element offsets: string arrays only, element to char data offsets
+ *        - char data:  UTF-8 bytes of strings
+ *
+ *        Not thread-safe; a batch filled by a subscription handler needs to be guarded by the
+ *        application if it is read from another thread.
+ */
+class ColumnarBatch final {
+public:
+    /**
+     * @brief All samples of one signal contained in the batch.
+     */
+    class Column final {
+    public:
+        /**
+         * @brief Construct an empty column.
+         *
+         * @param handle  The interned handle of the signal's path.
+         * @param type    The type of the signal. If INVALID, it is taken from the first valid
+         *                sample appended.
+         */
+        Column(SignalHandle_t handle, DataPointValue::Type type);
+
+        [[nodiscard]] SignalHandle_t       getHandle() const { return m_handle; }
+        [[nodiscard]] const std::string&   getPath() const;
+        [[nodiscard]] DataPointValue::Type getType() const { return m_type; }
+
+        /**
+         * @brief Get the number of rows, i.e. samples appended to the column.
+         */
+        [[nodiscard]] size_t size() const { return m_timestamps.size(); }
+        [[nodiscard]] bool   empty() const { return m_timestamps.empty(); }
+
+        /**
+         * @brief Get the number of rows without a valid value.
+         */
+        [[nodiscard]] size_t getNullCount() const { return m_nullCount; }
+
+        [[nodiscard]] bool isValid(size_t row) const {
+            return (m_validity[row / 8] & (1U << (row % 8))) != 0;
+        }
+
+        [[nodiscard]] const std::vector<int64_t>& getTimestamps() const { return m_timestamps; }
+        [[nodiscard]] const std::vector<uint8_t>& getValidity() const { return m_validity; }
+        [[nodiscard]] const std::vector<uint8_t>& getValueBuffer() const { return m_values; }
+        [[nodiscard]] const std::vector<int32_t>& getOffsets() const { return m_offsets; }
+        [[nodiscard]] const std::vector<int32_t>& getElementOffsets() const {
+            return m_elementOffsets;
+        }
+        [[nodiscard]] const std::vector<char>& getCharData() const { return m_chars; }
+
+        /**
+         * @brief Get the value buffer as an array of T, i.e. getValues<float>()[row] of a
+         *        FLOAT column, or getValues<int32_t>()[getOffsets()[row]] addressing the first
+         *        element of a row of an INT32_ARRAY column.
+         *
+         * @tparam T  The (element) type of the column; must not be bool or std::string.
+         */
+        template <typename T> [[nodiscard]] const T* getValues() const {
+            static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+                          "Only fixed width values are stored as array!");
+            return reinterpret_cast<const T*>(m_values.data());
+        }
+
+        /**
+         * @brief Get a row of the column as sample. The failure of a row without valid value is
+         *        not stored, such rows are returned as NOT_AVAILABLE.
+         *
+         * @param row  Index of the row; must be less than size().
+         */
+        [[nodiscard]] DataPointSample getSample(size_t row) const;
+
+        /**
+         * @brief Append a sample as new row. Samples of a narrow integer column holding the
+         *        32 bit type the value is transported as are narrowed; values out of range are
+         *        appended as INVALID_VALUE null.
+         *
+         * @throw InvalidTypeException if the sample holds a valid value of a different type.
+         */
+        void append(const DataPointSample& sample);
+
+        /**
+         * @brief Remove all rows, keeping the allocated buffers.
+         */
+        void clear();
+
+    private:
+        friend class ColumnarBatch;
+
+        void                       adoptType(DataPointValue::Type type);
+        template <typename T> bool appendValue(const DataPointSample& sample);
+        template <typename T> void appendTyped(const T& value);
+        void                       appendNullValue();
+        template <typename T> T    readTyped(size_t row) const;
+
+        SignalHandle_t       m_handle;
+        DataPointValue::Type m_type;
+        size_t               m_nullCount{0};
+        std::vector<int64_t> m_timestamps;
+        std::vector<uint8_t> m_validity;
+        std::vector<uint8_t> m_values;
+        std::vector<int32_t> m_offsets;
+        std::vector<int32_t> m_elementOffsets;
+        std::vector<char>    m_chars;
+    };
+
+    using const_iterator = std::vector<Column>::const_iterator;
+
+    ColumnarBatch() = default;
+
+    /**
+     * @brief Add a column for the given signal, if not contained already. Adding the columns
+     *        upfront fixes their order and their type, which allows narrow integer signals to
+     *        be stored in their actual type.
+     *
+     * @param handle  The interned handle of the signal's path.
+     * @param type    The type of the signal, INVALID to take it from the first sample.
+     * @return Column&  The column, valid until the next column is added.
+     */
+    Column& addColumn(SignalHandle_t handle, DataPointValue::Type type);
+    Column& addColumn(std::string_view path, DataPointValue::Type type) {
+        return addColumn(SignalPathRegistry::getInstance().intern(path), type);
+    }
+
+    /**
+     * @brief Append a sample of the given signal, adding its column if needed.
+     */
+    void append(SignalHandle_t handle, const DataPointSample& sample);
+    void append(std::string_view path, const DataPointSample& sample) {
+        append(SignalPathRegistry::getInstance().intern(path), sample);
+    }
+
+    /**
+     * @brief Append a value of the given data point, adding its column if needed.
+     *
+     * @tparam TDataPoint  The type of the data point.
+     * @param dataPoint    The data point.
+     * @param value        The value.
+     * @param timestamp    Time the value was captured at.
+     */
+    template <typename TDataPoint>
+    void append(const TDataPoint& dataPoint, typename TDataPoint::value_type value,
+                Timestamp timestamp = Timestamp{}) {
+        addColumn(dataPoint.getSignalHandle(), dataPoint.getDataType())
+            .append(DataPointSample(std::move(value), timestamp));
+    }
+
+    /**
+     * @brief Append all data points of a reply, typically from within a subscription handler.
+     */
+    void append(const DataPointReply& reply);
+
+    /**
+     * @brief Find the column of the given signal.
+     *
+     * @return const Column*  The column, nullptr if the batch does not contain the signal.
+     */
+    [[nodiscard]] const Column* find(SignalHandle_t handle) const;
+    [[nodiscard]] const Column* find(std::string_view path) const {
+        const auto handle = SignalPathRegistry::getInstance().find(path);
+        return handle ? find(*handle) : nullptr;
+    }
+
+    /**
+     * @brief Get the number of columns.
+     */
+    [[nodiscard]] size_t size() const { return m_columns.size(); }
+    [[nodiscard]] bool   empty() const { return m_columns.empty(); }
+
+    [[nodiscard]] const_iterator begin() const { return m_columns.cbegin(); }
+    [[nodiscard]] const_iterator end() const { return m_columns.cend(); }
+
+    /**
+     * @brief Remove all rows of all columns, keeping the columns and their buffers.
+     */
+    void clear();
+
+    /**
+     * @brief Export the column of a signal via the Arrow C data interface, as struct array of
+     *        the fields "timestamp" (timestamp[ns, UTC]) and "value" (the type of the signal,
+     *        arrays as list). The buffers are moved into the exported array without copying;
+     *        the column stays in the batch without any rows. It is released by the consumer
+     *        via the release callbacks of the structures.
+     *
+     * @param handle  The interned handle of the signal's path.
+     * @param schema  Receives the schema of the array.
+     * @param array   Receives the array.
+     * @throw InvalidValueException if the batch does not contain the signal or its type is not
+     *        known yet.
+     */
+    void exportToArrow(SignalHandle_t handle, ArrowSchema* schema, ArrowArray* array);
+
+private:
+    std::vector<Column>                        m_columns;
+    std::unordered_map<SignalHandle_t, size_t> m_index;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_COLUMNARBATCH_H
@@ -0,0 +1,408 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_COROUTINE_H
+#define VEHICLE_APP_SDK_COROUTINE_H
+
+// Coroutine support requires C++20; with older language versions this header provides nothing.
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include "sdk/AsyncResult.h"
+#include "sdk/Logger.h"
+#include "sdk/ThreadPool.h"
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace velocitas {
+
+/**
+ * @brief Common part of the promises of all Task types.
+ */
+class TaskPromiseBase {
+public:
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    /**
+     * @brief Transfers control to the awaiting coroutine once the task completed. Detached tasks
+     * destroy themselves.
+     */
+    struct FinalAwaiter {
+        bool await_ready() const noexcept { return false; }
+
+        template <typename TPromise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> handle) noexcept {
+            TaskPromiseBase& promise = handle.promise();
+            if (promise.m_continuation) {
+                return promise.m_continuation;
+            }
+            if (promise.m_isDetached) {
+                if (promise.m_exception) {
+                    promise.logUncaughtException();
+                }
+                handle.destroy();
+            }
+            return std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    FinalAwaiter final_suspend() noexcept { return {}; }
+
+    void unhandled_exception() noexcept { m_exception = std::current_exception(); }
+
+    /**
+     * @brief Get the pool the coroutine is resumed on after awaiting asynchronous results.
+     */
+    [[nodiscard]] const std::shared_ptr<ThreadPool>& getExecutor() {
+        if (!m_executor) {
+            m_executor = ThreadPool::getInstance();
+        }
+        return m_executor;
+    }
+
+    void setExecutor(std::shared_ptr<ThreadPool> executor) { m_executor = std::move(executor); }
+
+    void setContinuation(std::coroutine_handle<> continuation) { m_continuation = continuation; }
+
+    void detach() { m_isDetached = true; }
+
+protected:
+    void rethrowIfFailed() const {
+        if (m_exception) {
+            std::rethrow_exception(m_exception);
+        }
+    }
+
+private:
+    void logUncaughtException() const {
+        try {
+            std::rethrow_exception(m_exception);
+        } catch (const std::exception& e) {
+            logger().error("[Task] Uncaught exception in detached task: " + std::string(e.what()));
+        } catch (...) {
+            logger().error(std::string("[Task] Uncaught unknown exception in detached task"));
+        }
+    }
+
+    std::shared_ptr<ThreadPool> m_executor;
+    std::coroutine_handle<>     m_continuation;
+    std::exception_ptr          m_exception;
+    bool                        m_isDetached{false};
+};
+
+/**
+ * @brief Get the executor of the awaiting coroutine. Coroutines not being a Task are resumed on
+ * the default pool.
+ */
+template <typename TPromise>
+std::shared_ptr<ThreadPool> getExecutorOf(std::coroutine_handle<TPromise> handle) {
+    if constexpr (std::is_base_of_v<TaskPromiseBase, TPromise>) {
+        return handle.promise().getExecutor();
+    } else {
+        return ThreadPool::getInstance();
+    }
+}
+
+/**
+ * @brief Resume the given coroutine by one of the workers of the executor.
+ */
+inline void resumeOn(const std::shared_ptr<ThreadPool>& executor,
+                     std::coroutine_handle<>            handle) {
+    executor->post([handle]() { handle.resume(); });
+}
+
+/**
+ * @brief Awaiter starting an awaited Task and resuming the awaiting coroutine once it completed.
+ *
+ * @tparam TTaskPromise  Promise type of the awaited task.
+ */
+template <typename TTaskPromise> class TaskAwaiter {
+public:
+    explicit TaskAwaiter(std::coroutine_handle<TTaskPromise> handle)
+        : m_handle(handle) {}
+
+    bool await_ready() const noexcept { return !m_handle || m_handle.done(); }
+
+    template <typename TPromise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> awaiting) {
+        m_handle.promise().setExecutor(getExecutorOf(awaiting));
+        m_handle.promise().setContinuation(awaiting);
+        return m_handle;
+    }
+
+    decltype(auto) await_resume() { return m_handle.promise().takeResult(); }
+
+private:
+    std::coroutine_handle<TTaskPromise> m_handle;
+};
+
+/**
+ * @brief Lazily started coroutine returning a value of type T.
+ *
+ * A task starts running when it is awaited by another coroutine (it then inherits the executor
+ * of the awaiting one) or when it is passed to spawn. Awaiting asynchronous results within a
+ * task does not block a thread; the task is resumed by a worker of its executor instead.
+ *
+ * @tparam T  Type of the value returned via co_return.
+ */
+template <typename T = void> class [[nodiscard]] Task {
+public:
+    class promise_type : public TaskPromiseBase {
+    public:
+        Task get_return_object() {
+            return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        template <typename TValue> void return_value(TValue&& value) {
+            m_value.emplace(std::forward<TValue>(value));
+        }
+
+        T takeResult() {
+            rethrowIfFailed();
+            return std::move(*m_value);
+        }
+
+    private:
+        std::optional<T> m_value;
+    };
+
+    Task(Task&& other) noexcept
+        : m_handle(std::exchange(other.m_handle, nullptr)) {}
+
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+        return *this;
+    }
+
+    ~Task() { destroy(); }
+
+    Task(const Task&)            = delete;
+    Task& operator=(const Task&) = delete;
+
+    TaskAwaiter<promise_type> operator co_await() && noexcept {
+        return TaskAwaiter<promise_type>{m_handle};
+    }
+
+    /**
+     * @brief Release ownership of the coroutine, e.g. for detaching it.
+     */
+    std::coroutine_handle<promise_type> release() noexcept { return std::exchange(m_handle, {}); }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle)
+        : m_handle(handle) {}
+
+    void destroy() {
+        if (m_handle) {
+            m_handle.destroy();
+            m_handle = nullptr;
+        }
+    }
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+/**
+ * @brief Lazily started coroutine not returning a value.
+ */
+template <> class [[nodiscard]] Task<void> {
+public:
+    class promise_type : public TaskPromiseBase {
+    public:
+        Task get_return_object() {
+            return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        void return_void() noexcept {}
+
+        void takeResult() { rethrowIfFailed(); }
+    };
+
+    Task(Task&& other) noexcept
+        : m_handle(std::exchange(other.m_handle, nullptr)) {}
+
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+        return *this;
+    }
+
+    ~Task() { destroy(); }
+
+    Task(const Task&)            = delete;
+    Task& operator=(const Task&) = delete;
+
+    TaskAwaiter<promise_type> operator co_await() && noexcept {
+        return TaskAwaiter<promise_type>{m_handle};
+    }
+
+    std::coroutine_handle<promise_type> release() noexcept { return std::exchange(m_handle, {}); }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle)
+        : m_handle(handle) {}
+
+    void destroy() {
+        if (m_handle) {
+            m_handle.destroy();
+            m_handle = nullptr;
+        }
+    }
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+/**
+ * @brief Start the given task detached from the caller on the given executor. The task is
+ * destroyed once it completed; exceptions escaping from it are logged. The task keeps a reference
+ * to its executor, hence a pool created only for it must be referenced elsewhere until the task
+ * completed (the last reference to a pool must not be released by one of its workers).
+ *
+ * @param task      The task to run.
+ * @param executor  Pool to run the task on. If nullptr, the default pool is used.
+ */
+inline void spawn(Task<void> task, std::shared_ptr<ThreadPool> executor = nullptr) {
+    auto handle = task.release();
+    if (!handle) {
+        return;
+    }
+    auto& promise = handle.promise();
+    promise.setExecutor(std::move(executor));
+    promise.detach();
+    resumeOn(promise.getExecutor(), handle);
+}
+
+/**
+ * @brief Awaiter suspending a coroutine until an AsyncResult is available.
+ *
+ * @tparam T  Result type of the AsyncResult.
+ */
+template <typename T> class AsyncResultAwaiter {
+public:
+    explicit AsyncResultAwaiter(AsyncResultPtr_t<T> result)
+        : m_result(std::move(result)) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    template <typename TPromise> void await_suspend(std::coroutine_handle<TPromise> handle) {
+        // The coroutine may be resumed (and this awaiter destroyed) as soon as one of the
+        // callbacks ran, so only local copies are used after registering the first one. The
+        // flag ensures the coroutine is resumed once only.
+        auto result    = m_result;
+        auto executor  = getExecutorOf(handle);
+        auto isResumed = std::make_shared<std::atomic_bool>(false);
+        result->onError([this, handle, executor, isResumed](const Status& status) {
+            if (!isResumed->exchange(true)) {
+                m_status = status;
+                resumeOn(executor, handle);
+            }
+        });
+        result->onResult([this, handle, executor, isResumed](const T& value) {
+            if (!isResumed->exchange(true)) {
+                m_value.emplace(value);
+                resumeOn(executor, handle);
+            }
+        });
+    }
+
+    /**
+     * @throw AsyncException if the asynchronous operation failed.
+     */
+    T await_resume() {
+        if (!m_value) {
+            throw AsyncException(m_status.errorMessage());
+        }
+        return std::move(*m_value);
+    }
+
+private:
+    AsyncResultPtr_t<T> m_result;
+    std::optional<T>    m_value;
+    Status              m_status;
+};
+
+/**
+ * @brief Allows to co_await an AsyncResultPtr_t<T> within a coroutine to get its result.
+ */
+template <typename T> AsyncResultAwaiter<T> operator co_await(AsyncResultPtr_t<T> result) {
+    return AsyncResultAwaiter<T>{std::move(result)};
+}
+
+/**
+ * @brief Asynchronous generator view of a subscription, providing its items to a single
+ * consuming coroutine without blocking a thread while waiting for them.
+ *
+ * @tparam T  Item type of the subscription.
+ */
+template <typename T> class AsyncSubscriptionStream {
+public:
+    explicit AsyncSubscriptionStream(AsyncSubscriptionPtr_t<T> subscription)
+        : m_subscription(std::move(subscription)) {}
+
+    /**
+     * @brief Get the next item of the subscription.
+     * @throw AsyncException if an error was inserted into the subscription.
+     *
+     * @return Task<T>  Task to co_await for the item.
+     */
+    Task<T> next() {
+        while (true) {
+            auto item = m_subscription->tryNext();
+            if (item) {
+                co_return std::move(*item);
+            }
+            // named instead of a temporary awaiter, those are destroyed twice by some compilers
+            ItemAwaiter itemAwaiter{m_subscription};
+            co_await itemAwaiter;
+        }
+    }
+
+private:
+    struct ItemAwaiter {
+        AsyncSubscriptionPtr_t<T> m_subscription;
+
+        bool await_ready() const noexcept { return false; }
+
+        template <typename TPromise> bool await_suspend(std::coroutine_handle<TPromise> handle) {
+            auto executor = getExecutorOf(handle);
+            return m_subscription->notifyOnNextItem(
+                [handle, executor]() { resumeOn(executor, handle); });
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    AsyncSubscriptionPtr_t<T> m_subscription;
+};
+
+} // namespace velocitas
+
+#endif // __cpp_impl_coroutine
+
+#endif // VEHICLE_APP_SDK_COROUTINE_H
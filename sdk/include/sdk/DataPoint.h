@@ -20,11 +20,17 @@
 #include "sdk/AsyncResult.h"
 #include "sdk/DataPointValue.h"
 #include "sdk/Node.h"
+#include "sdk/SignalHistory.h"
+#include "sdk/SignalMirror.h"
+#include "sdk/SignalPathRegistry.h"
+#include "sdk/SignalTable.h"
 
 #include <cassert>
 #include <cstdint>
 #include <functional>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace velocitas {
@@ -45,6 +51,24 @@ public:
         , m_type{type} {
         assert(m_type != Type::BRANCH && m_type != Type::UNKNOWN_LEAF_TYPE);
     }
+
+    /**
+     * @brief Construct the data point of the signal at the given index of the signal table of a
+     *        generated model. Name, path, type and handle are taken from the table, so nothing
+     *        needs to be assembled or interned per data point.
+     *
+     * @param table   The signal table of the model.
+     * @param index   Index of the signal within the table.
+     * @param parent  Parent of the data point.
+     */
+    DataPoint(const SignalTable& table, size_t index, Node* parent)
+        : Node{getNameOfPath(table.getDescriptor(index).path),
+               std::string{table.getDescriptor(index).path}, parent}
+        , m_type{table.getDescriptor(index).nodeType}
+        , m_signalHandle{table.getHandle(index)} {
+        assert(m_type != Type::BRANCH);
+    }
+
     ~DataPoint() override = default;
 
     DataPoint(const DataPoint&)            = delete;
@@ -63,10 +87,60 @@ public:
 
     [[nodiscard]] virtual std::string toString() const = 0;
 
+    /**
+     * @brief Get the interned handle of the path of this data point.
+     *
+     * @return SignalHandle_t  Handle of getPath() within the SignalPathRegistry.
+     */
+    [[nodiscard]] SignalHandle_t getSignalHandle() const { return m_signalHandle; }
+
+    /**
+     * @brief Start recording the history of the numeric values of this data point delivered by
+     *        subscriptions, see SignalHistoryStore.
+     *
+     * @param config  Capacity and aggregation window of the history.
+     */
+    void enableHistory(const SignalHistoryConfig& config = {}) const;
+
+    /**
+     * @brief Stop recording the history of this data point and drop it.
+     */
+    void disableHistory() const;
+
+    /**
+     * @brief Get the aggregates over the window of the recorded history of this data point.
+     *
+     * @return std::nullopt if the history is not recorded or empty.
+     */
+    [[nodiscard]] std::optional<SignalHistoryAggregates> getHistoryAggregates() const;
+
+    /**
+     * @brief Get the recorded samples within the window of the history, oldest first.
+     */
+    [[nodiscard]] std::vector<SignalHistorySample> getHistorySamples() const;
+
+    /**
+     * @brief Start mirroring the latest value of this data point delivered by subscriptions, to be
+     *        read via TypedDataPoint::latest(), see SignalMirror. Only scalar values are mirrored.
+     */
+    void enableMirror() const;
+
+    /**
+     * @brief Stop mirroring the latest value of this data point.
+     */
+    void disableMirror() const;
+
     bool operator<(const DataPoint& rhs) const { return getPath() < rhs.getPath(); }
 
 private:
-    const Type m_type = Type::UNKNOWN_LEAF_TYPE;
+    static std::string getNameOfPath(std::string_view path) {
+        const auto separatorPos = path.rfind('.');
+        return std::string{separatorPos == std::string_view::npos ? path
+                                                                  : path.substr(separatorPos + 1)};
+    }
+
+    const Type           m_type = Type::UNKNOWN_LEAF_TYPE;
+    const SignalHandle_t m_signalHandle{SignalPathRegistry::getInstance().intern(getPath())};
 };
 
 inline bool operator<(const std::reference_wrapper<DataPoint>& lhs,
@@ -84,6 +158,11 @@ public:
 
     using value_type = T;
 
+    TypedDataPoint(const SignalTable& table, size_t index, Node* parent)
+        : DataPoint(table, index, parent) {
+        assert(table.getDescriptor(index).dataType == getValueType<T>());
+    }
+
     ~TypedDataPoint() override = default;
 
     TypedDataPoint(const TypedDataPoint&)            = delete;
@@ -96,6 +175,16 @@ public:
     [[nodiscard]] AsyncResultPtr_t<TypedDataPointValue<T>> get() const;
     [[nodiscard]] AsyncResultPtr_t<Status>                 set(T value) const;
 
+    /**
+     * @brief Get the latest value of this data point received by any subscription, without an
+     *        RPC and without taking a lock; to be called from any thread. Requires enableMirror()
+     *        and a subscription of the data point; until a value is received, the value fails
+     *        with NOT_AVAILABLE.
+     */
+    template <typename U = T> [[nodiscard]] LatestValue<U> latest() const {
+        return SignalMirror::getInstance().getLatest<U>(getSignalHandle());
+    }
+
     [[nodiscard]] std::string toString() const override;
 };
 
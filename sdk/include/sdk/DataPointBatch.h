@@ -19,12 +19,17 @@
 
 #include "sdk/AsyncResult.h"
 #include "sdk/DataPointValue.h"
+#include "sdk/SignalPathRegistry.h"
+#include "sdk/vdb/IVehicleDataBrokerClient.h"
 
 #include <map>
+#include <memory>
 #include <vector>
 
 namespace velocitas {
 
+class PreparedDataPointBatch;
+
 /**
  * @brief Batch implementation for setting multiple data points
  * atomically inside the VDB.
@@ -60,14 +65,83 @@ public:
      *
      * @pre At least one point was added via @ref DataPointBatch:add
      *
+     * @param mode  SetMode::ACTUATE (default) to request the signals' actuation,
+     * SetMode::PUBLISH to publish the values as provider of the signals. With kuksa.val.v2
+     * the latter uses a persistent provider stream, suitable for high-rate feeders.
+     *
      * @return AsyncResultPtr_t<SetErrorMap_t> The async result of the
      * operation. Contains a map of [dataPointPath, error] if any of the added data points
      * caused an error during set.
      */
-    AsyncResultPtr_t<SetErrorMap_t> apply();
+    AsyncResultPtr_t<SetErrorMap_t> apply(SetMode mode = SetMode::ACTUATE);
+
+    /**
+     * @brief Turn the batch into a prepared one to be applied repeatedly, e.g. by a control loop:
+     * its signals are resolved once and each apply only overwrites the values in place.
+     *
+     * @pre At least one point was added via @ref DataPointBatch:add
+     *
+     * @return PreparedDataPointBatch  The prepared batch, initially holding the added values.
+     */
+    PreparedDataPointBatch prepare();
+
+private:
+    std::vector<std::unique_ptr<DataPointValue>> m_dataPoints;
+};
+
+/**
+ * @brief Batch of a fixed set of data points to be set repeatedly, created via
+ * DataPointBatch::prepare.
+ *
+ * The values are kept in place and overwritten by set, so applying the batch does not allocate
+ * per data point. Clients resolving signals to ids (kuksa.val.v2) do so once and keep their
+ * request message, see IVehicleDataBrokerClient::prepareSet.
+ */
+class PreparedDataPointBatch final {
+public:
+    using SetErrorMap_t = DataPointBatch::SetErrorMap_t;
+
+    PreparedDataPointBatch(std::vector<std::unique_ptr<DataPointValue>> dataPoints,
+                           std::shared_ptr<IVehicleDataBrokerClient>    client);
+
+    /**
+     * @brief Replace the value of a data point of the batch. It does **not** set the value yet!
+     *
+     * @tparam TDataPoint               The type of the data point.
+     * @param dataPoint                 The data point; needs to be part of the batch.
+     * @param value                     The new value to set.
+     * @throw InvalidValueException     if the data point is not part of the batch.
+     * @return PreparedDataPointBatch&  A reference to the batch for method chaining.
+     */
+    template <typename TDataPoint>
+    PreparedDataPointBatch& set(const TDataPoint& dataPoint,
+                                typename TDataPoint::value_type value) {
+        using Value_t = TypedDataPointValue<typename TDataPoint::value_type>;
+        static_cast<Value_t&>(getEntry(dataPoint.getSignalHandle(), dataPoint.getDataType()))
+            .setValue(std::move(value));
+        return *this;
+    }
+
+    /**
+     * @brief Applies the current values of all data points by invoking an atomic set operation.
+     * The values can be changed for the next apply right after this call.
+     *
+     * @param mode  SetMode::ACTUATE (default) or SetMode::PUBLISH, see DataPointBatch::apply.
+     *
+     * @return AsyncResultPtr_t<SetErrorMap_t> The async result of the operation.
+     */
+    AsyncResultPtr_t<SetErrorMap_t> apply(SetMode mode = SetMode::ACTUATE);
+
+    [[nodiscard]] size_t size() const { return m_dataPoints.size(); }
 
 private:
+    DataPointValue& getEntry(SignalHandle_t signal, DataPointValue::Type type);
+
     std::vector<std::unique_ptr<DataPointValue>> m_dataPoints;
+    std::vector<SignalHandle_t>                  m_signals;
+    // keeps the client alive, as the prepared set refers to it
+    std::shared_ptr<IVehicleDataBrokerClient> m_client;
+    std::shared_ptr<IPreparedSet>             m_preparedSet;
 };
 
 } // namespace velocitas
@@ -17,12 +17,19 @@
 #ifndef VEHICLE_APP_SDK_DATAPOINTREPLY_H
 #define VEHICLE_APP_SDK_DATAPOINTREPLY_H
 
+#include "sdk/AllocationTracker.h"
+#include "sdk/DataPointSample.h"
 #include "sdk/DataPointValue.h"
 #include "sdk/Exceptions.h"
+#include "sdk/LazyDataPoint.h"
+#include "sdk/SignalPathRegistry.h"
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -36,28 +43,217 @@ class DataPoint;
  * @brief Result of an operation which returns multiple data points.
  *        Provides typed access to obtained data points.
  *
+ *        The data points are stored contiguously in insertion order and are indexed by an open
+ *        addressing table keyed by the interned signal handle of their path (see
+ *        SignalPathRegistry), so a lookup by handle does not touch any string at all.
  */
 class DataPointReply final {
 public:
+    /**
+     * @brief A single data point contained in the reply. It is either held as a DataPointValue
+     *        (m_value is set), as a LazyDataPointValue decoded on first access (m_lazyValue is
+     *        set) or as a DataPointSample.
+     */
+    struct Entry {
+        SignalHandle_t                      m_handle;
+        std::shared_ptr<DataPointValue>     m_value;
+        DataPointSample                     m_sample;
+        std::shared_ptr<LazyDataPointValue> m_lazyValue;
+
+        [[nodiscard]] const std::string& getPath() const {
+            return SignalPathRegistry::getInstance().getPath(m_handle);
+        }
+    };
+
+    using Entries_t      = std::vector<Entry, DomainAllocator_t<Entry, AllocationDomain::REPLY_MAPS>>;
+    using const_iterator = Entries_t::const_iterator;
+
     DataPointReply() = default;
 
-    DataPointReply(DataPointMap_t&& dataPointsMap)
-        : m_dataPointsMap(std::move(dataPointsMap)) {}
+    DataPointReply(DataPointMap_t&& dataPointsMap);
+
+    /**
+     * @brief Reserve space for the given number of data points.
+     *
+     * @param numDataPoints  Number of data points the reply will contain.
+     */
+    void reserve(size_t numDataPoints);
+
+    /**
+     * @brief Add a data point to the reply. A data point with the same path contained in the
+     *        reply already is replaced.
+     *
+     * @param path   The path ("name") of the data point.
+     * @param value  The value of the data point.
+     */
+    void set(std::string_view path, std::shared_ptr<DataPointValue> value) {
+        set(SignalPathRegistry::getInstance().intern(path), std::move(value));
+    }
+
+    /**
+     * @brief Add a data point to the reply. A data point with the same handle contained in the
+     *        reply already is replaced.
+     *
+     * @param handle The interned handle of the data point's path.
+     * @param value  The value of the data point.
+     */
+    void set(SignalHandle_t handle, std::shared_ptr<DataPointValue> value);
+
+    /**
+     * @brief Add a data point sample to the reply. A data point with the same path contained in
+     *        the reply already is replaced. Samples are stored inline, without allocating.
+     *
+     * @param path    The path ("name") of the data point.
+     * @param sample  The sample of the data point.
+     */
+    void set(std::string_view path, DataPointSample sample) {
+        set(SignalPathRegistry::getInstance().intern(path), std::move(sample));
+    }
+
+    /**
+     * @brief Add a data point sample to the reply. A data point with the same handle contained
+     *        in the reply already is replaced.
+     *
+     * @param handle  The interned handle of the data point's path.
+     * @param sample  The sample of the data point.
+     */
+    void set(SignalHandle_t handle, DataPointSample sample);
+
+    /**
+     * @brief Add a lazily decoded data point to the reply. A data point with the same handle
+     *        contained in the reply already is replaced. The value is decoded on first access
+     *        only, so data points which are not read do not cost any decoding.
+     *
+     * @param handle  The interned handle of the data point's path.
+     * @param value   The lazy value of the data point.
+     */
+    void set(SignalHandle_t handle, std::shared_ptr<LazyDataPointValue> value);
+
+    /**
+     * @brief Remove the data point of a signal. The other data points keep their order.
+     *
+     * @param handle  Interned handle of the signal's path.
+     * @return true if the reply contained the data point.
+     */
+    bool erase(SignalHandle_t handle);
 
     /**
      * @brief Get the desired data point from the reply as an untyped DataPointValue.
      *
      * @param path The path ("name") of the data point to query from the reply.
+     * @throw InvalidValueException if the data point is not contained in the reply.
      * @return std::shared_ptr<DataPointValue>  The genric data point value contained in the reply.
      */
     [[nodiscard]] std::shared_ptr<DataPointValue> getUntyped(const std::string& path) const {
-        auto mapEntry = m_dataPointsMap.find(path);
-        if (mapEntry == m_dataPointsMap.end()) {
-            throw InvalidValueException(path + " is not contained in reply!");
+        return getUntyped(getEntry(path));
+    }
+
+    /**
+     * @brief Get the desired data point from the reply as an untyped DataPointValue.
+     *
+     * @param handle The interned handle of the data point's path.
+     * @throw InvalidValueException if the data point is not contained in the reply.
+     * @return std::shared_ptr<DataPointValue>  The genric data point value contained in the reply.
+     */
+    [[nodiscard]] std::shared_ptr<DataPointValue> getUntyped(SignalHandle_t handle) const {
+        return getUntyped(getEntry(handle));
+    }
+
+    /**
+     * @brief Get the given entry of the reply as an untyped DataPointValue.
+     */
+    [[nodiscard]] static std::shared_ptr<DataPointValue> getUntyped(const Entry& entry) {
+        if (entry.m_value) {
+            return entry.m_value;
+        }
+        if (entry.m_lazyValue) {
+            return entry.m_lazyValue->get(entry.getPath());
+        }
+        return entry.m_sample.toDataPointValue(entry.getPath());
+    }
+
+    /**
+     * @brief Get the sample of the desired data point. This is the preferred, allocation free
+     *        way to read scalar values, i.e. via getSample(path).getIf<float>().
+     *
+     * @param path The path ("name") of the data point to query from the reply.
+     * @throw InvalidValueException if the data point is not contained in the reply.
+     * @return DataPointSample  The sample of the data point.
+     */
+    [[nodiscard]] DataPointSample getSample(std::string_view path) const {
+        return getSample(getEntry(path));
+    }
+
+    /**
+     * @brief Get the sample of the desired data point.
+     *
+     * @param handle The interned handle of the data point's path.
+     * @throw InvalidValueException if the data point is not contained in the reply.
+     * @return DataPointSample  The sample of the data point.
+     */
+    [[nodiscard]] DataPointSample getSample(SignalHandle_t handle) const {
+        return getSample(getEntry(handle));
+    }
+
+    /**
+     * @brief Get the sample of the given entry of the reply.
+     */
+    [[nodiscard]] static DataPointSample getSample(const Entry& entry) {
+        if (entry.m_value) {
+            return DataPointSample::fromDataPointValue(*entry.m_value);
+        }
+        if (entry.m_lazyValue) {
+            return entry.m_lazyValue->getSample();
         }
-        return mapEntry->second;
+        return entry.m_sample;
+    }
+
+    /**
+     * @brief Check if the desired data point was updated since the previous delivery of the
+     *        subscription. Unlike get(dataPoint)->wasUpdated(), this does not decode a lazily
+     *        decoded data point.
+     *
+     * @param handle The interned handle of the data point's path.
+     * @throw InvalidValueException if the data point is not contained in the reply.
+     */
+    [[nodiscard]] bool wasUpdated(SignalHandle_t handle) const {
+        return wasUpdated(getEntry(handle));
     }
 
+    /**
+     * @brief Check if the given entry of the reply was updated.
+     */
+    [[nodiscard]] static bool wasUpdated(const Entry& entry) {
+        if (entry.m_value) {
+            return entry.m_value->wasUpdated();
+        }
+        if (entry.m_lazyValue) {
+            return entry.m_lazyValue->wasUpdated();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Find the desired data point in the reply without throwing.
+     *
+     * @param path The path ("name") of the data point to find.
+     * @return const Entry*  The entry contained in the reply, nullptr if the reply does not
+     *                       contain the path.
+     */
+    [[nodiscard]] const Entry* find(std::string_view path) const {
+        const auto handle = SignalPathRegistry::getInstance().find(path);
+        return handle ? find(*handle) : nullptr;
+    }
+
+    /**
+     * @brief Find the desired data point in the reply without throwing.
+     *
+     * @param handle The interned handle of the data point's path.
+     * @return const Entry*  The entry contained in the reply, nullptr if the reply does not
+     *                       contain the data point.
+     */
+    [[nodiscard]] const Entry* find(SignalHandle_t handle) const;
+
     /**
      * @brief Get the desired data point from the reply.
      *
@@ -69,8 +265,19 @@ public:
     [[nodiscard]] std::shared_ptr<TypedDataPointValue<typename TDataPointType::value_type>>
     get(const TDataPointType& dataPoint) const {
         static_assert(std::is_base_of_v<DataPoint, TDataPointType>);
+        using Value_t = typename TDataPointType::value_type;
 
-        auto value = getUntyped(dataPoint.getPath());
+        if constexpr (!std::is_same_v<Value_t, detail::TransportType_t<Value_t>>) {
+            // may need narrowing from the type transported by the databroker APIs
+            const auto& entry = getEntry(dataPoint.getSignalHandle());
+            auto        value = std::make_shared<TypedDataPointValue<Value_t>>(
+                getSample(entry).template toTypedValue<Value_t>(dataPoint.getPath()));
+            if (!wasUpdated(entry)) {
+                value->clearUpdateStatus();
+            }
+            return value;
+        }
+        auto value = getUntyped(dataPoint.getSignalHandle());
         if (value->isValid()) {
             return std::dynamic_pointer_cast<
                 TypedDataPointValue<typename TDataPointType::value_type>>(value);
@@ -86,10 +293,46 @@ public:
      * @return true   Reply is empty.
      * @return false  Reply is not empty.
      */
-    [[nodiscard]] bool empty() const { return m_dataPointsMap.empty(); }
+    [[nodiscard]] bool empty() const { return m_entries.empty(); }
+
+    /**
+     * @brief Get the number of data points contained in the reply.
+     */
+    [[nodiscard]] size_t size() const { return m_entries.size(); }
+
+    [[nodiscard]] const_iterator begin() const { return m_entries.cbegin(); }
+    [[nodiscard]] const_iterator end() const { return m_entries.cend(); }
+
+    /**
+     * @brief Merge a newer reply into this one. Data points contained in both replies are
+     *        replaced by the ones of the newer reply.
+     *
+     * @param newerReply  The reply to merge into this one.
+     */
+    void merge(DataPointReply&& newerReply);
 
 private:
-    DataPointMap_t m_dataPointsMap;
+    template <typename TKey> [[nodiscard]] const Entry& getEntry(const TKey& key) const {
+        const auto* entry = find(key);
+        if (entry == nullptr) {
+            if constexpr (std::is_same_v<TKey, SignalHandle_t>) {
+                throw InvalidValueException(SignalPathRegistry::getInstance().getPath(key) +
+                                            " is not contained in reply!");
+            } else {
+                throw InvalidValueException(std::string(key) + " is not contained in reply!");
+            }
+        }
+        return *entry;
+    }
+
+    // returns the index into m_slots of the handle or of the empty slot to insert it into
+    [[nodiscard]] size_t findSlot(SignalHandle_t handle) const;
+    void                 rehash(size_t numSlots);
+    void                 setEntry(Entry&& entry);
+
+    Entries_t m_entries;
+    // index into m_entries + 1, 0 marks an empty slot
+    std::vector<uint32_t, DomainAllocator_t<uint32_t, AllocationDomain::REPLY_MAPS>> m_slots;
 };
 
 } // namespace velocitas
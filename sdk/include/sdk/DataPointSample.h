@@ -0,0 +1,232 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_DATAPOINTSAMPLE_H
+#define VEHICLE_APP_SDK_DATAPOINTSAMPLE_H
+
+#include "sdk/DataPointValue.h"
+#include "sdk/Exceptions.h"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief All value types a data point can have; std::monostate if there is no valid value.
+ */
+using DataPointVariant_t =
+    std::variant<std::monostate, bool, std::vector<bool>, int8_t, std::vector<int8_t>, int16_t,
+                 std::vector<int16_t>, int32_t, std::vector<int32_t>, int64_t,
+                 std::vector<int64_t>, uint8_t, std::vector<uint8_t>, uint16_t,
+                 std::vector<uint16_t>, uint32_t, std::vector<uint32_t>, uint64_t,
+                 std::vector<uint64_t>, float, std::vector<float>, double, std::vector<double>,
+                 std::string, std::vector<std::string>>;
+
+namespace detail {
+
+/**
+ * @brief The type values of type T are transported as by the databroker APIs, which carry
+ *        integers (and arrays of them) narrower than 32 bit as 32 bit ones.
+ */
+template <typename T> struct TransportType {
+    using type = T;
+};
+template <> struct TransportType<int8_t> {
+    using type = int32_t;
+};
+template <> struct TransportType<int16_t> {
+    using type = int32_t;
+};
+template <> struct TransportType<uint8_t> {
+    using type = uint32_t;
+};
+template <> struct TransportType<uint16_t> {
+    using type = uint32_t;
+};
+template <typename T> struct TransportType<std::vector<T>> {
+    using type = std::vector<typename TransportType<T>::type>;
+};
+template <typename T> using TransportType_t = typename TransportType<T>::type;
+
+/**
+ * @brief Narrow a transported value to its actual type.
+ *
+ * @return false if the value is out of the range of the actual type.
+ */
+template <typename TWide, typename TNarrow> bool narrowTransported(TWide wide, TNarrow& narrow) {
+    if constexpr (std::is_signed_v<TWide>) {
+        if (wide < std::numeric_limits<TNarrow>::min()) {
+            return false;
+        }
+    }
+    if (wide > std::numeric_limits<TNarrow>::max()) {
+        return false;
+    }
+    narrow = static_cast<TNarrow>(wide);
+    return true;
+}
+
+// arrays are narrowed by vectorized kernels
+bool narrowTransported(const std::vector<int32_t>& wide, std::vector<int8_t>& narrow);
+bool narrowTransported(const std::vector<int32_t>& wide, std::vector<int16_t>& narrow);
+bool narrowTransported(const std::vector<uint32_t>& wide, std::vector<uint8_t>& narrow);
+bool narrowTransported(const std::vector<uint32_t>& wide, std::vector<uint16_t>& narrow);
+
+} // namespace detail
+
+/**
+ * @brief Value-semantic sample of a data point: its value, timestamp and failure state.
+ *        Scalar values are stored inline, so creating or copying a sample does not allocate.
+ *        Unlike DataPointValue it does not carry the path of the data point, which is known
+ *        by the container of the sample (i.e. the DataPointReply), and it is read via a
+ *        type-safe accessor instead of a dynamic_cast.
+ */
+class DataPointSample {
+public:
+    DataPointSample() = default;
+
+    /**
+     * @brief Construct a valid sample.
+     *
+     * @tparam T         Type of the value; needs to be one of DataPointVariant_t.
+     * @param value      The value.
+     * @param timestamp  Time the value was captured at.
+     */
+    template <typename T>
+    explicit DataPointSample(T value, Timestamp timestamp = Timestamp{})
+        : m_value(std::move(value))
+        , m_timestamp(timestamp)
+        , m_type(getValueType<T>())
+        , m_failure(DataPointValue::Failure::NONE) {}
+
+    /**
+     * @brief Construct a sample without a valid value.
+     *
+     * @param type       Type of the data point.
+     * @param failure    Why there is no valid value.
+     * @param timestamp  Time the failure was detected at.
+     */
+    DataPointSample(DataPointValue::Type type, DataPointValue::Failure failure,
+                    Timestamp timestamp = Timestamp{})
+        : m_timestamp(timestamp)
+        , m_type(type)
+        , m_failure(failure) {}
+
+    [[nodiscard]] DataPointValue::Type    getType() const { return m_type; }
+    [[nodiscard]] const Timestamp&        getTimestamp() const { return m_timestamp; }
+    [[nodiscard]] DataPointValue::Failure getFailure() const { return m_failure; }
+
+    [[nodiscard]] bool isValid() const { return m_failure == DataPointValue::Failure::NONE; }
+
+    /**
+     * @brief Get the value if it is valid and of the requested type.
+     *
+     * @tparam T  The requested type.
+     * @return const T*  Pointer to the value, nullptr if the sample holds no valid value of T.
+     */
+    template <typename T> [[nodiscard]] const T* getIf() const noexcept {
+        return isValid() ? std::get_if<T>(&m_value) : nullptr;
+    }
+
+    /**
+     * @brief Get the value.
+     *
+     * @tparam T  The requested type.
+     * @throw InvalidValueException if the sample has no valid value.
+     * @throw InvalidTypeException if the value is not of the requested type.
+     * @return const T&  The value.
+     */
+    template <typename T> [[nodiscard]] const T& get() const {
+        if (!isValid()) {
+            throw InvalidValueException("Sample has no valid value: " + toString(m_failure));
+        }
+        const auto* value = std::get_if<T>(&m_value);
+        if (value == nullptr) {
+            throw InvalidTypeException("Sample does not hold a value of the requested type");
+        }
+        return *value;
+    }
+
+    [[nodiscard]] const DataPointVariant_t& getVariant() const { return m_value; }
+
+    /**
+     * @brief Create the typed data point value of the given path holding this sample.
+     *
+     * Values of integer types narrower than 32 bit (and arrays of them) may be held as the 32 bit
+     * type they are transported as; they are narrowed, values out of the range of T result in
+     * a value failing with INVALID_VALUE.
+     *
+     * @tparam T    Type of the data point.
+     * @param path  Path of the data point.
+     * @throw InvalidTypeException if the sample holds a valid value of a different type.
+     */
+    template <typename T>
+    [[nodiscard]] TypedDataPointValue<T> toTypedValue(std::string path) const {
+        if (!isValid()) {
+            return TypedDataPointValue<T>(path, m_failure, m_timestamp);
+        }
+        if constexpr (!std::is_same_v<T, detail::TransportType_t<T>>) {
+            if (const auto* transported = std::get_if<detail::TransportType_t<T>>(&m_value)) {
+                T value{};
+                if (!detail::narrowTransported(*transported, value)) {
+                    return TypedDataPointValue<T>(path, DataPointValue::Failure::INVALID_VALUE,
+                                                  m_timestamp);
+                }
+                return TypedDataPointValue<T>(path, std::move(value), m_timestamp);
+            }
+        }
+        return TypedDataPointValue<T>(path, get<T>(), m_timestamp);
+    }
+
+    /**
+     * @brief Create a DataPointValue of the given path holding this sample, for code using the
+     *        DataPointValue class hierarchy.
+     *
+     * @param path  Path of the data point.
+     * @return std::shared_ptr<DataPointValue>
+     */
+    [[nodiscard]] std::shared_ptr<DataPointValue> toDataPointValue(const std::string& path) const&;
+    [[nodiscard]] std::shared_ptr<DataPointValue> toDataPointValue(const std::string& path) &&;
+
+    /**
+     * @brief Create a sample from a DataPointValue.
+     *
+     * @param dataPointValue  The value to take the sample of.
+     * @return DataPointSample
+     */
+    static DataPointSample fromDataPointValue(const DataPointValue& dataPointValue);
+
+    bool operator==(const DataPointSample& other) const {
+        return m_type == other.m_type && m_failure == other.m_failure &&
+               m_timestamp == other.m_timestamp && m_value == other.m_value;
+    }
+
+private:
+    DataPointVariant_t      m_value;
+    Timestamp               m_timestamp{};
+    DataPointValue::Type    m_type{DataPointValue::Type::INVALID};
+    DataPointValue::Failure m_failure{DataPointValue::Failure::NOT_AVAILABLE};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_DATAPOINTSAMPLE_H
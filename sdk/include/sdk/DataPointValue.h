@@ -21,6 +21,7 @@
 
 #include <cassert>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -117,6 +118,24 @@ public:
         throw InvalidValueException("Base class does not carry values!");
     }
 
+    /**
+     * @brief Create a copy of this value, keeping its dynamic type.
+     */
+    [[nodiscard]] virtual std::unique_ptr<DataPointValue> clone() const {
+        return std::make_unique<DataPointValue>(*this);
+    }
+
+protected:
+    /**
+     * @brief Mark the value as valid and updated at the given time, after the value of a derived
+     *        class got replaced.
+     */
+    void setUpdated(const Timestamp& timestamp) {
+        m_timestamp  = timestamp;
+        m_failure    = Failure::NONE;
+        m_wasUpdated = true;
+    }
+
 private:
     std::string m_path;
     Type        m_type{Type::INVALID};
@@ -228,12 +247,24 @@ public:
         return m_value;
     }
 
+    /**
+     * @brief Replace the value in place, e.g. of a prepared batch; the path is kept.
+     */
+    void setValue(T value, const Timestamp& timestamp = Timestamp{}) {
+        m_value = std::move(value);
+        setUpdated(timestamp);
+    }
+
     bool operator==(const TypedDataPointValue& other) const {
         return DataPointValue::operator==(other) && m_value == other.m_value;
     }
 
     [[nodiscard]] std::string getValueAsString() const override;
 
+    [[nodiscard]] std::unique_ptr<DataPointValue> clone() const override {
+        return std::make_unique<TypedDataPointValue>(*this);
+    }
+
 private:
     T m_value;
 };
@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_EVENTLOOP_H
+#define VEHICLE_APP_SDK_EVENTLOOP_H
+
+#include "sdk/Histogram.h"
+#include "sdk/JobFunction.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief Snapshot of the metrics collected by an event loop since its creation.
+ */
+struct EventLoopMetrics {
+    /** Number of functions executed per loop iteration; its count is the number of iterations */
+    HistogramSnapshot batchSize;
+    /** Number of functions which threw an exception */
+    uint64_t numFailedFunctions{0};
+};
+
+/**
+ * @brief Single threaded executor: the functions posted to the loop (from any thread) are
+ * executed one after the other by the thread running the loop, so the state they access needs no
+ * synchronization.
+ *
+ * Each iteration takes all functions posted so far at once and executes them in the order they
+ * were posted, followed by the delayed functions having become due (in the order of their due
+ * time). Posting only takes a short lock; in steady state neither posting nor processing
+ * allocates memory for small functions.
+ */
+class EventLoop final {
+public:
+    using Clock_t = std::chrono::steady_clock;
+
+    static std::shared_ptr<EventLoop> create();
+
+    /**
+     * @brief Execute the given function by the loop, after the functions posted before.
+     *
+     * @param fun    The function to execute.
+     * @param delay  Delay before the function becomes due.
+     */
+    void post(JobFunction fun, std::chrono::milliseconds delay = std::chrono::milliseconds::zero());
+
+    /**
+     * @brief Run the loop on the calling thread until stop is called. Returns right away if the
+     * loop was stopped already.
+     */
+    void run();
+
+    /**
+     * @brief Execute one iteration without waiting for functions to become due, e.g. for
+     * embedding the loop into the loop of another framework or in tests.
+     *
+     * @return size_t  The number of functions executed.
+     */
+    size_t poll();
+
+    /**
+     * @brief Stop the loop after the functions of its current iteration. This is final: functions
+     * posted afterwards are not executed anymore. May be called from any thread, including the
+     * loop itself.
+     */
+    void stop();
+
+    [[nodiscard]] bool isStopped() const;
+
+    /**
+     * @brief Indicates if the calling thread is the one running the loop.
+     */
+    [[nodiscard]] bool isInLoopThread() const;
+
+    /**
+     * @brief Get the number of functions posted but not executed yet, including delayed ones.
+     */
+    [[nodiscard]] size_t getNumPendingFunctions() const;
+
+    [[nodiscard]] EventLoopMetrics getMetrics() const;
+
+    EventLoop(const EventLoop&)            = delete;
+    EventLoop(EventLoop&&)                 = delete;
+    EventLoop& operator=(const EventLoop&) = delete;
+    EventLoop& operator=(EventLoop&&)      = delete;
+
+    ~EventLoop() = default;
+
+private:
+    EventLoop() = default;
+
+    struct Posted {
+        JobFunction         m_fun;
+        Clock_t::time_point m_due;
+    };
+
+    struct Timer {
+        Clock_t::time_point m_due;
+        uint64_t            m_sequence;
+        JobFunction         m_fun;
+    };
+
+    /**
+     * @brief Execute the posted and due functions.
+     *
+     * @param isWaiting  Wait until there is something to execute.
+     * @return The number of executed functions, nullopt if the loop is stopped.
+     */
+    std::optional<size_t> runIteration(bool isWaiting);
+    void                  execute(JobFunction& fun);
+    void                  addTimer(Posted& posted);
+
+    mutable std::mutex      m_mutex;
+    std::condition_variable m_cv;
+    std::vector<Posted>     m_posted;
+    bool                    m_isStopped{false};
+    std::atomic_size_t      m_numTimers{0};
+
+    // only accessed by the thread running the loop
+    std::vector<Posted> m_batch;
+    std::vector<Timer>  m_timers;
+    uint64_t            m_nextTimerSequence{0};
+
+    std::atomic<std::thread::id> m_loopThread{};
+    Histogram                    m_batchSize;
+    std::atomic<uint64_t>        m_numFailedFunctions{0};
+};
+
+using EventLoopPtr_t = std::shared_ptr<EventLoop>;
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_EVENTLOOP_H
@@ -57,6 +57,16 @@ public:
     using std::runtime_error::runtime_error;
 };
 
+/**
+ * @brief An allocation of an SDK subsystem would exceed the memory limit set via
+ * AllocationTracker::setLimit.
+ *
+ */
+class MemoryLimitExceededException : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
 } // namespace velocitas
 
 #endif // VEHICLE_APP_SDK_EXCEPTIONS_H
@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#ifndef VEHICLE_APP_SDK_EXECUTOR_H
+#define VEHICLE_APP_SDK_EXECUTOR_H
+
+#include "sdk/EventLoop.h"
+#include "sdk/Job.h"
+#include "sdk/JobFunction.h"
+#include "sdk/Strand.h"
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace velocitas {
+
+class ThreadPool;
+
+/**
+ * @brief Runtime executing the asynchronous work of the SDK.
+ *
+ * The SDK's own executors (thread pools, strands, event loops) are available via the factories
+ * below. Apps embedding the SDK into another runtime, e.g. an asio io_context or a reactor of
+ * their framework, implement this interface and inject it into the VehicleApp or the clients, so
+ * the SDK's work is executed by the threads of that runtime.
+ *
+ * Implementations need to be thread safe: functions are posted from any thread, including the
+ * threads of gRPC and of the MQTT client.
+ */
+class IExecutor {
+public:
+    using Clock_t = std::chrono::steady_clock;
+
+    virtual ~IExecutor() = default;
+
+    /**
+     * @brief Execute the given function asynchronously. Must not execute it within the call.
+     *
+     * @param fun  The function to execute.
+     */
+    virtual void post(JobFunction fun) = 0;
+
+    /**
+     * @brief Execute the given function asynchronously as a continuation of the calling one,
+     *        i.e. the executor may run it right after the calling function returned, on the same
+     *        thread. By default the same as post.
+     *
+     * @param fun  The function to execute.
+     */
+    virtual void defer(JobFunction fun) { post(std::move(fun)); }
+
+    /**
+     * @brief Execute the given function asynchronously once the given point in time is reached.
+     *        Points in the past execute it right away, like post.
+     *
+     * @param timepoint  Point in time to execute the function at.
+     * @param fun        The function to execute.
+     */
+    virtual void scheduleAt(Clock_t::time_point timepoint, JobFunction fun) = 0;
+
+    /**
+     * @brief Execute all given functions asynchronously. Executors able to hand over several
+     *        functions at once (e.g. with a single lock) override this; by default each function
+     *        is posted on its own.
+     *
+     * @param funs  The functions to execute.
+     */
+    virtual void postBatch(std::vector<JobFunction> funs) {
+        for (auto& fun : funs) {
+            post(std::move(fun));
+        }
+    }
+
+    /**
+     * @brief Execute the given function asynchronously after the given delay.
+     */
+    void scheduleAfter(Clock_t::duration delay, JobFunction fun) {
+        scheduleAt(Clock_t::now() + delay, std::move(fun));
+    }
+
+    /**
+     * @brief Create an executor running the functions on the workers of the given pool.
+     *
+     * @param threadPool  The pool to use. If nullptr, the default pool is used.
+     * @param priority    Priority class the functions are scheduled with on the pool.
+     */
+    static std::shared_ptr<IExecutor>
+    createThreadPool(std::shared_ptr<ThreadPool> threadPool = nullptr,
+                     JobPriority                 priority   = JobPriority::NORMAL);
+
+    /**
+     * @brief Create an executor running the functions serialized via the given strand.
+     *
+     * @param strand  The strand to use. If nullptr, a new strand on the default pool is used.
+     */
+    static std::shared_ptr<IExecutor> createStrand(StrandPtr_t strand = nullptr);
+
+    /**
+     * @brief Create an executor running the functions by the given event loop.
+     *
+     * @param eventLoop  The loop to post the functions to.
+     * @throw InvalidValueException if no loop is passed.
+     */
+    static std::shared_ptr<IExecutor> createEventLoop(EventLoopPtr_t eventLoop);
+
+    IExecutor(const IExecutor&)            = delete;
+    IExecutor(IExecutor&&)                 = delete;
+    IExecutor& operator=(const IExecutor&) = delete;
+    IExecutor& operator=(IExecutor&&)      = delete;
+
+protected:
+    IExecutor() = default;
+};
+
+using ExecutorPtr_t = std::shared_ptr<IExecutor>;
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_EXECUTOR_H
@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_HISTOGRAM_H
+#define VEHICLE_APP_SDK_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace velocitas {
+
+/**
+ * @brief Point in time copy of the data of a Histogram.
+ */
+struct HistogramSnapshot {
+    /** Bucket 0 counts the value 0, bucket i counts values in [2^(i-1), 2^i). */
+    static constexpr size_t NUM_BUCKETS = 65;
+
+    uint64_t                          count{0};
+    uint64_t                          sum{0};
+    uint64_t                          min{0};
+    uint64_t                          max{0};
+    std::array<uint64_t, NUM_BUCKETS> buckets{};
+
+    [[nodiscard]] double getMean() const {
+        return count > 0 ? static_cast<double>(sum) / static_cast<double>(count) : 0.0;
+    }
+
+    /**
+     * @brief Get an estimation of the given percentile.
+     *
+     * @param percentile  The percentile to determine, in the range [0, 100].
+     * @return the upper bound of the bucket containing the percentile, capped to the recorded
+     * maximum; 0 if no value was recorded.
+     */
+    [[nodiscard]] uint64_t getPercentile(double percentile) const;
+};
+
+/**
+ * @brief Lock-free histogram of unsigned integral values (e.g. durations in nanoseconds) using
+ * buckets of exponentially growing size. Recording a value is wait-free apart from maintaining
+ * minimum and maximum, so it can be used on hot paths from multiple threads concurrently.
+ */
+class Histogram final {
+public:
+    Histogram() = default;
+
+    void record(uint64_t value) noexcept;
+
+    [[nodiscard]] HistogramSnapshot getSnapshot() const noexcept;
+
+    void reset() noexcept;
+
+    [[nodiscard]] static size_t getBucketIndex(uint64_t value) noexcept;
+
+    Histogram(const Histogram&)            = delete;
+    Histogram(Histogram&&)                 = delete;
+    Histogram& operator=(const Histogram&) = delete;
+    Histogram& operator=(Histogram&&)      = delete;
+
+private:
+    std::array<std::atomic<uint64_t>, HistogramSnapshot::NUM_BUCKETS> m_buckets{};
+    std::atomic<uint64_t>                                             m_sum{0};
+    std::atomic<uint64_t> m_min{std::numeric_limits<uint64_t>::max()};
+    std::atomic<uint64_t> m_max{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_HISTOGRAM_H
@@ -18,12 +18,132 @@
 #define VEHICLE_APP_SDK_IPUBSUBCLIENT_H
 
 #include "sdk/AsyncResult.h"
+#include "sdk/CallbackExecutor.h"
+#include "sdk/Executor.h"
+#include "sdk/PayloadCodec.h"
 
+#include <chrono>
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace velocitas {
 
+/**
+ * @brief A received message, referring to the buffer of the middleware's message instead of
+ * copying its payload. The views stay valid as long as (a copy of) the message exists.
+ */
+class PubSubMessage {
+public:
+    PubSubMessage(std::shared_ptr<const void> nativeMessage, std::string_view topic,
+                  std::string_view payload, int qos, bool isRetained)
+        : m_nativeMessage(std::move(nativeMessage))
+        , m_topic(topic)
+        , m_payload(payload)
+        , m_qos(qos)
+        , m_isRetained(isRetained) {}
+
+    [[nodiscard]] std::string_view getTopic() const { return m_topic; }
+    [[nodiscard]] std::string_view getPayload() const { return m_payload; }
+    [[nodiscard]] int              getQos() const { return m_qos; }
+    [[nodiscard]] bool             isRetained() const { return m_isRetained; }
+
+    /**
+     * @brief Get the message of the middleware owning the buffer, e.g. an mqtt::message (of the
+     * Paho MQTT C++ library) for MQTT clients, which provides the MQTT v5 properties.
+     */
+    [[nodiscard]] const std::shared_ptr<const void>& getNativeMessage() const {
+        return m_nativeMessage;
+    }
+
+private:
+    std::shared_ptr<const void> m_nativeMessage;
+    std::string_view            m_topic;
+    std::string_view            m_payload;
+    int                         m_qos;
+    bool                        m_isRetained;
+};
+
+/**
+ * @brief Configuration of a client batching the publishes per topic, see
+ * IPubSubClient::createBatching.
+ */
+struct PublishBatchingConfig {
+    enum class Mode {
+        /** Publishes are forwarded right away */
+        NONE,
+        /** Only the latest payload published within the flush window is published */
+        LATEST_ONLY,
+        /** The payloads published within the flush window are framed into one message */
+        AGGREGATE,
+    };
+
+    /** Mode of the topics not contained in m_topicModes */
+    Mode m_mode{Mode::LATEST_ONLY};
+
+    /** Mode per topic, overriding m_mode */
+    std::map<std::string, Mode> m_topicModes;
+
+    /** Time to collect the publishes of a topic for before publishing them */
+    std::chrono::milliseconds m_flushWindow{100};
+
+    /** Size of an aggregated message it is published at before the window ends; 0: no limit */
+    size_t m_maxBatchBytes{0};
+
+    /** Number of aggregated payloads a message is published at before the window ends; 0: no
+     * limit */
+    size_t m_maxBatchMessages{0};
+};
+
+/**
+ * @brief Options of an MQTT client, see IPubSubClient::createInstance. Options left unset are
+ * taken from the environment (SDV_MQTT_QOS, SDV_MQTT_PUBLISH_WINDOW,
+ * SDV_MQTT_MAX_BUFFERED_MESSAGES and SDV_MQTT_OFFLINE_QUEUE_PATH) or their defaults.
+ */
+struct MqttClientOptions {
+    enum class OfflineDropPolicy {
+        /** The oldest queued messages are dropped to make room for a new one */
+        DROP_OLDEST,
+        /** New messages are dropped while the queue is full */
+        DROP_NEWEST,
+    };
+
+    /** QoS (0, 1 or 2) to publish and subscribe topics with which are not contained in
+     * m_topicQos; unset: SDV_MQTT_QOS or 0 */
+    std::optional<int> m_qos;
+
+    /** QoS per topic or topic filter, overriding m_qos. A filter applies to the publishes on all
+     * topics matching it, the highest QoS of several matching filters wins. */
+    std::map<std::string, int> m_topicQos;
+
+    /** Number of publishes in flight at once, further ones are queued by the client; 0:
+     * SDV_MQTT_PUBLISH_WINDOW or 32 */
+    size_t m_maxInFlight{0};
+
+    /** Number of messages buffered by the client while it is disconnected, further publishes
+     * fail; 0: SDV_MQTT_MAX_BUFFERED_MESSAGES or no buffering */
+    int m_maxBufferedMessages{0};
+
+    /** File queueing the publishes while the client is disconnected, which are published in
+     * batches once it is connected again; empty: SDV_MQTT_OFFLINE_QUEUE_PATH or no queue */
+    std::string m_offlineQueuePath;
+
+    /** Size of the offline queue in bytes, each message taking 24 bytes plus its topic and
+     * payload; 0: 1 MiB */
+    size_t m_offlineQueueCapacity{0};
+
+    /** Message to drop if the offline queue is full */
+    OfflineDropPolicy m_offlineDropPolicy{OfflineDropPolicy::DROP_OLDEST};
+
+    /** Age of queued messages they are dropped at instead of being published; 0: no limit */
+    std::chrono::milliseconds m_offlineRetention{0};
+};
+
 /**
  * @brief Interface for implementing PubSub clients.
  *
@@ -96,6 +216,75 @@ public:
                                                          const std::string& keyStorePath,
                                                          const std::string& privateKeyPath);
 
+    /**
+     * @brief Create a new instance of an MQTT client connecting to a broker at the specified
+     * address using the provided options
+     *
+     * @param brokerUri address of the MQTT broker to connect to
+     * @param clientId used to identify the client at the MQTT broker
+     * @param options QoS, in-flight window and offline buffer of the client
+     * @throw std::invalid_argument if a QoS of the options is not 0, 1 or 2.
+     * @throw std::runtime_error if the offline queue file cannot be opened.
+     * @return std::shared_ptr<IPubSubClient> reference to the created MQTT client
+     */
+    static std::shared_ptr<IPubSubClient> createInstance(const std::string&       brokerUri,
+                                                         const std::string&       clientId,
+                                                         const MqttClientOptions& options);
+
+    /**
+     * @brief Create a client exchanging messages with the other in-process clients of this
+     * process, without a broker. It follows the semantics of an MQTT client, the payload of a
+     * message is shared by all binary subscriptions instead of being copied. Topics matching one of
+     * the bridged topic filters are published and subscribed via the bridge client instead, e.g.
+     * to exchange them with other processes via an MQTT broker.
+     *
+     * @param clientId       used to identify the client
+     * @param bridge         client to publish and subscribe the bridged topics via; may be nullptr
+     *                       if no topics are bridged
+     * @param bridgedTopics  topic filters to bridge
+     * @throw std::invalid_argument if topics are to be bridged without a bridge client.
+     * @return std::shared_ptr<IPubSubClient> reference to the created in-process client
+     */
+    static std::shared_ptr<IPubSubClient>
+    createInProcess(const std::string& clientId, std::shared_ptr<IPubSubClient> bridge = nullptr,
+                    const std::vector<std::string>& bridgedTopics = {});
+
+    /**
+     * @brief Create a client batching the publishes of the passed client per topic, to reduce
+     * the per message overhead of the broker and the transport. Depending on the mode of a topic,
+     * only the latest payload of a flush window is published, or all of its payloads are framed
+     * into one message (see splitAggregatedPayload). All other calls are forwarded unchanged.
+     *
+     * @param client  The client to publish the batches via.
+     * @param config  The batching per topic.
+     * @return std::shared_ptr<IPubSubClient> reference to the batching client
+     */
+    static std::shared_ptr<IPubSubClient> createBatching(std::shared_ptr<IPubSubClient> client,
+                                                         PublishBatchingConfig          config);
+
+    /**
+     * @brief Create a client encoding (e.g. compressing) the payloads of the passed client, with
+     * the codec configured for their topic. Encoding messages published asynchronously runs on the
+     * pub/sub thread pool. Encoded messages carry the name of their codec, so the client decodes
+     * the received ones transparently if it knows the codec, and passes other payloads unchanged.
+     *
+     * @param client  The client to publish and subscribe via.
+     * @param config  The codecs per topic.
+     * @return std::shared_ptr<IPubSubClient> reference to the encoding client
+     */
+    static std::shared_ptr<IPubSubClient> createEncoding(std::shared_ptr<IPubSubClient> client,
+                                                         PayloadCodecConfig             config);
+
+    /**
+     * @brief Split a message aggregated by a batching client into the original payloads. Each
+     * payload is framed by its size as 32 bit unsigned integer in network byte order.
+     *
+     * @param message  The aggregated message.
+     * @throw std::invalid_argument if the message is not framed correctly.
+     * @return std::vector<std::string>  The payloads in the order they were published.
+     */
+    static std::vector<std::string> splitAggregatedPayload(const std::string& message);
+
     virtual ~IPubSubClient() = default;
 
     /**
@@ -117,6 +306,20 @@ public:
      */
     virtual void disconnect() = 0;
 
+    /**
+     * @brief Disconnect the client within a bounded time, e.g. when shutting down: the
+     * asynchronous publishes in flight or queued (see publishAsync) get the chance to complete
+     * until the timeout expires, then the client disconnects.
+     *
+     * @param timeout  Maximum time for completing the publishes and disconnecting.
+     * @return size_t  Number of publishes which did not complete in time.
+     */
+    virtual size_t drainAndDisconnect(std::chrono::milliseconds timeout) {
+        std::ignore = timeout;
+        disconnect();
+        return 0;
+    }
+
     /**
      * @brief Return the connection state.
      *
@@ -142,11 +345,30 @@ public:
      * @param data the payload to send as the message
      * @param timeout_ms maximum time to wait for the publish to complete, in milliseconds
      * @return PublishStatus indicating the result of the publish operation: Success, Timeout,
-     * Failure
+     * Failure, or Queued if the client queued it offline
      */
     virtual PublishStatus publishOnTopic(const std::string& topic, const std::string& data,
                                          int timeout_ms) = 0;
 
+    /**
+     * @brief Publish a message on a topic without blocking the caller. Publishes are pipelined:
+     * up to a window of them are in flight at once, further ones are queued until earlier ones
+     * complete. The size of the window can be set via the environment variable
+     * SDV_MQTT_PUBLISH_WINDOW (default: 32).
+     *
+     * Clients not supporting asynchronous publishing publish synchronously.
+     *
+     * @param topic    The topic to which to publish.
+     * @param data     The message data.
+     * @param timeout  Maximum time for the publish to complete (including the time it is
+     *                 queued), zero for not timing out.
+     * @return AsyncResultPtr_t<PublishStatus>  The result of the publish: Success, Timeout,
+     *                                          Failure, or Queued if queued offline.
+     */
+    virtual AsyncResultPtr_t<PublishStatus>
+    publishAsync(const std::string& topic, const std::string& data,
+                 std::chrono::milliseconds timeout = std::chrono::milliseconds::zero());
+
     /**
      * @brief Subscribe to a topic.
      *
@@ -155,6 +377,17 @@ public:
      */
     virtual AsyncSubscriptionPtr_t<std::string> subscribeTopic(const std::string& topic) = 0;
 
+    /**
+     * @brief Subscribe to a topic, receiving the messages without copying their payload, e.g. for
+     * binary payloads of considerable size.
+     *
+     * Clients not supporting this copy the payload of a text subscription into the message.
+     *
+     * @param topic   The topic to subscribe to.
+     * @return AsyncSubscriptionPtr_t<PubSubMessage>  The subscription to the topic.
+     */
+    virtual AsyncSubscriptionPtr_t<PubSubMessage> subscribeTopicBinary(const std::string& topic);
+
     /**
      * @brief Unsubscribe from a topic.
      *
@@ -162,6 +395,32 @@ public:
      */
     virtual void unsubscribeTopic(const std::string& topic) = 0;
 
+    /**
+     * @brief Set the executor running the callbacks of the topic subscriptions created by this
+     *        client from now on. If none is set, the items of each subscription are dispatched
+     *        in order via a strand of the pub/sub thread pool.
+     *
+     * @param executor  The executor to use; nullptr for the default behavior.
+     */
+    void setCallbackExecutor(CallbackExecutorPtr_t executor);
+
+    [[nodiscard]] CallbackExecutorPtr_t getCallbackExecutor() const;
+
+    /**
+     * @brief Set the executor dispatching the received messages to the topic subscriptions
+     *        without a callback executor, instead of a strand of the pub/sub thread pool. To
+     *        keep the messages in order, it needs to run the posted functions one after the
+     *        other, e.g. as a strand or an event loop does.
+     *
+     * @param executor  The executor to use; nullptr for the default behavior.
+     */
+    virtual void setExecutor(ExecutorPtr_t executor);
+
+    /**
+     * @brief Get the executor set via setExecutor; nullptr if none is set.
+     */
+    [[nodiscard]] ExecutorPtr_t getExecutor() const;
+
     IPubSubClient(const IPubSubClient&)            = delete;
     IPubSubClient(IPubSubClient&&)                 = delete;
     IPubSubClient& operator=(const IPubSubClient&) = delete;
@@ -169,6 +428,10 @@ public:
 
 protected:
     IPubSubClient() = default;
+
+private:
+    CallbackExecutorPtr_t m_callbackExecutor;
+    ExecutorPtr_t         m_executor;
 };
 
 } // namespace velocitas
@@ -17,8 +17,13 @@
 #ifndef VEHICLE_APP_SDK_JOB_H
 #define VEHICLE_APP_SDK_JOB_H
 
+#include "sdk/AllocationTracker.h"
+#include "sdk/JobFunction.h"
+
 #include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -28,6 +33,18 @@ namespace velocitas {
 using Clock     = std::chrono::steady_clock;
 using Timepoint = std::chrono::time_point<Clock>;
 
+/**
+ * @brief Priority class of a job. A thread pool executes the executable jobs of a higher class
+ * before the ones of lower classes, see ThreadPoolConfig::starvationLimit.
+ */
+enum class JobPriority : uint8_t {
+    HIGH,   // Latency critical work, e.g. the delivery of safety relevant signals
+    NORMAL, // Everything not declaring a class
+    LOW     // Bulk work, e.g. telemetry, which may be delayed in favor of the other classes
+};
+
+constexpr size_t NUM_JOB_PRIORITIES = 3;
+
 /**
  * @brief Interface for jobs which can be executed by a worker in the thread pool.
  */
@@ -53,10 +70,24 @@ public:
      */
     [[nodiscard]] virtual bool shallRecur() const { return false; }
 
+    [[nodiscard]] JobPriority getPriority() const { return m_priority; }
+
+    /**
+     * @brief Set the priority class of the job. Needs to be set before enqueuing the job.
+     */
+    void setPriority(JobPriority priority) { m_priority = priority; }
+
     IJob(const IJob&)            = delete;
     IJob(IJob&&)                 = delete;
     IJob& operator=(const IJob&) = delete;
     IJob& operator=(IJob&&)      = delete;
+
+private:
+    friend class ThreadPool;
+
+    // point in time the job became executable, maintained by the ThreadPool for its metrics
+    Timepoint   m_timepointReady;
+    JobPriority m_priority{JobPriority::NORMAL};
 };
 
 using JobPtr_t = std::shared_ptr<IJob>;
@@ -68,7 +99,7 @@ class Job : public IJob {
 public:
     static JobPtr_t create(std::function<void()>     fun,
                            std::chrono::milliseconds delay = std::chrono::milliseconds::zero()) {
-        return std::make_shared<Job>(fun, delay);
+        return makeSharedIn<AllocationDomain::JOBS, Job>(fun, delay);
     }
 
     explicit Job(std::function<void()>     fun,
@@ -92,13 +123,65 @@ private:
 
 bool lowerJobPriority(const JobPtr_t& left, const JobPtr_t& right);
 
+/**
+ * @brief A nonrecurring job optimized for high-frequency submission.
+ *
+ * Instances are taken from a pool of preallocated memory blocks and the function to execute is
+ * wrapped by a JobFunction, so creating a job for a small callable does not allocate once the
+ * pool is warmed up. In contrast to Job, it does not support waiting for its termination.
+ */
+class LightJob final : public IJob {
+public:
+    /**
+     * @brief Create a new job from the job pool.
+     *
+     * @param fun    The function to execute.
+     * @param delay  Delay before the job becomes due.
+     * @return JobPtr_t
+     */
+    static JobPtr_t create(JobFunction               fun,
+                           std::chrono::milliseconds delay = std::chrono::milliseconds::zero());
+
+    /**
+     * @brief Grow the job pool to hold at least the given number of jobs, e.g. at startup, so it
+     * does not grow while the app is running. Also done via the env var SDV_JOB_POOL_SIZE.
+     *
+     * @param numJobs  Number of jobs existing at once the pool shall hold.
+     * @throw MemoryLimitExceededException if growing exceeds the memory limit.
+     */
+    static void reservePool(size_t numJobs);
+
+    /**
+     * @brief Get the number of jobs the job pool holds, in use or free.
+     */
+    [[nodiscard]] static size_t getPoolSize();
+
+    explicit LightJob(JobFunction               fun,
+                      std::chrono::milliseconds delay = std::chrono::milliseconds::zero());
+
+    bool isDue() const override {
+        return (m_timepointToExecute == Timepoint()) || (m_timepointToExecute <= Clock::now());
+    }
+
+    Timepoint getTimepointToExecute() const override { return m_timepointToExecute; }
+
+    void execute() override;
+
+private:
+    JobFunction m_fun;
+    Timepoint   m_timepointToExecute;
+};
+
 /**
  * @brief A recurring job which can be cancelled manually.
+ *
+ * The job is re-scheduled right after it was executed. Use PeriodicJob for jobs which shall be
+ * executed at a fixed rate.
  */
 class RecurringJob : public Job {
 public:
     static JobPtr_t create(std::function<void()> fun) {
-        return std::make_shared<RecurringJob>(fun);
+        return makeSharedIn<AllocationDomain::JOBS, RecurringJob>(fun);
     }
 
     using Job::Job;
@@ -112,10 +195,103 @@ public:
 
     [[nodiscard]] bool shallRecur() const override { return !m_isCancelled; }
 
+protected:
+    [[nodiscard]] bool isCancelled() const { return m_isCancelled; }
+
 private:
     std::atomic_bool m_isCancelled{false};
 };
 
+/**
+ * @brief Defines how a PeriodicJob deals with ticks whose deadline already passed at the time
+ * the job could be scheduled again (e.g. because its execution took longer than its period).
+ */
+enum class MissedTickPolicy {
+    /**
+     * @brief Missed ticks are dropped, the job is executed at the next tick in the future.
+     */
+    SKIP,
+    /**
+     * @brief The job is executed once for each missed tick, as fast as possible, until it
+     * caught up with the schedule.
+     */
+    CATCH_UP,
+    /**
+     * @brief All missed ticks are merged into a single execution taking place immediately.
+     */
+    COALESCE
+};
+
+/**
+ * @brief Timing statistics of a PeriodicJob. Jitter is the delay between the nominal deadline
+ * of a tick and the actual start of the execution.
+ */
+struct JitterStatistics {
+    size_t                   numExecutions{0};
+    size_t                   numMissedTicks{0};
+    std::chrono::nanoseconds minJitter{std::chrono::nanoseconds::max()};
+    std::chrono::nanoseconds maxJitter{std::chrono::nanoseconds::zero()};
+    std::chrono::nanoseconds totalJitter{std::chrono::nanoseconds::zero()};
+
+    [[nodiscard]] std::chrono::nanoseconds getMeanJitter() const {
+        if (numExecutions == 0) {
+            return std::chrono::nanoseconds::zero();
+        }
+        return totalJitter / static_cast<int64_t>(numExecutions);
+    }
+};
+
+/**
+ * @brief A recurring job which is executed at a fixed rate.
+ *
+ * The ticks are scheduled against absolute deadlines (start + n * period), so the execution
+ * time of the job does not accumulate as drift.
+ */
+class PeriodicJob : public RecurringJob {
+public:
+    static std::shared_ptr<PeriodicJob> create(std::function<void()>     fun,
+                                               std::chrono::milliseconds period,
+                                               MissedTickPolicy policy = MissedTickPolicy::SKIP) {
+        return makeSharedIn<AllocationDomain::JOBS, PeriodicJob>(fun, period, policy);
+    }
+
+    /**
+     * @brief Construct a new periodic job. The first tick is due one period after construction.
+     *
+     * @param fun     The function to execute at each tick.
+     * @param period  The period of the ticks. Must be greater than zero.
+     * @param policy  How to deal with missed ticks.
+     * @throws InvalidValueException if the period is not greater than zero.
+     */
+    PeriodicJob(std::function<void()> fun, std::chrono::milliseconds period,
+                MissedTickPolicy policy = MissedTickPolicy::SKIP);
+
+    bool isDue() const override { return m_nextDeadline <= Clock::now(); }
+
+    Timepoint getTimepointToExecute() const override { return m_nextDeadline; }
+
+    void execute() override;
+
+    [[nodiscard]] std::chrono::milliseconds getPeriod() const { return m_period; }
+
+    [[nodiscard]] MissedTickPolicy getMissedTickPolicy() const { return m_policy; }
+
+    [[nodiscard]] JitterStatistics getJitterStatistics() const;
+
+private:
+    [[nodiscard]] Timepoint getDeadlineOfTick(int64_t tick) const {
+        return m_start + m_period * tick;
+    }
+
+    const std::chrono::milliseconds m_period;
+    const MissedTickPolicy          m_policy;
+    const Timepoint                 m_start;
+    int64_t                         m_nextTick{1};
+    Timepoint                       m_nextDeadline;
+    mutable std::mutex              m_statisticsMutex;
+    JitterStatistics                m_statistics;
+};
+
 } // namespace velocitas
 
 #endif // VEHICLE_APP_SDK_JOB_H
@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_JOBFUNCTION_H
+#define VEHICLE_APP_SDK_JOBFUNCTION_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace velocitas {
+
+/**
+ * @brief Move-only wrapper of a callable taking no arguments and returning nothing.
+ *
+ * In contrast to std::function, callables up to INLINE_CAPACITY bytes (e.g. lambdas capturing a
+ * few pointers, shared_ptrs or strings) are stored inside the object itself, so wrapping them
+ * does not allocate. Bigger callables are stored on the heap. Being move-only, callables
+ * capturing move-only objects are supported as well.
+ */
+class JobFunction final {
+public:
+    static constexpr size_t INLINE_CAPACITY = 64;
+
+    JobFunction() noexcept = default;
+    JobFunction(std::nullptr_t) noexcept {} // NOLINT(google-explicit-constructor)
+
+    template <typename Fun,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<Fun>, JobFunction> &&
+                                          std::is_invocable_v<std::decay_t<Fun>&>>>
+    JobFunction(Fun&& fun) { // NOLINT(google-explicit-constructor)
+        using StoredFun = std::decay_t<Fun>;
+        if constexpr (isStorableInline<StoredFun>()) {
+            new (&m_storage) StoredFun(std::forward<Fun>(fun));
+            m_operations = getInlineOperations<StoredFun>();
+        } else {
+            *reinterpret_cast<StoredFun**>(&m_storage) = new StoredFun(std::forward<Fun>(fun));
+            m_operations = getHeapOperations<StoredFun>();
+        }
+    }
+
+    JobFunction(JobFunction&& other) noexcept { moveFrom(other); }
+
+    JobFunction& operator=(JobFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    JobFunction& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    ~JobFunction() { reset(); }
+
+    JobFunction(const JobFunction&)            = delete;
+    JobFunction& operator=(const JobFunction&) = delete;
+
+    /**
+     * @brief Invoke the wrapped callable. Must not be called on an empty object.
+     */
+    void operator()() { m_operations->invoke(&m_storage); }
+
+    explicit operator bool() const noexcept { return m_operations != nullptr; }
+
+    /**
+     * @brief Indicates if the wrapped callable is stored without any heap allocation.
+     */
+    [[nodiscard]] bool isStoredInline() const noexcept {
+        return (m_operations != nullptr) && m_operations->isInline;
+    }
+
+private:
+    struct Operations {
+        void (*invoke)(void* storage);
+        void (*move)(void* source, void* target) noexcept;
+        void (*destroy)(void* storage) noexcept;
+        bool isInline;
+    };
+
+    template <typename StoredFun> static constexpr bool isStorableInline() {
+        return (sizeof(StoredFun) <= INLINE_CAPACITY) &&
+               (alignof(StoredFun) <= alignof(std::max_align_t)) &&
+               std::is_nothrow_move_constructible_v<StoredFun>;
+    }
+
+    template <typename StoredFun> static const Operations* getInlineOperations() {
+        static constexpr Operations operations{
+            [](void* storage) { (*static_cast<StoredFun*>(storage))(); },
+            [](void* source, void* target) noexcept {
+                auto* sourceFun = static_cast<StoredFun*>(source);
+                new (target) StoredFun(std::move(*sourceFun));
+                sourceFun->~StoredFun();
+            },
+            [](void* storage) noexcept { static_cast<StoredFun*>(storage)->~StoredFun(); }, true};
+        return &operations;
+    }
+
+    template <typename StoredFun> static const Operations* getHeapOperations() {
+        static constexpr Operations operations{
+            [](void* storage) { (**static_cast<StoredFun**>(storage))(); },
+            [](void* source, void* target) noexcept {
+                *static_cast<StoredFun**>(target) = *static_cast<StoredFun**>(source);
+            },
+            [](void* storage) noexcept { delete *static_cast<StoredFun**>(storage); }, false};
+        return &operations;
+    }
+
+    void moveFrom(JobFunction& other) noexcept {
+        if (other.m_operations != nullptr) {
+            other.m_operations->move(&other.m_storage, &m_storage);
+            m_operations       = other.m_operations;
+            other.m_operations = nullptr;
+        }
+    }
+
+    void reset() noexcept {
+        if (m_operations != nullptr) {
+            m_operations->destroy(&m_storage);
+            m_operations = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char m_storage[INLINE_CAPACITY];
+    const Operations* m_operations{nullptr};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_JOBFUNCTION_H
@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef VEHICLE_APP_SDK_LATENCYTRACER_H
+#define VEHICLE_APP_SDK_LATENCYTRACER_H
+
+#include "sdk/Histogram.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+namespace velocitas {
+
+/**
+ * @brief Stages an update passes on its way from the databroker to the subscription callback.
+ */
+enum class LatencyStage {
+    STREAM_READ,    // The update was read from the subscription stream
+    DECODED,        // The update was routed to the subscriptions and staged for delivery
+    ENQUEUED,       // The item was handed to the subscription (callback executor or buffer)
+    CALLBACK_START, // The item callback was invoked
+    CALLBACK_END    // The item callback returned
+};
+
+constexpr size_t NUM_LATENCY_STAGES = static_cast<size_t>(LatencyStage::CALLBACK_END) + 1;
+
+/**
+ * @brief Time stamps of one traced update at each of the stages it passed.
+ */
+struct LatencyTrace {
+    using Clock_t = std::chrono::steady_clock;
+
+    /**
+     * Time from the broker timestamp of the newest value of the update until the stream read.
+     * The timestamp is converted to the local clock via the client's ClockOffsetEstimator; if
+     * there is no estimate, it relies on the system clocks of databroker and app being in sync.
+     * std::nullopt if no value carried a timestamp.
+     */
+    std::optional<std::chrono::nanoseconds>             brokerLatency;
+    std::array<Clock_t::time_point, NUM_LATENCY_STAGES> stamps{};
+
+    void stamp(LatencyStage stage) { stamp(stage, Clock_t::now()); }
+
+    void stamp(LatencyStage stage, Clock_t::time_point timePoint) {
+        stamps[static_cast<size_t>(stage)] = timePoint;
+    }
+
+    [[nodiscard]] bool isStamped(LatencyStage stage) const {
+        return stamps[static_cast<size_t>(stage)] != Clock_t::time_point{};
+    }
+};
+
+/**
+ * @brief Snapshot of the latencies recorded by a LatencyTracer since its creation or the last
+ * call of LatencyTracer::reset. Durations are given in nanoseconds.
+ */
+struct LatencyMetrics {
+    /** Number of updates offered for tracing, i.e. traced or skipped by the sampling */
+    uint64_t          numUpdates{0};
+    /** Number of traced updates */
+    uint64_t          numTracedUpdates{0};
+    /** Broker timestamp until stream read, see LatencyTrace::brokerLatency */
+    HistogramSnapshot brokerLatency;
+    /** Stream read until staged for delivery */
+    HistogramSnapshot decodeLatency;
+    /** Staged for delivery until handed to the subscription */
+    HistogramSnapshot enqueueLatency;
+    /** Handed to the subscription until the callback started */
+    HistogramSnapshot dispatchLatency;
+    /** Duration of the callback executions */
+    HistogramSnapshot executionTime;
+    /** Stream read until the callback returned */
+    HistogramSnapshot totalLatency;
+};
+
+/**
+ * @brief Collects the latencies of the updates of one subscription per stage.
+ *
+ * Only every n-th update is traced, so the overhead of tracing (reading the clock at each stage,
+ * recording the histograms) can be kept low enough for production use; an interval of 1
+ * traces all updates. Updates consumed via AsyncSubscription::next() instead of a callback have
+ * the stages up to ENQUEUED recorded only.
+ */
+class LatencyTracer final {
+public:
+    /**
+     * @brief Construct a new tracer.
+     *
+     * @param samplingInterval  Trace every n-th update; zero disables tracing.
+     */
+    explicit LatencyTracer(uint32_t samplingInterval)
+        : m_samplingInterval(samplingInterval) {}
+
+    /**
+     * @brief Count an update and tell if it shall be traced.
+     */
+    [[nodiscard]] bool shallTrace() noexcept {
+        if (m_samplingInterval == 0) {
+            return false;
+        }
+        return m_numUpdates.fetch_add(1, std::memory_order_relaxed) % m_samplingInterval == 0;
+    }
+
+    /**
+     * @brief Record the latencies between the stamped stages of the passed trace.
+     */
+    void record(const LatencyTrace& trace) noexcept;
+
+    [[nodiscard]] uint32_t getSamplingInterval() const { return m_samplingInterval; }
+
+    [[nodiscard]] LatencyMetrics getMetrics() const noexcept;
+
+    void reset() noexcept;
+
+    LatencyTracer(const LatencyTracer&)            = delete;
+    LatencyTracer(LatencyTracer&&)                 = delete;
+    LatencyTracer& operator=(const LatencyTracer&) = delete;
+    LatencyTracer& operator=(LatencyTracer&&)      = delete;
+    ~LatencyTracer()                               = default;
+
+private:
+    const uint32_t        m_samplingInterval;
+    std::atomic<uint64_t> m_numUpdates{0};
+    std::atomic<uint64_t> m_numTracedUpdates{0};
+    Histogram             m_brokerLatency;
+    Histogram             m_decodeLatency;
+    Histogram             m_enqueueLatency;
+    Histogram             m_dispatchLatency;
+    Histogram             m_executionTime;
+    Histogram             m_totalLatency;
+};
+
+using LatencyTracerPtr_t = std::shared_ptr<LatencyTracer>;
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_LATENCYTRACER_H
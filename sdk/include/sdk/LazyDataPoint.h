@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_LAZYDATAPOINT_H
+#define VEHICLE_APP_SDK_LAZYDATAPOINT_H
+
+#include "sdk/DataPointSample.h"
+#include "sdk/DataPointValue.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace velocitas {
+
+/**
+ * @brief Sample of a data point which is decoded from its source (i.e. the message received
+ *        from the databroker) on first access only. Decoding is thread-safe and happens at
+ *        most once, the source is kept alive until then.
+ */
+class LazySample final {
+public:
+    using Decoder_t = DataPointSample (*)(const void* source);
+
+    /**
+     * @brief Construct a lazy sample from a source.
+     *
+     * @param source   The source to decode, typically aliasing the message containing it.
+     * @param decoder  Function decoding the source.
+     */
+    LazySample(std::shared_ptr<const void> source, Decoder_t decoder)
+        : m_source(std::move(source))
+        , m_decoder(decoder) {}
+
+    /**
+     * @brief Construct a lazy sample which is decoded already.
+     */
+    explicit LazySample(DataPointSample sample)
+        : m_sample(std::move(sample)) {
+        std::call_once(m_decodeFlag, []() {});
+    }
+
+    LazySample(const LazySample&)            = delete;
+    LazySample(LazySample&&)                 = delete;
+    LazySample& operator=(const LazySample&) = delete;
+    LazySample& operator=(LazySample&&)      = delete;
+    ~LazySample()                            = default;
+
+    /**
+     * @brief Get the sample, decoding it if not done yet.
+     */
+    [[nodiscard]] const DataPointSample& get() const;
+
+private:
+    mutable std::shared_ptr<const void> m_source;
+    Decoder_t                           m_decoder{nullptr};
+    mutable std::once_flag              m_decodeFlag;
+    mutable DataPointSample             m_sample;
+};
+
+using LazySamplePtr_t = std::shared_ptr<const LazySample>;
+
+/**
+ * @brief Data point value of a DataPointReply which is created from a lazy sample on first
+ *        access. Its update status is tracked without creating the value, so checking
+ *        wasUpdated() of a signal does not decode it.
+ */
+class LazyDataPointValue final {
+public:
+    explicit LazyDataPointValue(LazySamplePtr_t sample)
+        : m_sample(std::move(sample)) {}
+
+    /**
+     * @brief Get the sample of the data point, decoding it if not done yet.
+     */
+    [[nodiscard]] const DataPointSample& getSample() const { return m_sample->get(); }
+
+    /**
+     * @brief Get the data point value, creating it on the first call.
+     *
+     * @param path  Path of the data point.
+     */
+    [[nodiscard]] std::shared_ptr<DataPointValue> get(const std::string& path) const;
+
+    [[nodiscard]] bool wasUpdated() const;
+
+    void clearUpdateStatus();
+
+private:
+    LazySamplePtr_t                         m_sample;
+    mutable std::mutex                      m_mutex;
+    mutable std::shared_ptr<DataPointValue> m_value;
+    bool                                    m_wasUpdated{true};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_LAZYDATAPOINT_H
@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef VEHICLE_APP_SDK_LOGRECORD_H
+#define VEHICLE_APP_SDK_LOGRECORD_H
+
+#include <fmt/core.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace velocitas {
+
+/**
+ * @brief Log message whose formatting is deferred: holds the format message, which has to be of
+ * static storage duration (e.g. a string literal) and thereby identifies the message, and a binary
+ * copy of the format arguments.
+ *
+ * Booleans, characters, integers, floating point numbers and strings are copied as raw values.
+ * Arguments of other types are formatted right away (with the default format) and stored as
+ * strings. The arguments are kept in an inline buffer, unless they do not fit in.
+ */
+class LogRecord {
+public:
+    LogRecord() = default;
+
+    template <typename... T>
+    explicit LogRecord(const char* format, const T&... args)
+        : m_format{format} {
+        (append(args), ...);
+    }
+
+    LogRecord(LogRecord&& other) noexcept;
+    LogRecord& operator=(LogRecord&& other) noexcept;
+    LogRecord(const LogRecord&)            = delete;
+    LogRecord& operator=(const LogRecord&) = delete;
+    ~LogRecord()                           = default;
+
+    /**
+     * @brief Indicates if the record holds a message, i.e. was not default constructed.
+     */
+    [[nodiscard]] bool isValid() const { return m_format != nullptr; }
+
+    [[nodiscard]] const char* getFormat() const { return m_format; }
+
+    /**
+     * @brief Format the message. A message without arguments is returned as is.
+     *
+     * @throws std::runtime_error if the arguments do not match the format message.
+     */
+    [[nodiscard]] std::string format() const;
+
+private:
+    static constexpr size_t INLINE_CAPACITY = 64;
+
+    enum class ArgType : uint8_t { BOOL, CHAR, INT, UINT, FLOAT, DOUBLE, STRING };
+
+    template <typename T> void append(const T& arg) {
+        if constexpr (std::is_same_v<T, bool>) {
+            appendValue(ArgType::BOOL, arg);
+        } else if constexpr (std::is_same_v<T, char>) {
+            appendValue(ArgType::CHAR, arg);
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            appendValue(ArgType::INT, static_cast<int64_t>(arg));
+        } else if constexpr (std::is_integral_v<T>) {
+            appendValue(ArgType::UINT, static_cast<uint64_t>(arg));
+        } else if constexpr (std::is_same_v<T, float>) {
+            appendValue(ArgType::FLOAT, arg);
+        } else if constexpr (std::is_same_v<T, double>) {
+            appendValue(ArgType::DOUBLE, arg);
+        } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            appendString(arg);
+        } else {
+            appendString(fmt::format("{}", arg));
+        }
+    }
+
+    template <typename T> void appendValue(ArgType type, const T& value) {
+        appendBytes(&type, sizeof(type));
+        appendBytes(&value, sizeof(value));
+    }
+
+    void appendString(std::string_view str);
+    void appendBytes(const void* bytes, size_t size);
+
+    [[nodiscard]] const std::byte* data() const {
+        return m_heap ? m_heap.get() : m_inline.data();
+    }
+
+    const char*                            m_format{nullptr};
+    size_t                                 m_size{0};
+    std::array<std::byte, INLINE_CAPACITY> m_inline{};
+    std::unique_ptr<std::byte[]>           m_heap;
+    size_t                                 m_heapCapacity{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_LOGRECORD_H
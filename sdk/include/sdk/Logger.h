@@ -17,18 +17,109 @@
 #ifndef VEHICLE_APP_SDK_LOGGER_H
 #define VEHICLE_APP_SDK_LOGGER_H
 
+#include "sdk/LogRecord.h"
+
 #include <fmt/core.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Minimum level of messages compiled in, as numeric value of velocitas::LogLevel. Logging calls
+ * of lower levels compile to nothing, e.g. define it as 1 to remove all debug messages.
+ */
+#ifndef VELOCITAS_LOG_MIN_LEVEL
+#define VELOCITAS_LOG_MIN_LEVEL 0
+#endif
 
 namespace velocitas {
 
+/**
+ * @brief Severity of log messages, in ascending order.
+ */
+enum class LogLevel { DEBUG = 0, INFO = 1, WARN = 2, ERROR = 3, OFF = 4 };
+
+constexpr LogLevel COMPILED_MIN_LOG_LEVEL = static_cast<LogLevel>(VELOCITAS_LOG_MIN_LEVEL);
+
+/**
+ * @brief Configuration of an asynchronous logger, see ILogger::createAsync.
+ */
+struct AsyncLoggerConfig {
+    enum class OverflowPolicy {
+        /** Messages logged while the buffer is full are dropped (and counted) */
+        DROP,
+        /** Threads logging while the buffer is full wait for the sink to catch up */
+        BLOCK,
+    };
+
+    /** Number of messages buffered; rounded up to the next power of two */
+    size_t m_capacity{8192};
+
+    OverflowPolicy m_overflowPolicy{OverflowPolicy::DROP};
+
+    /** Whether logging an error waits until it is written by the sink, so it is not lost if the
+     * app crashes right after */
+    bool m_isFlushingErrors{true};
+
+    /** Whether messages with a string literal as format message are formatted by the background
+     * thread, from a binary copy of their arguments, instead of by the logging thread */
+    bool m_isDeferringFormatting{true};
+};
+
+/**
+ * @brief Token bucket limiting the messages logged per call site, see Logger::setRateLimit.
+ */
+struct LogRateLimitConfig {
+    /** Messages per second logged by a call site in the long run */
+    double m_ratePerSecond{1.0};
+    /** Messages a call site can log in a burst before being limited */
+    double m_burst{10.0};
+};
+
+/**
+ * @brief Number of messages suppressed by the rate limit at a single call site.
+ */
+struct LogSiteMetrics {
+    std::string format;
+    uint64_t    numSuppressed{0};
+};
+
+/**
+ * @brief Snapshot of the metrics of the rate limit of the logger.
+ */
+struct LoggerMetrics {
+    uint64_t numSuppressed{0};
+    /** Call sites which had messages suppressed */
+    std::vector<LogSiteMetrics> sites;
+};
+
+class LogRateLimiter;
+
 /**
  * @brief Logger interface for implementing your own loggers.
  *
  */
 class ILogger {
 public:
+    /**
+     * @brief Create a logger buffering the messages in a lock-free queue, from which a background
+     * thread passes them in batches to the sink. Logging threads neither format the output nor wait
+     * for it to be written, unless the buffer is full and the policy says so.
+     *
+     * @param sink    The logger writing the messages; nullptr for the console, which is flushed
+     *                once per batch instead of once per message.
+     * @param config  Size and overflow behaviour of the buffer.
+     * @return std::unique_ptr<ILogger>  The asynchronous logger; writes the buffered messages when
+     *                                   destroyed.
+     */
+    static std::unique_ptr<ILogger> createAsync(std::unique_ptr<ILogger> sink   = nullptr,
+                                                AsyncLoggerConfig        config = {});
+
     ILogger()          = default;
     virtual ~ILogger() = default;
 
@@ -64,6 +155,26 @@ public:
      * @param msg The message to log.
      */
     virtual void debug(const std::string& msg) = 0;
+
+    /**
+     * @brief Wait until all messages logged so far are written.
+     */
+    virtual void flush() {}
+
+    /**
+     * @brief Indicates if the logger accepts deferred records via logDeferred, to format them later
+     * (e.g. on a background thread) instead of receiving formatted messages.
+     */
+    [[nodiscard]] virtual bool isDeferring() const { return false; }
+
+    /**
+     * @brief Log a message whose formatting is deferred. Only called if isDeferring() is true;
+     * by default the message is formatted right away and passed to the method of its level.
+     *
+     * @param level   The level of the message.
+     * @param record  The format message and its arguments.
+     */
+    virtual void logDeferred(LogLevel level, LogRecord&& record);
 };
 
 /**
@@ -79,10 +190,23 @@ public:
  *          If args are given then msg is assumed to be a valid format message
  *          following the formatting rules of https://fmt.dev/11.0/, and the args are assumed
  *          to be compatible with the given format message.
+ *
+ *          Call sites passing a string literal as (format) message can be rate limited, see
+ *          setRateLimit.
+ *
+ *          Messages below the level set via setLevel (initially the value of the environment
+ *          variable SDV_LOG_LEVEL: debug, info, warn, error or off; default: debug) are discarded
+ *          before being formatted, those below VELOCITAS_LOG_MIN_LEVEL are not even compiled in.
  */
 class Logger {
 public:
     Logger();
+    ~Logger();
+
+    Logger(const Logger&)            = delete;
+    Logger(Logger&&)                 = delete;
+    Logger& operator=(const Logger&) = delete;
+    Logger& operator=(Logger&&)      = delete;
 
     /**
      * @brief Log a message with info level.
@@ -92,12 +216,15 @@ public:
      * @param args  The format arguments.
      */
     template <typename... T> void info(const std::string& msg, const T&... args) {
-        const std::size_t nbr = sizeof...(T);
-        if (nbr == 0) {
-            m_impl->info(msg);
-        } else {
-            m_impl->info(fmt::format(msg, args...));
-        }
+        log<LogLevel::INFO>(&ILogger::info, msg, args...);
+    }
+
+    /**
+     * @brief Log a message given as string literal with info level. If the logger is deferring,
+     * the arguments are copied and formatted by the logger later on.
+     */
+    template <size_t N, typename... T> void info(const char (&msg)[N], const T&... args) {
+        log<LogLevel::INFO>(&ILogger::info, msg, args...);
     }
 
     /**
@@ -108,12 +235,15 @@ public:
      * @param args  The format arguments.
      */
     template <typename... T> void warn(const std::string& msg, const T&... args) {
-        const std::size_t nbr = sizeof...(T);
-        if (nbr == 0) {
-            m_impl->warn(msg);
-        } else {
-            m_impl->warn(fmt::format(msg, args...));
-        }
+        log<LogLevel::WARN>(&ILogger::warn, msg, args...);
+    }
+
+    /**
+     * @brief Log a message given as string literal with warn level. If the logger is deferring,
+     * the arguments are copied and formatted by the logger later on.
+     */
+    template <size_t N, typename... T> void warn(const char (&msg)[N], const T&... args) {
+        log<LogLevel::WARN>(&ILogger::warn, msg, args...);
     }
 
     /**
@@ -124,12 +254,15 @@ public:
      * @param args  The format arguments.
      */
     template <typename... T> void error(const std::string& msg, const T&... args) {
-        const std::size_t nbr = sizeof...(T);
-        if (nbr == 0) {
-            m_impl->error(msg);
-        } else {
-            m_impl->error(fmt::format(msg, args...));
-        }
+        log<LogLevel::ERROR>(&ILogger::error, msg, args...);
+    }
+
+    /**
+     * @brief Log a message given as string literal with error level. If the logger is deferring,
+     * the arguments are copied and formatted by the logger later on.
+     */
+    template <size_t N, typename... T> void error(const char (&msg)[N], const T&... args) {
+        log<LogLevel::ERROR>(&ILogger::error, msg, args...);
     }
 
     /**
@@ -140,12 +273,15 @@ public:
      * @param args  The format arguments.
      */
     template <typename... T> void debug(const std::string& msg, const T&... args) {
-        const std::size_t nbr = sizeof...(T);
-        if (nbr == 0) {
-            m_impl->debug(msg);
-        } else {
-            m_impl->debug(fmt::format(msg, args...));
-        }
+        log<LogLevel::DEBUG>(&ILogger::debug, msg, args...);
+    }
+
+    /**
+     * @brief Log a message given as string literal with debug level. If the logger is deferring,
+     * the arguments are copied and formatted by the logger later on.
+     */
+    template <size_t N, typename... T> void debug(const char (&msg)[N], const T&... args) {
+        log<LogLevel::DEBUG>(&ILogger::debug, msg, args...);
     }
 
     /**
@@ -153,10 +289,87 @@ public:
      *
      * @param impl The new implementation to use.
      */
-    void setLoggerImplementation(std::unique_ptr<ILogger>&& impl) { m_impl = std::move(impl); }
+    void setLoggerImplementation(std::unique_ptr<ILogger>&& impl) {
+        m_impl        = std::move(impl);
+        m_isDeferring = m_impl->isDeferring();
+    }
+
+    /**
+     * @brief Set the minimum level of messages to be logged.
+     */
+    void setLevel(LogLevel level) { m_level.store(level, std::memory_order_relaxed); }
+
+    [[nodiscard]] LogLevel getLevel() const { return m_level.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Indicates if messages of the given level are logged, e.g. to skip preparing
+     * expensive arguments.
+     */
+    [[nodiscard]] bool isEnabled(LogLevel level) const {
+        return level >= COMPILED_MIN_LOG_LEVEL && level >= getLevel();
+    }
+
+    /**
+     * @brief Wait until all messages logged so far are written, e.g. before shutting down.
+     */
+    void flush() { m_impl->flush(); }
+
+    /**
+     * @brief Limit the rate of messages per call site, i.e. per string literal used as (format)
+     * message, to keep hot error paths from flooding the log. Suppressed messages are counted and
+     * reported along with the next message of their call site being logged. Initially set via the
+     * environment variable SDV_LOG_RATE_LIMIT as "<messages per second>,<burst>" (default: none).
+     * To be set before logging concurrently, like the implementation.
+     *
+     * @param config  The limit; std::nullopt to disable rate limiting.
+     */
+    void setRateLimit(const std::optional<LogRateLimitConfig>& config);
+
+    /**
+     * @brief Get the numbers of messages suppressed by the rate limit since it was set.
+     */
+    [[nodiscard]] LoggerMetrics getMetrics() const;
 
 private:
-    std::unique_ptr<ILogger> m_impl;
+    template <LogLevel LEVEL, typename TMsg, typename... T>
+    void log(void (ILogger::*write)(const std::string&), const TMsg& msg, const T&... args) {
+        if constexpr (LEVEL >= COMPILED_MIN_LOG_LEVEL) {
+            if (!isEnabled(LEVEL)) {
+                return;
+            }
+            if constexpr (std::is_array_v<TMsg>) {
+                if (m_rateLimiter && !acquire(write, msg)) {
+                    return;
+                }
+            }
+            if constexpr (std::is_array_v<TMsg> && sizeof...(T) > 0) {
+                if (m_isDeferring) {
+                    m_impl->logDeferred(LEVEL, LogRecord{msg, args...});
+                    return;
+                }
+            }
+            if constexpr (sizeof...(T) == 0) {
+                ((*m_impl).*write)(msg);
+            } else {
+                ((*m_impl).*write)(fmt::format(fmt::runtime(msg), args...));
+            }
+        } else {
+            static_cast<void>(write);
+            static_cast<void>(msg);
+            (static_cast<void>(args), ...);
+        }
+    }
+
+    /**
+     * @brief Take a token of the call site identified by format; reports the messages suppressed
+     * before via write if granted.
+     */
+    bool acquire(void (ILogger::*write)(const std::string&), const char* format);
+
+    std::unique_ptr<ILogger>        m_impl;
+    std::atomic<LogLevel>           m_level{LogLevel::DEBUG};
+    bool                            m_isDeferring{false};
+    std::unique_ptr<LogRateLimiter> m_rateLimiter;
 };
 
 /**
@@ -0,0 +1,325 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_METRICS_H
+#define VEHICLE_APP_SDK_METRICS_H
+
+#include "sdk/Histogram.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief Label names and values identifying one series of a metric, e.g. {{"rpc", "GetValues"}}.
+ */
+using MetricLabels_t = std::vector<std::pair<std::string, std::string>>;
+
+/**
+ * @brief Monotonically increasing count of events, e.g. completed calls.
+ */
+class Counter final {
+public:
+    Counter() = default;
+
+    void increment(uint64_t value = 1) noexcept {
+        m_value.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t getValue() const noexcept {
+        return m_value.load(std::memory_order_relaxed);
+    }
+
+    Counter(const Counter&)            = delete;
+    Counter(Counter&&)                 = delete;
+    Counter& operator=(const Counter&) = delete;
+    Counter& operator=(Counter&&)      = delete;
+
+private:
+    std::atomic<uint64_t> m_value{0};
+};
+
+/**
+ * @brief Current value of a quantity which can go up and down, e.g. the number of open streams.
+ */
+class Gauge final {
+public:
+    Gauge() = default;
+
+    void set(int64_t value) noexcept { m_value.store(value, std::memory_order_relaxed); }
+
+    void add(int64_t delta) noexcept { m_value.fetch_add(delta, std::memory_order_relaxed); }
+
+    [[nodiscard]] int64_t getValue() const noexcept {
+        return m_value.load(std::memory_order_relaxed);
+    }
+
+    Gauge(const Gauge&)            = delete;
+    Gauge(Gauge&&)                 = delete;
+    Gauge& operator=(const Gauge&) = delete;
+    Gauge& operator=(Gauge&&)      = delete;
+
+private:
+    std::atomic<int64_t> m_value{0};
+};
+
+enum class MetricType {
+    COUNTER,  // Value only increases, unless the reporting component is reset
+    GAUGE,    // Value increases and decreases
+    HISTOGRAM // Distribution of recorded values, see Histogram
+};
+
+/**
+ * @brief Point in time value of one series of a metric.
+ */
+struct MetricSnapshot {
+    std::string       name;
+    std::string       help;
+    MetricType        type{MetricType::COUNTER};
+    MetricLabels_t    labels;
+    /** Value of counters and gauges */
+    double            value{0.0};
+    /** Distribution of histograms */
+    HistogramSnapshot histogram;
+};
+
+/**
+ * @brief Function adding the current values of metrics kept by a component itself (e.g. the
+ * statistics of a thread pool) to the passed list when the metrics are collected.
+ */
+using MetricsCollector_t = std::function<void(std::vector<MetricSnapshot>& metrics)>;
+
+class MetricsRegistry;
+
+/**
+ * @brief Keeps a collector registered to the MetricsRegistry; removes it when destroyed, after
+ * waiting for a collection calling it to finish.
+ */
+class MetricsCollectorHandle final {
+public:
+    MetricsCollectorHandle() = default;
+    ~MetricsCollectorHandle();
+
+    MetricsCollectorHandle(MetricsCollectorHandle&& other) noexcept;
+    MetricsCollectorHandle& operator=(MetricsCollectorHandle&& other) noexcept;
+
+    MetricsCollectorHandle(const MetricsCollectorHandle&)            = delete;
+    MetricsCollectorHandle& operator=(const MetricsCollectorHandle&) = delete;
+
+private:
+    friend class MetricsRegistry;
+
+    MetricsCollectorHandle(MetricsRegistry* registry, uint64_t id)
+        : m_registry(registry)
+        , m_id(id) {}
+
+    void release();
+
+    MetricsRegistry* m_registry{nullptr};
+    uint64_t         m_id{0};
+};
+
+/**
+ * @brief Registry of the metrics reported by the SDK components (and the app, if it likes to).
+ *
+ * Metrics are registered once by name and labels; the returned references stay valid for the
+ * lifetime of the process, so components keep them and recording an event is a single relaxed
+ * atomic operation (a few for histograms) without any lock or lookup. Registering is comparably
+ * expensive and shall not be done per event.
+ *
+ * Metric names follow the Prometheus conventions, i.e. snake case with the unit and "_total" for
+ * counters as suffix; durations are given in nanoseconds.
+ */
+class MetricsRegistry final {
+public:
+    /**
+     * @brief Get the registry of the process. It is never destroyed, so metrics may be recorded
+     * until the very end of the process (e.g. by threads stopping during static destruction).
+     */
+    static MetricsRegistry& getInstance();
+
+    MetricsRegistry();
+    ~MetricsRegistry();
+
+    /**
+     * @brief Get the counter of the given name and labels, registering it on first access.
+     *
+     * @param name    Name of the metric.
+     * @param help    Description of the metric; the one passed first is kept.
+     * @param labels  Labels of the series.
+     * @return Counter&  The counter; stays valid as long as the registry.
+     * @throws InvalidTypeException  if the name is registered for another type of metric.
+     */
+    Counter& getCounter(const std::string& name, const std::string& help,
+                        const MetricLabels_t& labels = {});
+
+    /**
+     * @brief Get the gauge of the given name and labels, see getCounter.
+     */
+    Gauge& getGauge(const std::string& name, const std::string& help,
+                    const MetricLabels_t& labels = {});
+
+    /**
+     * @brief Get the histogram of the given name and labels, see getCounter.
+     */
+    Histogram& getHistogram(const std::string& name, const std::string& help,
+                            const MetricLabels_t& labels = {});
+
+    /**
+     * @brief Register a function providing metrics when the registry gets collected.
+     *
+     * @param collector  The function; called with the lock of the collection held, so it must not
+     *                   access the registry itself.
+     * @return MetricsCollectorHandle  Keeps the collector registered as long as it exists.
+     */
+    [[nodiscard]] MetricsCollectorHandle addCollector(MetricsCollector_t collector);
+
+    /**
+     * @brief Get the current values of all registered metrics and of all collectors, sorted by
+     * name and labels.
+     */
+    [[nodiscard]] std::vector<MetricSnapshot> collect() const;
+
+    MetricsRegistry(const MetricsRegistry&)            = delete;
+    MetricsRegistry(MetricsRegistry&&)                 = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(MetricsRegistry&&)      = delete;
+
+private:
+    friend class MetricsCollectorHandle;
+
+    struct Metric;
+    using MetricKey_t = std::pair<std::string, MetricLabels_t>;
+
+    Metric& getOrAdd(const std::string& name, const std::string& help, MetricType type,
+                     const MetricLabels_t& labels);
+    void    removeCollector(uint64_t id);
+
+    mutable std::mutex                              m_mutex;
+    std::map<MetricKey_t, std::unique_ptr<Metric>> m_metrics;
+    std::map<std::string, MetricType>               m_types;
+    mutable std::mutex                              m_collectorMutex;
+    std::map<uint64_t, MetricsCollector_t>          m_collectors;
+    uint64_t                                        m_nextCollectorId{1};
+};
+
+/**
+ * @brief Format the metrics in the Prometheus text exposition format (version 0.0.4).
+ *
+ * Histograms are reported with cumulative buckets up to the highest non-empty one, whose upper
+ * bounds are the powers of two (minus one) used by Histogram.
+ */
+std::string toPrometheusText(const std::vector<MetricSnapshot>& metrics);
+
+/**
+ * @brief Sink interface for exporting the collected metrics, e.g. to a monitoring system.
+ */
+class IMetricsSink {
+public:
+    /**
+     * @brief Create a sink writing the metrics in the Prometheus text format to the given file,
+     * e.g. to be picked up by the textfile collector of the Prometheus node exporter. The file is
+     * replaced atomically, so readers never see a partially written file.
+     */
+    static std::unique_ptr<IMetricsSink> createPrometheusFile(std::string path);
+
+    IMetricsSink()          = default;
+    virtual ~IMetricsSink() = default;
+
+    IMetricsSink(const IMetricsSink&)            = delete;
+    IMetricsSink(IMetricsSink&&)                 = delete;
+    IMetricsSink& operator=(const IMetricsSink&) = delete;
+    IMetricsSink& operator=(IMetricsSink&&)      = delete;
+
+    /**
+     * @brief Export the passed metrics.
+     *
+     * @param metrics  The metrics as returned by MetricsRegistry::collect.
+     */
+    virtual void write(const std::vector<MetricSnapshot>& metrics) = 0;
+};
+
+/**
+ * @brief Periodically exports the metrics of a registry to a sink, from a thread of its own.
+ */
+class MetricsExporter final {
+public:
+    static constexpr std::chrono::milliseconds DEFAULT_INTERVAL{10000};
+
+    /**
+     * @brief Create an exporter as configured by the environment variables
+     *        SDV_METRICS_FILE          file to write the metrics to in the Prometheus text format
+     *        SDV_METRICS_INTERVAL_MS   export interval in milliseconds (default: 10000)
+     *
+     * @return std::unique_ptr<MetricsExporter>  The started exporter; nullptr if no file is set.
+     */
+    static std::unique_ptr<MetricsExporter> createFromEnvironment();
+
+    /**
+     * @param sink      Sink to write the metrics to.
+     * @param interval  Interval of exporting the metrics.
+     * @param registry  Registry to export.
+     */
+    MetricsExporter(std::unique_ptr<IMetricsSink> sink, std::chrono::milliseconds interval,
+                    MetricsRegistry& registry = MetricsRegistry::getInstance());
+
+    /**
+     * @brief Stops the exporter, see stop.
+     */
+    ~MetricsExporter();
+
+    /**
+     * @brief Export the current metrics right away.
+     */
+    void exportNow();
+
+    /**
+     * @brief Stop exporting periodically, after a final export of the current metrics.
+     */
+    void stop();
+
+    MetricsExporter(const MetricsExporter&)            = delete;
+    MetricsExporter(MetricsExporter&&)                 = delete;
+    MetricsExporter& operator=(const MetricsExporter&) = delete;
+    MetricsExporter& operator=(MetricsExporter&&)      = delete;
+
+private:
+    void run();
+
+    std::unique_ptr<IMetricsSink> m_sink;
+    std::chrono::milliseconds     m_interval;
+    MetricsRegistry&              m_registry;
+    std::mutex                    m_mutex;
+    std::condition_variable       m_stopCondition;
+    bool                          m_isStopping{false};
+    std::mutex                    m_exportMutex;
+    std::thread                   m_thread;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_METRICS_H
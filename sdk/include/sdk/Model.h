@@ -21,7 +21,11 @@
 #include "sdk/Node.h"
 #include "sdk/middleware/Middleware.h"
 
+#include <atomic>
+#include <memory>
 #include <string>
+#include <tuple>
+#include <utility>
 
 namespace velocitas {
 
@@ -37,6 +41,68 @@ public:
     [[nodiscard]] DataPointBatch setMany() const { return DataPointBatch{}; }
 };
 
+/**
+ * @brief A branch of the model tree which is constructed on first access, for large (e.g. fully
+ * generated VSS) models of which an app only uses a few signals.
+ *
+ * Only the constructor arguments of the branch are stored until then; the whole subtree is
+ * constructed by the first call of get() (or operator->), and later calls only load a pointer.
+ * Accessing the branch concurrently from several threads is safe; if its first accesses race,
+ * one of the constructed subtrees is kept. Generated models declare e.g.
+ *
+ *     LazyBranch<vehicle::Cabin, const char*, Model*, size_t> Cabin;
+ *
+ * and initialize it via Cabin("Cabin", this, SIGNAL_INDEX_CABIN).
+ *
+ * @tparam TBranch  Type of the branch.
+ * @tparam TArgs    Types of the arguments passed to the constructor of the branch.
+ */
+template <typename TBranch, typename... TArgs> class LazyBranch {
+public:
+    explicit LazyBranch(TArgs... args)
+        : m_args(std::move(args)...) {}
+
+    ~LazyBranch() { delete m_branch.load(std::memory_order_acquire); }
+
+    LazyBranch(const LazyBranch&)            = delete;
+    LazyBranch(LazyBranch&&)                 = delete;
+    LazyBranch& operator=(const LazyBranch&) = delete;
+    LazyBranch& operator=(LazyBranch&&)      = delete;
+
+    [[nodiscard]] TBranch&       get() { return getOrCreate(); }
+    [[nodiscard]] const TBranch& get() const { return getOrCreate(); }
+
+    TBranch*       operator->() { return &getOrCreate(); }
+    const TBranch* operator->() const { return &getOrCreate(); }
+
+    TBranch&       operator*() { return getOrCreate(); }
+    const TBranch& operator*() const { return getOrCreate(); }
+
+    /**
+     * @brief Indicates if the branch was accessed, i.e. its subtree is constructed.
+     */
+    [[nodiscard]] bool isConstructed() const {
+        return m_branch.load(std::memory_order_acquire) != nullptr;
+    }
+
+private:
+    TBranch& getOrCreate() const {
+        auto* branch = m_branch.load(std::memory_order_acquire);
+        if (branch == nullptr) {
+            auto created = std::apply(
+                [](const auto&... args) { return std::make_unique<TBranch>(args...); }, m_args);
+            if (m_branch.compare_exchange_strong(branch, created.get(), std::memory_order_acq_rel,
+                                                 std::memory_order_acquire)) {
+                branch = created.release();
+            }
+        }
+        return *branch;
+    }
+
+    mutable std::atomic<TBranch*> m_branch{nullptr};
+    const std::tuple<TArgs...>    m_args;
+};
+
 /**
  * @brief Base class for services within the model tree.
  *
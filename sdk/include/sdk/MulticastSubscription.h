@@ -0,0 +1,209 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_MULTICASTSUBSCRIPTION_H
+#define VEHICLE_APP_SDK_MULTICASTSUBSCRIPTION_H
+
+#include "sdk/AsyncResult.h"
+#include "sdk/CallbackExecutor.h"
+#include "sdk/Status.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief Configuration of a listener of a MulticastSubscription.
+ */
+struct MulticastListenerConfig {
+    /** Executor running the callbacks of the listener; nullptr to invoke them by the thread
+     * delivering the items of the source, which delays the listeners after this one */
+    CallbackExecutorPtr_t m_callbackExecutor;
+
+    /** Number of items buffered for consuming the listener via next() */
+    size_t m_bufferCapacity{AsyncSubscription<int>::DEFAULT_BUFFER_CAPACITY};
+
+    /** What to do with new items if the buffer is full */
+    OverflowPolicy m_overflowPolicy{OverflowPolicy::DROP_OLDEST};
+};
+
+/**
+ * @brief Distributes the items of one subscription to any number of listeners, so several
+ * components of an app can consume the same signals without subscribing to them again.
+ *
+ * Each item of the source is wrapped once into an immutable shared item, which all listeners get
+ * without copying it. Listeners are subscriptions of their own, so each one has its own executor,
+ * buffer and overflow policy, and is consumed via callbacks or next() like any subscription.
+ * Cancelling a listener removes it; the source keeps running until the multicast subscription is
+ * cancelled or destroyed. Errors of the source are passed on to all listeners. Listeners are added
+ * and removed without blocking the delivery of items.
+ *
+ * @tparam T  Item type of the source subscription, e.g. DataPointReply.
+ */
+template <typename T> class MulticastSubscription final {
+public:
+    using Item_t             = std::shared_ptr<const T>;
+    using ListenerPtr_t      = AsyncSubscriptionPtr_t<Item_t>;
+    using ListenerCallback_t = typename AsyncSubscription<Item_t>::ItemCallback_t;
+
+    /**
+     * @brief Create a multicast subscription taking over the source. The item and error
+     * callbacks of the source are registered by it, so the source must not have callbacks yet.
+     *
+     * @param source  The subscription to distribute, e.g. of VehicleApp::subscribeDataPoints.
+     */
+    static std::shared_ptr<MulticastSubscription> create(AsyncSubscriptionPtr_t<T> source) {
+        // the constructor is private, so make_shared cannot be used
+        std::shared_ptr<MulticastSubscription> multicast(new MulticastSubscription(source));
+        std::weak_ptr<MulticastSubscription>   weakMulticast = multicast;
+        source
+            ->onItemShared([weakMulticast](Item_t item) {
+                if (auto self = weakMulticast.lock()) {
+                    self->deliver(item);
+                }
+            })
+            ->onError([weakMulticast](Status status) {
+                if (auto self = weakMulticast.lock()) {
+                    self->fail(status);
+                }
+            });
+        return multicast;
+    }
+
+    /**
+     * @brief Cancels the source, see cancel.
+     */
+    ~MulticastSubscription() { m_source->cancel(); }
+
+    /**
+     * @brief Add a listener getting all items of the source from now on, to be consumed via
+     * next() or callbacks registered afterwards.
+     */
+    ListenerPtr_t addListener(const MulticastListenerConfig& config = {}) {
+        return addListener(nullptr, config);
+    }
+
+    /**
+     * @brief Add a listener getting all items of the source from now on, invoking the callback
+     * for each of them. The callback is registered before the first item is delivered.
+     */
+    ListenerPtr_t addListener(ListenerCallback_t             callback,
+                              const MulticastListenerConfig& config = {}) {
+        auto listener =
+            std::make_shared<AsyncSubscription<Item_t>>(config.m_bufferCapacity,
+                                                        config.m_overflowPolicy);
+        listener->setCallbackExecutor(config.m_callbackExecutor);
+        if (callback) {
+            listener->onItem(std::move(callback));
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto listeners = std::make_shared<Listeners_t>(*std::atomic_load(&m_listeners));
+        listeners->push_back(listener);
+        std::atomic_store(&m_listeners, std::shared_ptr<const Listeners_t>(std::move(listeners)));
+        return listener;
+    }
+
+    /**
+     * @brief Get the number of listeners not cancelled.
+     */
+    [[nodiscard]] size_t getNumListeners() const {
+        const auto listeners = std::atomic_load(&m_listeners);
+        return static_cast<size_t>(
+            std::count_if(listeners->begin(), listeners->end(),
+                          [](const auto& listener) { return !listener->isCancelled(); }));
+    }
+
+    /**
+     * @brief Get the source subscription, e.g. for its snapshot.
+     */
+    [[nodiscard]] const AsyncSubscriptionPtr_t<T>& getSource() const { return m_source; }
+
+    /**
+     * @brief Cancel the source and all listeners.
+     */
+    void cancel() {
+        m_source->cancel();
+        for (const auto& listener : *std::atomic_load(&m_listeners)) {
+            listener->cancel();
+        }
+    }
+
+    [[nodiscard]] bool isCancelled() const { return m_source->isCancelled(); }
+
+    MulticastSubscription(const MulticastSubscription&)            = delete;
+    MulticastSubscription(MulticastSubscription&&)                 = delete;
+    MulticastSubscription& operator=(const MulticastSubscription&) = delete;
+    MulticastSubscription& operator=(MulticastSubscription&&)      = delete;
+
+private:
+    using Listeners_t = std::vector<ListenerPtr_t>;
+
+    explicit MulticastSubscription(AsyncSubscriptionPtr_t<T> source)
+        : m_source(std::move(source))
+        , m_listeners(std::make_shared<const Listeners_t>()) {}
+
+    void deliver(const Item_t& item) {
+        // the listeners are copied on write, so delivering takes no lock
+        const auto listeners    = std::atomic_load(&m_listeners);
+        bool       hasCancelled = false;
+        for (const auto& listener : *listeners) {
+            if (listener->isCancelled()) {
+                hasCancelled = true;
+                continue;
+            }
+            listener->insertNewItem(Item_t(item));
+        }
+        if (hasCancelled) {
+            removeCancelledListeners();
+        }
+    }
+
+    void fail(const Status& status) {
+        for (const auto& listener : *std::atomic_load(&m_listeners)) {
+            listener->insertError(Status(status));
+        }
+    }
+
+    void removeCancelledListeners() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto listeners = std::make_shared<Listeners_t>(*std::atomic_load(&m_listeners));
+        listeners->erase(std::remove_if(listeners->begin(), listeners->end(),
+                                        [](const auto& listener) {
+                                            return listener->isCancelled();
+                                        }),
+                         listeners->end());
+        std::atomic_store(&m_listeners, std::shared_ptr<const Listeners_t>(std::move(listeners)));
+    }
+
+    const AsyncSubscriptionPtr_t<T>    m_source;
+    // serializes the modifications of the listeners
+    std::mutex                         m_mutex;
+    std::shared_ptr<const Listeners_t> m_listeners;
+};
+
+template <typename T> using MulticastSubscriptionPtr_t = std::shared_ptr<MulticastSubscription<T>>;
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_MULTICASTSUBSCRIPTION_H
@@ -36,13 +36,25 @@ public:
     };
 
     /**
-     * @brief Construct a new Node object
+     * @brief Construct a new Node object. The full path of the node is computed once here, hence
+     *        the parent needs to be constructed before its children (which is the case for
+     *        generated models, where children are members of their parent).
      *
      * @param name    Name of the node.
      * @param parent  Parent of the node.
      */
     explicit Node(std::string name, Node* parent = nullptr);
 
+    /**
+     * @brief Construct a new Node object whose full path is known already, e.g. from the
+     *        SignalTable of a generated model.
+     *
+     * @param name    Name of the node.
+     * @param path    Fully qualified path of the node; needs to match the path of the parent.
+     * @param parent  Parent of the node.
+     */
+    Node(std::string name, std::string path, Node* parent);
+
     virtual ~Node() = default;
 
     /**
@@ -63,9 +75,10 @@ public:
     /**
      * @brief Return the fully qualified path of the node down from the root of the tree.
      *
-     * @return std::string Fully qualified path of the node within the tree.
+     * @return const std::string& Fully qualified path of the node within the tree, which stays
+     * valid for the lifetime of the node.
      */
-    [[nodiscard]] std::string getPath() const;
+    [[nodiscard]] const std::string& getPath() const;
 
     /**
      * @brief Get the type of the node
@@ -84,6 +97,7 @@ private:
     // TODO: Use std::weak_ptr ?
     Node* const       m_parent;
     const std::string m_name;
+    const std::string m_path;
 };
 
 } // namespace velocitas
@@ -0,0 +1,98 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef VEHICLE_APP_SDK_PAYLOADCODEC_H
+#define VEHICLE_APP_SDK_PAYLOADCODEC_H
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief Codec transforming the payloads of pub/sub messages, e.g. compressing them. Needs to be
+ * thread-safe, as payloads are encoded and decoded by several threads concurrently.
+ */
+class IPayloadCodec {
+public:
+    /**
+     * @brief Create a codec compressing via deflate (zlib).
+     *
+     * @param level       Compression level from 1 (fastest) to 9 (smallest), -1 for zlib's
+     *                    default.
+     * @param dictionary  Preset dictionary, e.g. typical payloads of the topics; needs to be the
+     *                    same for publishers and subscribers. Improves the compression of small
+     *                    payloads considerably.
+     * @throw std::invalid_argument if the level is out of range.
+     * @return std::shared_ptr<IPayloadCodec>  The codec, named "deflate" or, if using a
+     *                                         dictionary, "deflate-<Adler-32 of the dictionary>".
+     */
+    static std::shared_ptr<IPayloadCodec> createDeflate(int         level      = -1,
+                                                        std::string dictionary = {});
+
+    virtual ~IPayloadCodec() = default;
+
+    /**
+     * @brief Get the name identifying the codec in encoded messages, at most 255 characters; the
+     * receivers of the messages select the codec to decode them by it.
+     */
+    [[nodiscard]] virtual const std::string& getName() const = 0;
+
+    [[nodiscard]] virtual std::string encode(std::string_view payload) const = 0;
+
+    /**
+     * @brief Decode a payload encoded by a codec of the same name.
+     * @throw std::runtime_error if the payload cannot be decoded.
+     */
+    [[nodiscard]] virtual std::string decode(std::string_view payload) const = 0;
+
+    IPayloadCodec(const IPayloadCodec&)            = delete;
+    IPayloadCodec(IPayloadCodec&&)                 = delete;
+    IPayloadCodec& operator=(const IPayloadCodec&) = delete;
+    IPayloadCodec& operator=(IPayloadCodec&&)      = delete;
+
+protected:
+    IPayloadCodec() = default;
+};
+
+using PayloadCodecPtr_t = std::shared_ptr<IPayloadCodec>;
+
+/**
+ * @brief Configuration of a client encoding the payloads it publishes, see
+ * IPubSubClient::createEncoding.
+ */
+struct PayloadCodecConfig {
+    /** Codec of the topics not contained in m_topicCodecs; nullptr: payloads are not encoded */
+    PayloadCodecPtr_t m_codec;
+
+    /** Codec per topic or topic filter, overriding m_codec; nullptr: payloads are not encoded. An
+     * entry of the topic itself takes precedence over the filters matching it; several filters
+     * with different codecs matching the same topic are ambiguous. */
+    std::map<std::string, PayloadCodecPtr_t> m_topicCodecs;
+
+    /** Further codecs received payloads may be encoded with, besides the ones above */
+    std::vector<PayloadCodecPtr_t> m_decoders;
+
+    /** Payloads smaller than this are not encoded, as they hardly compress */
+    size_t m_minPayloadSize{128};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_PAYLOADCODEC_H
@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_QUERY_H
+#define VEHICLE_APP_SDK_QUERY_H
+
+#include "sdk/DataPointSample.h"
+#include "sdk/SignalPathRegistry.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief Condition of a query: the value of a signal compared to an operand.
+ */
+struct QueryCondition {
+    enum class Operator {
+        GREATER,
+        LESS,
+        EQUAL,
+    };
+
+    SignalHandle_t  m_signal;
+    Operator        m_operator;
+    DataPointSample m_operand;
+};
+
+/**
+ * @brief Structured VDB query, as created by QueryBuilder::buildQuery(). Clients supporting it
+ *        subscribe to the selected signals directly, without formatting and parsing a query
+ *        string. A query is immutable, so it is best built once and kept for reuse.
+ */
+class Query final {
+public:
+    /**
+     * @brief Construct a query.
+     *
+     * @param signals      The selected signals, in the order of selection.
+     * @param conditions   The conditions of the WHERE clause, which all need to be met.
+     * @param queryString  The query in string form.
+     */
+    Query(std::vector<SignalHandle_t> signals, std::vector<QueryCondition> conditions,
+          std::string queryString)
+        : m_signals(std::move(signals))
+        , m_conditions(std::move(conditions))
+        , m_queryString(std::move(queryString)) {}
+
+    [[nodiscard]] const std::vector<SignalHandle_t>& getSignals() const { return m_signals; }
+    [[nodiscard]] const std::vector<QueryCondition>& getConditions() const { return m_conditions; }
+
+    /**
+     * @brief Get the paths of the selected signals.
+     */
+    [[nodiscard]] std::vector<std::string> getSignalPaths() const {
+        std::vector<std::string> paths;
+        paths.reserve(m_signals.size());
+        for (const auto signal : m_signals) {
+            paths.push_back(SignalPathRegistry::getInstance().getPath(signal));
+        }
+        return paths;
+    }
+
+    /**
+     * @brief Get the query in string form, as passed to clients not supporting structured
+     *        queries. It is formatted once, when the query is built.
+     */
+    [[nodiscard]] const std::string& toString() const { return m_queryString; }
+
+private:
+    std::vector<SignalHandle_t> m_signals;
+    std::vector<QueryCondition> m_conditions;
+    std::string                 m_queryString;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_QUERY_H
@@ -18,8 +18,11 @@
 #define VEHICLE_APP_SDK_QUERYBUILDER_H
 
 #include "sdk/DataPoint.h"
+#include "sdk/DataPointSample.h"
+#include "sdk/Query.h"
 
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace velocitas {
@@ -48,6 +51,21 @@ public:
      */
     static QueryBuilder select(const std::vector<std::reference_wrapper<DataPoint>>& dataPoints);
 
+    /**
+     * @brief Create a QueryBuilder selecting multiple data points, passed as arguments, e.g.
+     *        select(vehicle.Speed, vehicle.Cabin.Seat.Row1.Pos1.Position). The data point types
+     *        are checked at compile time, no list of references needs to be created.
+     *
+     * @param dataPoints  References to the data points to be selected
+     * @return A new instance of QueryBuilder
+     */
+    template <typename... TDataPoints,
+              typename = std::enable_if_t<(sizeof...(TDataPoints) > 1) &&
+                                          (std::is_base_of_v<DataPoint, TDataPoints> && ...)>>
+    static QueryBuilder select(const TDataPoints&... dataPoints) {
+        return selectAll({static_cast<const DataPoint*>(&dataPoints)...});
+    }
+
     /**
      * @brief Adds a condition for a data point to be met for getting a notification
      *
@@ -67,10 +85,23 @@ public:
      */
     [[nodiscard]] std::string build() const;
 
+    /**
+     * @brief Returns the structured query, containing the handles of the selected signals and
+     * the conditions. It can be passed to subscriptions directly, so the query string does not
+     * need to be parsed again.
+     *
+     * @return The structured query
+     */
+    [[nodiscard]] Query buildQuery() const;
+
 private:
     QueryBuilder() = default;
 
-    std::vector<std::string> m_queryContext;
+    static QueryBuilder selectAll(const std::vector<const DataPoint*>& dataPoints);
+
+    std::vector<std::string>    m_queryContext;
+    std::vector<SignalHandle_t> m_signals;
+    std::vector<QueryCondition> m_conditions;
 
     template <typename T> friend class WhereClauseBuilder;
 };
@@ -88,9 +119,7 @@ public:
      * @return This instance for method chaining.
      */
     WhereClauseBuilder& gt(T value) {
-        m_parent->m_queryContext.emplace_back(">");
-        m_parent->m_queryContext.emplace_back(std::to_string(value));
-        return *this;
+        return addCondition(QueryCondition::Operator::GREATER, value);
     }
 
     /**
@@ -100,9 +129,7 @@ public:
      * @return This instance for method chaining.
      */
     WhereClauseBuilder& lt(T value) {
-        m_parent->m_queryContext.emplace_back("<");
-        m_parent->m_queryContext.emplace_back(std::to_string(value));
-        return *this;
+        return addCondition(QueryCondition::Operator::LESS, value);
     }
 
     /**
@@ -112,9 +139,7 @@ public:
      * @return This instance for method chaining.
      */
     WhereClauseBuilder& eq(T value) {
-        m_parent->m_queryContext.emplace_back("=");
-        m_parent->m_queryContext.emplace_back(std::to_string(value));
-        return *this;
+        return addCondition(QueryCondition::Operator::EQUAL, value);
     }
 
     /**
@@ -125,14 +150,29 @@ public:
      */
     [[nodiscard]] std::string build() const { return m_parent->build(); }
 
+    /**
+     * @brief Returns the structured query, see QueryBuilder::buildQuery().
+     */
+    [[nodiscard]] Query buildQuery() const { return m_parent->buildQuery(); }
+
 private:
     WhereClauseBuilder(QueryBuilder* parent, const DataPoint& dataPoint)
-        : m_parent{parent} {
+        : m_parent{parent}
+        , m_signal{dataPoint.getSignalHandle()} {
         m_parent->m_queryContext.emplace_back("WHERE");
         m_parent->m_queryContext.emplace_back(dataPoint.getPath());
     }
 
-    QueryBuilder* m_parent{nullptr};
+    WhereClauseBuilder& addCondition(QueryCondition::Operator op, T value) {
+        static const char* const OPERATOR_TOKENS[] = {">", "<", "="};
+        m_parent->m_queryContext.emplace_back(OPERATOR_TOKENS[static_cast<int>(op)]);
+        m_parent->m_queryContext.emplace_back(std::to_string(value));
+        m_parent->m_conditions.push_back(QueryCondition{m_signal, op, DataPointSample(value)});
+        return *this;
+    }
+
+    QueryBuilder*  m_parent{nullptr};
+    SignalHandle_t m_signal;
 
     friend class QueryBuilder;
 };
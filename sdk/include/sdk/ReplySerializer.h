@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#ifndef VEHICLE_APP_SDK_REPLYSERIALIZER_H
+#define VEHICLE_APP_SDK_REPLYSERIALIZER_H
+
+#include "sdk/ColumnarBatch.h"
+#include "sdk/DataPointReply.h"
+#include "sdk/DataPointSample.h"
+#include "sdk/SignalPathRegistry.h"
+#include "sdk/SubscriptionView.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace velocitas {
+
+/**
+ * @brief Serializes data point replies, typed views and columnar batches as JSON or CBOR
+ * (RFC 8949) straight into a reusable buffer, e.g. for publishing them via publishToTopic,
+ * instead of building a document object per message.
+ *
+ * A reply or view is written as object of a member per signal, keyed by its path:
+ *
+ *     {"Vehicle.Speed":{"value":42.5,"timestamp":1700000000123456789},
+ *      "Vehicle.Cabin.Seat.Row1.Pos1.Position":{"failure":"NOT_AVAILABLE","timestamp":0}}
+ *
+ * with the timestamp in nanoseconds since the epoch, arrays as arrays and non-finite floats as
+ * null (JSON only). A columnar batch is written as {"<path>":{"timestamps":[...],"values":[...]}}
+ * with null values for the rows without valid value. CBOR payloads have the same structure.
+ *
+ * The key fragment of each signal (its escaped and quoted path, or its CBOR text string) is
+ * computed on the first serialization of the signal and copied into the buffer from then on. The
+ * buffer keeps its capacity, so once it has grown to the size of the payloads, serializing
+ * allocates nothing (apart from copying string and array values of views and batches).
+ *
+ * Not thread-safe; use a serializer per thread.
+ *
+ *     ReplySerializer serializer(ReplySerializer::Format::CBOR);
+ *     subscribeDataPoints(query)->onItem([this](const DataPointReply& reply) {
+ *         publishToTopic("vehicle/motion", m_serializer.serialize(reply));
+ *     });
+ */
+class ReplySerializer final {
+public:
+    enum class Format { JSON, CBOR };
+
+    explicit ReplySerializer(Format format = Format::JSON);
+
+    [[nodiscard]] Format getFormat() const { return m_format; }
+
+    /**
+     * @brief Serialize all data points of a reply, in their order within the reply.
+     *
+     * @return const std::string&  The payload, valid until the next serialization.
+     */
+    const std::string& serialize(const DataPointReply& reply);
+
+    /**
+     * @brief Serialize the bound fields of a view filled by a SubscriptionView, in the order of
+     * binding.
+     *
+     * @return const std::string&  The payload, valid until the next serialization.
+     */
+    template <typename TView>
+    const std::string& serialize(const SubscriptionView<TView>& view, const TView& fields) {
+        beginPayload(view.getNumSignals());
+        view.visitSamples(fields, [this](SignalHandle_t handle, const DataPointSample& sample) {
+            writeSample(handle, sample);
+        });
+        return endPayload();
+    }
+
+    /**
+     * @brief Serialize all rows of all columns of a batch.
+     *
+     * @return const std::string&  The payload, valid until the next serialization.
+     */
+    const std::string& serialize(const ColumnarBatch& batch);
+
+    /**
+     * @brief Get the payload of the latest serialization.
+     */
+    [[nodiscard]] const std::string& getBuffer() const { return m_buffer; }
+
+    /**
+     * @brief Get the number of signals a key fragment is cached for.
+     */
+    [[nodiscard]] size_t getNumCachedKeys() const { return m_keyFragments.size(); }
+
+private:
+    void               beginPayload(size_t numSignals);
+    const std::string& endPayload();
+
+    // writes the cached key fragment of the signal, which opens the object of its members
+    void                       writeKey(SignalHandle_t handle);
+    void                       writeSample(SignalHandle_t handle, const DataPointSample& sample);
+    void                       writeColumn(const ColumnarBatch::Column& column);
+    void                       writeValue(const DataPointVariant_t& value);
+    template <typename T> void writeScalar(const T& value);
+    void                       writeMemberName(std::string_view name, bool isFirst);
+    void                       writeArrayHead(size_t size);
+    void                       writeArrayTail();
+    void                       writeArraySeparator(size_t index);
+
+    const Format                                    m_format;
+    std::string                                     m_buffer;
+    std::unordered_map<SignalHandle_t, std::string> m_keyFragments;
+    size_t                                          m_numWrittenSignals{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_REPLYSERIALIZER_H
@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_RINGBUFFER_H
+#define VEHICLE_APP_SDK_RINGBUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace velocitas {
+
+/**
+ * @brief Bounded lock-free ring buffer supporting multiple concurrent producers and consumers.
+ *
+ * Each slot carries a sequence number telling whether it is ready to be written or read, so
+ * producers and consumers only contend on advancing their respective position. Items are moved
+ * in and out of the buffer.
+ *
+ * @tparam T           Type of the buffered items. Needs to be move constructible.
+ * @tparam TAllocator  Allocator of the slots (rebound to the slot type).
+ */
+template <typename T, typename TAllocator = std::allocator<T>> class RingBuffer final {
+public:
+    /**
+     * @brief Construct a new ring buffer.
+     *
+     * @param capacity  Minimum number of items the buffer can hold. It is rounded up to the next
+     *                  power of two (and to at least 2).
+     */
+    explicit RingBuffer(size_t capacity)
+        : m_capacity(roundUpToPowerOfTwo(capacity))
+        , m_cells(CellAllocatorTraits_t::allocate(m_cellAllocator, m_capacity)) {
+        for (size_t i = 0; i < m_capacity; ++i) {
+            new (&m_cells[i]) Cell{};
+            m_cells[i].m_sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~RingBuffer() {
+        while (tryPop()) {
+        }
+        for (size_t i = 0; i < m_capacity; ++i) {
+            m_cells[i].~Cell();
+        }
+        CellAllocatorTraits_t::deallocate(m_cellAllocator, m_cells, m_capacity);
+    }
+
+    /**
+     * @brief Try to append the given item.
+     *
+     * @param item  The item to append.
+     * @return true if the item was appended, false if the buffer is full (the item is left
+     * untouched in this case).
+     */
+    bool tryPush(T&& item) { return push(std::move(item)); }
+
+    /**
+     * @brief Try to append a copy of the given item.
+     *
+     * @param item  The item to append.
+     * @return true if the item was appended, false if the buffer is full.
+     */
+    bool tryPush(const T& item) { return push(item); }
+
+    /**
+     * @brief Try to remove the oldest item.
+     *
+     * @return the removed item, std::nullopt if the buffer is empty.
+     */
+    std::optional<T> tryPop() {
+        auto  position = m_dequeuePosition.load(std::memory_order_relaxed);
+        Cell* cell     = nullptr;
+        while (true) {
+            cell                = &m_cells[position & (m_capacity - 1)];
+            const auto sequence = cell->m_sequence.load(std::memory_order_acquire);
+            const auto diff     = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+            if (diff == 0) {
+                if (m_dequeuePosition.compare_exchange_weak(position, position + 1,
+                                                            std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return std::nullopt;
+            } else {
+                position = m_dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        T*               storedItem = std::launder(reinterpret_cast<T*>(&cell->m_storage));
+        std::optional<T> item{std::move(*storedItem)};
+        storedItem->~T();
+        cell->m_sequence.store(position + m_capacity, std::memory_order_release);
+        return item;
+    }
+
+    /**
+     * @brief Indicates if there is no item ready to be popped.
+     */
+    [[nodiscard]] bool empty() const {
+        const auto position = m_dequeuePosition.load(std::memory_order_acquire);
+        const auto sequence =
+            m_cells[position & (m_capacity - 1)].m_sequence.load(std::memory_order_acquire);
+        return static_cast<std::ptrdiff_t>(sequence - (position + 1)) < 0;
+    }
+
+    /**
+     * @brief Get the number of buffered items. Only a snapshot in case of concurrent access.
+     */
+    [[nodiscard]] size_t size() const {
+        const auto dequeuePosition = m_dequeuePosition.load(std::memory_order_acquire);
+        const auto enqueuePosition = m_enqueuePosition.load(std::memory_order_acquire);
+        return enqueuePosition > dequeuePosition ? enqueuePosition - dequeuePosition : 0;
+    }
+
+    [[nodiscard]] size_t capacity() const { return m_capacity; }
+
+    RingBuffer(const RingBuffer&)            = delete;
+    RingBuffer(RingBuffer&&)                 = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+    RingBuffer& operator=(RingBuffer&&)      = delete;
+
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    struct Cell {
+        std::atomic<size_t>                           m_sequence{0};
+        std::aligned_storage_t<sizeof(T), alignof(T)> m_storage;
+    };
+
+    using CellAllocator_t =
+        typename std::allocator_traits<TAllocator>::template rebind_alloc<Cell>;
+    using CellAllocatorTraits_t = std::allocator_traits<CellAllocator_t>;
+
+    template <typename TItem> bool push(TItem&& item) {
+        auto  position = m_enqueuePosition.load(std::memory_order_relaxed);
+        Cell* cell     = nullptr;
+        while (true) {
+            cell                = &m_cells[position & (m_capacity - 1)];
+            const auto sequence = cell->m_sequence.load(std::memory_order_acquire);
+            const auto diff     = static_cast<std::ptrdiff_t>(sequence - position);
+            if (diff == 0) {
+                if (m_enqueuePosition.compare_exchange_weak(position, position + 1,
+                                                            std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                position = m_enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        new (&cell->m_storage) T(std::forward<TItem>(item));
+        cell->m_sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    static size_t roundUpToPowerOfTwo(size_t value) {
+        size_t result = 2;
+        while (result < value) {
+            result <<= 1U;
+        }
+        return result;
+    }
+
+    const size_t    m_capacity;
+    CellAllocator_t m_cellAllocator;
+    Cell*           m_cells;
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_enqueuePosition{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_dequeuePosition{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_RINGBUFFER_H
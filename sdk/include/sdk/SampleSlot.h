@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_SAMPLESLOT_H
+#define VEHICLE_APP_SDK_SAMPLESLOT_H
+
+#include "sdk/DataPointSample.h"
+#include "sdk/DataPointValue.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace velocitas {
+
+/**
+ * @brief Holds the latest scalar sample of a signal as a sequence lock: writers are serialized,
+ * readers never block and only retry if they overlap with a write.
+ *
+ * All fields are lock-free atomics without pointers, so a slot may also be placed in memory
+ * shared between processes. Aligned to a cache line, so adjacent slots do not share one.
+ */
+class alignas(64) SampleSlot final {
+public:
+    using Clock_t = std::chrono::steady_clock;
+
+    /**
+     * @brief A consistent read of a slot.
+     */
+    struct Reading {
+        DataPointSample     sample;
+        Clock_t::time_point receivedAt;
+        /** Number of samples written since the slot was reset */
+        uint64_t            numUpdates{0};
+    };
+
+    SampleSlot() = default;
+
+    /**
+     * @brief Write a sample received at the given time.
+     *
+     * @return false if the sample holds a valid value which is not scalar, which is not written.
+     */
+    bool write(const DataPointSample& sample, Clock_t::time_point receivedAt);
+
+    /**
+     * @brief Reset the slot to hold no sample.
+     */
+    void reset();
+
+    /**
+     * @brief Read the slot, retrying for as long as it overlaps with writes.
+     *
+     * Only for slots whose writer cannot die while writing, i.e. of the same process. Slots shared
+     * with another process are read via tryRead(), see SharedStateTable::readSlot().
+     */
+    [[nodiscard]] Reading read() const;
+
+    /**
+     * @brief Read the slot, giving up after the given number of attempts overlapping with a write.
+     *
+     * @return std::nullopt if each attempt overlapped with a write, e.g. as the writer died while
+     *         writing and the slot stays locked.
+     */
+    [[nodiscard]] std::optional<Reading> tryRead(uint32_t maxAttempts) const;
+
+    /**
+     * @brief Get the number of samples written since the slot was reset, without reading them.
+     */
+    [[nodiscard]] uint64_t getNumUpdates() const {
+        return m_numUpdates.load(std::memory_order_acquire);
+    }
+
+    SampleSlot(const SampleSlot&)            = delete;
+    SampleSlot(SampleSlot&&)                 = delete;
+    SampleSlot& operator=(const SampleSlot&) = delete;
+    SampleSlot& operator=(SampleSlot&&)      = delete;
+    ~SampleSlot()                            = default;
+
+private:
+    uint64_t beginWrite();
+    void     endWrite(uint64_t sequence);
+
+    // odd while a write is in progress
+    std::atomic<uint64_t>                m_sequence{0};
+    std::atomic<DataPointValue::Type>    m_type{DataPointValue::Type::INVALID};
+    std::atomic<DataPointValue::Failure> m_failure{DataPointValue::Failure::NOT_AVAILABLE};
+    std::atomic<uint64_t>                m_valueBits{0};
+    std::atomic<int64_t>                 m_seconds{0};
+    std::atomic<int32_t>                 m_nanos{0};
+    std::atomic<int64_t>                 m_receivedAt{0};
+    std::atomic<uint64_t>                m_numUpdates{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_SAMPLESLOT_H
@@ -0,0 +1,220 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_SIGNALHISTORY_H
+#define VEHICLE_APP_SDK_SIGNALHISTORY_H
+
+#include "sdk/DataPointSample.h"
+#include "sdk/SignalPathRegistry.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <vector>
+
+namespace velocitas {
+
+class DataPointReply;
+
+/**
+ * @brief Configuration of the history of a signal.
+ */
+struct SignalHistoryConfig {
+    static constexpr size_t DEFAULT_CAPACITY = 256;
+
+    /** Maximum number of samples kept */
+    size_t m_capacity{DEFAULT_CAPACITY};
+
+    /**
+     * Samples older than this, relative to the newest sample, are not part of the window the
+     * aggregates are computed over; zero to aggregate all kept samples.
+     */
+    std::chrono::milliseconds m_window{0};
+};
+
+/**
+ * @brief A recorded value of a signal.
+ */
+struct SignalHistorySample {
+    Timestamp timestamp;
+    double    value{0.0};
+};
+
+/**
+ * @brief Aggregates of the samples within the window of a signal history.
+ */
+struct SignalHistoryAggregates {
+    size_t count{0};
+    double sum{0.0};
+    double mean{0.0};
+    double min{0.0};
+    double max{0.0};
+    /** Change of the value per second between the oldest and the newest sample of the window;
+     * zero if they share their timestamp */
+    double rateOfChange{0.0};
+    /** The newest sample */
+    SignalHistorySample latest;
+};
+
+/**
+ * @brief Fixed capacity history of the numeric values of a single signal with incrementally
+ * maintained window aggregates: recording a sample and reading the aggregates take constant
+ * (amortized) time, min and max are tracked via monotonic queues. Not thread-safe, see
+ * SignalHistoryStore.
+ */
+class SignalHistory final {
+public:
+    explicit SignalHistory(const SignalHistoryConfig& config = {});
+
+    /**
+     * @brief Record a sample. Samples are expected in chronological order; a sample older than
+     * the newest one is recorded as if taken at the time of the newest one.
+     */
+    void record(const SignalHistorySample& sample);
+
+    /**
+     * @brief Get the aggregates of the samples within the window.
+     *
+     * @return std::nullopt if no sample was recorded yet.
+     */
+    [[nodiscard]] std::optional<SignalHistoryAggregates> getAggregates() const;
+
+    /**
+     * @brief Get the samples within the window, oldest first.
+     */
+    [[nodiscard]] std::vector<SignalHistorySample> getSamples() const;
+
+    /**
+     * @brief Remove all samples.
+     */
+    void clear();
+
+    [[nodiscard]] const SignalHistoryConfig& getConfig() const { return m_config; }
+
+private:
+    // A bounded queue of sample sequence numbers, ordered by value, for the running min or max.
+    class MonotonicQueue {
+    public:
+        explicit MonotonicQueue(size_t capacity);
+
+        // removes the entries dominated by the new sample, then appends it
+        template <typename TIsDominated> void push(uint64_t sequence, TIsDominated isDominated);
+        void                                   popBefore(uint64_t sequence);
+        [[nodiscard]] uint64_t                 front() const { return m_entries[m_head]; }
+        void                                   clear() { m_size = 0; }
+
+    private:
+        std::vector<uint64_t> m_entries;
+        size_t                m_head{0};
+        size_t                m_size{0};
+    };
+
+    [[nodiscard]] const SignalHistorySample& at(uint64_t sequence) const {
+        return m_samples[sequence % m_samples.size()];
+    }
+    [[nodiscard]] static int64_t toNanoseconds(const Timestamp& timestamp);
+
+    const SignalHistoryConfig        m_config;
+    std::vector<SignalHistorySample> m_samples;
+    // sequence number of the next sample; the window holds [m_windowBegin, m_nextSequence)
+    uint64_t                         m_nextSequence{0};
+    uint64_t                         m_windowBegin{0};
+    double                           m_windowSum{0.0};
+    MonotonicQueue                   m_minQueue;
+    MonotonicQueue                   m_maxQueue;
+};
+
+/**
+ * @brief SDK-wide store of the histories of the signals they were enabled for. Subscriptions
+ * record every received valid numeric value of these signals (before the filters of their
+ * SubscriptionOptions), so apps need no own buffering or polling. With kuksa.val.v2, values
+ * received for several subscriptions of the same signal are recorded once.
+ */
+class SignalHistoryStore final {
+public:
+    static SignalHistoryStore& getInstance();
+
+    SignalHistoryStore() = default;
+
+    /**
+     * @brief Start recording the history of a signal; an existing history is replaced.
+     */
+    void enable(SignalHandle_t signal, const SignalHistoryConfig& config = {});
+
+    /**
+     * @brief Stop recording the history of a signal and drop it.
+     */
+    void disable(SignalHandle_t signal);
+
+    /**
+     * @brief Check if the history of a signal is recorded; cheap if none is recorded at all.
+     */
+    [[nodiscard]] bool isRecording(SignalHandle_t signal) const;
+
+    /**
+     * @brief Record the sample of a signal, if its history is recorded and it holds a valid
+     * numeric scalar. Samples without timestamp are stamped with the current time.
+     */
+    void record(SignalHandle_t signal, const DataPointSample& sample);
+
+    /**
+     * @brief Record all data points of the reply, see above.
+     */
+    void record(const DataPointReply& reply);
+
+    /**
+     * @brief Get the aggregates of the history of a signal.
+     *
+     * @return std::nullopt if the history is not recorded or empty.
+     */
+    [[nodiscard]] std::optional<SignalHistoryAggregates> getAggregates(SignalHandle_t signal) const;
+
+    /**
+     * @brief Get the samples within the window of the history of a signal, oldest first.
+     */
+    [[nodiscard]] std::vector<SignalHistorySample> getSamples(SignalHandle_t signal) const;
+
+    SignalHistoryStore(const SignalHistoryStore&)            = delete;
+    SignalHistoryStore(SignalHistoryStore&&)                 = delete;
+    SignalHistoryStore& operator=(const SignalHistoryStore&) = delete;
+    SignalHistoryStore& operator=(SignalHistoryStore&&)      = delete;
+    ~SignalHistoryStore()                                    = default;
+
+private:
+    struct Entry {
+        explicit Entry(const SignalHistoryConfig& config)
+            : m_history(config) {}
+
+        mutable std::mutex m_mutex;
+        SignalHistory      m_history;
+    };
+
+    [[nodiscard]] std::shared_ptr<Entry> find(SignalHandle_t signal) const;
+
+    mutable std::shared_mutex           m_mutex;
+    // indexed by the signal handle
+    std::vector<std::shared_ptr<Entry>> m_entries;
+    std::atomic<size_t>                 m_numRecordedSignals{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_SIGNALHISTORY_H
@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_SIGNALMIRROR_H
+#define VEHICLE_APP_SDK_SIGNALMIRROR_H
+
+#include "sdk/DataPointSample.h"
+#include "sdk/DataPointValue.h"
+#include "sdk/SampleSlot.h"
+#include "sdk/SignalPathRegistry.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+namespace velocitas {
+
+class DataPointReply;
+
+/**
+ * @brief The latest value of a scalar signal received by any subscription, see SignalMirror.
+ */
+template <typename T> struct LatestValue {
+    using Clock_t = std::chrono::steady_clock;
+
+    T                       value{};
+    DataPointValue::Failure failure{DataPointValue::Failure::NOT_AVAILABLE};
+    /** Time the value was captured at, as provided by the databroker */
+    Timestamp               timestamp{};
+    /** Time the value was received at by the app */
+    Clock_t::time_point     receivedAt{};
+    /** Number of values received since mirroring the signal was enabled */
+    uint64_t                numUpdates{0};
+
+    [[nodiscard]] bool isValid() const { return failure == DataPointValue::Failure::NONE; }
+
+    /**
+     * @brief Get the time passed since the value was received; the maximum duration if no value
+     * was received yet.
+     */
+    [[nodiscard]] Clock_t::duration getAge() const {
+        return numUpdates == 0 ? Clock_t::duration::max() : Clock_t::now() - receivedAt;
+    }
+
+    /**
+     * @brief Check if the value is valid and was received within the given duration.
+     */
+    [[nodiscard]] bool isFresh(Clock_t::duration maxAge) const {
+        return isValid() && getAge() <= maxAge;
+    }
+};
+
+/**
+ * @brief SDK-wide mirror of the latest values of the scalar signals it was enabled for.
+ * Subscriptions write every received value of these signals (before the filters of their
+ * SubscriptionOptions) into a per-signal slot, which any thread can read at a high rate without
+ * an RPC and without taking a lock.
+ *
+ * Each slot is a SampleSlot, i.e. a sequence lock. Slots are allocated in chunks on enable() and
+ * never move, so finding the slot of a signal takes no lock either.
+ */
+class SignalMirror final {
+public:
+    using Clock_t = SampleSlot::Clock_t;
+    using Reading = SampleSlot::Reading;
+
+    /** Maximum number of signal handles which can be mirrored */
+    static constexpr size_t MAX_NUM_SIGNALS = size_t{1} << 20U;
+
+    static SignalMirror& getInstance();
+
+    SignalMirror();
+
+    /**
+     * @brief Start mirroring the latest value of a signal; a mirrored value is reset.
+     *
+     * @throw InvalidValueException if the handle is not below MAX_NUM_SIGNALS.
+     */
+    void enable(SignalHandle_t signal);
+
+    /**
+     * @brief Stop mirroring the latest value of a signal.
+     */
+    void disable(SignalHandle_t signal);
+
+    /**
+     * @brief Check if the latest value of a signal is mirrored; cheap if none is mirrored at all.
+     */
+    [[nodiscard]] bool isMirroring(SignalHandle_t signal) const;
+
+    /**
+     * @brief Write the sample of a signal to its slot, if the signal is mirrored. Values which are
+     * not scalar are ignored.
+     */
+    void record(SignalHandle_t signal, const DataPointSample& sample,
+                Clock_t::time_point receivedAt = Clock_t::now());
+
+    /**
+     * @brief Record all data points of the reply, see above.
+     */
+    void record(const DataPointReply& reply);
+
+    /**
+     * @brief Read the slot of a signal.
+     *
+     * @return false if the signal is not mirrored.
+     */
+    bool read(SignalHandle_t signal, Reading& reading) const;
+
+    /**
+     * @brief Get the latest value of a signal as the given scalar type. Values of integer types
+     * narrower than 32 bit, transported as the 32 bit type, are narrowed; values of another type
+     * fail with INVALID_VALUE.
+     */
+    template <typename T> [[nodiscard]] LatestValue<T> getLatest(SignalHandle_t signal) const {
+        static_assert(std::is_arithmetic_v<T>, "Only scalar values are mirrored");
+        LatestValue<T> latest;
+        Reading        reading;
+        if (!read(signal, reading)) {
+            return latest;
+        }
+        latest.timestamp  = reading.sample.getTimestamp();
+        latest.receivedAt = reading.receivedAt;
+        latest.numUpdates = reading.numUpdates;
+        latest.failure    = reading.sample.getFailure();
+        if (!reading.sample.isValid()) {
+            return latest;
+        }
+        if (const auto* value = reading.sample.getIf<T>()) {
+            latest.value = *value;
+            return latest;
+        }
+        if constexpr (!std::is_same_v<T, detail::TransportType_t<T>>) {
+            const auto* transported = reading.sample.getIf<detail::TransportType_t<T>>();
+            if (transported != nullptr && detail::narrowTransported(*transported, latest.value)) {
+                return latest;
+            }
+        }
+        latest.failure = DataPointValue::Failure::INVALID_VALUE;
+        return latest;
+    }
+
+    SignalMirror(const SignalMirror&)            = delete;
+    SignalMirror(SignalMirror&&)                 = delete;
+    SignalMirror& operator=(const SignalMirror&) = delete;
+    SignalMirror& operator=(SignalMirror&&)      = delete;
+    ~SignalMirror();
+
+private:
+    static constexpr size_t CHUNK_SIZE = 256;
+    static constexpr size_t NUM_CHUNKS = MAX_NUM_SIGNALS / CHUNK_SIZE;
+
+    struct Chunk {
+        std::array<SampleSlot, CHUNK_SIZE>        m_slots;
+        std::array<std::atomic<bool>, CHUNK_SIZE> m_isEnabled{};
+    };
+
+    // returns the chunk holding the slot of the signal, nullptr if none is allocated
+    [[nodiscard]] Chunk* findChunk(SignalHandle_t signal) const;
+
+    // serializes allocating chunks and enabling or disabling signals
+    std::mutex                             m_mutex;
+    std::unique_ptr<std::atomic<Chunk*>[]> m_chunks;
+    std::atomic<size_t>                    m_numMirroredSignals{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_SIGNALMIRROR_H
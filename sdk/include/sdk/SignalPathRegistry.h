@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_SIGNALPATHREGISTRY_H
+#define VEHICLE_APP_SDK_SIGNALPATHREGISTRY_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace velocitas {
+
+/** Handle of an interned signal path; stays valid for the lifetime of the process */
+using SignalHandle_t = uint32_t;
+
+constexpr SignalHandle_t INVALID_SIGNAL_HANDLE = std::numeric_limits<SignalHandle_t>::max();
+
+/**
+ * @brief SDK-wide intern table for signal paths. Each distinct path is stored once and is
+ *        referred to by a small, dense integer handle. Handles are assigned in ascending order
+ *        starting at 0, so they can be used as indices into vectors.
+ *
+ *        Interned paths are never removed, which is fine for the bounded set of (VSS) signals
+ *        an app deals with.
+ */
+class SignalPathRegistry {
+public:
+    static SignalPathRegistry& getInstance();
+
+    ~SignalPathRegistry();
+
+    SignalPathRegistry(const SignalPathRegistry&)            = delete;
+    SignalPathRegistry(SignalPathRegistry&&)                 = delete;
+    SignalPathRegistry& operator=(const SignalPathRegistry&) = delete;
+    SignalPathRegistry& operator=(SignalPathRegistry&&)      = delete;
+
+    /**
+     * @brief Get the handle of the given path, interning the path if it is not known yet.
+     *
+     * @param path  The signal path.
+     * @throw std::length_error if the maximum number of paths is exceeded.
+     * @return SignalHandle_t  The handle of the path.
+     */
+    SignalHandle_t intern(std::string_view path);
+
+    /**
+     * @brief Get the handle of the given path without interning it.
+     *
+     * @param path  The signal path.
+     * @return std::optional<SignalHandle_t>  The handle, std::nullopt if the path is not interned.
+     */
+    [[nodiscard]] std::optional<SignalHandle_t> find(std::string_view path) const;
+
+    /**
+     * @brief Get the path of the given handle. This does not take any lock. The returned
+     *        reference stays valid for the lifetime of the process.
+     *
+     * @param handle  Handle returned by intern().
+     * @throw std::out_of_range if the handle is unknown.
+     * @return const std::string&  The path.
+     */
+    [[nodiscard]] const std::string& getPath(SignalHandle_t handle) const;
+
+    /**
+     * @brief Get the number of interned paths.
+     */
+    [[nodiscard]] size_t size() const { return m_size.load(std::memory_order_acquire); }
+
+    /** Number of paths stored per chunk of the table */
+    static constexpr size_t CHUNK_SIZE = 1024;
+    /** Maximum number of chunks, i.e. the table holds up to CHUNK_SIZE * MAX_CHUNKS paths */
+    static constexpr size_t MAX_CHUNKS = 1024;
+
+private:
+    SignalPathRegistry() = default;
+
+    // Paths are stored in fixed size chunks which are never moved, so readers holding a handle
+    // can access its path without locking.
+    mutable std::shared_mutex                            m_mutex;
+    std::unordered_map<std::string_view, SignalHandle_t> m_handles;
+    std::array<std::atomic<std::string*>, MAX_CHUNKS>    m_chunks{};
+    std::atomic<size_t>                                  m_size{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_SIGNALPATHREGISTRY_H
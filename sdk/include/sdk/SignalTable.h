@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_SIGNALTABLE_H
+#define VEHICLE_APP_SDK_SIGNALTABLE_H
+
+#include "sdk/DataPointValue.h"
+#include "sdk/Node.h"
+#include "sdk/SignalPathRegistry.h"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief Static description of one signal of a generated vehicle model.
+ */
+struct SignalDescriptor {
+    /** Fully qualified path of the signal, e.g. "Vehicle.Speed" */
+    std::string_view     path;
+    DataPointValue::Type dataType;
+    Node::Type           nodeType;
+};
+
+/**
+ * @brief Contiguous table of all signals of a generated vehicle model.
+ *
+ * The descriptors are generated as constexpr array in depth-first order of the model, so the
+ * signals of each branch occupy a contiguous range of indices. All paths are interned into the
+ * SignalPathRegistry once, when the table is constructed; data points constructed from the table
+ * take their path and handle from it instead of assembling and interning the path themselves.
+ * Declaring the table to the VehicleApp (see VehicleApp::declareSignals) resolves the numeric
+ * ids of all signals at connect time.
+ */
+class SignalTable final {
+public:
+    /**
+     * @param descriptors  The descriptors; need to outlive the table (usually static).
+     * @param size         Number of descriptors.
+     */
+    SignalTable(const SignalDescriptor* descriptors, size_t size);
+
+    template <size_t N>
+    explicit SignalTable(const std::array<SignalDescriptor, N>& descriptors)
+        : SignalTable(descriptors.data(), N) {}
+
+    [[nodiscard]] size_t size() const { return m_size; }
+
+    /**
+     * @brief Get the descriptor of the signal at the given index.
+     *
+     * @throw std::out_of_range if the index is outside of the table.
+     */
+    [[nodiscard]] const SignalDescriptor& getDescriptor(size_t index) const;
+
+    /**
+     * @brief Get the handle of the path of the signal at the given index.
+     *
+     * @throw std::out_of_range if the index is outside of the table.
+     */
+    [[nodiscard]] SignalHandle_t getHandle(size_t index) const;
+
+    /**
+     * @brief Get the index of the signal with the given path handle.
+     *
+     * @return std::optional<size_t>  The index, std::nullopt if the signal is not in the table.
+     */
+    [[nodiscard]] std::optional<size_t> findIndex(SignalHandle_t handle) const;
+
+    /**
+     * @brief Get the paths of all signals of the table, in table order.
+     */
+    [[nodiscard]] std::vector<std::string> getSignalPaths() const;
+
+    SignalTable(const SignalTable&)            = delete;
+    SignalTable(SignalTable&&)                 = delete;
+    SignalTable& operator=(const SignalTable&) = delete;
+    SignalTable& operator=(SignalTable&&)      = delete;
+    ~SignalTable()                             = default;
+
+private:
+    const SignalDescriptor*     m_descriptors;
+    size_t                      m_size;
+    std::vector<SignalHandle_t> m_handles;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_SIGNALTABLE_H
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_STRAND_H
+#define VEHICLE_APP_SDK_STRAND_H
+
+#include "sdk/Job.h"
+#include "sdk/JobFunction.h"
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace velocitas {
+
+class ThreadPool;
+
+/**
+ * @brief Serial executor on top of a ThreadPool.
+ *
+ * Functions posted to the same strand are executed one after the other in the order they were
+ * posted, never concurrently, while functions of different strands run in parallel on the
+ * workers of the pool. A strand does not occupy a worker while it has nothing to do; it only
+ * schedules a job to the pool when the first function is posted to it.
+ */
+class Strand final : public std::enable_shared_from_this<Strand> {
+public:
+    /**
+     * @brief Create a new strand.
+     *
+     * @param threadPool  Pool executing the functions of the strand. If nullptr, the default
+     *                    pool is used.
+     * @param priority    Priority class the strand is scheduled with on the pool.
+     * @return std::shared_ptr<Strand>
+     */
+    static std::shared_ptr<Strand> create(std::shared_ptr<ThreadPool> threadPool = nullptr,
+                                          JobPriority priority = JobPriority::NORMAL);
+
+    /**
+     * @brief Execute the given function asynchronously, after all functions posted before.
+     *
+     * @param fun  The function to execute.
+     */
+    void post(JobFunction fun);
+
+    /**
+     * @brief Append the given function to the strand without scheduling the strand itself. This
+     * allows the caller to enqueue the jobs of multiple strands at once.
+     *
+     * @param fun  The function to execute.
+     * @return JobPtr_t which needs to be enqueued to the pool to process the strand, nullptr if
+     * the strand is already scheduled.
+     */
+    [[nodiscard]] JobPtr_t push(JobFunction fun);
+
+    /**
+     * @brief Indicates if the calling thread is currently executing a function of this strand.
+     */
+    [[nodiscard]] bool isRunningInThisThread() const;
+
+    [[nodiscard]] size_t getNumPendingJobs() const;
+
+    [[nodiscard]] const std::shared_ptr<ThreadPool>& getThreadPool() const { return m_threadPool; }
+
+    [[nodiscard]] JobPriority getPriority() const { return m_priority; }
+
+    Strand(const Strand&)            = delete;
+    Strand(Strand&&)                 = delete;
+    Strand& operator=(const Strand&) = delete;
+    Strand& operator=(Strand&&)      = delete;
+
+    ~Strand() = default;
+
+private:
+    Strand(std::shared_ptr<ThreadPool> threadPool, JobPriority priority);
+
+    JobPtr_t createProcessingJob();
+    void     processPendingJobs();
+
+    std::shared_ptr<ThreadPool> m_threadPool;
+    const JobPriority           m_priority;
+    mutable std::mutex          m_mutex;
+    std::deque<JobFunction>     m_pendingJobs;
+    bool                        m_isScheduled{false};
+};
+
+using StrandPtr_t = std::shared_ptr<Strand>;
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_STRAND_H
@@ -0,0 +1,235 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_SUBSCRIPTIONVIEW_H
+#define VEHICLE_APP_SDK_SUBSCRIPTIONVIEW_H
+
+#include "sdk/AsyncResult.h"
+#include "sdk/CallbackExecutor.h"
+#include "sdk/DataPoint.h"
+#include "sdk/DataPointReply.h"
+#include "sdk/DataPointSample.h"
+#include "sdk/DataPointValue.h"
+#include "sdk/Exceptions.h"
+#include "sdk/Query.h"
+#include "sdk/SignalPathRegistry.h"
+#include "sdk/Status.h"
+#include "sdk/Utils.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief The latest value of one signal within a view, see SubscriptionView.
+ *
+ * @tparam T  Value type of the signal, i.e. the value_type of its TypedDataPoint.
+ */
+template <typename T> struct SignalField {
+    T                       value{};
+    /** False if no valid value of the signal was received yet, or the latest one is invalid */
+    bool                    isValid{false};
+    /** True if the signal was updated by the delivery the view was filled by */
+    bool                    wasUpdated{false};
+    DataPointValue::Failure failure{DataPointValue::Failure::NOT_AVAILABLE};
+    Timestamp               timestamp{};
+};
+
+/**
+ * @brief Fills a plain struct of SignalField members from the replies of a subscription, so
+ * callbacks read the signals as struct fields instead of looking them up in each reply.
+ *
+ * The fields are bound to their signals once; filling a view then finds each bound signal by its
+ * interned handle and copies the decoded value into the field, without allocating (apart from
+ * string and array values). Signals not contained in a reply (e.g. with
+ * SubscriptionMode::DELTA_ONLY) keep their previous value, with wasUpdated cleared.
+ *
+ *     struct Motion {
+ *         SignalField<float>   speed;
+ *         SignalField<int32_t> gear;
+ *     };
+ *     auto view = SubscriptionView<Motion>()
+ *                     .bind(&Motion::speed, vehicle.Speed)
+ *                     .bind(&Motion::gear, vehicle.Powertrain.Transmission.CurrentGear);
+ *     view.attach(subscribeDataPoints(view.buildQuery()))
+ *         ->onItem([](const Motion& motion) { ... });
+ *
+ * @tparam TView  The struct holding the fields; needs to be default constructible and copyable.
+ */
+template <typename TView> class SubscriptionView final {
+public:
+    /**
+     * @brief Bind a field to the signal of a data point of the vehicle model. The field's value
+     * type needs to match the data point's one.
+     */
+    template <typename T>
+    SubscriptionView& bind(SignalField<T> TView::*field, const TypedDataPoint<T>& dataPoint) {
+        return bind(field, dataPoint.getSignalHandle());
+    }
+
+    /**
+     * @brief Bind a field to a signal given by the interned handle of its path. Values of another
+     * type than T are delivered as invalid with failure INVALID_VALUE.
+     */
+    template <typename T>
+    SubscriptionView& bind(SignalField<T> TView::*field, SignalHandle_t signal) {
+        if (field == nullptr) {
+            throw InvalidValueException("SubscriptionView needs a field to bind");
+        }
+        m_bindings.push_back(
+            Binding{signal, [field](TView& view, const DataPointReply::Entry* entry) {
+                        auto& target = view.*field;
+                        if (entry == nullptr) {
+                            target.wasUpdated = false;
+                            return;
+                        }
+                        const auto sample = DataPointReply::getSample(*entry);
+                        target.wasUpdated = DataPointReply::wasUpdated(*entry);
+                        target.timestamp  = sample.getTimestamp();
+                        if (const auto* value = sample.template getIf<T>()) {
+                            target.value   = *value;
+                            target.isValid = true;
+                            target.failure = DataPointValue::Failure::NONE;
+                        } else {
+                            target.isValid = false;
+                            target.failure = sample.isValid()
+                                                 ? DataPointValue::Failure::INVALID_VALUE
+                                                 : sample.getFailure();
+                        }
+                    },
+                    [field](const TView& view) {
+                        const auto& source = view.*field;
+                        if (source.isValid) {
+                            return DataPointSample(source.value, source.timestamp);
+                        }
+                        return DataPointSample(getValueType<T>(), source.failure, source.timestamp);
+                    }});
+        return *this;
+    }
+
+    [[nodiscard]] size_t getNumSignals() const { return m_bindings.size(); }
+
+    /**
+     * @brief Get the handles of the bound signals, in the order of binding.
+     */
+    [[nodiscard]] std::vector<SignalHandle_t> getSignals() const {
+        std::vector<SignalHandle_t> signals;
+        signals.reserve(m_bindings.size());
+        for (const auto& binding : m_bindings) {
+            signals.push_back(binding.signal);
+        }
+        return signals;
+    }
+
+    /**
+     * @brief Build the query selecting all bound signals, to subscribe to.
+     */
+    [[nodiscard]] Query buildQuery() const {
+        auto                     signals = getSignals();
+        std::vector<std::string> paths;
+        paths.reserve(signals.size());
+        for (const auto signal : signals) {
+            paths.push_back(SignalPathRegistry::getInstance().getPath(signal));
+        }
+        return Query(std::move(signals), {}, "SELECT " + StringUtils::join(paths, ", "));
+    }
+
+    /**
+     * @brief Fill the bound fields of the view from the reply.
+     */
+    void fill(TView& view, const DataPointReply& reply) const { fill(m_bindings, view, reply); }
+
+    /**
+     * @brief Invoke the visitor with the handle and the sample of each bound field of the view, in
+     * the order of binding, e.g. to serialize the view (see ReplySerializer).
+     *
+     * @param visitor  Callable of signature void(SignalHandle_t, const DataPointSample&).
+     */
+    template <typename TVisitor> void visitSamples(const TView& view, TVisitor&& visitor) const {
+        for (const auto& binding : m_bindings) {
+            visitor(binding.signal, binding.sample(view));
+        }
+    }
+
+    /**
+     * @brief Create a subscription delivering the view filled by each reply of the source. The
+     * view is filled by the thread running the callbacks of the source, which then invokes the
+     * callbacks of the returned subscription inline. Cancelling the returned subscription cancels
+     * the source with its next reply; errors of the source are passed on.
+     *
+     * @param source  The subscription of the bound signals, e.g. of subscribeDataPoints; it must
+     *                not have callbacks yet.
+     */
+    AsyncSubscriptionPtr_t<TView>
+    attach(const AsyncSubscriptionPtr_t<DataPointReply>& source) const {
+        if (!source) {
+            throw InvalidValueException("SubscriptionView needs a source subscription");
+        }
+        auto target   = std::make_shared<AsyncSubscription<TView>>();
+        auto bindings = std::make_shared<const std::vector<Binding>>(m_bindings);
+        // the view is kept between the replies, so signals missing in a reply keep their value
+        auto view = std::make_shared<TView>();
+        target->setCallbackExecutor(CallbackExecutor::createInline());
+        std::weak_ptr<AsyncSubscription<DataPointReply>> weakSource = source;
+        // like the subscriptions of a broker client, the returned one is kept alive by its producer
+        source
+            ->onItem([weakSource, target, bindings, view](const DataPointReply& reply) {
+                if (target->isCancelled()) {
+                    if (auto replySubscription = weakSource.lock()) {
+                        replySubscription->cancel();
+                    }
+                    return;
+                }
+                fill(*bindings, *view, reply);
+                target->insertNewItem(TView(*view));
+            })
+            ->onError([target](Status status) { target->insertError(std::move(status)); });
+        target->setSnapshotProvider([weakSource, bindings]() {
+            TView snapshotView;
+            if (auto replySubscription = weakSource.lock()) {
+                if (auto snapshot = replySubscription->getSharedSnapshot()) {
+                    fill(*bindings, snapshotView, *snapshot);
+                }
+            }
+            return snapshotView;
+        });
+        return target;
+    }
+
+private:
+    struct Binding {
+        SignalHandle_t                                             signal;
+        std::function<void(TView&, const DataPointReply::Entry*)> assign;
+        std::function<DataPointSample(const TView&)>              sample;
+    };
+
+    static void fill(const std::vector<Binding>& bindings, TView& view,
+                     const DataPointReply& reply) {
+        for (const auto& binding : bindings) {
+            binding.assign(view, reply.find(binding.signal));
+        }
+    }
+
+    std::vector<Binding> m_bindings;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_SUBSCRIPTIONVIEW_H
@@ -17,39 +17,182 @@
 #ifndef VEHICLE_APP_SDK_THREADPOOL_H
 #define VEHICLE_APP_SDK_THREADPOOL_H
 
+#include "sdk/BuildProfile.h"
+#include "sdk/Histogram.h"
 #include "sdk/Job.h"
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <string>
 #include <thread>
 #include <vector>
 
 namespace velocitas {
 
+/**
+ * @brief Strategy used by a ThreadPool to distribute jobs among its worker threads.
+ */
+enum class SchedulingMode {
+    /**
+     * @brief All jobs are kept in a single queue shared by all workers.
+     */
+    SHARED_QUEUE,
+    /**
+     * @brief Each worker owns a queue of immediately executable jobs, idle workers steal jobs
+     * from busy ones.
+     */
+    WORK_STEALING
+};
+
+/**
+ * @brief Configuration of a thread pool.
+ */
+struct ThreadPoolConfig {
+    /**
+     * @brief Name of the pool. Worker threads are named "<name>-<worker index>" (truncated to
+     * the length supported by the OS).
+     */
+    std::string    name;
+    size_t         numWorkerThreads{PROFILE_NUM_WORKER_THREADS};
+    SchedulingMode schedulingMode{SchedulingMode::SHARED_QUEUE};
+    /**
+     * @brief Indices of the CPUs the worker threads shall be bound to. Empty means no binding.
+     */
+    std::vector<int> cpuAffinity;
+    /**
+     * @brief If greater than zero, worker threads are run with SCHED_FIFO at this priority.
+     * This usually requires elevated privileges; if it cannot be applied a warning is logged.
+     */
+    int realtimePriority{0};
+    /**
+     * @brief Executable jobs of a higher priority class run before the ones of lower classes,
+     * unless the oldest job of a lower class is waiting for longer than this. Zero disables the
+     * starvation protection, i.e. lower classes only run when no higher class job is waiting.
+     */
+    std::chrono::milliseconds starvationLimit{50};
+};
+
+/**
+ * @brief Utilization data of a single worker thread of a pool.
+ */
+struct WorkerMetrics {
+    uint64_t                 numExecutedJobs{0};
+    std::chrono::nanoseconds busyTime{0};
+    /** Ratio of busyTime to the time elapsed since the metrics were (re)started, in [0, 1] */
+    double utilization{0.0};
+};
+
+/**
+ * @brief Snapshot of the metrics collected by a thread pool since its creation or the last call
+ * of ThreadPool::resetMetrics. Durations are given in nanoseconds.
+ */
+struct ThreadPoolMetrics {
+    /** Time from a job becoming executable (enqueued or due) until its execution started */
+    HistogramSnapshot schedulingLatency;
+    /** The scheduling latency of the jobs of each priority class, indexed by JobPriority */
+    std::array<HistogramSnapshot, NUM_JOB_PRIORITIES> schedulingLatencyByPriority;
+    /** Duration of the job executions */
+    HistogramSnapshot executionTime;
+    /** Number of executable jobs waiting for a worker, sampled whenever jobs are enqueued */
+    HistogramSnapshot queueDepth;
+
+    size_t                     currentQueueDepth{0};
+    size_t                     peakQueueDepth{0};
+    uint64_t                   numExecutedJobs{0};
+    /** Number of job executions which threw an exception */
+    uint64_t                   numFailedJobs{0};
+    std::chrono::nanoseconds   elapsedTime{0};
+    std::vector<WorkerMetrics> workers;
+};
+
+/**
+ * @brief Outcome of ThreadPool::shutdown.
+ */
+struct ThreadPoolShutdownReport {
+    /** Number of jobs executed while draining */
+    uint64_t numDrainedJobs{0};
+    /** Number of executable jobs discarded because the deadline expired */
+    size_t numDroppedJobs{0};
+    /** Number of jobs discarded because they were waiting for becoming due */
+    size_t numDroppedDelayedJobs{0};
+    /** Number of jobs refused because they were enqueued while shutting down */
+    uint64_t numRejectedJobs{0};
+    /** True if all executable jobs were executed before the deadline */
+    bool isDrained{false};
+};
+
+class TimerWheel;
+
 /**
  * @brief Manages a pool of threads which are capable of executing jobs asynchronously.
  *
+ * Jobs not being due at the time they are enqueued are kept in a timer wheel until they become
+ * due and are moved to the queue(s) of executable jobs then. The executable jobs are queued in one
+ * lane per priority class (see IJob::setPriority), so e.g. the delivery of safety relevant signals
+ * is not queued behind bulk work sharing the pool.
  */
 class ThreadPool final {
 public:
     ThreadPool();
-    explicit ThreadPool(size_t numWorkerThreads);
+    explicit ThreadPool(size_t         numWorkerThreads,
+                        SchedulingMode schedulingMode = SchedulingMode::SHARED_QUEUE);
+    explicit ThreadPool(ThreadPoolConfig config);
 
     ~ThreadPool();
 
+    /** Name of the pool used for user jobs and for all subsystems not having an own pool */
+    static constexpr const char* DEFAULT_POOL = "default";
+    /** Name of the pool used by the vehicle data broker clients (e.g. re-subscriptions) */
+    static constexpr const char* VDB_POOL = "vdb";
+    /** Name of the pool used by the vehicle data broker clients for metadata requests */
+    static constexpr const char* METADATA_POOL = "metadata";
+    /** Name of the pool used for dispatching pub/sub messages to the subscribers */
+    static constexpr const char* PUBSUB_POOL = "pubsub";
+
     /**
-     * @brief Get the Instance object.
+     * @brief Get the Instance object, i.e. the default pool.
+     *
+     * Unless configured differently via configure, the scheduling mode of the instance can be
+     * selected via the environment variable SDV_THREADPOOL_SCHEDULING_MODE ("shared_queue"
+     * (default) or "work_stealing").
      *
      * @return std::shared_ptr<ThreadPool>
      */
     static std::shared_ptr<ThreadPool> getInstance();
 
+    /**
+     * @brief Get the named pool instance. The pool is created on first access according to the
+     * configuration passed to configure. If no configuration exists for the name, the default
+     * pool is returned, and the name stays bound to it: a later configure of the name is
+     * rejected. As the lookup takes the registry lock, components resolve their pool once, e.g.
+     * on construction, instead of on every use.
+     *
+     * @param name  Name of the pool, e.g. one of the subsystem pool names.
+     * @return std::shared_ptr<ThreadPool>
+     */
+    static std::shared_ptr<ThreadPool> getInstance(const std::string& name);
+
+    /**
+     * @brief Define the configuration of a named pool. This needs to be done before the pool is
+     * accessed for the first time, i.e. before the subsystem using it is created.
+     *
+     * @param config  The configuration; config.name identifies the pool.
+     * @return true if the configuration was stored, false if the name was already requested via
+     *         getInstance (even if it got the default pool then).
+     */
+    static bool configure(const ThreadPoolConfig& config);
+
+    [[nodiscard]] const std::string& getName() const { return m_config.name; }
+
     [[nodiscard]] size_t getNumWorkerThreads() const;
 
+    [[nodiscard]] SchedulingMode getSchedulingMode() const { return m_config.schedulingMode; }
+
     /**
      * @brief Enqueue the given job to be executed asynchronously by one of the worker threads.
      *
@@ -57,24 +200,179 @@ public:
      */
     void enqueue(JobPtr_t job);
 
+    /**
+     * @brief Enqueue all given jobs at once. Compared to enqueuing them one by one, the queue
+     * lock is taken only once and only as many workers are woken up as there are jobs to execute.
+     *
+     * @param jobs  The jobs to execute.
+     */
+    void enqueueBatch(std::vector<JobPtr_t> jobs);
+
+    /**
+     * @brief Execute the given function asynchronously by one of the worker threads.
+     *
+     * The function is wrapped into a pooled LightJob, so for small callables this does not
+     * allocate memory in steady state.
+     *
+     * @param fun       The function to execute.
+     * @param delay     Delay before the function is executed.
+     * @param priority  Priority class of the function.
+     */
+    void post(JobFunction fun, std::chrono::milliseconds delay = std::chrono::milliseconds::zero(),
+              JobPriority priority = JobPriority::NORMAL);
+
+    /**
+     * @brief Cancel the given job if it is waiting for becoming due. The job is removed from the
+     * pool and will not be executed.
+     *
+     * @param job  The job to cancel.
+     * @return true if the job was pending and got removed, false if it was not waiting for
+     * becoming due (i.e. unknown, already executable, executing or executed).
+     */
+    bool cancel(const JobPtr_t& job);
+
+    /**
+     * @brief Wait until no job is executing and no executable job is queued, i.e. until the
+     * in-flight work is done. Jobs waiting for becoming due are not waited for. If called by a
+     * worker of the pool, the job calling it does not count.
+     *
+     * @param timeout  Maximum time to wait.
+     * @return true if the pool got idle within the timeout, false otherwise.
+     */
+    [[nodiscard]] bool waitUntilIdle(std::chrono::milliseconds timeout) const;
+
+    /**
+     * @brief Stop the pool within a bounded time.
+     *
+     * The pool stops accepting jobs right away, except executable jobs enqueued by its own
+     * workers (i.e. continuations of the jobs being drained). Jobs waiting for becoming due are
+     * discarded and recurring jobs are not re-scheduled anymore. Executable jobs are executed
+     * until the pool is idle or the timeout expired, the remaining ones are discarded then. Jobs
+     * being executed at the deadline are waited for, as they cannot be interrupted. Must not be
+     * called by a worker of the pool.
+     *
+     * @param timeout  Maximum time to spend on draining the executable jobs.
+     * @return ThreadPoolShutdownReport  What was executed and what was dropped; empty if the pool
+     * was shut down already.
+     */
+    ThreadPoolShutdownReport shutdown(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Get the metrics collected by the pool. The workers record them using lock-free
+     * histograms and counters, so they are cheap enough to be always enabled.
+     *
+     * @return ThreadPoolMetrics
+     */
+    [[nodiscard]] ThreadPoolMetrics getMetrics() const;
+
+    /**
+     * @brief Restart collecting metrics, e.g. at the start of a new monitoring interval.
+     */
+    void resetMetrics();
+
     ThreadPool(const ThreadPool&)            = delete;
     ThreadPool(ThreadPool&&)                 = delete;
     ThreadPool& operator=(const ThreadPool&) = delete;
     ThreadPool& operator=(ThreadPool&&)      = delete;
 
 private:
+    /**
+     * @brief Immediately executable jobs, in one FIFO lane per priority class.
+     */
+    class JobLanes {
+    public:
+        void push(JobPtr_t job);
+
+        /**
+         * @brief Take the oldest job of the highest class, unless the oldest job of a lower class
+         * is waiting for longer than the starvation limit (if not zero).
+         */
+        JobPtr_t pop(Clock::duration starvationLimit);
+
+        /**
+         * @brief Take the newest job of the highest class, i.e. the opposite end pop takes from.
+         */
+        JobPtr_t popBack();
+
+        [[nodiscard]] size_t size() const { return m_size; }
+        [[nodiscard]] bool   empty() const { return m_size == 0; }
+        void                 clear();
+
+    private:
+        std::array<std::deque<JobPtr_t>, NUM_JOB_PRIORITIES> m_lanes;
+        size_t                                               m_size{0};
+    };
+
+    /**
+     * @brief Queue of immediately executable jobs owned by a single worker.
+     */
+    struct WorkerQueue {
+        std::mutex m_mutex;
+        JobLanes   m_jobs;
+    };
+
+    /**
+     * @brief Execution counters of a single worker.
+     */
+    struct WorkerStatistics {
+        std::atomic<uint64_t> m_numExecutedJobs{0};
+        std::atomic<uint64_t> m_busyTimeNs{0};
+    };
+
+    [[nodiscard]] bool     isAccepting(const IJob& job) const;
+    [[nodiscard]] bool     isIdle() const;
+    [[nodiscard]] uint64_t getNumExecutedJobs() const;
+    size_t                 stopWorkers();
+
     JobPtr_t getNextExecutableJob();
     void     waitForPotentiallyExecutableJob() const;
-    void     threadLoop();
+    void     threadLoop(size_t workerIndex);
+    // returns false if the job destroyed the pool, which must not be touched anymore then
+    bool     runJob(size_t workerIndex, const JobPtr_t& job);
+    void     recordQueueDepth(size_t queueDepth);
 
-    using QueueType =
-        std::priority_queue<JobPtr_t, std::deque<JobPtr_t>, decltype(lowerJobPriority)*>;
+    void     enqueueImmediateJob(JobPtr_t job);
+    void     enqueueImmediateJobs(std::vector<JobPtr_t>::iterator begin,
+                                  std::vector<JobPtr_t>::iterator end);
+    void     wakeUpWorkers(size_t numJobs) const;
+    void     enqueueDelayedJob(JobPtr_t job);
+    void     collectDueDelayedJobs(std::vector<JobPtr_t>& dueJobs);
+    void     updateNextDelayedJobDue();
+    JobPtr_t popOwnJob(size_t workerIndex);
+    JobPtr_t popDueDelayedJob();
+    JobPtr_t stealJob(size_t thiefIndex);
+    void     waitForWork() const;
+    void     workStealingThreadLoop(size_t workerIndex);
+    void     applyThreadSettings(size_t workerIndex) const;
 
+    const ThreadPoolConfig          m_config;
     mutable std::mutex              m_queueMutex;
     mutable std::condition_variable m_cv;
-    QueueType                       m_jobs;
+    JobLanes                        m_jobs;
+    std::unique_ptr<TimerWheel>     m_timerWheel;
     std::vector<std::thread>        m_workerThreads;
     std::atomic_bool                m_isRunning{true};
+    std::atomic_bool                m_isAccepting{true};
+    std::atomic_bool                m_isShutDown{false};
+    std::atomic_size_t              m_numExecutingJobs{0};
+    std::atomic<uint64_t>           m_numRejectedJobs{0};
+    std::atomic<Clock::rep>         m_nextDelayedJobDue;
+    size_t                          m_delayedJobsGeneration{0};
+
+    Histogram                                      m_schedulingLatency;
+    std::array<Histogram, NUM_JOB_PRIORITIES>      m_schedulingLatencyByPriority;
+    Histogram                                      m_executionTime;
+    Histogram                                      m_queueDepth;
+    std::atomic_size_t                             m_peakQueueDepth{0};
+    std::atomic<uint64_t>                          m_numFailedJobs{0};
+    std::atomic<Clock::rep>                        m_metricsStart;
+    std::vector<std::unique_ptr<WorkerStatistics>> m_workerStatistics;
+
+    // only used in SchedulingMode::WORK_STEALING
+    std::vector<std::unique_ptr<WorkerQueue>> m_workerQueues;
+    std::atomic_size_t                        m_numImmediateJobs{0};
+    mutable std::atomic_size_t                m_numIdleWorkers{0};
+    std::atomic_size_t                        m_nextWorkerQueue{0};
 };
 
 } // namespace velocitas
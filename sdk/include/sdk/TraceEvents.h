@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_TRACEEVENTS_H
+#define VEHICLE_APP_SDK_TRACEEVENTS_H
+
+#include "sdk/RingBuffer.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#ifndef VELOCITAS_TRACE_EVENTS
+#define VELOCITAS_TRACE_EVENTS 0
+#endif
+
+namespace velocitas {
+
+/**
+ * @brief A completed span of execution on one thread.
+ *
+ * Category and name are not copied, so they need to be string literals (or live as long as the
+ * recorder).
+ */
+struct TraceEvent {
+    const char* category{nullptr};
+    const char* name{nullptr};
+    /** Start of the span, as time since the epoch of the steady clock */
+    int64_t     startNs{0};
+    int64_t     durationNs{0};
+    /** Id of the thread as assigned by the OS, e.g. to correlate with perf */
+    uint32_t    threadId{0};
+};
+
+/**
+ * @brief Collects trace events in a bounded lock-free buffer and writes them in the Chrome
+ * trace event format (JSON), which can be loaded by Perfetto (ui.perfetto.dev) or
+ * chrome://tracing.
+ *
+ * Recording an event is a single push to the buffer; events recorded while the buffer is full
+ * are dropped and counted instead of blocking the traced threads. Recording is off until
+ * start() is called.
+ */
+class TraceRecorder final {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 65536;
+
+    /**
+     * @brief Get the recorder the spans of the SDK are recorded to.
+     */
+    static TraceRecorder& getInstance();
+
+    /**
+     * @param capacity  Maximum number of events buffered until they are written.
+     */
+    explicit TraceRecorder(size_t capacity = DEFAULT_CAPACITY);
+
+    void start() noexcept { m_isRecording.store(true, std::memory_order_relaxed); }
+    void stop() noexcept { m_isRecording.store(false, std::memory_order_relaxed); }
+
+    [[nodiscard]] bool isRecording() const noexcept {
+        return m_isRecording.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Record the passed event, if recording.
+     */
+    void record(const TraceEvent& event) noexcept;
+
+    /**
+     * @brief Remove the buffered events.
+     *
+     * @return std::vector<TraceEvent>  The events in the order they completed.
+     */
+    [[nodiscard]] std::vector<TraceEvent> drain();
+
+    /**
+     * @brief Write the buffered events as JSON object in the Chrome trace event format, removing
+     * them from the buffer. The threads are named by their current OS thread names.
+     */
+    void writeChromeJson(std::ostream& stream);
+
+    /**
+     * @brief Write the buffered events to the given file, see writeChromeJson.
+     *
+     * @return true if the file was written.
+     */
+    bool writeChromeJsonFile(const std::string& path);
+
+    [[nodiscard]] uint64_t getNumDroppedEvents() const noexcept {
+        return m_numDroppedEvents.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the OS id of the calling thread; cached per thread.
+     */
+    [[nodiscard]] static uint32_t getCurrentThreadId() noexcept;
+
+    TraceRecorder(const TraceRecorder&)            = delete;
+    TraceRecorder(TraceRecorder&&)                 = delete;
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+    TraceRecorder& operator=(TraceRecorder&&)      = delete;
+    ~TraceRecorder()                               = default;
+
+private:
+    RingBuffer<TraceEvent> m_buffer;
+    std::atomic_bool       m_isRecording{false};
+    std::atomic<uint64_t>  m_numDroppedEvents{0};
+};
+
+/**
+ * @brief Records the span from its construction until its destruction to the TraceRecorder of
+ * the SDK, if the recorder is recording at construction. Use via VELOCITAS_TRACE_SPAN.
+ */
+class ScopedTraceSpan final {
+public:
+    ScopedTraceSpan(const char* category, const char* name) noexcept
+        : m_category(TraceRecorder::getInstance().isRecording() ? category : nullptr)
+        , m_name(name) {
+        if (m_category != nullptr) {
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScopedTraceSpan() {
+        if (m_category != nullptr) {
+            const auto end = std::chrono::steady_clock::now();
+            TraceRecorder::getInstance().record(
+                {m_category, m_name,
+                 std::chrono::duration_cast<std::chrono::nanoseconds>(m_start.time_since_epoch())
+                     .count(),
+                 std::chrono::duration_cast<std::chrono::nanoseconds>(end - m_start).count(),
+                 TraceRecorder::getCurrentThreadId()});
+        }
+    }
+
+    ScopedTraceSpan(const ScopedTraceSpan&)            = delete;
+    ScopedTraceSpan(ScopedTraceSpan&&)                 = delete;
+    ScopedTraceSpan& operator=(const ScopedTraceSpan&) = delete;
+    ScopedTraceSpan& operator=(ScopedTraceSpan&&)      = delete;
+
+private:
+    const char*                           m_category;
+    const char*                           m_name;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace velocitas
+
+#define VELOCITAS_TRACE_CONCAT_IMPL(lhs, rhs) lhs##rhs
+#define VELOCITAS_TRACE_CONCAT(lhs, rhs)      VELOCITAS_TRACE_CONCAT_IMPL(lhs, rhs)
+
+/**
+ * @brief Trace the rest of the enclosing scope as span with the given category and name (both
+ * string literals). Compiled in only if the CMake option SDK_TRACE_EVENTS is set (passed to the
+ * compiler as VELOCITAS_TRACE_EVENTS); otherwise it does not cost anything.
+ */
+#if VELOCITAS_TRACE_EVENTS
+#define VELOCITAS_TRACE_SPAN(category, name)                                                       \
+    const ::velocitas::ScopedTraceSpan VELOCITAS_TRACE_CONCAT(velocitasTraceSpan_, __LINE__)(      \
+        category, name)
+#else
+#define VELOCITAS_TRACE_SPAN(category, name) static_cast<void>(0)
+#endif
+
+#endif // VEHICLE_APP_SDK_TRACEEVENTS_H
@@ -75,6 +75,24 @@ public:
     static std::string join(const std::vector<std::string>& stringVector,
                             const std::string&              separator);
 
+    /**
+     * @brief Split the passed string at each occurrence of the passed separator; the reverse of
+     * join. Surrounding whitespace is trimmed from the parts, empty parts are skipped.
+     *
+     * Examples:
+     *
+     * str                | separator  | result
+     * -------------------|------------|-------------------------
+     * ""                 | don't care | []
+     * "hello"            | ','        | ["hello"]
+     * "hello, world,,eh" | ','        | ["hello", "world", "eh"]
+     *
+     * @param str string to be split
+     * @param separator character separating the parts
+     * @return std::vector<std::string> containing the parts
+     */
+    static std::vector<std::string> split(const std::string& str, char separator);
+
 private:
     StringUtils() = delete;
 };
@@ -119,6 +137,12 @@ public:
      */
     [[nodiscard]] std::string getNetLocation() const { return m_netLocation; }
 
+    /**
+     * @brief Check whether the URL addresses a Unix domain socket ("unix:" or "unix-abstract:"
+     * scheme); the network location is the complete URL then.
+     */
+    [[nodiscard]] bool isUnixDomainSocket() const;
+
 private:
     std::string m_scheme;
     std::string m_netLocation;
@@ -19,18 +19,70 @@
 
 #include "sdk/AsyncResult.h"
 #include "sdk/DataPointReply.h"
+#include "sdk/JobFunction.h"
 
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 namespace velocitas {
 
 class DataPoint;
+class EventLoop;
+class IExecutor;
 class IPubSubClient;
 class IVehicleDataBrokerClient;
+class MetricsExporter;
+class Query;
+class SignalTable;
+enum class SubscriptionMode;
+struct SubscriptionOptions;
+
+/**
+ * @brief Durations of the phases of the startup of an app, see VehicleApp::run. Connecting the
+ * pub/sub client and preparing the databroker client run concurrently.
+ */
+struct StartupMetrics {
+    /** Starting the middleware and waiting for it to be ready */
+    std::chrono::nanoseconds middleware{0};
+    /** Connecting the pub/sub client */
+    std::chrono::nanoseconds pubSubConnect{0};
+    /** Connecting to the databroker and resolving the metadata of the declared signals; zero if
+     * no signals were declared, as the startup does not wait for it then */
+    std::chrono::nanoseconds vdbPrepare{0};
+    std::chrono::nanoseconds onStart{0};
+    /** From the start of run until onStart returned */
+    std::chrono::nanoseconds total{0};
+};
+
+/**
+ * @brief How a vehicle app executes its callbacks, see VehicleApp::setExecutionMode.
+ */
+enum class AppExecutionMode {
+    THREADED,  // As configured at the clients, by default on the SDK's thread pools; state shared
+               // by callbacks needs to be synchronized by the app
+    EVENT_LOOP // run() drives an event loop on its thread, which executes onStart, the callbacks of
+               // all results and subscriptions of the app's clients and the functions posted via
+               // VehicleApp::post, so the app needs no synchronization
+};
+
+/**
+ * @brief Outcome of stopping an app, see VehicleApp::stop.
+ */
+struct ShutdownReport {
+    /** Number of asynchronous publishes which did not complete before the deadline */
+    size_t numDroppedPublishes{0};
+    /** Number of databroker requests which got cancelled while awaiting their response */
+    size_t numCancelledRequests{0};
+    /** True if the thread pools finished their in-flight jobs before the deadline */
+    bool isDrained{false};
+    /** From the start of stop until it returned */
+    std::chrono::nanoseconds duration{0};
+};
 
 /**
  * @brief Base class for all vehicle apps which manages an app's lifecycle.
@@ -53,15 +105,41 @@ public:
     /**
      * @brief Runs the Vehicle App.
      *
+     * @details Starts the middleware, then connects the pub/sub client while the databroker client
+     * connects and resolves the metadata of the declared signals (see declareSignals) in the
+     * background, and calls onStart once both are done. If the databroker client connects at its
+     * creation (see IVehicleDataBrokerClient::whenReady), onStart is also called only once it is
+     * connected. The duration of each phase is logged and available via getStartupMetrics. In
+     * EVENT_LOOP mode the calling thread drives the event loop afterwards, until the app is
+     * stopped. If the environment variable SDV_METRICS_FILE is set, the SDK metrics are exported
+     * to it until the app is stopped, see MetricsExporter.
      */
     void run();
 
+    /** Time stop() without arguments grants the shutdown */
+    static constexpr std::chrono::milliseconds DEFAULT_STOP_TIMEOUT{5000};
+
     /**
-     * @brief Stops the Vehicle App
+     * @brief Stops the Vehicle App within DEFAULT_STOP_TIMEOUT, see stop(timeout).
      *
      */
     void stop();
 
+    /**
+     * @brief Stops the Vehicle App within a bounded time.
+     *
+     * @details Calls onStop, cancels the databroker requests still awaiting their response and
+     * waits for the thread pools to finish their in-flight jobs (e.g. the callbacks of the
+     * cancelled requests). Then the publishes, including those of the drained jobs, get the chance
+     * to complete before disconnecting the pub/sub client. Each step only gets the time remaining
+     * until the deadline; what did not complete in time is dropped and reported. The pools
+     * themselves keep running, as they are shared by the process (see ThreadPool::shutdown).
+     *
+     * @param timeout  Maximum time for stopping, not including the time taken by onStop.
+     * @return ShutdownReport  What got dropped.
+     */
+    ShutdownReport stop(std::chrono::milliseconds timeout);
+
     /**
      * @brief Event which is called once the Vehicle App is started.
      *
@@ -74,12 +152,62 @@ public:
      */
     virtual void onStop() {}
 
+    /**
+     * @brief Get the durations of the startup phases, once onStart returned.
+     */
+    [[nodiscard]] StartupMetrics getStartupMetrics() const;
+
+    /**
+     * @brief Select how the app's callbacks are executed. Needs to be called before run, e.g.
+     * in the constructor of the app, and replaces the callback executors of the app's clients.
+     *
+     * @param mode  The execution mode; THREADED by default.
+     */
+    void setExecutionMode(AppExecutionMode mode);
+
+    [[nodiscard]] AppExecutionMode getExecutionMode() const;
+
+    /**
+     * @brief Get the event loop driven by run() in EVENT_LOOP mode, nullptr otherwise.
+     */
+    [[nodiscard]] const std::shared_ptr<EventLoop>& getEventLoop() const { return m_eventLoop; }
+
+    /**
+     * @brief Run the app on the given executor, e.g. one wrapping the io_context or reactor of
+     * another framework: it executes the callbacks of the results and subscriptions of the app's
+     * clients, their internal work (see IVehicleDataBrokerClient::setExecutor and
+     * IPubSubClient::setExecutor) and the functions posted via post. Needs to be called before
+     * run, and replaces the callback executors of the app's clients.
+     *
+     * @param executor  The executor to use; nullptr to execute as selected by the execution mode.
+     */
+    void setExecutor(std::shared_ptr<IExecutor> executor);
+
+    [[nodiscard]] const std::shared_ptr<IExecutor>& getExecutor() const { return m_executor; }
+
     VehicleApp(const VehicleApp&)            = delete;
     VehicleApp(VehicleApp&&)                 = delete;
     VehicleApp& operator=(const VehicleApp&) = delete;
     VehicleApp& operator=(VehicleApp&&)      = delete;
 
 protected:
+    /**
+     * @brief Declare the signals the app is going to use, e.g. in the constructor of the app.
+     * Their metadata is resolved during startup, concurrently to connecting the pub/sub client, so
+     * subscriptions and requests issued in onStart are sent to the databroker right away.
+     *
+     * @param dataPoints  The signals to prepare.
+     */
+    void declareSignals(const std::vector<std::reference_wrapper<DataPoint>>& dataPoints);
+
+    /**
+     * @brief Declare all signals of the signal table of a generated model, see above. Their
+     * numeric ids are resolved once at startup, so later requests of the model address them by id.
+     *
+     * @param signalTable  The signal table of the model.
+     */
+    void declareSignals(const SignalTable& signalTable);
+
     /**
      * @brief Subscribes to the given PubSub topic.
      *
@@ -157,6 +285,56 @@ protected:
      */
     AsyncSubscriptionPtr_t<DataPointReply> subscribeDataPoints(const std::string& queryString);
 
+    /**
+     * @brief Subscribes to the query for data points, using the given subscription mode.
+     *
+     * @param queryString   The query to subscribe to.
+     * @param mode          The content of the replies to deliver.
+     * @return The subscription to the data points.
+     */
+    AsyncSubscriptionPtr_t<DataPointReply> subscribeDataPoints(const std::string& queryString,
+                                                               SubscriptionMode   mode);
+
+    /**
+     * @brief Subscribes to the query for data points, using the given subscription options,
+     *        e.g. to limit the rate of updates delivered per signal.
+     *
+     * @param queryString   The query to subscribe to.
+     * @param options       The content of the replies and the limits of the updates to deliver.
+     * @return The subscription to the data points.
+     */
+    AsyncSubscriptionPtr_t<DataPointReply>
+    subscribeDataPoints(const std::string& queryString, const SubscriptionOptions& options);
+
+    /**
+     * @brief Subscribes to the structured query for data points, see QueryBuilder::buildQuery.
+     *
+     * @param query   The query to subscribe to.
+     * @return The subscription to the data points.
+     */
+    AsyncSubscriptionPtr_t<DataPointReply> subscribeDataPoints(const Query& query);
+
+    /**
+     * @brief Subscribes to the structured query for data points, using the given subscription
+     *        options.
+     *
+     * @param query     The query to subscribe to.
+     * @param options   The content of the replies and the limits of the updates to deliver.
+     * @return The subscription to the data points.
+     */
+    AsyncSubscriptionPtr_t<DataPointReply> subscribeDataPoints(const Query&               query,
+                                                               const SubscriptionOptions& options);
+
+    /**
+     * @brief Execute the given function asynchronously: by the executor of the app if one is
+     * set, otherwise in EVENT_LOOP mode by the event loop, in THREADED mode by the default thread
+     * pool.
+     *
+     * @param fun    The function to execute.
+     * @param delay  Delay before the function is executed.
+     */
+    void post(JobFunction fun, std::chrono::milliseconds delay = std::chrono::milliseconds::zero());
+
     /**
      * @brief Get the Vehicle Data Broker Client object.
      *
@@ -177,6 +355,11 @@ private:
 
     std::shared_ptr<IVehicleDataBrokerClient> m_vdbClient;
     std::shared_ptr<IPubSubClient>            m_pubSubClient;
+    std::shared_ptr<EventLoop>                m_eventLoop;
+    std::shared_ptr<IExecutor>                m_executor;
+    std::shared_ptr<MetricsExporter>          m_metricsExporter;
+    std::vector<std::string>                  m_declaredSignals;
+    StartupMetrics                            m_startupMetrics;
     bool                                      m_isRunning{false};
     std::mutex                                m_stopWaitMutex;
     std::condition_variable                   m_stopWaitCV;
@@ -20,6 +20,8 @@
 #include "sdk/AsyncResult.h"
 #include "sdk/DataPoint.h"
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
 
 namespace velocitas {
@@ -48,20 +50,55 @@ public:
      *
      * @param vdbc Pointer to the VehicleDataBrokerClient
      */
-    void setVdbc(std::shared_ptr<IVehicleDataBrokerClient> vdbc) { m_vdbc = vdbc; }
+    void setVdbc(std::shared_ptr<IVehicleDataBrokerClient> vdbc);
 
     /**
      * @brief Get the VehicleDataBrokerClient implementation.
      *
      * @return std::shared_ptr<IVehicleDataBrokerClient>  Pointer to the VehicleDataBrokerClient
-     * implementation.
+     * implementation; if a batching window is set, this merges the get/set calls of the window.
      */
     std::shared_ptr<IVehicleDataBrokerClient> getVdbc() { return m_vdbc; }
 
+    /**
+     * @brief Set the window within which the get and set calls of the model (e.g. of
+     * TypedDataPoint::get() and set()) are merged into a single call to the databroker. Zero
+     * (the default, unless specified via env var SDV_MODEL_BATCHING_WINDOW_MS) disables the
+     * batching.
+     *
+     * @param batchingWindow Time to collect calls for before issuing them.
+     */
+    void setBatchingWindow(std::chrono::milliseconds batchingWindow);
+
+    /**
+     * @brief Set the number of signals after which a batch is issued before the end of the
+     * batching window. Zero (the default, unless specified via env var
+     * SDV_MODEL_BATCHING_MAX_SIZE) means no limit.
+     *
+     * @param maxBatchSize Maximum number of signals per batch.
+     */
+    void setMaxBatchSize(size_t maxBatchSize);
+
+    /**
+     * @brief Enable coalescing of the set calls within a batching window: only the latest value
+     * of a signal is written, the calls setting superseded values get the outcome of that final
+     * write. Disabled by default, unless enabled via env var SDV_MODEL_WRITE_COALESCING.
+     * Without a batching window there is nothing to coalesce.
+     *
+     * @param isEnabled Whether to coalesce the writes.
+     */
+    void setWriteCoalescing(bool isEnabled);
+
 private:
-    VehicleModelContext() = default;
+    VehicleModelContext();
+
+    void updateVdbc();
 
+    std::shared_ptr<IVehicleDataBrokerClient> m_unbatchedVdbc;
     std::shared_ptr<IVehicleDataBrokerClient> m_vdbc;
+    std::chrono::milliseconds                 m_batchingWindow{0};
+    size_t                                    m_maxBatchSize{0};
+    bool                                      m_isCoalescingWrites{false};
 };
 
 } // namespace velocitas
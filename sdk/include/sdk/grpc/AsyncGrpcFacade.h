@@ -19,23 +19,86 @@
 
 #include <grpcpp/client_context.h>
 
+#include <chrono>
 #include <functional>
+#include <memory>
+#include <optional>
+
+namespace google::protobuf {
+class MessageLite;
+} // namespace google::protobuf
 
 namespace velocitas {
 
+class CompressionPolicy;
 class GrpcCall;
 
 class AsyncGrpcFacade {
 public:
     using ContextModifierFunction = std::function<void(grpc::ClientContext&)>;
+    using Timeout_t               = std::optional<std::chrono::milliseconds>;
+    /** Decides per written request of a stream whether to compress it */
+    using CompressionFilter_t = std::function<bool(const google::protobuf::MessageLite&)>;
+
+    /** Default timeout of calls expecting a single response, unless set via env var */
+    static constexpr std::chrono::milliseconds DEFAULT_CALL_TIMEOUT{30000};
+
+    AsyncGrpcFacade();
 
     void setContextModifier(ContextModifierFunction function);
 
+    /**
+     * @brief Set the default timeout of calls expecting a single response, after which they are
+     * failed with status DEADLINE_EXCEEDED. Zero disables the deadline. Streaming calls have no
+     * deadline.
+     *
+     * @param timeout  The default timeout (initially DEFAULT_CALL_TIMEOUT, unless specified via
+     *                 env var SDV_GRPC_CALL_TIMEOUT_MS).
+     */
+    void setCallTimeout(std::chrono::milliseconds timeout);
+
+    [[nodiscard]] std::chrono::milliseconds getCallTimeout() const { return m_callTimeout; }
+
+    /**
+     * @brief Set the policy deciding per call, or per written request of streams, whether to
+     * compress the requests.
+     *
+     * @param policy  The policy (initially configured via env vars SDV_GRPC_COMPRESSION_MIN_SIZE
+     *                and SDV_GRPC_COMPRESSION_ALGORITHM).
+     */
+    void setCompressionPolicy(std::shared_ptr<CompressionPolicy> policy);
+
+    [[nodiscard]] const std::shared_ptr<CompressionPolicy>& getCompressionPolicy() const {
+        return m_compressionPolicy;
+    }
+
 protected:
     void applyContextModifier(GrpcCall& call); // NOLINT
 
+    /**
+     * @brief Set the deadline of a call expecting a single response.
+     *
+     * @param call     The call to set the deadline of.
+     * @param timeout  The timeout of this call; if not set, the default call timeout is used.
+     */
+    void applyDeadline(GrpcCall& call, Timeout_t timeout) const;
+
+    /**
+     * @brief Compress the request of a call sending a single one if the policy decides so.
+     */
+    void applyCompression(GrpcCall& call, const google::protobuf::MessageLite& request) const;
+
+    /**
+     * @brief Enable compression of a call streaming requests if the policy compresses any.
+     *
+     * @return The filter deciding per written request whether to compress it; empty if none is.
+     */
+    [[nodiscard]] CompressionFilter_t applyStreamCompression(GrpcCall& call) const;
+
 private:
-    ContextModifierFunction m_contextModifierFunction;
+    ContextModifierFunction            m_contextModifierFunction;
+    std::chrono::milliseconds          m_callTimeout;
+    std::shared_ptr<CompressionPolicy> m_compressionPolicy;
 };
 
 } // namespace velocitas
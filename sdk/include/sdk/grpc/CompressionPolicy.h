@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#ifndef VEHICLE_APP_SDK_COMPRESSIONPOLICY_H
+#define VEHICLE_APP_SDK_COMPRESSIONPOLICY_H
+
+#include <grpc/compression.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace google::protobuf {
+class MessageLite;
+} // namespace google::protobuf
+
+namespace velocitas {
+
+struct CompressionPolicyConfig {
+    /** Requests of at least this serialized size (in bytes) are compressed; zero disables it */
+    size_t m_minMessageSize{0};
+    /** Algorithm compressed requests are sent with */
+    grpc_compression_algorithm m_algorithm{GRPC_COMPRESS_GZIP};
+    /** Every n-th request eligible for compression is sampled to measure ratio and CPU time */
+    size_t m_sampleInterval{DEFAULT_SAMPLE_INTERVAL};
+    /** Requests of an RPC type are sent uncompressed while their sampled ratio exceeds this */
+    double m_maxRatio{DEFAULT_MAX_RATIO};
+
+    static constexpr size_t DEFAULT_SAMPLE_INTERVAL = 16;
+    static constexpr double DEFAULT_MAX_RATIO       = 0.8;
+
+    /**
+     * @brief Read the configuration from env vars SDV_GRPC_COMPRESSION_MIN_SIZE and
+     * SDV_GRPC_COMPRESSION_ALGORITHM ("gzip" or "deflate").
+     */
+    static CompressionPolicyConfig fromEnvironment();
+};
+
+/**
+ * @brief Statistics of the requests of one RPC type passed to a compression policy.
+ */
+struct CompressionStats {
+    uint64_t                 m_numCompressed{0};
+    uint64_t                 m_numUncompressed{0};
+    uint64_t                 m_numSampled{0};
+    uint64_t                 m_sampledBytes{0};
+    uint64_t                 m_sampledCompressedBytes{0};
+    std::chrono::nanoseconds m_sampledCpuTime{0};
+
+    /**
+     * @brief Get the ratio of compressed to uncompressed size over all sampled requests, 1 if none
+     * was sampled.
+     */
+    [[nodiscard]] double getRatio() const {
+        return m_sampledBytes == 0 ? 1.0
+                                   : static_cast<double>(m_sampledCompressedBytes) /
+                                         static_cast<double>(m_sampledBytes);
+    }
+};
+
+/**
+ * @brief Decides per request whether gRPC shall compress it, so large requests (e.g. reads or
+ * writes of many or of string and array signals) get compressed while small scalar ones are not
+ * burdened with the CPU cost.
+ *
+ * Requests smaller than the minimum size are never compressed. Every n-th eligible request of an
+ * RPC type is compressed once more by the policy to sample the achieved ratio and the CPU time it
+ * took; while the moving average of the ratio of an RPC type exceeds the maximum, its requests are
+ * sent uncompressed as compressing them is not worth it. Statistics are exposed per RPC type and as
+ * metrics labelled by the RPC type.
+ */
+class CompressionPolicy {
+public:
+    explicit CompressionPolicy(CompressionPolicyConfig config);
+    ~CompressionPolicy();
+
+    /**
+     * @brief Get whether the policy compresses any requests at all.
+     */
+    [[nodiscard]] bool isEnabled() const { return m_config.m_minMessageSize > 0; }
+
+    /**
+     * @brief Decide whether to compress the passed request; sampling it if it is its turn.
+     *
+     * @param request  The request; its type name identifies the RPC type.
+     * @return true    if the request shall be compressed with the configured algorithm.
+     */
+    bool shallCompress(const google::protobuf::MessageLite& request);
+
+    /**
+     * @brief Get the statistics of the passed RPC type, i.e. the full name of its request type.
+     */
+    [[nodiscard]] CompressionStats getStats(const std::string& rpcType) const;
+
+    [[nodiscard]] const CompressionPolicyConfig& getConfig() const { return m_config; }
+
+    CompressionPolicy(const CompressionPolicy&)            = delete;
+    CompressionPolicy(CompressionPolicy&&)                 = delete;
+    CompressionPolicy& operator=(const CompressionPolicy&) = delete;
+    CompressionPolicy& operator=(CompressionPolicy&&)      = delete;
+
+private:
+    struct RpcState;
+
+    RpcState& getState(const std::string& rpcType);
+    void      sample(RpcState& state, const google::protobuf::MessageLite& request);
+
+    const CompressionPolicyConfig                    m_config;
+    mutable std::mutex                               m_mutex;
+    std::map<std::string, std::unique_ptr<RpcState>> m_states;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_COMPRESSIONPOLICY_H
@@ -17,23 +17,232 @@
 #ifndef VEHICLE_APP_SDK_GRPCCALL_H
 #define VEHICLE_APP_SDK_GRPCCALL_H
 
+#include "sdk/AsyncResult.h"
 #include "sdk/Logger.h"
+#include "sdk/Metrics.h"
+#include "sdk/TraceEvents.h"
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <deque>
 #include <fmt/core.h>
 #include <functional>
+#include <google/protobuf/arena.h>
 #include <grpcpp/client_context.h>
 #include <grpcpp/impl/codegen/client_callback.h>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <utility>
 
 namespace velocitas {
 
+class ActiveCallRegistry;
+class GrpcCall;
+
+/**
+ * @brief Completion state of a GrpcCall. Setting it releases the call from the GrpcClient
+ * keeping it alive, so the call may get destroyed by the assignment. Until then the flag keeps
+ * the client's registry of calls alive, as gRPC requires a call to outlive its completion even
+ * if the client is destroyed before.
+ */
+class CompletionFlag {
+public:
+    CompletionFlag()  = default;
+    ~CompletionFlag() = default;
+
+    CompletionFlag(const CompletionFlag&)            = delete;
+    CompletionFlag(CompletionFlag&&)                 = delete;
+    CompletionFlag& operator=(const CompletionFlag&) = delete;
+    CompletionFlag& operator=(CompletionFlag&&)      = delete;
+
+    CompletionFlag& operator=(bool isComplete);
+
+    operator bool() const { return m_isComplete.load(); } // NOLINT(google-explicit-constructor)
+
+private:
+    friend class GrpcClient;
+
+    std::atomic_bool                    m_isComplete{false};
+    std::mutex                          m_mutex;
+    std::shared_ptr<ActiveCallRegistry> m_registry;
+    const GrpcCall*                     m_call{nullptr};
+};
+
+/**
+ * @brief Metrics of the calls of a single RPC type, registered in the MetricsRegistry with the
+ * type as label "rpc": the completed calls per status code (sdv_grpc_calls_total), their
+ * duration (sdv_grpc_call_duration_nanoseconds) and the open streams (sdv_grpc_active_streams).
+ */
+class RpcMetrics final {
+public:
+    /**
+     * @brief Get the metrics of the given RPC type, registering them on first access. Lookups
+     * take a lock, so callers keep the reference, see getRpcMetricsOf.
+     */
+    static RpcMetrics& get(std::string_view rpcType);
+
+    explicit RpcMetrics(std::string_view rpcType);
+
+    void recordCompletion(const grpc::Status& status, std::chrono::nanoseconds duration);
+
+    void onStreamStarted() noexcept { m_activeStreams.add(1); }
+    void onStreamDone() noexcept { m_activeStreams.add(-1); }
+
+    RpcMetrics(const RpcMetrics&)            = delete;
+    RpcMetrics(RpcMetrics&&)                 = delete;
+    RpcMetrics& operator=(const RpcMetrics&) = delete;
+    RpcMetrics& operator=(RpcMetrics&&)      = delete;
+
+private:
+    static constexpr size_t NUM_STATUS_CODES = grpc::StatusCode::UNAUTHENTICATED + 1;
+
+    std::string m_rpcType;
+    Histogram&  m_duration;
+    Gauge&      m_activeStreams;
+    // registered on the first completion with the respective code, to not report empty series
+    std::array<std::atomic<Counter*>, NUM_STATUS_CODES> m_calls{};
+};
+
 /**
  * @brief Base class for implementing GRPC calls.
  *
  */
 class GrpcCall {
 public:
+    GrpcCall() = default;
+
+    /**
+     * @param rpcType  Type of the call as reported for diagnostics; needs to outlive the call.
+     * @param metrics  Metrics to report the completion of the call to, if any.
+     */
+    explicit GrpcCall(std::string_view rpcType, RpcMetrics* metrics = nullptr)
+        : m_rpcType(rpcType)
+        , m_metrics(metrics)
+        , m_startTime(metrics != nullptr ? std::chrono::steady_clock::now()
+                                         : std::chrono::steady_clock::time_point{}) {}
+
+    [[nodiscard]] std::string_view getRpcType() const { return m_rpcType; }
+
+    /**
+     * @brief Report the final status of the call to its metrics, along with the time elapsed
+     * since the call was created. To be called once, when the call completes.
+     */
+    void recordCompletion(const grpc::Status& status) {
+        if (m_metrics != nullptr) {
+            m_metrics->recordCompletion(status, std::chrono::steady_clock::now() - m_startTime);
+        }
+    }
+
     grpc::ClientContext m_context;
-    bool                m_isComplete{false};
+    CompletionFlag      m_isComplete;
+
+protected:
+    [[nodiscard]] RpcMetrics* getMetrics() const { return m_metrics; }
+
+private:
+    std::string_view                      m_rpcType;
+    RpcMetrics*                           m_metrics{nullptr};
+    std::chrono::steady_clock::time_point m_startTime;
+};
+
+/**
+ * @brief Get the RPC type of calls sending requests of the passed type, i.e. the full name of the
+ * request message.
+ */
+template <class TRequestType> std::string_view getRpcTypeOf() {
+    return TRequestType::descriptor()->full_name();
+}
+
+/**
+ * @brief Get the metrics of calls sending requests of the passed type; looked up only once.
+ */
+template <class TRequestType> RpcMetrics* getRpcMetricsOf() {
+    static auto& metrics = RpcMetrics::get(getRpcTypeOf<TRequestType>());
+    return &metrics;
+}
+
+/**
+ * @brief Cancel the call (i.e. its context) once the passed result gets cancelled.
+ *
+ * @param result  The result provided by the call.
+ * @param call    The call to cancel.
+ */
+template <typename TResultType>
+void bindCancellation(AsyncResult<TResultType>& result, const std::shared_ptr<GrpcCall>& call) {
+    result.setCancellationHandler([weakCall = std::weak_ptr<GrpcCall>(call)]() {
+        if (auto callPtr = weakCall.lock()) {
+            callPtr->m_context.TryCancel();
+        }
+    });
+}
+
+/**
+ * @brief Cancel the streaming call (i.e. its context) once the passed subscription gets
+ * cancelled.
+ *
+ * @param subscription  The subscription fed by the call.
+ * @param call          The call to cancel.
+ */
+template <typename TResultType>
+void bindCancellation(AsyncSubscription<TResultType>& subscription,
+                      const std::shared_ptr<GrpcCall>& call) {
+    subscription.setCancellationHandler([weakCall = std::weak_ptr<GrpcCall>(call)]() {
+        if (auto callPtr = weakCall.lock()) {
+            callPtr->m_context.TryCancel();
+        }
+    });
+}
+
+/**
+ * @brief A protobuf message living on an arena of its own: parsing it allocates by bumping a
+ * pointer instead of one heap allocation per string or element, and all of its memory is freed
+ * at once. renew() replaces the message by an empty one while keeping the arena's initial block,
+ * so messages parsed one after the other (i.e. the responses of a stream) reuse that memory.
+ *
+ * @tparam TMessage  The data type of the message.
+ */
+template <class TMessage> class ArenaMessage {
+public:
+    static constexpr size_t INITIAL_BLOCK_SIZE = 4096;
+
+    ArenaMessage()
+        : m_initialBlock(new char[INITIAL_BLOCK_SIZE])
+        , m_arena(createArenaOptions(m_initialBlock.get()))
+        , m_message(google::protobuf::Arena::CreateMessage<TMessage>(&m_arena)) {}
+
+    ~ArenaMessage() = default;
+
+    ArenaMessage(const ArenaMessage&)            = delete;
+    ArenaMessage(ArenaMessage&&)                 = delete;
+    ArenaMessage& operator=(const ArenaMessage&) = delete;
+    ArenaMessage& operator=(ArenaMessage&&)      = delete;
+
+    TMessage& get() { return *m_message; }
+
+    /**
+     * @brief Discard the message, including all references to its contents, and provide an
+     * empty one.
+     */
+    TMessage& renew() {
+        m_arena.Reset();
+        m_message = google::protobuf::Arena::CreateMessage<TMessage>(&m_arena);
+        return *m_message;
+    }
+
+private:
+    static google::protobuf::ArenaOptions createArenaOptions(char* initialBlock) {
+        google::protobuf::ArenaOptions options;
+        options.initial_block      = initialBlock;
+        options.initial_block_size = INITIAL_BLOCK_SIZE;
+        return options;
+    }
+
+    std::unique_ptr<char[]> m_initialBlock;
+    google::protobuf::Arena m_arena;
+    TMessage*               m_message;
 };
 
 /**
@@ -44,11 +253,18 @@ public:
  */
 template <class TRequestType, class TResponseType> class GrpcSingleResponseCall : public GrpcCall {
 public:
-    GrpcSingleResponseCall() = default;
+    GrpcSingleResponseCall()
+        : GrpcCall(getRpcTypeOf<TRequestType>(), getRpcMetricsOf<TRequestType>()) {}
     explicit GrpcSingleResponseCall(TRequestType request)
-        : m_request(std::move(request)) {}
-    TRequestType  m_request;
-    TResponseType m_response;
+        : GrpcCall(getRpcTypeOf<TRequestType>(), getRpcMetricsOf<TRequestType>())
+        , m_request(std::move(request)) {}
+    TRequestType m_request;
+
+private:
+    ArenaMessage<TResponseType> m_arenaResponse;
+
+public:
+    TResponseType& m_response{m_arenaResponse.get()};
 };
 
 /**
@@ -60,17 +276,25 @@ public:
 template <class TRequestType, class TResponseType>
 class GrpcStreamingResponseCall : public GrpcCall, private grpc::ClientReadReactor<TResponseType> {
 public:
-    GrpcStreamingResponseCall() = default;
+    GrpcStreamingResponseCall()
+        : GrpcCall(getRpcTypeOf<TRequestType>(), getRpcMetricsOf<TRequestType>()) {}
     explicit GrpcStreamingResponseCall(TRequestType request)
-        : m_request(std::move(request)) {}
+        : GrpcCall(getRpcTypeOf<TRequestType>(), getRpcMetricsOf<TRequestType>())
+        , m_request(std::move(request)) {}
 
     GrpcStreamingResponseCall& startCall() {
-        this->StartRead(&m_response);
+        getMetrics()->onStreamStarted();
+        this->StartRead(&m_response.get());
         this->StartCall();
         return *this;
     }
 
-    GrpcStreamingResponseCall& onData(std::function<void(const TResponseType&)> handler) {
+    /**
+     * @brief Set the handler of the received responses. The handler may take over (i.e. move
+     * from) parts of the response. It must not keep references to the response, whose memory is
+     * reused for parsing the next one.
+     */
+    GrpcStreamingResponseCall& onData(std::function<void(TResponseType&)> handler) {
         m_onResponseHandler = handler;
         return *this;
     }
@@ -86,27 +310,224 @@ public:
 
 private:
     void OnReadDone(bool isOk) override {
+        VELOCITAS_TRACE_SPAN("grpc", "GrpcCall::OnReadDone");
         if (isOk) {
             try {
-                m_onResponseHandler(m_response);
+                m_onResponseHandler(m_response.get());
             } catch (const std::exception& e) {
                 velocitas::logger().error(
                     "GrpcCall: Exception occurred during response handler notification: {}",
                     e.what());
             }
-            this->StartRead(&m_response);
+            this->StartRead(&m_response.renew());
         }
     }
 
     void OnDone(const grpc::Status& status) override {
-        m_onFinishHandler(status);
+        getMetrics()->onStreamDone();
+        recordCompletion(status);
+        // the handlers are released once done, as they may keep the call or its consumer alive
+        auto onFinishHandler = std::exchange(m_onFinishHandler, nullptr);
+        onFinishHandler(status);
+        m_onResponseHandler = nullptr;
+        // may destroy the call, so it must not be accessed anymore
         m_isComplete = true;
     }
 
-    TRequestType                              m_request;
-    TResponseType                             m_response;
-    std::function<void(const TResponseType&)> m_onResponseHandler;
-    std::function<void(const grpc::Status&)>  m_onFinishHandler;
+    TRequestType                             m_request;
+    ArenaMessage<TResponseType>              m_response;
+    std::function<void(TResponseType&)>      m_onResponseHandler;
+    std::function<void(const grpc::Status&)> m_onFinishHandler;
+};
+
+/**
+ * @brief A GRPC call accepting multiple streamed requests.
+ *
+ * @tparam TRequestType   The data type of a single request.
+ */
+template <class TRequestType> class GrpcStreamingRequestCall : public GrpcCall {
+public:
+    GrpcStreamingRequestCall()
+        : GrpcCall(getRpcTypeOf<TRequestType>(), getRpcMetricsOf<TRequestType>()) {}
+    virtual ~GrpcStreamingRequestCall() = default;
+
+    GrpcStreamingRequestCall(const GrpcStreamingRequestCall&)            = delete;
+    GrpcStreamingRequestCall(GrpcStreamingRequestCall&&)                 = delete;
+    GrpcStreamingRequestCall& operator=(const GrpcStreamingRequestCall&) = delete;
+    GrpcStreamingRequestCall& operator=(GrpcStreamingRequestCall&&)      = delete;
+
+    /**
+     * @brief Queue the request for being written to the stream. Requests are written one after
+     * the other in the order of this call; writes requested after a failed write are dropped.
+     */
+    virtual void write(TRequestType request) = 0;
+};
+
+/**
+ * @brief A GRPC call where streamed requests and streamed responses are exchanged.
+ *
+ * @tparam TRequestType   The data type of a single request.
+ * @tparam TResponseType  The data type of a single response.
+ */
+template <class TRequestType, class TResponseType>
+class GrpcBidiStreamingCall : public GrpcStreamingRequestCall<TRequestType>,
+                              private grpc::ClientBidiReactor<TRequestType, TResponseType> {
+public:
+    GrpcBidiStreamingCall& startCall() {
+        this->getMetrics()->onStreamStarted();
+        this->StartRead(&m_response.get());
+        // Writes are started by application threads, i.e. outside of any reaction, which grpc
+        // only allows while the reactor is held. The hold is released once no further write can
+        // be started: when the read side finished (incl. cancellation) or a write failed.
+        this->AddHold();
+        this->StartCall();
+        return *this;
+    }
+
+    /**
+     * @brief Set the handler of the received responses. The handler may take over (i.e. move
+     * from) parts of the response. It must not keep references to the response, whose memory is
+     * reused for parsing the next one.
+     */
+    GrpcBidiStreamingCall& onData(std::function<void(TResponseType&)> handler) {
+        m_onResponseHandler = handler;
+        return *this;
+    }
+
+    /**
+     * @brief Set the handler called for each written request, in the order of the writes. It is
+     * passed whether the request was written to the stream successfully.
+     */
+    GrpcBidiStreamingCall& onWriteDone(std::function<void(bool)> handler) {
+        m_onWriteDoneHandler = handler;
+        return *this;
+    }
+
+    GrpcBidiStreamingCall& onFinish(std::function<void(const grpc::Status&)> handler) {
+        m_onFinishHandler = handler;
+        return *this;
+    }
+
+    /**
+     * @brief Set the filter deciding per written request whether to compress it with the
+     * compression algorithm of the call; without one, all requests are compressed if the call has
+     * an algorithm set. Must be set before the first write.
+     */
+    GrpcBidiStreamingCall& setCompressionFilter(std::function<bool(const TRequestType&)> filter) {
+        m_compressionFilter = filter;
+        return *this;
+    }
+
+    void write(TRequestType request) override {
+        const auto isCompressed = !m_compressionFilter || m_compressionFilter(request);
+
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        if (m_isWriteFailed || m_isHoldReleased) {
+            return;
+        }
+        m_pendingWrites.push_back({std::move(request), isCompressed});
+        if (!m_isWriting) {
+            startNextWrite();
+        }
+    }
+
+    grpc::ClientBidiReactor<TRequestType, TResponseType>& getReactor() { return *this; }
+
+private:
+    void startNextWrite() {
+        m_isWriting = !m_pendingWrites.empty();
+        if (m_isWriting) {
+            auto& pendingWrite = m_pendingWrites.front();
+            m_writtenRequest   = std::move(pendingWrite.first);
+            const auto options = pendingWrite.second ? grpc::WriteOptions()
+                                                     : grpc::WriteOptions().set_no_compression();
+            m_pendingWrites.pop_front();
+            this->StartWrite(&m_writtenRequest, options);
+        }
+    }
+
+    // needs m_writeMutex to be locked
+    void releaseHold() {
+        if (!m_isHoldReleased) {
+            m_isHoldReleased = true;
+            this->RemoveHold();
+        }
+    }
+
+    void notifyWriteDone(bool isOk) {
+        if (m_onWriteDoneHandler) {
+            try {
+                m_onWriteDoneHandler(isOk);
+            } catch (const std::exception& e) {
+                velocitas::logger().error(
+                    "GrpcCall: Exception occurred during write handler notification: {}",
+                    e.what());
+            }
+        }
+    }
+
+    void OnReadDone(bool isOk) override {
+        VELOCITAS_TRACE_SPAN("grpc", "GrpcCall::OnReadDone");
+        if (isOk) {
+            try {
+                m_onResponseHandler(m_response.get());
+            } catch (const std::exception& e) {
+                velocitas::logger().error(
+                    "GrpcCall: Exception occurred during response handler notification: {}",
+                    e.what());
+            }
+            this->StartRead(&m_response.renew());
+        } else {
+            // the stream is finished or cancelled; queued requests are still written from the
+            // write reactions, but no write is started from the outside anymore
+            std::lock_guard<std::mutex> lock(m_writeMutex);
+            releaseHold();
+        }
+    }
+
+    void OnWriteDone(bool isOk) override {
+        notifyWriteDone(isOk);
+        size_t numDroppedWrites{0};
+        {
+            std::lock_guard<std::mutex> lock(m_writeMutex);
+            if (isOk) {
+                startNextWrite();
+            } else {
+                m_isWriteFailed  = true;
+                m_isWriting      = false;
+                numDroppedWrites = m_pendingWrites.size();
+                m_pendingWrites.clear();
+                releaseHold();
+            }
+        }
+        for (size_t i = 0; i < numDroppedWrites; ++i) {
+            notifyWriteDone(false);
+        }
+    }
+
+    void OnDone(const grpc::Status& status) override {
+        this->getMetrics()->onStreamDone();
+        this->recordCompletion(status);
+        auto onFinishHandler = std::exchange(m_onFinishHandler, nullptr);
+        onFinishHandler(status);
+        m_onResponseHandler = nullptr;
+        // may destroy the call, so it must not be accessed anymore
+        this->m_isComplete = true;
+    }
+
+    ArenaMessage<TResponseType>              m_response;
+    std::function<void(TResponseType&)>      m_onResponseHandler;
+    std::function<void(bool)>                m_onWriteDoneHandler;
+    std::function<void(const grpc::Status&)> m_onFinishHandler;
+    std::function<bool(const TRequestType&)> m_compressionFilter;
+
+    std::mutex m_writeMutex;
+    // requests not written yet, each with whether to compress it
+    std::deque<std::pair<TRequestType, bool>> m_pendingWrites;
+    TRequestType                              m_writtenRequest;
+    bool                                      m_isWriting{false};
+    bool                                      m_isWriteFailed{false};
+    bool                                      m_isHoldReleased{false};
 };
 
 } // namespace velocitas
@@ -17,32 +17,56 @@
 #ifndef VEHICLE_APP_SDK_GRPCCLIENT_H
 #define VEHICLE_APP_SDK_GRPCCLIENT_H
 
+#include <map>
 #include <memory>
-#include <mutex>
-#include <vector>
+#include <string>
 
 namespace velocitas {
 
+class ActiveCallRegistry;
 class GrpcCall;
 
+/**
+ * @brief Keeps calls alive until they are complete. Completed calls release themselves (see
+ * CompletionFlag), so tracking a call costs constant time regardless of the number of calls.
+ */
 class GrpcClient {
 public:
-    GrpcClient()          = default;
-    virtual ~GrpcClient() = default;
+    GrpcClient();
+
+    /**
+     * @brief Cancels the active calls; they are kept alive until they are complete nevertheless.
+     */
+    virtual ~GrpcClient();
 
     GrpcClient(const GrpcClient&)            = delete;
     GrpcClient(GrpcClient&&)                 = delete;
     GrpcClient& operator=(const GrpcClient&) = delete;
     GrpcClient& operator=(GrpcClient&&)      = delete;
 
-    void                 addActiveCall(std::shared_ptr<GrpcCall> call);
-    [[nodiscard]] size_t getNumActiveCalls() const { return m_activeCalls.size(); }
+    /**
+     * @brief Keep the call alive until it is complete; a call being complete already is ignored.
+     */
+    void addActiveCall(std::shared_ptr<GrpcCall> call);
 
-private:
-    void pruneCompletedRequests();
+    [[nodiscard]] size_t getNumActiveCalls() const;
 
-    std::vector<std::shared_ptr<GrpcCall>> m_activeCalls;
-    std::mutex                             m_mutex;
+    /**
+     * @brief Cancel all active calls, e.g. when shutting down. The calls complete with status
+     * CANCELLED, unless they are completing already.
+     *
+     * @return size_t  The number of calls which got cancelled.
+     */
+    size_t cancelActiveCalls();
+
+    /**
+     * @brief Get the number of active calls per RPC type (see GrpcCall::getRpcType), for
+     * diagnostics.
+     */
+    [[nodiscard]] std::map<std::string, size_t> getNumActiveCallsByRpcType() const;
+
+private:
+    std::shared_ptr<ActiveCallRegistry> m_registry;
 };
 
 } // namespace velocitas
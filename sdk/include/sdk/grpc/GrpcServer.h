@@ -0,0 +1,275 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#ifndef VEHICLE_APP_SDK_GRPCSERVER_H
+#define VEHICLE_APP_SDK_GRPCSERVER_H
+
+#include "sdk/AsyncResult.h"
+#include "sdk/Logger.h"
+
+#include <grpcpp/server.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/server_callback.h>
+#include <grpcpp/support/status.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace grpc {
+class ServerBuilder;
+class Service;
+} // namespace grpc
+
+namespace velocitas {
+
+struct GrpcServerConfig {
+    /** Maximum number of threads gRPC uses to serve calls; zero keeps the gRPC default */
+    size_t m_maxThreads{0};
+    /** Request/response pairs kept for reuse by each PooledMessageAllocator */
+    size_t m_messagePoolSize{DEFAULT_MESSAGE_POOL_SIZE};
+
+    static constexpr size_t DEFAULT_MESSAGE_POOL_SIZE = 64;
+
+    /**
+     * @brief Read the configuration from env vars SDV_GRPC_SERVER_MAX_THREADS and
+     * SDV_GRPC_SERVER_MESSAGE_POOL_SIZE.
+     */
+    static GrpcServerConfig fromEnvironment();
+
+    /**
+     * @brief Apply the threading settings to the passed builder.
+     */
+    void applyTo(grpc::ServerBuilder& builder) const;
+};
+
+/**
+ * @brief Build and start a server serving the passed service, which needs to outlive the server.
+ *
+ * @param address       Address (host:port) to listen at; port 0 selects a free one.
+ * @param service       The service to serve; either synchronous or callback based.
+ * @param config        Threading settings of the server.
+ * @param selectedPort  Set to the port listened at if not nullptr.
+ * @throw std::runtime_error if the server cannot be started.
+ */
+std::unique_ptr<grpc::Server>
+startGrpcServer(const std::string& address, grpc::Service& service,
+                const GrpcServerConfig& config = GrpcServerConfig::fromEnvironment(),
+                int*                    selectedPort = nullptr);
+
+/**
+ * @brief Allocates the request and response messages of a callback based unary method from a
+ * pool instead of the heap. Released messages are cleared, which keeps the memory of their
+ * strings and repeated fields, and are reused by the next call; more than the configured number
+ * of unused messages are freed. Register it via the SetMessageAllocatorFor_<Method>() function
+ * of the generated callback service; it needs to outlive the server.
+ *
+ * @tparam TRequestType   The request message type of the method.
+ * @tparam TResponseType  The response message type of the method.
+ */
+template <class TRequestType, class TResponseType>
+class PooledMessageAllocator final : public grpc::MessageAllocator<TRequestType, TResponseType> {
+public:
+    explicit PooledMessageAllocator(size_t poolSize = GrpcServerConfig::DEFAULT_MESSAGE_POOL_SIZE)
+        : m_pool(std::make_shared<Pool>(poolSize)) {}
+
+    grpc::MessageHolder<TRequestType, TResponseType>* AllocateMessages() override {
+        {
+            std::lock_guard<std::mutex> lock(m_pool->m_mutex);
+            if (!m_pool->m_holders.empty()) {
+                auto* holder = m_pool->m_holders.back().release();
+                m_pool->m_holders.pop_back();
+                ++m_pool->m_numReused;
+                return holder;
+            }
+            ++m_pool->m_numAllocated;
+        }
+        return new Holder(m_pool);
+    }
+
+    /**
+     * @brief Get the number of message pairs allocated from the heap.
+     */
+    [[nodiscard]] uint64_t getNumAllocated() const {
+        std::lock_guard<std::mutex> lock(m_pool->m_mutex);
+        return m_pool->m_numAllocated;
+    }
+
+    /**
+     * @brief Get the number of message pairs taken from the pool.
+     */
+    [[nodiscard]] uint64_t getNumReused() const {
+        std::lock_guard<std::mutex> lock(m_pool->m_mutex);
+        return m_pool->m_numReused;
+    }
+
+private:
+    class Holder;
+
+    // referenced weakly by the holders, as calls may release their messages after the allocator
+    // is gone
+    struct Pool {
+        explicit Pool(size_t capacity)
+            : m_capacity(capacity) {}
+
+        const size_t                         m_capacity;
+        mutable std::mutex                   m_mutex;
+        std::vector<std::unique_ptr<Holder>> m_holders;
+        uint64_t                             m_numAllocated{0};
+        uint64_t                             m_numReused{0};
+    };
+
+    class Holder final : public grpc::MessageHolder<TRequestType, TResponseType> {
+    public:
+        explicit Holder(const std::shared_ptr<Pool>& pool)
+            : m_pool(pool) {
+            this->set_request(&m_request);
+            this->set_response(&m_response);
+        }
+
+        void Release() override {
+            if (auto pool = m_pool.lock()) {
+                m_request.Clear();
+                m_response.Clear();
+                std::lock_guard<std::mutex> lock(pool->m_mutex);
+                if (pool->m_holders.size() < pool->m_capacity) {
+                    pool->m_holders.emplace_back(this);
+                    return;
+                }
+            }
+            delete this;
+        }
+
+    private:
+        std::weak_ptr<Pool> m_pool;
+        TRequestType        m_request;
+        TResponseType       m_response;
+    };
+
+    std::shared_ptr<Pool> m_pool;
+};
+
+/**
+ * @brief Reactor finishing a unary call once an AsyncResult is available, so the handler
+ * returns right away instead of blocking a server thread until e.g. the databroker answered.
+ * A failed result finishes the call with UNAVAILABLE, and a call cancelled by the client
+ * (e.g. its deadline expired) cancels the result. Deletes itself once the call is done.
+ *
+ * The result is referenced weakly, so it is never released from within its own callback; its
+ * producer keeps it until it is available, as for any result consumed via callbacks.
+ *
+ * @tparam TResultType  The data type of the result.
+ */
+template <typename TResultType> class AsyncResultReactor final : public grpc::ServerUnaryReactor {
+public:
+    /** Fills the response from the result; the returned status finishes the call */
+    using ResponseWriter_t = std::function<grpc::Status(const TResultType& result)>;
+
+    explicit AsyncResultReactor(ResponseWriter_t writeResponse)
+        : m_writeResponse(std::move(writeResponse)) {}
+
+    AsyncResultReactor(const AsyncResultReactor&)            = delete;
+    AsyncResultReactor(AsyncResultReactor&&)                 = delete;
+    AsyncResultReactor& operator=(const AsyncResultReactor&) = delete;
+    AsyncResultReactor& operator=(AsyncResultReactor&&)      = delete;
+
+    ~AsyncResultReactor() override = default;
+
+    /**
+     * @brief Start waiting for the passed result; the call may be finished right away.
+     *
+     * @throw std::runtime_error if the result is awaited or has callbacks registered already.
+     */
+    void start(const AsyncResultPtr_t<TResultType>& result) {
+        m_result = result;
+        result
+            ->onResult([this](const TResultType& value) {
+                grpc::Status status;
+                try {
+                    status = m_writeResponse(value);
+                } catch (const std::exception& e) {
+                    logger().error("GrpcServer: Exception occurred while writing the response: {}",
+                                   e.what());
+                    status = grpc::Status(grpc::StatusCode::INTERNAL, e.what());
+                }
+                finish(status);
+            })
+            ->onError([this](const Status& error) {
+                if (m_isCancelled) {
+                    finish(grpc::Status::CANCELLED);
+                } else {
+                    finish(grpc::Status(grpc::StatusCode::UNAVAILABLE, error.errorMessage()));
+                }
+            });
+    }
+
+    void OnCancel() override {
+        m_isCancelled = true;
+        if (auto result = m_result.lock()) {
+            result->cancel();
+        }
+    }
+
+    void OnDone() override { delete this; }
+
+private:
+    // this may be deleted as soon as the call is finished, so it must not be accessed afterwards
+    void finish(const grpc::Status& status) {
+        if (!m_isFinished.exchange(true)) {
+            Finish(status);
+        }
+    }
+
+    std::weak_ptr<AsyncResult<TResultType>> m_result;
+    ResponseWriter_t                        m_writeResponse;
+    std::atomic_bool                        m_isCancelled{false};
+    std::atomic_bool                        m_isFinished{false};
+};
+
+/**
+ * @brief Finish a unary call of a callback based service once the passed result is available.
+ * To be returned by the method handler, e.g.
+ * @code
+ * return finishOnResult(vehicle.Speed.get(), [response](const auto& speed) {
+ *     response->set_speed(speed.value());
+ *     return grpc::Status::OK;
+ * });
+ * @endcode
+ *
+ * @param result         The result to finish the call with.
+ * @param writeResponse  Fills the response from the result, returning the status of the call.
+ * @return The reactor of the call.
+ */
+template <typename TResultType>
+grpc::ServerUnaryReactor*
+finishOnResult(const AsyncResultPtr_t<TResultType>&                       result,
+               typename AsyncResultReactor<TResultType>::ResponseWriter_t writeResponse) {
+    auto reactor = std::make_unique<AsyncResultReactor<TResultType>>(std::move(writeResponse));
+    reactor->start(result);
+    return reactor.release();
+}
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_GRPCSERVER_H
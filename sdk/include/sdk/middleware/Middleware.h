@@ -67,7 +67,8 @@ public:
     virtual void stop() {}
 
     /**
-     * @brief Get the location description (e.g. uri) of the specified service name
+     * @brief Get the location description (e.g. uri) of the specified service name. A service
+     * provided by several endpoints is described by the comma separated list of their locations.
      *
      * @param serviceName Name of the service to get the loaction description for
      * @return std::string representing the location description
@@ -18,17 +18,129 @@
 #define VEHICLE_APP_SDK_IVEHICLEDATABROKERCLIENT_H
 
 #include "sdk/AsyncResult.h"
+#include "sdk/CallbackExecutor.h"
+#include "sdk/Executor.h"
+#include "sdk/ClockOffsetEstimator.h"
 #include "sdk/DataPointReply.h"
+#include "sdk/Query.h"
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace velocitas {
 
 class DataPointReply;
 class DataPointValue;
+class IPreparedSet;
+class IVehicleDataBrokerClient;
+
+/**
+ * @brief Content of the replies delivered by a data point subscription.
+ */
+enum class SubscriptionMode {
+    FULL_STATE, // Each reply contains the latest values of all subscribed data points
+    DELTA_ONLY  // Each reply contains only the data points changed since the previous reply
+};
+
+/**
+ * @brief Options of a data point subscription. The limits are applied by the client per signal
+ *        to the updates received from the databroker, so dropped updates are neither decoded
+ *        nor dispatched. A value is compared against the last delivered value of its signal;
+ *        updates making a signal invalid or valid again are always delivered.
+ */
+struct SubscriptionOptions {
+    SubscriptionOptions() = default;
+
+    /** Options of the given mode, not limiting the updates */
+    explicit SubscriptionOptions(SubscriptionMode mode)
+        : m_mode{mode} {}
+
+    SubscriptionMode m_mode{SubscriptionMode::FULL_STATE};
+
+    /** Minimum time between two delivered values of a signal; zero disables it */
+    std::chrono::milliseconds m_minInterval{0};
+
+    /** Maximum number of delivered values of a signal per second; zero disables it */
+    double m_maxRate{0.0};
+
+    /** Numeric values not differing by more than this from the last delivered one are dropped */
+    double m_absoluteDeadband{0.0};
+
+    /** Same as m_absoluteDeadband, as a fraction of the last delivered value (0.01 = 1 %) */
+    double m_relativeDeadband{0.0};
+
+    /**
+     * Drop values equal to the last delivered one of a signal (compared exactly, also arrays and
+     * strings), e.g. ones re-sent after a resubscribe or by providers publishing periodically
+     */
+    bool m_distinctUntilChanged{false};
+
+    /** Executor of the callbacks of the subscription; nullptr to use the one of the client */
+    CallbackExecutorPtr_t m_callbackExecutor;
+
+    /**
+     * Priority class of the deliveries, e.g. HIGH for safety relevant signals. Unless
+     * m_callbackExecutor is set, a class other than NORMAL dispatches the callbacks via
+     * CallbackExecutor::getPriorityInstance instead of the executor of the client.
+     */
+    JobPriority m_priority{JobPriority::NORMAL};
+
+    /**
+     * Coalesce the updates arriving while the item callback is still busy with a previous one
+     * into a single pending update holding the latest value per signal, so slow consumers get the
+     * freshest state instead of a growing backlog. Needs callbacks run by an executor, as inline
+     * callbacks hold up the stream themselves; sets the overflow policy CONFLATE_LATEST.
+     */
+    bool m_isCoalescingDeliveries{false};
+
+    /**
+     * Trace the latencies of every n-th delivered update, see
+     * AsyncSubscription::getLatencyTracer; zero uses the interval set via the env var
+     * SDV_LATENCY_TRACING_INTERVAL (no tracing if unset). Supported by the kuksa.val.v2 client.
+     */
+    uint32_t m_latencyTracingInterval{0};
+};
+
+/**
+ * @brief Configuration of the replay of a signal recording, see
+ *        IVehicleDataBrokerClient::createReplay.
+ */
+struct ReplayConfig {
+    /** Factor the recorded timing is sped up by (2.0 = twice as fast); zero to replay the updates
+     * as fast as they are consumed */
+    double m_speed{1.0};
+
+    /** Whether to start over at the end of the recording */
+    bool m_isLooping{false};
+
+    /** Time from the first subscription to the start of the replay, so subscriptions created
+     * together (e.g. in onStart) all get the recording from its start */
+    std::chrono::milliseconds m_startDelay{100};
+};
+
+/**
+ * @brief Route of the signals of a VSS subtree to the client of the databroker holding them, see
+ *        IVehicleDataBrokerClient::createSharded.
+ */
+struct ShardRoute {
+    /** Path of the subtree, e.g. "Vehicle.Body"; empty to route all signals no other route has */
+    std::string m_subtree;
+
+    /** Client of the databroker holding the signals of the subtree */
+    std::shared_ptr<IVehicleDataBrokerClient> m_client;
+};
+
+/**
+ * @brief How values are written by a set operation.
+ */
+enum class SetMode {
+    ACTUATE, // Request the signals to be actuated, i.e. set their target values
+    PUBLISH  // Publish the values as their provider, i.e. set their current values
+};
 
 /**
  * @brief Interface for implementing VehicleDataBroker clients.
@@ -64,6 +176,22 @@ public:
     virtual AsyncResultPtr_t<SetErrorMap_t>
     setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints) = 0;
 
+    /**
+     * @brief Set datapoint values in the VDB, using the given set mode. Clients not supporting
+     *        different modes perform their regular set operation.
+     *
+     * @param datapoints The values to set.
+     * @param mode       Whether to actuate the signals or to publish their values.
+     *
+     * @return AsyncResultPtr_t<SetErrorMap_t> A map which contains [key, error] entries
+     * if a data point could not be set.
+     */
+    virtual AsyncResultPtr_t<SetErrorMap_t>
+    setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints, SetMode mode) {
+        std::ignore = mode;
+        return setDatapoints(datapoints);
+    }
+
     /**
      * @brief Subscribe to updates for the given query.
      *
@@ -73,6 +201,159 @@ public:
      */
     virtual AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string& query) = 0;
 
+    /**
+     * @brief Subscribe to updates for the given query, using the given subscription mode.
+     *        In DELTA_ONLY mode the full state is available via getSnapshot() of the returned
+     *        subscription. Clients not supporting delta updates deliver the full state.
+     *
+     * @param query The query to subscribe to.
+     * @param mode  The content of the replies to deliver.
+     *
+     * @return The subscription to the data points.
+     */
+    virtual AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string& query,
+                                                             SubscriptionMode   mode) {
+        std::ignore = mode;
+        return subscribe(query);
+    }
+
+    /**
+     * @brief Subscribe to updates for the given query, using the given subscription options.
+     *        Clients not supporting client-side filtering deliver all updates.
+     *
+     * @param query   The query to subscribe to.
+     * @param options The content of the replies and the limits of the updates to deliver.
+     *
+     * @return The subscription to the data points.
+     */
+    virtual AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string&         query,
+                                                             const SubscriptionOptions& options) {
+        return subscribe(query, options.m_mode);
+    }
+
+    /**
+     * @brief Subscribe to updates for the given structured query, see QueryBuilder::buildQuery.
+     *        Clients not supporting structured queries subscribe to its string form.
+     *
+     * @param query   The query to subscribe to.
+     * @param options The content of the replies and the limits of the updates to deliver.
+     *
+     * @return The subscription to the data points.
+     */
+    virtual AsyncSubscriptionPtr_t<DataPointReply> subscribe(const Query&               query,
+                                                             const SubscriptionOptions& options) {
+        return subscribe(query.toString(), options);
+    }
+
+    /**
+     * @brief Add signals to and remove signals from a subscription created by this client, e.g.
+     *        when the signals of interest change at runtime. Unlike subscribing anew, the kept
+     *        signals are delivered without a gap and no metadata is resolved again. Added signals
+     *        are delivered from their next update on; clients receiving them for other
+     *        subscriptions already may deliver their current values right away. Signals the WHERE
+     *        conditions of the query refer to are not removed.
+     *        Clients not supporting it leave the subscription unchanged.
+     *
+     * @param subscription    The subscription to update.
+     * @param addedSignals    Paths of the signals to add.
+     * @param removedSignals  Paths of the signals to remove.
+     *
+     * @return true if the subscription got updated, false if the client does not support it or
+     *         the subscription was not created by it or is cancelled.
+     */
+    virtual bool updateSubscription(const AsyncSubscriptionPtr_t<DataPointReply>& subscription,
+                                    const std::vector<std::string>&               addedSignals,
+                                    const std::vector<std::string>&               removedSignals) {
+        std::ignore = subscription;
+        std::ignore = addedSignals;
+        std::ignore = removedSignals;
+        return false;
+    }
+
+    /**
+     * @brief Prepare the client for accessing the passed signals, e.g. at app startup: connect to
+     *        the databroker and resolve the metadata of the signals, so later requests and
+     *        subscriptions of them need no further round trips. Clients without connection setup
+     *        or metadata complete right away.
+     *
+     * @param signalPaths  The signals to be accessed; may be empty to only connect.
+     * @param timeout      Maximum time to wait for the connection.
+     *
+     * @return The result, failing if the client did not get connected in time or the metadata of
+     * a signal could not be resolved.
+     */
+    virtual AsyncResultPtr_t<Status> prepare(const std::vector<std::string>& signalPaths,
+                                             std::chrono::milliseconds       timeout);
+
+    /**
+     * @brief Get a result completing once the connection the client started to establish at its
+     *        creation is ready, e.g. to begin an app's work with a connected client. The gRPC
+     *        clients connect all their channels at creation if env var SDV_VDB_PREWARM_TIMEOUT_MS
+     *        is set (in milliseconds); other clients and ones not prewarming complete right away.
+     *        Each call returns a new result.
+     *
+     * @return The result, failing if the connection did not get ready within the timeout.
+     */
+    virtual AsyncResultPtr_t<Status> whenReady();
+
+    /**
+     * @brief Prepare a set request of a fixed list of signals which is applied repeatedly, e.g.
+     *        by a control loop. Clients resolving signals to ids do so once here and reuse their
+     *        request message, only updating its values per apply. The default implementation
+     *        forwards each apply to setDatapoints.
+     *
+     * @param signalPaths  The signals to be set; the values passed to apply follow this order.
+     *
+     * @return The prepared set; it must not be used after this client got destroyed.
+     */
+    virtual std::shared_ptr<IPreparedSet> prepareSet(const std::vector<std::string>& signalPaths);
+
+    /**
+     * @brief Cancel the requests awaiting their response, e.g. when shutting down. Their results
+     *        fail with a cancellation error. Subscriptions are not affected.
+     *
+     * @return The number of requests which got cancelled.
+     */
+    virtual size_t cancelPendingRequests() { return 0; }
+
+    /**
+     * @brief Get the estimator converting the databroker's timestamps to the local monotonic
+     *        clock, fed by the round trips of the client's reads and the updates it traces (see
+     *        SubscriptionOptions::m_latencyTracingInterval).
+     *
+     * @return The estimator, nullptr if the client does not estimate the offset, e.g. as it
+     *         talks to several databrokers.
+     */
+    [[nodiscard]] virtual ClockOffsetEstimatorPtr_t getClockOffsetEstimator() const {
+        return nullptr;
+    }
+
+    /**
+     * @brief Set the executor running the callbacks of the results and subscriptions created by
+     *        this client from now on. Subscriptions may override it via their options. If none
+     *        is set, callbacks are invoked inline by the threads delivering the responses.
+     *
+     * @param executor  The executor to use; nullptr for the default behavior.
+     */
+    void setCallbackExecutor(CallbackExecutorPtr_t executor);
+
+    [[nodiscard]] CallbackExecutorPtr_t getCallbackExecutor() const;
+
+    /**
+     * @brief Set the executor running the internal work of this client, like restoring
+     *        subscriptions or issuing metadata requests, instead of the SDK's thread pools. The
+     *        responses themselves are still received by the threads of gRPC; to run the
+     *        callbacks by the executor as well, see CallbackExecutor::createExecutor.
+     *
+     * @param executor  The executor to use; nullptr for the thread pools of the SDK.
+     */
+    virtual void setExecutor(ExecutorPtr_t executor);
+
+    /**
+     * @brief Get the executor set via setExecutor; nullptr if none is set.
+     */
+    [[nodiscard]] ExecutorPtr_t getExecutor() const;
+
     /**
      * @brief Create an instance of the IVehicleDataBrokerClient.
      *
@@ -82,8 +363,114 @@ public:
      */
     static std::shared_ptr<IVehicleDataBrokerClient> createInstance(const std::string& serviceName);
 
+    /**
+     * @brief Create a client replaying a recording of a SignalRecorder instead of connecting to
+     *        a databroker. Its subscriptions deliver the recorded updates of their signals with the
+     *        recorded timing; getDatapoints returns the latest replayed values, signals read this
+     *        way are replayed from then on. Set requests succeed without effect. The recording is
+     *        memory mapped and read as it is replayed, so its size is not limited by the memory.
+     *
+     * @param recordingPath  Path of the recording.
+     * @param config         Speed and looping of the replay.
+     * @throw std::runtime_error if the recording cannot be read.
+     */
+    static std::shared_ptr<IVehicleDataBrokerClient> createReplay(const std::string& recordingPath,
+                                                                  ReplayConfig       config = {});
+
+    /**
+     * @brief Create a client reading the latest values of signals from a shared memory table
+     *        maintained by a SharedStatePublisher of another process on the same host, instead
+     *        of subscribing to the databroker itself. getDatapoints and subscriptions of signals
+     *        contained in the table are served from it without any request to the databroker;
+     *        subscriptions are notified once the publisher announces a change. Everything else,
+     *        like set requests, is forwarded to the fallback client.
+     *
+     * @param tableName  Name of the table, as passed to the SharedStatePublisher.
+     * @param fallback   Client for the requests the table cannot serve; nullptr to only read the
+     *                   table, in which case set requests fail.
+     */
+    static std::shared_ptr<IVehicleDataBrokerClient>
+    createSharedState(const std::string&                        tableName,
+                      std::shared_ptr<IVehicleDataBrokerClient> fallback = nullptr);
+
+    /**
+     * @brief Create a client routing the signals of VSS subtrees to the clients of different
+     *        databrokers, e.g. one per zone. Each signal is routed by the route of the longest
+     *        subtree containing it. Requests and subscriptions of signals of several routes are
+     *        split, issued to all their clients at once, and their results merged into one;
+     *        subscriptions with WHERE clauses need all their signals routed to the same client.
+     *        Signals without a route are reported as unknown by getDatapoints and as errors by
+     *        setDatapoints; subscribing to them throws an InvalidValueException.
+     *
+     * @param routes  The routes; at most one per subtree.
+     * @throw InvalidValueException if no route is passed, a route has no client or a subtree is
+     *        routed twice.
+     */
+    static std::shared_ptr<IVehicleDataBrokerClient> createSharded(std::vector<ShardRoute> routes);
+
 protected:
     IVehicleDataBrokerClient() = default;
+
+    /**
+     * @brief Get the executor for the callbacks of a subscription to create: the one of the
+     *        options if not nullptr, otherwise the one of the priority class of the options if
+     *        not NORMAL, otherwise the one of this client.
+     */
+    [[nodiscard]] CallbackExecutorPtr_t
+    resolveCallbackExecutor(const SubscriptionOptions& options) const {
+        if (options.m_callbackExecutor) {
+            return options.m_callbackExecutor;
+        }
+        if (options.m_priority != JobPriority::NORMAL) {
+            return CallbackExecutor::getPriorityInstance(options.m_priority);
+        }
+        return getCallbackExecutor();
+    }
+
+    /**
+     * @brief Apply the executor of this client to the given result before handing it out.
+     */
+    template <typename TResultPtr> TResultPtr withCallbackExecutor(TResultPtr result) const {
+        if (auto executor = getCallbackExecutor()) {
+            result->setCallbackExecutor(std::move(executor));
+        }
+        return result;
+    }
+
+private:
+    CallbackExecutorPtr_t m_callbackExecutor;
+    ExecutorPtr_t         m_executor;
+};
+
+/**
+ * @brief A set request of a fixed list of signals, see IVehicleDataBrokerClient::prepareSet.
+ */
+class IPreparedSet {
+public:
+    using SetErrorMap_t = IVehicleDataBrokerClient::SetErrorMap_t;
+
+    virtual ~IPreparedSet() = default;
+
+    IPreparedSet(const IPreparedSet&)            = delete;
+    IPreparedSet(IPreparedSet&&)                 = delete;
+    IPreparedSet& operator=(const IPreparedSet&) = delete;
+    IPreparedSet& operator=(IPreparedSet&&)      = delete;
+
+    /**
+     * @brief Set the passed values. The values are not referenced after returning, so they can
+     *        be overwritten for the next apply right away.
+     *
+     * @param values  One value per signal the set was prepared for, in the same order.
+     * @param mode    Whether to actuate the signals or to publish their values.
+     *
+     * @return AsyncResultPtr_t<SetErrorMap_t> A map which contains [key, error] entries
+     * if a data point could not be set.
+     */
+    virtual AsyncResultPtr_t<SetErrorMap_t>
+    apply(const std::vector<std::unique_ptr<DataPointValue>>& values, SetMode mode) = 0;
+
+protected:
+    IPreparedSet() = default;
 };
 
 } // namespace velocitas
@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_SHAREDSTATEPUBLISHER_H
+#define VEHICLE_APP_SDK_VDB_SHAREDSTATEPUBLISHER_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace velocitas {
+
+class DataPointReply;
+class SharedStateTable;
+
+/**
+ * @brief Publishes the latest values of a fixed set of signals into a shared memory table, so
+ * other processes on the same host read them via IVehicleDataBrokerClient::createSharedState
+ * instead of each subscribing to the databroker, e.g. a sidecar serving several apps.
+ *
+ * Each signal has a slot of its own, written as a sequence lock: readers never block the
+ * publisher and only retry if they overlap with a write of the same slot. Readers waiting for
+ * changes are woken once per published update. Only scalar values are shared; arrays and strings
+ * are skipped. Thread-safe.
+ */
+class SharedStatePublisher final {
+public:
+    /**
+     * @brief Create the table, replacing one of the same name left behind by another publisher.
+     * The table is removed when the publisher is destroyed.
+     *
+     * @param tableName    Name of the shared memory object, e.g. "/vehicle-state".
+     * @param signalPaths  The signals to publish.
+     * @throw std::runtime_error if the table cannot be created.
+     */
+    SharedStatePublisher(const std::string& tableName, const std::vector<std::string>& signalPaths);
+
+    ~SharedStatePublisher();
+
+    SharedStatePublisher(const SharedStatePublisher&)            = delete;
+    SharedStatePublisher(SharedStatePublisher&&)                 = delete;
+    SharedStatePublisher& operator=(const SharedStatePublisher&) = delete;
+    SharedStatePublisher& operator=(SharedStatePublisher&&)      = delete;
+
+    /**
+     * @brief Write the data points of a subscription update (or of any other reply) into the
+     *        table and wake the waiting readers, e.g. from the item callback of a subscription of
+     *        the published signals. Data points of other signals are ignored.
+     */
+    void publish(const DataPointReply& reply);
+
+    /**
+     * @brief Get the number of published updates which changed at least one slot.
+     */
+    [[nodiscard]] uint64_t getNumPublishedUpdates() const { return m_numPublishedUpdates; }
+
+private:
+    std::mutex                        m_mutex;
+    std::unique_ptr<SharedStateTable> m_table;
+    std::atomic<uint64_t>             m_numPublishedUpdates{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_SHAREDSTATEPUBLISHER_H
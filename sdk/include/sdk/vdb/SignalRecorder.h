@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_SIGNALRECORDER_H
+#define VEHICLE_APP_SDK_VDB_SIGNALRECORDER_H
+
+#include "sdk/SignalPathRegistry.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace velocitas {
+
+class DataPointReply;
+
+/**
+ * @brief Records the updates of subscriptions into a compact binary log, to replay them later
+ * via IVehicleDataBrokerClient::createReplay, e.g. for regression testing an app against data
+ * captured in a vehicle.
+ *
+ * Each update is appended as one record, stamped with the time since the recorder was created;
+ * paths are written once and referred to by a number, values are stored in binary. The log is
+ * append-only and each record is complete on its own, so a recording cut short (e.g. by a crash)
+ * stays readable up to its last complete record. Thread-safe.
+ */
+class SignalRecorder final {
+public:
+    /**
+     * @brief Create the recording file, replacing an existing one.
+     *
+     * @param path  Path of the file.
+     * @throw std::runtime_error if the file cannot be created.
+     */
+    explicit SignalRecorder(const std::string& path);
+
+    /**
+     * @brief Flush and close the file.
+     */
+    ~SignalRecorder();
+
+    SignalRecorder(const SignalRecorder&)            = delete;
+    SignalRecorder(SignalRecorder&&)                 = delete;
+    SignalRecorder& operator=(const SignalRecorder&) = delete;
+    SignalRecorder& operator=(SignalRecorder&&)      = delete;
+
+    /**
+     * @brief Append the data points of a subscription update (or of any other reply) as one
+     *        update, e.g. from the item callback of the subscription.
+     */
+    void record(const DataPointReply& reply);
+
+    /**
+     * @brief Write the buffered records to the file.
+     */
+    void flush();
+
+    [[nodiscard]] uint64_t getNumRecordedUpdates() const;
+
+private:
+    // need to be called with m_mutex being locked
+    uint32_t getPathId(SignalHandle_t handle);
+    void     writeRecord(uint32_t kind, const std::vector<uint8_t>& payload);
+
+    const std::chrono::steady_clock::time_point m_start{std::chrono::steady_clock::now()};
+
+    mutable std::mutex    m_mutex;
+    std::FILE*            m_file{nullptr};
+    // payload of the record being written
+    std::vector<uint8_t>  m_payload;
+    // the path id of each signal handle written already
+    std::vector<uint32_t> m_pathIds;
+    uint32_t              m_nextPathId{0};
+    uint64_t              m_numUpdates{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_SIGNALRECORDER_H
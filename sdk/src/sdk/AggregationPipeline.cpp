@@ -0,0 +1,305 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/AggregationPipeline.h"
+
+#include "sdk/Exceptions.h"
+#include "sdk/IPubSubClient.h"
+#include "sdk/Job.h"
+#include "sdk/Logger.h"
+#include "sdk/ThreadPool.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace velocitas {
+
+namespace {
+
+constexpr int64_t NANOSECONDS_PER_MILLISECOND = 1000000;
+
+std::optional<double> getNumericValue(const DataPointSample& sample) {
+    if (!sample.isValid()) {
+        return std::nullopt;
+    }
+    return std::visit(
+        [](const auto& value) -> std::optional<double> {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+                return static_cast<double>(value);
+            } else {
+                return std::nullopt;
+            }
+        },
+        sample.getVariant());
+}
+
+Timestamp getCurrentTimestamp() {
+    const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::system_clock::now().time_since_epoch())
+                         .count();
+    return Timestamp{now / 1000000000, static_cast<int32_t>(now % 1000000000)};
+}
+
+int64_t toMilliseconds(const Timestamp& timestamp) {
+    return timestamp.seconds * 1000 + timestamp.nanos / NANOSECONDS_PER_MILLISECOND;
+}
+
+} // namespace
+
+std::shared_ptr<AggregationPipeline>
+AggregationPipeline::create(AsyncSubscriptionPtr_t<DataPointReply> subscription,
+                            std::shared_ptr<IPubSubClient> publisher,
+                            AggregationPipelineConfig config,
+                            std::shared_ptr<ThreadPool> threadPool) {
+    if (!subscription || !publisher) {
+        throw InvalidValueException("AggregationPipeline needs a subscription and a publisher");
+    }
+    if (config.m_topic.empty() || config.m_window <= std::chrono::milliseconds::zero() ||
+        config.m_maxInFlightPublishes == 0) {
+        throw InvalidValueException(
+            "AggregationPipeline needs a topic, a positive window and a publish in flight");
+    }
+    if (!config.m_serializer) {
+        config.m_serializer = &AggregationPipeline::toJson;
+    }
+    // the constructor is private, so make_shared cannot be used
+    std::shared_ptr<AggregationPipeline> pipeline(
+        new AggregationPipeline(std::move(subscription), std::move(publisher), std::move(config)));
+    pipeline->start(threadPool ? threadPool : ThreadPool::getInstance());
+    return pipeline;
+}
+
+AggregationPipeline::AggregationPipeline(AsyncSubscriptionPtr_t<DataPointReply> subscription,
+                                         std::shared_ptr<IPubSubClient>         publisher,
+                                         AggregationPipelineConfig              config)
+    : m_config(std::move(config))
+    , m_subscription(std::move(subscription))
+    , m_publisher(std::move(publisher))
+    , m_windowStart(getCurrentTimestamp()) {}
+
+AggregationPipeline::~AggregationPipeline() { stop(); }
+
+void AggregationPipeline::start(const std::shared_ptr<ThreadPool>& threadPool) {
+    std::weak_ptr<AggregationPipeline> weakSelf = weak_from_this();
+    m_subscription
+        ->onItem([weakSelf](const DataPointReply& reply) {
+            if (auto self = weakSelf.lock()) {
+                self->accumulate(reply);
+            }
+        })
+        ->onError([topic = m_config.m_topic](const Status& status) {
+            logger().error("AggregationPipeline: Subscription of '{}' failed: {}", topic,
+                           status.errorMessage());
+        });
+
+    m_windowJob = PeriodicJob::create(
+        [weakSelf]() {
+            if (auto self = weakSelf.lock()) {
+                self->closeWindow();
+            }
+        },
+        m_config.m_window, MissedTickPolicy::COALESCE);
+    threadPool->enqueue(m_windowJob);
+}
+
+void AggregationPipeline::flush() { closeWindow(); }
+
+void AggregationPipeline::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_windowMutex);
+        if (m_isStopped) {
+            return;
+        }
+        m_isStopped = true;
+    }
+    if (m_windowJob) {
+        m_windowJob->cancel();
+    }
+    m_subscription->cancel();
+    closeWindow();
+}
+
+AggregationPipelineMetrics AggregationPipeline::getMetrics() const {
+    AggregationPipelineMetrics metrics;
+    metrics.numUpdates          = m_numUpdates;
+    metrics.numWindows          = m_numWindows;
+    metrics.numPublishedWindows = m_numPublishedWindows;
+    metrics.numFailedWindows    = m_numFailedWindows;
+    metrics.numDroppedWindows   = m_numDroppedWindows;
+    return metrics;
+}
+
+std::string AggregationPipeline::toJson(const AggregationWindow& window) {
+    auto signals = nlohmann::json::object();
+    for (const auto& aggregates : window.signals) {
+        signals[aggregates.path] = {{"count", aggregates.count}, {"sum", aggregates.sum},
+                                    {"mean", aggregates.mean},   {"min", aggregates.min},
+                                    {"max", aggregates.max},     {"first", aggregates.first},
+                                    {"last", aggregates.last}};
+    }
+    return nlohmann::json{{"start", toMilliseconds(window.start)},
+                          {"end", toMilliseconds(window.end)},
+                          {"signals", std::move(signals)}}
+        .dump();
+}
+
+void AggregationPipeline::accumulate(const DataPointReply& reply) {
+    ++m_numUpdates;
+    std::lock_guard<std::mutex> lock(m_windowMutex);
+    if (m_isStopped) {
+        return;
+    }
+    for (const auto& entry : reply) {
+        const auto value = getNumericValue(DataPointReply::getSample(entry));
+        if (!value) {
+            continue;
+        }
+        auto& accumulator = m_accumulators[entry.m_handle];
+        if (accumulator.count == 0) {
+            accumulator.min   = *value;
+            accumulator.max   = *value;
+            accumulator.first = *value;
+        } else {
+            accumulator.min = std::min(accumulator.min, *value);
+            accumulator.max = std::max(accumulator.max, *value);
+        }
+        ++accumulator.count;
+        accumulator.sum += *value;
+        accumulator.last = *value;
+    }
+}
+
+void AggregationPipeline::closeWindow() {
+    // keeps the windows in order if flush() and the window job close one concurrently
+    std::lock_guard<std::mutex> closeLock(m_closeMutex);
+
+    AggregationWindow window;
+    {
+        std::lock_guard<std::mutex> lock(m_windowMutex);
+        window.start  = m_windowStart;
+        window.end    = getCurrentTimestamp();
+        m_windowStart = window.end;
+        m_closedAccumulators.swap(m_accumulators);
+    }
+    ++m_numWindows;
+
+    window.signals.reserve(m_closedAccumulators.size());
+    for (const auto& [handle, accumulator] : m_closedAccumulators) {
+        SignalWindowAggregates aggregates;
+        aggregates.path  = SignalPathRegistry::getInstance().getPath(handle);
+        aggregates.count = accumulator.count;
+        aggregates.sum   = accumulator.sum;
+        aggregates.mean  = accumulator.sum / static_cast<double>(accumulator.count);
+        aggregates.min   = accumulator.min;
+        aggregates.max   = accumulator.max;
+        aggregates.first = accumulator.first;
+        aggregates.last  = accumulator.last;
+        window.signals.push_back(std::move(aggregates));
+    }
+    // cleared here rather than reallocated, so the buckets are reused by the next window
+    m_closedAccumulators.clear();
+    if (window.signals.empty() && !m_config.m_isPublishingEmptyWindows) {
+        return;
+    }
+    std::sort(window.signals.begin(), window.signals.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.path < rhs.path; });
+
+    std::string payload;
+    try {
+        payload = m_config.m_serializer(window);
+    } catch (const std::exception& e) {
+        logger().error("AggregationPipeline: Serializing a window of '{}' failed: {}",
+                       m_config.m_topic, e.what());
+        ++m_numFailedWindows;
+        return;
+    }
+    enqueue(std::move(payload));
+}
+
+void AggregationPipeline::enqueue(std::string payload) {
+    {
+        std::lock_guard<std::mutex> lock(m_publishMutex);
+        if (m_numInFlightPublishes >= m_config.m_maxInFlightPublishes) {
+            if (m_queuedWindows.size() >= m_config.m_maxQueuedWindows) {
+                if (m_queuedWindows.empty()) {
+                    ++m_numDroppedWindows;
+                    return;
+                }
+                m_queuedWindows.pop_front();
+                ++m_numDroppedWindows;
+            }
+            m_queuedWindows.push_back(std::move(payload));
+            return;
+        }
+        ++m_numInFlightPublishes;
+    }
+    publish(std::move(payload));
+}
+
+void AggregationPipeline::publish(std::string payload) {
+    AsyncResultPtr_t<PublishStatus> result;
+    try {
+        result = m_publisher->publishAsync(m_config.m_topic, payload, m_config.m_publishTimeout);
+    } catch (const std::exception& e) {
+        logger().error("AggregationPipeline: Publishing to '{}' failed: {}", m_config.m_topic,
+                       e.what());
+        onPublished(false);
+        return;
+    }
+    // the pipeline may be gone by the time the publish completes
+    std::weak_ptr<AggregationPipeline> weakSelf = weak_from_this();
+    result
+        ->onResult([weakSelf](const PublishStatus& status) {
+            if (auto self = weakSelf.lock()) {
+                self->onPublished(status == PublishStatus::Success ||
+                                  status == PublishStatus::Queued);
+            }
+        })
+        ->onError([weakSelf](const Status& /*status*/) {
+            if (auto self = weakSelf.lock()) {
+                self->onPublished(false);
+            }
+        });
+}
+
+void AggregationPipeline::onPublished(bool isSuccessful) {
+    if (isSuccessful) {
+        ++m_numPublishedWindows;
+    } else {
+        ++m_numFailedWindows;
+    }
+
+    std::string next;
+    {
+        std::lock_guard<std::mutex> lock(m_publishMutex);
+        if (m_queuedWindows.empty()) {
+            --m_numInFlightPublishes;
+            return;
+        }
+        next = std::move(m_queuedWindows.front());
+        m_queuedWindows.pop_front();
+    }
+    publish(std::move(next));
+}
+
+} // namespace velocitas
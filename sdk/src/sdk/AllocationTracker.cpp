@@ -0,0 +1,188 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/AllocationTracker.h"
+
+#include "sdk/Exceptions.h"
+#include "sdk/Metrics.h"
+#include "sdk/Utils.h"
+
+#include <fmt/core.h>
+
+#include <atomic>
+#include <cstdio>
+#include <exception>
+#include <string>
+#include <vector>
+
+namespace velocitas {
+
+namespace {
+
+struct DomainCounters {
+    std::atomic<uint64_t> numAllocations{0};
+    std::atomic<uint64_t> numDeallocations{0};
+    std::atomic<uint64_t> allocatedBytes{0};
+    std::atomic<uint64_t> heldBytes{0};
+    std::atomic<uint64_t> peakHeldBytes{0};
+};
+
+// trivially destructible, so allocations can still be recorded during static destruction
+std::array<DomainCounters, NUM_ALLOCATION_DOMAINS> domainCounters; // NOLINT
+
+DomainCounters& getCounters(AllocationDomain domain) {
+    return domainCounters[static_cast<size_t>(domain)];
+}
+
+uint64_t getLimitFromEnv() {
+    const auto limit = getEnvVar("SDV_MEMORY_LIMIT");
+    if (limit.empty()) {
+        return 0;
+    }
+    try {
+        return std::stoull(limit);
+    } catch (const std::exception&) {
+        // logging is not available this early, as the limit is read during static initialization
+        std::fprintf(stderr, "[AllocationTracker] Ignoring invalid SDV_MEMORY_LIMIT '%s'\n",
+                     limit.c_str());
+        return 0;
+    }
+}
+
+std::atomic<uint64_t> memoryLimit{getLimitFromEnv()}; // NOLINT
+
+void addDomainMetric(std::vector<MetricSnapshot>& metrics, const char* name, const char* help,
+                     MetricType type, AllocationDomain domain, uint64_t value) {
+    MetricSnapshot metric;
+    metric.name   = name;
+    metric.help   = help;
+    metric.type   = type;
+    metric.labels = {{"subsystem", std::string{AllocationTracker::getName(domain)}}};
+    metric.value  = static_cast<double>(value);
+    metrics.push_back(std::move(metric));
+}
+
+void collectMetrics(std::vector<MetricSnapshot>& metrics) {
+    for (size_t i = 0; i < NUM_ALLOCATION_DOMAINS; ++i) {
+        const auto domain     = static_cast<AllocationDomain>(i);
+        const auto statistics = AllocationTracker::getStatistics(domain);
+        addDomainMetric(metrics, "sdv_allocations_total", "Number of heap allocations",
+                        MetricType::COUNTER, domain, statistics.numAllocations);
+        addDomainMetric(metrics, "sdv_deallocations_total", "Number of heap deallocations",
+                        MetricType::COUNTER, domain, statistics.numDeallocations);
+        addDomainMetric(metrics, "sdv_allocated_bytes_total", "Sum of the allocated bytes",
+                        MetricType::COUNTER, domain, statistics.allocatedBytes);
+        addDomainMetric(metrics, "sdv_allocation_held_bytes", "Bytes currently held",
+                        MetricType::GAUGE, domain, statistics.heldBytes);
+        addDomainMetric(metrics, "sdv_allocation_peak_held_bytes", "Maximum of the bytes held",
+                        MetricType::GAUGE, domain, statistics.peakHeldBytes);
+    }
+}
+
+// only reported if the subsystems actually allocate via the tracking allocator
+const MetricsCollectorHandle metricsCollector = // NOLINT
+    IS_ALLOCATION_TRACKING_ENABLED ? MetricsRegistry::getInstance().addCollector(collectMetrics)
+                                   : MetricsCollectorHandle{};
+
+} // namespace
+
+void AllocationTracker::recordAllocation(AllocationDomain domain, size_t numBytes) noexcept {
+    auto& counters = getCounters(domain);
+    counters.numAllocations.fetch_add(1, std::memory_order_relaxed);
+    counters.allocatedBytes.fetch_add(numBytes, std::memory_order_relaxed);
+    const auto heldBytes =
+        counters.heldBytes.fetch_add(numBytes, std::memory_order_relaxed) + numBytes;
+    auto peakHeldBytes = counters.peakHeldBytes.load(std::memory_order_relaxed);
+    while (heldBytes > peakHeldBytes &&
+           !counters.peakHeldBytes.compare_exchange_weak(peakHeldBytes, heldBytes,
+                                                         std::memory_order_relaxed)) {
+    }
+}
+
+void AllocationTracker::recordDeallocation(AllocationDomain domain, size_t numBytes) noexcept {
+    auto& counters = getCounters(domain);
+    counters.numDeallocations.fetch_add(1, std::memory_order_relaxed);
+    counters.heldBytes.fetch_sub(numBytes, std::memory_order_relaxed);
+}
+
+void AllocationTracker::checkLimit(AllocationDomain domain, size_t numBytes) {
+    const auto limit = memoryLimit.load(std::memory_order_relaxed);
+    if (limit == 0) {
+        return;
+    }
+    const auto heldBytes = getTotalHeldBytes();
+    if (heldBytes + numBytes > limit) {
+        throw MemoryLimitExceededException(
+            fmt::format("Memory limit of {} bytes exceeded: allocating {} bytes for {} while {} "
+                        "bytes are held",
+                        limit, numBytes, getName(domain), heldBytes));
+    }
+}
+
+void AllocationTracker::setLimit(uint64_t maxHeldBytes) noexcept {
+    memoryLimit.store(maxHeldBytes, std::memory_order_relaxed);
+}
+
+uint64_t AllocationTracker::getLimit() noexcept {
+    return memoryLimit.load(std::memory_order_relaxed);
+}
+
+uint64_t AllocationTracker::getTotalHeldBytes() noexcept {
+    uint64_t heldBytes = 0;
+    for (const auto& counters : domainCounters) {
+        heldBytes += counters.heldBytes.load(std::memory_order_relaxed);
+    }
+    return heldBytes;
+}
+
+AllocationStatistics AllocationTracker::getStatistics(AllocationDomain domain) noexcept {
+    const auto&          counters = getCounters(domain);
+    AllocationStatistics statistics;
+    statistics.numAllocations   = counters.numAllocations.load(std::memory_order_relaxed);
+    statistics.numDeallocations = counters.numDeallocations.load(std::memory_order_relaxed);
+    statistics.allocatedBytes   = counters.allocatedBytes.load(std::memory_order_relaxed);
+    statistics.heldBytes        = counters.heldBytes.load(std::memory_order_relaxed);
+    statistics.peakHeldBytes    = counters.peakHeldBytes.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+std::string_view AllocationTracker::getName(AllocationDomain domain) noexcept {
+    switch (domain) {
+    case AllocationDomain::SUBSCRIPTION_BUFFERS:
+        return "subscription_buffers";
+    case AllocationDomain::METADATA_CACHE:
+        return "metadata_cache";
+    case AllocationDomain::REPLY_MAPS:
+        return "reply_maps";
+    case AllocationDomain::GRPC_CALLS:
+        return "grpc_calls";
+    case AllocationDomain::JOBS:
+        return "jobs";
+    }
+    return "unknown";
+}
+
+void AllocationTracker::reset() noexcept {
+    for (auto& counters : domainCounters) {
+        counters.numAllocations.store(0, std::memory_order_relaxed);
+        counters.numDeallocations.store(0, std::memory_order_relaxed);
+        counters.allocatedBytes.store(0, std::memory_order_relaxed);
+        counters.peakHeldBytes.store(counters.heldBytes.load(std::memory_order_relaxed),
+                                     std::memory_order_relaxed);
+    }
+}
+
+} // namespace velocitas
@@ -0,0 +1,304 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/ArrayConversions.h"
+
+#include <limits>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define VELOCITAS_ARRAY_CONVERSIONS_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define VELOCITAS_ARRAY_CONVERSIONS_NEON
+#endif
+
+namespace velocitas {
+
+namespace {
+
+template <typename TNarrow, typename TWide>
+void widenScalar(const TNarrow* src, size_t count, TWide* dst) {
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = src[i];
+    }
+}
+
+template <typename TWide, typename TNarrow>
+size_t narrowScalar(const TWide* src, size_t count, TNarrow* dst) {
+    constexpr auto MIN = static_cast<TWide>(std::numeric_limits<TNarrow>::min());
+    constexpr auto MAX = static_cast<TWide>(std::numeric_limits<TNarrow>::max());
+
+    size_t numOutOfRange = 0;
+    for (size_t i = 0; i < count; ++i) {
+        auto value = src[i];
+        if (value > MAX) {
+            value = MAX;
+            ++numOutOfRange;
+        } else if constexpr (std::is_signed_v<TWide>) {
+            if (value < MIN) {
+                value = MIN;
+                ++numOutOfRange;
+            }
+        }
+        dst[i] = static_cast<TNarrow>(value);
+    }
+    return numOutOfRange;
+}
+
+#if defined(VELOCITAS_ARRAY_CONVERSIONS_SSE2)
+
+// all SSE2 kernels use unaligned loads and stores, as the arrays are not aligned to 16 bytes
+
+void store(void* dst, __m128i value) { _mm_storeu_si128(static_cast<__m128i*>(dst), value); }
+
+__m128i load(const void* src) { return _mm_loadu_si128(static_cast<const __m128i*>(src)); }
+
+// store the 8 16 bit lanes of words as 32 bit lanes, extended by the lanes of the high words
+void storeWidenedWords(int32_t* dst, __m128i words, __m128i highWords) {
+    store(dst, _mm_unpacklo_epi16(words, highWords));
+    store(dst + 4, _mm_unpackhi_epi16(words, highWords));
+}
+
+// the number of set 32 bit lanes of the passed mask
+size_t countLanes(__m128i mask) {
+    return static_cast<size_t>(__builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(mask))));
+}
+
+__m128i isOutOfRange(__m128i values, __m128i min, __m128i max) {
+    return _mm_or_si128(_mm_cmpgt_epi32(values, max), _mm_cmpgt_epi32(min, values));
+}
+
+// the mask of the unsigned 32 bit lanes having bits set above the lowest BITS ones
+template <int BITS> __m128i hasHighBits(__m128i values) {
+    const auto isInRange = _mm_cmpeq_epi32(_mm_srli_epi32(values, BITS), _mm_setzero_si128());
+    return _mm_xor_si128(isInRange, _mm_set1_epi32(-1));
+}
+
+#elif defined(VELOCITAS_ARRAY_CONVERSIONS_NEON)
+
+size_t countLanes(uint32x4_t mask) { return vaddvq_u32(vshrq_n_u32(mask, 31)); }
+
+#endif
+
+} // namespace
+
+void widenIntegers(const int8_t* src, size_t count, int32_t* dst) {
+    size_t i = 0;
+#if defined(VELOCITAS_ARRAY_CONVERSIONS_SSE2)
+    for (; i + 16 <= count; i += 16) {
+        const auto bytes = load(src + i);
+        const auto signs = _mm_cmpgt_epi8(_mm_setzero_si128(), bytes);
+        const auto low   = _mm_unpacklo_epi8(bytes, signs);
+        const auto high  = _mm_unpackhi_epi8(bytes, signs);
+        storeWidenedWords(dst + i, low, _mm_srai_epi16(low, 15));
+        storeWidenedWords(dst + i + 8, high, _mm_srai_epi16(high, 15));
+    }
+#elif defined(VELOCITAS_ARRAY_CONVERSIONS_NEON)
+    for (; i + 16 <= count; i += 16) {
+        const auto bytes = vld1q_s8(src + i);
+        const auto low   = vmovl_s8(vget_low_s8(bytes));
+        const auto high  = vmovl_high_s8(bytes);
+        vst1q_s32(dst + i, vmovl_s16(vget_low_s16(low)));
+        vst1q_s32(dst + i + 4, vmovl_high_s16(low));
+        vst1q_s32(dst + i + 8, vmovl_s16(vget_low_s16(high)));
+        vst1q_s32(dst + i + 12, vmovl_high_s16(high));
+    }
+#endif
+    widenScalar(src + i, count - i, dst + i);
+}
+
+void widenIntegers(const int16_t* src, size_t count, int32_t* dst) {
+    size_t i = 0;
+#if defined(VELOCITAS_ARRAY_CONVERSIONS_SSE2)
+    for (; i + 8 <= count; i += 8) {
+        const auto words = load(src + i);
+        storeWidenedWords(dst + i, words, _mm_srai_epi16(words, 15));
+    }
+#elif defined(VELOCITAS_ARRAY_CONVERSIONS_NEON)
+    for (; i + 8 <= count; i += 8) {
+        const auto words = vld1q_s16(src + i);
+        vst1q_s32(dst + i, vmovl_s16(vget_low_s16(words)));
+        vst1q_s32(dst + i + 4, vmovl_high_s16(words));
+    }
+#endif
+    widenScalar(src + i, count - i, dst + i);
+}
+
+void widenIntegers(const uint8_t* src, size_t count, uint32_t* dst) {
+    size_t i = 0;
+#if defined(VELOCITAS_ARRAY_CONVERSIONS_SSE2)
+    const auto zero = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16) {
+        const auto bytes = load(src + i);
+        auto*      out   = reinterpret_cast<int32_t*>(dst + i);
+        storeWidenedWords(out, _mm_unpacklo_epi8(bytes, zero), zero);
+        storeWidenedWords(out + 8, _mm_unpackhi_epi8(bytes, zero), zero);
+    }
+#elif defined(VELOCITAS_ARRAY_CONVERSIONS_NEON)
+    for (; i + 16 <= count; i += 16) {
+        const auto bytes = vld1q_u8(src + i);
+        const auto low   = vmovl_u8(vget_low_u8(bytes));
+        const auto high  = vmovl_high_u8(bytes);
+        vst1q_u32(dst + i, vmovl_u16(vget_low_u16(low)));
+        vst1q_u32(dst + i + 4, vmovl_high_u16(low));
+        vst1q_u32(dst + i + 8, vmovl_u16(vget_low_u16(high)));
+        vst1q_u32(dst + i + 12, vmovl_high_u16(high));
+    }
+#endif
+    widenScalar(src + i, count - i, dst + i);
+}
+
+void widenIntegers(const uint16_t* src, size_t count, uint32_t* dst) {
+    size_t i = 0;
+#if defined(VELOCITAS_ARRAY_CONVERSIONS_SSE2)
+    const auto zero = _mm_setzero_si128();
+    for (; i + 8 <= count; i += 8) {
+        storeWidenedWords(reinterpret_cast<int32_t*>(dst + i), load(src + i), zero);
+    }
+#elif defined(VELOCITAS_ARRAY_CONVERSIONS_NEON)
+    for (; i + 8 <= count; i += 8) {
+        const auto words = vld1q_u16(src + i);
+        vst1q_u32(dst + i, vmovl_u16(vget_low_u16(words)));
+        vst1q_u32(dst + i + 4, vmovl_high_u16(words));
+    }
+#endif
+    widenScalar(src + i, count - i, dst + i);
+}
+
+size_t narrowIntegers(const int32_t* src, size_t count, int8_t* dst) {
+    size_t numOutOfRange = 0;
+    size_t i             = 0;
+#if defined(VELOCITAS_ARRAY_CONVERSIONS_SSE2)
+    const auto min = _mm_set1_epi32(std::numeric_limits<int8_t>::min());
+    const auto max = _mm_set1_epi32(std::numeric_limits<int8_t>::max());
+    for (; i + 16 <= count; i += 16) {
+        const __m128i values[] = {load(src + i), load(src + i + 4), load(src + i + 8),
+                                  load(src + i + 12)};
+        for (const auto& value : values) {
+            numOutOfRange += countLanes(isOutOfRange(value, min, max));
+        }
+        // saturating to 16 bit first keeps the saturation to 8 bit correct
+        store(dst + i, _mm_packs_epi16(_mm_packs_epi32(values[0], values[1]),
+                                       _mm_packs_epi32(values[2], values[3])));
+    }
+#elif defined(VELOCITAS_ARRAY_CONVERSIONS_NEON)
+    const auto min = vdupq_n_s32(std::numeric_limits<int8_t>::min());
+    const auto max = vdupq_n_s32(std::numeric_limits<int8_t>::max());
+    for (; i + 16 <= count; i += 16) {
+        const int32x4_t values[] = {vld1q_s32(src + i), vld1q_s32(src + i + 4),
+                                    vld1q_s32(src + i + 8), vld1q_s32(src + i + 12)};
+        for (const auto& value : values) {
+            numOutOfRange += countLanes(vorrq_u32(vcgtq_s32(value, max), vcltq_s32(value, min)));
+        }
+        const auto low  = vqmovn_high_s32(vqmovn_s32(values[0]), values[1]);
+        const auto high = vqmovn_high_s32(vqmovn_s32(values[2]), values[3]);
+        vst1q_s8(dst + i, vqmovn_high_s16(vqmovn_s16(low), high));
+    }
+#endif
+    return numOutOfRange + narrowScalar(src + i, count - i, dst + i);
+}
+
+size_t narrowIntegers(const int32_t* src, size_t count, int16_t* dst) {
+    size_t numOutOfRange = 0;
+    size_t i             = 0;
+#if defined(VELOCITAS_ARRAY_CONVERSIONS_SSE2)
+    const auto min = _mm_set1_epi32(std::numeric_limits<int16_t>::min());
+    const auto max = _mm_set1_epi32(std::numeric_limits<int16_t>::max());
+    for (; i + 8 <= count; i += 8) {
+        const auto low  = load(src + i);
+        const auto high = load(src + i + 4);
+        numOutOfRange += countLanes(isOutOfRange(low, min, max));
+        numOutOfRange += countLanes(isOutOfRange(high, min, max));
+        store(dst + i, _mm_packs_epi32(low, high));
+    }
+#elif defined(VELOCITAS_ARRAY_CONVERSIONS_NEON)
+    const auto min = vdupq_n_s32(std::numeric_limits<int16_t>::min());
+    const auto max = vdupq_n_s32(std::numeric_limits<int16_t>::max());
+    for (; i + 8 <= count; i += 8) {
+        const auto low  = vld1q_s32(src + i);
+        const auto high = vld1q_s32(src + i + 4);
+        numOutOfRange += countLanes(vorrq_u32(vcgtq_s32(low, max), vcltq_s32(low, min)));
+        numOutOfRange += countLanes(vorrq_u32(vcgtq_s32(high, max), vcltq_s32(high, min)));
+        vst1q_s16(dst + i, vqmovn_high_s32(vqmovn_s32(low), high));
+    }
+#endif
+    return numOutOfRange + narrowScalar(src + i, count - i, dst + i);
+}
+
+size_t narrowIntegers(const uint32_t* src, size_t count, uint8_t* dst) {
+    size_t numOutOfRange = 0;
+    size_t i             = 0;
+#if defined(VELOCITAS_ARRAY_CONVERSIONS_SSE2)
+    // SSE2 lacks unsigned 32 bit packing: out of range lanes are saturated by setting all of
+    // their bits, then the lowest byte of each lane is packed
+    const auto lowByte = _mm_set1_epi32(std::numeric_limits<uint8_t>::max());
+    for (; i + 16 <= count; i += 16) {
+        __m128i values[] = {load(src + i), load(src + i + 4), load(src + i + 8),
+                            load(src + i + 12)};
+        for (auto& value : values) {
+            const auto outOfRange = hasHighBits<8>(value);
+            numOutOfRange += countLanes(outOfRange);
+            value = _mm_and_si128(_mm_or_si128(value, outOfRange), lowByte);
+        }
+        store(dst + i, _mm_packus_epi16(_mm_packs_epi32(values[0], values[1]),
+                                        _mm_packs_epi32(values[2], values[3])));
+    }
+#elif defined(VELOCITAS_ARRAY_CONVERSIONS_NEON)
+    const auto max = vdupq_n_u32(std::numeric_limits<uint8_t>::max());
+    for (; i + 16 <= count; i += 16) {
+        const uint32x4_t values[] = {vld1q_u32(src + i), vld1q_u32(src + i + 4),
+                                     vld1q_u32(src + i + 8), vld1q_u32(src + i + 12)};
+        for (const auto& value : values) {
+            numOutOfRange += countLanes(vcgtq_u32(value, max));
+        }
+        const auto low  = vqmovn_high_u32(vqmovn_u32(values[0]), values[1]);
+        const auto high = vqmovn_high_u32(vqmovn_u32(values[2]), values[3]);
+        vst1q_u8(dst + i, vqmovn_high_u16(vqmovn_u16(low), high));
+    }
+#endif
+    return numOutOfRange + narrowScalar(src + i, count - i, dst + i);
+}
+
+size_t narrowIntegers(const uint32_t* src, size_t count, uint16_t* dst) {
+    size_t numOutOfRange = 0;
+    size_t i             = 0;
+#if defined(VELOCITAS_ARRAY_CONVERSIONS_SSE2)
+    // as above; the lowest word of each lane is sign extended, so the signed packing keeps it
+    for (; i + 8 <= count; i += 8) {
+        __m128i values[] = {load(src + i), load(src + i + 4)};
+        for (auto& value : values) {
+            const auto outOfRange = hasHighBits<16>(value);
+            numOutOfRange += countLanes(outOfRange);
+            value = _mm_srai_epi32(_mm_slli_epi32(_mm_or_si128(value, outOfRange), 16), 16);
+        }
+        store(dst + i, _mm_packs_epi32(values[0], values[1]));
+    }
+#elif defined(VELOCITAS_ARRAY_CONVERSIONS_NEON)
+    const auto max = vdupq_n_u32(std::numeric_limits<uint16_t>::max());
+    for (; i + 8 <= count; i += 8) {
+        const auto low  = vld1q_u32(src + i);
+        const auto high = vld1q_u32(src + i + 4);
+        numOutOfRange += countLanes(vcgtq_u32(low, max));
+        numOutOfRange += countLanes(vcgtq_u32(high, max));
+        vst1q_u16(dst + i, vqmovn_high_u32(vqmovn_u32(low), high));
+    }
+#endif
+    return numOutOfRange + narrowScalar(src + i, count - i, dst + i);
+}
+
+} // namespace velocitas
@@ -0,0 +1,52 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_ARRAYCONVERSIONS_H
+#define VEHICLE_APP_SDK_ARRAYCONVERSIONS_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace velocitas {
+
+/**
+ * @brief Conversion kernels between the integer arrays of types narrower than 32 bit and the
+ * 32 bit arrays the databroker APIs transport them in.
+ *
+ * The kernels use SSE2 on x86-64 and NEON on AArch64 (both being part of the baseline of these
+ * architectures, so no runtime dispatch is needed) and a scalar loop for the remaining elements
+ * and on other architectures. Source and destination must not overlap.
+ */
+
+void widenIntegers(const int8_t* src, size_t count, int32_t* dst);
+void widenIntegers(const int16_t* src, size_t count, int32_t* dst);
+void widenIntegers(const uint8_t* src, size_t count, uint32_t* dst);
+void widenIntegers(const uint16_t* src, size_t count, uint32_t* dst);
+
+/**
+ * @brief Narrow the passed values, saturating the ones out of the range of the narrow type.
+ *
+ * @return size_t  The number of values which were out of range, i.e. zero if the values were
+ *                 converted exactly.
+ */
+size_t narrowIntegers(const int32_t* src, size_t count, int8_t* dst);
+size_t narrowIntegers(const int32_t* src, size_t count, int16_t* dst);
+size_t narrowIntegers(const uint32_t* src, size_t count, uint8_t* dst);
+size_t narrowIntegers(const uint32_t* src, size_t count, uint16_t* dst);
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_ARRAYCONVERSIONS_H
@@ -0,0 +1,175 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/AsyncLogger.h"
+
+#include <chrono>
+#include <utility>
+
+namespace velocitas {
+
+namespace {
+
+// only a safety net, the background thread is woken up by the logging threads
+constexpr std::chrono::milliseconds IDLE_TIMEOUT{100};
+
+} // namespace
+
+AsyncLogger::AsyncLogger(std::unique_ptr<ILogger> sink, AsyncLoggerConfig config)
+    : m_sink{std::move(sink)}
+    , m_config{config}
+    , m_buffer{config.m_capacity}
+    , m_thread{[this]() { run(); }} {}
+
+AsyncLogger::~AsyncLogger() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+    m_wakeUp.notify_one();
+    m_thread.join();
+}
+
+void AsyncLogger::flush() {
+    auto flushed = std::make_shared<std::promise<void>>();
+    auto future  = flushed->get_future();
+    pushBlocking(Record{LogLevel::OFF, {}, {}, std::move(flushed)});
+    future.wait();
+}
+
+void AsyncLogger::log(LogLevel level, const std::string& msg) {
+    push(Record{level, msg, {}, nullptr});
+}
+
+void AsyncLogger::logDeferred(LogLevel level, LogRecord&& record) {
+    push(Record{level, {}, std::move(record), nullptr});
+}
+
+void AsyncLogger::push(Record&& record) {
+    const bool isError = record.m_level == LogLevel::ERROR;
+    if (m_config.m_overflowPolicy == AsyncLoggerConfig::OverflowPolicy::BLOCK) {
+        pushBlocking(std::move(record));
+    } else if (m_buffer.tryPush(std::move(record))) {
+        notifyPushed();
+    } else {
+        ++m_numDropped;
+        return;
+    }
+    if (isError && m_config.m_isFlushingErrors) {
+        flush();
+    }
+}
+
+void AsyncLogger::pushBlocking(Record&& record) {
+    while (!m_buffer.tryPush(std::move(record))) {
+        wakeUp();
+        std::this_thread::yield();
+    }
+    notifyPushed();
+}
+
+void AsyncLogger::notifyPushed() {
+    // pairs with the fence of the background thread going to sleep, so either it sees the record
+    // or the logging thread sees it sleeping
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_isSleeping.load(std::memory_order_relaxed)) {
+        wakeUp();
+    }
+}
+
+void AsyncLogger::wakeUp() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+    }
+    m_wakeUp.notify_one();
+}
+
+void AsyncLogger::run() {
+    while (true) {
+        size_t numWritten = 0;
+        while (numWritten < MAX_BATCH_SIZE) {
+            auto record = m_buffer.tryPop();
+            if (!record) {
+                break;
+            }
+            write(*record);
+            ++numWritten;
+        }
+        if (numWritten > 0) {
+            reportDropped();
+            m_sink->flush();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_isSleeping.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_buffer.empty()) {
+            if (m_isStopping) {
+                break;
+            }
+            m_wakeUp.wait_for(lock, IDLE_TIMEOUT);
+        }
+        m_isSleeping.store(false, std::memory_order_relaxed);
+    }
+    reportDropped();
+    m_sink->flush();
+}
+
+void AsyncLogger::write(Record& record) {
+    if (record.m_flushed) {
+        reportDropped();
+        m_sink->flush();
+        record.m_flushed->set_value();
+        return;
+    }
+
+    if (record.m_deferred.isValid()) {
+        try {
+            record.m_msg = record.m_deferred.format();
+        } catch (const std::exception& ex) {
+            m_sink->error(fmt::format(R"(Failed to format log message "{}": {})",
+                                      record.m_deferred.getFormat(), ex.what()));
+            return;
+        }
+    }
+    switch (record.m_level) {
+    case LogLevel::DEBUG:
+        m_sink->debug(record.m_msg);
+        break;
+    case LogLevel::INFO:
+        m_sink->info(record.m_msg);
+        break;
+    case LogLevel::WARN:
+        m_sink->warn(record.m_msg);
+        break;
+    case LogLevel::ERROR:
+        m_sink->error(record.m_msg);
+        break;
+    case LogLevel::OFF:
+        break;
+    }
+}
+
+void AsyncLogger::reportDropped() {
+    const size_t numDropped = m_numDropped;
+    if (numDropped > m_numReportedDropped) {
+        m_sink->warn(fmt::format("Log buffer overflow: dropped {} messages",
+                                 numDropped - m_numReportedDropped));
+        m_numReportedDropped = numDropped;
+    }
+}
+
+} // namespace velocitas
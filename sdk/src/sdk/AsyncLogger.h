@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef VEHICLE_APP_SDK_ASYNCLOGGER_H
+#define VEHICLE_APP_SDK_ASYNCLOGGER_H
+
+#include "sdk/Logger.h"
+#include "sdk/RingBuffer.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace velocitas {
+
+/**
+ * @brief Logger passing the messages via a lock-free multi-producer queue to a background thread,
+ * which writes them to the sink in batches and flushes the sink once per batch.
+ *
+ * If deferring, messages logged with a string literal as format message are queued as LogRecord
+ * and formatted by the background thread.
+ *
+ * Flushing enqueues a marker and waits for the background thread to reach it, so it waits for the
+ * messages logged before only, no matter how many are logged concurrently.
+ */
+class AsyncLogger final : public ILogger {
+public:
+    AsyncLogger(std::unique_ptr<ILogger> sink, AsyncLoggerConfig config);
+
+    /**
+     * @brief Writes the buffered messages before stopping the background thread.
+     */
+    ~AsyncLogger() override;
+
+    AsyncLogger(const AsyncLogger&)            = delete;
+    AsyncLogger(AsyncLogger&&)                 = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(AsyncLogger&&)      = delete;
+
+    void info(const std::string& msg) override { log(LogLevel::INFO, msg); }
+    void warn(const std::string& msg) override { log(LogLevel::WARN, msg); }
+    void error(const std::string& msg) override { log(LogLevel::ERROR, msg); }
+    void debug(const std::string& msg) override { log(LogLevel::DEBUG, msg); }
+    void flush() override;
+
+    [[nodiscard]] bool isDeferring() const override { return m_config.m_isDeferringFormatting; }
+    void               logDeferred(LogLevel level, LogRecord&& record) override;
+
+    /** Number of messages dropped because the buffer was full */
+    [[nodiscard]] size_t getNumDropped() const { return m_numDropped; }
+
+private:
+    static constexpr size_t MAX_BATCH_SIZE = 256;
+
+    /** Either a message, formatted or deferred, or a marker to be flushed */
+    struct Record {
+        LogLevel                            m_level;
+        std::string                         m_msg;
+        LogRecord                           m_deferred;
+        std::shared_ptr<std::promise<void>> m_flushed;
+    };
+
+    void log(LogLevel level, const std::string& msg);
+    void push(Record&& record);
+    void pushBlocking(Record&& record);
+    void notifyPushed();
+    void wakeUp();
+    void run();
+    void write(Record& record);
+    void reportDropped();
+
+    std::unique_ptr<ILogger> m_sink;
+    const AsyncLoggerConfig  m_config;
+    RingBuffer<Record>       m_buffer;
+    std::atomic_size_t       m_numDropped{0};
+    size_t                   m_numReportedDropped{0};
+
+    std::mutex              m_mutex;
+    std::condition_variable m_wakeUp;
+    std::atomic_bool        m_isSleeping{false};
+    bool                    m_isStopping{false};
+    std::thread             m_thread;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_ASYNCLOGGER_H
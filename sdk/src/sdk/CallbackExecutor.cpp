@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/CallbackExecutor.h"
+
+#include "sdk/Exceptions.h"
+
+#include <array>
+#include <utility>
+
+namespace velocitas {
+
+CallbackExecutor::CallbackExecutor(CallbackExecution           execution,
+                                   std::shared_ptr<ThreadPool> threadPool, StrandPtr_t strand,
+                                   EventLoopPtr_t eventLoop, JobPriority priority,
+                                   ExecutorPtr_t executor)
+    : m_execution(execution)
+    , m_threadPool(std::move(threadPool))
+    , m_strand(std::move(strand))
+    , m_eventLoop(std::move(eventLoop))
+    , m_priority(priority)
+    , m_executor(std::move(executor)) {}
+
+std::shared_ptr<CallbackExecutor> CallbackExecutor::createInline() {
+    return std::shared_ptr<CallbackExecutor>(
+        new CallbackExecutor(CallbackExecution::INLINE, nullptr, nullptr));
+}
+
+std::shared_ptr<CallbackExecutor> CallbackExecutor::createPool(const std::string& poolName,
+                                                               JobPriority        priority) {
+    return std::shared_ptr<CallbackExecutor>(new CallbackExecutor(
+        CallbackExecution::POOL, ThreadPool::getInstance(poolName), nullptr, nullptr, priority));
+}
+
+const std::shared_ptr<CallbackExecutor>&
+CallbackExecutor::getPriorityInstance(JobPriority priority) {
+    static const std::array<std::shared_ptr<CallbackExecutor>, NUM_JOB_PRIORITIES> instances{
+        createPool(ThreadPool::DEFAULT_POOL, JobPriority::HIGH),
+        createPool(ThreadPool::DEFAULT_POOL, JobPriority::NORMAL),
+        createPool(ThreadPool::DEFAULT_POOL, JobPriority::LOW)};
+    return instances[static_cast<size_t>(priority)];
+}
+
+std::shared_ptr<CallbackExecutor> CallbackExecutor::createStrand(StrandPtr_t strand) {
+    if (!strand) {
+        strand = Strand::create();
+    }
+    auto       threadPool = strand->getThreadPool();
+    const auto priority   = strand->getPriority();
+    return std::shared_ptr<CallbackExecutor>(new CallbackExecutor(
+        CallbackExecution::STRAND, std::move(threadPool), std::move(strand), nullptr, priority));
+}
+
+std::shared_ptr<CallbackExecutor> CallbackExecutor::createEventLoop(EventLoopPtr_t eventLoop) {
+    return std::shared_ptr<CallbackExecutor>(new CallbackExecutor(
+        CallbackExecution::EVENT_LOOP, nullptr, nullptr, std::move(eventLoop)));
+}
+
+std::shared_ptr<CallbackExecutor> CallbackExecutor::createExecutor(ExecutorPtr_t executor) {
+    if (!executor) {
+        throw InvalidValueException("CallbackExecutor needs an executor to post to");
+    }
+    return std::shared_ptr<CallbackExecutor>(
+        new CallbackExecutor(CallbackExecution::EXECUTOR, nullptr, nullptr, nullptr,
+                             JobPriority::NORMAL, std::move(executor)));
+}
+
+void CallbackExecutor::post(JobFunction job, const StrandPtr_t& strand) {
+    if (m_execution == CallbackExecution::EXECUTOR) {
+        m_executor->post(std::move(job));
+    } else if (m_execution == CallbackExecution::EVENT_LOOP) {
+        // the loop keeps the order of all callbacks, so there is no need for the strand
+        m_eventLoop->post(std::move(job));
+    } else if (m_execution == CallbackExecution::STRAND) {
+        m_strand->post(std::move(job));
+    } else if (strand) {
+        strand->post(std::move(job));
+    } else {
+        m_threadPool->post(std::move(job), std::chrono::milliseconds::zero(), m_priority);
+    }
+}
+
+CallbackExecutorMetrics CallbackExecutor::getMetrics() const {
+    CallbackExecutorMetrics metrics;
+    metrics.dispatchLatency = m_dispatchLatency.getSnapshot();
+    metrics.executionTime   = m_executionTime.getSnapshot();
+    return metrics;
+}
+
+void CallbackExecutor::resetMetrics() {
+    m_dispatchLatency.reset();
+    m_executionTime.reset();
+}
+
+} // namespace velocitas
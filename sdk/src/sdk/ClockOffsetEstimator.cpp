@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#include "sdk/ClockOffsetEstimator.h"
+
+#include "sdk/Exceptions.h"
+
+#include <algorithm>
+
+namespace velocitas {
+
+namespace {
+
+constexpr int64_t NANOS_PER_SECOND = 1000000000;
+
+bool isSet(const Timestamp& timestamp) { return timestamp.seconds != 0 || timestamp.nanos != 0; }
+
+int64_t toNanos(const Timestamp& timestamp) {
+    return timestamp.seconds * NANOS_PER_SECOND + timestamp.nanos;
+}
+
+int64_t toNanos(ClockOffsetEstimator::Clock_t::time_point timePoint) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(timePoint.time_since_epoch())
+        .count();
+}
+
+} // namespace
+
+ClockOffsetEstimator::ClockOffsetEstimator(Clock_t::duration window)
+    : m_bucketNanos(std::chrono::duration_cast<std::chrono::nanoseconds>(window).count() /
+                    static_cast<int64_t>(NUM_BUCKETS)) {
+    if (window < std::chrono::milliseconds{1}) {
+        throw InvalidValueException("ClockOffsetEstimator needs a window of at least 1 ms");
+    }
+}
+
+void ClockOffsetEstimator::addRoundTrip(Clock_t::time_point sentAt, const Timestamp& brokerTime,
+                                        Clock_t::time_point receivedAt) {
+    if (!isSet(brokerTime) || receivedAt < sentAt) {
+        return;
+    }
+    addSample(toNanos(brokerTime) - toNanos(receivedAt), toNanos(receivedAt) - toNanos(sentAt),
+              receivedAt);
+}
+
+void ClockOffsetEstimator::addOneWay(const Timestamp& brokerTime, Clock_t::time_point receivedAt) {
+    if (!isSet(brokerTime)) {
+        return;
+    }
+    addSample(toNanos(brokerTime) - toNanos(receivedAt), std::nullopt, receivedAt);
+}
+
+void ClockOffsetEstimator::addSample(int64_t lowerBound, std::optional<int64_t> roundTrip,
+                                     Clock_t::time_point receivedAt) {
+    const auto      index = toNanos(receivedAt) / m_bucketNanos;
+    std::lock_guard lock(m_mutex);
+    ++m_numSamples;
+    // samples of threads delivering late may fall into buckets reused already
+    if (index <= m_latestIndex - static_cast<int64_t>(NUM_BUCKETS)) {
+        return;
+    }
+    m_latestIndex = std::max(m_latestIndex, index);
+    auto& bucket  = m_buckets[static_cast<size_t>(index) % NUM_BUCKETS];
+    if (bucket.index != index) {
+        bucket = Bucket{index, lowerBound, roundTrip};
+        return;
+    }
+    bucket.maxLowerBound = std::max(bucket.maxLowerBound, lowerBound);
+    if (roundTrip && (!bucket.minRoundTrip || *roundTrip < *bucket.minRoundTrip)) {
+        bucket.minRoundTrip = roundTrip;
+    }
+}
+
+std::optional<std::chrono::nanoseconds> ClockOffsetEstimator::getOffset() const {
+    std::optional<int64_t> maxLowerBound;
+    std::optional<int64_t> minRoundTrip;
+    std::lock_guard        lock(m_mutex);
+    for (const auto& bucket : m_buckets) {
+        if (bucket.index < 0 || bucket.index <= m_latestIndex - static_cast<int64_t>(NUM_BUCKETS)) {
+            continue;
+        }
+        if (!maxLowerBound || bucket.maxLowerBound > *maxLowerBound) {
+            maxLowerBound = bucket.maxLowerBound;
+        }
+        if (bucket.minRoundTrip && (!minRoundTrip || *bucket.minRoundTrip < *minRoundTrip)) {
+            minRoundTrip = bucket.minRoundTrip;
+        }
+    }
+    if (!maxLowerBound) {
+        return std::nullopt;
+    }
+    // the least delayed sample took about half of the shortest round trip to arrive
+    return std::chrono::nanoseconds{*maxLowerBound + minRoundTrip.value_or(0) / 2};
+}
+
+std::optional<ClockOffsetEstimator::Clock_t::time_point>
+ClockOffsetEstimator::toLocal(const Timestamp& brokerTime) const {
+    if (!isSet(brokerTime)) {
+        return std::nullopt;
+    }
+    const auto offset = getOffset();
+    if (!offset) {
+        return std::nullopt;
+    }
+    return Clock_t::time_point{std::chrono::duration_cast<Clock_t::duration>(
+        std::chrono::nanoseconds{toNanos(brokerTime)} - *offset)};
+}
+
+std::optional<std::chrono::nanoseconds>
+ClockOffsetEstimator::getLatency(const Timestamp&      brokerTime,
+                                 Clock_t::time_point receivedAt) const {
+    const auto takenAt = toLocal(brokerTime);
+    if (!takenAt) {
+        return std::nullopt;
+    }
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(receivedAt - *takenAt);
+}
+
+uint64_t ClockOffsetEstimator::getNumSamples() const {
+    std::lock_guard lock(m_mutex);
+    return m_numSamples;
+}
+
+} // namespace velocitas
@@ -0,0 +1,523 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/ColumnarBatch.h"
+
+#include "sdk/DataPointReply.h"
+#include "sdk/Exceptions.h"
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace velocitas {
+
+namespace {
+
+constexpr int64_t NANOS_PER_SECOND = 1000000000;
+
+template <typename T> struct TypeTag {
+    using type = T;
+};
+
+template <typename T> struct IsVector : std::false_type {};
+template <typename T> struct IsVector<std::vector<T>> : std::true_type {};
+
+// Calls fun with the TypeTag of the value type of the given data point type. Returns false if
+// the type has no value type (INVALID).
+template <typename TFun> bool visitColumnType(DataPointValue::Type type, TFun&& fun) {
+    switch (type) {
+    case DataPointValue::Type::BOOL:
+        fun(TypeTag<bool>{});
+        return true;
+    case DataPointValue::Type::BOOL_ARRAY:
+        fun(TypeTag<std::vector<bool>>{});
+        return true;
+    case DataPointValue::Type::INT8:
+        fun(TypeTag<int8_t>{});
+        return true;
+    case DataPointValue::Type::INT8_ARRAY:
+        fun(TypeTag<std::vector<int8_t>>{});
+        return true;
+    case DataPointValue::Type::INT16:
+        fun(TypeTag<int16_t>{});
+        return true;
+    case DataPointValue::Type::INT16_ARRAY:
+        fun(TypeTag<std::vector<int16_t>>{});
+        return true;
+    case DataPointValue::Type::INT32:
+        fun(TypeTag<int32_t>{});
+        return true;
+    case DataPointValue::Type::INT32_ARRAY:
+        fun(TypeTag<std::vector<int32_t>>{});
+        return true;
+    case DataPointValue::Type::INT64:
+        fun(TypeTag<int64_t>{});
+        return true;
+    case DataPointValue::Type::INT64_ARRAY:
+        fun(TypeTag<std::vector<int64_t>>{});
+        return true;
+    case DataPointValue::Type::UINT8:
+        fun(TypeTag<uint8_t>{});
+        return true;
+    case DataPointValue::Type::UINT8_ARRAY:
+        fun(TypeTag<std::vector<uint8_t>>{});
+        return true;
+    case DataPointValue::Type::UINT16:
+        fun(TypeTag<uint16_t>{});
+        return true;
+    case DataPointValue::Type::UINT16_ARRAY:
+        fun(TypeTag<std::vector<uint16_t>>{});
+        return true;
+    case DataPointValue::Type::UINT32:
+        fun(TypeTag<uint32_t>{});
+        return true;
+    case DataPointValue::Type::UINT32_ARRAY:
+        fun(TypeTag<std::vector<uint32_t>>{});
+        return true;
+    case DataPointValue::Type::UINT64:
+        fun(TypeTag<uint64_t>{});
+        return true;
+    case DataPointValue::Type::UINT64_ARRAY:
+        fun(TypeTag<std::vector<uint64_t>>{});
+        return true;
+    case DataPointValue::Type::FLOAT:
+        fun(TypeTag<float>{});
+        return true;
+    case DataPointValue::Type::FLOAT_ARRAY:
+        fun(TypeTag<std::vector<float>>{});
+        return true;
+    case DataPointValue::Type::DOUBLE:
+        fun(TypeTag<double>{});
+        return true;
+    case DataPointValue::Type::DOUBLE_ARRAY:
+        fun(TypeTag<std::vector<double>>{});
+        return true;
+    case DataPointValue::Type::STRING:
+        fun(TypeTag<std::string>{});
+        return true;
+    case DataPointValue::Type::STRING_ARRAY:
+        fun(TypeTag<std::vector<std::string>>{});
+        return true;
+    case DataPointValue::Type::INVALID:
+        break;
+    }
+    return false;
+}
+
+void setBit(std::vector<uint8_t>& bitmap, size_t index, bool value) {
+    if (bitmap.size() <= index / 8) {
+        bitmap.resize(index / 8 + 1, 0);
+    }
+    if (value) {
+        bitmap[index / 8] |= static_cast<uint8_t>(1U << (index % 8));
+    }
+}
+
+bool getBit(const std::vector<uint8_t>& bitmap, size_t index) {
+    return (bitmap[index / 8] & (1U << (index % 8))) != 0;
+}
+
+void appendBytes(std::vector<uint8_t>& buffer, const void* data, size_t numBytes) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    buffer.insert(buffer.end(), bytes, bytes + numBytes);
+}
+
+int32_t toOffset(size_t size) {
+    if (size > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+        throw InvalidValueException("Column exceeds the maximum size of its buffers");
+    }
+    return static_cast<int32_t>(size);
+}
+
+// Arrow format strings, see https://arrow.apache.org/docs/format/CDataInterface.html
+template <typename T> const char* getArrowFormat() {
+    if constexpr (std::is_same_v<T, bool>) {
+        return "b";
+    } else if constexpr (std::is_same_v<T, int8_t>) {
+        return "c";
+    } else if constexpr (std::is_same_v<T, uint8_t>) {
+        return "C";
+    } else if constexpr (std::is_same_v<T, int16_t>) {
+        return "s";
+    } else if constexpr (std::is_same_v<T, uint16_t>) {
+        return "S";
+    } else if constexpr (std::is_same_v<T, int32_t>) {
+        return "i";
+    } else if constexpr (std::is_same_v<T, uint32_t>) {
+        return "I";
+    } else if constexpr (std::is_same_v<T, int64_t>) {
+        return "l";
+    } else if constexpr (std::is_same_v<T, uint64_t>) {
+        return "L";
+    } else if constexpr (std::is_same_v<T, float>) {
+        return "f";
+    } else if constexpr (std::is_same_v<T, double>) {
+        return "g";
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return "u";
+    } else {
+        static_assert(IsVector<T>::value, "Unsupported column type!");
+        return "+l";
+    }
+}
+
+// Private data of exported arrays; keeps the exported column alive
+struct ArrowArrayData {
+    std::shared_ptr<const ColumnarBatch::Column> m_column;
+    std::vector<const void*>                     m_buffers;
+    std::vector<ArrowArray*>                     m_children;
+};
+
+void releaseArrowArray(ArrowArray* array) {
+    auto* data = static_cast<ArrowArrayData*>(array->private_data);
+    for (auto* child : data->m_children) {
+        if (child->release != nullptr) {
+            child->release(child);
+        }
+        delete child;
+    }
+    delete data;
+    array->release = nullptr;
+}
+
+void initArrowArray(ArrowArray* array, std::shared_ptr<const ColumnarBatch::Column> column,
+                    size_t length, size_t nullCount, std::vector<const void*> buffers,
+                    std::vector<ArrowArray*> children = {}) {
+    auto* data =
+        new ArrowArrayData{std::move(column), std::move(buffers), std::move(children)};
+    array->length       = static_cast<int64_t>(length);
+    array->null_count   = static_cast<int64_t>(nullCount);
+    array->offset       = 0;
+    array->n_buffers    = static_cast<int64_t>(data->m_buffers.size());
+    array->n_children   = static_cast<int64_t>(data->m_children.size());
+    array->buffers      = data->m_buffers.data();
+    array->children     = data->m_children.empty() ? nullptr : data->m_children.data();
+    array->dictionary   = nullptr;
+    array->release      = &releaseArrowArray;
+    array->private_data = data;
+}
+
+// Private data of exported schemas
+struct ArrowSchemaData {
+    std::string               m_format;
+    std::string               m_name;
+    std::vector<ArrowSchema*> m_children;
+};
+
+void releaseArrowSchema(ArrowSchema* schema) {
+    auto* data = static_cast<ArrowSchemaData*>(schema->private_data);
+    for (auto* child : data->m_children) {
+        if (child->release != nullptr) {
+            child->release(child);
+        }
+        delete child;
+    }
+    delete data;
+    schema->release = nullptr;
+}
+
+void initArrowSchema(ArrowSchema* schema, std::string format, std::string name, int64_t flags,
+                     std::vector<ArrowSchema*> children = {}) {
+    auto* data = new ArrowSchemaData{std::move(format), std::move(name), std::move(children)};
+    schema->format       = data->m_format.c_str();
+    schema->name         = data->m_name.c_str();
+    schema->metadata     = nullptr;
+    schema->flags        = flags;
+    schema->n_children   = static_cast<int64_t>(data->m_children.size());
+    schema->children     = data->m_children.empty() ? nullptr : data->m_children.data();
+    schema->dictionary   = nullptr;
+    schema->release      = &releaseArrowSchema;
+    schema->private_data = data;
+}
+
+} // namespace
+
+ColumnarBatch::Column::Column(SignalHandle_t handle, DataPointValue::Type type)
+    : m_handle(handle)
+    , m_type(DataPointValue::Type::INVALID) {
+    adoptType(type);
+}
+
+const std::string& ColumnarBatch::Column::getPath() const {
+    return SignalPathRegistry::getInstance().getPath(m_handle);
+}
+
+void ColumnarBatch::Column::adoptType(DataPointValue::Type type) {
+    m_type = type;
+    visitColumnType(type, [this](auto tag) {
+        using T = typename decltype(tag)::type;
+        if constexpr (std::is_same_v<T, std::string> || IsVector<T>::value) {
+            m_offsets.assign(1, 0);
+        }
+        if constexpr (std::is_same_v<T, std::vector<std::string>>) {
+            m_elementOffsets.assign(1, 0);
+        }
+    });
+    // rows appended while the type was unknown are null
+    for (size_t row = 0; row < size(); ++row) {
+        appendNullValue();
+    }
+}
+
+void ColumnarBatch::Column::append(const DataPointSample& sample) {
+    if (m_type == DataPointValue::Type::INVALID && sample.isValid()) {
+        adoptType(sample.getType());
+    }
+
+    bool isValid = false;
+    if (sample.isValid()) {
+        visitColumnType(m_type, [this, &sample, &isValid](auto tag) {
+            isValid = appendValue<typename decltype(tag)::type>(sample);
+        });
+    }
+    if (!isValid) {
+        appendNullValue();
+        ++m_nullCount;
+    }
+
+    const auto row = size();
+    setBit(m_validity, row, isValid);
+    const auto& timestamp = sample.getTimestamp();
+    m_timestamps.push_back(timestamp.seconds * NANOS_PER_SECOND + timestamp.nanos);
+}
+
+template <typename T> bool ColumnarBatch::Column::appendValue(const DataPointSample& sample) {
+    if (const auto* value = sample.getIf<T>()) {
+        appendTyped(*value);
+        return true;
+    }
+    if constexpr (!std::is_same_v<T, detail::TransportType_t<T>>) {
+        if (const auto* transported = sample.getIf<detail::TransportType_t<T>>()) {
+            T value{};
+            if (!detail::narrowTransported(*transported, value)) {
+                return false;
+            }
+            appendTyped(value);
+            return true;
+        }
+    }
+    throw InvalidTypeException("Sample does not match the type of column " + getPath());
+}
+
+template <typename T> void ColumnarBatch::Column::appendTyped(const T& value) {
+    if constexpr (std::is_same_v<T, bool>) {
+        setBit(m_values, size(), value);
+    } else if constexpr (std::is_arithmetic_v<T>) {
+        appendBytes(m_values, &value, sizeof(T));
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        m_chars.insert(m_chars.end(), value.begin(), value.end());
+        m_offsets.push_back(toOffset(m_chars.size()));
+    } else {
+        using Element_t         = typename T::value_type;
+        const auto firstElement = static_cast<size_t>(m_offsets.back());
+        if constexpr (std::is_same_v<Element_t, bool>) {
+            for (size_t i = 0; i < value.size(); ++i) {
+                setBit(m_values, firstElement + i, value[i]);
+            }
+        } else if constexpr (std::is_arithmetic_v<Element_t>) {
+            appendBytes(m_values, value.data(), value.size() * sizeof(Element_t));
+        } else {
+            for (const auto& element : value) {
+                m_chars.insert(m_chars.end(), element.begin(), element.end());
+                m_elementOffsets.push_back(toOffset(m_chars.size()));
+            }
+        }
+        m_offsets.push_back(toOffset(firstElement + value.size()));
+    }
+}
+
+void ColumnarBatch::Column::appendNullValue() {
+    visitColumnType(m_type, [this](auto tag) {
+        using T = typename decltype(tag)::type;
+        if constexpr (std::is_same_v<T, bool>) {
+            setBit(m_values, size(), false);
+        } else if constexpr (std::is_arithmetic_v<T>) {
+            m_values.resize(m_values.size() + sizeof(T), 0);
+        } else {
+            m_offsets.push_back(m_offsets.back());
+        }
+    });
+}
+
+template <typename T> T ColumnarBatch::Column::readTyped(size_t row) const {
+    if constexpr (std::is_same_v<T, bool>) {
+        return getBit(m_values, row);
+    } else if constexpr (std::is_arithmetic_v<T>) {
+        T value{};
+        std::memcpy(&value, m_values.data() + row * sizeof(T), sizeof(T));
+        return value;
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return std::string(m_chars.data() + m_offsets[row],
+                           static_cast<size_t>(m_offsets[row + 1] - m_offsets[row]));
+    } else {
+        using Element_t  = typename T::value_type;
+        const auto begin = static_cast<size_t>(m_offsets[row]);
+        const auto end   = static_cast<size_t>(m_offsets[row + 1]);
+        T          value;
+        value.reserve(end - begin);
+        for (auto element = begin; element < end; ++element) {
+            if constexpr (std::is_same_v<Element_t, bool>) {
+                value.push_back(getBit(m_values, element));
+            } else if constexpr (std::is_arithmetic_v<Element_t>) {
+                value.push_back(getValues<Element_t>()[element]);
+            } else {
+                value.emplace_back(
+                    m_chars.data() + m_elementOffsets[element],
+                    static_cast<size_t>(m_elementOffsets[element + 1] - m_elementOffsets[element]));
+            }
+        }
+        return value;
+    }
+}
+
+DataPointSample ColumnarBatch::Column::getSample(size_t row) const {
+    const auto nanos = m_timestamps[row];
+    Timestamp  timestamp{nanos / NANOS_PER_SECOND, static_cast<int32_t>(nanos % NANOS_PER_SECOND)};
+    if (timestamp.nanos < 0) {
+        timestamp.nanos += static_cast<int32_t>(NANOS_PER_SECOND);
+        --timestamp.seconds;
+    }
+
+    DataPointSample sample(m_type, DataPointValue::Failure::NOT_AVAILABLE, timestamp);
+    if (isValid(row)) {
+        visitColumnType(m_type, [this, row, &sample, &timestamp](auto tag) {
+            sample = DataPointSample(readTyped<typename decltype(tag)::type>(row), timestamp);
+        });
+    }
+    return sample;
+}
+
+void ColumnarBatch::Column::clear() {
+    m_nullCount = 0;
+    m_timestamps.clear();
+    m_validity.clear();
+    m_values.clear();
+    m_chars.clear();
+    if (!m_offsets.empty()) {
+        m_offsets.resize(1);
+    }
+    if (!m_elementOffsets.empty()) {
+        m_elementOffsets.resize(1);
+    }
+}
+
+ColumnarBatch::Column& ColumnarBatch::addColumn(SignalHandle_t handle, DataPointValue::Type type) {
+    const auto [iter, isInserted] = m_index.try_emplace(handle, m_columns.size());
+    if (isInserted) {
+        return m_columns.emplace_back(handle, type);
+    }
+
+    auto& column = m_columns[iter->second];
+    if (column.getType() == DataPointValue::Type::INVALID &&
+        type != DataPointValue::Type::INVALID) {
+        column.adoptType(type);
+    }
+    return column;
+}
+
+void ColumnarBatch::append(SignalHandle_t handle, const DataPointSample& sample) {
+    addColumn(handle, DataPointValue::Type::INVALID).append(sample);
+}
+
+void ColumnarBatch::append(const DataPointReply& reply) {
+    for (const auto& entry : reply) {
+        if (entry.m_value || entry.m_lazyValue) {
+            append(entry.m_handle, DataPointReply::getSample(entry));
+        } else {
+            append(entry.m_handle, entry.m_sample);
+        }
+    }
+}
+
+const ColumnarBatch::Column* ColumnarBatch::find(SignalHandle_t handle) const {
+    const auto iter = m_index.find(handle);
+    return iter != m_index.end() ? &m_columns[iter->second] : nullptr;
+}
+
+void ColumnarBatch::clear() {
+    for (auto& column : m_columns) {
+        column.clear();
+    }
+}
+
+void ColumnarBatch::exportToArrow(SignalHandle_t handle, ArrowSchema* schema,
+                                  ArrowArray* array) {
+    const auto iter = m_index.find(handle);
+    if (iter == m_index.end()) {
+        throw InvalidValueException(SignalPathRegistry::getInstance().getPath(handle) +
+                                    " is not contained in batch!");
+    }
+    auto& column = m_columns[iter->second];
+    if (column.getType() == DataPointValue::Type::INVALID) {
+        throw InvalidValueException("Type of " + column.getPath() + " is not known yet!");
+    }
+
+    auto exported = std::make_shared<const Column>(std::move(column));
+    column        = Column(handle, exported->getType());
+
+    auto* valueSchema = new ArrowSchema;
+    auto* valueArray  = new ArrowArray;
+    visitColumnType(exported->getType(), [&exported, valueSchema, valueArray](auto tag) {
+        using T = typename decltype(tag)::type;
+        const void* validity = exported->getValidity().data();
+        if constexpr (std::is_arithmetic_v<T>) {
+            initArrowArray(valueArray, exported, exported->size(), exported->getNullCount(),
+                           {validity, exported->getValueBuffer().data()});
+            initArrowSchema(valueSchema, getArrowFormat<T>(), "value", ARROW_FLAG_NULLABLE);
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            initArrowArray(valueArray, exported, exported->size(), exported->getNullCount(),
+                           {validity, exported->getOffsets().data(),
+                            exported->getCharData().data()});
+            initArrowSchema(valueSchema, getArrowFormat<T>(), "value", ARROW_FLAG_NULLABLE);
+        } else {
+            using Element_t        = typename T::value_type;
+            const auto numElements = static_cast<size_t>(exported->getOffsets().back());
+
+            auto* elementSchema = new ArrowSchema;
+            auto* elementArray  = new ArrowArray;
+            if constexpr (std::is_same_v<Element_t, std::string>) {
+                initArrowArray(elementArray, exported, numElements, 0,
+                               {nullptr, exported->getElementOffsets().data(),
+                                exported->getCharData().data()});
+            } else {
+                initArrowArray(elementArray, exported, numElements, 0,
+                               {nullptr, exported->getValueBuffer().data()});
+            }
+            initArrowSchema(elementSchema, getArrowFormat<Element_t>(), "item", 0);
+
+            initArrowArray(valueArray, exported, exported->size(), exported->getNullCount(),
+                           {validity, exported->getOffsets().data()}, {elementArray});
+            initArrowSchema(valueSchema, getArrowFormat<T>(), "value", ARROW_FLAG_NULLABLE,
+                            {elementSchema});
+        }
+    });
+
+    auto* timestampSchema = new ArrowSchema;
+    auto* timestampArray  = new ArrowArray;
+    initArrowArray(timestampArray, exported, exported->size(), 0,
+                   {nullptr, exported->getTimestamps().data()});
+    initArrowSchema(timestampSchema, "tsn:UTC", "timestamp", 0);
+
+    initArrowArray(array, exported, exported->size(), 0, {nullptr},
+                   {timestampArray, valueArray});
+    initArrowSchema(schema, "+s", exported->getPath(), 0, {timestampSchema, valueSchema});
+}
+
+} // namespace velocitas
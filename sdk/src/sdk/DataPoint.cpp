@@ -26,12 +26,33 @@
 
 namespace velocitas {
 
+void DataPoint::enableHistory(const SignalHistoryConfig& config) const {
+    SignalHistoryStore::getInstance().enable(getSignalHandle(), config);
+}
+
+void DataPoint::disableHistory() const {
+    SignalHistoryStore::getInstance().disable(getSignalHandle());
+}
+
+std::optional<SignalHistoryAggregates> DataPoint::getHistoryAggregates() const {
+    return SignalHistoryStore::getInstance().getAggregates(getSignalHandle());
+}
+
+std::vector<SignalHistorySample> DataPoint::getHistorySamples() const {
+    return SignalHistoryStore::getInstance().getSamples(getSignalHandle());
+}
+
+void DataPoint::enableMirror() const { SignalMirror::getInstance().enable(getSignalHandle()); }
+
+void DataPoint::disableMirror() const { SignalMirror::getInstance().disable(getSignalHandle()); }
+
 template <typename T> AsyncResultPtr_t<TypedDataPointValue<T>> TypedDataPoint<T>::get() const {
     return VehicleModelContext::getInstance()
         .getVdbc()
         ->getDatapoints({getPath()})
-        ->map<TypedDataPointValue<T>>(
-            [this](const DataPointReply& dataPointValues) { return *dataPointValues.get(*this); });
+        ->map<TypedDataPointValue<T>>([this](const DataPointReply& dataPointValues) {
+            return dataPointValues.getSample(getSignalHandle()).template toTypedValue<T>(getPath());
+        });
 }
 
 template <typename T> AsyncResultPtr_t<Status> TypedDataPoint<T>::set(T value) const {
@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/DataPointReply.h"
+
+#include <limits>
+#include <stdexcept>
+
+namespace velocitas {
+
+namespace {
+
+constexpr size_t MIN_NUM_SLOTS = 8;
+
+// keeps the load factor of the table at or below 1/2
+size_t getNumSlotsFor(size_t numEntries) {
+    size_t numSlots = MIN_NUM_SLOTS;
+    while (numSlots < 2 * numEntries) {
+        numSlots *= 2;
+    }
+    return numSlots;
+}
+
+} // namespace
+
+DataPointReply::DataPointReply(DataPointMap_t&& dataPointsMap) {
+    reserve(dataPointsMap.size());
+    for (auto& [path, value] : dataPointsMap) {
+        set(path, std::move(value));
+    }
+}
+
+void DataPointReply::reserve(size_t numDataPoints) {
+    m_entries.reserve(numDataPoints);
+    const auto numSlots = getNumSlotsFor(numDataPoints);
+    if (numSlots > m_slots.size()) {
+        rehash(numSlots);
+    }
+}
+
+void DataPointReply::set(SignalHandle_t handle, std::shared_ptr<DataPointValue> value) {
+    setEntry(Entry{handle, std::move(value), DataPointSample{}, nullptr});
+}
+
+void DataPointReply::set(SignalHandle_t handle, DataPointSample sample) {
+    setEntry(Entry{handle, nullptr, std::move(sample), nullptr});
+}
+
+void DataPointReply::set(SignalHandle_t handle, std::shared_ptr<LazyDataPointValue> value) {
+    setEntry(Entry{handle, nullptr, DataPointSample{}, std::move(value)});
+}
+
+void DataPointReply::setEntry(Entry&& entry) {
+    if (m_slots.size() < getNumSlotsFor(m_entries.size() + 1)) {
+        rehash(getNumSlotsFor(m_entries.size() + 1));
+    }
+    auto& slot = m_slots[findSlot(entry.m_handle)];
+    if (slot != 0) {
+        auto& existingEntry       = m_entries[slot - 1];
+        existingEntry.m_value     = std::move(entry.m_value);
+        existingEntry.m_sample    = std::move(entry.m_sample);
+        existingEntry.m_lazyValue = std::move(entry.m_lazyValue);
+        return;
+    }
+    if (m_entries.size() >= std::numeric_limits<uint32_t>::max()) {
+        throw std::length_error("DataPointReply: too many data points");
+    }
+    m_entries.push_back(std::move(entry));
+    slot = static_cast<uint32_t>(m_entries.size());
+}
+
+bool DataPointReply::erase(SignalHandle_t handle) {
+    if (m_entries.empty()) {
+        return false;
+    }
+    const auto slot = m_slots[findSlot(handle)];
+    if (slot == 0) {
+        return false;
+    }
+    m_entries.erase(m_entries.begin() + (slot - 1));
+    // the entries behind the erased one moved, so their slots are rebuilt
+    rehash(m_slots.size());
+    return true;
+}
+
+const DataPointReply::Entry* DataPointReply::find(SignalHandle_t handle) const {
+    if (m_entries.empty()) {
+        return nullptr;
+    }
+    const auto slot = m_slots[findSlot(handle)];
+    if (slot == 0) {
+        return nullptr;
+    }
+    return &m_entries[slot - 1];
+}
+
+void DataPointReply::merge(DataPointReply&& newerReply) {
+    reserve(m_entries.size() + newerReply.m_entries.size());
+    for (auto& entry : newerReply.m_entries) {
+        setEntry(std::move(entry));
+    }
+    newerReply.m_entries.clear();
+    newerReply.m_slots.clear();
+}
+
+size_t DataPointReply::findSlot(SignalHandle_t handle) const {
+    // handles are dense, so they are distributed well over the slots without hashing
+    const auto mask  = m_slots.size() - 1;
+    auto       index = static_cast<size_t>(handle) & mask;
+    while (m_slots[index] != 0 && m_entries[m_slots[index] - 1].m_handle != handle) {
+        index = (index + 1) & mask;
+    }
+    return index;
+}
+
+void DataPointReply::rehash(size_t numSlots) {
+    m_slots.assign(numSlots, 0);
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        m_slots[findSlot(m_entries[i].m_handle)] = static_cast<uint32_t>(i + 1);
+    }
+}
+
+} // namespace velocitas
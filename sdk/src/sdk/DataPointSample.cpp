@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/DataPointSample.h"
+
+#include "sdk/ArrayConversions.h"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace velocitas {
+
+namespace {
+
+template <typename T> struct TypeTag {
+    using type = T;
+};
+
+template <typename TFun, size_t... INDICES>
+bool visitValueType(DataPointValue::Type type, TFun&& fun,
+                    std::index_sequence<INDICES...> /*indices*/) {
+    // alternative 0 is std::monostate, which has no value type
+    return ((getValueType<std::variant_alternative_t<INDICES + 1, DataPointVariant_t>>() == type &&
+             (fun(TypeTag<std::variant_alternative_t<INDICES + 1, DataPointVariant_t>>{}), true)) ||
+            ...);
+}
+
+// Calls fun with the TypeTag of the alternative of DataPointVariant_t matching the given type.
+// Returns false if there is none.
+template <typename TFun> bool visitValueType(DataPointValue::Type type, TFun&& fun) {
+    return visitValueType(type, std::forward<TFun>(fun),
+                          std::make_index_sequence<std::variant_size_v<DataPointVariant_t> - 1>{});
+}
+
+template <typename TValue>
+std::shared_ptr<DataPointValue> createDataPointValue(const std::string& path, TValue&& value,
+                                                     const Timestamp& timestamp) {
+    using T = std::decay_t<TValue>;
+    if constexpr (std::is_same_v<T, std::monostate>) {
+        return std::make_shared<DataPointValue>(DataPointValue::Type::INVALID, path, timestamp,
+                                                DataPointValue::Failure::INTERNAL_ERROR);
+    } else {
+        return std::make_shared<TypedDataPointValue<T>>(path, std::forward<TValue>(value),
+                                                        timestamp);
+    }
+}
+
+template <typename TWide, typename TNarrow>
+bool narrowArray(const std::vector<TWide>& wide, std::vector<TNarrow>& narrow) {
+    narrow.resize(wide.size());
+    return narrowIntegers(wide.data(), wide.size(), narrow.data()) == 0;
+}
+
+} // namespace
+
+namespace detail {
+
+bool narrowTransported(const std::vector<int32_t>& wide, std::vector<int8_t>& narrow) {
+    return narrowArray(wide, narrow);
+}
+
+bool narrowTransported(const std::vector<int32_t>& wide, std::vector<int16_t>& narrow) {
+    return narrowArray(wide, narrow);
+}
+
+bool narrowTransported(const std::vector<uint32_t>& wide, std::vector<uint8_t>& narrow) {
+    return narrowArray(wide, narrow);
+}
+
+bool narrowTransported(const std::vector<uint32_t>& wide, std::vector<uint16_t>& narrow) {
+    return narrowArray(wide, narrow);
+}
+
+} // namespace detail
+
+std::shared_ptr<DataPointValue>
+DataPointSample::toDataPointValue(const std::string& path) const& {
+    if (!isValid()) {
+        return std::make_shared<DataPointValue>(m_type, path, m_timestamp, m_failure);
+    }
+    return std::visit(
+        [this, &path](const auto& value) { return createDataPointValue(path, value, m_timestamp); },
+        m_value);
+}
+
+std::shared_ptr<DataPointValue> DataPointSample::toDataPointValue(const std::string& path) && {
+    if (!isValid()) {
+        return std::make_shared<DataPointValue>(m_type, path, m_timestamp, m_failure);
+    }
+    return std::visit(
+        [this, &path](auto&& value) {
+            return createDataPointValue(path, std::forward<decltype(value)>(value), m_timestamp);
+        },
+        std::move(m_value));
+}
+
+DataPointSample DataPointSample::fromDataPointValue(const DataPointValue& dataPointValue) {
+    const auto& timestamp = dataPointValue.getTimestamp();
+    if (!dataPointValue.isValid()) {
+        return DataPointSample(dataPointValue.getType(), dataPointValue.getFailure(), timestamp);
+    }
+
+    DataPointSample sample(dataPointValue.getType(), DataPointValue::Failure::INTERNAL_ERROR,
+                           timestamp);
+    visitValueType(dataPointValue.getType(), [&sample, &dataPointValue, &timestamp](auto tag) {
+        using T = typename decltype(tag)::type;
+        // the legacy hierarchy allows untyped values claiming a type, hence the checked cast
+        const auto* typedValue = dynamic_cast<const TypedDataPointValue<T>*>(&dataPointValue);
+        if (typedValue != nullptr) {
+            sample = DataPointSample(typedValue->value(), timestamp);
+        }
+    });
+    return sample;
+}
+
+} // namespace velocitas
@@ -0,0 +1,167 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/EventLoop.h"
+
+#include "sdk/Logger.h"
+
+#include <algorithm>
+#include <exception>
+#include <string>
+#include <utility>
+
+namespace velocitas {
+
+namespace {
+// orders the timer heap by due time, then by the order of posting; the earliest is in front
+template <typename TTimer> bool isLater(const TTimer& left, const TTimer& right) {
+    if (left.m_due != right.m_due) {
+        return left.m_due > right.m_due;
+    }
+    return left.m_sequence > right.m_sequence;
+}
+} // namespace
+
+std::shared_ptr<EventLoop> EventLoop::create() {
+    return std::shared_ptr<EventLoop>(new EventLoop());
+}
+
+void EventLoop::post(JobFunction fun, std::chrono::milliseconds delay) {
+    const auto due = delay > std::chrono::milliseconds::zero() ? Clock_t::now() + delay
+                                                               : Clock_t::time_point{};
+    bool       wasEmpty{false};
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_isStopped) {
+            return;
+        }
+        wasEmpty = m_posted.empty();
+        m_posted.push_back({std::move(fun), due});
+    }
+    // the loop only waits if it has not been notified about earlier functions yet
+    if (wasEmpty) {
+        m_cv.notify_one();
+    }
+}
+
+void EventLoop::run() {
+    m_loopThread = std::this_thread::get_id();
+    while (runIteration(true)) {
+    }
+    m_loopThread = std::thread::id{};
+}
+
+size_t EventLoop::poll() {
+    const auto previousLoopThread = m_loopThread.exchange(std::this_thread::get_id());
+    const auto numExecuted        = runIteration(false);
+    m_loopThread                  = previousLoopThread;
+    return numExecuted.value_or(0);
+}
+
+void EventLoop::stop() {
+    // destroyed outside of the lock, as destroying the functions may post further ones
+    std::vector<Posted> discarded;
+    {
+        std::lock_guard lock(m_mutex);
+        m_isStopped = true;
+        std::swap(discarded, m_posted);
+    }
+    m_cv.notify_all();
+}
+
+bool EventLoop::isStopped() const {
+    std::lock_guard lock(m_mutex);
+    return m_isStopped;
+}
+
+bool EventLoop::isInLoopThread() const { return m_loopThread.load() == std::this_thread::get_id(); }
+
+size_t EventLoop::getNumPendingFunctions() const {
+    std::lock_guard lock(m_mutex);
+    return m_posted.size() + m_numTimers.load();
+}
+
+EventLoopMetrics EventLoop::getMetrics() const {
+    EventLoopMetrics metrics;
+    metrics.batchSize          = m_batchSize.getSnapshot();
+    metrics.numFailedFunctions = m_numFailedFunctions.load(std::memory_order_relaxed);
+    return metrics;
+}
+
+std::optional<size_t> EventLoop::runIteration(bool isWaiting) {
+    {
+        std::unique_lock lock(m_mutex);
+        if (isWaiting) {
+            const auto hasWorkToDo = [this] { return !m_posted.empty() || m_isStopped; };
+            if (m_timers.empty()) {
+                m_cv.wait(lock, hasWorkToDo);
+            } else {
+                m_cv.wait_until(lock, m_timers.front().m_due, hasWorkToDo);
+            }
+        }
+        if (m_isStopped) {
+            return std::nullopt;
+        }
+        // the vectors are swapped instead of moved, so both keep their capacity
+        std::swap(m_posted, m_batch);
+    }
+
+    const auto now         = Clock_t::now();
+    size_t     numExecuted = 0;
+    for (auto& posted : m_batch) {
+        if (posted.m_due > now) {
+            addTimer(posted);
+        } else {
+            execute(posted.m_fun);
+            ++numExecuted;
+        }
+    }
+    m_batch.clear();
+
+    while (!m_timers.empty() && m_timers.front().m_due <= now) {
+        std::pop_heap(m_timers.begin(), m_timers.end(), isLater<Timer>);
+        auto fun = std::move(m_timers.back().m_fun);
+        m_timers.pop_back();
+        m_numTimers.fetch_sub(1);
+        execute(fun);
+        ++numExecuted;
+    }
+
+    if (numExecuted > 0) {
+        m_batchSize.record(numExecuted);
+    }
+    return numExecuted;
+}
+
+void EventLoop::addTimer(Posted& posted) {
+    m_timers.push_back({posted.m_due, m_nextTimerSequence++, std::move(posted.m_fun)});
+    std::push_heap(m_timers.begin(), m_timers.end(), isLater<Timer>);
+    m_numTimers.fetch_add(1);
+}
+
+void EventLoop::execute(JobFunction& fun) {
+    try {
+        fun();
+    } catch (const std::exception& e) {
+        m_numFailedFunctions.fetch_add(1, std::memory_order_relaxed);
+        logger().error("[EventLoop] Uncaught exception during execution: " + std::string(e.what()));
+    } catch (...) {
+        m_numFailedFunctions.fetch_add(1, std::memory_order_relaxed);
+        logger().error(std::string("[EventLoop] Uncaught unknown exception during execution"));
+    }
+}
+
+} // namespace velocitas
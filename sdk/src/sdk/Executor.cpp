@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#include "sdk/Executor.h"
+
+#include "sdk/Exceptions.h"
+#include "sdk/ThreadPool.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace velocitas {
+
+namespace {
+
+// the pools and event loops schedule with a resolution of milliseconds; rounding up never runs
+// a function before its time
+std::chrono::milliseconds getDelayUntil(IExecutor::Clock_t::time_point timepoint) {
+    const auto delay =
+        std::chrono::ceil<std::chrono::milliseconds>(timepoint - IExecutor::Clock_t::now());
+    return std::max(delay, std::chrono::milliseconds::zero());
+}
+
+class ThreadPoolExecutor final : public IExecutor {
+public:
+    ThreadPoolExecutor(std::shared_ptr<ThreadPool> threadPool, JobPriority priority)
+        : m_threadPool(std::move(threadPool))
+        , m_priority(priority) {}
+
+    void post(JobFunction fun) override {
+        m_threadPool->post(std::move(fun), std::chrono::milliseconds::zero(), m_priority);
+    }
+
+    void scheduleAt(Clock_t::time_point timepoint, JobFunction fun) override {
+        m_threadPool->post(std::move(fun), getDelayUntil(timepoint), m_priority);
+    }
+
+    void postBatch(std::vector<JobFunction> funs) override {
+        std::vector<JobPtr_t> jobs;
+        jobs.reserve(funs.size());
+        for (auto& fun : funs) {
+            auto job = LightJob::create(std::move(fun));
+            job->setPriority(m_priority);
+            jobs.push_back(std::move(job));
+        }
+        m_threadPool->enqueueBatch(std::move(jobs));
+    }
+
+private:
+    const std::shared_ptr<ThreadPool> m_threadPool;
+    const JobPriority                 m_priority;
+};
+
+class StrandExecutor final : public IExecutor {
+public:
+    explicit StrandExecutor(StrandPtr_t strand)
+        : m_strand(std::move(strand)) {}
+
+    void post(JobFunction fun) override { m_strand->post(std::move(fun)); }
+
+    void scheduleAt(Clock_t::time_point timepoint, JobFunction fun) override {
+        // the strand has no timers, so the function is handed to it once it is due
+        m_strand->getThreadPool()->post(
+            [strand = m_strand, fun = std::move(fun)]() mutable { strand->post(std::move(fun)); },
+            getDelayUntil(timepoint), m_strand->getPriority());
+    }
+
+private:
+    const StrandPtr_t m_strand;
+};
+
+class EventLoopExecutor final : public IExecutor {
+public:
+    explicit EventLoopExecutor(EventLoopPtr_t eventLoop)
+        : m_eventLoop(std::move(eventLoop)) {}
+
+    void post(JobFunction fun) override { m_eventLoop->post(std::move(fun)); }
+
+    void scheduleAt(Clock_t::time_point timepoint, JobFunction fun) override {
+        m_eventLoop->post(std::move(fun), getDelayUntil(timepoint));
+    }
+
+private:
+    const EventLoopPtr_t m_eventLoop;
+};
+
+} // namespace
+
+std::shared_ptr<IExecutor> IExecutor::createThreadPool(std::shared_ptr<ThreadPool> threadPool,
+                                                       JobPriority                 priority) {
+    if (!threadPool) {
+        threadPool = ThreadPool::getInstance();
+    }
+    return std::make_shared<ThreadPoolExecutor>(std::move(threadPool), priority);
+}
+
+std::shared_ptr<IExecutor> IExecutor::createStrand(StrandPtr_t strand) {
+    if (!strand) {
+        strand = Strand::create();
+    }
+    return std::make_shared<StrandExecutor>(std::move(strand));
+}
+
+std::shared_ptr<IExecutor> IExecutor::createEventLoop(EventLoopPtr_t eventLoop) {
+    if (!eventLoop) {
+        throw InvalidValueException("EventLoop executor needs an event loop");
+    }
+    return std::make_shared<EventLoopExecutor>(std::move(eventLoop));
+}
+
+} // namespace velocitas
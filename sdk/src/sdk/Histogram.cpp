@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/Histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace velocitas {
+
+size_t Histogram::getBucketIndex(uint64_t value) noexcept {
+    if (value == 0) {
+        return 0;
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(64 - __builtin_clzll(value));
+#else
+    size_t index = 0;
+    while (value != 0) {
+        value >>= 1U;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+void Histogram::record(uint64_t value) noexcept {
+    m_buckets[getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+
+    auto currentMin = m_min.load(std::memory_order_relaxed);
+    while (value < currentMin &&
+           !m_min.compare_exchange_weak(currentMin, value, std::memory_order_relaxed)) {
+    }
+    auto currentMax = m_max.load(std::memory_order_relaxed);
+    while (value > currentMax &&
+           !m_max.compare_exchange_weak(currentMax, value, std::memory_order_relaxed)) {
+    }
+}
+
+HistogramSnapshot Histogram::getSnapshot() const noexcept {
+    HistogramSnapshot snapshot;
+    for (size_t i = 0; i < HistogramSnapshot::NUM_BUCKETS; ++i) {
+        snapshot.buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+        snapshot.count += snapshot.buckets[i];
+    }
+    snapshot.sum = m_sum.load(std::memory_order_relaxed);
+    snapshot.max = m_max.load(std::memory_order_relaxed);
+    snapshot.min = (snapshot.count > 0) ? m_min.load(std::memory_order_relaxed) : 0;
+    return snapshot;
+}
+
+void Histogram::reset() noexcept {
+    for (auto& bucket : m_buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    m_sum.store(0, std::memory_order_relaxed);
+    m_min.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+}
+
+uint64_t HistogramSnapshot::getPercentile(double percentile) const {
+    if (count == 0) {
+        return 0;
+    }
+    const auto rank = static_cast<uint64_t>(
+        std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * static_cast<double>(count)));
+    uint64_t numValuesSeen = 0;
+    for (size_t i = 0; i < NUM_BUCKETS; ++i) {
+        numValuesSeen += buckets[i];
+        if (numValuesSeen >= std::max<uint64_t>(rank, 1)) {
+            if (i == 0) {
+                return 0;
+            }
+            const auto upperBound = (i >= 64) ? std::numeric_limits<uint64_t>::max()
+                                              : (uint64_t{1} << i) - 1;
+            return std::clamp(upperBound, min, max);
+        }
+    }
+    return max;
+}
+
+} // namespace velocitas
@@ -15,6 +15,15 @@
  */
 
 #include "sdk/Job.h"
+#include "sdk/BuildProfile.h"
+#include "sdk/Exceptions.h"
+#include "sdk/Logger.h"
+#include "sdk/Utils.h"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace velocitas {
 
@@ -29,6 +38,138 @@ Job::Job(std::function<void()> fun, std::chrono::milliseconds delay)
     }
 }
 
+namespace {
+
+/**
+ * @brief Thread-safe pool of equally sized memory blocks, growing in slabs.
+ *
+ * The initial number of blocks is taken from the env var SDV_JOB_POOL_SIZE, so the pool can be
+ * sized at startup instead of growing while the app is running.
+ */
+class BlockPool {
+public:
+    static constexpr size_t BLOCK_SIZE      = 192;
+    static constexpr size_t BLOCKS_PER_SLAB = PROFILE_JOB_POOL_GROWTH;
+
+    static BlockPool& getInstance() {
+        // intentionally leaked: jobs may still be alive during destruction of static objects
+        static auto* instance = new BlockPool();
+        return *instance;
+    }
+
+    BlockPool() {
+        const auto poolSize = getEnvVar("SDV_JOB_POOL_SIZE");
+        if (!poolSize.empty()) {
+            try {
+                reserve(std::stoul(poolSize));
+            } catch (const std::exception& e) {
+                logger().warn("[LightJob] Cannot reserve SDV_JOB_POOL_SIZE '{}' jobs: {}",
+                              poolSize, e.what());
+            }
+        }
+    }
+
+    void* allocate() {
+        std::lock_guard lock{m_mutex};
+        if (m_freeList == nullptr) {
+            addSlab(BLOCKS_PER_SLAB);
+        }
+        auto* block = m_freeList;
+        m_freeList  = block->next;
+        return block;
+    }
+
+    void deallocate(void* pointer) noexcept {
+        std::lock_guard lock{m_mutex};
+        auto*           block = static_cast<FreeBlock*>(pointer);
+        block->next           = m_freeList;
+        m_freeList            = block;
+    }
+
+    void reserve(size_t numBlocks) {
+        std::lock_guard lock{m_mutex};
+        if (numBlocks > m_numBlocks) {
+            addSlab(numBlocks - m_numBlocks);
+        }
+    }
+
+    [[nodiscard]] size_t getNumBlocks() const {
+        std::lock_guard lock{m_mutex};
+        return m_numBlocks;
+    }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    union alignas(std::max_align_t) Block {
+        FreeBlock     freeBlock;
+        unsigned char storage[BLOCK_SIZE];
+    };
+
+    void addSlab(size_t numBlocks) {
+        if constexpr (IS_ALLOCATION_TRACKING_ENABLED) {
+            AllocationTracker::checkLimit(AllocationDomain::JOBS, sizeof(Block) * numBlocks);
+        }
+        m_slabs.push_back(std::make_unique<Block[]>(numBlocks));
+        if constexpr (IS_ALLOCATION_TRACKING_ENABLED) {
+            // slabs are kept until the end of the process, so they are never deallocated
+            AllocationTracker::recordAllocation(AllocationDomain::JOBS, sizeof(Block) * numBlocks);
+        }
+        auto* slab = m_slabs.back().get();
+        for (size_t i = 0; i < numBlocks; ++i) {
+            slab[i].freeBlock.next = m_freeList;
+            m_freeList             = &slab[i].freeBlock;
+        }
+        m_numBlocks += numBlocks;
+    }
+
+    mutable std::mutex                    m_mutex;
+    FreeBlock*                            m_freeList{nullptr};
+    size_t                                m_numBlocks{0};
+    std::vector<std::unique_ptr<Block[]>> m_slabs;
+};
+
+/**
+ * @brief Allocator serving single objects fitting into a pool block from the BlockPool.
+ */
+template <typename T> class PoolAllocator {
+public:
+    using value_type = T;
+
+    PoolAllocator() noexcept = default;
+    template <typename U> PoolAllocator(const PoolAllocator<U>& /*other*/) noexcept {}
+
+    T* allocate(size_t count) {
+        // T is the node of allocate_shared, i.e. control block and LightJob together; if it grew
+        // beyond a block, every job would silently be allocated from the heap again
+        static_assert(sizeof(T) <= BlockPool::BLOCK_SIZE && alignof(T) <= alignof(std::max_align_t),
+                      "The shared_ptr node of a LightJob needs to fit into a pool block");
+        if (count == 1) {
+            return static_cast<T*>(BlockPool::getInstance().allocate());
+        }
+        return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, size_t count) noexcept {
+        if (count == 1) {
+            BlockPool::getInstance().deallocate(pointer);
+        } else {
+            ::operator delete(pointer);
+        }
+    }
+
+    template <typename U> bool operator==(const PoolAllocator<U>& /*other*/) const noexcept {
+        return true;
+    }
+    template <typename U> bool operator!=(const PoolAllocator<U>& /*other*/) const noexcept {
+        return false;
+    }
+};
+
+} // namespace
+
 void Job::waitForTermination() const { std::lock_guard lock(m_terminationMutex); }
 
 void Job::execute() {
@@ -36,10 +177,86 @@ void Job::execute() {
     m_fun();
 }
 
+void LightJob::reservePool(size_t numJobs) { BlockPool::getInstance().reserve(numJobs); }
+
+size_t LightJob::getPoolSize() { return BlockPool::getInstance().getNumBlocks(); }
+
+JobPtr_t LightJob::create(JobFunction fun, std::chrono::milliseconds delay) {
+    return std::allocate_shared<LightJob>(PoolAllocator<LightJob>(), std::move(fun), delay);
+}
+
+LightJob::LightJob(JobFunction fun, std::chrono::milliseconds delay)
+    : m_fun(std::move(fun)) {
+    if (delay > std::chrono::milliseconds::zero()) {
+        m_timepointToExecute = Clock::now() + delay;
+    }
+}
+
+void LightJob::execute() {
+    if (m_fun) {
+        m_fun();
+    }
+}
+
 void RecurringJob::execute() {
     if (!m_isCancelled) {
         Job::execute();
     }
 }
 
+PeriodicJob::PeriodicJob(std::function<void()> fun, std::chrono::milliseconds period,
+                         MissedTickPolicy policy)
+    : RecurringJob(std::move(fun))
+    , m_period(period)
+    , m_policy(policy)
+    , m_start(Clock::now()) {
+    if (m_period <= std::chrono::milliseconds::zero()) {
+        throw InvalidValueException("Period of a PeriodicJob must be greater than zero");
+    }
+    m_nextDeadline = getDeadlineOfTick(m_nextTick);
+}
+
+void PeriodicJob::execute() {
+    if (isCancelled()) {
+        return;
+    }
+
+    const auto jitter = std::max(Clock::now() - getDeadlineOfTick(m_nextTick), Clock::duration{});
+    RecurringJob::execute();
+    const auto now = Clock::now();
+
+    ++m_nextTick;
+    size_t numMissedTicks = 0;
+    if (getDeadlineOfTick(m_nextTick) <= now) {
+        const auto numTicksPassed =
+            static_cast<int64_t>((now - getDeadlineOfTick(m_nextTick)) / m_period) + 1;
+        switch (m_policy) {
+        case MissedTickPolicy::SKIP:
+            m_nextTick += numTicksPassed;
+            numMissedTicks = numTicksPassed;
+            break;
+        case MissedTickPolicy::COALESCE:
+            m_nextTick += numTicksPassed - 1;
+            numMissedTicks = numTicksPassed - 1;
+            break;
+        case MissedTickPolicy::CATCH_UP:
+        default:
+            break;
+        }
+    }
+    m_nextDeadline = getDeadlineOfTick(m_nextTick);
+
+    std::lock_guard lock(m_statisticsMutex);
+    ++m_statistics.numExecutions;
+    m_statistics.numMissedTicks += numMissedTicks;
+    m_statistics.minJitter = std::min<std::chrono::nanoseconds>(m_statistics.minJitter, jitter);
+    m_statistics.maxJitter = std::max<std::chrono::nanoseconds>(m_statistics.maxJitter, jitter);
+    m_statistics.totalJitter += jitter;
+}
+
+JitterStatistics PeriodicJob::getJitterStatistics() const {
+    std::lock_guard lock(m_statisticsMutex);
+    return m_statistics;
+}
+
 } // namespace velocitas
@@ -0,0 +1,75 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/LatencyTracer.h"
+
+#include <algorithm>
+
+namespace velocitas {
+
+namespace {
+
+void recordBetween(Histogram& histogram, const LatencyTrace& trace, LatencyStage from,
+                   LatencyStage to) {
+    if (!trace.isStamped(from) || !trace.isStamped(to)) {
+        return;
+    }
+    const auto duration = trace.stamps[static_cast<size_t>(to)] -
+                          trace.stamps[static_cast<size_t>(from)];
+    histogram.record(static_cast<uint64_t>(
+        std::max<int64_t>(0, std::chrono::nanoseconds(duration).count())));
+}
+
+} // namespace
+
+void LatencyTracer::record(const LatencyTrace& trace) noexcept {
+    m_numTracedUpdates.fetch_add(1, std::memory_order_relaxed);
+    if (trace.brokerLatency) {
+        // clock skew between databroker and app may make it negative
+        m_brokerLatency.record(
+            static_cast<uint64_t>(std::max<int64_t>(0, trace.brokerLatency->count())));
+    }
+    recordBetween(m_decodeLatency, trace, LatencyStage::STREAM_READ, LatencyStage::DECODED);
+    recordBetween(m_enqueueLatency, trace, LatencyStage::DECODED, LatencyStage::ENQUEUED);
+    recordBetween(m_dispatchLatency, trace, LatencyStage::ENQUEUED, LatencyStage::CALLBACK_START);
+    recordBetween(m_executionTime, trace, LatencyStage::CALLBACK_START, LatencyStage::CALLBACK_END);
+    recordBetween(m_totalLatency, trace, LatencyStage::STREAM_READ, LatencyStage::CALLBACK_END);
+}
+
+LatencyMetrics LatencyTracer::getMetrics() const noexcept {
+    LatencyMetrics metrics;
+    metrics.numUpdates       = m_numUpdates.load(std::memory_order_relaxed);
+    metrics.numTracedUpdates = m_numTracedUpdates.load(std::memory_order_relaxed);
+    metrics.brokerLatency    = m_brokerLatency.getSnapshot();
+    metrics.decodeLatency    = m_decodeLatency.getSnapshot();
+    metrics.enqueueLatency   = m_enqueueLatency.getSnapshot();
+    metrics.dispatchLatency  = m_dispatchLatency.getSnapshot();
+    metrics.executionTime    = m_executionTime.getSnapshot();
+    metrics.totalLatency     = m_totalLatency.getSnapshot();
+    return metrics;
+}
+
+void LatencyTracer::reset() noexcept {
+    m_numUpdates.store(0, std::memory_order_relaxed);
+    m_numTracedUpdates.store(0, std::memory_order_relaxed);
+    m_brokerLatency.reset();
+    m_decodeLatency.reset();
+    m_enqueueLatency.reset();
+    m_dispatchLatency.reset();
+    m_executionTime.reset();
+    m_totalLatency.reset();
+}
+
+} // namespace velocitas
@@ -0,0 +1,54 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/LazyDataPoint.h"
+
+namespace velocitas {
+
+const DataPointSample& LazySample::get() const {
+    std::call_once(m_decodeFlag, [this]() {
+        m_sample = m_decoder(m_source.get());
+        // the source is not needed anymore, which may release the message containing it
+        m_source.reset();
+    });
+    return m_sample;
+}
+
+std::shared_ptr<DataPointValue> LazyDataPointValue::get(const std::string& path) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_value) {
+        m_value = m_sample->get().toDataPointValue(path);
+        if (!m_wasUpdated) {
+            m_value->clearUpdateStatus();
+        }
+    }
+    return m_value;
+}
+
+bool LazyDataPointValue::wasUpdated() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_value ? m_value->wasUpdated() : m_wasUpdated;
+}
+
+void LazyDataPointValue::clearUpdateStatus() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_wasUpdated = false;
+    if (m_value) {
+        m_value->clearUpdateStatus();
+    }
+}
+
+} // namespace velocitas
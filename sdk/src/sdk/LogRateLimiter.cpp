@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/LogRateLimiter.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace velocitas {
+
+namespace {
+// 2^64 divided by the golden ratio (Fibonacci hashing)
+constexpr uint64_t HASH_MULTIPLIER = 0x9e3779b97f4a7c15;
+} // namespace
+
+LogRateLimiter::LogRateLimiter(LogRateLimitConfig config)
+    : m_config{config} {}
+
+LogRateLimiter::Site* LogRateLimiter::findSite(const char* format) {
+    // the format strings are aligned, hence their addresses are mixed before picking the slot
+    const size_t start = static_cast<size_t>(
+        (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(format)) * HASH_MULTIPLIER) >> 32U);
+    for (size_t i = 0; i < MAX_PROBE_LENGTH; ++i) {
+        Site&       site     = m_sites[(start + i) % MAX_NUM_SITES];
+        const char* occupant = site.m_format.load(std::memory_order_acquire);
+        if (occupant == nullptr &&
+            site.m_format.compare_exchange_strong(occupant, format, std::memory_order_acq_rel)) {
+            return &site;
+        }
+        if (occupant == format) {
+            return &site;
+        }
+    }
+    return nullptr;
+}
+
+bool LogRateLimiter::tryAcquire(const char* format, uint64_t& numSuppressed,
+                                Clock_t::time_point now) {
+    Site* const site = findSite(format);
+    if (site == nullptr) {
+        numSuppressed = 0;
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(site->m_mutex);
+    if (!site->m_isInitialized) {
+        site->m_isInitialized = true;
+        site->m_tokens        = m_config.m_burst;
+        site->m_lastRefill    = now;
+    } else if (now > site->m_lastRefill) {
+        const std::chrono::duration<double> elapsed = now - site->m_lastRefill;
+        site->m_tokens =
+            std::min(m_config.m_burst, site->m_tokens + elapsed.count() * m_config.m_ratePerSecond);
+        site->m_lastRefill = now;
+    }
+
+    if (site->m_tokens < 1.0) {
+        ++site->m_numPendingSuppressed;
+        site->m_numSuppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    site->m_tokens -= 1.0;
+    numSuppressed                = site->m_numPendingSuppressed;
+    site->m_numPendingSuppressed = 0;
+    return true;
+}
+
+LoggerMetrics LogRateLimiter::getMetrics() const {
+    LoggerMetrics metrics;
+    for (const auto& site : m_sites) {
+        const auto numSuppressed = site.m_numSuppressed.load(std::memory_order_relaxed);
+        if (numSuppressed > 0) {
+            metrics.numSuppressed += numSuppressed;
+            metrics.sites.push_back({site.m_format.load(std::memory_order_acquire), numSuppressed});
+        }
+    }
+    std::sort(metrics.sites.begin(), metrics.sites.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.numSuppressed > rhs.numSuppressed;
+    });
+    return metrics;
+}
+
+} // namespace velocitas
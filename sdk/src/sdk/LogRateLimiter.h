@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef VEHICLE_APP_SDK_LOGRATELIMITER_H
+#define VEHICLE_APP_SDK_LOGRATELIMITER_H
+
+#include "sdk/Logger.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace velocitas {
+
+/**
+ * @brief Token buckets of the logging call sites, identified by the address of their format
+ * message (a string literal).
+ *
+ * The sites are kept in a fixed size open addressing table, whose slots are claimed lock-free;
+ * each bucket has its own mutex, so only messages of the same site contend. Sites not fitting
+ * into the table are not limited.
+ */
+class LogRateLimiter final {
+public:
+    using Clock_t = std::chrono::steady_clock;
+
+    explicit LogRateLimiter(LogRateLimitConfig config);
+
+    /**
+     * @brief Take a token of the site.
+     *
+     * @param format         The format message identifying the site.
+     * @param numSuppressed  Set to the number of messages of the site suppressed since the last
+     *                       granted one, if granted.
+     * @return true if the message may be logged, false if it is suppressed.
+     */
+    bool tryAcquire(const char* format, uint64_t& numSuppressed, Clock_t::time_point now);
+
+    bool tryAcquire(const char* format, uint64_t& numSuppressed) {
+        return tryAcquire(format, numSuppressed, Clock_t::now());
+    }
+
+    [[nodiscard]] LoggerMetrics getMetrics() const;
+
+private:
+    static constexpr size_t MAX_NUM_SITES = 1024;
+    // slots probed for a call site; a site not found within them is not limited, so logging
+    // from a crowded table stays cheap
+    static constexpr size_t MAX_PROBE_LENGTH = 16;
+
+    struct Site {
+        std::atomic<const char*> m_format{nullptr};
+        std::mutex               m_mutex;
+        bool                     m_isInitialized{false};
+        double                   m_tokens{0.0};
+        Clock_t::time_point      m_lastRefill;
+        uint64_t                 m_numPendingSuppressed{0};
+        std::atomic<uint64_t>    m_numSuppressed{0};
+    };
+
+    Site* findSite(const char* format);
+
+    const LogRateLimitConfig        m_config;
+    std::array<Site, MAX_NUM_SITES> m_sites;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_LOGRATELIMITER_H
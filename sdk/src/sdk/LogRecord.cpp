@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/LogRecord.h"
+
+#include <fmt/args.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace velocitas {
+
+LogRecord::LogRecord(LogRecord&& other) noexcept
+    : m_format{other.m_format}
+    , m_size{other.m_size}
+    , m_heap{std::move(other.m_heap)}
+    , m_heapCapacity{other.m_heapCapacity} {
+    if (!m_heap) {
+        std::memcpy(m_inline.data(), other.m_inline.data(), m_size);
+    }
+    other.m_format       = nullptr;
+    other.m_size         = 0;
+    other.m_heapCapacity = 0;
+}
+
+LogRecord& LogRecord::operator=(LogRecord&& other) noexcept {
+    if (this != &other) {
+        m_format       = other.m_format;
+        m_size         = other.m_size;
+        m_heap         = std::move(other.m_heap);
+        m_heapCapacity = other.m_heapCapacity;
+        if (!m_heap) {
+            std::memcpy(m_inline.data(), other.m_inline.data(), m_size);
+        }
+        other.m_format       = nullptr;
+        other.m_size         = 0;
+        other.m_heapCapacity = 0;
+    }
+    return *this;
+}
+
+void LogRecord::appendString(std::string_view str) {
+    const auto size = static_cast<uint32_t>(str.size());
+    appendValue(ArgType::STRING, size);
+    appendBytes(str.data(), size);
+}
+
+void LogRecord::appendBytes(const void* bytes, size_t size) {
+    const size_t requiredSize = m_size + size;
+    if (!m_heap && requiredSize > INLINE_CAPACITY) {
+        m_heapCapacity = std::max(2 * INLINE_CAPACITY, requiredSize);
+        m_heap         = std::make_unique<std::byte[]>(m_heapCapacity);
+        std::memcpy(m_heap.get(), m_inline.data(), m_size);
+    } else if (m_heap && requiredSize > m_heapCapacity) {
+        m_heapCapacity = std::max(2 * m_heapCapacity, requiredSize);
+        auto heap      = std::make_unique<std::byte[]>(m_heapCapacity);
+        std::memcpy(heap.get(), m_heap.get(), m_size);
+        m_heap = std::move(heap);
+    }
+    std::memcpy((m_heap ? m_heap.get() : m_inline.data()) + m_size, bytes, size);
+    m_size = requiredSize;
+}
+
+namespace {
+
+template <typename T> T read(const std::byte*& position) {
+    T value;
+    std::memcpy(&value, position, sizeof(value));
+    position += sizeof(value);
+    return value;
+}
+
+} // namespace
+
+std::string LogRecord::format() const {
+    if (m_size == 0) {
+        return m_format;
+    }
+
+    fmt::dynamic_format_arg_store<fmt::format_context> args;
+    const std::byte*                                   position = data();
+    const std::byte* const                             end      = position + m_size;
+    while (position < end) {
+        switch (read<ArgType>(position)) {
+        case ArgType::BOOL:
+            args.push_back(read<bool>(position));
+            break;
+        case ArgType::CHAR:
+            args.push_back(read<char>(position));
+            break;
+        case ArgType::INT:
+            args.push_back(read<int64_t>(position));
+            break;
+        case ArgType::UINT:
+            args.push_back(read<uint64_t>(position));
+            break;
+        case ArgType::FLOAT:
+            args.push_back(read<float>(position));
+            break;
+        case ArgType::DOUBLE:
+            args.push_back(read<double>(position));
+            break;
+        case ArgType::STRING: {
+            const auto size = read<uint32_t>(position);
+            // the view refers to the record, which outlives the formatting
+            args.push_back(std::string_view(reinterpret_cast<const char*>(position), size));
+            position += size;
+            break;
+        }
+        }
+    }
+    return fmt::vformat(m_format, args);
+}
+
+} // namespace velocitas
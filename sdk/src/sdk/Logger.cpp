@@ -16,8 +16,13 @@
 
 #include "sdk/Logger.h"
 
+#include "sdk/AsyncLogger.h"
+#include "sdk/LogRateLimiter.h"
+#include "sdk/Utils.h"
+
 #include <chrono>
 #include <cstdio>
+#include <stdexcept>
 #include <fmt/chrono.h>
 #include <fmt/color.h>
 
@@ -29,6 +34,13 @@ namespace velocitas {
  */
 class ConsoleLogger : public ILogger {
 public:
+    /**
+     * @param isFlushingEachMessage  Whether stdout is flushed after each message; otherwise it is
+     *                               flushed by flush() only.
+     */
+    explicit ConsoleLogger(bool isFlushingEachMessage = true)
+        : m_isFlushingEachMessage{isFlushingEachMessage} {}
+
     void info(const std::string& msg) override { log("INFO ", fmt::color::white, msg); }
 
     void warn(const std::string& msg) override { log("WARN ", fmt::color::yellow, msg); }
@@ -37,14 +49,109 @@ public:
 
     void debug(const std::string& msg) override { log("DEBUG", fmt::color::brown, msg); }
 
+    void flush() override { std::fflush(stdout); }
+
 private:
     void log(const std::string& level, fmt::color color, const std::string& msg) {
         fmt::print(fmt::fg(color), "{}, {} : {}\n", std::chrono::system_clock::now(), level, msg);
-        std::fflush(stdout);
+        if (m_isFlushingEachMessage) {
+            std::fflush(stdout);
+        }
     }
+
+    bool m_isFlushingEachMessage;
 };
 
+void ILogger::logDeferred(LogLevel level, LogRecord&& record) {
+    switch (level) {
+    case LogLevel::DEBUG:
+        debug(record.format());
+        break;
+    case LogLevel::INFO:
+        info(record.format());
+        break;
+    case LogLevel::WARN:
+        warn(record.format());
+        break;
+    case LogLevel::ERROR:
+        error(record.format());
+        break;
+    case LogLevel::OFF:
+        break;
+    }
+}
+
+std::unique_ptr<ILogger> ILogger::createAsync(std::unique_ptr<ILogger> sink,
+                                              AsyncLoggerConfig        config) {
+    if (!sink) {
+        sink = std::make_unique<ConsoleLogger>(false);
+    }
+    return std::make_unique<AsyncLogger>(std::move(sink), config);
+}
+
+namespace {
+
+constexpr char const* LOG_LEVEL_ENV_VAR_NAME      = "SDV_LOG_LEVEL";
+constexpr char const* LOG_RATE_LIMIT_ENV_VAR_NAME = "SDV_LOG_RATE_LIMIT";
+
+} // namespace
+
 Logger::Logger()
-    : m_impl(std::make_unique<ConsoleLogger>()) {}
+    : m_impl(std::make_unique<ConsoleLogger>()) {
+    const auto level = StringUtils::toLower(getEnvVar(LOG_LEVEL_ENV_VAR_NAME));
+    if (level.empty() || level == "debug") {
+        m_level = LogLevel::DEBUG;
+    } else if (level == "info") {
+        m_level = LogLevel::INFO;
+    } else if (level == "warn") {
+        m_level = LogLevel::WARN;
+    } else if (level == "error") {
+        m_level = LogLevel::ERROR;
+    } else if (level == "off") {
+        m_level = LogLevel::OFF;
+    } else {
+        m_impl->error(fmt::format("Invalid value of {}: \"{}\". Using default (debug).",
+                                  LOG_LEVEL_ENV_VAR_NAME, level));
+    }
+
+    const auto rateLimit = getEnvVar(LOG_RATE_LIMIT_ENV_VAR_NAME);
+    if (!rateLimit.empty()) {
+        try {
+            const auto         parts = StringUtils::split(rateLimit, ',');
+            LogRateLimitConfig config;
+            config.m_ratePerSecond = std::stod(parts.at(0));
+            config.m_burst         = parts.size() > 1 ? std::stod(parts[1]) : config.m_burst;
+            if (parts.size() > 2 || config.m_ratePerSecond <= 0.0 || config.m_burst < 1.0) {
+                throw std::invalid_argument("out of range");
+            }
+            setRateLimit(config);
+        } catch (const std::exception&) {
+            m_impl->error(fmt::format("Invalid value of {}: \"{}\". Using default (no limit).",
+                                      LOG_RATE_LIMIT_ENV_VAR_NAME, rateLimit));
+        }
+    }
+}
+
+Logger::~Logger() = default;
+
+void Logger::setRateLimit(const std::optional<LogRateLimitConfig>& config) {
+    m_rateLimiter = config ? std::make_unique<LogRateLimiter>(*config) : nullptr;
+}
+
+LoggerMetrics Logger::getMetrics() const {
+    return m_rateLimiter ? m_rateLimiter->getMetrics() : LoggerMetrics{};
+}
+
+bool Logger::acquire(void (ILogger::*write)(const std::string&), const char* format) {
+    uint64_t numSuppressed = 0;
+    if (!m_rateLimiter->tryAcquire(format, numSuppressed)) {
+        return false;
+    }
+    if (numSuppressed > 0) {
+        ((*m_impl).*write)(
+            fmt::format(R"(Suppressed {} messages like "{}")", numSuppressed, format));
+    }
+    return true;
+}
 
 } // namespace velocitas
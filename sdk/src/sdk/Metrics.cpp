@@ -0,0 +1,354 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/Metrics.h"
+
+#include "sdk/Exceptions.h"
+#include "sdk/Logger.h"
+#include "sdk/Utils.h"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <tuple>
+#include <variant>
+
+namespace velocitas {
+
+namespace {
+
+std::string toString(MetricType type) {
+    switch (type) {
+    case MetricType::COUNTER:
+        return "counter";
+    case MetricType::GAUGE:
+        return "gauge";
+    case MetricType::HISTOGRAM:
+        return "histogram";
+    }
+    return "untyped";
+}
+
+std::string escape(const std::string& text, bool isLabelValue) {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (const char character : text) {
+        if (character == '\\') {
+            escaped += "\\\\";
+        } else if (character == '\n') {
+            escaped += "\\n";
+        } else if (character == '"' && isLabelValue) {
+            escaped += "\\\"";
+        } else {
+            escaped += character;
+        }
+    }
+    return escaped;
+}
+
+std::string formatLabels(const MetricLabels_t& labels, const std::string& bucketBound = {}) {
+    if (labels.empty() && bucketBound.empty()) {
+        return {};
+    }
+    std::string text{"{"};
+    for (const auto& [name, value] : labels) {
+        if (text.size() > 1) {
+            text += ',';
+        }
+        text += fmt::format("{}=\"{}\"", name, escape(value, true));
+    }
+    if (!bucketBound.empty()) {
+        if (text.size() > 1) {
+            text += ',';
+        }
+        text += fmt::format("le=\"{}\"", bucketBound);
+    }
+    text += '}';
+    return text;
+}
+
+void appendHistogram(std::string& text, const MetricSnapshot& metric) {
+    const auto& histogram = metric.histogram;
+    // the last bucket has no finite upper bound, its values are only covered by "+Inf"
+    size_t numBuckets = 0;
+    for (size_t i = 0; i + 1 < HistogramSnapshot::NUM_BUCKETS; ++i) {
+        if (histogram.buckets[i] > 0) {
+            numBuckets = i + 1;
+        }
+    }
+    uint64_t cumulativeCount = 0;
+    for (size_t i = 0; i < numBuckets; ++i) {
+        cumulativeCount += histogram.buckets[i];
+        const auto upperBound = (i == 0) ? uint64_t{0} : (uint64_t{1} << i) - 1;
+        text += fmt::format("{}_bucket{} {}\n", metric.name,
+                            formatLabels(metric.labels, std::to_string(upperBound)),
+                            cumulativeCount);
+    }
+    text += fmt::format("{}_bucket{} {}\n", metric.name, formatLabels(metric.labels, "+Inf"),
+                        histogram.count);
+    text += fmt::format("{}_sum{} {}\n", metric.name, formatLabels(metric.labels), histogram.sum);
+    text += fmt::format("{}_count{} {}\n", metric.name, formatLabels(metric.labels),
+                        histogram.count);
+}
+
+class PrometheusFileSink : public IMetricsSink {
+public:
+    explicit PrometheusFileSink(std::string path)
+        : m_path(std::move(path)) {}
+
+    void write(const std::vector<MetricSnapshot>& metrics) override {
+        // written to a temporary file first, as renaming replaces the file atomically
+        const auto temporaryPath = m_path + ".tmp";
+        {
+            std::ofstream file(temporaryPath, std::ios::trunc);
+            file << toPrometheusText(metrics);
+            if (!file.good()) {
+                logger().warn("Failed to write metrics to {}", temporaryPath);
+                return;
+            }
+        }
+        if (std::rename(temporaryPath.c_str(), m_path.c_str()) != 0) {
+            logger().warn("Failed to replace metrics file {}", m_path);
+        }
+    }
+
+private:
+    std::string m_path;
+};
+
+std::chrono::milliseconds determineExportInterval() {
+    std::chrono::milliseconds interval{MetricsExporter::DEFAULT_INTERVAL};
+    try {
+        auto intervalStr = getEnvVar("SDV_METRICS_INTERVAL_MS");
+        if (!intervalStr.empty()) {
+            interval = std::chrono::milliseconds{std::stoul(intervalStr)};
+        }
+    } catch (...) {
+        logger().error("Invalid metrics export interval specified via env var! Using default "
+                       "({} ms).",
+                       MetricsExporter::DEFAULT_INTERVAL.count());
+    }
+    return std::max(interval, std::chrono::milliseconds{1});
+}
+
+} // namespace
+
+struct MetricsRegistry::Metric {
+    explicit Metric(std::string help, MetricType type)
+        : m_help(std::move(help)) {
+        switch (type) {
+        case MetricType::COUNTER:
+            m_value.emplace<Counter>();
+            break;
+        case MetricType::GAUGE:
+            m_value.emplace<Gauge>();
+            break;
+        case MetricType::HISTOGRAM:
+            m_value.emplace<Histogram>();
+            break;
+        }
+    }
+
+    std::string                             m_help;
+    std::variant<Counter, Gauge, Histogram> m_value;
+};
+
+MetricsCollectorHandle::~MetricsCollectorHandle() { release(); }
+
+MetricsCollectorHandle::MetricsCollectorHandle(MetricsCollectorHandle&& other) noexcept
+    : m_registry(std::exchange(other.m_registry, nullptr))
+    , m_id(other.m_id) {}
+
+MetricsCollectorHandle& MetricsCollectorHandle::operator=(MetricsCollectorHandle&& other) noexcept {
+    if (this != &other) {
+        release();
+        m_registry = std::exchange(other.m_registry, nullptr);
+        m_id       = other.m_id;
+    }
+    return *this;
+}
+
+void MetricsCollectorHandle::release() {
+    if (m_registry != nullptr) {
+        std::exchange(m_registry, nullptr)->removeCollector(m_id);
+    }
+}
+
+MetricsRegistry& MetricsRegistry::getInstance() {
+    static auto* const instance = new MetricsRegistry(); // NOLINT(cppcoreguidelines-owning-memory)
+    return *instance;
+}
+
+MetricsRegistry::MetricsRegistry()  = default;
+MetricsRegistry::~MetricsRegistry() = default;
+
+MetricsRegistry::Metric& MetricsRegistry::getOrAdd(const std::string& name,
+                                                   const std::string& help, MetricType type,
+                                                   const MetricLabels_t& labels) {
+    std::lock_guard lock(m_mutex);
+    auto [typeIter, isNewName] = m_types.emplace(name, type);
+    if (!isNewName && typeIter->second != type) {
+        throw InvalidTypeException(fmt::format("Metric '{}' is registered as {} already", name,
+                                               toString(typeIter->second)));
+    }
+    auto& metric = m_metrics[MetricKey_t{name, labels}];
+    if (!metric) {
+        metric = std::make_unique<Metric>(help, type);
+    }
+    return *metric;
+}
+
+Counter& MetricsRegistry::getCounter(const std::string& name, const std::string& help,
+                                     const MetricLabels_t& labels) {
+    return std::get<Counter>(getOrAdd(name, help, MetricType::COUNTER, labels).m_value);
+}
+
+Gauge& MetricsRegistry::getGauge(const std::string& name, const std::string& help,
+                                 const MetricLabels_t& labels) {
+    return std::get<Gauge>(getOrAdd(name, help, MetricType::GAUGE, labels).m_value);
+}
+
+Histogram& MetricsRegistry::getHistogram(const std::string& name, const std::string& help,
+                                         const MetricLabels_t& labels) {
+    return std::get<Histogram>(getOrAdd(name, help, MetricType::HISTOGRAM, labels).m_value);
+}
+
+MetricsCollectorHandle MetricsRegistry::addCollector(MetricsCollector_t collector) {
+    std::lock_guard lock(m_collectorMutex);
+    const auto      id = m_nextCollectorId++;
+    m_collectors.emplace(id, std::move(collector));
+    return MetricsCollectorHandle{this, id};
+}
+
+void MetricsRegistry::removeCollector(uint64_t id) {
+    std::lock_guard lock(m_collectorMutex);
+    m_collectors.erase(id);
+}
+
+std::vector<MetricSnapshot> MetricsRegistry::collect() const {
+    std::vector<MetricSnapshot> metrics;
+    {
+        std::lock_guard lock(m_mutex);
+        metrics.reserve(m_metrics.size());
+        for (const auto& [key, metric] : m_metrics) {
+            MetricSnapshot snapshot;
+            snapshot.name   = key.first;
+            snapshot.help   = metric->m_help;
+            snapshot.labels = key.second;
+            if (const auto* counter = std::get_if<Counter>(&metric->m_value)) {
+                snapshot.type  = MetricType::COUNTER;
+                snapshot.value = static_cast<double>(counter->getValue());
+            } else if (const auto* gauge = std::get_if<Gauge>(&metric->m_value)) {
+                snapshot.type  = MetricType::GAUGE;
+                snapshot.value = static_cast<double>(gauge->getValue());
+            } else {
+                snapshot.type      = MetricType::HISTOGRAM;
+                snapshot.histogram = std::get<Histogram>(metric->m_value).getSnapshot();
+            }
+            metrics.push_back(std::move(snapshot));
+        }
+    }
+    {
+        std::lock_guard lock(m_collectorMutex);
+        for (const auto& [id, collector] : m_collectors) {
+            collector(metrics);
+        }
+    }
+    std::stable_sort(metrics.begin(), metrics.end(), [](const auto& lhs, const auto& rhs) {
+        return std::tie(lhs.name, lhs.labels) < std::tie(rhs.name, rhs.labels);
+    });
+    return metrics;
+}
+
+std::string toPrometheusText(const std::vector<MetricSnapshot>& metrics) {
+    std::string text;
+    const std::string* previousName{nullptr};
+    for (const auto& metric : metrics) {
+        if (previousName == nullptr || *previousName != metric.name) {
+            text += fmt::format("# HELP {} {}\n", metric.name, escape(metric.help, false));
+            text += fmt::format("# TYPE {} {}\n", metric.name, toString(metric.type));
+            previousName = &metric.name;
+        }
+        if (metric.type == MetricType::HISTOGRAM) {
+            appendHistogram(text, metric);
+        } else {
+            text += fmt::format("{}{} {}\n", metric.name, formatLabels(metric.labels),
+                                metric.value);
+        }
+    }
+    return text;
+}
+
+std::unique_ptr<IMetricsSink> IMetricsSink::createPrometheusFile(std::string path) {
+    return std::make_unique<PrometheusFileSink>(std::move(path));
+}
+
+std::unique_ptr<MetricsExporter> MetricsExporter::createFromEnvironment() {
+    auto path = getEnvVar("SDV_METRICS_FILE");
+    if (path.empty()) {
+        return nullptr;
+    }
+    const auto interval = determineExportInterval();
+    logger().info("Exporting metrics to {} every {} ms", path, interval.count());
+    return std::make_unique<MetricsExporter>(IMetricsSink::createPrometheusFile(std::move(path)),
+                                             interval);
+}
+
+MetricsExporter::MetricsExporter(std::unique_ptr<IMetricsSink> sink,
+                                 std::chrono::milliseconds interval, MetricsRegistry& registry)
+    : m_sink(std::move(sink))
+    , m_interval(interval)
+    , m_registry(registry)
+    , m_thread([this]() { run(); }) {}
+
+MetricsExporter::~MetricsExporter() { stop(); }
+
+void MetricsExporter::exportNow() {
+    std::lock_guard lock(m_exportMutex);
+    try {
+        m_sink->write(m_registry.collect());
+    } catch (const std::exception& e) {
+        logger().error("Exporting metrics failed: {}", e.what());
+    }
+}
+
+void MetricsExporter::stop() {
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_isStopping) {
+            return;
+        }
+        m_isStopping = true;
+    }
+    m_stopCondition.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    exportNow();
+}
+
+void MetricsExporter::run() {
+    std::unique_lock lock(m_mutex);
+    while (!m_stopCondition.wait_for(lock, m_interval, [this]() { return m_isStopping; })) {
+        lock.unlock();
+        exportNow();
+        lock.lock();
+    }
+}
+
+} // namespace velocitas
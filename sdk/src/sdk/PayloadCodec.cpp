@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/PayloadCodec.h"
+
+#include <fmt/core.h>
+#include <zlib.h>
+
+#include <stdexcept>
+#include <utility>
+
+namespace velocitas {
+
+namespace {
+
+class DeflateCodec final : public IPayloadCodec {
+public:
+    DeflateCodec(int level, std::string dictionary)
+        : m_level{level}
+        , m_dictionary{std::move(dictionary)}
+        , m_name{m_dictionary.empty() ? std::string("deflate")
+                                      : fmt::format("deflate-{:08x}", getDictionaryId())} {}
+
+    [[nodiscard]] const std::string& getName() const override { return m_name; }
+
+    [[nodiscard]] std::string encode(std::string_view payload) const override {
+        z_stream stream{};
+        if (deflateInit(&stream, m_level) != Z_OK) {
+            throw std::runtime_error("Deflate: Initializing the stream failed");
+        }
+        if (!m_dictionary.empty()) {
+            deflateSetDictionary(&stream, getDictionaryData(), getDictionarySize());
+        }
+        std::string encoded(deflateBound(&stream, static_cast<uLong>(payload.size())), '\0');
+        stream.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(payload.data()));
+        stream.avail_in  = static_cast<uInt>(payload.size());
+        stream.next_out  = reinterpret_cast<Bytef*>(encoded.data());
+        stream.avail_out = static_cast<uInt>(encoded.size());
+        const auto result = deflate(&stream, Z_FINISH);
+        encoded.resize(stream.total_out);
+        deflateEnd(&stream);
+        if (result != Z_STREAM_END) {
+            throw std::runtime_error(fmt::format("Deflate: Encoding failed ({})", result));
+        }
+        return encoded;
+    }
+
+    [[nodiscard]] std::string decode(std::string_view payload) const override {
+        z_stream stream{};
+        if (inflateInit(&stream) != Z_OK) {
+            throw std::runtime_error("Deflate: Initializing the stream failed");
+        }
+        stream.next_in  = reinterpret_cast<Bytef*>(const_cast<char*>(payload.data()));
+        stream.avail_in = static_cast<uInt>(payload.size());
+
+        // deflated telemetry typically expands by 5-10x
+        std::string decoded(payload.size() * 8 + 64, '\0');
+        int         result = Z_OK;
+        while (result != Z_STREAM_END) {
+            if (stream.total_out == decoded.size()) {
+                decoded.resize(decoded.size() * 2);
+            }
+            stream.next_out  = reinterpret_cast<Bytef*>(decoded.data() + stream.total_out);
+            stream.avail_out = static_cast<uInt>(decoded.size() - stream.total_out);
+            result           = inflate(&stream, Z_NO_FLUSH);
+            if (result == Z_NEED_DICT && !m_dictionary.empty()) {
+                result = inflateSetDictionary(&stream, getDictionaryData(), getDictionarySize());
+            }
+            if (result != Z_OK && result != Z_STREAM_END && result != Z_BUF_ERROR) {
+                break;
+            }
+            if (result == Z_BUF_ERROR && stream.avail_in == 0) {
+                break;
+            }
+        }
+        decoded.resize(stream.total_out);
+        inflateEnd(&stream);
+        if (result != Z_STREAM_END) {
+            throw std::runtime_error(fmt::format("Deflate: Decoding failed ({})", result));
+        }
+        return decoded;
+    }
+
+private:
+    [[nodiscard]] const Bytef* getDictionaryData() const {
+        return reinterpret_cast<const Bytef*>(m_dictionary.data());
+    }
+    [[nodiscard]] uInt getDictionarySize() const { return static_cast<uInt>(m_dictionary.size()); }
+
+    // zlib identifies a dictionary by its Adler-32 checksum as well
+    [[nodiscard]] uLong getDictionaryId() const {
+        return adler32(adler32(0L, Z_NULL, 0), getDictionaryData(), getDictionarySize());
+    }
+
+    const int         m_level;
+    const std::string m_dictionary;
+    const std::string m_name;
+};
+
+} // namespace
+
+std::shared_ptr<IPayloadCodec> IPayloadCodec::createDeflate(int level, std::string dictionary) {
+    if (level < Z_DEFAULT_COMPRESSION || level > Z_BEST_COMPRESSION) {
+        throw std::invalid_argument(fmt::format("Invalid deflate compression level {}", level));
+    }
+    return std::make_shared<DeflateCodec>(level, std::move(dictionary));
+}
+
+} // namespace velocitas
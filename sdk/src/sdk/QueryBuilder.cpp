@@ -25,18 +25,30 @@ QueryBuilder QueryBuilder::select(const DataPoint& dataPoint) {
     QueryBuilder builder;
     builder.m_queryContext.emplace_back("SELECT");
     builder.m_queryContext.push_back(dataPoint.getPath());
+    builder.m_signals.push_back(dataPoint.getSignalHandle());
     return builder;
 }
 
 QueryBuilder
 QueryBuilder::select(const std::vector<std::reference_wrapper<DataPoint>>& dataPoints) {
+    std::vector<const DataPoint*> pointers;
+    pointers.reserve(dataPoints.size());
+    std::transform(dataPoints.begin(), dataPoints.end(), std::back_inserter(pointers),
+                   [](const auto& dataPoint) { return &dataPoint.get(); });
+    return selectAll(pointers);
+}
+
+QueryBuilder QueryBuilder::selectAll(const std::vector<const DataPoint*>& dataPoints) {
     QueryBuilder builder;
     builder.m_queryContext.emplace_back("SELECT");
 
     std::vector<std::string> paths;
     paths.reserve(dataPoints.size());
-    std::transform(dataPoints.begin(), dataPoints.end(), std::back_inserter(paths),
-                   [](const auto& dataPoint) { return dataPoint.get().getPath(); });
+    builder.m_signals.reserve(dataPoints.size());
+    for (const auto* dataPoint : dataPoints) {
+        paths.push_back(dataPoint->getPath());
+        builder.m_signals.push_back(dataPoint->getSignalHandle());
+    }
 
     builder.m_queryContext.emplace_back(StringUtils::join(paths, ", "));
     return builder;
@@ -44,4 +56,6 @@ QueryBuilder::select(const std::vector<std::reference_wrapper<DataPoint>>& dataP
 
 std::string QueryBuilder::build() const { return StringUtils::join(m_queryContext, " "); }
 
+Query QueryBuilder::buildQuery() const { return Query(m_signals, m_conditions, build()); }
+
 } // namespace velocitas
@@ -0,0 +1,361 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#include "sdk/ReplySerializer.h"
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace velocitas {
+
+namespace {
+
+constexpr int64_t NANOS_PER_SECOND = 1000000000;
+
+constexpr uint8_t CBOR_UNSIGNED = 0;
+constexpr uint8_t CBOR_NEGATIVE = 1;
+constexpr uint8_t CBOR_TEXT     = 3;
+constexpr uint8_t CBOR_ARRAY    = 4;
+constexpr uint8_t CBOR_MAP      = 5;
+constexpr char    CBOR_FALSE    = '\xf4';
+constexpr char    CBOR_TRUE     = '\xf5';
+constexpr char    CBOR_NULL     = '\xf6';
+constexpr char    CBOR_FLOAT32  = '\xfa';
+constexpr char    CBOR_FLOAT64  = '\xfb';
+
+// the members of a signal's object: value or failure, and timestamp(s)
+constexpr size_t NUM_SIGNAL_MEMBERS = 2;
+
+std::string_view getFailureName(DataPointValue::Failure failure) {
+    switch (failure) {
+    case DataPointValue::Failure::NONE:
+        return "NONE";
+    case DataPointValue::Failure::INVALID_VALUE:
+        return "INVALID_VALUE";
+    case DataPointValue::Failure::NOT_AVAILABLE:
+        return "NOT_AVAILABLE";
+    case DataPointValue::Failure::UNKNOWN_DATAPOINT:
+        return "UNKNOWN_DATAPOINT";
+    case DataPointValue::Failure::ACCESS_DENIED:
+        return "ACCESS_DENIED";
+    case DataPointValue::Failure::INTERNAL_ERROR:
+        return "INTERNAL_ERROR";
+    default:
+        return "UNKNOWN";
+    }
+}
+
+template <typename T> void appendBigEndian(std::string& out, T value) {
+    for (int shift = static_cast<int>(sizeof(T) * 8) - 8; shift >= 0; shift -= 8) {
+        out.push_back(static_cast<char>((value >> shift) & 0xFFU));
+    }
+}
+
+void appendCborHead(std::string& out, uint8_t majorType, uint64_t argument) {
+    const auto initialByte = static_cast<uint8_t>(majorType << 5U);
+    if (argument < 24) {
+        out.push_back(static_cast<char>(initialByte | argument));
+    } else if (argument <= UINT8_MAX) {
+        out.push_back(static_cast<char>(initialByte | 24U));
+        appendBigEndian(out, static_cast<uint8_t>(argument));
+    } else if (argument <= UINT16_MAX) {
+        out.push_back(static_cast<char>(initialByte | 25U));
+        appendBigEndian(out, static_cast<uint16_t>(argument));
+    } else if (argument <= UINT32_MAX) {
+        out.push_back(static_cast<char>(initialByte | 26U));
+        appendBigEndian(out, static_cast<uint32_t>(argument));
+    } else {
+        out.push_back(static_cast<char>(initialByte | 27U));
+        appendBigEndian(out, argument);
+    }
+}
+
+void appendJsonString(std::string& out, std::string_view value) {
+    static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+    out.push_back('"');
+    for (const char character : value) {
+        switch (character) {
+        case '"':
+            out.append("\\\"");
+            break;
+        case '\\':
+            out.append("\\\\");
+            break;
+        case '\n':
+            out.append("\\n");
+            break;
+        case '\r':
+            out.append("\\r");
+            break;
+        case '\t':
+            out.append("\\t");
+            break;
+        default:
+            if (static_cast<unsigned char>(character) < 0x20) {
+                out.append("\\u00");
+                out.push_back(HEX_DIGITS[static_cast<unsigned char>(character) >> 4U]);
+                out.push_back(HEX_DIGITS[static_cast<unsigned char>(character) & 0xFU]);
+            } else {
+                out.push_back(character);
+            }
+        }
+    }
+    out.push_back('"');
+}
+
+void appendCborText(std::string& out, std::string_view value) {
+    appendCborHead(out, CBOR_TEXT, value.size());
+    out.append(value);
+}
+
+template <typename T> struct IsVector : std::false_type {};
+template <typename T> struct IsVector<std::vector<T>> : std::true_type {};
+
+// shortest representation parsing back to the same value
+template <typename T> void appendNumber(std::string& out, T value) {
+    std::array<char, 32> chars{};
+    const auto           result = std::to_chars(chars.data(), chars.data() + chars.size(), value);
+    out.append(chars.data(), result.ptr);
+}
+
+} // namespace
+
+ReplySerializer::ReplySerializer(Format format)
+    : m_format(format) {}
+
+const std::string& ReplySerializer::serialize(const DataPointReply& reply) {
+    beginPayload(reply.size());
+    for (const auto& entry : reply) {
+        writeSample(entry.m_handle, DataPointReply::getSample(entry));
+    }
+    return endPayload();
+}
+
+const std::string& ReplySerializer::serialize(const ColumnarBatch& batch) {
+    beginPayload(batch.size());
+    for (const auto& column : batch) {
+        writeColumn(column);
+    }
+    return endPayload();
+}
+
+void ReplySerializer::beginPayload(size_t numSignals) {
+    // keeps the capacity of the previous payloads
+    m_buffer.clear();
+    m_numWrittenSignals = 0;
+    if (m_format == Format::JSON) {
+        m_buffer.push_back('{');
+    } else {
+        appendCborHead(m_buffer, CBOR_MAP, numSignals);
+    }
+}
+
+const std::string& ReplySerializer::endPayload() {
+    if (m_format == Format::JSON) {
+        m_buffer.push_back('}');
+    }
+    return m_buffer;
+}
+
+void ReplySerializer::writeKey(SignalHandle_t handle) {
+    auto iter = m_keyFragments.find(handle);
+    if (iter == m_keyFragments.end()) {
+        const auto& path = SignalPathRegistry::getInstance().getPath(handle);
+        std::string fragment;
+        if (m_format == Format::JSON) {
+            appendJsonString(fragment, path);
+            fragment.append(":{");
+        } else {
+            appendCborText(fragment, path);
+            appendCborHead(fragment, CBOR_MAP, NUM_SIGNAL_MEMBERS);
+        }
+        iter = m_keyFragments.emplace(handle, std::move(fragment)).first;
+    }
+    if (m_format == Format::JSON && m_numWrittenSignals > 0) {
+        m_buffer.push_back(',');
+    }
+    ++m_numWrittenSignals;
+    m_buffer.append(iter->second);
+}
+
+void ReplySerializer::writeSample(SignalHandle_t handle, const DataPointSample& sample) {
+    writeKey(handle);
+    if (sample.isValid()) {
+        writeMemberName("value", true);
+        writeValue(sample.getVariant());
+    } else {
+        writeMemberName("failure", true);
+        writeScalar(getFailureName(sample.getFailure()));
+    }
+    writeMemberName("timestamp", false);
+    const auto& timestamp = sample.getTimestamp();
+    writeScalar(timestamp.seconds * NANOS_PER_SECOND + timestamp.nanos);
+    if (m_format == Format::JSON) {
+        m_buffer.push_back('}');
+    }
+}
+
+void ReplySerializer::writeColumn(const ColumnarBatch::Column& column) {
+    writeKey(column.getHandle());
+    writeMemberName("timestamps", true);
+    const auto& timestamps = column.getTimestamps();
+    writeArrayHead(timestamps.size());
+    for (size_t row = 0; row < timestamps.size(); ++row) {
+        writeArraySeparator(row);
+        writeScalar(timestamps[row]);
+    }
+    writeArrayTail();
+
+    writeMemberName("values", false);
+    writeArrayHead(column.size());
+    for (size_t row = 0; row < column.size(); ++row) {
+        writeArraySeparator(row);
+        if (!column.isValid(row)) {
+            writeValue(std::monostate{});
+        } else if (column.getType() == DataPointValue::Type::STRING) {
+            // read from the character buffer rather than copying the value into a sample
+            const auto& offsets = column.getOffsets();
+            writeScalar(std::string_view(column.getCharData().data() + offsets[row],
+                                         offsets[row + 1] - offsets[row]));
+        } else {
+            writeValue(column.getSample(row).getVariant());
+        }
+    }
+    writeArrayTail();
+    if (m_format == Format::JSON) {
+        m_buffer.push_back('}');
+    }
+}
+
+void ReplySerializer::writeValue(const DataPointVariant_t& value) {
+    std::visit(
+        [this](const auto& typedValue) {
+            using T = std::decay_t<decltype(typedValue)>;
+            if constexpr (std::is_same_v<T, std::monostate>) {
+                if (m_format == Format::JSON) {
+                    m_buffer.append("null");
+                } else {
+                    m_buffer.push_back(CBOR_NULL);
+                }
+            } else if constexpr (std::is_same_v<T, std::string>) {
+                writeScalar(std::string_view(typedValue));
+            } else if constexpr (IsVector<T>::value) {
+                writeArrayHead(typedValue.size());
+                size_t index{0};
+                for (const auto& element : typedValue) {
+                    writeArraySeparator(index++);
+                    if constexpr (std::is_same_v<T, std::vector<std::string>>) {
+                        writeScalar(std::string_view(element));
+                    } else {
+                        writeScalar(static_cast<typename T::value_type>(element));
+                    }
+                }
+                writeArrayTail();
+            } else {
+                writeScalar(typedValue);
+            }
+        },
+        value);
+}
+
+template <typename T> void ReplySerializer::writeScalar(const T& value) {
+    const bool isJson = m_format == Format::JSON;
+    if constexpr (std::is_same_v<T, bool>) {
+        if (isJson) {
+            m_buffer.append(value ? "true" : "false");
+        } else {
+            m_buffer.push_back(value ? CBOR_TRUE : CBOR_FALSE);
+        }
+    } else if constexpr (std::is_same_v<T, std::string_view>) {
+        if (isJson) {
+            appendJsonString(m_buffer, value);
+        } else {
+            appendCborText(m_buffer, value);
+        }
+    } else if constexpr (std::is_floating_point_v<T>) {
+        if (isJson) {
+            if (std::isfinite(value)) {
+                appendNumber(m_buffer, value);
+            } else {
+                m_buffer.append("null");
+            }
+        } else if constexpr (std::is_same_v<T, float>) {
+            uint32_t bits{0};
+            std::memcpy(&bits, &value, sizeof(bits));
+            m_buffer.push_back(CBOR_FLOAT32);
+            appendBigEndian(m_buffer, bits);
+        } else {
+            uint64_t bits{0};
+            std::memcpy(&bits, &value, sizeof(bits));
+            m_buffer.push_back(CBOR_FLOAT64);
+            appendBigEndian(m_buffer, bits);
+        }
+    } else {
+        static_assert(std::is_integral_v<T>, "Unsupported value type!");
+        if (isJson) {
+            appendNumber(m_buffer, value);
+            return;
+        }
+        if constexpr (std::is_signed_v<T>) {
+            if (value < 0) {
+                // encodes -1 - value, without overflowing for the minimum of int64_t
+                appendCborHead(m_buffer, CBOR_NEGATIVE, ~static_cast<uint64_t>(value));
+                return;
+            }
+        }
+        appendCborHead(m_buffer, CBOR_UNSIGNED, static_cast<uint64_t>(value));
+    }
+}
+
+void ReplySerializer::writeMemberName(std::string_view name, bool isFirst) {
+    if (m_format == Format::JSON) {
+        if (!isFirst) {
+            m_buffer.push_back(',');
+        }
+        appendJsonString(m_buffer, name);
+        m_buffer.push_back(':');
+    } else {
+        appendCborText(m_buffer, name);
+    }
+}
+
+void ReplySerializer::writeArrayHead(size_t size) {
+    if (m_format == Format::JSON) {
+        m_buffer.push_back('[');
+    } else {
+        appendCborHead(m_buffer, CBOR_ARRAY, size);
+    }
+}
+
+void ReplySerializer::writeArrayTail() {
+    if (m_format == Format::JSON) {
+        m_buffer.push_back(']');
+    }
+}
+
+void ReplySerializer::writeArraySeparator(size_t index) {
+    if (m_format == Format::JSON && index > 0) {
+        m_buffer.push_back(',');
+    }
+}
+
+} // namespace velocitas
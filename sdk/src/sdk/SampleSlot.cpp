@@ -0,0 +1,180 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/SampleSlot.h"
+
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <variant>
+
+namespace velocitas {
+
+namespace {
+
+template <typename T> uint64_t toBits(T value) {
+    static_assert(sizeof(T) <= sizeof(uint64_t));
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(T));
+    return bits;
+}
+
+template <typename T> DataPointSample toSample(uint64_t bits, Timestamp timestamp) {
+    T value{};
+    std::memcpy(&value, &bits, sizeof(T));
+    return DataPointSample(value, timestamp);
+}
+
+// the type of the value held, unlike DataPointSample::getType() which is the signal's type
+DataPointValue::Type getHeldType(const DataPointSample& sample, uint64_t& bits) {
+    return std::visit(
+        [&bits](const auto& value) {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (std::is_arithmetic_v<T>) {
+                bits = toBits(value);
+                return getValueType<T>();
+            } else {
+                return DataPointValue::Type::INVALID;
+            }
+        },
+        sample.getVariant());
+}
+
+DataPointSample decode(DataPointValue::Type type, uint64_t bits, Timestamp timestamp) {
+    switch (type) {
+    case DataPointValue::Type::BOOL:
+        return toSample<bool>(bits, timestamp);
+    case DataPointValue::Type::INT8:
+        return toSample<int8_t>(bits, timestamp);
+    case DataPointValue::Type::INT16:
+        return toSample<int16_t>(bits, timestamp);
+    case DataPointValue::Type::INT32:
+        return toSample<int32_t>(bits, timestamp);
+    case DataPointValue::Type::INT64:
+        return toSample<int64_t>(bits, timestamp);
+    case DataPointValue::Type::UINT8:
+        return toSample<uint8_t>(bits, timestamp);
+    case DataPointValue::Type::UINT16:
+        return toSample<uint16_t>(bits, timestamp);
+    case DataPointValue::Type::UINT32:
+        return toSample<uint32_t>(bits, timestamp);
+    case DataPointValue::Type::UINT64:
+        return toSample<uint64_t>(bits, timestamp);
+    case DataPointValue::Type::FLOAT:
+        return toSample<float>(bits, timestamp);
+    case DataPointValue::Type::DOUBLE:
+        return toSample<double>(bits, timestamp);
+    default:
+        return DataPointSample(type, DataPointValue::Failure::NOT_AVAILABLE, timestamp);
+    }
+}
+
+} // namespace
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free &&
+                  std::atomic<DataPointValue::Type>::is_always_lock_free,
+              "Slots shared between processes need address-free atomics");
+
+bool SampleSlot::write(const DataPointSample& sample, Clock_t::time_point receivedAt) {
+    uint64_t   bits = 0;
+    const auto type = sample.isValid() ? getHeldType(sample, bits) : sample.getType();
+    if (sample.isValid() && type == DataPointValue::Type::INVALID) {
+        return false;
+    }
+    const auto sequence = beginWrite();
+    m_type.store(type, std::memory_order_relaxed);
+    m_failure.store(sample.getFailure(), std::memory_order_relaxed);
+    m_valueBits.store(bits, std::memory_order_relaxed);
+    m_seconds.store(sample.getTimestamp().seconds, std::memory_order_relaxed);
+    m_nanos.store(sample.getTimestamp().nanos, std::memory_order_relaxed);
+    m_receivedAt.store(receivedAt.time_since_epoch().count(), std::memory_order_relaxed);
+    // release, so readers seeing the new count via getNumUpdates() can read the sample
+    m_numUpdates.store(m_numUpdates.load(std::memory_order_relaxed) + 1,
+                       std::memory_order_release);
+    endWrite(sequence);
+    return true;
+}
+
+void SampleSlot::reset() {
+    const auto sequence = beginWrite();
+    m_type.store(DataPointValue::Type::INVALID, std::memory_order_relaxed);
+    m_failure.store(DataPointValue::Failure::NOT_AVAILABLE, std::memory_order_relaxed);
+    m_valueBits.store(0, std::memory_order_relaxed);
+    m_seconds.store(0, std::memory_order_relaxed);
+    m_nanos.store(0, std::memory_order_relaxed);
+    m_receivedAt.store(0, std::memory_order_relaxed);
+    m_numUpdates.store(0, std::memory_order_release);
+    endWrite(sequence);
+}
+
+SampleSlot::Reading SampleSlot::read() const {
+    for (;;) {
+        if (auto reading = tryRead(std::numeric_limits<uint32_t>::max())) {
+            return std::move(*reading);
+        }
+    }
+}
+
+std::optional<SampleSlot::Reading> SampleSlot::tryRead(uint32_t maxAttempts) const {
+    for (uint32_t attempt = 0; attempt < maxAttempts; ++attempt) {
+        const auto sequence = m_sequence.load(std::memory_order_acquire);
+        if ((sequence & 1U) != 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        const auto      type       = m_type.load(std::memory_order_relaxed);
+        const auto      failure    = m_failure.load(std::memory_order_relaxed);
+        const auto      bits       = m_valueBits.load(std::memory_order_relaxed);
+        const Timestamp timestamp  = {m_seconds.load(std::memory_order_relaxed),
+                                      m_nanos.load(std::memory_order_relaxed)};
+        const auto      receivedAt = m_receivedAt.load(std::memory_order_relaxed);
+        const auto      numUpdates = m_numUpdates.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_sequence.load(std::memory_order_relaxed) != sequence) {
+            continue;
+        }
+        return Reading{failure == DataPointValue::Failure::NONE
+                           ? decode(type, bits, timestamp)
+                           : DataPointSample(type, failure, timestamp),
+                       Clock_t::time_point(Clock_t::duration(receivedAt)), numUpdates};
+    }
+    return std::nullopt;
+}
+
+uint64_t SampleSlot::beginWrite() {
+    auto sequence = m_sequence.load(std::memory_order_relaxed);
+    for (;;) {
+        if ((sequence & 1U) != 0) {
+            std::this_thread::yield();
+            sequence = m_sequence.load(std::memory_order_relaxed);
+            continue;
+        }
+        if (m_sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire,
+                                             std::memory_order_relaxed)) {
+            break;
+        }
+    }
+    // the fields must not become visible before the sequence marking the write
+    std::atomic_thread_fence(std::memory_order_release);
+    return sequence + 1;
+}
+
+void SampleSlot::endWrite(uint64_t sequence) {
+    m_sequence.store(sequence + 1, std::memory_order_release);
+}
+
+} // namespace velocitas
@@ -0,0 +1,255 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/SignalHistory.h"
+
+#include "sdk/DataPointReply.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <variant>
+
+namespace velocitas {
+
+namespace {
+
+constexpr int64_t NANOSECONDS_PER_SECOND = 1000000000;
+
+std::optional<double> getNumericValue(const DataPointSample& sample) {
+    if (!sample.isValid()) {
+        return std::nullopt;
+    }
+    return std::visit(
+        [](const auto& value) -> std::optional<double> {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+                return static_cast<double>(value);
+            } else {
+                return std::nullopt;
+            }
+        },
+        sample.getVariant());
+}
+
+Timestamp getCurrentTimestamp() {
+    const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::system_clock::now().time_since_epoch())
+                         .count();
+    return Timestamp{now / NANOSECONDS_PER_SECOND,
+                     static_cast<int32_t>(now % NANOSECONDS_PER_SECOND)};
+}
+
+} // namespace
+
+SignalHistory::MonotonicQueue::MonotonicQueue(size_t capacity)
+    : m_entries(capacity) {}
+
+template <typename TIsDominated>
+void SignalHistory::MonotonicQueue::push(uint64_t sequence, TIsDominated isDominated) {
+    while (m_size > 0 && isDominated(m_entries[(m_head + m_size - 1) % m_entries.size()])) {
+        --m_size;
+    }
+    m_entries[(m_head + m_size) % m_entries.size()] = sequence;
+    ++m_size;
+}
+
+void SignalHistory::MonotonicQueue::popBefore(uint64_t sequence) {
+    while (m_size > 0 && m_entries[m_head] < sequence) {
+        m_head = (m_head + 1) % m_entries.size();
+        --m_size;
+    }
+}
+
+SignalHistory::SignalHistory(const SignalHistoryConfig& config)
+    : m_config{std::max<size_t>(config.m_capacity, 1), config.m_window}
+    , m_samples(m_config.m_capacity)
+    , m_minQueue(m_config.m_capacity)
+    , m_maxQueue(m_config.m_capacity) {}
+
+void SignalHistory::record(const SignalHistorySample& sample) {
+    const auto capacity = m_samples.size();
+    auto       newest   = sample;
+    if (m_nextSequence > 0) {
+        const auto& previous = at(m_nextSequence - 1);
+        if (toNanoseconds(newest.timestamp) < toNanoseconds(previous.timestamp)) {
+            newest.timestamp = previous.timestamp;
+        }
+    }
+
+    // the slot of the oldest sample gets overwritten
+    if (m_nextSequence >= capacity && m_windowBegin <= m_nextSequence - capacity) {
+        m_windowSum -= at(m_windowBegin).value;
+        ++m_windowBegin;
+        m_minQueue.popBefore(m_windowBegin);
+        m_maxQueue.popBefore(m_windowBegin);
+    }
+
+    const auto sequence            = m_nextSequence++;
+    m_samples[sequence % capacity] = newest;
+    m_windowSum += newest.value;
+    m_minQueue.push(sequence, [this, &newest](uint64_t other) {
+        return at(other).value >= newest.value;
+    });
+    m_maxQueue.push(sequence, [this, &newest](uint64_t other) {
+        return at(other).value <= newest.value;
+    });
+
+    if (m_config.m_window.count() > 0) {
+        const auto windowStart =
+            toNanoseconds(newest.timestamp) -
+            std::chrono::duration_cast<std::chrono::nanoseconds>(m_config.m_window).count();
+        while (toNanoseconds(at(m_windowBegin).timestamp) < windowStart) {
+            m_windowSum -= at(m_windowBegin).value;
+            ++m_windowBegin;
+        }
+        m_minQueue.popBefore(m_windowBegin);
+        m_maxQueue.popBefore(m_windowBegin);
+    }
+
+    // restart the running sum whenever possible, so rounding errors do not accumulate
+    if (m_windowBegin == sequence) {
+        m_windowSum = newest.value;
+    }
+}
+
+std::optional<SignalHistoryAggregates> SignalHistory::getAggregates() const {
+    if (m_nextSequence == 0) {
+        return std::nullopt;
+    }
+    const auto& oldest = at(m_windowBegin);
+    const auto& newest = at(m_nextSequence - 1);
+
+    SignalHistoryAggregates aggregates;
+    aggregates.count  = static_cast<size_t>(m_nextSequence - m_windowBegin);
+    aggregates.sum    = m_windowSum;
+    aggregates.mean   = m_windowSum / static_cast<double>(aggregates.count);
+    aggregates.min    = at(m_minQueue.front()).value;
+    aggregates.max    = at(m_maxQueue.front()).value;
+    aggregates.latest = newest;
+    if (const auto duration = toNanoseconds(newest.timestamp) - toNanoseconds(oldest.timestamp);
+        duration > 0) {
+        aggregates.rateOfChange = (newest.value - oldest.value) *
+                                  static_cast<double>(NANOSECONDS_PER_SECOND) /
+                                  static_cast<double>(duration);
+    }
+    return aggregates;
+}
+
+std::vector<SignalHistorySample> SignalHistory::getSamples() const {
+    std::vector<SignalHistorySample> samples;
+    samples.reserve(static_cast<size_t>(m_nextSequence - m_windowBegin));
+    for (auto sequence = m_windowBegin; sequence < m_nextSequence; ++sequence) {
+        samples.push_back(at(sequence));
+    }
+    return samples;
+}
+
+void SignalHistory::clear() {
+    m_nextSequence = 0;
+    m_windowBegin  = 0;
+    m_windowSum    = 0.0;
+    m_minQueue.clear();
+    m_maxQueue.clear();
+}
+
+int64_t SignalHistory::toNanoseconds(const Timestamp& timestamp) {
+    return timestamp.seconds * NANOSECONDS_PER_SECOND + timestamp.nanos;
+}
+
+SignalHistoryStore& SignalHistoryStore::getInstance() {
+    static SignalHistoryStore instance;
+    return instance;
+}
+
+void SignalHistoryStore::enable(SignalHandle_t signal, const SignalHistoryConfig& config) {
+    auto                                entry = std::make_shared<Entry>(config);
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (signal >= m_entries.size()) {
+        m_entries.resize(signal + 1);
+    }
+    if (!m_entries[signal]) {
+        m_numRecordedSignals.fetch_add(1, std::memory_order_relaxed);
+    }
+    m_entries[signal] = std::move(entry);
+}
+
+void SignalHistoryStore::disable(SignalHandle_t signal) {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (signal < m_entries.size() && m_entries[signal]) {
+        m_entries[signal].reset();
+        m_numRecordedSignals.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+bool SignalHistoryStore::isRecording(SignalHandle_t signal) const {
+    return m_numRecordedSignals.load(std::memory_order_relaxed) > 0 && find(signal) != nullptr;
+}
+
+void SignalHistoryStore::record(SignalHandle_t signal, const DataPointSample& sample) {
+    const auto entry = find(signal);
+    if (!entry) {
+        return;
+    }
+    const auto value = getNumericValue(sample);
+    if (!value) {
+        return;
+    }
+    const auto& timestamp    = sample.getTimestamp();
+    const bool  hasTimestamp = timestamp.seconds != 0 || timestamp.nanos != 0;
+
+    std::lock_guard<std::mutex> lock(entry->m_mutex);
+    entry->m_history.record({hasTimestamp ? timestamp : getCurrentTimestamp(), *value});
+}
+
+void SignalHistoryStore::record(const DataPointReply& reply) {
+    if (m_numRecordedSignals.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+    for (const auto& entry : reply) {
+        if (isRecording(entry.m_handle)) {
+            record(entry.m_handle, DataPointReply::getSample(entry));
+        }
+    }
+}
+
+std::optional<SignalHistoryAggregates>
+SignalHistoryStore::getAggregates(SignalHandle_t signal) const {
+    const auto entry = find(signal);
+    if (!entry) {
+        return std::nullopt;
+    }
+    std::lock_guard<std::mutex> lock(entry->m_mutex);
+    return entry->m_history.getAggregates();
+}
+
+std::vector<SignalHistorySample> SignalHistoryStore::getSamples(SignalHandle_t signal) const {
+    const auto entry = find(signal);
+    if (!entry) {
+        return {};
+    }
+    std::lock_guard<std::mutex> lock(entry->m_mutex);
+    return entry->m_history.getSamples();
+}
+
+std::shared_ptr<SignalHistoryStore::Entry> SignalHistoryStore::find(SignalHandle_t signal) const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    if (signal < m_entries.size()) {
+        return m_entries[signal];
+    }
+    return nullptr;
+}
+
+} // namespace velocitas
@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/SignalMirror.h"
+
+#include "sdk/DataPointReply.h"
+#include "sdk/Exceptions.h"
+
+namespace velocitas {
+
+SignalMirror& SignalMirror::getInstance() {
+    static SignalMirror instance;
+    return instance;
+}
+
+SignalMirror::SignalMirror()
+    : m_chunks(std::make_unique<std::atomic<Chunk*>[]>(NUM_CHUNKS)) {}
+
+SignalMirror::~SignalMirror() {
+    for (size_t i = 0; i < NUM_CHUNKS; ++i) {
+        delete m_chunks[i].load(std::memory_order_relaxed);
+    }
+}
+
+void SignalMirror::enable(SignalHandle_t signal) {
+    if (signal >= MAX_NUM_SIGNALS) {
+        throw InvalidValueException("Signal handle exceeds the capacity of the signal mirror");
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto&                       chunk = m_chunks[signal / CHUNK_SIZE];
+    if (chunk.load(std::memory_order_relaxed) == nullptr) {
+        chunk.store(new Chunk(), std::memory_order_release);
+    }
+    auto* const chunkPtr = chunk.load(std::memory_order_relaxed);
+    chunkPtr->m_slots[signal % CHUNK_SIZE].reset();
+    if (!chunkPtr->m_isEnabled[signal % CHUNK_SIZE].exchange(true)) {
+        m_numMirroredSignals.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void SignalMirror::disable(SignalHandle_t signal) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto*                       chunk = findChunk(signal);
+    if (chunk != nullptr && chunk->m_isEnabled[signal % CHUNK_SIZE].exchange(false)) {
+        m_numMirroredSignals.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+bool SignalMirror::isMirroring(SignalHandle_t signal) const {
+    if (m_numMirroredSignals.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+    const auto* chunk = findChunk(signal);
+    return chunk != nullptr &&
+           chunk->m_isEnabled[signal % CHUNK_SIZE].load(std::memory_order_relaxed);
+}
+
+void SignalMirror::record(SignalHandle_t signal, const DataPointSample& sample,
+                          Clock_t::time_point receivedAt) {
+    if (!isMirroring(signal)) {
+        return;
+    }
+    findChunk(signal)->m_slots[signal % CHUNK_SIZE].write(sample, receivedAt);
+}
+
+void SignalMirror::record(const DataPointReply& reply) {
+    if (m_numMirroredSignals.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+    const auto receivedAt = Clock_t::now();
+    for (const auto& entry : reply) {
+        if (isMirroring(entry.m_handle)) {
+            record(entry.m_handle, DataPointReply::getSample(entry), receivedAt);
+        }
+    }
+}
+
+bool SignalMirror::read(SignalHandle_t signal, Reading& reading) const {
+    if (!isMirroring(signal)) {
+        return false;
+    }
+    reading = findChunk(signal)->m_slots[signal % CHUNK_SIZE].read();
+    return true;
+}
+
+SignalMirror::Chunk* SignalMirror::findChunk(SignalHandle_t signal) const {
+    if (signal >= MAX_NUM_SIGNALS) {
+        return nullptr;
+    }
+    return m_chunks[signal / CHUNK_SIZE].load(std::memory_order_acquire);
+}
+
+} // namespace velocitas
@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/SignalPathRegistry.h"
+
+#include <mutex>
+#include <stdexcept>
+
+namespace velocitas {
+
+SignalPathRegistry& SignalPathRegistry::getInstance() {
+    static SignalPathRegistry instance;
+    return instance;
+}
+
+SignalPathRegistry::~SignalPathRegistry() {
+    for (auto& chunk : m_chunks) {
+        delete[] chunk.load(); // NOLINT(cppcoreguidelines-owning-memory)
+    }
+}
+
+SignalHandle_t SignalPathRegistry::intern(std::string_view path) {
+    if (auto handle = find(path)) {
+        return *handle;
+    }
+
+    std::unique_lock lock(m_mutex);
+    if (auto iter = m_handles.find(path); iter != m_handles.end()) {
+        return iter->second;
+    }
+    const auto handle     = m_size.load(std::memory_order_relaxed);
+    const auto chunkIndex = handle / CHUNK_SIZE;
+    if (chunkIndex >= MAX_CHUNKS) {
+        throw std::length_error("SignalPathRegistry: too many signal paths");
+    }
+    auto* chunk = m_chunks[chunkIndex].load(std::memory_order_relaxed);
+    if (chunk == nullptr) {
+        chunk = new std::string[CHUNK_SIZE]; // NOLINT(cppcoreguidelines-owning-memory)
+        m_chunks[chunkIndex].store(chunk, std::memory_order_release);
+    }
+    auto& storedPath = chunk[handle % CHUNK_SIZE];
+    storedPath       = path;
+    m_handles.emplace(storedPath, static_cast<SignalHandle_t>(handle));
+    m_size.store(handle + 1, std::memory_order_release);
+    return static_cast<SignalHandle_t>(handle);
+}
+
+std::optional<SignalHandle_t> SignalPathRegistry::find(std::string_view path) const {
+    std::shared_lock lock(m_mutex);
+    if (auto iter = m_handles.find(path); iter != m_handles.end()) {
+        return iter->second;
+    }
+    return std::nullopt;
+}
+
+const std::string& SignalPathRegistry::getPath(SignalHandle_t handle) const {
+    if (handle >= m_size.load(std::memory_order_acquire)) {
+        throw std::out_of_range("SignalPathRegistry: unknown signal handle");
+    }
+    return m_chunks[handle / CHUNK_SIZE].load(std::memory_order_acquire)[handle % CHUNK_SIZE];
+}
+
+} // namespace velocitas
@@ -0,0 +1,60 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/SignalTable.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace velocitas {
+
+SignalTable::SignalTable(const SignalDescriptor* descriptors, size_t size)
+    : m_descriptors(descriptors)
+    , m_size(size) {
+    auto& registry = SignalPathRegistry::getInstance();
+    m_handles.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+        m_handles.push_back(registry.intern(descriptors[i].path));
+    }
+}
+
+const SignalDescriptor& SignalTable::getDescriptor(size_t index) const {
+    if (index >= m_size) {
+        throw std::out_of_range("Signal index outside of the signal table");
+    }
+    return m_descriptors[index];
+}
+
+SignalHandle_t SignalTable::getHandle(size_t index) const { return m_handles.at(index); }
+
+std::optional<size_t> SignalTable::findIndex(SignalHandle_t handle) const {
+    const auto iter = std::find(m_handles.cbegin(), m_handles.cend(), handle);
+    if (iter == m_handles.cend()) {
+        return std::nullopt;
+    }
+    return static_cast<size_t>(iter - m_handles.cbegin());
+}
+
+std::vector<std::string> SignalTable::getSignalPaths() const {
+    std::vector<std::string> paths;
+    paths.reserve(m_size);
+    for (size_t i = 0; i < m_size; ++i) {
+        paths.emplace_back(m_descriptors[i].path);
+    }
+    return paths;
+}
+
+} // namespace velocitas
@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/Strand.h"
+#include "sdk/Logger.h"
+#include "sdk/ThreadPool.h"
+
+#include <string>
+
+namespace velocitas {
+
+namespace {
+// upper limit of functions executed per scheduling of a strand, so a busy strand does not starve
+// the other jobs of the pool
+constexpr size_t MAX_JOBS_PER_RUN = 16;
+
+thread_local const Strand* currentStrand{nullptr};
+} // namespace
+
+Strand::Strand(std::shared_ptr<ThreadPool> threadPool, JobPriority priority)
+    : m_threadPool(threadPool ? std::move(threadPool) : ThreadPool::getInstance())
+    , m_priority(priority) {}
+
+std::shared_ptr<Strand> Strand::create(std::shared_ptr<ThreadPool> threadPool,
+                                       JobPriority                 priority) {
+    return std::shared_ptr<Strand>(new Strand(std::move(threadPool), priority));
+}
+
+void Strand::post(JobFunction fun) {
+    auto job = push(std::move(fun));
+    if (job) {
+        m_threadPool->enqueue(std::move(job));
+    }
+}
+
+JobPtr_t Strand::push(JobFunction fun) {
+    std::lock_guard lock{m_mutex};
+    m_pendingJobs.push_back(std::move(fun));
+    if (m_isScheduled) {
+        return {};
+    }
+    m_isScheduled = true;
+    return createProcessingJob();
+}
+
+bool Strand::isRunningInThisThread() const { return currentStrand == this; }
+
+size_t Strand::getNumPendingJobs() const {
+    std::lock_guard lock{m_mutex};
+    return m_pendingJobs.size();
+}
+
+JobPtr_t Strand::createProcessingJob() {
+    auto job = LightJob::create([self = shared_from_this()]() { self->processPendingJobs(); });
+    job->setPriority(m_priority);
+    return job;
+}
+
+void Strand::processPendingJobs() {
+    const auto* const previousStrand = currentStrand;
+    currentStrand                    = this;
+    for (size_t i = 0; i < MAX_JOBS_PER_RUN; ++i) {
+        JobFunction fun;
+        {
+            std::lock_guard lock{m_mutex};
+            if (m_pendingJobs.empty()) {
+                m_isScheduled = false;
+                currentStrand = previousStrand;
+                return;
+            }
+            fun = std::move(m_pendingJobs.front());
+            m_pendingJobs.pop_front();
+        }
+        try {
+            fun();
+        } catch (const std::exception& e) {
+            logger().error("[Strand] Uncaught exception during job execution: " +
+                           std::string(e.what()));
+        } catch (...) {
+            logger().error(std::string("[Strand] Uncaught unknown exception during job execution"));
+        }
+    }
+    currentStrand = previousStrand;
+
+    {
+        std::lock_guard lock{m_mutex};
+        if (m_pendingJobs.empty()) {
+            m_isScheduled = false;
+            return;
+        }
+    }
+    // stay scheduled, but give the other jobs of the pool a chance to run
+    m_threadPool->enqueue(createProcessingJob());
+}
+
+} // namespace velocitas
@@ -16,99 +16,870 @@
 
 #include "sdk/ThreadPool.h"
 #include "sdk/Logger.h"
+#include "sdk/Metrics.h"
+#include "sdk/TimerWheel.h"
+#include "sdk/TraceEvents.h"
+#include "sdk/Utils.h"
 
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstring>
+#include <limits>
+#include <map>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 namespace velocitas {
 
-ThreadPool::ThreadPool(size_t numWorkerThreads)
-    : m_jobs(&lowerJobPriority)
-    , m_workerThreads{numWorkerThreads} {
-    for (size_t i = 0; i < numWorkerThreads; ++i) {
-        m_workerThreads[i] = std::thread([this]() { threadLoop(); });
+namespace {
+constexpr Clock::rep NO_DELAYED_JOB_DUE = std::numeric_limits<Clock::rep>::max();
+
+// interval of checking whether a pool being shut down got idle
+constexpr std::chrono::milliseconds DRAIN_POLL_INTERVAL{1};
+
+// identifies the pool and worker the current thread belongs to (if any)
+thread_local const ThreadPool* currentPool{nullptr};
+thread_local size_t            currentWorkerIndex{0};
+
+SchedulingMode getSchedulingModeFromEnv() {
+    const auto modeName = StringUtils::toLower(getEnvVar("SDV_THREADPOOL_SCHEDULING_MODE"));
+    if (modeName == "work_stealing") {
+        return SchedulingMode::WORK_STEALING;
+    }
+    if (!modeName.empty() && modeName != "shared_queue") {
+        logger().warn("[ThreadPool] Unknown scheduling mode '{}', using shared_queue", modeName);
+    }
+    return SchedulingMode::SHARED_QUEUE;
+}
+
+// metric label of each JobPriority
+constexpr std::array<const char*, NUM_JOB_PRIORITIES> PRIORITY_NAMES{"high", "normal", "low"};
+
+// Linux limits thread names to 15 characters plus terminating zero
+constexpr size_t MAX_THREAD_NAME_LENGTH = 15;
+
+MetricSnapshot createPoolMetric(const std::string& name, const std::string& help, MetricType type,
+                                const std::string& poolName, double value = 0.0) {
+    MetricSnapshot metric;
+    metric.name   = name;
+    metric.help   = help;
+    metric.type   = type;
+    metric.labels = {{"pool", poolName}};
+    metric.value  = value;
+    return metric;
+}
+
+void addPoolMetrics(std::vector<MetricSnapshot>& metrics, const std::string& poolName,
+                    const ThreadPoolMetrics& poolMetrics) {
+    metrics.push_back(createPoolMetric("sdv_threadpool_queue_depth",
+                                       "Number of executable jobs waiting for a worker",
+                                       MetricType::GAUGE, poolName,
+                                       static_cast<double>(poolMetrics.currentQueueDepth)));
+    metrics.push_back(createPoolMetric("sdv_threadpool_executed_jobs_total",
+                                       "Number of jobs executed by the pool", MetricType::COUNTER,
+                                       poolName,
+                                       static_cast<double>(poolMetrics.numExecutedJobs)));
+    metrics.push_back(createPoolMetric("sdv_threadpool_failed_jobs_total",
+                                       "Number of job executions which threw an exception",
+                                       MetricType::COUNTER, poolName,
+                                       static_cast<double>(poolMetrics.numFailedJobs)));
+    double utilization{0.0};
+    for (const auto& worker : poolMetrics.workers) {
+        utilization += worker.utilization;
+    }
+    if (!poolMetrics.workers.empty()) {
+        utilization /= static_cast<double>(poolMetrics.workers.size());
+    }
+    metrics.push_back(createPoolMetric("sdv_threadpool_utilization",
+                                       "Mean ratio of the time the workers are busy, in [0, 1]",
+                                       MetricType::GAUGE, poolName, utilization));
+
+    auto schedulingLatency = createPoolMetric(
+        "sdv_threadpool_scheduling_latency_nanoseconds",
+        "Time from a job becoming executable until its execution started", MetricType::HISTOGRAM,
+        poolName);
+    schedulingLatency.histogram = poolMetrics.schedulingLatency;
+    metrics.push_back(std::move(schedulingLatency));
+    for (size_t priority = 0; priority < NUM_JOB_PRIORITIES; ++priority) {
+        auto priorityLatency = createPoolMetric(
+            "sdv_threadpool_priority_scheduling_latency_nanoseconds",
+            "Time from a job of a priority class becoming executable until its execution started",
+            MetricType::HISTOGRAM, poolName);
+        priorityLatency.labels.emplace_back("priority", PRIORITY_NAMES[priority]);
+        priorityLatency.histogram = poolMetrics.schedulingLatencyByPriority[priority];
+        metrics.push_back(std::move(priorityLatency));
+    }
+    auto executionTime =
+        createPoolMetric("sdv_threadpool_execution_time_nanoseconds",
+                         "Duration of the job executions", MetricType::HISTOGRAM, poolName);
+    executionTime.histogram = poolMetrics.executionTime;
+    metrics.push_back(std::move(executionTime));
+}
+
+class PoolRegistry {
+public:
+    static PoolRegistry& get() {
+        static PoolRegistry registry;
+        return registry;
+    }
+
+    PoolRegistry()
+        : m_metricsCollector(MetricsRegistry::getInstance().addCollector(
+              [this](std::vector<MetricSnapshot>& metrics) { collectMetrics(metrics); })) {}
+
+    std::shared_ptr<ThreadPool> getPool(const std::string& name) {
+        std::lock_guard lock{m_mutex};
+        auto            resolvedIter = m_resolvedPools.find(name);
+        if (resolvedIter != m_resolvedPools.end()) {
+            return resolvedIter->second;
+        }
+        const bool isConfigured = m_configs.find(name) != m_configs.end();
+        // pools not being configured separately share the default pool
+        auto pool = getOrCreatePool(isConfigured ? name : ThreadPool::DEFAULT_POOL);
+        m_resolvedPools.emplace(name, pool);
+        return pool;
+    }
+
+    bool configure(const ThreadPoolConfig& config) {
+        std::lock_guard lock{m_mutex};
+        // once a name was resolved (possibly to the default pool), its users keep their pool
+        if (m_pools.find(config.name) != m_pools.end() ||
+            m_resolvedPools.find(config.name) != m_resolvedPools.end()) {
+            return false;
+        }
+        m_configs[config.name] = config;
+        return true;
+    }
+
+private:
+    std::shared_ptr<ThreadPool> getOrCreatePool(const std::string& name) {
+        auto poolIter = m_pools.find(name);
+        if (poolIter != m_pools.end()) {
+            return poolIter->second;
+        }
+        auto configIter = m_configs.find(name);
+        if (configIter == m_configs.end()) {
+            ThreadPoolConfig defaultConfig;
+            defaultConfig.name           = ThreadPool::DEFAULT_POOL;
+            defaultConfig.schedulingMode = getSchedulingModeFromEnv();
+            configIter                   = m_configs.emplace(name, defaultConfig).first;
+        }
+        auto pool = std::make_shared<ThreadPool>(configIter->second);
+        m_pools.emplace(name, pool);
+        return pool;
+    }
+
+    void collectMetrics(std::vector<MetricSnapshot>& metrics) {
+        std::lock_guard lock{m_mutex};
+        for (const auto& [name, pool] : m_pools) {
+            addPoolMetrics(metrics, name, pool->getMetrics());
+        }
+    }
+
+    std::mutex                                         m_mutex;
+    std::map<std::string, ThreadPoolConfig>            m_configs;
+    std::map<std::string, std::shared_ptr<ThreadPool>> m_pools;
+    // pool handed out per requested name, including the names sharing the default pool
+    std::map<std::string, std::shared_ptr<ThreadPool>> m_resolvedPools;
+    // declared last, so it is removed before the pools are destroyed
+    MetricsCollectorHandle m_metricsCollector;
+};
+} // namespace
+
+ThreadPool::ThreadPool(size_t numWorkerThreads, SchedulingMode schedulingMode)
+    : ThreadPool(ThreadPoolConfig{"", numWorkerThreads, schedulingMode, {}, 0}) {}
+
+ThreadPool::ThreadPool(ThreadPoolConfig config)
+    : m_config(std::move(config))
+    , m_timerWheel(std::make_unique<TimerWheel>())
+    , m_workerThreads{m_config.numWorkerThreads}
+    , m_nextDelayedJobDue{NO_DELAYED_JOB_DUE}
+    , m_metricsStart{Clock::now().time_since_epoch().count()} {
+    const auto numWorkerThreads = m_config.numWorkerThreads;
+    m_workerStatistics.resize(numWorkerThreads);
+    for (auto& statistics : m_workerStatistics) {
+        statistics = std::make_unique<WorkerStatistics>();
+    }
+    if (m_config.schedulingMode == SchedulingMode::WORK_STEALING) {
+        // keep at least one queue, so jobs enqueued to a pool without workers have a place to go
+        m_workerQueues.resize(std::max<size_t>(numWorkerThreads, 1));
+        for (auto& queue : m_workerQueues) {
+            queue = std::make_unique<WorkerQueue>();
+        }
+        for (size_t i = 0; i < numWorkerThreads; ++i) {
+            m_workerThreads[i] = std::thread([this, i]() {
+                applyThreadSettings(i);
+                workStealingThreadLoop(i);
+            });
+        }
+    } else {
+        for (size_t i = 0; i < numWorkerThreads; ++i) {
+            m_workerThreads[i] = std::thread([this, i]() {
+                applyThreadSettings(i);
+                threadLoop(i);
+            });
+        }
     }
 }
 
 ThreadPool::ThreadPool()
-    : ThreadPool(2) {}
+    : ThreadPool(PROFILE_NUM_WORKER_THREADS) {}
+
+void ThreadPool::applyThreadSettings(size_t workerIndex) const {
+#ifdef __linux__
+    if (!m_config.name.empty()) {
+        auto threadName = fmt::format("{}-{}", m_config.name, workerIndex);
+        if (threadName.size() > MAX_THREAD_NAME_LENGTH) {
+            threadName.resize(MAX_THREAD_NAME_LENGTH);
+        }
+        pthread_setname_np(pthread_self(), threadName.c_str());
+    }
+    if (!m_config.cpuAffinity.empty()) {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for (const auto cpu : m_config.cpuAffinity) {
+            CPU_SET(cpu, &cpuSet);
+        }
+        const auto result = pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+        if (result != 0) {
+            logger().warn("[ThreadPool] Cannot set CPU affinity of pool '{}': {}", m_config.name,
+                          std::strerror(result));
+        }
+    }
+    if (m_config.realtimePriority > 0) {
+        sched_param param{};
+        param.sched_priority = m_config.realtimePriority;
+        const auto result    = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+        if (result != 0) {
+            logger().warn("[ThreadPool] Cannot set SCHED_FIFO priority {} of pool '{}': {}",
+                          m_config.realtimePriority, m_config.name, std::strerror(result));
+        }
+    }
+#else
+    (void)workerIndex;
+    if (!m_config.cpuAffinity.empty() || m_config.realtimePriority > 0) {
+        logger().warn("[ThreadPool] CPU affinity and priority are not supported on this platform");
+    }
+#endif
+}
 
-ThreadPool::~ThreadPool() {
+ThreadPool::~ThreadPool() { stopWorkers(); }
+
+size_t ThreadPool::stopWorkers() {
+    size_t numDroppedJobs = 0;
     {
         std::lock_guard lock{m_queueMutex};
         m_isRunning = false;
-        // empty the job queue (std::priority_queue does not offer a clear function)
-        QueueType().swap(m_jobs);
+        numDroppedJobs += m_jobs.size();
+        m_jobs.clear();
+        m_timerWheel.reset();
+    }
+    for (auto& queue : m_workerQueues) {
+        std::lock_guard lock{queue->m_mutex};
+        numDroppedJobs += queue->m_jobs.size();
+        queue->m_jobs.clear();
     }
     m_cv.notify_all();
 
     for (auto& thread : m_workerThreads) {
-        thread.join();
+        if (!thread.joinable()) {
+            continue;
+        }
+        if (thread.get_id() == std::this_thread::get_id()) {
+            // One of our own jobs dropped the last reference to the pool (e.g. a strand owning
+            // it), while executing or when being released. A worker cannot join itself: detach it
+            // and let it leave its loop right away, without touching the pool anymore.
+            thread.detach();
+            currentPool = nullptr;
+        } else {
+            thread.join();
+        }
+    }
+    return numDroppedJobs;
+}
+
+ThreadPoolShutdownReport ThreadPool::shutdown(std::chrono::milliseconds timeout) {
+    ThreadPoolShutdownReport report;
+    if (m_isShutDown.exchange(true)) {
+        return report;
+    }
+    const auto numExecutedJobs = getNumExecutedJobs();
+    m_isAccepting              = false;
+    {
+        std::lock_guard lock{m_queueMutex};
+        report.numDroppedDelayedJobs = m_timerWheel->size();
+        m_timerWheel                 = std::make_unique<TimerWheel>();
+        updateNextDelayedJobDue();
+        ++m_delayedJobsGeneration;
+    }
+    m_cv.notify_all();
+
+    report.isDrained       = waitUntilIdle(timeout);
+    report.numDroppedJobs  = stopWorkers();
+    report.numDrainedJobs  = getNumExecutedJobs() - numExecutedJobs;
+    report.numRejectedJobs = m_numRejectedJobs.load();
+    if (!report.isDrained || report.numDroppedDelayedJobs > 0) {
+        logger().warn("[ThreadPool] Pool '{}' shut down: dropped {} executable and {} delayed jobs",
+                      m_config.name, report.numDroppedJobs, report.numDroppedDelayedJobs);
+    }
+    return report;
+}
+
+bool ThreadPool::isAccepting(const IJob& job) const {
+    // while draining, the jobs being drained may still enqueue their immediate continuations
+    return m_isAccepting.load() || (currentPool == this && job.isDue());
+}
+
+bool ThreadPool::waitUntilIdle(std::chrono::milliseconds timeout) const {
+    const auto deadline = Clock::now() + timeout;
+    while (!isIdle()) {
+        if (Clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(DRAIN_POLL_INTERVAL);
+    }
+    return true;
+}
+
+bool ThreadPool::isIdle() const {
+    const size_t numOwnJobs = (currentPool == this) ? 1 : 0;
+    if (m_numExecutingJobs.load() > numOwnJobs) {
+        return false;
+    }
+    if (m_config.schedulingMode == SchedulingMode::WORK_STEALING) {
+        return m_numImmediateJobs.load() == 0;
     }
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+    return m_jobs.empty();
+}
+
+uint64_t ThreadPool::getNumExecutedJobs() const {
+    uint64_t numExecutedJobs = 0;
+    for (const auto& statistics : m_workerStatistics) {
+        numExecutedJobs += statistics->m_numExecutedJobs.load(std::memory_order_relaxed);
+    }
+    return numExecutedJobs;
 }
 
 std::shared_ptr<ThreadPool> ThreadPool::getInstance() {
-    static std::shared_ptr<ThreadPool> instance{std::make_shared<ThreadPool>()};
+    // resolved once, as this is called on hot paths; the default pool never changes once created
+    static const auto instance = getInstance(DEFAULT_POOL);
     return instance;
 }
 
+std::shared_ptr<ThreadPool> ThreadPool::getInstance(const std::string& name) {
+    return PoolRegistry::get().getPool(name);
+}
+
+bool ThreadPool::configure(const ThreadPoolConfig& config) {
+    if (!PoolRegistry::get().configure(config)) {
+        logger().warn("[ThreadPool] Pool '{}' already in use, ignoring its configuration",
+                      config.name);
+        return false;
+    }
+    return true;
+}
+
 size_t ThreadPool::getNumWorkerThreads() const { return m_workerThreads.size(); }
 
 void ThreadPool::enqueue(JobPtr_t job) {
     if (job) {
-        std::lock_guard<std::mutex> lock(m_queueMutex);
-        m_jobs.push(std::move(job));
-        m_cv.notify_one();
+        if (!isAccepting(*job)) {
+            m_numRejectedJobs.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        if (!job->isDue()) {
+            enqueueDelayedJob(std::move(job));
+            return;
+        }
+        job->m_timepointReady = Clock::now();
+        if (m_config.schedulingMode == SchedulingMode::WORK_STEALING) {
+            enqueueImmediateJob(std::move(job));
+        } else {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            m_jobs.push(std::move(job));
+            recordQueueDepth(m_jobs.size());
+            m_cv.notify_one();
+        }
     } else {
         logger().error("[ThreadPool::enqueue] Ignoring nullptr Job!");
         assert(job);
     }
 }
 
+void ThreadPool::enqueueBatch(std::vector<JobPtr_t> jobs) {
+    const bool useSharedQueue = m_config.schedulingMode == SchedulingMode::SHARED_QUEUE;
+
+    // Delayed jobs go into the timer wheel, immediate ones into the shared queue, both within one
+    // lock. For work stealing, the immediate ones are compacted at the front of the vector and
+    // distributed to the worker queues afterwards.
+    auto       immediateEnd     = jobs.begin();
+    size_t     numImmediateJobs = 0;
+    const auto now              = Clock::now();
+    {
+        std::unique_lock<std::mutex> lock(m_queueMutex, std::defer_lock);
+        if (useSharedQueue) {
+            lock.lock();
+        }
+        bool anyDelayedJob = false;
+        for (auto& job : jobs) {
+            if (!job) {
+                logger().error("[ThreadPool::enqueueBatch] Ignoring nullptr Job!");
+            } else if (!isAccepting(*job)) {
+                m_numRejectedJobs.fetch_add(1, std::memory_order_relaxed);
+            } else if (job->isDue()) {
+                ++numImmediateJobs;
+                job->m_timepointReady = now;
+                if (useSharedQueue) {
+                    m_jobs.push(std::move(job));
+                } else {
+                    *immediateEnd++ = std::move(job);
+                }
+            } else {
+                if (!lock.owns_lock()) {
+                    lock.lock();
+                }
+                if (m_isRunning) {
+                    const auto timepointDue = job->getTimepointToExecute();
+                    m_timerWheel->arm(std::move(job), timepointDue);
+                    anyDelayedJob = true;
+                }
+            }
+        }
+        if (useSharedQueue && numImmediateJobs > 0) {
+            recordQueueDepth(m_jobs.size());
+        }
+        if (anyDelayedJob) {
+            updateNextDelayedJobDue();
+            ++m_delayedJobsGeneration;
+            m_cv.notify_one();
+        }
+    }
+
+    if (numImmediateJobs > 0) {
+        if (useSharedQueue) {
+            wakeUpWorkers(numImmediateJobs);
+        } else {
+            enqueueImmediateJobs(jobs.begin(), immediateEnd);
+        }
+    }
+}
+
+void ThreadPool::wakeUpWorkers(size_t numJobs) const {
+    if (numJobs >= m_workerThreads.size()) {
+        m_cv.notify_all();
+    } else {
+        for (size_t i = 0; i < numJobs; ++i) {
+            m_cv.notify_one();
+        }
+    }
+}
+
+void ThreadPool::post(JobFunction fun, std::chrono::milliseconds delay, JobPriority priority) {
+    auto job = LightJob::create(std::move(fun), delay);
+    job->setPriority(priority);
+    enqueue(std::move(job));
+}
+
+bool ThreadPool::cancel(const JobPtr_t& job) {
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+    if (!m_timerWheel || !m_timerWheel->cancel(job.get())) {
+        return false;
+    }
+    updateNextDelayedJobDue();
+    return true;
+}
+
+void ThreadPool::enqueueDelayedJob(JobPtr_t job) {
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+    if (!m_isRunning) {
+        return;
+    }
+    const auto timepointDue = job->getTimepointToExecute();
+    m_timerWheel->arm(std::move(job), timepointDue);
+    updateNextDelayedJobDue();
+    ++m_delayedJobsGeneration;
+    m_cv.notify_one();
+}
+
+void ThreadPool::updateNextDelayedJobDue() {
+    const auto nextExpiry = m_timerWheel->getNextExpiry();
+    m_nextDelayedJobDue =
+        nextExpiry ? nextExpiry->time_since_epoch().count() : NO_DELAYED_JOB_DUE;
+}
+
+void ThreadPool::collectDueDelayedJobs(std::vector<JobPtr_t>& dueJobs) {
+    if (m_timerWheel && Clock::now().time_since_epoch().count() >= m_nextDelayedJobDue.load()) {
+        const auto numCollectedJobs = dueJobs.size();
+        m_timerWheel->advance(Clock::now(), dueJobs);
+        updateNextDelayedJobDue();
+        // delayed jobs are waiting for a worker since they became due, not since being collected
+        for (auto iter = dueJobs.begin() + static_cast<std::ptrdiff_t>(numCollectedJobs);
+             iter != dueJobs.end(); ++iter) {
+            (*iter)->m_timepointReady = (*iter)->getTimepointToExecute();
+        }
+    }
+}
+
 JobPtr_t ThreadPool::getNextExecutableJob() {
     JobPtr_t                    job;
+    std::vector<JobPtr_t>       dueJobs;
     std::lock_guard<std::mutex> lock(m_queueMutex);
-    if (!m_jobs.empty() && m_jobs.top()->isDue()) {
-        job = m_jobs.top();
-        m_jobs.pop();
+    collectDueDelayedJobs(dueJobs);
+    if (!dueJobs.empty()) {
+        for (auto& dueJob : dueJobs) {
+            m_jobs.push(std::move(dueJob));
+        }
+        recordQueueDepth(m_jobs.size());
+        if (dueJobs.size() > 1) {
+            m_cv.notify_all();
+        }
+    }
+    job = m_jobs.pop(m_config.starvationLimit);
+    if (job) {
+        m_numExecutingJobs.fetch_add(1);
     }
     return job;
 }
 
 void ThreadPool::waitForPotentiallyExecutableJob() const {
     std::unique_lock<std::mutex> lock(m_queueMutex);
-    if (m_jobs.empty()) {
-        m_cv.wait(lock, [this] { return !m_jobs.empty() || !m_isRunning; });
+    const auto                   generation  = m_delayedJobsGeneration;
+    const auto                   hasWorkToDo = [this, generation] {
+        return !m_jobs.empty() || !m_isRunning || m_delayedJobsGeneration != generation;
+    };
+    const auto nextExpiry = m_timerWheel ? m_timerWheel->getNextExpiry() : std::nullopt;
+    if (nextExpiry) {
+        m_cv.wait_until(lock, *nextExpiry, hasWorkToDo);
     } else {
-        auto timepointToExecuteNextJob = m_jobs.top()->getTimepointToExecute();
-        m_cv.wait_until(lock, timepointToExecuteNextJob);
+        m_cv.wait(lock, hasWorkToDo);
+    }
+}
+
+void ThreadPool::enqueueImmediateJob(JobPtr_t job) {
+    // jobs enqueued by one of our own workers (e.g. recurring jobs or continuations) stay local,
+    // all others are distributed round robin
+    const size_t queueIndex = (currentPool == this)
+                                  ? currentWorkerIndex
+                                  : m_nextWorkerQueue.fetch_add(1) % m_workerQueues.size();
+    {
+        auto&                       queue = *m_workerQueues[queueIndex];
+        std::lock_guard<std::mutex> lock(queue.m_mutex);
+        queue.m_jobs.push(std::move(job));
+    }
+    recordQueueDepth(m_numImmediateJobs.fetch_add(1) + 1);
+
+    // Pairs with the increment of m_numIdleWorkers in waitForWork: either we see the idle worker
+    // here or the worker sees our job before going to sleep.
+    if (m_numIdleWorkers.load() > 0) {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_cv.notify_one();
     }
 }
 
+void ThreadPool::enqueueImmediateJobs(std::vector<JobPtr_t>::iterator begin,
+                                      std::vector<JobPtr_t>::iterator end) {
+    const auto numJobs    = static_cast<size_t>(std::distance(begin, end));
+    const auto numQueues  = m_workerQueues.size();
+    const auto firstQueue = m_nextWorkerQueue.fetch_add(numJobs);
+    // each queue gets every numQueues-th job, so each queue lock is taken once
+    for (size_t queueOffset = 0; queueOffset < std::min(numJobs, numQueues); ++queueOffset) {
+        auto& queue = *m_workerQueues[(firstQueue + queueOffset) % numQueues];
+        std::lock_guard<std::mutex> lock(queue.m_mutex);
+        for (size_t jobIndex = queueOffset; jobIndex < numJobs; jobIndex += numQueues) {
+            queue.m_jobs.push(std::move(*(begin + static_cast<std::ptrdiff_t>(jobIndex))));
+        }
+    }
+    recordQueueDepth(m_numImmediateJobs.fetch_add(numJobs) + numJobs);
+
+    // see enqueueImmediateJob
+    const auto numIdleWorkers = m_numIdleWorkers.load();
+    if (numIdleWorkers > 0) {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        wakeUpWorkers(std::min(numJobs, numIdleWorkers));
+    }
+}
+
+JobPtr_t ThreadPool::popOwnJob(size_t workerIndex) {
+    JobPtr_t                    job;
+    auto&                       queue = *m_workerQueues[workerIndex];
+    std::lock_guard<std::mutex> lock(queue.m_mutex);
+    job = queue.m_jobs.pop(m_config.starvationLimit);
+    if (job) {
+        // counted as executing before not being counted as queued, so the pool never seems idle
+        m_numExecutingJobs.fetch_add(1);
+        m_numImmediateJobs.fetch_sub(1);
+    }
+    return job;
+}
+
+JobPtr_t ThreadPool::popDueDelayedJob() {
+    if (Clock::now().time_since_epoch().count() < m_nextDelayedJobDue.load()) {
+        return {};
+    }
+    std::vector<JobPtr_t> dueJobs;
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        collectDueDelayedJobs(dueJobs);
+    }
+    if (dueJobs.empty()) {
+        return {};
+    }
+    m_numExecutingJobs.fetch_add(1);
+    // execute the first one right away, the others are distributed to the worker queues
+    if (dueJobs.size() > 1) {
+        enqueueImmediateJobs(std::next(dueJobs.begin()), dueJobs.end());
+    }
+    return std::move(dueJobs.front());
+}
+
+JobPtr_t ThreadPool::stealJob(size_t thiefIndex) {
+    JobPtr_t job;
+    for (size_t offset = 1; offset < m_workerQueues.size() && !job; ++offset) {
+        auto& victim = *m_workerQueues[(thiefIndex + offset) % m_workerQueues.size()];
+        std::unique_lock<std::mutex> lock(victim.m_mutex, std::try_to_lock);
+        if (lock.owns_lock() && !victim.m_jobs.empty()) {
+            // steal from the opposite end the owner is taking jobs from
+            job = victim.m_jobs.popBack();
+            m_numExecutingJobs.fetch_add(1);
+            m_numImmediateJobs.fetch_sub(1);
+        }
+    }
+    return job;
+}
+
+void ThreadPool::waitForWork() const {
+    std::unique_lock<std::mutex> lock(m_queueMutex);
+    m_numIdleWorkers.fetch_add(1);
+    const auto generation  = m_delayedJobsGeneration;
+    const auto hasWorkToDo = [this, generation] {
+        return m_numImmediateJobs.load() > 0 || !m_isRunning ||
+               m_delayedJobsGeneration != generation;
+    };
+    const auto nextExpiry = m_timerWheel ? m_timerWheel->getNextExpiry() : std::nullopt;
+    if (nextExpiry) {
+        m_cv.wait_until(lock, *nextExpiry, hasWorkToDo);
+    } else {
+        m_cv.wait(lock, hasWorkToDo);
+    }
+    m_numIdleWorkers.fetch_sub(1);
+}
+
+void ThreadPool::JobLanes::push(JobPtr_t job) {
+    m_lanes[static_cast<size_t>(job->getPriority())].push_back(std::move(job));
+    ++m_size;
+}
+
+JobPtr_t ThreadPool::JobLanes::pop(Clock::duration starvationLimit) {
+    if (m_size == 0) {
+        return {};
+    }
+    size_t lane = 0;
+    while (m_lanes[lane].empty()) {
+        ++lane;
+    }
+    // only if jobs of lower classes are waiting, the one waiting longest may be starving
+    if (starvationLimit > Clock::duration::zero() && m_lanes[lane].size() < m_size) {
+        auto oldestReady = Clock::now() - starvationLimit;
+        for (size_t lowerLane = lane + 1; lowerLane < NUM_JOB_PRIORITIES; ++lowerLane) {
+            const auto& jobs = m_lanes[lowerLane];
+            if (!jobs.empty() && jobs.front()->m_timepointReady < oldestReady) {
+                oldestReady = jobs.front()->m_timepointReady;
+                lane        = lowerLane;
+            }
+        }
+    }
+    auto job = std::move(m_lanes[lane].front());
+    m_lanes[lane].pop_front();
+    --m_size;
+    return job;
+}
+
+JobPtr_t ThreadPool::JobLanes::popBack() {
+    for (auto& jobs : m_lanes) {
+        if (!jobs.empty()) {
+            auto job = std::move(jobs.back());
+            jobs.pop_back();
+            --m_size;
+            return job;
+        }
+    }
+    return {};
+}
+
+void ThreadPool::JobLanes::clear() {
+    for (auto& jobs : m_lanes) {
+        jobs.clear();
+    }
+    m_size = 0;
+}
+
 namespace {
-void executeJob(JobPtr_t job) {
+bool executeJob(IJob& job) {
     try {
-        job->execute();
+        job.execute();
+        return true;
     } catch (const std::exception& e) {
         logger().error("[ThreadPool] Uncaught exception during job execution: " +
                        std::string(e.what()));
     } catch (...) {
         logger().error(std::string("[ThreadPool] Uncaught unknown exception during job execution"));
     }
+    return false;
+}
+
+uint64_t toNanoseconds(Clock::duration duration) {
+    const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(duration);
+    return nanoseconds.count() > 0 ? static_cast<uint64_t>(nanoseconds.count()) : 0;
 }
 } // namespace
 
-void ThreadPool::threadLoop() {
+void ThreadPool::recordQueueDepth(size_t queueDepth) {
+    m_queueDepth.record(queueDepth);
+    auto peakQueueDepth = m_peakQueueDepth.load(std::memory_order_relaxed);
+    while (queueDepth > peakQueueDepth &&
+           !m_peakQueueDepth.compare_exchange_weak(peakQueueDepth, queueDepth,
+                                                   std::memory_order_relaxed)) {
+    }
+}
+
+bool ThreadPool::runJob(size_t workerIndex, const JobPtr_t& job) {
+    VELOCITAS_TRACE_SPAN("threadpool", "ThreadPool::runJob");
+    const auto start             = Clock::now();
+    const auto schedulingLatency = toNanoseconds(start - job->m_timepointReady);
+    m_schedulingLatency.record(schedulingLatency);
+    m_schedulingLatencyByPriority[static_cast<size_t>(job->m_priority)].record(schedulingLatency);
+    const bool isExecuted = executeJob(*job);
+    // the job may have dropped the last reference to the pool, see stopWorkers()
+    if (currentPool != this) {
+        return false;
+    }
+    if (!isExecuted) {
+        m_numFailedJobs.fetch_add(1, std::memory_order_relaxed);
+    }
+    const auto executionTime = toNanoseconds(Clock::now() - start);
+    m_executionTime.record(executionTime);
+
+    auto& statistics = *m_workerStatistics[workerIndex];
+    statistics.m_numExecutedJobs.fetch_add(1, std::memory_order_relaxed);
+    statistics.m_busyTimeNs.fetch_add(executionTime, std::memory_order_relaxed);
+    return true;
+}
+
+ThreadPoolMetrics ThreadPool::getMetrics() const {
+    ThreadPoolMetrics metrics;
+    metrics.schedulingLatency = m_schedulingLatency.getSnapshot();
+    for (size_t priority = 0; priority < NUM_JOB_PRIORITIES; ++priority) {
+        metrics.schedulingLatencyByPriority[priority] =
+            m_schedulingLatencyByPriority[priority].getSnapshot();
+    }
+    metrics.executionTime     = m_executionTime.getSnapshot();
+    metrics.queueDepth        = m_queueDepth.getSnapshot();
+    metrics.peakQueueDepth    = m_peakQueueDepth.load(std::memory_order_relaxed);
+    metrics.numExecutedJobs   = metrics.executionTime.count;
+    metrics.numFailedJobs     = m_numFailedJobs.load(std::memory_order_relaxed);
+    if (m_config.schedulingMode == SchedulingMode::WORK_STEALING) {
+        metrics.currentQueueDepth = m_numImmediateJobs.load();
+    } else {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        metrics.currentQueueDepth = m_jobs.size();
+    }
+
+    const auto elapsedTime = Clock::now() - Timepoint(Clock::duration(m_metricsStart.load()));
+    metrics.elapsedTime    = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsedTime);
+    metrics.workers.reserve(m_workerStatistics.size());
+    for (const auto& statistics : m_workerStatistics) {
+        WorkerMetrics worker;
+        worker.numExecutedJobs = statistics->m_numExecutedJobs.load(std::memory_order_relaxed);
+        worker.busyTime =
+            std::chrono::nanoseconds(statistics->m_busyTimeNs.load(std::memory_order_relaxed));
+        if (metrics.elapsedTime.count() > 0) {
+            worker.utilization = std::min(1.0, static_cast<double>(worker.busyTime.count()) /
+                                                   static_cast<double>(metrics.elapsedTime.count()));
+        }
+        metrics.workers.push_back(worker);
+    }
+    return metrics;
+}
+
+void ThreadPool::resetMetrics() {
+    m_schedulingLatency.reset();
+    for (auto& histogram : m_schedulingLatencyByPriority) {
+        histogram.reset();
+    }
+    m_executionTime.reset();
+    m_queueDepth.reset();
+    m_peakQueueDepth.store(0, std::memory_order_relaxed);
+    m_numFailedJobs.store(0, std::memory_order_relaxed);
+    for (auto& statistics : m_workerStatistics) {
+        statistics->m_numExecutedJobs.store(0, std::memory_order_relaxed);
+        statistics->m_busyTimeNs.store(0, std::memory_order_relaxed);
+    }
+    m_metricsStart = Clock::now().time_since_epoch().count();
+}
+
+void ThreadPool::threadLoop(size_t workerIndex) {
+    currentPool        = this;
+    currentWorkerIndex = workerIndex;
     while (m_isRunning) {
         JobPtr_t job = getNextExecutableJob();
         if (job) {
-            executeJob(job);
-            if (job->shallRecur()) {
+            if (!runJob(workerIndex, job)) {
+                return;
+            }
+            // recurring jobs are not re-scheduled anymore once the pool is shutting down
+            if (job->shallRecur() && m_isAccepting) {
                 enqueue(job);
             }
+            m_numExecutingJobs.fetch_sub(1);
+            // releasing the job may destroy the pool, see stopWorkers()
+            job.reset();
+            if (currentPool != this) {
+                return;
+            }
         } else {
             waitForPotentiallyExecutableJob();
         }
     }
+    currentPool = nullptr;
+}
+
+void ThreadPool::workStealingThreadLoop(size_t workerIndex) {
+    currentPool        = this;
+    currentWorkerIndex = workerIndex;
+    while (m_isRunning) {
+        JobPtr_t job = popOwnJob(workerIndex);
+        if (!job) {
+            job = popDueDelayedJob();
+        }
+        if (!job) {
+            job = stealJob(workerIndex);
+        }
+        if (job) {
+            if (!runJob(workerIndex, job)) {
+                return;
+            }
+            // recurring jobs are not re-scheduled anymore once the pool is shutting down
+            if (job->shallRecur() && m_isAccepting) {
+                enqueue(job);
+            }
+            m_numExecutingJobs.fetch_sub(1);
+            // releasing the job may destroy the pool, see stopWorkers()
+            job.reset();
+            if (currentPool != this) {
+                return;
+            }
+        } else {
+            waitForWork();
+        }
+    }
+    currentPool = nullptr;
 }
 
 } // namespace velocitas
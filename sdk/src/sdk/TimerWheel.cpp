@@ -0,0 +1,197 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/TimerWheel.h"
+
+#include <algorithm>
+
+namespace velocitas {
+
+namespace {
+constexpr size_t SLOT_BITS = 6;
+static_assert(TimerWheel::NUM_SLOTS == (size_t{1} << SLOT_BITS));
+static_assert(TimerWheel::NUM_SLOTS <= 64, "Occupancy bitmask must fit into uint64_t");
+
+constexpr uint64_t slotBit(size_t slot) { return uint64_t{1} << slot; }
+
+constexpr size_t slotOf(int64_t tick, size_t level) {
+    return static_cast<size_t>(tick >> (SLOT_BITS * level)) & (TimerWheel::NUM_SLOTS - 1);
+}
+} // namespace
+
+TimerWheel::TimerWheel(std::chrono::milliseconds resolution, Timepoint start)
+    : m_resolution(std::max(std::chrono::nanoseconds(resolution), std::chrono::nanoseconds(1)))
+    , m_start(start) {}
+
+int64_t TimerWheel::toTick(Timepoint timepoint, bool roundUp) const {
+    const auto sinceStart =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(timepoint - m_start);
+    if (sinceStart.count() <= 0) {
+        return 0;
+    }
+    auto ticks = sinceStart / m_resolution;
+    if (roundUp && (sinceStart % m_resolution).count() != 0) {
+        ++ticks;
+    }
+    return ticks;
+}
+
+void TimerWheel::arm(JobPtr_t job, Timepoint timepointDue) {
+    const auto  tickDue = std::max(toTick(timepointDue, true), m_currentTick + 1);
+    const auto* jobKey  = job.get();
+    m_staging.push_back(Entry{std::move(job), tickDue, 0, 0});
+    auto entry = std::prev(m_staging.end());
+    m_index.emplace(jobKey, entry);
+    insert(m_staging, entry);
+}
+
+void TimerWheel::insert(Slot_t& source, Slot_t::iterator entry) {
+    const auto delta = entry->tickDue - m_currentTick;
+
+    size_t  level = 0;
+    int64_t span  = NUM_SLOTS;
+    while ((level < NUM_LEVELS - 1) && (delta >= span)) {
+        ++level;
+        span <<= SLOT_BITS;
+    }
+
+    size_t slot = 0;
+    if (delta <= 0) {
+        // only happens while cascading: the current slot is collected right afterwards
+        slot = slotOf(m_currentTick, 0);
+    } else if (delta >= span) {
+        // beyond the range of the wheel: park it in the top level slot which is cascaded last
+        slot = slotOf((m_currentTick >> (SLOT_BITS * level)) + NUM_SLOTS - 1, 0);
+    } else {
+        slot = slotOf(entry->tickDue, level);
+    }
+
+    entry->level = level;
+    entry->slot  = slot;
+    auto& target = m_slots[level][slot];
+    // splicing keeps the iterator stored in m_index valid
+    target.splice(target.end(), source, entry);
+    m_occupiedSlots[level] |= slotBit(slot);
+}
+
+void TimerWheel::cascade(size_t level) {
+    const auto slot = slotOf(m_currentTick, level);
+    if ((m_occupiedSlots[level] & slotBit(slot)) == 0) {
+        return;
+    }
+    Slot_t entries;
+    entries.splice(entries.end(), m_slots[level][slot]);
+    m_occupiedSlots[level] &= ~slotBit(slot);
+    while (!entries.empty()) {
+        insert(entries, entries.begin());
+    }
+}
+
+void TimerWheel::collectDueJobs(std::vector<JobPtr_t>& dueJobs) {
+    const auto slot = slotOf(m_currentTick, 0);
+    if ((m_occupiedSlots[0] & slotBit(slot)) == 0) {
+        return;
+    }
+    auto& entries = m_slots[0][slot];
+    for (auto entry = entries.begin(); entry != entries.end(); ++entry) {
+        auto range = m_index.equal_range(entry->job.get());
+        for (auto iter = range.first; iter != range.second; ++iter) {
+            if (iter->second == entry) {
+                m_index.erase(iter);
+                break;
+            }
+        }
+        dueJobs.push_back(std::move(entry->job));
+    }
+    entries.clear();
+    m_occupiedSlots[0] &= ~slotBit(slot);
+}
+
+void TimerWheel::advance(Timepoint now, std::vector<JobPtr_t>& dueJobs) {
+    const auto targetTick = toTick(now, false);
+    while (m_currentTick < targetTick) {
+        if (empty()) {
+            m_currentTick = targetTick;
+            break;
+        }
+        if (m_occupiedSlots[0] == 0) {
+            // nothing to collect in the lowest level: skip to the tick before the next cascade
+            const auto nextWrap = (m_currentTick | static_cast<int64_t>(NUM_SLOTS - 1)) + 1;
+            if (nextWrap > targetTick) {
+                m_currentTick = targetTick;
+                break;
+            }
+            m_currentTick = nextWrap - 1;
+        }
+
+        ++m_currentTick;
+        size_t topLevelToCascade = 0;
+        for (size_t level = 1; level < NUM_LEVELS; ++level) {
+            const auto lowerBitsMask = (int64_t{1} << (SLOT_BITS * level)) - 1;
+            if ((m_currentTick & lowerBitsMask) != 0) {
+                break;
+            }
+            topLevelToCascade = level;
+        }
+        for (size_t level = topLevelToCascade; level > 0; --level) {
+            cascade(level);
+        }
+        collectDueJobs(dueJobs);
+    }
+}
+
+std::optional<Timepoint> TimerWheel::getNextExpiry() const {
+    if (empty()) {
+        return std::nullopt;
+    }
+    std::optional<int64_t> nextTick;
+    for (size_t level = 0; level < NUM_LEVELS; ++level) {
+        if (m_occupiedSlots[level] == 0) {
+            continue;
+        }
+        const auto base = m_currentTick >> (SLOT_BITS * level);
+        for (size_t offset = 1; offset <= NUM_SLOTS; ++offset) {
+            if ((m_occupiedSlots[level] & slotBit(slotOf(base + offset, 0))) != 0) {
+                const auto tick = (base + static_cast<int64_t>(offset)) << (SLOT_BITS * level);
+                if (!nextTick || tick < *nextTick) {
+                    nextTick = tick;
+                }
+                break;
+            }
+        }
+    }
+    return m_start + std::chrono::duration_cast<Clock::duration>(m_resolution * (*nextTick));
+}
+
+bool TimerWheel::cancel(const IJob* job) {
+    auto range = m_index.equal_range(job);
+    if (range.first == range.second) {
+        return false;
+    }
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        const auto level     = iter->second->level;
+        const auto slotIndex = iter->second->slot;
+        auto&      slot      = m_slots[level][slotIndex];
+        slot.erase(iter->second);
+        if (slot.empty()) {
+            m_occupiedSlots[level] &= ~slotBit(slotIndex);
+        }
+    }
+    m_index.erase(range.first, range.second);
+    return true;
+}
+
+} // namespace velocitas
@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_TIMERWHEEL_H
+#define VEHICLE_APP_SDK_TIMERWHEEL_H
+
+#include "sdk/Job.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief Hierarchical timer wheel holding delayed jobs until they are due.
+ *
+ * Arming and cancelling a job are O(1) operations. Jobs are kept in slots of
+ * NUM_LEVELS wheels of NUM_SLOTS slots each, the wheel of level n covering NUM_SLOTS^(n+1)
+ * ticks. Jobs of higher levels are cascaded down to lower levels while time advances.
+ * Jobs being due later than the range covered by all levels are re-cascaded in the top level.
+ *
+ * The class is not thread-safe, callers need to serialize the access.
+ */
+class TimerWheel final {
+public:
+    static constexpr size_t NUM_LEVELS = 4;
+    static constexpr size_t NUM_SLOTS  = 64;
+
+    explicit TimerWheel(std::chrono::milliseconds resolution = std::chrono::milliseconds(1),
+                        Timepoint                 start      = Clock::now());
+
+    /**
+     * @brief Arm a timer executing the passed job at the given timepoint. Jobs being due
+     * already are reported by the next call to advance.
+     *
+     * @param job           The job to be scheduled.
+     * @param timepointDue  Point in time the job becomes due.
+     */
+    void arm(JobPtr_t job, Timepoint timepointDue);
+
+    /**
+     * @brief Remove all pending timers of the passed job.
+     *
+     * @param job  The job to be cancelled.
+     * @return true if at least one pending timer of the job was removed, false otherwise.
+     */
+    bool cancel(const IJob* job);
+
+    /**
+     * @brief Advance the wheel to the passed timepoint and collect all jobs being due until then.
+     * The due jobs are appended to the passed vector ordered by their due time.
+     *
+     * @param now      Timepoint to advance the wheel to.
+     * @param dueJobs  Vector the due jobs get appended to.
+     */
+    void advance(Timepoint now, std::vector<JobPtr_t>& dueJobs);
+
+    /**
+     * @brief Get the timepoint at which advance needs to be called next. This may be earlier
+     * than the point in time the next job becomes due, in case jobs need to be cascaded down
+     * from higher levels.
+     *
+     * @return the timepoint of the next wheel activity or std::nullopt if no timer is armed.
+     */
+    [[nodiscard]] std::optional<Timepoint> getNextExpiry() const;
+
+    [[nodiscard]] size_t size() const { return m_index.size(); }
+    [[nodiscard]] bool   empty() const { return m_index.empty(); }
+
+private:
+    struct Entry {
+        JobPtr_t job;
+        int64_t  tickDue;
+        size_t   level;
+        size_t   slot;
+    };
+    using Slot_t = std::list<Entry>;
+
+    void insert(Slot_t& source, Slot_t::iterator entry);
+    void cascade(size_t level);
+    void collectDueJobs(std::vector<JobPtr_t>& dueJobs);
+
+    [[nodiscard]] int64_t toTick(Timepoint timepoint, bool roundUp) const;
+
+    std::chrono::nanoseconds                               m_resolution;
+    Timepoint                                              m_start;
+    int64_t                                                m_currentTick{0};
+    std::array<std::array<Slot_t, NUM_SLOTS>, NUM_LEVELS>  m_slots;
+    std::array<uint64_t, NUM_LEVELS>                       m_occupiedSlots{};
+    std::unordered_multimap<const IJob*, Slot_t::iterator> m_index;
+    Slot_t                                                 m_staging;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_TIMERWHEEL_H
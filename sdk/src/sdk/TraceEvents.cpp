@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/TraceEvents.h"
+
+#include <fmt/core.h>
+#include <nlohmann/json.hpp>
+
+#include <fstream>
+#include <set>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace velocitas {
+
+namespace {
+
+std::string toJsonString(const char* text) {
+    return nlohmann::json(text != nullptr ? text : "").dump();
+}
+
+std::string getThreadName(uint32_t threadId) {
+    std::ifstream file(fmt::format("/proc/self/task/{}/comm", threadId));
+    std::string   name;
+    std::getline(file, name);
+    return name;
+}
+
+} // namespace
+
+TraceRecorder& TraceRecorder::getInstance() {
+    // intentionally leaked: threads may still record during destruction of static objects
+    static auto* instance = new TraceRecorder();
+    return *instance;
+}
+
+TraceRecorder::TraceRecorder(size_t capacity)
+    : m_buffer(capacity) {}
+
+void TraceRecorder::record(const TraceEvent& event) noexcept {
+    if (!isRecording()) {
+        return;
+    }
+    if (!m_buffer.tryPush(event)) {
+        m_numDroppedEvents.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+std::vector<TraceEvent> TraceRecorder::drain() {
+    std::vector<TraceEvent> events;
+    events.reserve(m_buffer.size());
+    while (auto event = m_buffer.tryPop()) {
+        events.push_back(*event);
+    }
+    return events;
+}
+
+void TraceRecorder::writeChromeJson(std::ostream& stream) {
+    const auto         events = drain();
+    const auto         pid    = static_cast<uint32_t>(::getpid());
+    std::set<uint32_t> threadIds;
+
+    stream << R"({"displayTimeUnit":"ns","traceEvents":[)";
+    const char* separator = "";
+    for (const auto& event : events) {
+        // timestamps and durations are given in microseconds
+        stream << separator
+               << fmt::format(
+                      R"({{"ph":"X","cat":{},"name":{},)"
+                      R"("ts":{:.3f},"dur":{:.3f},"pid":{},"tid":{}}})",
+                      toJsonString(event.category), toJsonString(event.name),
+                      static_cast<double>(event.startNs) / 1000.0,
+                      static_cast<double>(event.durationNs) / 1000.0, pid, event.threadId);
+        separator = ",\n";
+        threadIds.insert(event.threadId);
+    }
+    for (const auto threadId : threadIds) {
+        const auto name = getThreadName(threadId);
+        if (name.empty()) {
+            continue; // the thread terminated in the meantime
+        }
+        stream << separator
+               << fmt::format(
+                      R"({{"ph":"M","name":"thread_name",)"
+                      R"("pid":{},"tid":{},"args":{{"name":{}}}}})",
+                      pid, threadId, toJsonString(name.c_str()));
+        separator = ",\n";
+    }
+    stream << "]}\n";
+}
+
+bool TraceRecorder::writeChromeJsonFile(const std::string& path) {
+    std::ofstream file(path, std::ios::trunc);
+    writeChromeJson(file);
+    return file.good();
+}
+
+uint32_t TraceRecorder::getCurrentThreadId() noexcept {
+    thread_local const auto threadId = static_cast<uint32_t>(::syscall(SYS_gettid));
+    return threadId;
+}
+
+} // namespace velocitas
@@ -20,6 +20,7 @@
 #include <cctype>
 #include <cstdlib>
 #include <sstream>
+#include <string_view>
 
 namespace velocitas {
 
@@ -54,12 +55,44 @@ std::string StringUtils::join(const std::vector<std::string>& stringVector,
     return oss.str();
 }
 
+std::vector<std::string> StringUtils::split(const std::string& str, char separator) {
+    static constexpr std::string_view WHITESPACE = " \t\n\r";
+
+    std::vector<std::string> parts;
+    std::string_view         rest = str;
+    while (!rest.empty()) {
+        const auto       end  = rest.find(separator);
+        std::string_view part = rest.substr(0, end);
+        rest.remove_prefix(end == std::string_view::npos ? rest.size() : end + 1);
+
+        const auto first = part.find_first_not_of(WHITESPACE);
+        if (first != std::string_view::npos) {
+            part = part.substr(first, part.find_last_not_of(WHITESPACE) - first + 1);
+            parts.emplace_back(part);
+        }
+    }
+    return parts;
+}
+
 namespace {
 constexpr std::string_view SCHEME_PART_START           = "//";
 constexpr std::string_view SIMPLIFIED_SCHEME_SEPARATOR = "://";
+constexpr std::string_view UDS_SCHEME                  = "unix";
+constexpr std::string_view UDS_ABSTRACT_SCHEME         = "unix-abstract";
 } // namespace
 
 SimpleUrlParse::SimpleUrlParse(const std::string& url) {
+    // return the full URL if using Unix domain socket, which gRPC also accepts in the forms
+    // "unix:relative/path", "unix:/absolute/path" and "unix-abstract:name"
+    const auto lowerUrl = StringUtils::toLower(url);
+    for (const auto& udsScheme : {UDS_SCHEME, UDS_ABSTRACT_SCHEME}) {
+        if (lowerUrl.compare(0, udsScheme.length() + 1, std::string{udsScheme} + ":") == 0) {
+            m_scheme      = udsScheme;
+            m_netLocation = url;
+            return;
+        }
+    }
+
     auto schemeLen = url.find(SIMPLIFIED_SCHEME_SEPARATOR);
     if (schemeLen != std::string::npos) {
         m_scheme = StringUtils::toLower(url.substr(0, schemeLen));
@@ -67,12 +100,6 @@ SimpleUrlParse::SimpleUrlParse(const std::string& url) {
         schemeLen = 0;
     }
 
-    // return the full URL if using Unix domain socket
-    if (m_scheme == "unix") {
-        m_netLocation = url;
-        return;
-    }
-
     auto startOfSchemePart = url.find(SCHEME_PART_START, schemeLen);
     if (startOfSchemePart != std::string::npos) {
         startOfSchemePart += SCHEME_PART_START.length();
@@ -87,4 +114,8 @@ SimpleUrlParse::SimpleUrlParse(const std::string& url) {
     m_netLocation = url.substr(startOfSchemePart, netLocationLen);
 }
 
+bool SimpleUrlParse::isUnixDomainSocket() const {
+    return m_scheme == UDS_SCHEME || m_scheme == UDS_ABSTRACT_SCHEME;
+}
+
 } // namespace velocitas
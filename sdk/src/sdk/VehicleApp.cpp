@@ -16,8 +16,18 @@
 
 #include "sdk/VehicleApp.h"
 
+#include "sdk/CallbackExecutor.h"
+#include "sdk/DataPoint.h"
+#include "sdk/EventLoop.h"
+#include "sdk/Exceptions.h"
+#include "sdk/Executor.h"
 #include "sdk/IPubSubClient.h"
 #include "sdk/Logger.h"
+#include "sdk/Metrics.h"
+#include "sdk/SignalTable.h"
+#include "sdk/ThreadPool.h"
+#include "sdk/TraceEvents.h"
+#include "sdk/Utils.h"
 #include "sdk/VehicleModelContext.h"
 #include "sdk/middleware/Middleware.h"
 #include "sdk/vdb/IVehicleDataBrokerClient.h"
@@ -25,10 +35,66 @@
 #include <fmt/core.h>
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
+#include <future>
+#include <iterator>
 #include <string>
+#include <vector>
 
 namespace velocitas {
 
+namespace {
+
+using Clock_t = std::chrono::steady_clock;
+
+// maximum time the startup waits for the connection to the databroker, if signals are declared
+constexpr std::chrono::milliseconds PREPARE_TIMEOUT{10000};
+
+struct PrepareOutcome {
+    Status              m_status;
+    Clock_t::time_point m_completionTime;
+};
+
+double toMilliseconds(std::chrono::nanoseconds duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+// file the trace events are written to when the app stops; only used if they are compiled in
+constexpr char const* TRACE_FILE_ENV_VAR_NAME = "SDV_TRACE_FILE";
+
+void startTracingIfRequested() {
+    if constexpr (VELOCITAS_TRACE_EVENTS != 0) {
+        if (!getEnvVar(TRACE_FILE_ENV_VAR_NAME).empty()) {
+            TraceRecorder::getInstance().start();
+        }
+    }
+}
+
+void writeTraceIfRequested() {
+    if constexpr (VELOCITAS_TRACE_EVENTS != 0) {
+        auto& recorder = TraceRecorder::getInstance();
+        if (!recorder.isRecording()) {
+            return;
+        }
+        recorder.stop();
+        const auto path = getEnvVar(TRACE_FILE_ENV_VAR_NAME);
+        if (recorder.writeChromeJsonFile(path)) {
+            logger().info("Trace written to {} ({} events dropped).", path,
+                          recorder.getNumDroppedEvents());
+        } else {
+            logger().warn("Failed to write trace to {}", path);
+        }
+    }
+}
+
+std::chrono::milliseconds getRemainingTime(Clock_t::time_point deadline) {
+    const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline -
+                                                                                 Clock_t::now());
+    return std::max(remaining, std::chrono::milliseconds::zero());
+}
+
+} // namespace
+
 VehicleApp::VehicleApp(std::shared_ptr<IVehicleDataBrokerClient> vdbClient,
                        std::shared_ptr<IPubSubClient>            pubSubClient)
     : m_vdbClient(vdbClient)
@@ -38,19 +104,73 @@ VehicleApp::VehicleApp(std::shared_ptr<IVehicleDataBrokerClient> vdbClient,
 
 void VehicleApp::run() {
     logger().info("Starting app ...");
+    const auto startTime = Clock_t::now();
+    m_metricsExporter    = MetricsExporter::createFromEnvironment();
+    startTracingIfRequested();
     Middleware::getInstance().start();
     Middleware::getInstance().waitUntilReady();
+    const auto middlewareReadyTime = Clock_t::now();
+    m_startupMetrics.middleware    = middlewareReadyTime - startTime;
+
+    auto prepared = std::make_shared<std::promise<PrepareOutcome>>();
+    auto outcome  = prepared->get_future();
+    m_vdbClient->prepare(m_declaredSignals, PREPARE_TIMEOUT)
+        ->onResult([prepared](const Status& status) {
+            prepared->set_value({status, Clock_t::now()});
+        })
+        ->onError([prepared](const Status& status) {
+            prepared->set_value({status, Clock_t::now()});
+        });
+
+    // completes right away unless the databroker client connects at its creation (prewarming)
+    auto readiness = m_vdbClient->whenReady();
 
     if (m_pubSubClient) {
         m_pubSubClient->connect();
     }
-    onStart();
+    m_startupMetrics.pubSubConnect = Clock_t::now() - middlewareReadyTime;
+
+    // awaited, as its callbacks may be bound to the event loop not running yet
+    try {
+        readiness->await();
+    } catch (const AsyncException& e) {
+        logger().warn("Databroker client not ready: {}", e.what());
+    }
+
+    if (!m_declaredSignals.empty()) {
+        const auto result           = outcome.get();
+        m_startupMetrics.vdbPrepare = result.m_completionTime - middlewareReadyTime;
+        if (!result.m_status.ok()) {
+            logger().warn("Preparing the declared signals failed: {}",
+                          result.m_status.errorMessage());
+        }
+    }
+
+    // set before onStart, so a stop requested by it (or concurrently) is not overridden
     {
         std::unique_lock lk(m_stopWaitMutex);
         m_isRunning = true;
     }
-    logger().info("App is running.");
+    const auto onStartTime = Clock_t::now();
+    {
+        VELOCITAS_TRACE_SPAN("app", "VehicleApp::onStart");
+        onStart();
+    }
+    const auto runningTime   = Clock_t::now();
+    m_startupMetrics.onStart = runningTime - onStartTime;
+    m_startupMetrics.total   = runningTime - startTime;
+    logger().info("App is running (startup took {:.1f} ms: middleware {:.1f} ms, pub/sub connect "
+                  "{:.1f} ms, databroker {:.1f} ms, onStart {:.1f} ms).",
+                  toMilliseconds(m_startupMetrics.total),
+                  toMilliseconds(m_startupMetrics.middleware),
+                  toMilliseconds(m_startupMetrics.pubSubConnect),
+                  toMilliseconds(m_startupMetrics.vdbPrepare),
+                  toMilliseconds(m_startupMetrics.onStart));
 
+    if (m_eventLoop) {
+        // executes the callbacks until stop() stops the loop
+        m_eventLoop->run();
+    }
     {
         std::unique_lock lk(m_stopWaitMutex);
         m_stopWaitCV.wait(lk, [this] { return !m_isRunning; });
@@ -58,12 +178,36 @@ void VehicleApp::run() {
     logger().info("App stopped.");
 }
 
-void VehicleApp::stop() {
+void VehicleApp::stop() { stop(DEFAULT_STOP_TIMEOUT); }
+
+ShutdownReport VehicleApp::stop(std::chrono::milliseconds timeout) {
     logger().info("Stopping app ...");
 
-    onStop();
+    {
+        VELOCITAS_TRACE_SPAN("app", "VehicleApp::onStop");
+        onStop();
+    }
+    const auto     startTime = Clock_t::now();
+    const auto     deadline  = startTime + timeout;
+    ShutdownReport report;
+    report.numCancelledRequests = m_vdbClient->cancelPendingRequests();
+
+    // pools not being configured separately are the default pool, which is waited for only once
+    std::vector<std::shared_ptr<ThreadPool>> pools;
+    for (const auto* name : {ThreadPool::PUBSUB_POOL, ThreadPool::VDB_POOL,
+                             ThreadPool::METADATA_POOL, ThreadPool::DEFAULT_POOL}) {
+        auto pool = ThreadPool::getInstance(name);
+        if (std::find(pools.begin(), pools.end(), pool) == pools.end()) {
+            pools.push_back(std::move(pool));
+        }
+    }
+    report.isDrained = true;
+    for (const auto& pool : pools) {
+        report.isDrained = pool->waitUntilIdle(getRemainingTime(deadline)) && report.isDrained;
+    }
+    // in-flight jobs may still publish, hence pub/sub is drained only after them
     if (m_pubSubClient) {
-        m_pubSubClient->disconnect();
+        report.numDroppedPublishes = m_pubSubClient->drainAndDisconnect(getRemainingTime(deadline));
     }
     Middleware::getInstance().stop();
 
@@ -72,6 +216,87 @@ void VehicleApp::stop() {
         m_isRunning = false;
         m_stopWaitCV.notify_all();
     }
+    if (m_eventLoop) {
+        m_eventLoop->stop();
+    }
+    if (m_metricsExporter) {
+        // exports the final state of the metrics
+        m_metricsExporter->stop();
+    }
+    writeTraceIfRequested();
+    report.duration = Clock_t::now() - startTime;
+    if (report.numDroppedPublishes > 0 || report.numCancelledRequests > 0 || !report.isDrained) {
+        logger().warn("App stop took {:.1f} ms: dropped {} publishes, cancelled {} databroker "
+                      "requests, in-flight jobs {}.",
+                      toMilliseconds(report.duration), report.numDroppedPublishes,
+                      report.numCancelledRequests, report.isDrained ? "done" : "not done");
+    }
+    return report;
+}
+
+StartupMetrics VehicleApp::getStartupMetrics() const { return m_startupMetrics; }
+
+void VehicleApp::setExecutionMode(AppExecutionMode mode) {
+    if (mode == getExecutionMode()) {
+        return;
+    }
+    CallbackExecutorPtr_t executor;
+    if (mode == AppExecutionMode::EVENT_LOOP) {
+        m_eventLoop = EventLoop::create();
+        executor    = CallbackExecutor::createEventLoop(m_eventLoop);
+    } else {
+        m_eventLoop.reset();
+    }
+    m_vdbClient->setCallbackExecutor(executor);
+    if (m_pubSubClient) {
+        m_pubSubClient->setCallbackExecutor(executor);
+    }
+}
+
+AppExecutionMode VehicleApp::getExecutionMode() const {
+    return m_eventLoop ? AppExecutionMode::EVENT_LOOP : AppExecutionMode::THREADED;
+}
+
+void VehicleApp::setExecutor(std::shared_ptr<IExecutor> executor) {
+    m_executor = std::move(executor);
+    CallbackExecutorPtr_t callbackExecutor;
+    if (m_executor) {
+        callbackExecutor = CallbackExecutor::createExecutor(m_executor);
+    } else if (m_eventLoop) {
+        callbackExecutor = CallbackExecutor::createEventLoop(m_eventLoop);
+    }
+    m_vdbClient->setCallbackExecutor(callbackExecutor);
+    m_vdbClient->setExecutor(m_executor);
+    if (m_pubSubClient) {
+        m_pubSubClient->setCallbackExecutor(callbackExecutor);
+        m_pubSubClient->setExecutor(m_executor);
+    }
+}
+
+void VehicleApp::post(JobFunction fun, std::chrono::milliseconds delay) {
+    if (m_executor) {
+        if (delay > std::chrono::milliseconds::zero()) {
+            m_executor->scheduleAfter(delay, std::move(fun));
+        } else {
+            m_executor->post(std::move(fun));
+        }
+    } else if (m_eventLoop) {
+        m_eventLoop->post(std::move(fun), delay);
+    } else {
+        ThreadPool::getInstance()->post(std::move(fun), delay);
+    }
+}
+
+void VehicleApp::declareSignals(const std::vector<std::reference_wrapper<DataPoint>>& dataPoints) {
+    for (const auto& dataPoint : dataPoints) {
+        m_declaredSignals.emplace_back(dataPoint.get().getPath());
+    }
+}
+
+void VehicleApp::declareSignals(const SignalTable& signalTable) {
+    auto paths = signalTable.getSignalPaths();
+    m_declaredSignals.insert(m_declaredSignals.end(), std::make_move_iterator(paths.begin()),
+                             std::make_move_iterator(paths.end()));
 }
 
 AsyncSubscriptionPtr_t<std::string> VehicleApp::subscribeToTopic(const std::string& topic) {
@@ -109,6 +334,25 @@ AsyncSubscriptionPtr_t<DataPointReply> VehicleApp::subscribeDataPoints(const std
     return m_vdbClient->subscribe(query);
 }
 
+AsyncSubscriptionPtr_t<DataPointReply> VehicleApp::subscribeDataPoints(const std::string& query,
+                                                                       SubscriptionMode   mode) {
+    return m_vdbClient->subscribe(query, mode);
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+VehicleApp::subscribeDataPoints(const std::string& query, const SubscriptionOptions& options) {
+    return m_vdbClient->subscribe(query, options);
+}
+
+AsyncSubscriptionPtr_t<DataPointReply> VehicleApp::subscribeDataPoints(const Query& query) {
+    return m_vdbClient->subscribe(query, SubscriptionOptions{});
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+VehicleApp::subscribeDataPoints(const Query& query, const SubscriptionOptions& options) {
+    return m_vdbClient->subscribe(query, options);
+}
+
 void VehicleApp::publishToTopic(const std::string& topic, const std::string& data) {
     if (m_pubSubClient) {
         m_pubSubClient->publishOnTopic(topic, data);
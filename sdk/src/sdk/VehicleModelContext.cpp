@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/VehicleModelContext.h"
+
+#include "sdk/Logger.h"
+#include "sdk/Utils.h"
+#include "sdk/vdb/BatchingBrokerClient.h"
+
+#include <string>
+#include <utility>
+
+namespace velocitas {
+
+namespace {
+
+std::chrono::milliseconds determineBatchingWindow() {
+    std::chrono::milliseconds batchingWindow{0};
+    try {
+        auto batchingWindowStr = getEnvVar("SDV_MODEL_BATCHING_WINDOW_MS");
+        if (!batchingWindowStr.empty()) {
+            batchingWindow = std::chrono::milliseconds{std::stoul(batchingWindowStr)};
+        }
+    } catch (...) {
+        logger().error("Invalid model batching window specified via env var! Using default "
+                       "(disabled).");
+    }
+    return batchingWindow;
+}
+
+size_t determineMaxBatchSize() {
+    size_t maxBatchSize{0};
+    try {
+        auto maxBatchSizeStr = getEnvVar("SDV_MODEL_BATCHING_MAX_SIZE");
+        if (!maxBatchSizeStr.empty()) {
+            maxBatchSize = std::stoul(maxBatchSizeStr);
+        }
+    } catch (...) {
+        logger().error("Invalid model batch size specified via env var! Using default "
+                       "(unlimited).");
+    }
+    return maxBatchSize;
+}
+
+bool determineWriteCoalescing() {
+    const auto value = StringUtils::toLower(getEnvVar("SDV_MODEL_WRITE_COALESCING"));
+    if (value == "1" || value == "true" || value == "on") {
+        return true;
+    }
+    if (!value.empty() && value != "0" && value != "false" && value != "off") {
+        logger().warn("Invalid write coalescing mode '{}' specified via env var, using default "
+                      "(disabled)",
+                      value);
+    }
+    return false;
+}
+
+} // namespace
+
+VehicleModelContext::VehicleModelContext()
+    : m_batchingWindow(determineBatchingWindow())
+    , m_maxBatchSize(determineMaxBatchSize())
+    , m_isCoalescingWrites(determineWriteCoalescing()) {}
+
+void VehicleModelContext::setVdbc(std::shared_ptr<IVehicleDataBrokerClient> vdbc) {
+    m_unbatchedVdbc = std::move(vdbc);
+    updateVdbc();
+}
+
+void VehicleModelContext::setBatchingWindow(std::chrono::milliseconds batchingWindow) {
+    m_batchingWindow = batchingWindow;
+    updateVdbc();
+}
+
+void VehicleModelContext::setMaxBatchSize(size_t maxBatchSize) {
+    m_maxBatchSize = maxBatchSize;
+    updateVdbc();
+}
+
+void VehicleModelContext::setWriteCoalescing(bool isEnabled) {
+    m_isCoalescingWrites = isEnabled;
+    updateVdbc();
+}
+
+void VehicleModelContext::updateVdbc() {
+    if (m_unbatchedVdbc && m_batchingWindow.count() > 0) {
+        m_vdbc = std::make_shared<BatchingBrokerClient>(
+            m_unbatchedVdbc,
+            BatchingConfig{m_batchingWindow, m_maxBatchSize, m_isCoalescingWrites});
+    } else {
+        m_vdbc = m_unbatchedVdbc;
+    }
+}
+
+} // namespace velocitas
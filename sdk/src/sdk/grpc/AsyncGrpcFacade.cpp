@@ -15,14 +15,77 @@
  */
 
 #include "sdk/grpc/AsyncGrpcFacade.h"
+#include "sdk/grpc/CompressionPolicy.h"
 #include "sdk/grpc/GrpcCall.h"
 
+#include "sdk/Logger.h"
+#include "sdk/Utils.h"
+
+#include <string>
+#include <utility>
+
 namespace velocitas {
 
+namespace {
+
+std::chrono::milliseconds determineCallTimeout() {
+    std::chrono::milliseconds callTimeout{AsyncGrpcFacade::DEFAULT_CALL_TIMEOUT};
+    try {
+        auto callTimeoutStr = getEnvVar("SDV_GRPC_CALL_TIMEOUT_MS");
+        if (!callTimeoutStr.empty()) {
+            callTimeout = std::chrono::milliseconds{std::stoul(callTimeoutStr)};
+        }
+    } catch (...) {
+        logger().error("Invalid gRPC call timeout specified via env var! Using default ({} ms).",
+                       AsyncGrpcFacade::DEFAULT_CALL_TIMEOUT.count());
+    }
+    return callTimeout;
+}
+
+} // namespace
+
+AsyncGrpcFacade::AsyncGrpcFacade()
+    : m_callTimeout(determineCallTimeout())
+    , m_compressionPolicy(
+          std::make_shared<CompressionPolicy>(CompressionPolicyConfig::fromEnvironment())) {}
+
 void AsyncGrpcFacade::setContextModifier(ContextModifierFunction function) {
     m_contextModifierFunction = function;
 }
 
+void AsyncGrpcFacade::setCallTimeout(std::chrono::milliseconds timeout) {
+    m_callTimeout = timeout;
+}
+
+void AsyncGrpcFacade::setCompressionPolicy(std::shared_ptr<CompressionPolicy> policy) {
+    m_compressionPolicy = std::move(policy);
+}
+
+void AsyncGrpcFacade::applyDeadline(GrpcCall& call, Timeout_t timeout) const {
+    const auto callTimeout = timeout.value_or(m_callTimeout);
+    if (callTimeout.count() > 0) {
+        call.m_context.set_deadline(std::chrono::system_clock::now() + callTimeout);
+    }
+}
+
+void AsyncGrpcFacade::applyCompression(GrpcCall&                           call,
+                                       const google::protobuf::MessageLite& request) const {
+    if (m_compressionPolicy && m_compressionPolicy->shallCompress(request)) {
+        call.m_context.set_compression_algorithm(m_compressionPolicy->getConfig().m_algorithm);
+    }
+}
+
+AsyncGrpcFacade::CompressionFilter_t AsyncGrpcFacade::applyStreamCompression(GrpcCall& call) const {
+    if (!m_compressionPolicy || !m_compressionPolicy->isEnabled()) {
+        return {};
+    }
+    // requests are compressed with the algorithm of the call unless written without compression
+    call.m_context.set_compression_algorithm(m_compressionPolicy->getConfig().m_algorithm);
+    return [policy = m_compressionPolicy](const google::protobuf::MessageLite& request) {
+        return policy->shallCompress(request);
+    };
+}
+
 void AsyncGrpcFacade::applyContextModifier(GrpcCall& call) {
     if (m_contextModifierFunction) {
         m_contextModifierFunction(call.m_context);
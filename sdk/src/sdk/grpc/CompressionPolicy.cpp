@@ -0,0 +1,198 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#include "sdk/grpc/CompressionPolicy.h"
+
+#include "sdk/Logger.h"
+#include "sdk/Metrics.h"
+#include "sdk/Utils.h"
+
+#include <google/protobuf/message_lite.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+namespace velocitas {
+
+namespace {
+
+// weight of a new sample in the moving average of the ratio
+constexpr double SAMPLE_WEIGHT = 0.125;
+
+grpc_compression_algorithm parseAlgorithm(std::string_view name) {
+    if (name == "gzip") {
+        return GRPC_COMPRESS_GZIP;
+    }
+    if (name == "deflate") {
+        return GRPC_COMPRESS_DEFLATE;
+    }
+    throw std::invalid_argument("unknown compression algorithm");
+}
+
+} // namespace
+
+struct CompressionPolicy::RpcState {
+    explicit RpcState(const std::string& rpcType)
+        : m_compressedCounter(getRequestCounter(rpcType, "true"))
+        , m_uncompressedCounter(getRequestCounter(rpcType, "false"))
+        , m_sampledBytesCounter(MetricsRegistry::getInstance().getCounter(
+              "sdv_grpc_compression_sampled_bytes_total",
+              "Serialized size of the requests sampled by the compression policy",
+              {{"rpc", rpcType}}))
+        , m_sampledCompressedBytesCounter(MetricsRegistry::getInstance().getCounter(
+              "sdv_grpc_compression_sampled_compressed_bytes_total",
+              "Compressed size of the requests sampled by the compression policy",
+              {{"rpc", rpcType}}))
+        , m_sampledCpuTimeCounter(MetricsRegistry::getInstance().getCounter(
+              "sdv_grpc_compression_sampled_cpu_nanoseconds_total",
+              "Time it took to compress the requests sampled by the compression policy",
+              {{"rpc", rpcType}})) {}
+
+    static Counter& getRequestCounter(const std::string& rpcType, const std::string& compressed) {
+        return MetricsRegistry::getInstance().getCounter(
+            "sdv_grpc_compression_requests_total",
+            "Number of requests passed to the compression policy",
+            {{"rpc", rpcType}, {"compressed", compressed}});
+    }
+
+    Counter& m_compressedCounter;
+    Counter& m_uncompressedCounter;
+    Counter& m_sampledBytesCounter;
+    Counter& m_sampledCompressedBytesCounter;
+    Counter& m_sampledCpuTimeCounter;
+
+    CompressionStats m_stats;
+    uint64_t         m_numEligible{0};
+    // exponentially weighted moving average of the sampled ratios
+    double           m_ratio{1.0};
+    bool             m_isSkipped{false};
+};
+
+CompressionPolicyConfig CompressionPolicyConfig::fromEnvironment() {
+    CompressionPolicyConfig config;
+    try {
+        const auto valueStr = getEnvVar("SDV_GRPC_COMPRESSION_MIN_SIZE");
+        if (!valueStr.empty()) {
+            config.m_minMessageSize = std::stoul(valueStr);
+        }
+    } catch (...) {
+        logger().error("Invalid value of env var SDV_GRPC_COMPRESSION_MIN_SIZE! Compression is "
+                       "disabled.");
+    }
+    try {
+        const auto valueStr = getEnvVar("SDV_GRPC_COMPRESSION_ALGORITHM");
+        if (!valueStr.empty()) {
+            config.m_algorithm = parseAlgorithm(valueStr);
+        }
+    } catch (...) {
+        logger().error("Invalid value of env var SDV_GRPC_COMPRESSION_ALGORITHM! Using default "
+                       "(gzip).");
+    }
+    return config;
+}
+
+CompressionPolicy::CompressionPolicy(CompressionPolicyConfig config)
+    : m_config(config) {}
+
+CompressionPolicy::~CompressionPolicy() = default;
+
+bool CompressionPolicy::shallCompress(const google::protobuf::MessageLite& request) {
+    if (!isEnabled()) {
+        return false;
+    }
+    const auto isEligible = request.ByteSizeLong() >= m_config.m_minMessageSize;
+    RpcState*  state{nullptr};
+    bool       isSampled{false};
+    {
+        std::lock_guard lock(m_mutex);
+        state     = &getState(std::string(request.GetTypeName()));
+        isSampled = isEligible &&
+                    state->m_numEligible++ % std::max<size_t>(m_config.m_sampleInterval, 1) == 0;
+    }
+    if (isSampled) {
+        sample(*state, request);
+    }
+
+    std::lock_guard lock(m_mutex);
+    const auto      isCompressed = isEligible && state->m_ratio <= m_config.m_maxRatio;
+    if (isCompressed) {
+        ++state->m_stats.m_numCompressed;
+        state->m_compressedCounter.increment();
+    } else {
+        ++state->m_stats.m_numUncompressed;
+        state->m_uncompressedCounter.increment();
+    }
+    return isCompressed;
+}
+
+CompressionStats CompressionPolicy::getStats(const std::string& rpcType) const {
+    std::lock_guard lock(m_mutex);
+    const auto      iter = m_states.find(rpcType);
+    return iter == m_states.end() ? CompressionStats{} : iter->second->m_stats;
+}
+
+CompressionPolicy::RpcState& CompressionPolicy::getState(const std::string& rpcType) {
+    auto& state = m_states[rpcType];
+    if (!state) {
+        state = std::make_unique<RpcState>(rpcType);
+    }
+    return *state;
+}
+
+void CompressionPolicy::sample(RpcState& state, const google::protobuf::MessageLite& request) {
+    const auto  serialized     = request.SerializeAsString();
+    auto        compressedSize = compressBound(static_cast<uLong>(serialized.size()));
+    std::string compressed(compressedSize, '\0');
+
+    const auto start  = std::chrono::steady_clock::now();
+    const auto result = compress2(reinterpret_cast<Bytef*>(compressed.data()), &compressedSize,
+                                  reinterpret_cast<const Bytef*>(serialized.data()),
+                                  static_cast<uLong>(serialized.size()), Z_DEFAULT_COMPRESSION);
+    const auto cpuTime = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+    if (result != Z_OK || serialized.empty()) {
+        return;
+    }
+    const auto ratio =
+        static_cast<double>(compressedSize) / static_cast<double>(serialized.size());
+
+    std::lock_guard lock(m_mutex);
+    auto&           stats = state.m_stats;
+    state.m_ratio =
+        stats.m_numSampled == 0 ? ratio : state.m_ratio + SAMPLE_WEIGHT * (ratio - state.m_ratio);
+    ++stats.m_numSampled;
+    stats.m_sampledBytes += serialized.size();
+    stats.m_sampledCompressedBytes += compressedSize;
+    stats.m_sampledCpuTime += cpuTime;
+    state.m_sampledBytesCounter.increment(serialized.size());
+    state.m_sampledCompressedBytesCounter.increment(compressedSize);
+    state.m_sampledCpuTimeCounter.increment(cpuTime.count());
+
+    const auto isSkipped = state.m_ratio > m_config.m_maxRatio;
+    if (isSkipped != state.m_isSkipped) {
+        state.m_isSkipped = isSkipped;
+        logger().info("CompressionPolicy: Requests of {} compress to {:.0f}% of their size; "
+                      "sending them {}",
+                      request.GetTypeName(), state.m_ratio * 100.0,
+                      isSkipped ? "uncompressed" : "compressed again");
+    }
+}
+
+} // namespace velocitas
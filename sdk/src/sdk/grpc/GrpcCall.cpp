@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/grpc/GrpcCall.h"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace velocitas {
+
+namespace {
+
+const char* toString(grpc::StatusCode code) {
+    switch (code) {
+    case grpc::StatusCode::OK:
+        return "OK";
+    case grpc::StatusCode::CANCELLED:
+        return "CANCELLED";
+    case grpc::StatusCode::UNKNOWN:
+        return "UNKNOWN";
+    case grpc::StatusCode::INVALID_ARGUMENT:
+        return "INVALID_ARGUMENT";
+    case grpc::StatusCode::DEADLINE_EXCEEDED:
+        return "DEADLINE_EXCEEDED";
+    case grpc::StatusCode::NOT_FOUND:
+        return "NOT_FOUND";
+    case grpc::StatusCode::ALREADY_EXISTS:
+        return "ALREADY_EXISTS";
+    case grpc::StatusCode::PERMISSION_DENIED:
+        return "PERMISSION_DENIED";
+    case grpc::StatusCode::RESOURCE_EXHAUSTED:
+        return "RESOURCE_EXHAUSTED";
+    case grpc::StatusCode::FAILED_PRECONDITION:
+        return "FAILED_PRECONDITION";
+    case grpc::StatusCode::ABORTED:
+        return "ABORTED";
+    case grpc::StatusCode::OUT_OF_RANGE:
+        return "OUT_OF_RANGE";
+    case grpc::StatusCode::UNIMPLEMENTED:
+        return "UNIMPLEMENTED";
+    case grpc::StatusCode::INTERNAL:
+        return "INTERNAL";
+    case grpc::StatusCode::UNAVAILABLE:
+        return "UNAVAILABLE";
+    case grpc::StatusCode::DATA_LOSS:
+        return "DATA_LOSS";
+    case grpc::StatusCode::UNAUTHENTICATED:
+        return "UNAUTHENTICATED";
+    default:
+        return "UNKNOWN";
+    }
+}
+
+} // namespace
+
+RpcMetrics& RpcMetrics::get(std::string_view rpcType) {
+    // never destroyed, like the MetricsRegistry, as calls may complete during static destruction
+    static auto* const mutex = new std::mutex(); // NOLINT(cppcoreguidelines-owning-memory)
+    static auto* const metricsByType =
+        new std::map<std::string, std::unique_ptr<RpcMetrics>, std::less<>>(); // NOLINT
+    std::lock_guard lock(*mutex);
+    auto            iter = metricsByType->find(rpcType);
+    if (iter == metricsByType->end()) {
+        iter = metricsByType
+                   ->emplace(std::string{rpcType}, std::make_unique<RpcMetrics>(rpcType))
+                   .first;
+    }
+    return *iter->second;
+}
+
+RpcMetrics::RpcMetrics(std::string_view rpcType)
+    : m_rpcType(rpcType)
+    , m_duration(MetricsRegistry::getInstance().getHistogram(
+          "sdv_grpc_call_duration_nanoseconds",
+          "Duration of the gRPC calls from their creation until their completion",
+          {{"rpc", m_rpcType}}))
+    , m_activeStreams(MetricsRegistry::getInstance().getGauge(
+          "sdv_grpc_active_streams", "Number of open gRPC streams", {{"rpc", m_rpcType}})) {}
+
+void RpcMetrics::recordCompletion(const grpc::Status& status, std::chrono::nanoseconds duration) {
+    m_duration.record(static_cast<uint64_t>(std::max<int64_t>(0, duration.count())));
+
+    const auto code  = static_cast<size_t>(status.error_code());
+    const auto index = (code < NUM_STATUS_CODES) ? code : size_t{grpc::StatusCode::UNKNOWN};
+    auto*      calls = m_calls[index].load(std::memory_order_acquire);
+    if (calls == nullptr) {
+        // registering is idempotent, so concurrent first completions get the same counter
+        calls = &MetricsRegistry::getInstance().getCounter(
+            "sdv_grpc_calls_total", "Number of completed gRPC calls by status code",
+            {{"rpc", m_rpcType}, {"code", toString(static_cast<grpc::StatusCode>(index))}});
+        m_calls[index].store(calls, std::memory_order_release);
+    }
+    calls->increment();
+}
+
+} // namespace velocitas
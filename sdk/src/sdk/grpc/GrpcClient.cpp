@@ -17,24 +17,115 @@
 #include "sdk/grpc/GrpcClient.h"
 #include "sdk/grpc/GrpcCall.h"
 
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace velocitas {
 
-void GrpcClient::addActiveCall(std::shared_ptr<GrpcCall> call) {
-    pruneCompletedRequests();
+class ActiveCallRegistry {
+public:
+    void add(std::shared_ptr<GrpcCall> call) {
+        std::lock_guard lock(m_mutex);
+        auto* const key = call.get();
+        m_calls.emplace(key, std::move(call));
+    }
+
+    void release(const GrpcCall* call) {
+        std::shared_ptr<GrpcCall> releasedCall;
+        {
+            std::lock_guard lock(m_mutex);
+            auto            iter = m_calls.find(call);
+            if (iter == m_calls.end()) {
+                return;
+            }
+            releasedCall = std::move(iter->second);
+            m_calls.erase(iter);
+        }
+        // the call may get destroyed here, which must not happen with the mutex being locked
+    }
+
+    [[nodiscard]] std::vector<std::shared_ptr<GrpcCall>> getCalls() const {
+        std::vector<std::shared_ptr<GrpcCall>> calls;
+        std::lock_guard                        lock(m_mutex);
+        calls.reserve(m_calls.size());
+        for (const auto& [key, call] : m_calls) {
+            calls.push_back(call);
+        }
+        return calls;
+    }
+
+    [[nodiscard]] size_t size() const {
+        std::lock_guard lock(m_mutex);
+        return m_calls.size();
+    }
+
+    [[nodiscard]] std::map<std::string, size_t> countByRpcType() const {
+        std::map<std::string, size_t> counts;
+        std::lock_guard               lock(m_mutex);
+        for (const auto& [key, call] : m_calls) {
+            ++counts[std::string{call->getRpcType()}];
+        }
+        return counts;
+    }
+
+private:
+    mutable std::mutex                                             m_mutex;
+    std::unordered_map<const GrpcCall*, std::shared_ptr<GrpcCall>> m_calls;
+};
+
+CompletionFlag& CompletionFlag::operator=(bool isComplete) {
+    std::shared_ptr<ActiveCallRegistry> registry;
+    const GrpcCall*                     call{nullptr};
     {
-        std::scoped_lock<std::mutex> lock(m_mutex);
-        m_activeCalls.emplace_back(call);
+        std::lock_guard lock(m_mutex);
+        m_isComplete = isComplete;
+        if (isComplete) {
+            registry = std::move(m_registry);
+            call     = m_call;
+        }
+    }
+    if (registry) {
+        // may destroy the call and thereby this flag, so it must not be accessed anymore
+        registry->release(call);
     }
+    return *this;
 }
 
-void GrpcClient::pruneCompletedRequests() {
-    static auto isComplete = [](const auto& activeCall) { return activeCall->m_isComplete; };
+GrpcClient::GrpcClient()
+    : m_registry(std::make_shared<ActiveCallRegistry>()) {}
 
-    {
-        std::scoped_lock<std::mutex> lock(m_mutex);
-        m_activeCalls.erase(std::remove_if(m_activeCalls.begin(), m_activeCalls.end(), isComplete),
-                            m_activeCalls.end());
+GrpcClient::~GrpcClient() {
+    // the calls keep the registry alive until they are complete
+    cancelActiveCalls();
+}
+
+void GrpcClient::addActiveCall(std::shared_ptr<GrpcCall> call) {
+    auto&           flag = call->m_isComplete;
+    std::lock_guard lock(flag.m_mutex);
+    if (flag.m_isComplete) {
+        return;
     }
+    flag.m_registry = m_registry;
+    flag.m_call     = call.get();
+    // added while the flag is locked, so a concurrent completion finds the call being registered
+    m_registry->add(std::move(call));
+}
+
+size_t GrpcClient::getNumActiveCalls() const { return m_registry->size(); }
+
+size_t GrpcClient::cancelActiveCalls() {
+    // cancelled outside of the registry's lock, as completing the calls releases them from it
+    const auto calls = m_registry->getCalls();
+    for (const auto& call : calls) {
+        call->m_context.TryCancel();
+    }
+    return calls.size();
+}
+
+std::map<std::string, size_t> GrpcClient::getNumActiveCallsByRpcType() const {
+    return m_registry->countByRpcType();
 }
 
 } // namespace velocitas
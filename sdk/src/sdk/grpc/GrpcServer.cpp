@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#include "sdk/grpc/GrpcServer.h"
+
+#include "sdk/Logger.h"
+#include "sdk/Utils.h"
+
+#include <grpcpp/resource_quota.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server_builder.h>
+
+#include <algorithm>
+#include <fmt/core.h>
+#include <limits>
+#include <stdexcept>
+
+namespace velocitas {
+
+namespace {
+
+size_t readSizeFromEnvironment(const char* varName, size_t defaultValue) {
+    try {
+        const auto valueStr = getEnvVar(varName);
+        if (!valueStr.empty()) {
+            return std::stoul(valueStr);
+        }
+    } catch (...) {
+        logger().error("Invalid value of env var {}! Using default ({}).", varName, defaultValue);
+    }
+    return defaultValue;
+}
+
+} // namespace
+
+GrpcServerConfig GrpcServerConfig::fromEnvironment() {
+    GrpcServerConfig config;
+    config.m_maxThreads = readSizeFromEnvironment("SDV_GRPC_SERVER_MAX_THREADS", 0);
+    config.m_messagePoolSize =
+        readSizeFromEnvironment("SDV_GRPC_SERVER_MESSAGE_POOL_SIZE", DEFAULT_MESSAGE_POOL_SIZE);
+    return config;
+}
+
+void GrpcServerConfig::applyTo(grpc::ServerBuilder& builder) const {
+    if (m_maxThreads == 0) {
+        return;
+    }
+    grpc::ResourceQuota quota("sdv_grpc_server");
+    quota.SetMaxThreads(static_cast<int>(
+        std::min<size_t>(m_maxThreads, std::numeric_limits<int>::max())));
+    builder.SetResourceQuota(quota);
+}
+
+std::unique_ptr<grpc::Server> startGrpcServer(const std::string& address, grpc::Service& service,
+                                              const GrpcServerConfig& config, int* selectedPort) {
+    int                 port{0};
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort(address, grpc::InsecureServerCredentials(), &port);
+    builder.RegisterService(&service);
+    config.applyTo(builder);
+    auto server = builder.BuildAndStart();
+    if (!server || port == 0) {
+        throw std::runtime_error(fmt::format("Failed to start gRPC server at '{}'", address));
+    }
+    logger().info("gRPC server listening at '{}'", address);
+    if (selectedPort != nullptr) {
+        *selectedPort = port;
+    }
+    return server;
+}
+
+} // namespace velocitas
@@ -22,9 +22,12 @@
 
 #include "fmt/core.h"
 
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace velocitas {
 
@@ -47,8 +50,16 @@ static std::string getServiceEnvVarName(const std::string& serviceName) {
 }
 
 std::string NativeMiddleware::getServiceLocation(const std::string& serviceName) const {
-    auto envVarName     = getServiceEnvVarName(serviceName);
-    auto serviceAddress = SimpleUrlParse(getEnvVar(envVarName)).getNetLocation();
+    auto envVarName = getServiceEnvVarName(serviceName);
+    // a service may be provided by several endpoints to fail over between, listed comma separated
+    std::vector<std::string> locations;
+    for (const auto& url : StringUtils::split(getEnvVar(envVarName), ',')) {
+        auto location = SimpleUrlParse(url).getNetLocation();
+        if (!location.empty()) {
+            locations.push_back(std::move(location));
+        }
+    }
+    auto serviceAddress = StringUtils::join(locations, ",");
     if (!serviceAddress.empty()) {
         return serviceAddress;
     }
@@ -70,6 +81,18 @@ std::string NativeMiddleware::getServiceLocation(const std::string& serviceName)
 
 std::shared_ptr<IPubSubClient>
 NativeMiddleware::createPubSubClient(const std::string& clientId) const {
+    const std::string pubSubType = StringUtils::toLower(getEnvVar(PUBSUB_TYPE_ENV_VAR_NAME));
+    if (pubSubType == "inprocess") {
+        const auto bridgedTopics = StringUtils::split(getEnvVar(BRIDGED_TOPICS_ENV_VAR_NAME), ',');
+        std::shared_ptr<IPubSubClient> bridge;
+        if (!bridgedTopics.empty()) {
+            bridge = IPubSubClient::createInstance(getServiceLocation("mqtt"), clientId);
+        }
+        return IPubSubClient::createInProcess(clientId, std::move(bridge), bridgedTopics);
+    }
+    if (!pubSubType.empty() && pubSubType != "mqtt") {
+        throw std::runtime_error(fmt::format("Unknown pub/sub type '{}'", pubSubType));
+    }
     std::string brokerLocation = getServiceLocation("mqtt");
     return IPubSubClient::createInstance(brokerLocation, clientId);
 }
@@ -25,6 +25,18 @@ class NativeMiddleware : public Middleware {
 public:
     static constexpr char const* TYPE_ID = "native";
 
+    /**
+     * @brief Name of the environment variable selecting the pub/sub client: "mqtt" (default) or
+     * "inprocess".
+     */
+    static constexpr char const* PUBSUB_TYPE_ENV_VAR_NAME = "SDV_PUBSUB_TYPE";
+
+    /**
+     * @brief Name of the environment variable listing the comma separated topic filters an
+     * in-process pub/sub client bridges to the MQTT broker.
+     */
+    static constexpr char const* BRIDGED_TOPICS_ENV_VAR_NAME = "SDV_PUBSUB_BRIDGED_TOPICS";
+
     NativeMiddleware()
         : Middleware(TYPE_ID) {}
 
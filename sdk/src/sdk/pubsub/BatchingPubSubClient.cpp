@@ -0,0 +1,223 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "BatchingPubSubClient.h"
+
+#include "sdk/Job.h"
+#include "sdk/Logger.h"
+#include "sdk/ThreadPool.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace velocitas {
+
+namespace {
+
+constexpr size_t FRAME_HEADER_SIZE = 4;
+
+void appendFrame(std::string& message, const std::string& payload) {
+    const auto size = static_cast<uint32_t>(payload.size());
+    message.reserve(message.size() + FRAME_HEADER_SIZE + payload.size());
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        message.push_back(static_cast<char>((size >> shift) & 0xFFU));
+    }
+    message.append(payload);
+}
+
+std::chrono::milliseconds getShortestTimeout(std::chrono::milliseconds lhs,
+                                             std::chrono::milliseconds rhs) {
+    if (lhs.count() == 0) {
+        return rhs;
+    }
+    if (rhs.count() == 0) {
+        return lhs;
+    }
+    return std::min(lhs, rhs);
+}
+
+} // namespace
+
+std::shared_ptr<IPubSubClient>
+IPubSubClient::createBatching(std::shared_ptr<IPubSubClient> client, PublishBatchingConfig config) {
+    return std::make_shared<BatchingPubSubClient>(std::move(client), std::move(config));
+}
+
+std::vector<std::string> IPubSubClient::splitAggregatedPayload(const std::string& message) {
+    std::vector<std::string> payloads;
+    size_t                   offset = 0;
+    while (offset < message.size()) {
+        if (message.size() - offset < FRAME_HEADER_SIZE) {
+            throw std::invalid_argument("Aggregated payload ends within a frame header");
+        }
+        uint32_t size = 0;
+        for (size_t i = 0; i < FRAME_HEADER_SIZE; ++i) {
+            size = (size << 8U) | static_cast<uint8_t>(message[offset + i]);
+        }
+        offset += FRAME_HEADER_SIZE;
+        if (message.size() - offset < size) {
+            throw std::invalid_argument("Aggregated payload ends within a frame");
+        }
+        payloads.emplace_back(message, offset, size);
+        offset += size;
+    }
+    return payloads;
+}
+
+BatchingPubSubClient::BatchingPubSubClient(std::shared_ptr<IPubSubClient> client,
+                                           PublishBatchingConfig          config)
+    : m_client(std::move(client))
+    , m_config(std::move(config)) {}
+
+BatchingPubSubClient::~BatchingPubSubClient() { flush(); }
+
+void BatchingPubSubClient::disconnect() {
+    flush();
+    m_client->disconnect();
+}
+
+void BatchingPubSubClient::publishOnTopic(const std::string& topic, const std::string& data) {
+    std::ignore = publishAsync(topic, data, std::chrono::milliseconds::zero());
+}
+
+PublishStatus BatchingPubSubClient::publishOnTopic(const std::string& topic,
+                                                   const std::string& data, int timeout_ms) {
+    return publishAsync(topic, data, std::chrono::milliseconds(timeout_ms))->await();
+}
+
+AsyncResultPtr_t<PublishStatus> BatchingPubSubClient::publishAsync(
+    const std::string& topic, const std::string& data, std::chrono::milliseconds timeout) {
+    const auto mode = getMode(topic);
+    if (mode == PublishBatchingConfig::Mode::NONE) {
+        return m_client->publishAsync(topic, data, timeout);
+    }
+
+    auto  result = std::make_shared<AsyncResult<PublishStatus>>();
+    Batch fullBatch;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto& batch = m_batches[topic];
+        if (mode == PublishBatchingConfig::Mode::AGGREGATE) {
+            appendFrame(batch.m_payload, data);
+        } else {
+            batch.m_payload = data;
+        }
+        ++batch.m_numMessages;
+        batch.m_timeout = getShortestTimeout(batch.m_timeout, timeout);
+        batch.m_results.push_back(result);
+        if (mode == PublishBatchingConfig::Mode::AGGREGATE && isFull(batch)) {
+            fullBatch = std::move(batch);
+            m_batches.erase(topic);
+        } else {
+            scheduleFlush();
+        }
+    }
+    if (!fullBatch.m_results.empty()) {
+        publishBatch(topic, std::move(fullBatch));
+    }
+    return result;
+}
+
+AsyncSubscriptionPtr_t<std::string>
+BatchingPubSubClient::subscribeTopic(const std::string& topic) {
+    auto subscription = m_client->subscribeTopic(topic);
+    if (auto executor = getCallbackExecutor()) {
+        subscription->setCallbackExecutor(std::move(executor));
+    }
+    return subscription;
+}
+
+AsyncSubscriptionPtr_t<PubSubMessage>
+BatchingPubSubClient::subscribeTopicBinary(const std::string& topic) {
+    auto subscription = m_client->subscribeTopicBinary(topic);
+    if (auto executor = getCallbackExecutor()) {
+        subscription->setCallbackExecutor(std::move(executor));
+    }
+    return subscription;
+}
+
+void BatchingPubSubClient::flush() {
+    std::map<std::string, Batch> batches;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isFlushScheduled = false;
+        batches.swap(m_batches);
+    }
+    for (auto& [topic, batch] : batches) {
+        publishBatch(topic, std::move(batch));
+    }
+}
+
+PublishBatchingConfig::Mode BatchingPubSubClient::getMode(const std::string& topic) const {
+    const auto iter = m_config.m_topicModes.find(topic);
+    return iter != m_config.m_topicModes.cend() ? iter->second : m_config.m_mode;
+}
+
+bool BatchingPubSubClient::isFull(const Batch& batch) const {
+    return (m_config.m_maxBatchBytes > 0 && batch.m_payload.size() >= m_config.m_maxBatchBytes) ||
+           (m_config.m_maxBatchMessages > 0 && batch.m_numMessages >= m_config.m_maxBatchMessages);
+}
+
+void BatchingPubSubClient::scheduleFlush() {
+    if (m_isFlushScheduled) {
+        return;
+    }
+    m_isFlushScheduled = true;
+    auto flushBatches = [weakThis = weak_from_this()]() {
+        if (auto thisPtr = weakThis.lock()) {
+            thisPtr->flush();
+        }
+    };
+    if (auto executor = getExecutor()) {
+        executor->scheduleAfter(m_config.m_flushWindow, std::move(flushBatches));
+    } else {
+        ThreadPool::getInstance(ThreadPool::PUBSUB_POOL)
+            ->enqueue(Job::create(std::move(flushBatches), m_config.m_flushWindow));
+    }
+}
+
+void BatchingPubSubClient::setExecutor(ExecutorPtr_t executor) {
+    IPubSubClient::setExecutor(executor);
+    m_client->setExecutor(std::move(executor));
+}
+
+void BatchingPubSubClient::publishBatch(const std::string& topic, Batch batch) {
+    logger().debug(R"(Publishing batch of {} message(s) on topic "{}")", batch.m_numMessages,
+                   topic);
+    AsyncResultPtr_t<PublishStatus> result;
+    try {
+        result = m_client->publishAsync(topic, batch.m_payload, batch.m_timeout);
+    } catch (const std::exception& e) {
+        logger().error(R"(Publishing batch on topic "{}" failed: {})", topic, e.what());
+        for (const auto& callerResult : batch.m_results) {
+            callerResult->insertResult(PublishStatus::Failure);
+        }
+        return;
+    }
+    result->onError([results = batch.m_results](const Status& /*status*/) {
+        for (const auto& callerResult : results) {
+            callerResult->insertResult(PublishStatus::Failure);
+        }
+    });
+    result->onResult([results = std::move(batch.m_results)](const PublishStatus& status) {
+        for (const auto& callerResult : results) {
+            callerResult->insertResult(PublishStatus(status));
+        }
+    });
+}
+
+} // namespace velocitas
@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef VEHICLE_APP_SDK_PUBSUB_BATCHINGPUBSUBCLIENT_H
+#define VEHICLE_APP_SDK_PUBSUB_BATCHINGPUBSUBCLIENT_H
+
+#include "sdk/IPubSubClient.h"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief Decorator of an IPubSubClient batching the publishes per topic within a flush window,
+ * either keeping the latest payload only or aggregating all payloads into one framed message.
+ *
+ * The callers of superseded or aggregated publishes get the outcome of the publish of the batch.
+ * Aggregated messages are also published once they reach the size or number of payloads limit.
+ * Subscriptions are forwarded unchanged.
+ */
+class BatchingPubSubClient : public IPubSubClient,
+                             public std::enable_shared_from_this<BatchingPubSubClient> {
+public:
+    BatchingPubSubClient(std::shared_ptr<IPubSubClient> client, PublishBatchingConfig config);
+
+    ~BatchingPubSubClient() override;
+
+    BatchingPubSubClient(const BatchingPubSubClient&)            = delete;
+    BatchingPubSubClient(BatchingPubSubClient&&)                 = delete;
+    BatchingPubSubClient& operator=(const BatchingPubSubClient&) = delete;
+    BatchingPubSubClient& operator=(BatchingPubSubClient&&)      = delete;
+
+    void connect() override { m_client->connect(); }
+    void reconnect(int timeout_ms) override { m_client->reconnect(timeout_ms); }
+
+    /**
+     * @brief Publishes the pending batches before disconnecting.
+     */
+    void disconnect() override;
+
+    [[nodiscard]] bool isConnected() const override { return m_client->isConnected(); }
+
+    /**
+     * @brief Adds the message to the batch of its topic, without waiting for it to be published.
+     */
+    void publishOnTopic(const std::string& topic, const std::string& data) override;
+
+    /**
+     * @brief Adds the message to the batch of its topic and waits for the batch to be published.
+     */
+    PublishStatus publishOnTopic(const std::string& topic, const std::string& data,
+                                 int timeout_ms) override;
+
+    /**
+     * @brief Adds the message to the batch of its topic. The result is the outcome of the publish
+     * of the batch, which times out after the shortest timeout of its publishes.
+     */
+    AsyncResultPtr_t<PublishStatus> publishAsync(const std::string& topic, const std::string& data,
+                                                 std::chrono::milliseconds timeout) override;
+
+    AsyncSubscriptionPtr_t<std::string> subscribeTopic(const std::string& topic) override;
+
+    AsyncSubscriptionPtr_t<PubSubMessage> subscribeTopicBinary(const std::string& topic) override;
+
+    void unsubscribeTopic(const std::string& topic) override { m_client->unsubscribeTopic(topic); }
+
+    void setExecutor(ExecutorPtr_t executor) override;
+
+    /**
+     * @brief Publish the pending batches right away instead of at the end of the flush window.
+     */
+    void flush();
+
+    /**
+     * @brief Get the decorated client.
+     */
+    [[nodiscard]] const std::shared_ptr<IPubSubClient>& getClient() const { return m_client; }
+
+private:
+    struct Batch {
+        std::string                                  m_payload;
+        size_t                                       m_numMessages{0};
+        std::chrono::milliseconds                    m_timeout{0};
+        std::vector<AsyncResultPtr_t<PublishStatus>> m_results;
+    };
+
+    [[nodiscard]] PublishBatchingConfig::Mode getMode(const std::string& topic) const;
+    [[nodiscard]] bool                        isFull(const Batch& batch) const;
+
+    // needs to be called with m_mutex being locked
+    void scheduleFlush();
+
+    void publishBatch(const std::string& topic, Batch batch);
+
+    std::shared_ptr<IPubSubClient> m_client;
+    const PublishBatchingConfig    m_config;
+
+    std::mutex                   m_mutex;
+    std::map<std::string, Batch> m_batches;
+    bool                         m_isFlushScheduled{false};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_PUBSUB_BATCHINGPUBSUBCLIENT_H
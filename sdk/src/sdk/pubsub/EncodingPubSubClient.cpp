@@ -0,0 +1,229 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "EncodingPubSubClient.h"
+
+#include "sdk/Job.h"
+#include "sdk/Logger.h"
+#include "sdk/ThreadPool.h"
+
+#include <fmt/core.h>
+
+#include <stdexcept>
+#include <utility>
+
+namespace velocitas {
+
+namespace {
+
+constexpr std::string_view FRAME_MARKER        = "\x1bSDV";
+constexpr size_t           MAX_CODEC_NAME_SIZE = 255;
+
+bool isFramed(std::string_view payload) {
+    return payload.substr(0, FRAME_MARKER.size()) == FRAME_MARKER;
+}
+
+std::string frame(std::string_view codecName, std::string_view encoded) {
+    std::string framed;
+    framed.reserve(FRAME_MARKER.size() + 1 + codecName.size() + encoded.size());
+    framed.append(FRAME_MARKER);
+    framed.push_back(static_cast<char>(codecName.size()));
+    framed.append(codecName);
+    framed.append(encoded);
+    return framed;
+}
+
+} // namespace
+
+std::shared_ptr<IPubSubClient>
+IPubSubClient::createEncoding(std::shared_ptr<IPubSubClient> client, PayloadCodecConfig config) {
+    return std::make_shared<EncodingPubSubClient>(std::move(client), std::move(config));
+}
+
+EncodingPubSubClient::EncodingPubSubClient(std::shared_ptr<IPubSubClient> client,
+                                           PayloadCodecConfig             config)
+    : m_client{std::move(client)}
+    , m_config{std::move(config)} {
+    const auto addDecoder = [this](const PayloadCodecPtr_t& codec) {
+        if (!codec) {
+            return;
+        }
+        if (codec->getName().size() > MAX_CODEC_NAME_SIZE) {
+            throw std::invalid_argument(
+                fmt::format("Name of payload codec '{}' is too long", codec->getName()));
+        }
+        m_decoders.emplace(codec->getName(), codec);
+    };
+    addDecoder(m_config.m_codec);
+    for (const auto& [topic, codec] : m_config.m_topicCodecs) {
+        addDecoder(codec);
+        m_topicCodecs.insert(topic, codec.get());
+    }
+    for (const auto& codec : m_config.m_decoders) {
+        addDecoder(codec);
+    }
+}
+
+void EncodingPubSubClient::publishOnTopic(const std::string& topic, const std::string& data) {
+    m_client->publishOnTopic(topic, encode(topic, data));
+}
+
+PublishStatus EncodingPubSubClient::publishOnTopic(const std::string& topic,
+                                                   const std::string& data, int timeout_ms) {
+    return m_client->publishOnTopic(topic, encode(topic, data), timeout_ms);
+}
+
+AsyncResultPtr_t<PublishStatus>
+EncodingPubSubClient::publishAsync(const std::string& topic, const std::string& data,
+                                   std::chrono::milliseconds timeout) {
+    if (getCodec(topic) == nullptr || data.size() < m_config.m_minPayloadSize) {
+        return m_client->publishAsync(topic, encode(topic, data), timeout);
+    }
+    auto result = std::make_shared<AsyncResult<PublishStatus>>();
+    auto encodeAndPublish = [weakThis = weak_from_this(), result, topic, data, timeout]() {
+        auto thisPtr = weakThis.lock();
+        if (!thisPtr) {
+            result->insertResult(PublishStatus::Failure);
+            return;
+        }
+        try {
+            thisPtr->m_client->publishAsync(topic, thisPtr->encode(topic, data), timeout)
+                ->onResult([result](const PublishStatus& status) {
+                    result->insertResult(PublishStatus(status));
+                });
+        } catch (const std::exception& ex) {
+            logger().error("Publish failed: {}", ex.what());
+            result->insertResult(PublishStatus::Failure);
+        }
+    };
+    if (auto executor = getExecutor()) {
+        executor->post(std::move(encodeAndPublish));
+    } else {
+        ThreadPool::getInstance(ThreadPool::PUBSUB_POOL)
+            ->enqueue(Job::create(std::move(encodeAndPublish)));
+    }
+    return result;
+}
+
+void EncodingPubSubClient::setExecutor(ExecutorPtr_t executor) {
+    IPubSubClient::setExecutor(executor);
+    m_client->setExecutor(std::move(executor));
+}
+
+AsyncSubscriptionPtr_t<std::string>
+EncodingPubSubClient::subscribeTopic(const std::string& topic) {
+    auto subscription = std::make_shared<AsyncSubscription<std::string>>();
+    subscription->setCallbackExecutor(getCallbackExecutor());
+    // the subscription of the decorated client is kept by it, and keeps the decoding one
+    m_client->subscribeTopic(topic)
+        ->onItemMoved([weakThis = weak_from_this(), subscription, topic](std::string&& item) {
+            auto thisPtr = weakThis.lock();
+            if (!thisPtr) {
+                return;
+            }
+            try {
+                auto decoded = thisPtr->decode(item);
+                subscription->insertNewItem(decoded ? std::move(*decoded) : std::move(item));
+            } catch (const std::exception& ex) {
+                logger().error(R"(Dropping message on topic "{}": {})", topic, ex.what());
+            }
+        })
+        ->onError([subscription](const Status& status) {
+            subscription->insertError(Status(status));
+        });
+    return subscription;
+}
+
+AsyncSubscriptionPtr_t<PubSubMessage>
+EncodingPubSubClient::subscribeTopicBinary(const std::string& topic) {
+    auto subscription = std::make_shared<AsyncSubscription<PubSubMessage>>();
+    subscription->setCallbackExecutor(getCallbackExecutor());
+    m_client->subscribeTopicBinary(topic)
+        ->onItemMoved([weakThis = weak_from_this(), subscription](PubSubMessage&& message) {
+            auto thisPtr = weakThis.lock();
+            if (!thisPtr) {
+                return;
+            }
+            try {
+                auto decoded = thisPtr->decode(message.getPayload());
+                if (!decoded) {
+                    // not encoded, so the message is passed without copying its payload
+                    subscription->insertNewItem(std::move(message));
+                    return;
+                }
+                auto owner = std::make_shared<const std::pair<std::string, std::string>>(
+                    std::string(message.getTopic()), std::move(*decoded));
+                subscription->insertNewItem(PubSubMessage(owner, owner->first, owner->second,
+                                                          message.getQos(),
+                                                          message.isRetained()));
+            } catch (const std::exception& ex) {
+                logger().error(R"(Dropping message on topic "{}": {})", message.getTopic(),
+                               ex.what());
+            }
+        })
+        ->onError([subscription](const Status& status) {
+            subscription->insertError(Status(status));
+        });
+    return subscription;
+}
+
+std::string EncodingPubSubClient::encode(const std::string& topic,
+                                         const std::string& payload) const {
+    const auto* codec = getCodec(topic);
+    if (codec == nullptr || payload.size() < m_config.m_minPayloadSize) {
+        // payloads looking like a frame are framed without a codec, to be passed unchanged
+        return isFramed(payload) ? frame("", payload) : payload;
+    }
+    return frame(codec->getName(), codec->encode(payload));
+}
+
+std::optional<std::string> EncodingPubSubClient::decode(std::string_view payload) const {
+    if (!isFramed(payload) || payload.size() == FRAME_MARKER.size()) {
+        return std::nullopt;
+    }
+    payload.remove_prefix(FRAME_MARKER.size());
+    const auto nameSize = static_cast<uint8_t>(payload.front());
+    if (payload.size() < 1U + nameSize) {
+        throw std::runtime_error("Encoded payload ends within the codec name");
+    }
+    const auto name    = payload.substr(1, nameSize);
+    const auto encoded = payload.substr(1U + nameSize);
+    if (name.empty()) {
+        return std::string(encoded);
+    }
+    const auto iter = m_decoders.find(name);
+    if (iter == m_decoders.end()) {
+        throw std::runtime_error(fmt::format("Unknown payload codec '{}'", name));
+    }
+    return iter->second->decode(encoded);
+}
+
+const IPayloadCodec* EncodingPubSubClient::getCodec(const std::string& topic) const {
+    if (const auto iter = m_config.m_topicCodecs.find(topic);
+        iter != m_config.m_topicCodecs.end()) {
+        return iter->second.get();
+    }
+    bool                 isMatched{false};
+    const IPayloadCodec* codec{nullptr};
+    m_topicCodecs.forEachMatch(topic, [&](const IPayloadCodec* filterCodec) {
+        if (!isMatched) {
+            isMatched = true;
+            codec     = filterCodec;
+        }
+    });
+    return isMatched ? codec : m_config.m_codec.get();
+}
+
+} // namespace velocitas
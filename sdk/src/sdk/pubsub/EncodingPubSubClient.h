@@ -0,0 +1,98 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef VEHICLE_APP_SDK_PUBSUB_ENCODINGPUBSUBCLIENT_H
+#define VEHICLE_APP_SDK_PUBSUB_ENCODINGPUBSUBCLIENT_H
+
+#include "sdk/IPubSubClient.h"
+#include "sdk/PayloadCodec.h"
+#include "sdk/pubsub/TopicTrie.h"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace velocitas {
+
+/**
+ * @brief Decorator of an IPubSubClient encoding the published payloads with the codec of their
+ * topic, and decoding the received ones.
+ *
+ * An encoded payload is framed as "\x1bSDV", the size of the codec name (one byte), the codec
+ * name and the encoded payload. Payloads smaller than the configured minimum, as well as those
+ * of topics without a codec, are published unchanged, unless they start with the frame marker.
+ */
+class EncodingPubSubClient : public IPubSubClient,
+                             public std::enable_shared_from_this<EncodingPubSubClient> {
+public:
+    EncodingPubSubClient(std::shared_ptr<IPubSubClient> client, PayloadCodecConfig config);
+
+    EncodingPubSubClient(const EncodingPubSubClient&)            = delete;
+    EncodingPubSubClient(EncodingPubSubClient&&)                 = delete;
+    EncodingPubSubClient& operator=(const EncodingPubSubClient&) = delete;
+    EncodingPubSubClient& operator=(EncodingPubSubClient&&)      = delete;
+
+    ~EncodingPubSubClient() override = default;
+
+    void connect() override { m_client->connect(); }
+    void reconnect(int timeout_ms) override { m_client->reconnect(timeout_ms); }
+    void disconnect() override { m_client->disconnect(); }
+    [[nodiscard]] bool isConnected() const override { return m_client->isConnected(); }
+
+    void          publishOnTopic(const std::string& topic, const std::string& data) override;
+    PublishStatus publishOnTopic(const std::string& topic, const std::string& data,
+                                 int timeout_ms) override;
+
+    /**
+     * @brief Encodes the payload on the pub/sub thread pool before publishing it.
+     */
+    AsyncResultPtr_t<PublishStatus> publishAsync(const std::string& topic, const std::string& data,
+                                                 std::chrono::milliseconds timeout) override;
+
+    AsyncSubscriptionPtr_t<std::string>   subscribeTopic(const std::string& topic) override;
+    AsyncSubscriptionPtr_t<PubSubMessage> subscribeTopicBinary(const std::string& topic) override;
+    void unsubscribeTopic(const std::string& topic) override { m_client->unsubscribeTopic(topic); }
+
+    void setExecutor(ExecutorPtr_t executor) override;
+
+    /**
+     * @brief Encode the payload as it is published on the topic.
+     */
+    [[nodiscard]] std::string encode(const std::string& topic, const std::string& payload) const;
+
+    /**
+     * @brief Decode a received payload.
+     * @throw std::runtime_error if the payload is encoded by an unknown codec or is corrupt.
+     *
+     * @return std::optional<std::string>  The decoded payload, std::nullopt if the payload is not
+     *                                     encoded.
+     */
+    [[nodiscard]] std::optional<std::string> decode(std::string_view payload) const;
+
+private:
+    [[nodiscard]] const IPayloadCodec* getCodec(const std::string& topic) const;
+
+    std::shared_ptr<IPubSubClient>                        m_client;
+    const PayloadCodecConfig                              m_config;
+    TopicTrie<const IPayloadCodec*>                       m_topicCodecs;
+    std::map<std::string, PayloadCodecPtr_t, std::less<>> m_decoders;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_PUBSUB_ENCODINGPUBSUBCLIENT_H
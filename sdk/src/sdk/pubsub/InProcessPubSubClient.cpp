@@ -0,0 +1,253 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "InProcessPubSubClient.h"
+
+#include "sdk/Logger.h"
+#include "sdk/Status.h"
+#include "sdk/ThreadPool.h"
+
+#include <fmt/core.h>
+
+#include <stdexcept>
+#include <utility>
+
+namespace velocitas {
+
+namespace {
+
+/** Owns topic and payload of a message, which the binary subscriptions refer to */
+struct InProcessMessage {
+    std::string m_topic;
+    std::string m_payload;
+};
+
+template <typename TItem, typename TCreateItem>
+void dispatch(AsyncSubscription<TItem>& subscription, const TCreateItem& createItem) {
+    try {
+        subscription.insertNewItem(createItem());
+    } catch (std::exception& e) {
+        subscription.insertError(
+            Status(fmt::format("In-process: Callback threw an exception on update: {}", e.what())));
+    }
+}
+
+void dispatch(const AsyncSubscriptionPtr_t<std::string>&     text,
+              const AsyncSubscriptionPtr_t<PubSubMessage>&   binary,
+              const std::shared_ptr<const InProcessMessage>& message) {
+    if (text) {
+        dispatch(*text, [&message]() { return message->m_payload; });
+    }
+    if (binary) {
+        dispatch(*binary, [&message]() {
+            return PubSubMessage(message, message->m_topic, message->m_payload, 0, false);
+        });
+    }
+}
+
+bool hasCallbackExecutor(const InProcessBus::Subscriber& subscriber) {
+    return subscriber.m_text ? subscriber.m_text->getCallbackExecutor() != nullptr
+                             : subscriber.m_binary->getCallbackExecutor() != nullptr;
+}
+
+} // namespace
+
+std::shared_ptr<InProcessBus> InProcessBus::getInstance() {
+    static auto instance = std::make_shared<InProcessBus>();
+    return instance;
+}
+
+InProcessBus::InProcessBus()
+    : m_dispatchStrand{Strand::create(ThreadPool::getInstance(ThreadPool::PUBSUB_POOL))} {}
+
+void InProcessBus::subscribe(const std::string& filter, Subscriber subscriber) {
+    m_subscribers.insert(filter, std::move(subscriber));
+}
+
+void InProcessBus::unsubscribe(const std::string& filter, const InProcessPubSubClient* owner) {
+    m_subscribers.removeIf(
+        filter, [owner](const Subscriber& subscriber) { return subscriber.m_owner == owner; });
+}
+
+void InProcessBus::publish(const std::string& topic, const std::string& payload) {
+    struct WeakSubscriber {
+        std::weak_ptr<AsyncSubscription<std::string>>   m_text;
+        std::weak_ptr<AsyncSubscription<PubSubMessage>> m_binary;
+    };
+
+    std::shared_ptr<const InProcessMessage> message;
+    std::vector<WeakSubscriber>             subscribers;
+    m_subscribers.forEachMatch(topic, [&](const Subscriber& subscriber) {
+        if (!message) {
+            message = std::make_shared<const InProcessMessage>(InProcessMessage{topic, payload});
+        }
+        if (hasCallbackExecutor(subscriber)) {
+            dispatch(subscriber.m_text, subscriber.m_binary, message);
+        } else {
+            subscribers.push_back(WeakSubscriber{subscriber.m_text, subscriber.m_binary});
+        }
+    });
+    if (subscribers.empty()) {
+        return;
+    }
+    auto job = m_dispatchStrand->push([subscribers = std::move(subscribers), message]() {
+        for (const auto& subscriber : subscribers) {
+            dispatch(subscriber.m_text.lock(), subscriber.m_binary.lock(), message);
+        }
+    });
+    if (job) {
+        m_dispatchStrand->getThreadPool()->enqueue(std::move(job));
+    }
+}
+
+InProcessPubSubClient::InProcessPubSubClient(std::string                     clientId,
+                                             std::shared_ptr<IPubSubClient>  bridge,
+                                             const std::vector<std::string>& bridgedTopics)
+    : m_bus{InProcessBus::getInstance()}
+    , m_clientId{std::move(clientId)}
+    , m_bridge{std::move(bridge)} {
+    if (!m_bridge && !bridgedTopics.empty()) {
+        throw std::invalid_argument("Bridged topics require a bridge client");
+    }
+    for (const auto& topic : bridgedTopics) {
+        m_bridgedTopics.insert(topic, true);
+    }
+}
+
+InProcessPubSubClient::~InProcessPubSubClient() {
+    for (const auto& topic : m_subscribedTopics) {
+        m_bus->unsubscribe(topic, this);
+    }
+}
+
+void InProcessPubSubClient::connect() {
+    logger().info("Connecting in-process client '{}'", m_clientId);
+    if (m_bridge) {
+        m_bridge->connect();
+    }
+    m_isConnected = true;
+}
+
+void InProcessPubSubClient::reconnect(int timeout_ms) {
+    if (m_bridge) {
+        m_bridge->reconnect(timeout_ms);
+    }
+    m_isConnected = true;
+}
+
+void InProcessPubSubClient::disconnect() {
+    m_isConnected = false;
+    if (m_bridge) {
+        m_bridge->disconnect();
+    }
+}
+
+void InProcessPubSubClient::publishOnTopic(const std::string& topic, const std::string& data) {
+    logger().debug(R"(Publish on topic "{}": "{}")", topic, data);
+    if (isBridged(topic)) {
+        m_bridge->publishOnTopic(topic, data);
+        return;
+    }
+    if (!m_isConnected) {
+        throw std::runtime_error(
+            fmt::format("In-process client '{}' is not connected", m_clientId));
+    }
+    m_bus->publish(topic, data);
+}
+
+PublishStatus InProcessPubSubClient::publishOnTopic(const std::string& topic,
+                                                    const std::string& data, int timeout_ms) {
+    return publishAsync(topic, data, std::chrono::milliseconds(timeout_ms))->await();
+}
+
+AsyncResultPtr_t<PublishStatus>
+InProcessPubSubClient::publishAsync(const std::string& topic, const std::string& data,
+                                    std::chrono::milliseconds timeout) {
+    if (isBridged(topic)) {
+        return m_bridge->publishAsync(topic, data, timeout);
+    }
+    // the message is passed to the subscriptions right away, so it cannot time out
+    auto result = std::make_shared<AsyncResult<PublishStatus>>();
+    try {
+        publishOnTopic(topic, data);
+        result->insertResult(PublishStatus::Success);
+    } catch (const std::exception& ex) {
+        logger().error("Publish failed: {}", ex.what());
+        result->insertResult(PublishStatus::Failure);
+    }
+    return result;
+}
+
+AsyncSubscriptionPtr_t<std::string>
+InProcessPubSubClient::subscribeTopic(const std::string& topic) {
+    if (isBridged(topic)) {
+        return m_bridge->subscribeTopic(topic);
+    }
+    auto subscription = std::make_shared<AsyncSubscription<std::string>>();
+    subscribe(topic, InProcessBus::Subscriber{this, subscription, nullptr});
+    return subscription;
+}
+
+AsyncSubscriptionPtr_t<PubSubMessage>
+InProcessPubSubClient::subscribeTopicBinary(const std::string& topic) {
+    if (isBridged(topic)) {
+        return m_bridge->subscribeTopicBinary(topic);
+    }
+    auto subscription = std::make_shared<AsyncSubscription<PubSubMessage>>();
+    subscribe(topic, InProcessBus::Subscriber{this, nullptr, subscription});
+    return subscription;
+}
+
+void InProcessPubSubClient::unsubscribeTopic(const std::string& topic) {
+    logger().debug("Unsubscribing from {}", topic);
+    if (isBridged(topic)) {
+        m_bridge->unsubscribeTopic(topic);
+        return;
+    }
+    m_bus->unsubscribe(topic, this);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_subscribedTopics.erase(topic);
+}
+
+bool InProcessPubSubClient::isBridged(const std::string& topic) const {
+    // wildcards of a subscribed filter are matched literally, so a filter is bridged if it is
+    // covered by a bridged filter
+    bool isBridged{false};
+    m_bridgedTopics.forEachMatch(topic, [&isBridged](bool /*bridged*/) { isBridged = true; });
+    return isBridged;
+}
+
+void InProcessPubSubClient::subscribe(const std::string&       topic,
+                                      InProcessBus::Subscriber subscriber) {
+    logger().debug("Subscribing to {}", topic);
+    if (subscriber.m_text) {
+        subscriber.m_text->setCallbackExecutor(getCallbackExecutor());
+    } else {
+        subscriber.m_binary->setCallbackExecutor(getCallbackExecutor());
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_subscribedTopics.insert(topic);
+    }
+    m_bus->subscribe(topic, std::move(subscriber));
+}
+
+std::shared_ptr<IPubSubClient>
+IPubSubClient::createInProcess(const std::string& clientId, std::shared_ptr<IPubSubClient> bridge,
+                               const std::vector<std::string>& bridgedTopics) {
+    return std::make_shared<InProcessPubSubClient>(clientId, std::move(bridge), bridgedTopics);
+}
+
+} // namespace velocitas
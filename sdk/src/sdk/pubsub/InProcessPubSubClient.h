@@ -0,0 +1,128 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef VEHICLE_APP_SDK_PUBSUB_INPROCESSPUBSUBCLIENT_H
+#define VEHICLE_APP_SDK_PUBSUB_INPROCESSPUBSUBCLIENT_H
+
+#include "sdk/IPubSubClient.h"
+#include "sdk/Strand.h"
+#include "sdk/pubsub/TopicTrie.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace velocitas {
+
+class InProcessPubSubClient;
+
+/**
+ * @brief Topic bus shared by all in-process clients of the process. Publishing matches the topic
+ * against a snapshot of the subscriptions without taking a lock (see TopicTrie); the payload is
+ * stored once per message and shared by all binary subscriptions.
+ */
+class InProcessBus {
+public:
+    struct Subscriber {
+        const InProcessPubSubClient*          m_owner;
+        AsyncSubscriptionPtr_t<std::string>   m_text;
+        AsyncSubscriptionPtr_t<PubSubMessage> m_binary;
+    };
+
+    static std::shared_ptr<InProcessBus> getInstance();
+
+    InProcessBus();
+
+    void subscribe(const std::string& filter, Subscriber subscriber);
+
+    /**
+     * @brief Remove the subscriptions of the filter created by the owner.
+     */
+    void unsubscribe(const std::string& filter, const InProcessPubSubClient* owner);
+
+    /**
+     * @brief Pass the message to all subscriptions matching the topic. Subscriptions with a
+     * callback executor get it right away, all others via a single job per message on the strand
+     * of the bus, so messages are delivered in the order they are published.
+     */
+    void publish(const std::string& topic, const std::string& payload);
+
+private:
+    TopicTrie<Subscriber> m_subscribers;
+    StrandPtr_t           m_dispatchStrand;
+};
+
+/**
+ * @brief Client exchanging messages with all other in-process clients of the process via the
+ * InProcessBus, following the semantics of an MQTT client: subscriptions may contain wildcards,
+ * a client receives its own publishes, and messages published while disconnected fail.
+ *
+ * Topics (and filters) matching one of the bridged topic filters are published and subscribed
+ * via the bridge client instead, e.g. an MQTT client to exchange them with other processes.
+ */
+class InProcessPubSubClient : public IPubSubClient {
+public:
+    InProcessPubSubClient(std::string clientId, std::shared_ptr<IPubSubClient> bridge,
+                          const std::vector<std::string>& bridgedTopics);
+
+    /**
+     * @brief Removes the subscriptions of the client from the bus.
+     */
+    ~InProcessPubSubClient() override;
+
+    InProcessPubSubClient(const InProcessPubSubClient&)            = delete;
+    InProcessPubSubClient(InProcessPubSubClient&&)                 = delete;
+    InProcessPubSubClient& operator=(const InProcessPubSubClient&) = delete;
+    InProcessPubSubClient& operator=(InProcessPubSubClient&&)      = delete;
+
+    void               connect() override;
+    void               reconnect(int timeout_ms) override;
+    void               disconnect() override;
+    [[nodiscard]] bool isConnected() const override { return m_isConnected; }
+
+    void          publishOnTopic(const std::string& topic, const std::string& data) override;
+    PublishStatus publishOnTopic(const std::string& topic, const std::string& data,
+                                 int timeout_ms) override;
+    AsyncResultPtr_t<PublishStatus> publishAsync(const std::string& topic, const std::string& data,
+                                                 std::chrono::milliseconds timeout) override;
+
+    AsyncSubscriptionPtr_t<std::string>   subscribeTopic(const std::string& topic) override;
+    AsyncSubscriptionPtr_t<PubSubMessage> subscribeTopicBinary(const std::string& topic) override;
+    void                                  unsubscribeTopic(const std::string& topic) override;
+
+    [[nodiscard]] const std::string& getClientId() const { return m_clientId; }
+
+private:
+    [[nodiscard]] bool isBridged(const std::string& topic) const;
+
+    void subscribe(const std::string& topic, InProcessBus::Subscriber subscriber);
+
+    std::shared_ptr<InProcessBus>  m_bus;
+    const std::string              m_clientId;
+    std::shared_ptr<IPubSubClient> m_bridge;
+    TopicTrie<bool>                m_bridgedTopics;
+    std::atomic_bool               m_isConnected{false};
+
+    std::mutex            m_mutex;
+    std::set<std::string> m_subscribedTopics;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_PUBSUB_INPROCESSPUBSUBCLIENT_H
@@ -15,20 +15,199 @@
  */
 
 #include "sdk/IPubSubClient.h"
+#include "sdk/Job.h"
 #include "sdk/Logger.h"
+#include "sdk/Metrics.h"
 #include "sdk/Status.h"
+#include "sdk/Strand.h"
 #include "sdk/ThreadPool.h"
+#include "sdk/TraceEvents.h"
+#include "sdk/Utils.h"
+#include "sdk/pubsub/OfflineQueue.h"
+#include "sdk/pubsub/PublishWindow.h"
+#include "sdk/pubsub/TopicTrie.h"
 
 #include "sdk/middleware/Middleware.h"
 
 #include <mqtt/async_client.h>
-#include <future>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <mqtt/connect_options.h>
-#include <unordered_map>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 namespace velocitas {
 
-class MqttPubSubClient : public IPubSubClient, private mqtt::callback {
+namespace {
+
+const size_t DEFAULT_PUBLISH_WINDOW        = 32;
+const int    DEFAULT_QOS                   = 0;
+const int    DEFAULT_MAX_BUFFERED_MESSAGES = 0;
+const int    MAX_QOS                       = 2;
+const size_t DEFAULT_OFFLINE_QUEUE_CAPACITY = 1024 * 1024;
+
+// interval of checking whether the publishes got completed when draining
+constexpr std::chrono::milliseconds DRAIN_POLL_INTERVAL{5};
+
+size_t determinePublishWindow() {
+    size_t window = DEFAULT_PUBLISH_WINDOW;
+    try {
+        auto windowStr = getEnvVar("SDV_MQTT_PUBLISH_WINDOW");
+        if (!windowStr.empty()) {
+            window = std::stoul(windowStr);
+        }
+    } catch (...) {
+        logger().error("Invalid MQTT publish window specified via env var! Using default ({}).",
+                       window);
+    }
+    return window;
+}
+
+bool isValidQos(int qos) { return qos >= 0 && qos <= MAX_QOS; }
+
+int determineQos() {
+    int qos = DEFAULT_QOS;
+    try {
+        auto qosStr = getEnvVar("SDV_MQTT_QOS");
+        if (!qosStr.empty()) {
+            auto value = std::stoi(qosStr);
+            if (!isValidQos(value)) {
+                throw std::out_of_range("MQTT QoS out of range");
+            }
+            qos = value;
+        }
+    } catch (...) {
+        logger().error("Invalid MQTT QoS specified via env var! Using default ({}).", qos);
+    }
+    return qos;
+}
+
+int determineMaxBufferedMessages() {
+    int maxBufferedMessages = DEFAULT_MAX_BUFFERED_MESSAGES;
+    try {
+        auto maxBufferedStr = getEnvVar("SDV_MQTT_MAX_BUFFERED_MESSAGES");
+        if (!maxBufferedStr.empty()) {
+            maxBufferedMessages = std::stoi(maxBufferedStr);
+        }
+    } catch (...) {
+        logger().error(
+            "Invalid MQTT max buffered messages specified via env var! Using default ({}).",
+            maxBufferedMessages);
+    }
+    return maxBufferedMessages;
+}
+
+/**
+ * Fills the options left unset from the environment or their defaults.
+ * @throw std::invalid_argument if a QoS of the options is invalid.
+ */
+MqttClientOptions resolveOptions(MqttClientOptions options) {
+    if (options.m_qos && !isValidQos(*options.m_qos)) {
+        throw std::invalid_argument(fmt::format("Invalid MQTT QoS {}", *options.m_qos));
+    }
+    for (const auto& [topic, qos] : options.m_topicQos) {
+        if (!isValidQos(qos)) {
+            throw std::invalid_argument(
+                fmt::format(R"(Invalid MQTT QoS {} of topic "{}")", qos, topic));
+        }
+    }
+    if (!options.m_qos) {
+        options.m_qos = determineQos();
+    }
+    if (options.m_maxInFlight == 0) {
+        options.m_maxInFlight = determinePublishWindow();
+    }
+    if (options.m_maxBufferedMessages <= 0) {
+        options.m_maxBufferedMessages = determineMaxBufferedMessages();
+    }
+    if (options.m_offlineQueuePath.empty()) {
+        options.m_offlineQueuePath = getEnvVar("SDV_MQTT_OFFLINE_QUEUE_PATH");
+    }
+    if (options.m_offlineQueueCapacity == 0) {
+        options.m_offlineQueueCapacity = DEFAULT_OFFLINE_QUEUE_CAPACITY;
+    }
+    return options;
+}
+
+std::unique_ptr<OfflineQueue> createOfflineQueue(const MqttClientOptions& options) {
+    if (options.m_offlineQueuePath.empty()) {
+        return nullptr;
+    }
+    return std::make_unique<OfflineQueue>(options.m_offlineQueuePath,
+                                          options.m_offlineQueueCapacity,
+                                          options.m_offlineDropPolicy, options.m_offlineRetention);
+}
+
+StrandPtr_t createDispatchStrand() {
+    return Strand::create(ThreadPool::getInstance(ThreadPool::PUBSUB_POOL));
+}
+
+/**
+ * Metrics of the publishes sent to the broker, i.e. not of the ones queued offline.
+ */
+struct PublishMetrics {
+    /** Time from handing a message to paho until the publish completed (or failed) */
+    Histogram& m_latency;
+    Counter&   m_numSucceeded;
+    Counter&   m_numFailed;
+
+    static PublishMetrics& get() {
+        auto&                 registry = MetricsRegistry::getInstance();
+        static PublishMetrics metrics{
+            registry.getHistogram("sdv_mqtt_publish_latency_nanoseconds",
+                                  "Time from sending an MQTT publish until its completion"),
+            registry.getCounter("sdv_mqtt_publishes_total", "Number of completed MQTT publishes",
+                                {{"status", "success"}}),
+            registry.getCounter("sdv_mqtt_publishes_total", "Number of completed MQTT publishes",
+                                {{"status", "failure"}})};
+        return metrics;
+    }
+
+    void record(bool isSuccess, std::chrono::steady_clock::time_point startTime) {
+        const auto latency = std::chrono::steady_clock::now() - startTime;
+        m_latency.record(static_cast<uint64_t>(
+            std::max<int64_t>(0, std::chrono::nanoseconds(latency).count())));
+        (isSuccess ? m_numSucceeded : m_numFailed).increment();
+    }
+};
+
+/**
+ * Reports the completion of a single publish to the publish window; deletes itself afterwards,
+ * as paho calls exactly one of its methods.
+ */
+class PublishListener final : public mqtt::iaction_listener {
+public:
+    explicit PublishListener(PublishWindow::DoneHandler_t onDone)
+        : m_onDone(std::move(onDone))
+        , m_startTime(std::chrono::steady_clock::now()) {}
+
+private:
+    void on_success(const mqtt::token& /*tok*/) override { complete(PublishStatus::Success); }
+
+    void on_failure(const mqtt::token& tok) override {
+        logger().error("MQTT publish failed: rc={}", tok.get_return_code());
+        complete(PublishStatus::Failure);
+    }
+
+    void complete(PublishStatus status) {
+        PublishMetrics::get().record(status == PublishStatus::Success, m_startTime);
+        auto onDone = std::move(m_onDone);
+        delete this;
+        onDone(status);
+    }
+
+    PublishWindow::DoneHandler_t          m_onDone;
+    std::chrono::steady_clock::time_point m_startTime;
+};
+
+} // namespace
+
+class MqttPubSubClient : public IPubSubClient,
+                         public std::enable_shared_from_this<MqttPubSubClient>,
+                         private mqtt::callback {
 public:
     MqttPubSubClient()                                   = delete;
     MqttPubSubClient(const MqttPubSubClient&)            = delete;
@@ -36,22 +215,32 @@ public:
     MqttPubSubClient& operator=(const MqttPubSubClient&) = delete;
     MqttPubSubClient& operator=(MqttPubSubClient&&)      = delete;
 
-    MqttPubSubClient(const std::string& brokerUri, const std::string& clientId)
-        : m_client{brokerUri, clientId}
-        , m_connectOptions{} {
+    MqttPubSubClient(const std::string& brokerUri, const std::string& clientId,
+                     const MqttClientOptions& options = {})
+        : m_options{resolveOptions(options)}
+        , m_client{brokerUri, clientId, m_options.m_maxBufferedMessages, nullptr}
+        , m_connectOptions{}
+        , m_publishWindow{std::make_shared<PublishWindow>(m_options.m_maxInFlight)} {
         m_client.set_callback(*this);
+        for (const auto& [topic, qos] : m_options.m_topicQos) {
+            m_topicQos.insert(topic, qos);
+        }
     }
 
     MqttPubSubClient(const std::string& brokerUri, const std::string& clientId,
                      const std::string& username, const std::string& password)
-        : m_client{brokerUri, clientId}
-        , m_connectOptions{username, password} {
+        : m_options{resolveOptions({})}
+        , m_client{brokerUri, clientId, m_options.m_maxBufferedMessages, nullptr}
+        , m_connectOptions{username, password}
+        , m_publishWindow{std::make_shared<PublishWindow>(m_options.m_maxInFlight)} {
         m_client.set_callback(*this);
     }
 
     MqttPubSubClient(const std::string& brokerUri, const std::string& clientId,
                      const std::string& token)
-        : m_client{brokerUri, clientId} {
+        : m_options{resolveOptions({})}
+        , m_client{brokerUri, clientId, m_options.m_maxBufferedMessages, nullptr}
+        , m_publishWindow{std::make_shared<PublishWindow>(m_options.m_maxInFlight)} {
         m_client.set_callback(*this);
         m_connectOptions = mqtt::connect_options_builder().user_name(token).finalize();
     }
@@ -59,7 +248,9 @@ public:
     MqttPubSubClient(const std::string& brokerUri, const std::string& clientId,
                      const std::string& trustStorePath, const std::string& keyStorePath,
                      const std::string& privateKeyPath)
-        : m_client{brokerUri, clientId} {
+        : m_options{resolveOptions({})}
+        , m_client{brokerUri, clientId, m_options.m_maxBufferedMessages, nullptr}
+        , m_publishWindow{std::make_shared<PublishWindow>(m_options.m_maxInFlight)} {
         m_client.set_callback(*this);
         auto sslopts =
             mqtt::ssl_options_builder()
@@ -83,6 +274,8 @@ public:
                           "consider to remove it");
         }
 
+        // paho rejects publishes exceeding its in-flight limit, so it gets the size of the window
+        m_connectOptions.set_max_inflight(static_cast<int>(m_publishWindow->getMaxInFlight()));
         m_client.connect(m_connectOptions)->wait();
     }
 
@@ -103,86 +296,301 @@ public:
     }
 
     void               disconnect() override { m_client.disconnect()->wait(); }
+
+    size_t drainAndDisconnect(std::chrono::milliseconds timeout) override {
+        const auto deadline   = std::chrono::steady_clock::now() + timeout;
+        const auto numPending = [this] {
+            return m_publishWindow->getNumInFlight() + m_publishWindow->getNumQueued();
+        };
+        while (numPending() > 0 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(DRAIN_POLL_INTERVAL);
+        }
+        const auto numDropped = numPending();
+        if (numDropped > 0) {
+            logger().warn("Disconnecting from MQTT broker with {} publishes not completed",
+                          numDropped);
+        }
+
+        try {
+            const auto remaining = std::max(std::chrono::steady_clock::duration::zero(),
+                                            deadline - std::chrono::steady_clock::now());
+            if (!m_client.disconnect()->wait_for(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(remaining))) {
+                logger().warn("MQTT disconnect did not complete within {} ms", timeout.count());
+            }
+        } catch (const mqtt::exception& ex) {
+            logger().error("MQTT disconnect failed: {}", ex.what());
+        }
+        return numDropped;
+    }
     [[nodiscard]] bool isConnected() const override { return m_client.is_connected(); }
 
     void publishOnTopic(const std::string& topic, const std::string& data) override {
         logger().debug(R"(Publish on topic "{}": "{}")", topic, data);
-        m_client.publish(topic, data)->wait();
+        if (isPublishingOffline()) {
+            publishOffline(topic, data);
+            return;
+        }
+        const auto startTime = std::chrono::steady_clock::now();
+        try {
+            m_client.publish(topic, data, getQos(topic), false)->wait();
+        } catch (...) {
+            PublishMetrics::get().record(false, startTime);
+            throw;
+        }
+        PublishMetrics::get().record(true, startTime);
     }
 
     PublishStatus publishOnTopic(const std::string& topic, const std::string& data,
-                                 int timeout_ms) {
-        try {
-            logger().debug(R"(Publish on topic "{}": "{}")", topic, data);
-
-            auto future = std::async(std::launch::async, [this, &topic, &data]() {
-                auto tok = m_client.publish(topic, data);
-                if (!tok) {
-                    throw mqtt::exception(MQTTASYNC_FAILURE);
-                }
-                tok->wait();
-                return PublishStatus::Success;
-            });
-
-            if (future.wait_for(std::chrono::milliseconds(timeout_ms)) ==
-                std::future_status::ready) {
-                return future.get(); // Success
-            } else {
-                logger().warn("Publish timed out after {} ms", timeout_ms);
-                return PublishStatus::Timeout;
-            }
+                                 int timeout_ms) override {
+        const auto status =
+            publishAsync(topic, data, std::chrono::milliseconds(timeout_ms))->await();
+        if (status == PublishStatus::Timeout) {
+            logger().warn("Publish timed out after {} ms", timeout_ms);
+        }
+        return status;
+    }
 
-        } catch (const mqtt::exception& ex) {
-            logger().error("MQTT publish failed: {}", ex.what());
-            return PublishStatus::Failure;
-        } catch (const std::exception& ex) {
-            logger().error("Unexpected exception during publish: {}", ex.what());
-            return PublishStatus::Failure;
+    AsyncResultPtr_t<PublishStatus> publishAsync(const std::string& topic, const std::string& data,
+                                                 std::chrono::milliseconds timeout) override {
+        logger().debug(R"(Publish on topic "{}": "{}")", topic, data);
+        if (isPublishingOffline()) {
+            auto result = std::make_shared<AsyncResult<PublishStatus>>();
+            result->insertResult(publishOffline(topic, data));
+            return result;
         }
+        return submit(mqtt::make_message(topic, data, getQos(topic), false), timeout);
     }
 
     AsyncSubscriptionPtr_t<std::string> subscribeTopic(const std::string& topic) override {
-        logger().debug("Subscribing to {}", topic);
         auto subscription = std::make_shared<AsyncSubscription<std::string>>();
-        m_subscriberMap.insert(std::make_pair(topic, subscription));
-        m_client.subscribe(topic, 0)->wait();
+        subscribe(topic, Subscriber{subscription, nullptr});
         return subscription;
     }
 
-    void unsubscribeTopic(const std::string& topic) {
+    AsyncSubscriptionPtr_t<PubSubMessage> subscribeTopicBinary(const std::string& topic) override {
+        auto subscription = std::make_shared<AsyncSubscription<PubSubMessage>>();
+        subscribe(topic, Subscriber{nullptr, subscription});
+        return subscription;
+    }
+
+    void unsubscribeTopic(const std::string& topic) override {
         logger().debug("Unsubscribing from {}", topic);
         m_client.unsubscribe(topic)->wait();
-        auto range = m_subscriberMap.equal_range(topic);
-        m_subscriberMap.erase(range.first, range.second);
+        m_subscribers.remove(topic);
     }
 
 private:
-    void message_arrived(mqtt::const_message_ptr msg) override {
-        const std::string& topic   = msg->get_topic();
-        const std::string& payload = msg->get_payload_str();
-        logger().debug(R"(MQTT: Update on topic "{}": "{}")", topic, payload);
-
-        // Todo: Replace by solution capable handling wildcards
-        auto range = m_subscriberMap.equal_range(topic);
-        for (auto it = range.first; it != range.second; ++it) {
-            auto subscription = it->second;
-            ThreadPool::getInstance()->enqueue(Job::create([subscription, payload]() {
-                try {
-                    subscription->insertNewItem(std::string(payload));
-                } catch (std::exception& e) {
-                    subscription->insertError(Status(
-                        fmt::format("MQTT: Callback threw an exception on update: {}", e.what())));
+    /** Either a text or a binary subscription */
+    struct Subscriber {
+        AsyncSubscriptionPtr_t<std::string>   m_text;
+        AsyncSubscriptionPtr_t<PubSubMessage> m_binary;
+
+        [[nodiscard]] bool hasCallbackExecutor() const {
+            return m_text ? m_text->getCallbackExecutor() != nullptr
+                          : m_binary->getCallbackExecutor() != nullptr;
+        }
+    };
+
+    struct WeakSubscriber {
+        std::weak_ptr<AsyncSubscription<std::string>>   m_text;
+        std::weak_ptr<AsyncSubscription<PubSubMessage>> m_binary;
+    };
+
+    AsyncResultPtr_t<PublishStatus> submit(mqtt::const_message_ptr   message,
+                                           std::chrono::milliseconds timeout) {
+        return m_publishWindow->submit(
+            [this, message = std::move(message)](PublishWindow::DoneHandler_t onDone) {
+                auto listener = std::make_unique<PublishListener>(std::move(onDone));
+                m_client.publish(message, nullptr, *listener);
+                // paho completed or failed the publish, if the call did not throw
+                listener.release();
+            },
+            timeout);
+    }
+
+    [[nodiscard]] bool isPublishingOffline() const {
+        // while older messages are queued, new ones are queued as well to keep their order
+        return m_offlineQueue &&
+               (!m_client.is_connected() || m_isDraining || !m_offlineQueue->empty());
+    }
+
+    PublishStatus publishOffline(const std::string& topic, const std::string& data) {
+        if (!m_offlineQueue->push(topic, data, getQos(topic))) {
+            logger().warn(R"(MQTT offline queue is full, dropped message on topic "{}")", topic);
+            return PublishStatus::Failure;
+        }
+        // the drain may have completed since checking whether to publish offline
+        if (m_client.is_connected()) {
+            scheduleDrain();
+        }
+        return PublishStatus::Queued;
+    }
+
+    void connected(const std::string& /*cause*/) override { scheduleDrain(); }
+
+    void scheduleDrain() {
+        if (!m_offlineQueue || m_isDraining.exchange(true)) {
+            return;
+        }
+        enqueueDrainBatch();
+    }
+
+    void enqueueDrainBatch() {
+        ThreadPool::getInstance(ThreadPool::PUBSUB_POOL)
+            ->enqueue(Job::create([weakSelf = weak_from_this()]() {
+                if (auto self = weakSelf.lock()) {
+                    self->drainBatch();
                 }
             }));
+    }
+
+    /**
+     * Publishes the oldest queued messages as one batch of the size of the publish window. They
+     * are removed from the queue once all of them are published, so messages are published at
+     * least once: if the connection drops, the whole batch is published again after reconnecting.
+     */
+    void drainBatch() {
+        auto records = m_offlineQueue->peek(m_publishWindow->getMaxInFlight());
+        if (records.empty() || !m_client.is_connected()) {
+            m_isDraining = false;
+            // messages may have been queued since peeking
+            if (!m_offlineQueue->empty() && m_client.is_connected()) {
+                scheduleDrain();
+            }
+            return;
+        }
+        logger().debug("Publishing {} messages of the MQTT offline queue", records.size());
+        auto numPending = std::make_shared<std::atomic_size_t>(records.size());
+        auto isFailed   = std::make_shared<std::atomic_bool>(false);
+        // the batch is identified by the id of its last record, not by its size: publishes
+        // meanwhile queued may drop the oldest records, i.e. ones of the batch
+        const auto lastId = records.back().m_id;
+        for (auto& record : records) {
+            submit(mqtt::make_message(record.m_topic, record.m_payload, record.m_qos, false),
+                   std::chrono::milliseconds(0))
+                ->onResult([weakSelf = weak_from_this(), numPending, isFailed,
+                            lastId](const PublishStatus& status) {
+                    if (status != PublishStatus::Success) {
+                        *isFailed = true;
+                    }
+                    auto self = weakSelf.lock();
+                    if (--*numPending == 0 && self) {
+                        self->onBatchDrained(lastId, *isFailed);
+                    }
+                });
+        }
+    }
+
+    void onBatchDrained(uint64_t lastId, bool isFailed) {
+        if (isFailed) {
+            logger().warn("Publishing the MQTT offline queue failed, retrying after reconnect");
+            m_isDraining = false;
+            return;
+        }
+        m_offlineQueue->popUntil(lastId);
+        enqueueDrainBatch();
+    }
+
+    /**
+     * Returns the QoS configured for the topic or filter: the one it is contained in the options
+     * with, otherwise the highest one of the filters matching it, otherwise the default QoS.
+     */
+    [[nodiscard]] int getQos(const std::string& topic) const {
+        if (const auto iter = m_options.m_topicQos.find(topic);
+            iter != m_options.m_topicQos.end()) {
+            return iter->second;
+        }
+        std::optional<int> qos;
+        m_topicQos.forEachMatch(topic, [&qos](int filterQos) {
+            qos = std::max(qos.value_or(filterQos), filterQos);
+        });
+        return qos.value_or(*m_options.m_qos);
+    }
+
+    void subscribe(const std::string& topic, Subscriber subscriber) {
+        logger().debug("Subscribing to {}", topic);
+        if (subscriber.m_text) {
+            subscriber.m_text->setCallbackExecutor(getCallbackExecutor());
+        } else {
+            subscriber.m_binary->setCallbackExecutor(getCallbackExecutor());
         }
+        m_subscribers.insert(topic, std::move(subscriber));
+        m_client.subscribe(topic, getQos(topic))->wait();
     }
 
-    using TopicMap_t =
-        std::unordered_multimap<std::string, std::shared_ptr<AsyncSubscription<std::string>>>;
+    void message_arrived(mqtt::const_message_ptr msg) override {
+        VELOCITAS_TRACE_SPAN("pubsub", "MqttPubSubClient::message_arrived");
+        if (logger().isEnabled(LogLevel::DEBUG)) {
+            logger().debug(R"(MQTT: Update on topic "{}": "{}")", msg->get_topic(),
+                           msg->get_payload_str());
+        }
 
-    mqtt::async_client    m_client;
-    mqtt::connect_options m_connectOptions;
-    TopicMap_t            m_subscriberMap;
+        // Subscriptions with an executor dispatch their callbacks on their own. All others are
+        // served by a single job per message, dispatched via the executor or strand of the
+        // client, so the items are delivered in order.
+        std::vector<WeakSubscriber> subscribers;
+        m_subscribers.forEachMatch(msg->get_topic(), [&](const Subscriber& subscriber) {
+            if (subscriber.hasCallbackExecutor()) {
+                dispatch(subscriber.m_text, subscriber.m_binary, msg);
+            } else {
+                subscribers.push_back(WeakSubscriber{subscriber.m_text, subscriber.m_binary});
+            }
+        });
+        if (subscribers.empty()) {
+            return;
+        }
+        // the message keeps the payload, so it is not copied until handed to text subscriptions
+        auto dispatchAll = [subscribers = std::move(subscribers), msg]() {
+            for (const auto& subscriber : subscribers) {
+                dispatch(subscriber.m_text.lock(), subscriber.m_binary.lock(), msg);
+            }
+        };
+        if (auto executor = getExecutor()) {
+            executor->post(std::move(dispatchAll));
+            return;
+        }
+        auto job = m_dispatchStrand->push(std::move(dispatchAll));
+        if (job) {
+            m_dispatchStrand->getThreadPool()->enqueue(std::move(job));
+        }
+    }
+
+    static void dispatch(const AsyncSubscriptionPtr_t<std::string>&   text,
+                         const AsyncSubscriptionPtr_t<PubSubMessage>& binary,
+                         const mqtt::const_message_ptr&               msg) {
+        if (text) {
+            dispatch(*text, [&msg]() { return std::string(msg->get_payload_str()); });
+        }
+        if (binary) {
+            dispatch(*binary, [&msg]() {
+                const auto& payload = msg->get_payload();
+                return PubSubMessage(msg, msg->get_topic(),
+                                     std::string_view(payload.data(), payload.size()),
+                                     msg->get_qos(), msg->is_retained());
+            });
+        }
+    }
+
+    template <typename TItem, typename TCreateItem>
+    static void dispatch(AsyncSubscription<TItem>& subscription, const TCreateItem& createItem) {
+        try {
+            subscription.insertNewItem(createItem());
+        } catch (std::exception& e) {
+            subscription.insertError(
+                Status(fmt::format("MQTT: Callback threw an exception on update: {}", e.what())));
+        }
+    }
+
+    const MqttClientOptions        m_options;
+    TopicTrie<int>                 m_topicQos;
+    mqtt::async_client             m_client;
+    mqtt::connect_options          m_connectOptions;
+    TopicTrie<Subscriber>          m_subscribers;
+    std::shared_ptr<PublishWindow> m_publishWindow;
+    StrandPtr_t                    m_dispatchStrand{createDispatchStrand()};
+    std::unique_ptr<OfflineQueue>  m_offlineQueue{createOfflineQueue(m_options)};
+    std::atomic_bool               m_isDraining{false};
 };
 
 std::shared_ptr<IPubSubClient> IPubSubClient::createInstance(const std::string& clientId) {
@@ -194,6 +602,12 @@ std::shared_ptr<IPubSubClient> IPubSubClient::createInstance(const std::string&
     return std::make_shared<MqttPubSubClient>(brokerUri, clientId);
 }
 
+std::shared_ptr<IPubSubClient> IPubSubClient::createInstance(const std::string&       brokerUri,
+                                                             const std::string&       clientId,
+                                                             const MqttClientOptions& options) {
+    return std::make_shared<MqttPubSubClient>(brokerUri, clientId, options);
+}
+
 std::shared_ptr<IPubSubClient> IPubSubClient::createInstance(const std::string& brokerUri,
                                                              const std::string& clientId,
                                                              const std::string& username,
@@ -215,4 +629,54 @@ std::shared_ptr<IPubSubClient> IPubSubClient::createInstance(const std::string&
                                               privateKeyPath);
 }
 
+AsyncSubscriptionPtr_t<PubSubMessage>
+IPubSubClient::subscribeTopicBinary(const std::string& topic) {
+    auto subscription = std::make_shared<AsyncSubscription<PubSubMessage>>();
+    subscription->setCallbackExecutor(getCallbackExecutor());
+    // the text subscription is kept by the client, and keeps the binary one
+    subscribeTopic(topic)
+        ->onItemMoved([subscription, topic](std::string&& item) {
+            auto message =
+                std::make_shared<const std::pair<std::string, std::string>>(topic, std::move(item));
+            subscription->insertNewItem(
+                PubSubMessage(message, message->first, message->second, 0, false));
+        })
+        ->onError([subscription](const Status& status) {
+            subscription->insertError(Status(status));
+        });
+    return subscription;
+}
+
+AsyncResultPtr_t<PublishStatus> IPubSubClient::publishAsync(const std::string&        topic,
+                                                            const std::string&        data,
+                                                            std::chrono::milliseconds timeout) {
+    auto result = std::make_shared<AsyncResult<PublishStatus>>();
+    if (timeout.count() > 0) {
+        result->insertResult(publishOnTopic(topic, data, static_cast<int>(timeout.count())));
+        return result;
+    }
+    try {
+        publishOnTopic(topic, data);
+        result->insertResult(PublishStatus::Success);
+    } catch (const std::exception& ex) {
+        logger().error("Publish failed: {}", ex.what());
+        result->insertResult(PublishStatus::Failure);
+    }
+    return result;
+}
+
+void IPubSubClient::setCallbackExecutor(CallbackExecutorPtr_t executor) {
+    std::atomic_store(&m_callbackExecutor, std::move(executor));
+}
+
+CallbackExecutorPtr_t IPubSubClient::getCallbackExecutor() const {
+    return std::atomic_load(&m_callbackExecutor);
+}
+
+void IPubSubClient::setExecutor(ExecutorPtr_t executor) {
+    std::atomic_store(&m_executor, std::move(executor));
+}
+
+ExecutorPtr_t IPubSubClient::getExecutor() const { return std::atomic_load(&m_executor); }
+
 } // namespace velocitas
@@ -0,0 +1,279 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/pubsub/OfflineQueue.h"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace velocitas {
+
+struct OfflineQueue::Header {
+    uint64_t m_magic;
+    uint64_t m_capacity;
+    uint64_t m_head;
+    uint64_t m_tail;
+    uint64_t m_numRecords;
+};
+
+struct OfflineQueue::RecordHeader {
+    uint32_t m_topicSize;
+    uint32_t m_payloadSize;
+    int32_t  m_qos;
+    int32_t  m_reserved;
+    int64_t  m_timestampMs;
+};
+
+namespace {
+
+constexpr uint64_t MAGIC       = 0x5344564f51554555; // "SDVOQUEU"
+constexpr uint32_t WRAP_MARKER = 0xffffffff;
+
+std::runtime_error systemError(const std::string& what, const std::string& path) {
+    return std::runtime_error(
+        fmt::format("Offline queue: {} '{}' failed: {}", what, path, std::strerror(errno)));
+}
+
+} // namespace
+
+OfflineQueue::OfflineQueue(const std::string& path, size_t capacity, DropPolicy dropPolicy,
+                           std::chrono::milliseconds retention)
+    : m_dropPolicy{dropPolicy}
+    , m_retention{retention} {
+    static_assert(sizeof(RecordHeader) == 24, "Record header is part of the file format");
+
+    m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (m_fd < 0) {
+        throw systemError("Opening", path);
+    }
+    struct stat fileStat {};
+    m_fileSize = sizeof(Header) + capacity;
+    if (::fstat(m_fd, &fileStat) != 0 ||
+        (static_cast<size_t>(fileStat.st_size) != m_fileSize &&
+         ::ftruncate(m_fd, static_cast<off_t>(m_fileSize)) != 0)) {
+        ::close(m_fd);
+        throw systemError("Resizing", path);
+    }
+    void* mapping = ::mmap(nullptr, m_fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (mapping == MAP_FAILED) {
+        ::close(m_fd);
+        throw systemError("Mapping", path);
+    }
+    m_header = static_cast<Header*>(mapping);
+    m_data   = static_cast<uint8_t*>(mapping) + sizeof(Header);
+
+    const bool isValid = m_header->m_magic == MAGIC && m_header->m_capacity == capacity &&
+                         m_header->m_head <= capacity && m_header->m_tail <= capacity &&
+                         hasValidRecords();
+    if (!isValid) {
+        *m_header = Header{MAGIC, capacity, 0, 0, 0};
+    }
+}
+
+OfflineQueue::~OfflineQueue() {
+    ::munmap(m_header, m_fileSize);
+    ::close(m_fd);
+}
+
+bool OfflineQueue::push(const std::string& topic, const std::string& payload, int qos) {
+    const auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch());
+    const RecordHeader record{static_cast<uint32_t>(topic.size()),
+                              static_cast<uint32_t>(payload.size()), qos, 0,
+                              static_cast<int64_t>(timestamp.count())};
+    const size_t       recordSize = sizeof(RecordHeader) + topic.size() + payload.size();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!reserve(recordSize)) {
+        ++m_numDropped;
+        return false;
+    }
+    uint8_t* target = m_data + m_header->m_tail;
+    std::memcpy(target, &record, sizeof(record));
+    std::memcpy(target + sizeof(record), topic.data(), topic.size());
+    std::memcpy(target + sizeof(record) + topic.size(), payload.data(), payload.size());
+    m_header->m_tail += recordSize;
+    ++m_header->m_numRecords;
+    return true;
+}
+
+std::vector<OfflineQueue::Record> OfflineQueue::peek(size_t maxRecords) {
+    std::vector<Record>         records;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto                  now = std::chrono::system_clock::now();
+    while (m_header->m_numRecords > 0 && isExpired(m_header->m_head, now)) {
+        popOne();
+        ++m_numDropped;
+    }
+
+    size_t offset = m_header->m_head;
+    for (size_t i = 0; i < std::min<size_t>(maxRecords, m_header->m_numRecords); ++i) {
+        if (m_header->m_capacity - offset < sizeof(RecordHeader)) {
+            offset = 0;
+        }
+        RecordHeader header{};
+        std::memcpy(&header, m_data + offset, sizeof(header));
+        if (header.m_topicSize == WRAP_MARKER) {
+            offset = 0;
+            std::memcpy(&header, m_data, sizeof(header));
+        }
+        const auto* topic = reinterpret_cast<const char*>(m_data + offset + sizeof(header));
+        const std::chrono::system_clock::time_point timestamp(
+            std::chrono::milliseconds(header.m_timestampMs));
+        records.push_back(Record{std::string(topic, header.m_topicSize),
+                                 std::string(topic + header.m_topicSize, header.m_payloadSize),
+                                 header.m_qos, timestamp, m_headId + i});
+        offset += getRecordSize(offset);
+    }
+    return records;
+}
+
+void OfflineQueue::pop(size_t numRecords) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (size_t i = 0; i < numRecords && m_header->m_numRecords > 0; ++i) {
+        popOne();
+    }
+}
+
+void OfflineQueue::popUntil(uint64_t id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    while (m_header->m_numRecords > 0 && m_headId <= id) {
+        popOne();
+    }
+}
+
+size_t OfflineQueue::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_header->m_numRecords;
+}
+
+size_t OfflineQueue::getNumDropped() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_numDropped;
+}
+
+bool OfflineQueue::hasValidRecords() const {
+    // Nothing is synced explicitly, so a crash may have left a torn record behind. Walk the
+    // records like peek does, but check each one to lie within the ring before trusting it.
+    const uint64_t capacity = m_header->m_capacity;
+    if (m_header->m_numRecords > capacity / sizeof(RecordHeader)) {
+        return false;
+    }
+    uint64_t offset = m_header->m_head;
+    for (uint64_t i = 0; i < m_header->m_numRecords; ++i) {
+        if (capacity - offset < sizeof(RecordHeader)) {
+            offset = 0;
+        }
+        RecordHeader header{};
+        std::memcpy(&header, m_data + offset, sizeof(header));
+        if (header.m_topicSize == WRAP_MARKER) {
+            offset = 0;
+            std::memcpy(&header, m_data, sizeof(header));
+        }
+        const uint64_t recordSize =
+            uint64_t{sizeof(header)} + header.m_topicSize + header.m_payloadSize;
+        if (recordSize > capacity - offset) {
+            return false;
+        }
+        offset += recordSize;
+    }
+    return offset == m_header->m_tail;
+}
+
+size_t OfflineQueue::getRecordSize(size_t offset) const {
+    RecordHeader header{};
+    std::memcpy(&header, m_data + offset, sizeof(header));
+    return sizeof(header) + header.m_topicSize + header.m_payloadSize;
+}
+
+bool OfflineQueue::isExpired(size_t offset, std::chrono::system_clock::time_point now) const {
+    if (m_retention.count() == 0) {
+        return false;
+    }
+    int64_t timestampMs{0};
+    std::memcpy(&timestampMs, m_data + offset + offsetof(RecordHeader, m_timestampMs),
+                sizeof(timestampMs));
+    return now - std::chrono::system_clock::time_point(std::chrono::milliseconds(timestampMs)) >
+           m_retention;
+}
+
+void OfflineQueue::popOne() {
+    ++m_headId;
+    m_header->m_head += getRecordSize(m_header->m_head);
+    if (--m_header->m_numRecords == 0) {
+        m_header->m_head = 0;
+        m_header->m_tail = 0;
+        return;
+    }
+    skipWrapAtHead();
+}
+
+void OfflineQueue::skipWrapAtHead() {
+    // the head always refers to a record, unless the records at the end of the ring were consumed
+    const size_t head = m_header->m_head;
+    if (m_header->m_capacity - head < sizeof(RecordHeader)) {
+        m_header->m_head = 0;
+        return;
+    }
+    uint32_t topicSize{0};
+    std::memcpy(&topicSize, m_data + head, sizeof(topicSize));
+    if (topicSize == WRAP_MARKER) {
+        m_header->m_head = 0;
+    }
+}
+
+bool OfflineQueue::reserve(size_t recordSize) {
+    const size_t capacity = m_header->m_capacity;
+    if (recordSize > capacity) {
+        return false;
+    }
+    while (true) {
+        const size_t head = m_header->m_head;
+        const size_t tail = m_header->m_tail;
+        if (m_header->m_numRecords == 0 || tail > head) {
+            // the records are [head, tail), the free space is [tail, capacity) and [0, head)
+            if (capacity - tail >= recordSize) {
+                return true;
+            }
+            if (head >= recordSize) {
+                if (capacity - tail >= sizeof(WRAP_MARKER)) {
+                    std::memcpy(m_data + tail, &WRAP_MARKER, sizeof(WRAP_MARKER));
+                }
+                m_header->m_tail = 0;
+                return true;
+            }
+        } else if (head - tail >= recordSize) {
+            // the records are wrapped, the free space is [tail, head)
+            return true;
+        }
+        if (m_dropPolicy == DropPolicy::DROP_NEWEST) {
+            return false;
+        }
+        popOne();
+        ++m_numDropped;
+    }
+}
+
+} // namespace velocitas
@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef VEHICLE_APP_SDK_PUBSUB_OFFLINEQUEUE_H
+#define VEHICLE_APP_SDK_PUBSUB_OFFLINEQUEUE_H
+
+#include "sdk/IPubSubClient.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief Bounded queue of outgoing messages persisted in a memory mapped file, so they survive
+ * a restart of the app. The records are appended to a ring within the file; pushing costs one copy
+ * into the mapping and never waits for the disk or the network.
+ *
+ * The records of a previous run are kept if the file was created with the same capacity.
+ */
+class OfflineQueue {
+public:
+    using DropPolicy = MqttClientOptions::OfflineDropPolicy;
+
+    struct Record {
+        std::string                           m_topic;
+        std::string                           m_payload;
+        int                                   m_qos{0};
+        std::chrono::system_clock::time_point m_timestamp;
+        /** Position of the record in the queue since it was opened, see popUntil */
+        uint64_t m_id{0};
+    };
+
+    /**
+     * @brief Open the queue file, creating it if it does not exist.
+     *
+     * @param path        Path of the file.
+     * @param capacity    Number of bytes available for records, each taking 24 bytes plus the
+     *                    size of its topic and payload.
+     * @param dropPolicy  Which message to drop if the queue is full.
+     * @param retention   Age of messages they are dropped at instead of being published; zero for
+     *                    keeping them until published.
+     * @throw std::runtime_error if the file cannot be created or mapped.
+     */
+    OfflineQueue(const std::string& path, size_t capacity, DropPolicy dropPolicy,
+                 std::chrono::milliseconds retention);
+
+    ~OfflineQueue();
+
+    OfflineQueue(const OfflineQueue&)            = delete;
+    OfflineQueue(OfflineQueue&&)                 = delete;
+    OfflineQueue& operator=(const OfflineQueue&) = delete;
+    OfflineQueue& operator=(OfflineQueue&&)      = delete;
+
+    /**
+     * @brief Append a message, dropping the oldest ones if needed and the policy says so.
+     *
+     * @return true if the message was queued, false if it was dropped.
+     */
+    bool push(const std::string& topic, const std::string& payload, int qos);
+
+    /**
+     * @brief Get copies of the oldest messages without removing them; messages exceeding the
+     * retention are removed first.
+     */
+    [[nodiscard]] std::vector<Record> peek(size_t maxRecords);
+
+    /**
+     * @brief Remove the oldest messages, e.g. after they were published.
+     */
+    void pop(size_t numRecords);
+
+    /**
+     * @brief Remove the oldest messages up to and including the one with the given id, e.g. after
+     * a peeked batch was published. In contrast to pop, messages pushed and dropped meanwhile
+     * do not shift the removed range, so messages queued after the batch are kept.
+     */
+    void popUntil(uint64_t id);
+
+    [[nodiscard]] size_t size() const;
+    [[nodiscard]] bool   empty() const { return size() == 0; }
+
+    /** Number of messages dropped because the queue was full or they exceeded the retention */
+    [[nodiscard]] size_t getNumDropped() const;
+
+private:
+    struct Header;
+    struct RecordHeader;
+
+    [[nodiscard]] bool   hasValidRecords() const;
+    [[nodiscard]] size_t getRecordSize(size_t offset) const;
+    [[nodiscard]] bool   isExpired(size_t offset, std::chrono::system_clock::time_point now) const;
+
+    // need to be called with m_mutex being locked
+    void   popOne();
+    void   skipWrapAtHead();
+    bool   reserve(size_t recordSize);
+
+    const DropPolicy                m_dropPolicy;
+    const std::chrono::milliseconds m_retention;
+
+    mutable std::mutex m_mutex;
+    int                m_fd{-1};
+    size_t             m_fileSize{0};
+    Header*            m_header{nullptr};
+    uint8_t*           m_data{nullptr};
+    size_t             m_numDropped{0};
+    // id of the record at the head, counting all records removed since opening the queue
+    uint64_t           m_headId{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_PUBSUB_OFFLINEQUEUE_H
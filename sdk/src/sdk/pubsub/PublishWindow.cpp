@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "PublishWindow.h"
+
+#include "sdk/ThreadPool.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace velocitas {
+
+PublishWindow::PublishWindow(size_t maxInFlight)
+    : m_maxInFlight(std::max<size_t>(maxInFlight, 1))
+    , m_timeoutPool(ThreadPool::getInstance(ThreadPool::PUBSUB_POOL)) {}
+
+size_t PublishWindow::getNumInFlight() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_numInFlight;
+}
+
+size_t PublishWindow::getNumQueued() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_queued.size();
+}
+
+AsyncResultPtr_t<PublishStatus> PublishWindow::submit(Sender_t                  sender,
+                                                      std::chrono::milliseconds timeout) {
+    auto publish      = std::make_shared<Publish>();
+    publish->m_sender = std::move(sender);
+    publish->m_result = std::make_shared<AsyncResult<PublishStatus>>();
+    auto result       = publish->m_result;
+
+    bool isSendable = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (timeout.count() > 0) {
+            publish->m_timeoutJob = Job::create(
+                [weakThis = weak_from_this(), weakPublish = std::weak_ptr(publish)]() {
+                    auto thisPtr = weakThis.lock();
+                    auto publish = weakPublish.lock();
+                    if (thisPtr && publish) {
+                        thisPtr->onTimeout(publish);
+                    }
+                },
+                timeout);
+            m_timeoutPool->enqueue(publish->m_timeoutJob);
+        }
+        isSendable = m_numInFlight < m_maxInFlight;
+        if (isSendable) {
+            ++m_numInFlight;
+        } else {
+            m_queued.push_back(publish);
+        }
+    }
+    if (isSendable) {
+        send(publish);
+    }
+    return result;
+}
+
+void PublishWindow::send(const PublishPtr_t& publish) {
+    auto sender = std::exchange(publish->m_sender, {});
+    try {
+        sender([weakThis = weak_from_this(), publish](PublishStatus status) {
+            if (auto thisPtr = weakThis.lock()) {
+                thisPtr->onSent(publish, status);
+            } else {
+                publish->m_result->insertResult(PublishStatus(status));
+            }
+        });
+    } catch (const std::exception&) {
+        onSent(publish, PublishStatus::Failure);
+    }
+}
+
+void PublishWindow::onSent(const PublishPtr_t& publish, PublishStatus status) {
+    if (publish->m_timeoutJob) {
+        m_timeoutPool->cancel(publish->m_timeoutJob);
+    }
+    // a timed out publish already has its result, which is kept then
+    publish->m_result->insertResult(PublishStatus(status));
+
+    PublishPtr_t next;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_queued.empty()) {
+            --m_numInFlight;
+            return;
+        }
+        // the slot is handed over to the next publish
+        next = std::move(m_queued.front());
+        m_queued.pop_front();
+    }
+    send(next);
+}
+
+void PublishWindow::onTimeout(const PublishPtr_t& publish) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto iter = std::find(m_queued.begin(), m_queued.end(), publish);
+        if (iter != m_queued.end()) {
+            m_queued.erase(iter);
+        }
+    }
+    publish->m_result->insertResult(PublishStatus::Timeout);
+}
+
+} // namespace velocitas
@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef VEHICLE_APP_SDK_PUBSUB_PUBLISHWINDOW_H
+#define VEHICLE_APP_SDK_PUBSUB_PUBLISHWINDOW_H
+
+#include "sdk/AsyncResult.h"
+#include "sdk/Job.h"
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace velocitas {
+
+/**
+ * @brief Pipelines asynchronous publishes, limiting the number of publishes in flight. Publishes
+ * exceeding the window are queued and sent as soon as earlier ones complete.
+ *
+ * Timeouts are enforced by delayed jobs of the pub/sub thread pool, i.e. by its timer wheel. A
+ * publish timing out while being queued is not sent at all; one timing out while in flight keeps
+ * its slot of the window until the transport reports its completion.
+ */
+class PublishWindow : public std::enable_shared_from_this<PublishWindow> {
+public:
+    using DoneHandler_t = std::function<void(PublishStatus)>;
+    /** Starts a publish; the handler needs to be called exactly once when it completed. */
+    using Sender_t = std::function<void(DoneHandler_t)>;
+
+    /**
+     * @brief Construct a window; needs to be owned by a shared_ptr.
+     *
+     * @param maxInFlight  Maximum number of publishes in flight, at least 1.
+     */
+    explicit PublishWindow(size_t maxInFlight);
+
+    /**
+     * @brief Submit a publish, which is sent right away if the window is not full.
+     *
+     * @param sender   Starts the publish.
+     * @param timeout  Time the publish needs to complete in (including the time queued), zero
+     *                 for not timing out.
+     * @return AsyncResultPtr_t<PublishStatus>  The result of the publish.
+     */
+    AsyncResultPtr_t<PublishStatus> submit(Sender_t sender, std::chrono::milliseconds timeout);
+
+    [[nodiscard]] size_t getMaxInFlight() const { return m_maxInFlight; }
+    [[nodiscard]] size_t getNumInFlight() const;
+    [[nodiscard]] size_t getNumQueued() const;
+
+private:
+    struct Publish {
+        Sender_t                        m_sender;
+        AsyncResultPtr_t<PublishStatus> m_result;
+        JobPtr_t                        m_timeoutJob;
+    };
+    using PublishPtr_t = std::shared_ptr<Publish>;
+
+    void send(const PublishPtr_t& publish);
+    void onSent(const PublishPtr_t& publish, PublishStatus status);
+    void onTimeout(const PublishPtr_t& publish);
+
+    const size_t                      m_maxInFlight;
+    // enforces the timeouts; resolved once, as every publish arms and cancels a job on it
+    const std::shared_ptr<ThreadPool> m_timeoutPool;
+    mutable std::mutex                m_mutex;
+    size_t                            m_numInFlight{0};
+    std::deque<PublishPtr_t>          m_queued;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_PUBSUB_PUBLISHWINDOW_H
@@ -0,0 +1,273 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef VEHICLE_APP_SDK_PUBSUB_TOPICTRIE_H
+#define VEHICLE_APP_SDK_PUBSUB_TOPICTRIE_H
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief Trie of MQTT topic filters, matching topics according to the MQTT wildcard rules:
+ * "+" matches a single level, a trailing "#" the parent level and any number of child levels;
+ * wildcards at the first level do not match topics starting with "$".
+ *
+ * Filters of shared subscriptions ("$share/<group>/<filter>") match like <filter>, but each
+ * message is passed to one subscriber of the group only, round robin.
+ *
+ * The trie is immutable once published: modifications copy the nodes along the path of the
+ * filter and publish a new root, so matching reads a snapshot without taking a lock, e.g. from
+ * the callback thread of the MQTT client. Modifications are serialized by a mutex.
+ *
+ * @tparam T  Type of the subscribers.
+ */
+template <typename T> class TopicTrie {
+public:
+    /**
+     * @brief Add a subscriber of the filter.
+     */
+    void insert(std::string_view filter, T subscriber) {
+        auto [group, levels] = parseFilter(filter);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto root = std::atomic_load(&m_root);
+        std::atomic_store(&m_root, std::shared_ptr<const Node>(
+                                       insertAt(root.get(), levels, 0, group, subscriber)));
+    }
+
+    /**
+     * @brief Remove all subscribers of the filter.
+     *
+     * @return true if there was at least one subscriber of the filter, false otherwise.
+     */
+    bool remove(std::string_view filter) {
+        return removeIf(filter, [](const T& /*subscriber*/) { return true; });
+    }
+
+    /**
+     * @brief Remove the subscribers of the filter the predicate returns true for.
+     *
+     * @param filter     The filter to remove subscribers of.
+     * @param predicate  Callable taking a const T&.
+     * @return true if at least one subscriber was removed, false otherwise.
+     */
+    template <typename TPredicate> bool removeIf(std::string_view filter, TPredicate&& predicate) {
+        auto [group, levels] = parseFilter(filter);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto root = std::atomic_load(&m_root);
+        bool isRemoved{false};
+        auto newRoot = removeAt(root.get(), levels, 0, group, predicate, isRemoved);
+        if (isRemoved) {
+            std::atomic_store(&m_root, std::shared_ptr<const Node>(std::move(newRoot)));
+        }
+        return isRemoved;
+    }
+
+    /**
+     * @brief Call the visitor with each subscriber the topic is to be passed to.
+     *
+     * @param topic    The topic of a received message; must not contain wildcards.
+     * @param visitor  Callable taking a const T&.
+     */
+    template <typename TVisitor>
+    void forEachMatch(std::string_view topic, TVisitor&& visitor) const {
+        auto root = std::atomic_load(&m_root);
+        if (!root) {
+            return;
+        }
+        std::vector<std::string_view> levels = splitLevels(topic);
+        const bool isSystemTopic             = !topic.empty() && topic.front() == '$';
+        matchAt(*root, levels, 0, isSystemTopic, visitor);
+    }
+
+    /**
+     * @brief Get the subscribers the topic is to be passed to.
+     */
+    [[nodiscard]] std::vector<T> match(std::string_view topic) const {
+        std::vector<T> subscribers;
+        forEachMatch(topic,
+                     [&subscribers](const T& subscriber) { subscribers.push_back(subscriber); });
+        return subscribers;
+    }
+
+    [[nodiscard]] bool empty() const { return std::atomic_load(&m_root) == nullptr; }
+
+private:
+    struct SharedGroup {
+        std::vector<T>                      m_subscribers;
+        // shared by all copies of the node, so the rotation survives modifications of the trie
+        std::shared_ptr<std::atomic_size_t> m_next{std::make_shared<std::atomic_size_t>(0)};
+    };
+
+    struct Node {
+        std::map<std::string, std::shared_ptr<const Node>, std::less<>> m_children;
+        std::vector<T>                                                  m_subscribers;
+        std::map<std::string, SharedGroup, std::less<>>                 m_groups;
+
+        [[nodiscard]] bool empty() const {
+            return m_children.empty() && m_subscribers.empty() && m_groups.empty();
+        }
+    };
+    using NodePtr_t = std::unique_ptr<Node>;
+
+    static constexpr std::string_view SHARE_PREFIX = "$share/";
+
+    static std::vector<std::string_view> splitLevels(std::string_view topic) {
+        std::vector<std::string_view> levels;
+        size_t                        begin = 0;
+        while (true) {
+            const auto end = topic.find('/', begin);
+            if (end == std::string_view::npos) {
+                levels.push_back(topic.substr(begin));
+                return levels;
+            }
+            levels.push_back(topic.substr(begin, end - begin));
+            begin = end + 1;
+        }
+    }
+
+    // the levels refer to the passed filter
+    static std::pair<std::string, std::vector<std::string_view>>
+    parseFilter(std::string_view filter) {
+        std::string group;
+        if (filter.substr(0, SHARE_PREFIX.size()) == SHARE_PREFIX) {
+            filter.remove_prefix(SHARE_PREFIX.size());
+            const auto end = filter.find('/');
+            group          = std::string(filter.substr(0, end));
+            filter.remove_prefix(end == std::string_view::npos ? filter.size() : end + 1);
+        }
+        return {std::move(group), splitLevels(filter)};
+    }
+
+    static NodePtr_t copyOf(const Node* node) {
+        return node != nullptr ? std::make_unique<Node>(*node) : std::make_unique<Node>();
+    }
+
+    static NodePtr_t insertAt(const Node* node, const std::vector<std::string_view>& levels,
+                              size_t depth, const std::string& group, const T& subscriber) {
+        auto copy = copyOf(node);
+        if (depth == levels.size()) {
+            if (group.empty()) {
+                copy->m_subscribers.push_back(subscriber);
+            } else {
+                copy->m_groups[group].m_subscribers.push_back(subscriber);
+            }
+            return copy;
+        }
+        auto&       child    = copy->m_children[std::string(levels[depth])];
+        const Node* oldChild = child.get();
+        child                = insertAt(oldChild, levels, depth + 1, group, subscriber);
+        return copy;
+    }
+
+    template <typename TPredicate>
+    static bool eraseIf(std::vector<T>& subscribers, TPredicate& predicate) {
+        const auto size = subscribers.size();
+        subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(),
+                                         [&predicate](const T& item) { return predicate(item); }),
+                          subscribers.end());
+        return subscribers.size() != size;
+    }
+
+    // returns nullptr if the node became empty
+    template <typename TPredicate>
+    static NodePtr_t removeAt(const Node* node, const std::vector<std::string_view>& levels,
+                              size_t depth, const std::string& group, TPredicate& predicate,
+                              bool& isRemoved) {
+        if (node == nullptr) {
+            return nullptr;
+        }
+        auto copy = copyOf(node);
+        if (depth == levels.size()) {
+            if (group.empty()) {
+                isRemoved = eraseIf(copy->m_subscribers, predicate);
+            } else {
+                const auto iter = copy->m_groups.find(group);
+                if (iter != copy->m_groups.end()) {
+                    isRemoved = eraseIf(iter->second.m_subscribers, predicate);
+                    if (iter->second.m_subscribers.empty()) {
+                        copy->m_groups.erase(iter);
+                    }
+                }
+            }
+        } else {
+            const auto iter = copy->m_children.find(levels[depth]);
+            if (iter == copy->m_children.end()) {
+                return copy;
+            }
+            auto child =
+                removeAt(iter->second.get(), levels, depth + 1, group, predicate, isRemoved);
+            if (child) {
+                iter->second = std::move(child);
+            } else {
+                copy->m_children.erase(iter);
+            }
+        }
+        return copy->empty() ? nullptr : std::move(copy);
+    }
+
+    template <typename TVisitor>
+    static void visitSubscribers(const Node& node, TVisitor& visitor) {
+        for (const auto& subscriber : node.m_subscribers) {
+            visitor(subscriber);
+        }
+        for (const auto& [name, group] : node.m_groups) {
+            const auto index = group.m_next->fetch_add(1, std::memory_order_relaxed);
+            visitor(group.m_subscribers[index % group.m_subscribers.size()]);
+        }
+    }
+
+    template <typename TVisitor>
+    static void matchAt(const Node& node, const std::vector<std::string_view>& levels,
+                        size_t depth, bool isSystemTopic, TVisitor& visitor) {
+        // wildcards of the first level must not match topics starting with "$"
+        const bool isWildcardAllowed = depth > 0 || !isSystemTopic;
+        if (isWildcardAllowed) {
+            const auto multiLevel = node.m_children.find("#");
+            if (multiLevel != node.m_children.end()) {
+                visitSubscribers(*multiLevel->second, visitor);
+            }
+        }
+        if (depth == levels.size()) {
+            visitSubscribers(node, visitor);
+            return;
+        }
+        const auto exact = node.m_children.find(levels[depth]);
+        if (exact != node.m_children.end()) {
+            matchAt(*exact->second, levels, depth + 1, isSystemTopic, visitor);
+        }
+        if (isWildcardAllowed) {
+            const auto singleLevel = node.m_children.find("+");
+            if (singleLevel != node.m_children.end()) {
+                matchAt(*singleLevel->second, levels, depth + 1, isSystemTopic, visitor);
+            }
+        }
+    }
+
+    std::mutex                  m_mutex;
+    std::shared_ptr<const Node> m_root;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_PUBSUB_TOPICTRIE_H
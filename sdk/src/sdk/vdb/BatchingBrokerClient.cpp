@@ -0,0 +1,263 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/BatchingBrokerClient.h"
+
+#include "sdk/DataPointReply.h"
+#include "sdk/DataPointValue.h"
+#include "sdk/Job.h"
+#include "sdk/ThreadPool.h"
+
+#include <utility>
+
+namespace velocitas {
+
+BatchingBrokerClient::BatchingBrokerClient(std::shared_ptr<IVehicleDataBrokerClient> client,
+                                           std::chrono::milliseconds batchingWindow)
+    : BatchingBrokerClient(std::move(client), BatchingConfig{batchingWindow}) {}
+
+BatchingBrokerClient::BatchingBrokerClient(std::shared_ptr<IVehicleDataBrokerClient> client,
+                                           BatchingConfig                            config)
+    : m_client(std::move(client))
+    , m_config(config) {}
+
+BatchingBrokerClient::~BatchingBrokerClient() { flush(); }
+
+AsyncResultPtr_t<DataPointReply>
+BatchingBrokerClient::getDatapoints(const std::vector<std::string>& datapoints) {
+    auto       result = withCallbackExecutor(std::make_shared<AsyncResult<DataPointReply>>());
+    GetRequest request{{}, result};
+    request.m_signals.reserve(datapoints.size());
+    auto& registry = SignalPathRegistry::getInstance();
+
+    GetBatch fullBatch;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& path : datapoints) {
+            const auto signal = registry.intern(path);
+            request.m_signals.push_back(signal);
+            if (m_getBatch.m_signals.insert(signal).second) {
+                m_getBatch.m_paths.push_back(path);
+            }
+        }
+        m_getBatch.m_requests.push_back(std::move(request));
+        if (isFull(m_getBatch.m_paths.size())) {
+            fullBatch = std::exchange(m_getBatch, {});
+        } else {
+            scheduleFlush();
+        }
+    }
+    if (!fullBatch.m_requests.empty()) {
+        issueGetBatch(std::move(fullBatch));
+    }
+    return result;
+}
+
+AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t> BatchingBrokerClient::setDatapoints(
+    const std::vector<std::unique_ptr<DataPointValue>>& datapoints) {
+    auto       result = withCallbackExecutor(std::make_shared<AsyncResult<SetErrorMap_t>>());
+    SetRequest request{{}, result};
+    request.m_paths.reserve(datapoints.size());
+    auto& registry = SignalPathRegistry::getInstance();
+
+    SetBatch previousBatch;
+    SetBatch fullBatch;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto&                       indices = m_setBatch.m_dataPointIndices;
+        if (!m_config.m_isCoalescingWrites) {
+            // writing a signal twice within one batch would lose the first write
+            for (const auto& dataPoint : datapoints) {
+                if (indices.count(registry.intern(dataPoint->getPath())) > 0) {
+                    previousBatch = std::exchange(m_setBatch, {});
+                    break;
+                }
+            }
+        }
+        for (const auto& dataPoint : datapoints) {
+            const auto signal = registry.intern(dataPoint->getPath());
+            if (auto iter = indices.find(signal); iter != indices.end()) {
+                // superseded: the earlier callers get the outcome of this write
+                m_setBatch.m_dataPoints[iter->second] = dataPoint->clone();
+            } else {
+                indices.emplace(signal, m_setBatch.m_dataPoints.size());
+                m_setBatch.m_dataPoints.push_back(dataPoint->clone());
+            }
+            request.m_paths.push_back(dataPoint->getPath());
+        }
+        m_setBatch.m_requests.push_back(std::move(request));
+        if (isFull(m_setBatch.m_dataPoints.size())) {
+            fullBatch = std::exchange(m_setBatch, {});
+        } else {
+            scheduleFlush();
+        }
+    }
+    if (!previousBatch.m_requests.empty()) {
+        issueSetBatch(std::move(previousBatch));
+    }
+    if (!fullBatch.m_requests.empty()) {
+        issueSetBatch(std::move(fullBatch));
+    }
+    return result;
+}
+
+AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t> BatchingBrokerClient::setDatapoints(
+    const std::vector<std::unique_ptr<DataPointValue>>& datapoints, SetMode mode) {
+    if (mode == SetMode::PUBLISH) {
+        return withCallbackExecutor(m_client->setDatapoints(datapoints, mode));
+    }
+    return setDatapoints(datapoints);
+}
+
+// with an executor of its own, the options are needed to hand it to the wrapped client
+AsyncSubscriptionPtr_t<DataPointReply> BatchingBrokerClient::subscribe(const std::string& query) {
+    if (getCallbackExecutor()) {
+        return subscribe(query, SubscriptionOptions{});
+    }
+    return m_client->subscribe(query);
+}
+
+AsyncSubscriptionPtr_t<DataPointReply> BatchingBrokerClient::subscribe(const std::string& query,
+                                                                       SubscriptionMode   mode) {
+    if (getCallbackExecutor()) {
+        return subscribe(query, SubscriptionOptions{mode});
+    }
+    return m_client->subscribe(query, mode);
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+BatchingBrokerClient::subscribe(const std::string& query, const SubscriptionOptions& options) {
+    auto effectiveOptions               = options;
+    effectiveOptions.m_callbackExecutor = resolveCallbackExecutor(options);
+    return m_client->subscribe(query, effectiveOptions);
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+BatchingBrokerClient::subscribe(const Query& query, const SubscriptionOptions& options) {
+    auto effectiveOptions               = options;
+    effectiveOptions.m_callbackExecutor = resolveCallbackExecutor(options);
+    return m_client->subscribe(query, effectiveOptions);
+}
+
+bool BatchingBrokerClient::updateSubscription(
+    const AsyncSubscriptionPtr_t<DataPointReply>& subscription,
+    const std::vector<std::string>& addedSignals, const std::vector<std::string>& removedSignals) {
+    return m_client->updateSubscription(subscription, addedSignals, removedSignals);
+}
+
+AsyncResultPtr_t<Status>
+BatchingBrokerClient::prepare(const std::vector<std::string>& signalPaths,
+                              std::chrono::milliseconds       timeout) {
+    return withCallbackExecutor(m_client->prepare(signalPaths, timeout));
+}
+
+AsyncResultPtr_t<Status> BatchingBrokerClient::whenReady() {
+    return withCallbackExecutor(m_client->whenReady());
+}
+
+size_t BatchingBrokerClient::cancelPendingRequests() {
+    flush();
+    return m_client->cancelPendingRequests();
+}
+
+void BatchingBrokerClient::setExecutor(ExecutorPtr_t executor) {
+    IVehicleDataBrokerClient::setExecutor(executor);
+    m_client->setExecutor(std::move(executor));
+}
+
+void BatchingBrokerClient::flush() {
+    GetBatch getBatch;
+    SetBatch setBatch;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isFlushScheduled = false;
+        getBatch           = std::exchange(m_getBatch, {});
+        setBatch           = std::exchange(m_setBatch, {});
+    }
+    if (!setBatch.m_requests.empty()) {
+        issueSetBatch(std::move(setBatch));
+    }
+    if (!getBatch.m_requests.empty()) {
+        issueGetBatch(std::move(getBatch));
+    }
+}
+
+void BatchingBrokerClient::scheduleFlush() {
+    if (m_isFlushScheduled) {
+        return;
+    }
+    m_isFlushScheduled = true;
+    auto flushBatches = [weakThis = weak_from_this()]() {
+        if (auto thisPtr = weakThis.lock()) {
+            thisPtr->flush();
+        }
+    };
+    if (auto executor = getExecutor()) {
+        executor->scheduleAfter(m_config.m_batchingWindow, std::move(flushBatches));
+    } else {
+        ThreadPool::getInstance(ThreadPool::VDB_POOL)
+            ->enqueue(Job::create(std::move(flushBatches), m_config.m_batchingWindow));
+    }
+}
+
+bool BatchingBrokerClient::isFull(size_t batchSize) const {
+    return m_config.m_maxBatchSize > 0 && batchSize >= m_config.m_maxBatchSize;
+}
+
+void BatchingBrokerClient::issueGetBatch(GetBatch batch) {
+    auto requests = std::make_shared<std::vector<GetRequest>>(std::move(batch.m_requests));
+    auto result   = m_client->getDatapoints(batch.m_paths);
+    result->onError([requests](const Status& status) {
+        for (const auto& request : *requests) {
+            request.m_result->insertError(Status(status));
+        }
+    });
+    result->onResult([requests](const DataPointReply& reply) {
+        for (const auto& request : *requests) {
+            DataPointReply requestReply;
+            requestReply.reserve(request.m_signals.size());
+            for (const auto signal : request.m_signals) {
+                if (const auto* entry = reply.find(signal)) {
+                    requestReply.set(signal, DataPointReply::getSample(*entry));
+                }
+            }
+            request.m_result->insertResult(std::move(requestReply));
+        }
+    });
+}
+
+void BatchingBrokerClient::issueSetBatch(SetBatch batch) {
+    auto requests = std::make_shared<std::vector<SetRequest>>(std::move(batch.m_requests));
+    auto result   = m_client->setDatapoints(batch.m_dataPoints);
+    result->onError([requests](const Status& status) {
+        for (const auto& request : *requests) {
+            request.m_result->insertError(Status(status));
+        }
+    });
+    result->onResult([requests](const SetErrorMap_t& errorMap) {
+        for (const auto& request : *requests) {
+            SetErrorMap_t requestErrors;
+            for (const auto& path : request.m_paths) {
+                if (auto iter = errorMap.find(path); iter != errorMap.end()) {
+                    requestErrors.emplace(*iter);
+                }
+            }
+            request.m_result->insertResult(std::move(requestErrors));
+        }
+    });
+}
+
+} // namespace velocitas
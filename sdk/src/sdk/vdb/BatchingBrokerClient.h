@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_BATCHINGBROKERCLIENT_H
+#define VEHICLE_APP_SDK_VDB_BATCHINGBROKERCLIENT_H
+
+#include "sdk/SignalPathRegistry.h"
+#include "sdk/vdb/IVehicleDataBrokerClient.h"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief Configuration of the BatchingBrokerClient.
+ */
+struct BatchingConfig {
+    /** Time to collect calls for before issuing them */
+    std::chrono::milliseconds m_batchingWindow{0};
+
+    /** Number of signals a batch is issued at before the window ends; zero means no limit */
+    size_t m_maxBatchSize{0};
+
+    /** Whether a set call of a signal pending in the set batch replaces its value */
+    bool m_isCoalescingWrites{false};
+};
+
+/**
+ * @brief Decorator of a VehicleDataBrokerClient merging the get and set calls issued within a
+ * batching window into a single getDatapoints and setDatapoints call of the decorated client.
+ *
+ * The replies of the merged calls are split up again, so each caller gets the data points it
+ * requested (respectively the errors of the data points it set) only. A set call of a signal
+ * already contained in the pending set batch flushes that batch first, so no write is lost.
+ * With write coalescing, it replaces the pending value instead, so only the latest value of a
+ * signal is written per batch; the superseded calls get the outcome of that final write.
+ * Subscriptions are forwarded unchanged.
+ */
+class BatchingBrokerClient : public IVehicleDataBrokerClient,
+                             public std::enable_shared_from_this<BatchingBrokerClient> {
+public:
+    BatchingBrokerClient(std::shared_ptr<IVehicleDataBrokerClient> client,
+                         std::chrono::milliseconds                 batchingWindow);
+    BatchingBrokerClient(std::shared_ptr<IVehicleDataBrokerClient> client, BatchingConfig config);
+
+    ~BatchingBrokerClient() override;
+
+    BatchingBrokerClient(const BatchingBrokerClient&)            = delete;
+    BatchingBrokerClient(BatchingBrokerClient&&)                 = delete;
+    BatchingBrokerClient& operator=(const BatchingBrokerClient&) = delete;
+    BatchingBrokerClient& operator=(BatchingBrokerClient&&)      = delete;
+
+    AsyncResultPtr_t<DataPointReply>
+    getDatapoints(const std::vector<std::string>& datapoints) override;
+
+    AsyncResultPtr_t<SetErrorMap_t>
+    setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints) override;
+
+    /**
+     * @brief Values to be published are not batched but forwarded to the decorated client.
+     */
+    AsyncResultPtr_t<SetErrorMap_t>
+    setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints,
+                  SetMode                                             mode) override;
+
+    using IVehicleDataBrokerClient::subscribe;
+
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string& query) override;
+
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string& query,
+                                                     SubscriptionMode   mode) override;
+
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string&         query,
+                                                     const SubscriptionOptions& options) override;
+
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const Query&               query,
+                                                     const SubscriptionOptions& options) override;
+
+    bool updateSubscription(const AsyncSubscriptionPtr_t<DataPointReply>& subscription,
+                            const std::vector<std::string>&               addedSignals,
+                            const std::vector<std::string>&               removedSignals) override;
+
+    AsyncResultPtr_t<Status> prepare(const std::vector<std::string>& signalPaths,
+                                     std::chrono::milliseconds       timeout) override;
+
+    AsyncResultPtr_t<Status> whenReady() override;
+
+    /**
+     * @brief Cancel the pending requests of the decorated client; requests still being batched
+     * are issued and cancelled as well.
+     */
+    size_t cancelPendingRequests() override;
+
+    void setExecutor(ExecutorPtr_t executor) override;
+
+    [[nodiscard]] ClockOffsetEstimatorPtr_t getClockOffsetEstimator() const override {
+        return m_client->getClockOffsetEstimator();
+    }
+
+    /**
+     * @brief Issue the pending batches right away instead of at the end of the batching window.
+     */
+    void flush();
+
+    /**
+     * @brief Get the decorated client.
+     */
+    [[nodiscard]] const std::shared_ptr<IVehicleDataBrokerClient>& getClient() const {
+        return m_client;
+    }
+
+private:
+    struct GetRequest {
+        std::vector<SignalHandle_t>      m_signals;
+        AsyncResultPtr_t<DataPointReply> m_result;
+    };
+
+    struct GetBatch {
+        std::vector<std::string> m_paths;
+        std::set<SignalHandle_t> m_signals;
+        std::vector<GetRequest>  m_requests;
+    };
+
+    struct SetRequest {
+        std::vector<std::string>        m_paths;
+        AsyncResultPtr_t<SetErrorMap_t> m_result;
+    };
+
+    struct SetBatch {
+        std::vector<std::unique_ptr<DataPointValue>> m_dataPoints;
+        // index of each signal's data point within m_dataPoints
+        std::map<SignalHandle_t, size_t> m_dataPointIndices;
+        std::vector<SetRequest>          m_requests;
+    };
+
+    // need to be called with m_mutex being locked
+    void scheduleFlush();
+
+    [[nodiscard]] bool isFull(size_t batchSize) const;
+
+    void issueGetBatch(GetBatch batch);
+    void issueSetBatch(SetBatch batch);
+
+    std::shared_ptr<IVehicleDataBrokerClient> m_client;
+    const BatchingConfig                      m_config;
+
+    std::mutex m_mutex;
+    GetBatch   m_getBatch;
+    SetBatch   m_setBatch;
+    bool       m_isFlushScheduled{false};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_BATCHINGBROKERCLIENT_H
@@ -20,14 +20,63 @@
 
 #include "sdk/Exceptions.h"
 
+#include <fmt/core.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace velocitas {
 
-AsyncResultPtr_t<DataPointBatch::SetErrorMap_t> DataPointBatch::apply() {
+AsyncResultPtr_t<DataPointBatch::SetErrorMap_t> DataPointBatch::apply(SetMode mode) {
     if (m_dataPoints.empty()) {
         throw InvalidValueException("Called DataPointBatch::apply() without any data points!");
     }
 
-    return VehicleModelContext::getInstance().getVdbc()->setDatapoints(std::move(m_dataPoints));
+    return VehicleModelContext::getInstance().getVdbc()->setDatapoints(std::move(m_dataPoints),
+                                                                       mode);
+}
+
+PreparedDataPointBatch DataPointBatch::prepare() {
+    if (m_dataPoints.empty()) {
+        throw InvalidValueException("Called DataPointBatch::prepare() without any data points!");
+    }
+
+    return PreparedDataPointBatch(std::move(m_dataPoints),
+                                  VehicleModelContext::getInstance().getVdbc());
+}
+
+PreparedDataPointBatch::PreparedDataPointBatch(
+    std::vector<std::unique_ptr<DataPointValue>> dataPoints,
+    std::shared_ptr<IVehicleDataBrokerClient>    client)
+    : m_dataPoints(std::move(dataPoints))
+    , m_client(std::move(client)) {
+    auto&                    registry = SignalPathRegistry::getInstance();
+    std::vector<std::string> paths;
+    paths.reserve(m_dataPoints.size());
+    m_signals.reserve(m_dataPoints.size());
+    for (const auto& dataPoint : m_dataPoints) {
+        paths.push_back(dataPoint->getPath());
+        m_signals.push_back(registry.intern(dataPoint->getPath()));
+    }
+    m_preparedSet = m_client->prepareSet(paths);
+}
+
+AsyncResultPtr_t<PreparedDataPointBatch::SetErrorMap_t>
+PreparedDataPointBatch::apply(SetMode mode) {
+    return m_preparedSet->apply(m_dataPoints, mode);
+}
+
+DataPointValue& PreparedDataPointBatch::getEntry(SignalHandle_t signal, DataPointValue::Type type) {
+    // batches are small, so a linear search beats any index structure
+    for (size_t i = 0; i < m_signals.size(); ++i) {
+        if (m_signals[i] == signal && m_dataPoints[i]->getType() == type) {
+            return *m_dataPoints[i];
+        }
+    }
+    throw InvalidValueException(
+        fmt::format("Data point {} is not part of the prepared batch",
+                    SignalPathRegistry::getInstance().getPath(signal)));
 }
 
 } // namespace velocitas
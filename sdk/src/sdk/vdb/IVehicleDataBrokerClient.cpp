@@ -21,19 +21,46 @@
 #include "sdk/vdb/grpc/kuksa_val_v2/BrokerClient.h"
 #include "sdk/vdb/grpc/sdv_databroker_v1/BrokerClient.h"
 
+#include <fmt/core.h>
+
+#include <atomic>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace velocitas {
 
 static const std::string API_DEFINING_ENV_VAR = "KUKSA_DATABROKER_API"; // NOLINT(runtime/string)
 static const std::string SDV_V1_API           = "sdv.databroker.v1";    // NOLINT(runtime/string)
 static const std::string KUKSA_V2_API         = "kuksa.val.v2";         // NOLINT(runtime/string)
+static const std::string REPLAY_API           = "replay";               // NOLINT(runtime/string)
 static const auto&       DEFAULT_API          = SDV_V1_API;
 
-std::shared_ptr<IVehicleDataBrokerClient>
-IVehicleDataBrokerClient::createInstance(const std::string& vdbServiceName) {
+// name of the shared state table to read the signals from, if any
+static const std::string SHARED_STATE_ENV_VAR = "SDV_SHARED_STATE_TABLE"; // NOLINT(runtime/string)
+// VSS subtrees routed to other databrokers than the default one, as <subtree>=<service name>,...
+static const std::string SHARDS_ENV_VAR = "SDV_VDB_SHARDS"; // NOLINT(runtime/string)
+
+namespace {
+
+class ForwardingPreparedSet : public IPreparedSet {
+public:
+    explicit ForwardingPreparedSet(IVehicleDataBrokerClient& client)
+        : m_client(client) {}
+
+    AsyncResultPtr_t<SetErrorMap_t>
+    apply(const std::vector<std::unique_ptr<DataPointValue>>& values, SetMode mode) override {
+        return m_client.setDatapoints(values, mode);
+    }
+
+private:
+    IVehicleDataBrokerClient& m_client;
+};
+
+std::shared_ptr<IVehicleDataBrokerClient> createApiClient(const std::string& vdbServiceName) {
     const auto apiVariant = getEnvVar(API_DEFINING_ENV_VAR, DEFAULT_API);
 
     if (apiVariant == SDV_V1_API) {
@@ -46,8 +73,85 @@ IVehicleDataBrokerClient::createInstance(const std::string& vdbServiceName) {
         return std::make_shared<kuksa_val_v2::BrokerClient>(vdbServiceName);
     }
 
+    if (apiVariant == REPLAY_API) {
+        ReplayConfig config;
+        config.m_speed     = std::stod(getEnvVar("SDV_REPLAY_SPEED", "1"));
+        config.m_isLooping = getEnvVar("SDV_REPLAY_LOOP", "false") == "true";
+        return IVehicleDataBrokerClient::createReplay(getEnvVar("SDV_REPLAY_FILE"), config);
+    }
+
     logger().error("Unsupported Kuksa Databroker {} API", apiVariant);
     throw std::runtime_error("Unsupported API specified");
 }
 
+std::shared_ptr<IVehicleDataBrokerClient> createShardedClient(const std::string& vdbServiceName,
+                                                              const std::string& shards) {
+    std::vector<ShardRoute> routes;
+    for (const auto& shard : StringUtils::split(shards, ',')) {
+        const auto separator = shard.find('=');
+        if (separator == std::string::npos || separator == 0 || separator + 1 == shard.size()) {
+            throw std::runtime_error(
+                fmt::format("Malformed shard '{}' in env var {}", shard, SHARDS_ENV_VAR));
+        }
+        const auto serviceName = shard.substr(separator + 1);
+        logger().info("Routing signals of {} to databroker '{}'", shard.substr(0, separator),
+                      serviceName);
+        routes.push_back({shard.substr(0, separator), createApiClient(serviceName)});
+    }
+    routes.push_back({"", createApiClient(vdbServiceName)});
+    return IVehicleDataBrokerClient::createSharded(std::move(routes));
+}
+
+} // namespace
+
+std::shared_ptr<IVehicleDataBrokerClient>
+IVehicleDataBrokerClient::createInstance(const std::string& vdbServiceName) {
+    const auto shards    = getEnvVar(SHARDS_ENV_VAR);
+    auto       client    = shards.empty() ? createApiClient(vdbServiceName)
+                                          : createShardedClient(vdbServiceName, shards);
+    const auto tableName = getEnvVar(SHARED_STATE_ENV_VAR);
+    if (tableName.empty()) {
+        return client;
+    }
+    return createSharedState(tableName, std::move(client));
+}
+
+AsyncResultPtr_t<Status>
+IVehicleDataBrokerClient::prepare(const std::vector<std::string>& signalPaths,
+                                  std::chrono::milliseconds       timeout) {
+    std::ignore = signalPaths;
+    std::ignore = timeout;
+    auto result = withCallbackExecutor(std::make_shared<AsyncResult<Status>>());
+    result->insertResult(Status());
+    return result;
+}
+
+AsyncResultPtr_t<Status> IVehicleDataBrokerClient::whenReady() {
+    auto result = withCallbackExecutor(std::make_shared<AsyncResult<Status>>());
+    result->insertResult(Status());
+    return result;
+}
+
+std::shared_ptr<IPreparedSet>
+IVehicleDataBrokerClient::prepareSet(const std::vector<std::string>& signalPaths) {
+    std::ignore = signalPaths;
+    return std::make_shared<ForwardingPreparedSet>(*this);
+}
+
+void IVehicleDataBrokerClient::setCallbackExecutor(CallbackExecutorPtr_t executor) {
+    std::atomic_store(&m_callbackExecutor, std::move(executor));
+}
+
+CallbackExecutorPtr_t IVehicleDataBrokerClient::getCallbackExecutor() const {
+    return std::atomic_load(&m_callbackExecutor);
+}
+
+void IVehicleDataBrokerClient::setExecutor(ExecutorPtr_t executor) {
+    std::atomic_store(&m_executor, std::move(executor));
+}
+
+ExecutorPtr_t IVehicleDataBrokerClient::getExecutor() const {
+    return std::atomic_load(&m_executor);
+}
+
 } // namespace velocitas
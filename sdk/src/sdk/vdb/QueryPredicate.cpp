@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "QueryPredicate.h"
+
+#include "sdk/Exceptions.h"
+
+#include <algorithm>
+#include <type_traits>
+
+namespace velocitas {
+
+namespace {
+
+enum class Ordering { LESS, EQUAL, GREATER, UNORDERED };
+
+template <typename T> Ordering compareSame(T lhs, T rhs) {
+    if (lhs < rhs) {
+        return Ordering::LESS;
+    }
+    if (rhs < lhs) {
+        return Ordering::GREATER;
+    }
+    // NaN is neither less, nor greater, nor equal
+    return lhs == rhs ? Ordering::EQUAL : Ordering::UNORDERED;
+}
+
+Ordering compare(int64_t lhs, uint64_t rhs) {
+    return lhs < 0 ? Ordering::LESS : compareSame(static_cast<uint64_t>(lhs), rhs);
+}
+
+Ordering compare(uint64_t lhs, int64_t rhs) {
+    return rhs < 0 ? Ordering::GREATER : compareSame(lhs, static_cast<uint64_t>(rhs));
+}
+
+template <typename TLhs, typename TRhs> Ordering compareNumbers(TLhs lhs, TRhs rhs) {
+    if constexpr (std::is_same_v<TLhs, TRhs>) {
+        return compareSame(lhs, rhs);
+    } else if constexpr (std::is_floating_point_v<TLhs> || std::is_floating_point_v<TRhs>) {
+        return compareSame(static_cast<double>(lhs), static_cast<double>(rhs));
+    } else {
+        return compare(lhs, rhs);
+    }
+}
+
+} // namespace
+
+QueryPredicate::QueryPredicate(const std::vector<QueryCondition>& conditions) {
+    m_terms.reserve(conditions.size());
+    for (const auto& condition : conditions) {
+        auto operand = toNumber(condition.m_operand);
+        if (!operand) {
+            throw InvalidTypeException("WHERE conditions need a numeric or boolean operand");
+        }
+        auto iter = std::find(m_signals.cbegin(), m_signals.cend(), condition.m_signal);
+        if (iter == m_signals.cend()) {
+            iter = m_signals.insert(m_signals.cend(), condition.m_signal);
+        }
+        m_terms.push_back(Term{static_cast<size_t>(iter - m_signals.cbegin()),
+                               condition.m_operator, *operand});
+    }
+    m_values.resize(m_signals.size());
+}
+
+bool QueryPredicate::refersTo(SignalHandle_t signal) const {
+    return std::find(m_signals.cbegin(), m_signals.cend(), signal) != m_signals.cend();
+}
+
+void QueryPredicate::update(SignalHandle_t signal, const DataPointSample& sample) {
+    const auto iter = std::find(m_signals.cbegin(), m_signals.cend(), signal);
+    if (iter != m_signals.cend()) {
+        m_values[iter - m_signals.cbegin()] = toNumber(sample);
+    }
+}
+
+bool QueryPredicate::isMet() const {
+    return std::all_of(m_terms.cbegin(), m_terms.cend(), [this](const Term& term) {
+        const auto& value = m_values[term.m_slot];
+        return value && isMet(term, *value);
+    });
+}
+
+std::optional<QueryPredicate::Number_t> QueryPredicate::toNumber(const DataPointSample& sample) {
+    if (!sample.isValid()) {
+        return std::nullopt;
+    }
+    return std::visit(
+        [](const auto& value) -> std::optional<Number_t> {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (std::is_floating_point_v<T>) {
+                return Number_t{static_cast<double>(value)};
+            } else if constexpr (std::is_same_v<T, bool> || std::is_unsigned_v<T>) {
+                return Number_t{static_cast<uint64_t>(value)};
+            } else if constexpr (std::is_integral_v<T>) {
+                return Number_t{static_cast<int64_t>(value)};
+            } else {
+                return std::nullopt;
+            }
+        },
+        sample.getVariant());
+}
+
+bool QueryPredicate::isMet(const Term& term, const Number_t& value) {
+    const auto ordering = std::visit(
+        [](auto lhs, auto rhs) { return compareNumbers(lhs, rhs); }, value, term.m_operand);
+    switch (term.m_operator) {
+    case QueryCondition::Operator::GREATER:
+        return ordering == Ordering::GREATER;
+    case QueryCondition::Operator::LESS:
+        return ordering == Ordering::LESS;
+    case QueryCondition::Operator::EQUAL:
+        return ordering == Ordering::EQUAL;
+    }
+    return false;
+}
+
+} // namespace velocitas
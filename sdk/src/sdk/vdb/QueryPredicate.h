@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef VEHICLE_APP_SDK_VDB_QUERYPREDICATE_H
+#define VEHICLE_APP_SDK_VDB_QUERYPREDICATE_H
+
+#include "sdk/DataPointSample.h"
+#include "sdk/Query.h"
+
+#include <optional>
+#include <variant>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief The conditions of a query's WHERE clause, compiled for evaluating them on the client
+ * side, for databroker APIs not supporting them. Each condition refers to a slot holding the
+ * latest value of its signal, and to its operand converted to a number once.
+ *
+ * An empty predicate (without conditions) is always met.
+ */
+class QueryPredicate {
+public:
+    QueryPredicate() = default;
+
+    /**
+     * @brief Compile the conditions, which all need to be met.
+     *
+     * @throw InvalidTypeException if an operand is neither numeric nor boolean.
+     */
+    explicit QueryPredicate(const std::vector<QueryCondition>& conditions);
+
+    [[nodiscard]] bool empty() const { return m_terms.empty(); }
+
+    /**
+     * @brief Get the signals the conditions refer to, each contained once.
+     */
+    [[nodiscard]] const std::vector<SignalHandle_t>& getSignals() const { return m_signals; }
+
+    /**
+     * @brief Check whether any condition refers to the signal.
+     */
+    [[nodiscard]] bool refersTo(SignalHandle_t signal) const;
+
+    /**
+     * @brief Remember the latest sample of a signal for the evaluation; signals not referred to
+     * are ignored.
+     */
+    void update(SignalHandle_t signal, const DataPointSample& sample);
+
+    /**
+     * @brief Check whether all conditions are met by the latest samples. Conditions on signals
+     * without (valid numeric) sample are not met.
+     */
+    [[nodiscard]] bool isMet() const;
+
+private:
+    using Number_t = std::variant<int64_t, uint64_t, double>;
+
+    struct Term {
+        size_t                   m_slot;
+        QueryCondition::Operator m_operator;
+        Number_t                 m_operand;
+    };
+
+    [[nodiscard]] static std::optional<Number_t> toNumber(const DataPointSample& sample);
+    [[nodiscard]] static bool                    isMet(const Term& term, const Number_t& value);
+
+    std::vector<SignalHandle_t>          m_signals;
+    std::vector<Term>                    m_terms;
+    // latest value per signal, same order as m_signals
+    std::vector<std::optional<Number_t>> m_values;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_QUERYPREDICATE_H
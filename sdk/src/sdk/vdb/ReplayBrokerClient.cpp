@@ -0,0 +1,275 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ReplayBrokerClient.h"
+
+#include "sdk/Logger.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/TypeConversions.h"
+
+#include <algorithm>
+#include <chrono>
+#include <tuple>
+
+namespace velocitas {
+
+std::shared_ptr<IVehicleDataBrokerClient>
+IVehicleDataBrokerClient::createReplay(const std::string& recordingPath, ReplayConfig config) {
+    return std::make_shared<ReplayBrokerClient>(recordingPath, config);
+}
+
+ReplayBrokerClient::ReplayBrokerClient(const std::string& recordingPath, ReplayConfig config)
+    : m_config(config)
+    , m_reader(recordingPath) {
+    logger().info("Replaying signal recording '{}' ({} bytes) at speed {}", recordingPath,
+                  m_reader.getFileSize(), m_config.m_speed);
+}
+
+ReplayBrokerClient::~ReplayBrokerClient() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+    m_stopCondition.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+AsyncResultPtr_t<DataPointReply>
+ReplayBrokerClient::getDatapoints(const std::vector<std::string>& datapoints) {
+    DataPointReply reply;
+    reply.reserve(datapoints.size());
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& path : datapoints) {
+            const auto signal = SignalPathRegistry::getInstance().intern(path);
+            want(signal);
+            reply.set(signal, m_latestSamples[signal]);
+        }
+    }
+    auto result = withCallbackExecutor(std::make_shared<AsyncResult<DataPointReply>>());
+    result->insertResult(std::move(reply));
+    return result;
+}
+
+AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t>
+ReplayBrokerClient::setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints) {
+    std::ignore = datapoints;
+    auto result = withCallbackExecutor(std::make_shared<AsyncResult<SetErrorMap_t>>());
+    result->insertResult(SetErrorMap_t{});
+    return result;
+}
+
+AsyncSubscriptionPtr_t<DataPointReply> ReplayBrokerClient::subscribe(const std::string& query) {
+    return subscribe(query, SubscriptionOptions{});
+}
+
+AsyncSubscriptionPtr_t<DataPointReply> ReplayBrokerClient::subscribe(const std::string& query,
+                                                                     SubscriptionMode   mode) {
+    return subscribe(query, SubscriptionOptions{mode});
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+ReplayBrokerClient::subscribe(const std::string& query, const SubscriptionOptions& options) {
+    std::vector<SignalHandle_t> signals;
+    for (const auto& path : kuksa_val_v2::parseQuery(query)) {
+        signals.push_back(SignalPathRegistry::getInstance().intern(path));
+    }
+    return addSubscription(std::move(signals), options);
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+ReplayBrokerClient::subscribe(const Query& query, const SubscriptionOptions& options) {
+    return addSubscription(query.getSignals(), options);
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+ReplayBrokerClient::addSubscription(std::vector<SignalHandle_t> signals,
+                                    const SubscriptionOptions&  options) {
+    auto subscription = std::make_shared<AsyncSubscription<DataPointReply>>();
+    subscription->setCallbackExecutor(resolveCallbackExecutor(options));
+    if (options.m_isCoalescingDeliveries) {
+        subscription->setOverflowPolicy(OverflowPolicy::CONFLATE_LATEST);
+    }
+
+    auto state = std::make_shared<SubscriptionState>();
+    subscription->setSnapshotProvider([state]() {
+        std::lock_guard<std::mutex> lock(state->m_mutex);
+        return state->m_dataPoints;
+    });
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto signal : signals) {
+        want(signal);
+    }
+    m_subscriptions.push_back(Subscription{subscription, std::move(signals), options,
+                                           SignalUpdateFilter::isFiltering(options), {},
+                                           std::move(state)});
+    if (!m_thread.joinable()) {
+        m_thread = std::thread([this]() { run(); });
+    }
+    return subscription;
+}
+
+bool ReplayBrokerClient::updateSubscription(
+    const AsyncSubscriptionPtr_t<DataPointReply>& subscription,
+    const std::vector<std::string>& addedSignals, const std::vector<std::string>& removedSignals) {
+    auto&                       registry = SignalPathRegistry::getInstance();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto iter = std::find_if(m_subscriptions.begin(), m_subscriptions.end(), [&](const auto& sub) {
+        return sub.m_subscription == subscription;
+    });
+    if (iter == m_subscriptions.end() || subscription->isCancelled()) {
+        return false;
+    }
+    auto& signals = iter->m_signals;
+    for (const auto& path : addedSignals) {
+        const auto signal = registry.intern(path);
+        if (std::find(signals.begin(), signals.end(), signal) == signals.end()) {
+            signals.push_back(signal);
+            want(signal);
+        }
+    }
+    // signals no subscription wants anymore are still read, as they might be read via get
+    for (const auto& path : removedSignals) {
+        const auto signal = registry.intern(path);
+        signals.erase(std::remove(signals.begin(), signals.end(), signal), signals.end());
+        iter->m_filters.erase(signal);
+        std::lock_guard<std::mutex> stateLock(iter->m_state->m_mutex);
+        iter->m_state->m_dataPoints.erase(signal);
+    }
+    return true;
+}
+
+void ReplayBrokerClient::want(SignalHandle_t signal) {
+    if (signal >= m_wantedSignals.size()) {
+        m_wantedSignals.resize(signal + 1, false);
+        m_latestSamples.resize(signal + 1);
+    }
+    if (!m_wantedSignals[signal]) {
+        m_wantedSignals[signal]   = true;
+        m_areWantedSignalsChanged = true;
+    }
+}
+
+void ReplayBrokerClient::run() {
+    std::vector<bool> wantedSignals;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_stopCondition.wait_for(lock, m_config.m_startDelay,
+                                     [this]() { return m_isStopping; })) {
+            return;
+        }
+    }
+
+    auto start          = std::chrono::steady_clock::now();
+    bool hasReplayedAny = false;
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_isStopping) {
+                return;
+            }
+            if (m_areWantedSignalsChanged) {
+                wantedSignals             = m_wantedSignals;
+                m_areWantedSignalsChanged = false;
+            }
+        }
+
+        auto update = m_reader.next(&wantedSignals);
+        if (!update) {
+            if (!m_config.m_isLooping) {
+                logger().info("Replay of the signal recording finished");
+                return;
+            }
+            // a recording without updates of the wanted signals is not read over and over
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (!hasReplayedAny && m_stopCondition.wait_for(lock, m_config.m_startDelay,
+                                                            [this]() { return m_isStopping; })) {
+                return;
+            }
+            m_reader.rewind();
+            start          = std::chrono::steady_clock::now();
+            hasReplayedAny = false;
+            continue;
+        }
+
+        if (m_config.m_speed > 0.0) {
+            const auto dueAt =
+                start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                            std::chrono::duration<double, std::nano>(
+                                static_cast<double>(update->m_offset.count()) / m_config.m_speed));
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (m_stopCondition.wait_until(lock, dueAt, [this]() { return m_isStopping; })) {
+                return;
+            }
+        }
+        deliver(update->m_dataPoints);
+        hasReplayedAny = true;
+        ++m_numReplayedUpdates;
+    }
+}
+
+void ReplayBrokerClient::deliver(const DataPointReply& update) {
+    const auto receivedAt = SignalUpdateFilter::Clock_t::now();
+    std::vector<std::pair<AsyncSubscriptionPtr_t<DataPointReply>, DataPointReply>> deliveries;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& entry : update) {
+            m_latestSamples[entry.m_handle] = DataPointReply::getSample(entry);
+        }
+        m_subscriptions.erase(std::remove_if(m_subscriptions.begin(), m_subscriptions.end(),
+                                             [](const auto& subscription) {
+                                                 return subscription.m_subscription->isCancelled();
+                                             }),
+                              m_subscriptions.end());
+
+        for (auto& subscription : m_subscriptions) {
+            DataPointReply changes;
+            for (const auto& entry : update) {
+                const auto& signals = subscription.m_signals;
+                if (std::find(signals.begin(), signals.end(), entry.m_handle) == signals.end()) {
+                    continue;
+                }
+                auto sample = DataPointReply::getSample(entry);
+                if (subscription.m_isFiltering &&
+                    !subscription.m_filters[entry.m_handle].accept(subscription.m_options,
+                                                                   sample, receivedAt)) {
+                    continue;
+                }
+                changes.set(entry.m_handle, std::move(sample));
+            }
+            if (changes.empty()) {
+                continue;
+            }
+            std::lock_guard<std::mutex> stateLock(subscription.m_state->m_mutex);
+            auto&                       state = subscription.m_state->m_dataPoints;
+            for (const auto& entry : changes) {
+                state.set(entry.m_handle, DataPointReply::getSample(entry));
+            }
+            deliveries.emplace_back(subscription.m_subscription,
+                                    subscription.m_options.m_mode == SubscriptionMode::DELTA_ONLY
+                                        ? std::move(changes)
+                                        : DataPointReply(state));
+        }
+    }
+    // outside of the lock, as callbacks invoked inline may call this client
+    for (auto& [subscription, reply] : deliveries) {
+        subscription->insertNewItem(std::move(reply));
+    }
+}
+
+} // namespace velocitas
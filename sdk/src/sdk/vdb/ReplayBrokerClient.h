@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_REPLAYBROKERCLIENT_H
+#define VEHICLE_APP_SDK_VDB_REPLAYBROKERCLIENT_H
+
+#include "sdk/SignalPathRegistry.h"
+#include "sdk/vdb/IVehicleDataBrokerClient.h"
+#include "sdk/vdb/SignalRecording.h"
+#include "sdk/vdb/SignalUpdateFilter.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief VehicleDataBrokerClient replaying a signal recording, see
+ * IVehicleDataBrokerClient::createReplay.
+ *
+ * A single thread reads the recording once and hands each update to the subscriptions of its
+ * signals, after applying their SubscriptionOptions. Only the entries of signals which are
+ * subscribed or were read are decoded. WHERE clauses of queries are not supported.
+ */
+class ReplayBrokerClient : public IVehicleDataBrokerClient {
+public:
+    ReplayBrokerClient(const std::string& recordingPath, ReplayConfig config);
+
+    ~ReplayBrokerClient() override;
+
+    ReplayBrokerClient(const ReplayBrokerClient&)            = delete;
+    ReplayBrokerClient(ReplayBrokerClient&&)                 = delete;
+    ReplayBrokerClient& operator=(const ReplayBrokerClient&) = delete;
+    ReplayBrokerClient& operator=(ReplayBrokerClient&&)      = delete;
+
+    AsyncResultPtr_t<DataPointReply>
+    getDatapoints(const std::vector<std::string>& datapoints) override;
+
+    AsyncResultPtr_t<SetErrorMap_t>
+    setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints) override;
+
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string& query) override;
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string& query,
+                                                     SubscriptionMode   mode) override;
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string&         query,
+                                                     const SubscriptionOptions& options) override;
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const Query&               query,
+                                                     const SubscriptionOptions& options) override;
+
+    bool updateSubscription(const AsyncSubscriptionPtr_t<DataPointReply>& subscription,
+                            const std::vector<std::string>&               addedSignals,
+                            const std::vector<std::string>&               removedSignals) override;
+
+    /**
+     * @brief Get the number of recorded updates replayed so far.
+     */
+    [[nodiscard]] uint64_t getNumReplayedUpdates() const { return m_numReplayedUpdates; }
+
+private:
+    // the delivered data points of a subscription, for its snapshots
+    struct SubscriptionState {
+        std::mutex     m_mutex;
+        DataPointReply m_dataPoints;
+    };
+
+    struct Subscription {
+        AsyncSubscriptionPtr_t<DataPointReply>                 m_subscription;
+        std::vector<SignalHandle_t>                            m_signals;
+        SubscriptionOptions                                    m_options;
+        bool                                                   m_isFiltering{false};
+        std::unordered_map<SignalHandle_t, SignalUpdateFilter> m_filters;
+        std::shared_ptr<SubscriptionState>                     m_state;
+    };
+
+    AsyncSubscriptionPtr_t<DataPointReply> addSubscription(std::vector<SignalHandle_t> signals,
+                                                           const SubscriptionOptions&  options);
+
+    // need to be called with m_mutex being locked
+    void want(SignalHandle_t signal);
+
+    void run();
+    void deliver(const DataPointReply& update);
+
+    const ReplayConfig    m_config;
+    SignalRecordingReader m_reader;
+
+    std::mutex                   m_mutex;
+    std::condition_variable      m_stopCondition;
+    bool                         m_isStopping{false};
+    std::vector<Subscription>    m_subscriptions;
+    // the signals to read from the recording and their latest replayed samples, by handle
+    std::vector<bool>            m_wantedSignals;
+    bool                         m_areWantedSignalsChanged{false};
+    std::vector<DataPointSample> m_latestSamples;
+    std::atomic<uint64_t>        m_numReplayedUpdates{0};
+    std::thread                  m_thread;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_REPLAYBROKERCLIENT_H
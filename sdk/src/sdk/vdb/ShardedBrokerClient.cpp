@@ -0,0 +1,524 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#include "ShardedBrokerClient.h"
+
+#include "sdk/Exceptions.h"
+#include "sdk/Logger.h"
+#include "sdk/Utils.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/TypeConversions.h"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+namespace velocitas {
+
+namespace {
+
+bool isInSubtree(std::string_view path, const std::string& subtree) {
+    if (subtree.empty()) {
+        return true;
+    }
+    return path.size() >= subtree.size() && path.compare(0, subtree.size(), subtree) == 0 &&
+           (path.size() == subtree.size() || path[subtree.size()] == '.');
+}
+
+std::string buildQuery(const std::vector<std::string>& paths) {
+    return "SELECT " + StringUtils::join(paths, ", ");
+}
+
+std::string getUnroutedError(const std::string& path) {
+    return fmt::format("No databroker is routed for signal '{}'", path);
+}
+
+// cancelling the merged result of a split request cancels its parts
+template <typename TResult, typename TPart>
+void cancelPartsWith(TResult& result, const std::vector<AsyncResultPtr_t<TPart>>& parts) {
+    std::vector<std::weak_ptr<AsyncResult<TPart>>> weakParts(parts.begin(), parts.end());
+    result.setCancellationHandler([weakParts = std::move(weakParts)]() {
+        for (const auto& weakPart : weakParts) {
+            if (auto part = weakPart.lock()) {
+                part->cancel();
+            }
+        }
+    });
+}
+
+} // namespace
+
+struct ShardedBrokerClient::MergedSubscription {
+    AsyncSubscriptionPtr_t<DataPointReply> m_subscription;
+    SubscriptionMode                       m_mode;
+    // options of the parts, which deliver their deltas inline to be merged
+    SubscriptionOptions                    m_partOptions;
+
+    std::mutex     m_mutex;
+    DataPointReply m_state;
+    // the subscription of each route, nullptr for routes without signals
+    std::vector<AsyncSubscriptionPtr_t<DataPointReply>> m_parts;
+
+    void deliver(DataPointReply&& update) {
+        DataPointReply item;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_mode == SubscriptionMode::DELTA_ONLY) {
+                m_state.merge(DataPointReply(update));
+                item = std::move(update);
+            } else {
+                m_state.merge(std::move(update));
+                item = m_state;
+            }
+        }
+        m_subscription->insertNewItem(std::move(item));
+    }
+
+    void fail(Status&& status) {
+        cancelParts();
+        m_subscription->insertError(std::move(status));
+    }
+
+    void cancelParts() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& part : m_parts) {
+            if (part) {
+                part->cancel();
+            }
+        }
+    }
+};
+
+std::shared_ptr<IVehicleDataBrokerClient>
+IVehicleDataBrokerClient::createSharded(std::vector<ShardRoute> routes) {
+    return std::make_shared<ShardedBrokerClient>(std::move(routes));
+}
+
+ShardedBrokerClient::ShardedBrokerClient(std::vector<ShardRoute> routes)
+    : m_routes(std::move(routes)) {
+    if (m_routes.empty()) {
+        throw InvalidValueException("A sharded client needs at least one route");
+    }
+    // the longest subtree containing a signal is found first
+    std::stable_sort(m_routes.begin(), m_routes.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.m_subtree.size() > rhs.m_subtree.size();
+    });
+    for (size_t i = 0; i < m_routes.size(); ++i) {
+        if (!m_routes[i].m_client) {
+            throw InvalidValueException(
+                fmt::format("Route of subtree '{}' has no client", m_routes[i].m_subtree));
+        }
+        if (i > 0 && m_routes[i].m_subtree == m_routes[i - 1].m_subtree) {
+            throw InvalidValueException(
+                fmt::format("Subtree '{}' is routed twice", m_routes[i].m_subtree));
+        }
+    }
+}
+
+AsyncResultPtr_t<DataPointReply>
+ShardedBrokerClient::getDatapoints(const std::vector<std::string>& datapoints) {
+    std::vector<std::string> unrouted;
+    const auto               groups = groupByRoute(datapoints, unrouted);
+    const auto               route  = getSingleRoute(groups);
+    if (route && unrouted.empty()) {
+        return withCallbackExecutor(m_routes[*route].m_client->getDatapoints(datapoints));
+    }
+
+    ++m_numSplitRequests;
+    std::vector<AsyncResultPtr_t<DataPointReply>> parts;
+    for (size_t i = 0; i < groups.size(); ++i) {
+        if (!groups[i].empty()) {
+            parts.push_back(m_routes[i].m_client->getDatapoints(groups[i]));
+        }
+    }
+    auto result = whenAll(parts)->then(
+        [unrouted = std::move(unrouted)](const std::vector<DataPointReply>& replies) {
+            DataPointReply reply;
+            for (const auto& part : replies) {
+                reply.merge(DataPointReply(part));
+            }
+            for (const auto& path : unrouted) {
+                reply.set(path, DataPointSample(DataPointValue::Type::INVALID,
+                                                DataPointValue::Failure::UNKNOWN_DATAPOINT,
+                                                Timestamp{}));
+            }
+            return reply;
+        });
+    cancelPartsWith(*result, parts);
+    return withCallbackExecutor(std::move(result));
+}
+
+AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t>
+ShardedBrokerClient::setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints) {
+    return setSplit(datapoints, std::nullopt);
+}
+
+AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t>
+ShardedBrokerClient::setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints,
+                                   SetMode                                             mode) {
+    return setSplit(datapoints, mode);
+}
+
+AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t>
+ShardedBrokerClient::setSplit(const std::vector<std::unique_ptr<DataPointValue>>& datapoints,
+                              std::optional<SetMode>                              mode) {
+    const auto setAt = [&mode](IVehicleDataBrokerClient&                           client,
+                               const std::vector<std::unique_ptr<DataPointValue>>& values) {
+        return mode ? client.setDatapoints(values, *mode) : client.setDatapoints(values);
+    };
+
+    SetErrorMap_t       errors;
+    std::vector<size_t> routes;
+    routes.reserve(datapoints.size());
+    for (const auto& dataPoint : datapoints) {
+        const auto route = findRoute(dataPoint->getPath());
+        if (!route) {
+            errors.emplace(dataPoint->getPath(), getUnroutedError(dataPoint->getPath()));
+        }
+        routes.push_back(route.value_or(m_routes.size()));
+    }
+    const auto isSingleRoute = std::adjacent_find(routes.begin(), routes.end(),
+                                                  std::not_equal_to<>()) == routes.end();
+    if (!routes.empty() && isSingleRoute && errors.empty()) {
+        return withCallbackExecutor(setAt(*m_routes[routes.front()].m_client, datapoints));
+    }
+
+    ++m_numSplitRequests;
+    std::vector<std::vector<std::unique_ptr<DataPointValue>>> groups(m_routes.size());
+    for (size_t i = 0; i < datapoints.size(); ++i) {
+        if (routes[i] < m_routes.size()) {
+            groups[routes[i]].push_back(datapoints[i]->clone());
+        }
+    }
+    std::vector<AsyncResultPtr_t<SetErrorMap_t>> parts;
+    for (size_t i = 0; i < groups.size(); ++i) {
+        if (!groups[i].empty()) {
+            parts.push_back(setAt(*m_routes[i].m_client, groups[i]));
+        }
+    }
+    auto result = whenAll(parts)->then(
+        [errors = std::move(errors)](const std::vector<SetErrorMap_t>& partErrors) {
+            auto allErrors = errors;
+            for (const auto& part : partErrors) {
+                allErrors.insert(part.begin(), part.end());
+            }
+            return allErrors;
+        });
+    cancelPartsWith(*result, parts);
+    return withCallbackExecutor(std::move(result));
+}
+
+AsyncSubscriptionPtr_t<DataPointReply> ShardedBrokerClient::subscribe(const std::string& query) {
+    return subscribe(query, SubscriptionOptions{});
+}
+
+AsyncSubscriptionPtr_t<DataPointReply> ShardedBrokerClient::subscribe(const std::string& query,
+                                                                      SubscriptionMode   mode) {
+    return subscribe(query, SubscriptionOptions{mode});
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+ShardedBrokerClient::subscribe(const std::string& query, const SubscriptionOptions& options) {
+    std::vector<std::string> paths;
+    try {
+        paths = kuksa_val_v2::parseQuery(query);
+    } catch (const std::runtime_error&) {
+        // e.g. a WHERE clause, which only the databroker can evaluate; left to the default route
+        const auto route = findRoute({});
+        if (!route) {
+            throw InvalidValueException(
+                "Queries with WHERE clauses need a route of all signals (empty subtree)");
+        }
+        return forwardSubscription(*route, query, options);
+    }
+
+    std::vector<std::string> unrouted;
+    const auto               groups = groupByRoute(paths, unrouted);
+    if (!unrouted.empty()) {
+        throw InvalidValueException(getUnroutedError(unrouted.front()));
+    }
+    if (const auto route = getSingleRoute(groups)) {
+        return forwardSubscription(*route, query, options);
+    }
+    return subscribeSplit(groups, options);
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+ShardedBrokerClient::subscribe(const Query& query, const SubscriptionOptions& options) {
+    auto paths = query.getSignalPaths();
+    for (const auto& condition : query.getConditions()) {
+        paths.push_back(SignalPathRegistry::getInstance().getPath(condition.m_signal));
+    }
+    std::vector<std::string> unrouted;
+    const auto               groups = groupByRoute(paths, unrouted);
+    if (!unrouted.empty()) {
+        throw InvalidValueException(getUnroutedError(unrouted.front()));
+    }
+    if (const auto route = getSingleRoute(groups)) {
+        auto effectiveOptions               = options;
+        effectiveOptions.m_callbackExecutor = resolveCallbackExecutor(options);
+        return m_routes[*route].m_client->subscribe(query, effectiveOptions);
+    }
+    if (!query.getConditions().empty()) {
+        throw InvalidValueException("WHERE clauses of signals of several databrokers are not "
+                                    "supported");
+    }
+    return subscribeSplit(groups, options);
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+ShardedBrokerClient::forwardSubscription(size_t route, const std::string& query,
+                                         const SubscriptionOptions& options) {
+    auto effectiveOptions               = options;
+    effectiveOptions.m_callbackExecutor = resolveCallbackExecutor(options);
+    return m_routes[route].m_client->subscribe(query, effectiveOptions);
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+ShardedBrokerClient::subscribeSplit(const std::vector<std::vector<std::string>>& groups,
+                                    const SubscriptionOptions&                   options) {
+    ++m_numSplitRequests;
+    auto merged            = std::make_shared<MergedSubscription>();
+    merged->m_subscription = std::make_shared<AsyncSubscription<DataPointReply>>();
+    merged->m_subscription->setCallbackExecutor(resolveCallbackExecutor(options));
+    if (options.m_isCoalescingDeliveries) {
+        merged->m_subscription->setOverflowPolicy(OverflowPolicy::CONFLATE_LATEST);
+    }
+    merged->m_mode                                 = options.m_mode;
+    merged->m_partOptions                          = options;
+    merged->m_partOptions.m_mode                   = SubscriptionMode::DELTA_ONLY;
+    merged->m_partOptions.m_callbackExecutor       = nullptr;
+    merged->m_partOptions.m_priority               = JobPriority::NORMAL;
+    merged->m_partOptions.m_isCoalescingDeliveries = false;
+    merged->m_parts.resize(m_routes.size());
+
+    std::weak_ptr<MergedSubscription> weakMerged = merged;
+    merged->m_subscription->setSnapshotProvider([weakMerged]() {
+        auto mergedPtr = weakMerged.lock();
+        if (!mergedPtr) {
+            return DataPointReply{};
+        }
+        std::lock_guard<std::mutex> lock(mergedPtr->m_mutex);
+        return mergedPtr->m_state;
+    });
+    // the streams of the parts are stopped right away, not with their next update
+    merged->m_subscription->setCancellationHandler([weakMerged]() {
+        if (auto mergedPtr = weakMerged.lock()) {
+            mergedPtr->cancelParts();
+        }
+    });
+
+    for (size_t i = 0; i < groups.size(); ++i) {
+        if (!groups[i].empty()) {
+            subscribeShard(merged, m_routes[i], i, groups[i]);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_subscriptions.erase(std::remove_if(m_subscriptions.begin(), m_subscriptions.end(),
+                                         [](const auto& subscription) {
+                                             return subscription->m_subscription->isCancelled();
+                                         }),
+                          m_subscriptions.end());
+    m_subscriptions.push_back(merged);
+    return merged->m_subscription;
+}
+
+void ShardedBrokerClient::subscribeShard(const std::shared_ptr<MergedSubscription>& merged,
+                                         const ShardRoute& route, size_t routeIndex,
+                                         const std::vector<std::string>& paths) {
+    auto part = route.m_client->subscribe(buildQuery(paths), merged->m_partOptions);
+    {
+        std::lock_guard<std::mutex> lock(merged->m_mutex);
+        merged->m_parts[routeIndex] = part;
+    }
+    // weak references only, as the merged subscription holds its parts
+    std::weak_ptr<MergedSubscription>                weakMerged = merged;
+    std::weak_ptr<AsyncSubscription<DataPointReply>> weakPart   = part;
+    part->onItemMoved([weakMerged, weakPart](DataPointReply&& update) {
+        auto mergedPtr = weakMerged.lock();
+        if (!mergedPtr || mergedPtr->m_subscription->isCancelled()) {
+            if (auto partPtr = weakPart.lock()) {
+                partPtr->cancel();
+            }
+            return;
+        }
+        mergedPtr->deliver(std::move(update));
+    });
+    part->onError([weakMerged](Status status) {
+        if (auto mergedPtr = weakMerged.lock()) {
+            mergedPtr->fail(std::move(status));
+        }
+    });
+}
+
+bool ShardedBrokerClient::updateSubscription(
+    const AsyncSubscriptionPtr_t<DataPointReply>& subscription,
+    const std::vector<std::string>& addedSignals, const std::vector<std::string>& removedSignals) {
+    std::shared_ptr<MergedSubscription> merged;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto iter = std::find_if(m_subscriptions.begin(), m_subscriptions.end(),
+                                       [&subscription](const auto& candidate) {
+                                           return candidate->m_subscription == subscription;
+                                       });
+        if (iter != m_subscriptions.end()) {
+            merged = *iter;
+        }
+    }
+    if (!merged) {
+        // forwarded to the client of a single route, so signals of other routes cannot be added
+        std::vector<std::string> unrouted;
+        const auto               route = getSingleRoute(groupByRoute(addedSignals, unrouted));
+        if (!unrouted.empty() || (!addedSignals.empty() && !route)) {
+            return false;
+        }
+        for (size_t i = 0; i < m_routes.size(); ++i) {
+            if ((!route || *route == i) &&
+                m_routes[i].m_client->updateSubscription(subscription, addedSignals,
+                                                         removedSignals)) {
+                return true;
+            }
+        }
+        return false;
+    }
+    if (subscription->isCancelled()) {
+        return false;
+    }
+
+    std::vector<std::string> unrouted;
+    const auto               addedGroups = groupByRoute(addedSignals, unrouted);
+    if (!unrouted.empty()) {
+        return false;
+    }
+    // signals without a route are not subscribed, so there is nothing to remove
+    const auto removedGroups = groupByRoute(removedSignals, unrouted);
+    for (size_t i = 0; i < m_routes.size(); ++i) {
+        if (addedGroups[i].empty() && removedGroups[i].empty()) {
+            continue;
+        }
+        AsyncSubscriptionPtr_t<DataPointReply> part;
+        {
+            std::lock_guard<std::mutex> lock(merged->m_mutex);
+            part = merged->m_parts[i];
+        }
+        if (part) {
+            m_routes[i].m_client->updateSubscription(part, addedGroups[i], removedGroups[i]);
+        } else if (!addedGroups[i].empty()) {
+            subscribeShard(merged, m_routes[i], i, addedGroups[i]);
+        }
+    }
+    std::lock_guard<std::mutex> lock(merged->m_mutex);
+    for (const auto& path : removedSignals) {
+        merged->m_state.erase(SignalPathRegistry::getInstance().intern(path));
+    }
+    return true;
+}
+
+AsyncResultPtr_t<Status> ShardedBrokerClient::prepare(const std::vector<std::string>& signalPaths,
+                                                      std::chrono::milliseconds       timeout) {
+    std::vector<std::string> unrouted;
+    const auto               groups = groupByRoute(signalPaths, unrouted);
+    if (!unrouted.empty()) {
+        auto result = withCallbackExecutor(std::make_shared<AsyncResult<Status>>());
+        result->insertError(Status(getUnroutedError(unrouted.front())));
+        return result;
+    }
+    // all clients get connected, also the ones without signals to prepare
+    std::vector<AsyncResultPtr_t<Status>> parts;
+    for (size_t i = 0; i < m_routes.size(); ++i) {
+        parts.push_back(m_routes[i].m_client->prepare(groups[i], timeout));
+    }
+    return withCallbackExecutor(
+        whenAll(parts)->then([](const std::vector<Status>& /*unused*/) { return Status(); }));
+}
+
+AsyncResultPtr_t<Status> ShardedBrokerClient::whenReady() {
+    std::vector<AsyncResultPtr_t<Status>> parts;
+    for (const auto& route : m_routes) {
+        parts.push_back(route.m_client->whenReady());
+    }
+    return withCallbackExecutor(
+        whenAll(parts)->then([](const std::vector<Status>& /*unused*/) { return Status(); }));
+}
+
+std::shared_ptr<IPreparedSet>
+ShardedBrokerClient::prepareSet(const std::vector<std::string>& signalPaths) {
+    std::vector<std::string> unrouted;
+    const auto               route = getSingleRoute(groupByRoute(signalPaths, unrouted));
+    if (route && unrouted.empty()) {
+        return m_routes[*route].m_client->prepareSet(signalPaths);
+    }
+    return IVehicleDataBrokerClient::prepareSet(signalPaths);
+}
+
+size_t ShardedBrokerClient::cancelPendingRequests() {
+    size_t numCancelled{0};
+    for (const auto& route : m_routes) {
+        numCancelled += route.m_client->cancelPendingRequests();
+    }
+    return numCancelled;
+}
+
+void ShardedBrokerClient::setExecutor(ExecutorPtr_t executor) {
+    IVehicleDataBrokerClient::setExecutor(executor);
+    for (const auto& route : m_routes) {
+        route.m_client->setExecutor(executor);
+    }
+}
+
+std::optional<size_t> ShardedBrokerClient::findRoute(std::string_view path) const {
+    for (size_t i = 0; i < m_routes.size(); ++i) {
+        if (isInSubtree(path, m_routes[i].m_subtree)) {
+            return i;
+        }
+    }
+    return std::nullopt;
+}
+
+std::vector<std::vector<std::string>>
+ShardedBrokerClient::groupByRoute(const std::vector<std::string>& paths,
+                                  std::vector<std::string>&       unrouted) const {
+    std::vector<std::vector<std::string>> groups(m_routes.size());
+    for (const auto& path : paths) {
+        if (const auto route = findRoute(path)) {
+            groups[*route].push_back(path);
+        } else {
+            unrouted.push_back(path);
+        }
+    }
+    return groups;
+}
+
+std::optional<size_t>
+ShardedBrokerClient::getSingleRoute(const std::vector<std::vector<std::string>>& groups) {
+    std::optional<size_t> route;
+    for (size_t i = 0; i < groups.size(); ++i) {
+        if (groups[i].empty()) {
+            continue;
+        }
+        if (route) {
+            return std::nullopt;
+        }
+        route = i;
+    }
+    return route;
+}
+
+} // namespace velocitas
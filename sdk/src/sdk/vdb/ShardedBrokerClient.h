@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#ifndef VEHICLE_APP_SDK_VDB_SHARDEDBROKERCLIENT_H
+#define VEHICLE_APP_SDK_VDB_SHARDEDBROKERCLIENT_H
+
+#include "sdk/vdb/IVehicleDataBrokerClient.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief VehicleDataBrokerClient routing the signals of VSS subtrees to the clients of different
+ * databrokers, see IVehicleDataBrokerClient::createSharded.
+ *
+ * Requests and subscriptions whose signals are all routed to the same client are forwarded as
+ * they are. Others are split per route and issued to all their clients at once; the replies of
+ * the parts of a request are merged once all arrived, the updates of the parts of a subscription
+ * are merged into the state of the subscription as they arrive, and delivered as a whole or as
+ * delta, depending on its mode.
+ */
+class ShardedBrokerClient : public IVehicleDataBrokerClient {
+public:
+    explicit ShardedBrokerClient(std::vector<ShardRoute> routes);
+
+    ShardedBrokerClient(const ShardedBrokerClient&)            = delete;
+    ShardedBrokerClient(ShardedBrokerClient&&)                 = delete;
+    ShardedBrokerClient& operator=(const ShardedBrokerClient&) = delete;
+    ShardedBrokerClient& operator=(ShardedBrokerClient&&)      = delete;
+
+    AsyncResultPtr_t<DataPointReply>
+    getDatapoints(const std::vector<std::string>& datapoints) override;
+
+    AsyncResultPtr_t<SetErrorMap_t>
+    setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints) override;
+
+    AsyncResultPtr_t<SetErrorMap_t>
+    setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints,
+                  SetMode                                             mode) override;
+
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string& query) override;
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string& query,
+                                                     SubscriptionMode   mode) override;
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string&         query,
+                                                     const SubscriptionOptions& options) override;
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const Query&               query,
+                                                     const SubscriptionOptions& options) override;
+
+    bool updateSubscription(const AsyncSubscriptionPtr_t<DataPointReply>& subscription,
+                            const std::vector<std::string>&               addedSignals,
+                            const std::vector<std::string>&               removedSignals) override;
+
+    AsyncResultPtr_t<Status> prepare(const std::vector<std::string>& signalPaths,
+                                     std::chrono::milliseconds       timeout) override;
+
+    AsyncResultPtr_t<Status> whenReady() override;
+
+    std::shared_ptr<IPreparedSet> prepareSet(const std::vector<std::string>& signalPaths) override;
+
+    size_t cancelPendingRequests() override;
+
+    void setExecutor(ExecutorPtr_t executor) override;
+
+    /**
+     * @brief Get the index of the route of the passed signal, nullopt if it has none.
+     */
+    [[nodiscard]] std::optional<size_t> findRoute(std::string_view path) const;
+
+    [[nodiscard]] const std::vector<ShardRoute>& getRoutes() const { return m_routes; }
+
+    /**
+     * @brief Get the number of requests and subscriptions split across several routes.
+     */
+    [[nodiscard]] uint64_t getNumSplitRequests() const { return m_numSplitRequests; }
+
+private:
+    struct MergedSubscription;
+
+    // the passed paths grouped per route, in the order of m_routes; the ones without a route are
+    // added to unrouted
+    std::vector<std::vector<std::string>> groupByRoute(const std::vector<std::string>& paths,
+                                                       std::vector<std::string>& unrouted) const;
+
+    // sets the values at the clients of their routes, with the passed mode if set
+    AsyncResultPtr_t<SetErrorMap_t>
+    setSplit(const std::vector<std::unique_ptr<DataPointValue>>& datapoints,
+             std::optional<SetMode>                              mode);
+
+    // the index of the only route of the passed groups, nullopt if several have paths
+    static std::optional<size_t>
+    getSingleRoute(const std::vector<std::vector<std::string>>& groups);
+
+    AsyncSubscriptionPtr_t<DataPointReply> forwardSubscription(size_t                     route,
+                                                               const std::string&         query,
+                                                               const SubscriptionOptions& options);
+
+    AsyncSubscriptionPtr_t<DataPointReply>
+    subscribeSplit(const std::vector<std::vector<std::string>>& groups,
+                   const SubscriptionOptions&                   options);
+
+    // subscribes the paths at the route on behalf of the merged subscription
+    static void subscribeShard(const std::shared_ptr<MergedSubscription>& merged,
+                               const ShardRoute& route, size_t routeIndex,
+                               const std::vector<std::string>& paths);
+
+    std::vector<ShardRoute> m_routes;
+
+    std::mutex                                       m_mutex;
+    std::vector<std::shared_ptr<MergedSubscription>> m_subscriptions;
+    std::atomic<uint64_t>                            m_numSplitRequests{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_SHARDEDBROKERCLIENT_H
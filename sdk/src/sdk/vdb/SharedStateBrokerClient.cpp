@@ -0,0 +1,431 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "SharedStateBrokerClient.h"
+
+#include "SharedStateTable.h"
+
+#include "sdk/Logger.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/TypeConversions.h"
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <utility>
+
+namespace velocitas {
+
+namespace {
+
+// time after which the thread checks whether the table got closed, even without changes
+constexpr std::chrono::milliseconds POLL_INTERVAL{100};
+
+// time between attempts to open a table which does not exist (yet)
+constexpr std::chrono::milliseconds OPEN_RETRY_INTERVAL{1000};
+
+} // namespace
+
+std::shared_ptr<IVehicleDataBrokerClient>
+IVehicleDataBrokerClient::createSharedState(const std::string&                        tableName,
+                                            std::shared_ptr<IVehicleDataBrokerClient> fallback) {
+    return std::make_shared<SharedStateBrokerClient>(tableName, std::move(fallback));
+}
+
+SharedStateBrokerClient::SharedStateBrokerClient(
+    std::string tableName, std::shared_ptr<IVehicleDataBrokerClient> fallback)
+    : m_tableName(std::move(tableName))
+    , m_fallback(std::move(fallback)) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        openTable();
+    }
+    if (m_table) {
+        logger().info("Reading {} signals from shared state table '{}'", m_table->getNumSignals(),
+                      m_tableName);
+    } else {
+        logger().warn("Shared state table '{}' does not exist yet, waiting for its publisher",
+                      m_tableName);
+    }
+    m_thread = std::thread([this]() { run(); });
+}
+
+SharedStateBrokerClient::~SharedStateBrokerClient() {
+    std::shared_ptr<SharedStateTable> table;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+        table        = m_table;
+    }
+    m_stopCondition.notify_all();
+    // a thread not waiting yet notices the stop after the poll interval at the latest
+    if (table) {
+        table->wake();
+    }
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+AsyncResultPtr_t<DataPointReply>
+SharedStateBrokerClient::getDatapoints(const std::vector<std::string>& datapoints) {
+    auto&                       registry = SignalPathRegistry::getInstance();
+    std::vector<SignalHandle_t> signals;
+    signals.reserve(datapoints.size());
+    for (const auto& path : datapoints) {
+        signals.push_back(registry.intern(path));
+    }
+    const auto table = getTable();
+    if (m_fallback && !isServedLocally(table, signals)) {
+        return withCallbackExecutor(m_fallback->getDatapoints(datapoints));
+    }
+
+    DataPointReply reply;
+    reply.reserve(signals.size());
+    for (const auto signal : signals) {
+        const auto index = table ? table->findIndex(signal) : std::nullopt;
+        if (!index) {
+            reply.set(signal, DataPointSample(DataPointValue::Type::INVALID,
+                                              table ? DataPointValue::Failure::UNKNOWN_DATAPOINT
+                                                    : DataPointValue::Failure::NOT_AVAILABLE,
+                                              Timestamp{}));
+            continue;
+        }
+        auto reading = table->readSlot(*index);
+        if (!reading) {
+            // the publisher died while writing the slot
+            if (m_fallback) {
+                return withCallbackExecutor(m_fallback->getDatapoints(datapoints));
+            }
+            reply.set(signal, DataPointSample(DataPointValue::Type::INVALID,
+                                              DataPointValue::Failure::NOT_AVAILABLE,
+                                              Timestamp{}));
+            continue;
+        }
+        reply.set(signal, std::move(reading->sample));
+        ++m_numReadDataPoints;
+    }
+    auto result = withCallbackExecutor(std::make_shared<AsyncResult<DataPointReply>>());
+    result->insertResult(std::move(reply));
+    return result;
+}
+
+AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t> SharedStateBrokerClient::setDatapoints(
+    const std::vector<std::unique_ptr<DataPointValue>>& datapoints) {
+    if (m_fallback) {
+        return withCallbackExecutor(m_fallback->setDatapoints(datapoints));
+    }
+    SetErrorMap_t errors;
+    for (const auto& dataPoint : datapoints) {
+        errors.emplace(dataPoint->getPath(), "Shared state table is read-only");
+    }
+    auto result = withCallbackExecutor(std::make_shared<AsyncResult<SetErrorMap_t>>());
+    result->insertResult(std::move(errors));
+    return result;
+}
+
+AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t> SharedStateBrokerClient::setDatapoints(
+    const std::vector<std::unique_ptr<DataPointValue>>& datapoints, SetMode mode) {
+    if (m_fallback) {
+        return withCallbackExecutor(m_fallback->setDatapoints(datapoints, mode));
+    }
+    return setDatapoints(datapoints);
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+SharedStateBrokerClient::subscribe(const std::string& query) {
+    return subscribe(query, SubscriptionOptions{});
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+SharedStateBrokerClient::subscribe(const std::string& query, SubscriptionMode mode) {
+    return subscribe(query, SubscriptionOptions{mode});
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+SharedStateBrokerClient::subscribe(const std::string& query, const SubscriptionOptions& options) {
+    std::vector<SignalHandle_t> signals;
+    try {
+        for (const auto& path : kuksa_val_v2::parseQuery(query)) {
+            signals.push_back(SignalPathRegistry::getInstance().intern(path));
+        }
+    } catch (const std::runtime_error&) {
+        // e.g. a WHERE clause, which only the databroker can evaluate
+        if (!m_fallback) {
+            throw;
+        }
+    }
+    if (m_fallback && (signals.empty() || !isServedLocally(getTable(), signals))) {
+        auto effectiveOptions               = options;
+        effectiveOptions.m_callbackExecutor = resolveCallbackExecutor(options);
+        return m_fallback->subscribe(query, effectiveOptions);
+    }
+    return addSubscription(std::move(signals), options);
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+SharedStateBrokerClient::subscribe(const Query& query, const SubscriptionOptions& options) {
+    if (m_fallback &&
+        (!query.getConditions().empty() || !isServedLocally(getTable(), query.getSignals()))) {
+        auto effectiveOptions               = options;
+        effectiveOptions.m_callbackExecutor = resolveCallbackExecutor(options);
+        return m_fallback->subscribe(query, effectiveOptions);
+    }
+    return addSubscription(query.getSignals(), options);
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+SharedStateBrokerClient::addSubscription(std::vector<SignalHandle_t> signals,
+                                         const SubscriptionOptions&  options) {
+    auto subscription = std::make_shared<AsyncSubscription<DataPointReply>>();
+    subscription->setCallbackExecutor(resolveCallbackExecutor(options));
+    if (options.m_isCoalescingDeliveries) {
+        subscription->setOverflowPolicy(OverflowPolicy::CONFLATE_LATEST);
+    }
+
+    auto state = std::make_shared<SubscriptionState>();
+    subscription->setSnapshotProvider([state]() {
+        std::lock_guard<std::mutex> lock(state->m_mutex);
+        return state->m_dataPoints;
+    });
+
+    std::shared_ptr<SharedStateTable> table;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_subscriptions.push_back(Subscription{subscription, std::move(signals), {}, {}, options,
+                                               SignalUpdateFilter::isFiltering(options), {},
+                                               std::move(state)});
+        mapSignals(m_subscriptions.back());
+        table = m_table;
+    }
+    // delivers the current values of the signals without waiting for the next change
+    if (table) {
+        table->wake();
+    }
+    return subscription;
+}
+
+bool SharedStateBrokerClient::updateSubscription(
+    const AsyncSubscriptionPtr_t<DataPointReply>& subscription,
+    const std::vector<std::string>& addedSignals, const std::vector<std::string>& removedSignals) {
+    auto&                        registry = SignalPathRegistry::getInstance();
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto iter = std::find_if(m_subscriptions.begin(), m_subscriptions.end(), [&](const auto& sub) {
+        return sub.m_subscription == subscription;
+    });
+    if (iter == m_subscriptions.end()) {
+        lock.unlock();
+        return m_fallback && m_fallback->updateSubscription(subscription, addedSignals,
+                                                            removedSignals);
+    }
+    if (subscription->isCancelled()) {
+        return false;
+    }
+    auto& signals = iter->m_signals;
+    for (const auto& path : addedSignals) {
+        const auto signal = registry.intern(path);
+        if (std::find(signals.begin(), signals.end(), signal) == signals.end()) {
+            signals.push_back(signal);
+            iter->m_indices.push_back(m_table ? m_table->findIndex(signal) : std::nullopt);
+            iter->m_numSeenUpdates.push_back(0);
+        }
+    }
+    for (const auto& path : removedSignals) {
+        const auto signal = registry.intern(path);
+        const auto found  = std::find(signals.begin(), signals.end(), signal);
+        if (found == signals.end()) {
+            continue;
+        }
+        const auto position = found - signals.begin();
+        signals.erase(found);
+        iter->m_indices.erase(iter->m_indices.begin() + position);
+        iter->m_numSeenUpdates.erase(iter->m_numSeenUpdates.begin() + position);
+        iter->m_filters.erase(signal);
+        std::lock_guard<std::mutex> stateLock(iter->m_state->m_mutex);
+        iter->m_state->m_dataPoints.erase(signal);
+    }
+    const auto table = m_table;
+    lock.unlock();
+    if (table && !addedSignals.empty()) {
+        table->wake();
+    }
+    return true;
+}
+
+AsyncResultPtr_t<Status>
+SharedStateBrokerClient::prepare(const std::vector<std::string>& signalPaths,
+                                 std::chrono::milliseconds       timeout) {
+    if (m_fallback) {
+        return withCallbackExecutor(m_fallback->prepare(signalPaths, timeout));
+    }
+    return IVehicleDataBrokerClient::prepare(signalPaths, timeout);
+}
+
+AsyncResultPtr_t<Status> SharedStateBrokerClient::whenReady() {
+    if (m_fallback) {
+        return withCallbackExecutor(m_fallback->whenReady());
+    }
+    return IVehicleDataBrokerClient::whenReady();
+}
+
+std::shared_ptr<IPreparedSet>
+SharedStateBrokerClient::prepareSet(const std::vector<std::string>& signalPaths) {
+    if (m_fallback) {
+        return m_fallback->prepareSet(signalPaths);
+    }
+    return IVehicleDataBrokerClient::prepareSet(signalPaths);
+}
+
+size_t SharedStateBrokerClient::cancelPendingRequests() {
+    return m_fallback ? m_fallback->cancelPendingRequests() : 0;
+}
+
+void SharedStateBrokerClient::setExecutor(ExecutorPtr_t executor) {
+    IVehicleDataBrokerClient::setExecutor(executor);
+    if (m_fallback) {
+        m_fallback->setExecutor(std::move(executor));
+    }
+}
+
+std::shared_ptr<SharedStateTable> SharedStateBrokerClient::getTable() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_table;
+}
+
+bool SharedStateBrokerClient::isServedLocally(const std::shared_ptr<SharedStateTable>& table,
+                                              const std::vector<SignalHandle_t>& signals) const {
+    return table && std::all_of(signals.begin(), signals.end(), [&table](auto signal) {
+               return table->findIndex(signal).has_value();
+           });
+}
+
+void SharedStateBrokerClient::openTable() {
+    try {
+        auto table = SharedStateTable::open(m_tableName);
+        // a table being closed by a restarting publisher is not used anymore
+        if (!table->isClosed()) {
+            m_table = std::move(table);
+        }
+    } catch (const std::runtime_error&) {
+        // not created (yet)
+        return;
+    }
+    for (auto& subscription : m_subscriptions) {
+        mapSignals(subscription);
+    }
+}
+
+void SharedStateBrokerClient::mapSignals(Subscription& subscription) const {
+    const auto& signals = subscription.m_signals;
+    subscription.m_indices.assign(signals.size(), std::nullopt);
+    subscription.m_numSeenUpdates.assign(signals.size(), 0);
+    if (!m_table) {
+        return;
+    }
+    for (size_t i = 0; i < signals.size(); ++i) {
+        subscription.m_indices[i] = m_table->findIndex(signals[i]);
+    }
+}
+
+void SharedStateBrokerClient::run() {
+    while (true) {
+        std::shared_ptr<SharedStateTable> table;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (m_isStopping) {
+                return;
+            }
+            if (m_table && m_table->isClosed()) {
+                logger().info("Shared state table '{}' got closed by its publisher", m_tableName);
+                m_table.reset();
+            }
+            if (!m_table) {
+                openTable();
+            }
+            if (!m_table) {
+                if (m_stopCondition.wait_for(lock, OPEN_RETRY_INTERVAL,
+                                             [this]() { return m_isStopping; })) {
+                    return;
+                }
+                continue;
+            }
+            table = m_table;
+        }
+
+        // read before delivering, so changes published meanwhile end the wait right away
+        const auto changeCount = table->getChangeCount();
+        deliver(*table);
+        table->waitForChange(changeCount, POLL_INTERVAL);
+    }
+}
+
+void SharedStateBrokerClient::deliver(const SharedStateTable& table) {
+    std::vector<std::pair<AsyncSubscriptionPtr_t<DataPointReply>, DataPointReply>> deliveries;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_subscriptions.erase(std::remove_if(m_subscriptions.begin(), m_subscriptions.end(),
+                                             [](const auto& subscription) {
+                                                 return subscription.m_subscription->isCancelled();
+                                             }),
+                              m_subscriptions.end());
+
+        for (auto& subscription : m_subscriptions) {
+            DataPointReply changes;
+            for (size_t i = 0; i < subscription.m_signals.size(); ++i) {
+                const auto& index = subscription.m_indices[i];
+                if (!index) {
+                    continue;
+                }
+                const auto& slot = table.getSlot(*index);
+                if (slot.getNumUpdates() == subscription.m_numSeenUpdates[i]) {
+                    continue;
+                }
+                // a slot abandoned by a publisher that died while writing it is retried with
+                // the next change, until the restarted publisher closes the table
+                auto reading = table.readSlot(*index);
+                if (!reading) {
+                    continue;
+                }
+                subscription.m_numSeenUpdates[i] = reading->numUpdates;
+                ++m_numReadDataPoints;
+                const auto signal = subscription.m_signals[i];
+                if (subscription.m_isFiltering &&
+                    !subscription.m_filters[signal].accept(subscription.m_options,
+                                                           reading->sample, reading->receivedAt)) {
+                    continue;
+                }
+                changes.set(signal, std::move(reading->sample));
+            }
+            if (changes.empty()) {
+                continue;
+            }
+            std::lock_guard<std::mutex> stateLock(subscription.m_state->m_mutex);
+            auto&                       state = subscription.m_state->m_dataPoints;
+            for (const auto& entry : changes) {
+                state.set(entry.m_handle, DataPointReply::getSample(entry));
+            }
+            deliveries.emplace_back(subscription.m_subscription,
+                                    subscription.m_options.m_mode == SubscriptionMode::DELTA_ONLY
+                                        ? std::move(changes)
+                                        : DataPointReply(state));
+        }
+    }
+    // outside of the lock, as callbacks invoked inline may call this client
+    for (auto& [subscription, reply] : deliveries) {
+        subscription->insertNewItem(std::move(reply));
+    }
+}
+
+} // namespace velocitas
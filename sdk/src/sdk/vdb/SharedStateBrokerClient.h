@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_SHAREDSTATEBROKERCLIENT_H
+#define VEHICLE_APP_SDK_VDB_SHAREDSTATEBROKERCLIENT_H
+
+#include "sdk/SignalPathRegistry.h"
+#include "sdk/vdb/IVehicleDataBrokerClient.h"
+#include "sdk/vdb/SignalUpdateFilter.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace velocitas {
+
+class SharedStateTable;
+
+/**
+ * @brief VehicleDataBrokerClient reading the signals of a shared state table, see
+ * IVehicleDataBrokerClient::createSharedState.
+ *
+ * Requests and subscriptions of signals not all contained in the table, queries with WHERE
+ * clauses and set requests are forwarded to the fallback client. A single thread waits for the
+ * publisher to announce changes and hands the changed slots to the subscriptions of their
+ * signals, after applying their SubscriptionOptions. If the table is closed or does not exist
+ * yet, it is (re)opened once the publisher creates it.
+ */
+class SharedStateBrokerClient : public IVehicleDataBrokerClient {
+public:
+    SharedStateBrokerClient(std::string                               tableName,
+                            std::shared_ptr<IVehicleDataBrokerClient> fallback);
+
+    ~SharedStateBrokerClient() override;
+
+    SharedStateBrokerClient(const SharedStateBrokerClient&)            = delete;
+    SharedStateBrokerClient(SharedStateBrokerClient&&)                 = delete;
+    SharedStateBrokerClient& operator=(const SharedStateBrokerClient&) = delete;
+    SharedStateBrokerClient& operator=(SharedStateBrokerClient&&)      = delete;
+
+    AsyncResultPtr_t<DataPointReply>
+    getDatapoints(const std::vector<std::string>& datapoints) override;
+
+    AsyncResultPtr_t<SetErrorMap_t>
+    setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints) override;
+
+    AsyncResultPtr_t<SetErrorMap_t>
+    setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints,
+                  SetMode                                             mode) override;
+
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string& query) override;
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string& query,
+                                                     SubscriptionMode   mode) override;
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string&         query,
+                                                     const SubscriptionOptions& options) override;
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const Query&               query,
+                                                     const SubscriptionOptions& options) override;
+
+    bool updateSubscription(const AsyncSubscriptionPtr_t<DataPointReply>& subscription,
+                            const std::vector<std::string>&               addedSignals,
+                            const std::vector<std::string>&               removedSignals) override;
+
+    AsyncResultPtr_t<Status> prepare(const std::vector<std::string>& signalPaths,
+                                     std::chrono::milliseconds       timeout) override;
+
+    AsyncResultPtr_t<Status> whenReady() override;
+
+    std::shared_ptr<IPreparedSet> prepareSet(const std::vector<std::string>& signalPaths) override;
+
+    size_t cancelPendingRequests() override;
+
+    void setExecutor(ExecutorPtr_t executor) override;
+
+    /**
+     * @brief Get the number of data points read from the table, by requests and subscriptions.
+     */
+    [[nodiscard]] uint64_t getNumReadDataPoints() const { return m_numReadDataPoints; }
+
+private:
+    // the delivered data points of a subscription, for its snapshots
+    struct SubscriptionState {
+        std::mutex     m_mutex;
+        DataPointReply m_dataPoints;
+    };
+
+    struct Subscription {
+        AsyncSubscriptionPtr_t<DataPointReply>                 m_subscription;
+        std::vector<SignalHandle_t>                            m_signals;
+        // slot index and number of updates last seen of each signal, in order of m_signals
+        std::vector<std::optional<size_t>>                     m_indices;
+        std::vector<uint64_t>                                  m_numSeenUpdates;
+        SubscriptionOptions                                    m_options;
+        bool                                                   m_isFiltering{false};
+        std::unordered_map<SignalHandle_t, SignalUpdateFilter> m_filters;
+        std::shared_ptr<SubscriptionState>                     m_state;
+    };
+
+    // the opened table, nullptr if there is none (yet)
+    std::shared_ptr<SharedStateTable> getTable();
+
+    [[nodiscard]] bool isServedLocally(const std::shared_ptr<SharedStateTable>& table,
+                                       const std::vector<SignalHandle_t>&       signals) const;
+
+    AsyncSubscriptionPtr_t<DataPointReply> addSubscription(std::vector<SignalHandle_t> signals,
+                                                           const SubscriptionOptions&  options);
+
+    // need to be called with m_mutex being locked
+    void openTable();
+    void mapSignals(Subscription& subscription) const;
+
+    void run();
+    void deliver(const SharedStateTable& table);
+
+    const std::string                         m_tableName;
+    std::shared_ptr<IVehicleDataBrokerClient> m_fallback;
+
+    std::mutex                        m_mutex;
+    std::condition_variable           m_stopCondition;
+    bool                              m_isStopping{false};
+    std::shared_ptr<SharedStateTable> m_table;
+    std::vector<Subscription>         m_subscriptions;
+    std::atomic<uint64_t>             m_numReadDataPoints{0};
+    std::thread                       m_thread;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_SHAREDSTATEBROKERCLIENT_H
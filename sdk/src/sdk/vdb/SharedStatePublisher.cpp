@@ -0,0 +1,53 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/SharedStatePublisher.h"
+
+#include "sdk/DataPointReply.h"
+#include "sdk/Logger.h"
+#include "sdk/vdb/SharedStateTable.h"
+
+namespace velocitas {
+
+SharedStatePublisher::SharedStatePublisher(const std::string&              tableName,
+                                           const std::vector<std::string>& signalPaths)
+    : m_table(SharedStateTable::create(tableName, signalPaths)) {
+    logger().info("Publishing {} signals to shared state table '{}'", signalPaths.size(),
+                  tableName);
+}
+
+SharedStatePublisher::~SharedStatePublisher() = default;
+
+void SharedStatePublisher::publish(const DataPointReply& reply) {
+    const auto receivedAt = SampleSlot::Clock_t::now();
+    bool       isChanged  = false;
+
+    // a single writer per slot, as sequence locks expect
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& entry : reply) {
+        const auto index = m_table->findIndex(entry.m_handle);
+        if (index) {
+            isChanged |= m_table->getSlot(*index).write(DataPointReply::getSample(entry),
+                                                        receivedAt);
+        }
+    }
+    if (isChanged) {
+        m_table->notifyChange();
+        ++m_numPublishedUpdates;
+    }
+}
+
+} // namespace velocitas
@@ -0,0 +1,256 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "SharedStateTable.h"
+
+#include "sdk/Exceptions.h"
+
+#include <fmt/core.h>
+
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <ctime>
+#include <new>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace velocitas {
+
+namespace {
+
+// attempts to read a locked slot between checks whether its publisher is gone
+constexpr uint32_t SLOT_READ_ATTEMPTS = 64;
+
+// time after which a slot still locked is considered abandoned, i.e. its publisher died while
+// writing it
+constexpr std::chrono::milliseconds SLOT_READ_TIMEOUT{10};
+
+std::runtime_error systemError(const std::string& what, const std::string& name) {
+    return std::runtime_error(
+        fmt::format("Shared state table: {} '{}' failed: {}", what, name, std::strerror(errno)));
+}
+
+// not private futex operations, as the word is shared between processes
+long futex(const std::atomic<uint32_t>& word, int operation, uint32_t value,
+           const struct timespec* timeout) {
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+    return ::syscall(SYS_futex, reinterpret_cast<const uint32_t*>(&word), operation, value,
+                     timeout, nullptr, 0);
+}
+
+// closes a table left behind by a publisher, so readers still mapping it open the new one
+void closeExisting(const std::string& name) {
+    const int fd = ::shm_open(name.c_str(), O_RDWR | O_CLOEXEC, 0);
+    if (fd < 0) {
+        return;
+    }
+    struct stat objectStat {};
+    if (::fstat(fd, &objectStat) == 0 &&
+        static_cast<size_t>(objectStat.st_size) >= sizeof(shared_state::TableHeader)) {
+        void* mapping = ::mmap(nullptr, sizeof(shared_state::TableHeader), PROT_READ | PROT_WRITE,
+                               MAP_SHARED, fd, 0);
+        if (mapping != MAP_FAILED) {
+            auto* header = static_cast<shared_state::TableHeader*>(mapping);
+            header->m_isClosed.store(1, std::memory_order_release);
+            header->m_changeCount.fetch_add(1, std::memory_order_release);
+            futex(header->m_changeCount, FUTEX_WAKE, INT_MAX, nullptr);
+            ::munmap(mapping, sizeof(shared_state::TableHeader));
+        }
+    }
+    ::close(fd);
+    ::shm_unlink(name.c_str());
+}
+
+} // namespace
+
+std::unique_ptr<SharedStateTable>
+SharedStateTable::create(const std::string& name, const std::vector<std::string>& signalPaths) {
+    for (const auto& path : signalPaths) {
+        if (path.size() >= shared_state::MAX_PATH_LENGTH) {
+            throw InvalidValueException(
+                fmt::format("Shared state table: path '{}' exceeds the maximum length", path));
+        }
+    }
+    closeExisting(name);
+
+    const int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        throw systemError("Creating", name);
+    }
+    const auto size = getSize(signalPaths.size());
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        ::close(fd);
+        ::shm_unlink(name.c_str());
+        throw systemError("Sizing", name);
+    }
+    std::unique_ptr<SharedStateTable> table(new SharedStateTable(name, fd, size, true));
+    table->map();
+    auto* header = new (table->m_mapping) shared_state::TableHeader{};
+
+    header->m_version    = shared_state::VERSION;
+    header->m_numSignals = static_cast<uint32_t>(signalPaths.size());
+    auto* slots          = reinterpret_cast<SampleSlot*>(header + 1);
+    auto* paths          = reinterpret_cast<char*>(slots + signalPaths.size());
+    for (size_t i = 0; i < signalPaths.size(); ++i) {
+        new (&slots[i]) SampleSlot();
+        std::memcpy(paths + i * shared_state::MAX_PATH_LENGTH, signalPaths[i].data(),
+                    signalPaths[i].size());
+    }
+    header->m_magic.store(shared_state::MAGIC, std::memory_order_release);
+    table->attach();
+    return table;
+}
+
+std::unique_ptr<SharedStateTable> SharedStateTable::open(const std::string& name) {
+    const int fd = ::shm_open(name.c_str(), O_RDWR | O_CLOEXEC, 0);
+    if (fd < 0) {
+        throw systemError("Opening", name);
+    }
+    struct stat objectStat {};
+    if (::fstat(fd, &objectStat) != 0) {
+        ::close(fd);
+        throw systemError("Reading the size of", name);
+    }
+    const auto size = static_cast<size_t>(objectStat.st_size);
+    if (size < sizeof(shared_state::TableHeader)) {
+        ::close(fd);
+        throw std::runtime_error(
+            fmt::format("Shared state table: '{}' is not initialized yet", name));
+    }
+    std::unique_ptr<SharedStateTable> table(new SharedStateTable(name, fd, size, false));
+    table->map();
+    table->attach();
+    return table;
+}
+
+SharedStateTable::SharedStateTable(std::string name, int fd, size_t size, bool isOwner)
+    : m_name(std::move(name))
+    , m_fd(fd)
+    , m_size(size)
+    , m_isOwner(isOwner) {}
+
+SharedStateTable::~SharedStateTable() {
+    if (m_mapping != nullptr) {
+        if (m_isOwner) {
+            m_header->m_isClosed.store(1, std::memory_order_release);
+            notifyChange();
+        }
+        ::munmap(m_mapping, m_size);
+    }
+    ::close(m_fd);
+    if (m_isOwner) {
+        ::shm_unlink(m_name.c_str());
+    }
+}
+
+void SharedStateTable::map() {
+    void* mapping = ::mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (mapping == MAP_FAILED) {
+        throw systemError("Mapping", m_name);
+    }
+    m_mapping = mapping;
+    m_header  = static_cast<shared_state::TableHeader*>(mapping);
+}
+
+void SharedStateTable::attach() {
+    if (m_header->m_magic.load(std::memory_order_acquire) != shared_state::MAGIC ||
+        m_header->m_version != shared_state::VERSION ||
+        getSize(m_header->m_numSignals) != m_size) {
+        throw std::runtime_error(
+            fmt::format("Shared state table: '{}' is no initialized table of version {}", m_name,
+                        shared_state::VERSION));
+    }
+    m_numSignals   = m_header->m_numSignals;
+    m_slots        = reinterpret_cast<SampleSlot*>(m_header + 1);
+    m_paths        = reinterpret_cast<const char*>(m_slots + m_numSignals);
+    auto& registry = SignalPathRegistry::getInstance();
+    m_indices.reserve(m_numSignals);
+    for (size_t i = 0; i < m_numSignals; ++i) {
+        m_indices.emplace(registry.intern(getPath(i)), i);
+    }
+}
+
+size_t SharedStateTable::getSize(size_t numSignals) {
+    return sizeof(shared_state::TableHeader) +
+           numSignals * (sizeof(SampleSlot) + shared_state::MAX_PATH_LENGTH);
+}
+
+std::string_view SharedStateTable::getPath(size_t index) const {
+    const auto* path = m_paths + index * shared_state::MAX_PATH_LENGTH;
+    return {path, ::strnlen(path, shared_state::MAX_PATH_LENGTH)};
+}
+
+std::optional<size_t> SharedStateTable::findIndex(SignalHandle_t signal) const {
+    const auto iter = m_indices.find(signal);
+    if (iter == m_indices.end()) {
+        return std::nullopt;
+    }
+    return iter->second;
+}
+
+std::optional<SampleSlot::Reading> SharedStateTable::readSlot(size_t index) const {
+    const auto deadline = std::chrono::steady_clock::now() + SLOT_READ_TIMEOUT;
+    for (;;) {
+        if (auto reading = m_slots[index].tryRead(SLOT_READ_ATTEMPTS)) {
+            return reading;
+        }
+        if (isClosed() || std::chrono::steady_clock::now() >= deadline) {
+            return std::nullopt;
+        }
+    }
+}
+
+uint32_t SharedStateTable::getChangeCount() const {
+    return m_header->m_changeCount.load(std::memory_order_acquire);
+}
+
+void SharedStateTable::notifyChange() {
+    // sequentially consistent, so either the publisher sees the waiter or the waiter the change
+    m_header->m_changeCount.fetch_add(1);
+    if (m_header->m_numWaiters.load() > 0) {
+        wake();
+    }
+}
+
+void SharedStateTable::waitForChange(uint32_t changeCount,
+                                     std::chrono::milliseconds timeout) const {
+    const auto      seconds     = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+    const auto      nanoseconds = std::chrono::nanoseconds(timeout - seconds);
+    struct timespec relativeTimeout {};
+    relativeTimeout.tv_sec  = static_cast<time_t>(seconds.count());
+    relativeTimeout.tv_nsec = static_cast<long>(nanoseconds.count());
+    m_header->m_numWaiters.fetch_add(1);
+    // returns right away if the count differs already
+    futex(m_header->m_changeCount, FUTEX_WAIT, changeCount, &relativeTimeout);
+    m_header->m_numWaiters.fetch_sub(1);
+}
+
+void SharedStateTable::wake() const {
+    futex(m_header->m_changeCount, FUTEX_WAKE, INT_MAX, nullptr);
+}
+
+bool SharedStateTable::isClosed() const {
+    return m_header->m_isClosed.load(std::memory_order_acquire) != 0;
+}
+
+} // namespace velocitas
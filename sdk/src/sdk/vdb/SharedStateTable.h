@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_SHAREDSTATETABLE_H
+#define VEHICLE_APP_SDK_VDB_SHAREDSTATETABLE_H
+
+#include "sdk/SampleSlot.h"
+#include "sdk/SignalPathRegistry.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Layout of the POSIX shared memory object of a shared state table, written by a single
+ * SharedStatePublisher and read by any number of processes. All numbers are stored in host byte
+ * order, as the table is only shared on one host.
+ *
+ *   table  := TableHeader SampleSlot[numSignals] path[numSignals]
+ *   path   := char[MAX_PATH_LENGTH], zero terminated
+ *
+ * The publisher stores the magic number last, so readers never see a partially initialized
+ * table. The change count is incremented after each batch of written slots; readers wait for it
+ * to change via a futex.
+ */
+namespace velocitas::shared_state {
+
+constexpr uint64_t MAGIC           = 0x3130455441545344; // "DSTATE01"
+constexpr uint32_t VERSION         = 1;
+constexpr size_t   MAX_PATH_LENGTH = 256;
+
+struct alignas(64) TableHeader {
+    std::atomic<uint64_t> m_magic;
+    uint32_t              m_version;
+    uint32_t              m_numSignals;
+    // futex word, incremented after each batch of written slots
+    std::atomic<uint32_t> m_changeCount;
+    // number of readers waiting for a change, so the publisher only wakes if there are any
+    std::atomic<uint32_t> m_numWaiters;
+    // set when the publisher closes the table, e.g. before being restarted
+    std::atomic<uint32_t> m_isClosed;
+};
+
+} // namespace velocitas::shared_state
+
+namespace velocitas {
+
+/**
+ * @brief Mapping of a shared state table, see shared_state above.
+ */
+class SharedStateTable final {
+public:
+    /**
+     * @brief Create the table of the given signals, replacing an existing one of the same name.
+     * The table is closed and removed when the returned object is destroyed.
+     *
+     * @param name         Name of the shared memory object, e.g. "/vehicle-state".
+     * @param signalPaths  The signals of the table.
+     * @throw std::runtime_error if the table cannot be created.
+     */
+    static std::unique_ptr<SharedStateTable> create(const std::string&              name,
+                                                    const std::vector<std::string>& signalPaths);
+
+    /**
+     * @brief Open an existing table for reading.
+     *
+     * @throw std::runtime_error if there is no completely initialized table of the given name.
+     */
+    static std::unique_ptr<SharedStateTable> open(const std::string& name);
+
+    ~SharedStateTable();
+
+    SharedStateTable(const SharedStateTable&)            = delete;
+    SharedStateTable(SharedStateTable&&)                 = delete;
+    SharedStateTable& operator=(const SharedStateTable&) = delete;
+    SharedStateTable& operator=(SharedStateTable&&)      = delete;
+
+    [[nodiscard]] const std::string& getName() const { return m_name; }
+    [[nodiscard]] size_t             getNumSignals() const { return m_numSignals; }
+    [[nodiscard]] std::string_view   getPath(size_t index) const;
+
+    /**
+     * @brief Get the index of the slot of a signal.
+     *
+     * @return std::nullopt if the signal is not part of the table.
+     */
+    [[nodiscard]] std::optional<size_t> findIndex(SignalHandle_t signal) const;
+
+    [[nodiscard]] SampleSlot&       getSlot(size_t index) { return m_slots[index]; }
+    [[nodiscard]] const SampleSlot& getSlot(size_t index) const { return m_slots[index]; }
+
+    /**
+     * @brief Read a slot, unless the publisher died while writing it.
+     *
+     * A slot stays locked forever if its publisher dies in the middle of a write. As a write takes
+     * nanoseconds, a reader spins a bounded number of attempts at a time and gives up once the
+     * table got closed (e.g. by the restarted publisher) or the slot stayed locked for a few
+     * milliseconds; callers then treat the signal as not served by the table.
+     *
+     * @return std::nullopt if the slot could not be read.
+     */
+    [[nodiscard]] std::optional<SampleSlot::Reading> readSlot(size_t index) const;
+
+    [[nodiscard]] uint32_t getChangeCount() const;
+
+    /**
+     * @brief Announce the slots written since the last call to waiting readers.
+     */
+    void notifyChange();
+
+    /**
+     * @brief Wait until the change count differs from the given one, the timeout expired or
+     *        wake() got called.
+     */
+    void waitForChange(uint32_t changeCount, std::chrono::milliseconds timeout) const;
+
+    /**
+     * @brief Wake all readers waiting for a change, also ones of other processes.
+     */
+    void wake() const;
+
+    /**
+     * @brief Check if the publisher closed the table.
+     */
+    [[nodiscard]] bool isClosed() const;
+
+private:
+    SharedStateTable(std::string name, int fd, size_t size, bool isOwner);
+
+    static size_t getSize(size_t numSignals);
+    void          map();
+    // validates the mapped table and indexes its signals
+    void          attach();
+
+    const std::string                          m_name;
+    const int                                  m_fd;
+    const size_t                               m_size;
+    const bool                                 m_isOwner;
+    void*                                      m_mapping{nullptr};
+    shared_state::TableHeader*                 m_header{nullptr};
+    SampleSlot*                                m_slots{nullptr};
+    const char*                                m_paths{nullptr};
+    size_t                                     m_numSignals{0};
+    std::unordered_map<SignalHandle_t, size_t> m_indices;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_SHAREDSTATETABLE_H
@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/SignalRecorder.h"
+
+#include "sdk/DataPointReply.h"
+#include "sdk/Logger.h"
+#include "sdk/vdb/SignalRecording.h"
+
+#include <fmt/core.h>
+
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace velocitas {
+
+namespace {
+
+constexpr uint32_t NO_PATH_ID = std::numeric_limits<uint32_t>::max();
+
+template <typename T> void append(std::vector<uint8_t>& buffer, const T& scalar) {
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&scalar);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+} // namespace
+
+SignalRecorder::SignalRecorder(const std::string& path)
+    : m_file(std::fopen(path.c_str(), "wb")) {
+    if (m_file == nullptr) {
+        throw std::runtime_error(fmt::format("Signal recording: Creating '{}' failed: {}", path,
+                                             std::strerror(errno)));
+    }
+    const auto startTime = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch());
+    const recording::FileHeader header{recording::MAGIC, recording::VERSION, 0,
+                                       static_cast<int64_t>(startTime.count())};
+    std::fwrite(&header, sizeof(header), 1, m_file);
+}
+
+SignalRecorder::~SignalRecorder() { std::fclose(m_file); }
+
+void SignalRecorder::record(const DataPointReply& reply) {
+    const auto offset = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - m_start);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_payload.clear();
+    append(m_payload, static_cast<int64_t>(offset.count()));
+    append(m_payload, static_cast<uint32_t>(reply.size()));
+    for (const auto& entry : reply) {
+        recording::encodeEntry(getPathId(entry.m_handle), DataPointReply::getSample(entry),
+                               m_payload);
+    }
+    writeRecord(static_cast<uint32_t>(recording::RecordKind::UPDATE), m_payload);
+    ++m_numUpdates;
+}
+
+void SignalRecorder::flush() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::fflush(m_file);
+}
+
+uint64_t SignalRecorder::getNumRecordedUpdates() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_numUpdates;
+}
+
+uint32_t SignalRecorder::getPathId(SignalHandle_t handle) {
+    if (handle >= m_pathIds.size()) {
+        m_pathIds.resize(handle + 1, NO_PATH_ID);
+    }
+    if (m_pathIds[handle] == NO_PATH_ID) {
+        const auto&          path = SignalPathRegistry::getInstance().getPath(handle);
+        std::vector<uint8_t> payload;
+        payload.reserve(sizeof(uint32_t) + path.size());
+        append(payload, m_nextPathId);
+        payload.insert(payload.end(), path.begin(), path.end());
+        writeRecord(static_cast<uint32_t>(recording::RecordKind::PATH), payload);
+        m_pathIds[handle] = m_nextPathId++;
+    }
+    return m_pathIds[handle];
+}
+
+void SignalRecorder::writeRecord(uint32_t kind, const std::vector<uint8_t>& payload) {
+    const recording::RecordHeader header{kind, static_cast<uint32_t>(payload.size())};
+    if (std::fwrite(&header, sizeof(header), 1, m_file) != 1 ||
+        std::fwrite(payload.data(), 1, payload.size(), m_file) != payload.size()) {
+        logger().error("Signal recording: Writing a record failed: {}", std::strerror(errno));
+    }
+}
+
+} // namespace velocitas
@@ -0,0 +1,339 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "SignalRecording.h"
+
+#include <fmt/core.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <variant>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace velocitas {
+
+namespace recording {
+
+namespace {
+
+void append(std::vector<uint8_t>& buffer, const std::string& string);
+
+template <typename T> void append(std::vector<uint8_t>& buffer, const T& scalar) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&scalar);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+void append(std::vector<uint8_t>& buffer, const std::string& string) {
+    append(buffer, static_cast<uint32_t>(string.size()));
+    buffer.insert(buffer.end(), string.begin(), string.end());
+}
+
+template <typename T> void append(std::vector<uint8_t>& buffer, const std::vector<T>& array) {
+    append(buffer, static_cast<uint32_t>(array.size()));
+    if constexpr (std::is_same_v<T, bool>) {
+        for (const bool element : array) {
+            append(buffer, static_cast<uint8_t>(element));
+        }
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        for (const auto& element : array) {
+            append(buffer, element);
+        }
+    } else {
+        const auto* bytes = reinterpret_cast<const uint8_t*>(array.data());
+        buffer.insert(buffer.end(), bytes, bytes + array.size() * sizeof(T));
+    }
+}
+
+} // namespace
+
+void encodeEntry(uint32_t pathId, const DataPointSample& sample, std::vector<uint8_t>& buffer) {
+    const bool hasValue =
+        sample.isValid() && !std::holds_alternative<std::monostate>(sample.getVariant());
+    append(buffer, pathId);
+    if (!hasValue) {
+        // a valid sample without value (which should not occur) is recorded as not available
+        const auto failure =
+            sample.isValid() ? DataPointValue::Failure::NOT_AVAILABLE : sample.getFailure();
+        append(buffer, static_cast<uint8_t>(sample.getType()));
+        append(buffer, static_cast<uint8_t>(failure));
+        append(buffer, sample.getTimestamp().seconds);
+        append(buffer, sample.getTimestamp().nanos);
+        return;
+    }
+    std::visit(
+        [&buffer, &sample](const auto& value) {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (!std::is_same_v<T, std::monostate>) {
+                // the type of the value held, which may be wider than the one of the signal
+                append(buffer, static_cast<uint8_t>(getValueType<T>()));
+                append(buffer, static_cast<uint8_t>(DataPointValue::Failure::NONE));
+                append(buffer, sample.getTimestamp().seconds);
+                append(buffer, sample.getTimestamp().nanos);
+                if constexpr (std::is_same_v<T, bool>) {
+                    append(buffer, static_cast<uint8_t>(value));
+                } else {
+                    append(buffer, value);
+                }
+            }
+        },
+        sample.getVariant());
+}
+
+/**
+ * @brief Bounds checked reading of the mapped bytes, without copying strings or arrays which are
+ * skipped.
+ */
+class ByteReader {
+public:
+    struct Corrupt {};
+
+    ByteReader(const uint8_t* position, const uint8_t* end)
+        : m_position(position)
+        , m_end(end) {}
+
+    template <typename T> T read() {
+        if constexpr (std::is_same_v<T, bool>) {
+            return read<uint8_t>() != 0;
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            const auto  size  = read<uint32_t>();
+            const auto* bytes = consume(size);
+            return std::string(reinterpret_cast<const char*>(bytes), size);
+        } else if constexpr (std::is_arithmetic_v<T>) {
+            T value;
+            std::memcpy(&value, consume(sizeof(T)), sizeof(T));
+            return value;
+        } else {
+            using Element_t  = typename T::value_type;
+            const auto count = read<uint32_t>();
+            T          array;
+            if constexpr (std::is_same_v<Element_t, bool> ||
+                          std::is_same_v<Element_t, std::string>) {
+                array.reserve(count);
+                for (uint32_t i = 0; i < count; ++i) {
+                    array.push_back(read<Element_t>());
+                }
+            } else {
+                const auto* bytes = consume(size_t{count} * sizeof(Element_t));
+                array.resize(count);
+                std::memcpy(array.data(), bytes, size_t{count} * sizeof(Element_t));
+            }
+            return array;
+        }
+    }
+
+    template <typename T> void skip() {
+        if constexpr (std::is_same_v<T, bool>) {
+            consume(1);
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            consume(read<uint32_t>());
+        } else if constexpr (std::is_arithmetic_v<T>) {
+            consume(sizeof(T));
+        } else {
+            using Element_t  = typename T::value_type;
+            const auto count = read<uint32_t>();
+            if constexpr (std::is_same_v<Element_t, std::string>) {
+                for (uint32_t i = 0; i < count; ++i) {
+                    skip<Element_t>();
+                }
+            } else {
+                consume(size_t{count} * (std::is_same_v<Element_t, bool> ? 1 : sizeof(Element_t)));
+            }
+        }
+    }
+
+    [[nodiscard]] const uint8_t* getPosition() const { return m_position; }
+
+private:
+    const uint8_t* consume(size_t size) {
+        if (static_cast<size_t>(m_end - m_position) < size) {
+            throw Corrupt{};
+        }
+        const auto* bytes = m_position;
+        m_position += size;
+        return bytes;
+    }
+
+    const uint8_t* m_position;
+    const uint8_t* m_end;
+};
+
+} // namespace recording
+
+namespace {
+
+using recording::ByteReader;
+using recording::FileHeader;
+using recording::RecordHeader;
+using recording::RecordKind;
+
+/**
+ * @brief Read (or skip) the value of the variant alternative the type refers to.
+ */
+template <size_t I = 1>
+DataPointSample readValue([[maybe_unused]] ByteReader& reader, DataPointValue::Type type,
+                          [[maybe_unused]] Timestamp timestamp, [[maybe_unused]] bool isWanted) {
+    if constexpr (I == std::variant_size_v<DataPointVariant_t>) {
+        static_cast<void>(type);
+        throw ByteReader::Corrupt{}; // unknown value type
+    } else {
+        using T = std::variant_alternative_t<I, DataPointVariant_t>;
+        if (getValueType<T>() != type) {
+            return readValue<I + 1>(reader, type, timestamp, isWanted);
+        }
+        if (!isWanted) {
+            reader.skip<T>();
+            return DataPointSample();
+        }
+        return DataPointSample(reader.read<T>(), timestamp);
+    }
+}
+
+std::runtime_error systemError(const std::string& what, const std::string& path) {
+    return std::runtime_error(
+        fmt::format("Signal recording: {} '{}' failed: {}", what, path, std::strerror(errno)));
+}
+
+} // namespace
+
+SignalRecordingReader::SignalRecordingReader(const std::string& path) {
+    static_assert(sizeof(FileHeader) == 24, "File header is part of the file format");
+
+    m_fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (m_fd < 0) {
+        throw systemError("Opening", path);
+    }
+    struct stat fileStat {};
+    if (::fstat(m_fd, &fileStat) != 0) {
+        ::close(m_fd);
+        throw systemError("Reading the size of", path);
+    }
+    m_fileSize = static_cast<size_t>(fileStat.st_size);
+    if (m_fileSize < sizeof(FileHeader)) {
+        ::close(m_fd);
+        throw std::runtime_error(fmt::format("Signal recording: '{}' is no recording", path));
+    }
+    void* mapping = ::mmap(nullptr, m_fileSize, PROT_READ, MAP_PRIVATE, m_fd, 0);
+    if (mapping == MAP_FAILED) {
+        ::close(m_fd);
+        throw systemError("Mapping", path);
+    }
+    // the pages are read once, in order
+    ::madvise(mapping, m_fileSize, MADV_SEQUENTIAL);
+    m_data = static_cast<const uint8_t*>(mapping);
+
+    std::memcpy(&m_header, m_data, sizeof(m_header));
+    if (m_header.m_magic != recording::MAGIC || m_header.m_version != recording::VERSION) {
+        ::munmap(mapping, m_fileSize);
+        ::close(m_fd);
+        throw std::runtime_error(fmt::format(
+            "Signal recording: '{}' is no recording of version {} written in this byte order",
+            path, recording::VERSION));
+    }
+    m_position = sizeof(FileHeader);
+}
+
+SignalRecordingReader::~SignalRecordingReader() {
+    ::munmap(const_cast<uint8_t*>(m_data), m_fileSize);
+    ::close(m_fd);
+}
+
+std::optional<SignalRecordingReader::Update>
+SignalRecordingReader::next(const std::vector<bool>* wantedSignals) {
+    while (m_fileSize - m_position >= sizeof(RecordHeader)) {
+        RecordHeader record{};
+        std::memcpy(&record, m_data + m_position, sizeof(record));
+        const size_t payloadOffset = m_position + sizeof(record);
+        if (m_fileSize - payloadOffset < record.m_size) {
+            break;
+        }
+        m_position = payloadOffset + record.m_size;
+
+        const auto* payload = m_data + payloadOffset;
+        if (record.m_kind == static_cast<uint32_t>(RecordKind::PATH)) {
+            readPath(payload, record.m_size);
+            continue;
+        }
+        if (record.m_kind != static_cast<uint32_t>(RecordKind::UPDATE)) {
+            continue;
+        }
+
+        try {
+            ByteReader reader(payload, payload + record.m_size);
+            Update     update;
+            update.m_offset       = std::chrono::nanoseconds{reader.read<int64_t>()};
+            const auto numEntries = reader.read<uint32_t>();
+            for (uint32_t i = 0; i < numEntries; ++i) {
+                readEntry(reader, wantedSignals, update.m_dataPoints);
+            }
+            if (!update.m_dataPoints.empty()) {
+                return update;
+            }
+        } catch (const ByteReader::Corrupt&) {
+            // a corrupt record; its size still leads to the next one
+        }
+    }
+    return std::nullopt;
+}
+
+void SignalRecordingReader::rewind() { m_position = sizeof(FileHeader); }
+
+void SignalRecordingReader::readPath(const uint8_t* payload, size_t size) {
+    if (size < sizeof(uint32_t)) {
+        return;
+    }
+    uint32_t pathId{0};
+    std::memcpy(&pathId, payload, sizeof(pathId));
+    if (pathId >= m_handles.size()) {
+        m_handles.resize(pathId + 1, INVALID_SIGNAL_HANDLE);
+    }
+    m_handles[pathId] = SignalPathRegistry::getInstance().intern(
+        std::string_view(reinterpret_cast<const char*>(payload + sizeof(pathId)),
+                         size - sizeof(pathId)));
+}
+
+void SignalRecordingReader::readEntry(ByteReader& reader, const std::vector<bool>* wantedSignals,
+                                      DataPointReply& dataPoints) const {
+    const auto pathId  = reader.read<uint32_t>();
+    const auto type    = static_cast<DataPointValue::Type>(reader.read<uint8_t>());
+    const auto failure = static_cast<DataPointValue::Failure>(reader.read<uint8_t>());
+    Timestamp  timestamp;
+    timestamp.seconds = reader.read<int64_t>();
+    timestamp.nanos   = reader.read<int32_t>();
+
+    const auto handle   = pathId < m_handles.size() ? m_handles[pathId] : INVALID_SIGNAL_HANDLE;
+    const bool isWanted = handle != INVALID_SIGNAL_HANDLE &&
+                          (wantedSignals == nullptr ||
+                           (handle < wantedSignals->size() && (*wantedSignals)[handle]));
+    if (failure != DataPointValue::Failure::NONE) {
+        if (isWanted) {
+            dataPoints.set(handle, DataPointSample(type, failure, timestamp));
+        }
+        return;
+    }
+    auto sample = readValue(reader, type, timestamp, isWanted);
+    if (isWanted) {
+        dataPoints.set(handle, std::move(sample));
+    }
+}
+
+} // namespace velocitas
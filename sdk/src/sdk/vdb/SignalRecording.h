@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_SIGNALRECORDING_H
+#define VEHICLE_APP_SDK_VDB_SIGNALRECORDING_H
+
+#include "sdk/DataPointReply.h"
+#include "sdk/DataPointSample.h"
+#include "sdk/SignalPathRegistry.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * File format of signal recordings, written by SignalRecorder and read by
+ * SignalRecordingReader. All numbers are stored in host byte order; the magic number tells
+ * whether a file was written with a different one.
+ *
+ *   file    := FileHeader record*
+ *   record  := RecordHeader payload (of RecordHeader::m_size bytes)
+ *   PATH    := uint32 pathId, path bytes
+ *   UPDATE  := int64 offsetNs, uint32 numEntries, entry*
+ *   entry   := uint32 pathId, uint8 type (DataPointValue::Type), uint8 failure
+ *              (DataPointValue::Failure), int64 seconds, int32 nanos, value (if valid)
+ *   value   := scalar | uint32 length, string bytes | uint32 count, element*
+ *
+ * Paths are written once, by a PATH record preceding the first update referring to them.
+ * Scalars take the size of their type (bool: 1 byte), string array elements are stored like
+ * strings. Records of unknown kind are skipped, so later versions can add kinds.
+ */
+namespace velocitas::recording {
+
+constexpr uint64_t MAGIC   = 0x3130434552564453; // "SDVREC01"
+constexpr uint32_t VERSION = 1;
+
+struct FileHeader {
+    uint64_t m_magic;
+    uint32_t m_version;
+    uint32_t m_reserved;
+    /** Wall clock time the recording was started at, in nanoseconds since the epoch */
+    int64_t m_startTimeNs;
+};
+
+enum class RecordKind : uint32_t {
+    PATH   = 1,
+    UPDATE = 2,
+};
+
+struct RecordHeader {
+    uint32_t m_kind;
+    uint32_t m_size;
+};
+
+/**
+ * @brief Append the encoded entry of a sample to the buffer.
+ */
+void encodeEntry(uint32_t pathId, const DataPointSample& sample, std::vector<uint8_t>& buffer);
+
+class ByteReader;
+
+} // namespace velocitas::recording
+
+namespace velocitas {
+
+/**
+ * @brief Sequential reader of a signal recording. The file is memory mapped instead of being
+ * read into memory, so recordings much larger than the memory can be read; entries of signals
+ * not asked for are skipped without being decoded. A truncated last record, e.g. of a recorder
+ * which did not get closed, ends the recording. Not thread-safe.
+ */
+class SignalRecordingReader final {
+public:
+    struct Update {
+        /** Time since the start of the recording the update was recorded at */
+        std::chrono::nanoseconds m_offset{0};
+        DataPointReply           m_dataPoints;
+    };
+
+    /**
+     * @brief Open and map the recording.
+     *
+     * @throw std::runtime_error if the file cannot be mapped or is no recording.
+     */
+    explicit SignalRecordingReader(const std::string& path);
+
+    ~SignalRecordingReader();
+
+    SignalRecordingReader(const SignalRecordingReader&)            = delete;
+    SignalRecordingReader(SignalRecordingReader&&)                 = delete;
+    SignalRecordingReader& operator=(const SignalRecordingReader&) = delete;
+    SignalRecordingReader& operator=(SignalRecordingReader&&)      = delete;
+
+    /**
+     * @brief Read the next update containing any of the wanted signals.
+     *
+     * @param wantedSignals  Whether to read a signal, indexed by its handle; nullptr to read
+     *                       all signals.
+     * @return std::nullopt at the end of the recording.
+     */
+    [[nodiscard]] std::optional<Update> next(const std::vector<bool>* wantedSignals = nullptr);
+
+    /**
+     * @brief Continue reading at the first update.
+     */
+    void rewind();
+
+    [[nodiscard]] int64_t getStartTimeNs() const { return m_header.m_startTimeNs; }
+    [[nodiscard]] size_t  getFileSize() const { return m_fileSize; }
+
+private:
+    void readPath(const uint8_t* payload, size_t size);
+    // adds the entry to the data points if it is wanted, otherwise skips it without decoding
+    void readEntry(recording::ByteReader& reader, const std::vector<bool>* wantedSignals,
+                   DataPointReply& dataPoints) const;
+
+    int                         m_fd{-1};
+    size_t                      m_fileSize{0};
+    const uint8_t*              m_data{nullptr};
+    size_t                      m_position{0};
+    recording::FileHeader       m_header{};
+    // handle of each path id of the file
+    std::vector<SignalHandle_t> m_handles;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_SIGNALRECORDING_H
@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "SignalUpdateFilter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <variant>
+
+namespace velocitas {
+
+namespace {
+
+/**
+ * @brief Get the value of the sample as double, if it holds a valid numeric scalar.
+ */
+std::optional<double> getNumericValue(const DataPointSample& sample) {
+    if (!sample.isValid()) {
+        return std::nullopt;
+    }
+    return std::visit(
+        [](const auto& value) -> std::optional<double> {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+                return static_cast<double>(value);
+            } else {
+                return std::nullopt;
+            }
+        },
+        sample.getVariant());
+}
+
+std::chrono::nanoseconds getMinInterval(const SubscriptionOptions& options) {
+    std::chrono::nanoseconds minInterval{options.m_minInterval};
+    if (options.m_maxRate > 0.0) {
+        const std::chrono::duration<double> rateInterval{1.0 / options.m_maxRate};
+        minInterval = std::max(minInterval,
+                               std::chrono::duration_cast<std::chrono::nanoseconds>(rateInterval));
+    }
+    return minInterval;
+}
+
+bool isWithinDeadband(const SubscriptionOptions& options, double lastValue, double value) {
+    const auto difference = std::abs(value - lastValue);
+    if (options.m_absoluteDeadband > 0.0 && difference <= options.m_absoluteDeadband) {
+        return true;
+    }
+    return options.m_relativeDeadband > 0.0 &&
+           difference <= options.m_relativeDeadband * std::abs(lastValue);
+}
+
+bool isSameValue(const DataPointSample& lhs, const DataPointSample& rhs) {
+    if (lhs.isValid() != rhs.isValid() || lhs.getType() != rhs.getType()) {
+        return false;
+    }
+    if (!lhs.isValid()) {
+        return lhs.getFailure() == rhs.getFailure();
+    }
+    // compares the alternative first, arrays and strings their size before their elements
+    return lhs.getVariant() == rhs.getVariant();
+}
+
+} // namespace
+
+bool SignalUpdateFilter::isFiltering(const SubscriptionOptions& options) {
+    return options.m_minInterval.count() > 0 || options.m_maxRate > 0.0 ||
+           options.m_absoluteDeadband > 0.0 || options.m_relativeDeadband > 0.0 ||
+           options.m_distinctUntilChanged;
+}
+
+bool SignalUpdateFilter::accept(const SubscriptionOptions& options, const DataPointSample& sample,
+                                Clock_t::time_point receivedAt) {
+    const auto value = getNumericValue(sample);
+    // changes of the validity are always delivered
+    if (m_lastDeliveredAt && sample.isValid() && m_wasValid) {
+        if ((receivedAt - *m_lastDeliveredAt) < getMinInterval(options)) {
+            return false;
+        }
+        if (value && m_lastDeliveredValue &&
+            isWithinDeadband(options, *m_lastDeliveredValue, *value)) {
+            return false;
+        }
+    }
+    if (options.m_distinctUntilChanged) {
+        if (m_lastDeliveredSample && isSameValue(*m_lastDeliveredSample, sample)) {
+            return false;
+        }
+        m_lastDeliveredSample = sample;
+    }
+    m_lastDeliveredAt    = receivedAt;
+    m_lastDeliveredValue = value;
+    m_wasValid           = sample.isValid();
+    return true;
+}
+
+} // namespace velocitas
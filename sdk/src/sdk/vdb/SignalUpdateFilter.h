@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef VEHICLE_APP_SDK_VDB_SIGNALUPDATEFILTER_H
+#define VEHICLE_APP_SDK_VDB_SIGNALUPDATEFILTER_H
+
+#include "sdk/DataPointSample.h"
+#include "sdk/vdb/IVehicleDataBrokerClient.h"
+
+#include <chrono>
+#include <optional>
+
+namespace velocitas {
+
+/**
+ * @brief Applies the limits of SubscriptionOptions to the updates of a single signal.
+ */
+class SignalUpdateFilter {
+public:
+    using Clock_t = std::chrono::steady_clock;
+
+    /**
+     * @brief Check whether the options limit the updates to deliver at all.
+     */
+    [[nodiscard]] static bool isFiltering(const SubscriptionOptions& options);
+
+    /**
+     * @brief Check whether the update is to be delivered; if so, it becomes the reference the
+     * following updates are compared against.
+     *
+     * @param options     The limits to apply.
+     * @param sample      The received update.
+     * @param receivedAt  Time the update was received at.
+     * @return true if the update is to be delivered, false if it is to be dropped.
+     */
+    bool accept(const SubscriptionOptions& options, const DataPointSample& sample,
+                Clock_t::time_point receivedAt);
+
+private:
+    std::optional<Clock_t::time_point> m_lastDeliveredAt;
+    std::optional<double>              m_lastDeliveredValue;
+    bool                               m_wasValid{false};
+    // only kept if the options ask for distinct values
+    std::optional<DataPointSample>     m_lastDeliveredSample;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_SIGNALUPDATEFILTER_H
@@ -19,7 +19,10 @@
 #include "sdk/Logger.h"
 #include "sdk/Utils.h"
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <grpc/grpc.h>
 #include <grpcpp/support/channel_arguments.h>
 #include <nlohmann/json.hpp>
 
@@ -31,8 +34,46 @@ namespace {
 constexpr char const* ENV_VAR_CHANNEL_CONFIG = "SDV_VDB_CHANNEL_CONFIG_PATH";
 
 constexpr char const* JSON_CHANNEL_ARGS_KEY = "channelArguments";
+
+constexpr int UDS_RECONNECT_BACKOFF_MS     = 100;
+constexpr int UDS_MAX_RECONNECT_BACKOFF_MS = 1000;
+
+bool isArgumentSet(const grpc::ChannelArguments& args, const char* name) {
+    const auto cArgs = args.c_channel_args();
+    for (size_t i = 0; i < cArgs.num_args; ++i) {
+        if (std::strcmp(cArgs.args[i].key, name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void setDefaultInt(grpc::ChannelArguments& args, const char* name, int value) {
+    if (!isArgumentSet(args, name)) {
+        args.SetInt(name, value);
+    }
+}
 } // namespace
 
+size_t getMaxMessageSize(const grpc::ChannelArguments& args) {
+    // negative values mean unlimited, the default limit of the databroker applies then
+    size_t     maxReceiveSize = DEFAULT_MAX_MESSAGE_SIZE;
+    size_t     maxSendSize    = DEFAULT_MAX_MESSAGE_SIZE;
+    const auto cArgs          = args.c_channel_args();
+    for (size_t i = 0; i < cArgs.num_args; ++i) {
+        const auto& arg = cArgs.args[i];
+        if (arg.type != GRPC_ARG_INTEGER || arg.value.integer < 0) {
+            continue;
+        }
+        if (std::strcmp(arg.key, GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH) == 0) {
+            maxReceiveSize = static_cast<size_t>(arg.value.integer);
+        } else if (std::strcmp(arg.key, GRPC_ARG_MAX_SEND_MESSAGE_LENGTH) == 0) {
+            maxSendSize = static_cast<size_t>(arg.value.integer);
+        }
+    }
+    return std::min(maxReceiveSize, maxSendSize);
+}
+
 grpc::ChannelArguments getChannelArguments() {
     grpc::ChannelArguments chArgs;
 
@@ -68,4 +109,14 @@ grpc::ChannelArguments getChannelArguments() {
     return chArgs;
 }
 
+void applyTransportDefaults(const std::string& address, grpc::ChannelArguments& args) {
+    if (!SimpleUrlParse(address).isUnixDomainSocket()) {
+        return;
+    }
+    setDefaultInt(args, GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS, UDS_RECONNECT_BACKOFF_MS);
+    setDefaultInt(args, GRPC_ARG_MIN_RECONNECT_BACKOFF_MS, UDS_RECONNECT_BACKOFF_MS);
+    setDefaultInt(args, GRPC_ARG_MAX_RECONNECT_BACKOFF_MS, UDS_MAX_RECONNECT_BACKOFF_MS);
+    setDefaultInt(args, GRPC_ARG_HTTP2_BDP_PROBE, 0);
+}
+
 } // namespace velocitas
@@ -17,6 +17,9 @@
 #ifndef VEHICLE_APP_SDK_VDB_GRPC_COMMON_CHANNELCONFIGURATION_H
 #define VEHICLE_APP_SDK_VDB_GRPC_COMMON_CHANNELCONFIGURATION_H
 
+#include <cstddef>
+#include <string>
+
 namespace grpc {
 class ChannelArguments;
 }
@@ -25,6 +28,24 @@ namespace velocitas {
 
 grpc::ChannelArguments getChannelArguments();
 
+/**
+ * @brief Add the defaults tuned for the transport to the passed address to the channel
+ * arguments, unless they are set already (e.g. via the channel configuration file).
+ *
+ * Channels to a Unix domain socket reach a databroker on the same host: they reconnect quickly
+ * after it was restarted and skip the bandwidth probing meant for network links.
+ */
+void applyTransportDefaults(const std::string& address, grpc::ChannelArguments& args);
+
+/** Message size limit of gRPC (and of the databroker) if none is configured */
+constexpr size_t DEFAULT_MAX_MESSAGE_SIZE = 4 * 1024 * 1024;
+
+/**
+ * @brief Get the maximum size of messages sent or received via channels created with the
+ * passed arguments, i.e. the smaller one of the configured send and receive limits.
+ */
+size_t getMaxMessageSize(const grpc::ChannelArguments& args);
+
 } // namespace velocitas
 
 #endif // VEHICLE_APP_SDK_VDB_GRPC_COMMON_CHANNELCONFIGURATION_H
@@ -0,0 +1,228 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "ChannelPool.h"
+
+#include "sdk/Logger.h"
+#include "sdk/Utils.h"
+#include "sdk/vdb/grpc/common/ChannelConfiguration.h"
+
+#include <fmt/core.h>
+#include <grpc/grpc.h>
+#include <grpcpp/channel.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/support/channel_arguments.h>
+
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+namespace velocitas {
+
+namespace {
+
+size_t getPoolSizeFromEnv() {
+    size_t size{1};
+    try {
+        auto sizeStr = getEnvVar("SDV_VDB_CHANNEL_POOL_SIZE");
+        if (!sizeStr.empty()) {
+            size = std::stoul(sizeStr);
+        }
+    } catch (...) {
+        logger().error("Invalid channel pool size specified via env var! Using default (1).");
+    }
+    if (size == 0) {
+        logger().warn("Channel pool size must be at least 1! Using default (1).");
+        size = 1;
+    }
+    return size;
+}
+
+ChannelSelection getSelectionFromEnv() {
+    const auto selectionName = StringUtils::toLower(getEnvVar("SDV_VDB_CHANNEL_POOL_SELECTION"));
+    if (selectionName == "least_loaded") {
+        return ChannelSelection::LEAST_LOADED;
+    }
+    if (!selectionName.empty() && selectionName != "round_robin") {
+        logger().warn("Unknown channel selection '{}', using round_robin", selectionName);
+    }
+    return ChannelSelection::ROUND_ROBIN;
+}
+
+/**
+ * @brief Get the channel arguments configured via file, which is parsed on first use only.
+ */
+const grpc::ChannelArguments& getConfiguredChannelArguments() {
+    static const grpc::ChannelArguments args = getChannelArguments();
+    return args;
+}
+
+std::vector<std::shared_ptr<grpc::Channel>> createChannels(const std::string& address,
+                                                           size_t             numChannels) {
+    auto args = getConfiguredChannelArguments();
+    applyTransportDefaults(address, args);
+    if (numChannels > 1) {
+        // channels to the same address share their connection unless each has its own subchannels
+        args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+    }
+
+    std::vector<std::shared_ptr<grpc::Channel>> channels;
+    channels.reserve(numChannels);
+    for (size_t i = 0; i < numChannels; ++i) {
+        channels.push_back(
+            grpc::CreateCustomChannel(address, grpc::InsecureChannelCredentials(), args));
+    }
+    return channels;
+}
+
+} // namespace
+
+ChannelPoolConfig ChannelPoolConfig::fromEnvironment() {
+    return ChannelPoolConfig{getPoolSizeFromEnv(), getSelectionFromEnv()};
+}
+
+ChannelPool::Lease::Lease(std::shared_ptr<ChannelPool> pool, size_t index)
+    : m_pool{std::move(pool)}
+    , m_index{index} {
+    m_pool->m_loads[m_index].fetch_add(1);
+}
+
+ChannelPool::Lease::~Lease() { m_pool->m_loads[m_index].fetch_sub(1); }
+
+ChannelPool::ChannelPool(std::vector<std::shared_ptr<grpc::Channel>> channels,
+                         ChannelSelection selection, size_t maxMessageSize, size_t numEndpoints)
+    : m_channels{std::move(channels)}
+    , m_loads{std::make_unique<std::atomic_size_t[]>(m_channels.size())}
+    , m_selection{selection}
+    , m_maxMessageSize{maxMessageSize}
+    , m_numEndpoints{numEndpoints}
+    , m_channelsPerEndpoint{numEndpoints > 0 ? m_channels.size() / numEndpoints : 0} {
+    if (m_channels.empty()) {
+        throw std::invalid_argument("Channel pool needs at least one channel");
+    }
+    if (m_channelsPerEndpoint == 0 || m_channels.size() % m_numEndpoints != 0) {
+        throw std::invalid_argument("Channels of a pool need to be evenly split among endpoints");
+    }
+}
+
+std::shared_ptr<ChannelPool>
+ChannelPool::create(std::vector<std::shared_ptr<grpc::Channel>> channels,
+                    ChannelSelection selection, size_t maxMessageSize, size_t numEndpoints) {
+    return std::shared_ptr<ChannelPool>(
+        new ChannelPool(std::move(channels), selection, maxMessageSize, numEndpoints));
+}
+
+std::shared_ptr<ChannelPool> ChannelPool::getShared(const std::string&       address,
+                                                    const ChannelPoolConfig& config) {
+    static std::mutex                                         mutex;
+    static std::map<std::string, std::weak_ptr<ChannelPool>> pools;
+
+    const auto key = fmt::format("{}#{}#{}", address, config.m_size,
+                                 static_cast<int>(config.m_selection));
+
+    std::lock_guard lock(mutex);
+    if (auto pool = pools[key].lock()) {
+        return pool;
+    }
+    auto endpoints = StringUtils::split(address, ',');
+    if (endpoints.empty()) {
+        endpoints.push_back(address);
+    }
+    logger().info("Creating channel pool of {} channel(s) to '{}'", config.m_size, address);
+    std::vector<std::shared_ptr<grpc::Channel>> channels;
+    channels.reserve(endpoints.size() * config.m_size);
+    for (const auto& endpoint : endpoints) {
+        auto endpointChannels = createChannels(endpoint, config.m_size);
+        channels.insert(channels.end(), endpointChannels.begin(), endpointChannels.end());
+    }
+    auto pool  = create(std::move(channels), config.m_selection,
+                        velocitas::getMaxMessageSize(getConfiguredChannelArguments()),
+                        endpoints.size());
+    pools[key] = pool;
+    return pool;
+}
+
+const std::shared_ptr<grpc::Channel>& ChannelPool::getChannel(size_t index) const {
+    return m_channels.at(index);
+}
+
+const std::shared_ptr<grpc::Channel>& ChannelPool::getPrimaryChannel() const {
+    return m_channels[getActiveEndpoint() * m_channelsPerEndpoint];
+}
+
+size_t ChannelPool::getLoad(size_t index) const {
+    if (index >= m_channels.size()) {
+        throw std::out_of_range("Channel index out of range");
+    }
+    return m_loads[index].load();
+}
+
+std::shared_ptr<ChannelPool::Lease> ChannelPool::acquire() {
+    const auto numChannels = m_channelsPerEndpoint;
+    const auto first       = getActiveEndpoint() * numChannels;
+    const auto start       = m_next.fetch_add(1) % numChannels;
+    auto       selected    = start;
+    if (m_selection == ChannelSelection::LEAST_LOADED) {
+        // start the scan at the round robin position to spread calls among equally loaded ones
+        auto minLoad = m_loads[first + selected].load();
+        for (size_t offset = 1; offset < numChannels && minLoad > 0; ++offset) {
+            const auto index = (start + offset) % numChannels;
+            const auto load  = m_loads[first + index].load();
+            if (load < minLoad) {
+                minLoad  = load;
+                selected = index;
+            }
+        }
+    }
+    return std::make_shared<Lease>(shared_from_this(), first + selected);
+}
+
+std::shared_ptr<ChannelPool::Lease> ChannelPool::acquireAlternative(size_t index) {
+    if (index >= m_channels.size()) {
+        throw std::out_of_range("Channel index out of range");
+    }
+    if (m_channels.size() == 1) {
+        return nullptr;
+    }
+    const auto endpoint = index / m_channelsPerEndpoint;
+    const auto next     = m_next.fetch_add(1);
+    size_t     selected = 0;
+    if (m_numEndpoints > 1) {
+        selected = ((endpoint + 1) % m_numEndpoints) * m_channelsPerEndpoint +
+                   next % m_channelsPerEndpoint;
+    } else {
+        // any channel but the passed one
+        selected = (index + 1 + next % (m_channelsPerEndpoint - 1)) % m_channelsPerEndpoint;
+    }
+    return std::make_shared<Lease>(shared_from_this(), selected);
+}
+
+void ChannelPool::reportUnavailable(size_t index) {
+    if (m_numEndpoints == 1 || index >= m_channels.size() ||
+        m_channels[index]->GetState(false) == GRPC_CHANNEL_READY) {
+        return;
+    }
+    auto       endpoint = index / m_channelsPerEndpoint;
+    const auto next     = (endpoint + 1) % m_numEndpoints;
+    // concurrently failing calls fail over once only
+    if (m_activeEndpoint.compare_exchange_strong(endpoint, next)) {
+        logger().warn("Endpoint #{} of channel pool not reachable, failing over to endpoint #{}",
+                      endpoint, next);
+    }
+}
+
+} // namespace velocitas
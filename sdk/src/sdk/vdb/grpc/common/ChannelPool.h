@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef VEHICLE_APP_SDK_VDB_GRPC_COMMON_CHANNELPOOL_H
+#define VEHICLE_APP_SDK_VDB_GRPC_COMMON_CHANNELPOOL_H
+
+#include "sdk/vdb/grpc/common/ChannelConfiguration.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace grpc {
+class Channel;
+} // namespace grpc
+
+namespace velocitas {
+
+/**
+ * @brief Strategy to select the channel of a pool a call is issued on.
+ */
+enum class ChannelSelection {
+    ROUND_ROBIN,  // cycle through the channels
+    LEAST_LOADED, // pick the channel with the fewest calls in flight
+};
+
+struct ChannelPoolConfig {
+    size_t           m_size{1};
+    ChannelSelection m_selection{ChannelSelection::ROUND_ROBIN};
+
+    /**
+     * @brief Read the configuration from env vars SDV_VDB_CHANNEL_POOL_SIZE and
+     * SDV_VDB_CHANNEL_POOL_SELECTION ("round_robin" or "least_loaded").
+     */
+    static ChannelPoolConfig fromEnvironment();
+};
+
+/**
+ * @brief A fixed set of channels to the same server, each call being issued on one of them.
+ *
+ * Pools are shared by all clients connecting to the same address with the same configuration,
+ * so the channel arguments are parsed and the connections are established only once.
+ *
+ * A pool may connect to several endpoints of the same service (e.g. redundant databrokers), each
+ * with the same number of channels. Calls are issued on the channels of the active endpoint only;
+ * once a call fails as the endpoint is not reachable, the pool fails over to the next one and
+ * stays there until that one fails as well.
+ */
+class ChannelPool : public std::enable_shared_from_this<ChannelPool> {
+public:
+    /**
+     * @brief A selected channel; it counts as loaded by one more call until the lease is
+     * destroyed.
+     */
+    class Lease {
+    public:
+        Lease(std::shared_ptr<ChannelPool> pool, size_t index);
+        ~Lease();
+
+        [[nodiscard]] size_t getIndex() const { return m_index; }
+
+        /**
+         * @brief Report that a call on the channel failed with status UNAVAILABLE, see
+         * ChannelPool::reportUnavailable.
+         */
+        void reportUnavailable() { m_pool->reportUnavailable(m_index); }
+
+        Lease(const Lease&)            = delete;
+        Lease(Lease&&)                 = delete;
+        Lease& operator=(const Lease&) = delete;
+        Lease& operator=(Lease&&)      = delete;
+
+    private:
+        std::shared_ptr<ChannelPool> m_pool;
+        size_t                       m_index;
+    };
+
+    /**
+     * @brief Create a pool of the passed channels.
+     *
+     * @param channels        The channels to the same server.
+     * @param selection       Strategy to select the channel of a call.
+     * @param maxMessageSize  Maximum size of messages sent or received via the channels.
+     * @param numEndpoints    Number of endpoints the channels are connected to; the channels of
+     *                        each endpoint follow the ones of the previous endpoint.
+     * @throw std::invalid_argument if there are no channels or if they are not evenly split
+     * among the endpoints.
+     */
+    static std::shared_ptr<ChannelPool> create(std::vector<std::shared_ptr<grpc::Channel>> channels,
+                                               ChannelSelection selection,
+                                               size_t maxMessageSize = DEFAULT_MAX_MESSAGE_SIZE,
+                                               size_t numEndpoints   = 1);
+
+    /**
+     * @brief Get the pool shared by all clients connecting to the passed address with the
+     * passed configuration, creating it if there is none yet. The address may be a comma
+     * separated list of the endpoints to fail over between, e.g. "broker-a:55555,broker-b:55555",
+     * each being connected via as many channels as configured.
+     */
+    static std::shared_ptr<ChannelPool> getShared(const std::string&       address,
+                                                  const ChannelPoolConfig& config);
+
+    [[nodiscard]] size_t getSize() const { return m_channels.size(); }
+
+    [[nodiscard]] size_t getMaxMessageSize() const { return m_maxMessageSize; }
+
+    [[nodiscard]] const std::shared_ptr<grpc::Channel>& getChannel(size_t index) const;
+
+    [[nodiscard]] size_t getNumEndpoints() const { return m_numEndpoints; }
+
+    /**
+     * @brief Get the index of the endpoint calls are currently issued to.
+     */
+    [[nodiscard]] size_t getActiveEndpoint() const { return m_activeEndpoint.load(); }
+
+    /**
+     * @brief Get the first channel of the active endpoint, representing its connection state.
+     */
+    [[nodiscard]] const std::shared_ptr<grpc::Channel>& getPrimaryChannel() const;
+
+    /**
+     * @brief Get the number of leases currently held on the channel at the passed index.
+     */
+    [[nodiscard]] size_t getLoad(size_t index) const;
+
+    /**
+     * @brief Select the channel to issue the next call on.
+     */
+    [[nodiscard]] std::shared_ptr<Lease> acquire();
+
+    /**
+     * @brief Select a channel to issue a duplicate of a call on, which was issued on the channel
+     * at the passed index: a channel of the next endpoint if there are several, otherwise another
+     * channel of the same endpoint.
+     *
+     * @return The lease of the selected channel, null if the pool has a single channel only.
+     */
+    [[nodiscard]] std::shared_ptr<Lease> acquireAlternative(size_t index);
+
+    /**
+     * @brief Report that a call on the channel at the passed index failed with status
+     * UNAVAILABLE. If the channel is not connected, the endpoint is not reachable and the pool
+     * fails over to the next endpoint, unless it did so already. A connected channel indicates
+     * that the databroker reported the status itself, e.g. for a provider not being available.
+     */
+    void reportUnavailable(size_t index);
+
+    ChannelPool(const ChannelPool&)            = delete;
+    ChannelPool(ChannelPool&&)                 = delete;
+    ChannelPool& operator=(const ChannelPool&) = delete;
+    ChannelPool& operator=(ChannelPool&&)      = delete;
+    ~ChannelPool()                             = default;
+
+private:
+    ChannelPool(std::vector<std::shared_ptr<grpc::Channel>> channels, ChannelSelection selection,
+                size_t maxMessageSize, size_t numEndpoints);
+
+    std::vector<std::shared_ptr<grpc::Channel>> m_channels;
+    std::unique_ptr<std::atomic_size_t[]>       m_loads;
+    ChannelSelection                            m_selection;
+    size_t                                      m_maxMessageSize;
+    size_t                                      m_numEndpoints;
+    size_t                                      m_channelsPerEndpoint;
+    std::atomic_size_t                          m_activeEndpoint{0};
+    std::atomic_size_t                          m_next{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_GRPC_COMMON_CHANNELPOOL_H
@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/grpc/common/ChannelPrewarmer.h"
+
+#include "sdk/Logger.h"
+#include "sdk/Utils.h"
+#include "sdk/vdb/grpc/common/ChannelPool.h"
+#include "sdk/vdb/grpc/common/ConnectivityWatcher.h"
+
+#include <fmt/core.h>
+
+#include <string>
+#include <utility>
+
+namespace velocitas {
+
+namespace {
+
+void complete(AsyncResult<Status>& result, const Status& status) {
+    if (status.ok()) {
+        result.insertResult(Status());
+    } else {
+        result.insertError(Status(status.errorMessage()));
+    }
+}
+
+} // namespace
+
+ChannelPrewarmConfig ChannelPrewarmConfig::fromEnvironment() {
+    ChannelPrewarmConfig config;
+    try {
+        const auto valueStr = getEnvVar("SDV_VDB_PREWARM_TIMEOUT_MS");
+        if (!valueStr.empty()) {
+            config.m_timeout = std::chrono::milliseconds{std::stoul(valueStr)};
+        }
+    } catch (...) {
+        logger().error("Invalid value of env var SDV_VDB_PREWARM_TIMEOUT_MS! Channels are not "
+                       "prewarmed.");
+    }
+    return config;
+}
+
+ChannelPrewarmer::ChannelPrewarmer(size_t numChannels, std::chrono::milliseconds timeout)
+    : m_numChannels(numChannels)
+    , m_timeout(timeout)
+    , m_startTime(std::chrono::steady_clock::now())
+    , m_numPendingChannels(numChannels) {}
+
+std::shared_ptr<ChannelPrewarmer> ChannelPrewarmer::start(const ChannelPool&        pool,
+                                                          std::chrono::milliseconds timeout) {
+    std::shared_ptr<ChannelPrewarmer> prewarmer(new ChannelPrewarmer(pool.getSize(), timeout));
+    // all channels connect concurrently, each asked to by the watcher
+    for (size_t i = 0; i < pool.getSize(); ++i) {
+        ConnectivityWatcher::getInstance().waitUntilReady(
+            pool.getChannel(i), timeout,
+            [prewarmer](bool isReady) { prewarmer->onChannelDone(isReady); });
+    }
+    return prewarmer;
+}
+
+AsyncResultPtr_t<Status> ChannelPrewarmer::whenReady() {
+    auto   result = std::make_shared<AsyncResult<Status>>();
+    Status status;
+    {
+        std::lock_guard lock(m_mutex);
+        if (!m_status) {
+            m_waitingResults.push_back(result);
+            return result;
+        }
+        status = *m_status;
+    }
+    complete(*result, status);
+    return result;
+}
+
+void ChannelPrewarmer::onChannelDone(bool isReady) {
+    std::vector<AsyncResultPtr_t<Status>> waitingResults;
+    Status                                status;
+    {
+        std::lock_guard lock(m_mutex);
+        if (!isReady) {
+            ++m_numFailedChannels;
+        }
+        if (--m_numPendingChannels > 0) {
+            return;
+        }
+        m_status = m_numFailedChannels == 0
+                       ? Status()
+                       : Status(fmt::format("{} of {} channels not connected within {} ms",
+                                            m_numFailedChannels, m_numChannels, m_timeout.count()));
+        status   = *m_status;
+        waitingResults.swap(m_waitingResults);
+    }
+
+    if (status.ok()) {
+        logger().info("Connected to the databroker after {} ms",
+                      std::chrono::duration_cast<std::chrono::milliseconds>(
+                          std::chrono::steady_clock::now() - m_startTime)
+                          .count());
+    } else {
+        logger().warn("Prewarming the databroker connection failed: {}", status.errorMessage());
+    }
+    for (const auto& result : waitingResults) {
+        complete(*result, status);
+    }
+}
+
+} // namespace velocitas
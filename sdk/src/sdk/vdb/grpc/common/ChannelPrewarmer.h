@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_GRPC_COMMON_CHANNELPREWARMER_H
+#define VEHICLE_APP_SDK_VDB_GRPC_COMMON_CHANNELPREWARMER_H
+
+#include "sdk/AsyncResult.h"
+#include "sdk/Status.h"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace velocitas {
+
+class ChannelPool;
+
+struct ChannelPrewarmConfig {
+    /** Maximum time to wait for the channels to get connected; zero disables prewarming */
+    std::chrono::milliseconds m_timeout{0};
+
+    /**
+     * @brief Read the configuration from env var SDV_VDB_PREWARM_TIMEOUT_MS.
+     */
+    static ChannelPrewarmConfig fromEnvironment();
+};
+
+/**
+ * @brief Connects all channels of a pool right when a client is created, so the name resolution,
+ * the connect and the HTTP/2 handshake are done before the first request instead of delaying it.
+ *
+ * The channels connect in the background; whenReady tells when all of them are connected.
+ */
+class ChannelPrewarmer {
+public:
+    /**
+     * @brief Start connecting all channels of the passed pool.
+     *
+     * @param pool     The pool whose channels to connect.
+     * @param timeout  Maximum time to wait for all channels to get connected.
+     */
+    static std::shared_ptr<ChannelPrewarmer> start(const ChannelPool&        pool,
+                                                   std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Get a result completing once all channels are connected; each call returns a new
+     *        result.
+     *
+     * @return The result, failing if a channel did not get connected within the timeout.
+     */
+    AsyncResultPtr_t<Status> whenReady();
+
+    ChannelPrewarmer(const ChannelPrewarmer&)            = delete;
+    ChannelPrewarmer(ChannelPrewarmer&&)                 = delete;
+    ChannelPrewarmer& operator=(const ChannelPrewarmer&) = delete;
+    ChannelPrewarmer& operator=(ChannelPrewarmer&&)      = delete;
+    ~ChannelPrewarmer()                                  = default;
+
+private:
+    ChannelPrewarmer(size_t numChannels, std::chrono::milliseconds timeout);
+
+    void onChannelDone(bool isReady);
+
+    const size_t                                m_numChannels;
+    const std::chrono::milliseconds             m_timeout;
+    const std::chrono::steady_clock::time_point m_startTime;
+    std::mutex                                  m_mutex;
+    size_t                                      m_numPendingChannels;
+    size_t                                      m_numFailedChannels{0};
+    // set once all channels are done
+    std::optional<Status>                       m_status;
+    std::vector<AsyncResultPtr_t<Status>>       m_waitingResults;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_GRPC_COMMON_CHANNELPREWARMER_H
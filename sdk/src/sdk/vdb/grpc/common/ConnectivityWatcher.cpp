@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/grpc/common/ConnectivityWatcher.h"
+
+#include "sdk/Logger.h"
+
+#include <grpcpp/channel.h>
+
+#include <exception>
+#include <tuple>
+#include <utility>
+
+namespace velocitas {
+
+struct ConnectivityWatcher::Watch {
+    std::shared_ptr<grpc::Channel>        m_channel;
+    std::chrono::system_clock::time_point m_deadline;
+    ReadyHandler_t                        m_handler;
+};
+
+namespace {
+void notify(const ConnectivityWatcher::ReadyHandler_t& handler, bool isReady) {
+    try {
+        handler(isReady);
+    } catch (const std::exception& e) {
+        logger().error("[ConnectivityWatcher] Uncaught exception in handler: {}", e.what());
+    }
+}
+} // namespace
+
+ConnectivityWatcher& ConnectivityWatcher::getInstance() {
+    // never destroyed: watches may still be pending while static objects are destroyed
+    static auto* instance = new ConnectivityWatcher();
+    return *instance;
+}
+
+ConnectivityWatcher::ConnectivityWatcher()
+    : m_thread([this]() { run(); }) {
+    m_thread.detach();
+}
+
+void ConnectivityWatcher::waitUntilReady(const std::shared_ptr<grpc::Channel>& channel,
+                                         std::chrono::milliseconds             timeout,
+                                         ReadyHandler_t                        handler) {
+    arm(std::make_unique<Watch>(
+        Watch{channel, std::chrono::system_clock::now() + timeout, std::move(handler)}));
+}
+
+void ConnectivityWatcher::arm(std::unique_ptr<Watch> watch) {
+    const auto state = watch->m_channel->GetState(true);
+    // checked right before watching it, as becoming ready earlier would not be reported
+    if (state == GRPC_CHANNEL_READY) {
+        notify(watch->m_handler, true);
+        return;
+    }
+    auto* tag = watch.get();
+    // ownership is passed to the completion queue until the tag is returned
+    watch->m_channel->NotifyOnStateChange(state, watch->m_deadline, &m_queue, tag);
+    std::ignore = watch.release();
+}
+
+void ConnectivityWatcher::run() {
+    void* tag  = nullptr;
+    bool  isOk = false;
+    while (m_queue.Next(&tag, &isOk)) {
+        std::unique_ptr<Watch> watch(static_cast<Watch*>(tag));
+        if (!isOk) {
+            notify(watch->m_handler, false); // the deadline expired
+        } else if (watch->m_channel->GetState(false) == GRPC_CHANNEL_READY) {
+            notify(watch->m_handler, true);
+        } else {
+            arm(std::move(watch));
+        }
+    }
+}
+
+} // namespace velocitas
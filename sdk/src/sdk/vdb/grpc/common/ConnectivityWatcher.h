@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_GRPC_COMMON_CONNECTIVITYWATCHER_H
+#define VEHICLE_APP_SDK_VDB_GRPC_COMMON_CONNECTIVITYWATCHER_H
+
+#include <grpcpp/completion_queue.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+
+namespace grpc {
+class Channel;
+}
+
+namespace velocitas {
+
+/**
+ * @brief Watches the connectivity state of gRPC channels, so reconnecting can wait for a channel
+ * to become ready instead of polling it with timers.
+ *
+ * All watches are served by a single background thread, which is started on first use.
+ */
+class ConnectivityWatcher final {
+public:
+    using ReadyHandler_t = std::function<void(bool isReady)>;
+
+    static ConnectivityWatcher& getInstance();
+
+    /**
+     * @brief Wait for the channel to become ready. The channel is asked to connect if it is idle.
+     *
+     * @param channel  The channel to watch.
+     * @param timeout  Maximum time to wait.
+     * @param handler  Called with true once the channel is ready, with false if it did not get
+     *                 ready in time. Called by the calling thread if the channel is ready
+     *                 already, otherwise by the watcher thread.
+     */
+    void waitUntilReady(const std::shared_ptr<grpc::Channel>& channel,
+                        std::chrono::milliseconds timeout, ReadyHandler_t handler);
+
+    ConnectivityWatcher(const ConnectivityWatcher&)            = delete;
+    ConnectivityWatcher(ConnectivityWatcher&&)                 = delete;
+    ConnectivityWatcher& operator=(const ConnectivityWatcher&) = delete;
+    ConnectivityWatcher& operator=(ConnectivityWatcher&&)      = delete;
+
+private:
+    struct Watch;
+
+    ConnectivityWatcher();
+    ~ConnectivityWatcher() = default;
+
+    void arm(std::unique_ptr<Watch> watch);
+    void run();
+
+    grpc::CompletionQueue m_queue;
+    std::thread           m_thread;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_GRPC_COMMON_CONNECTIVITYWATCHER_H
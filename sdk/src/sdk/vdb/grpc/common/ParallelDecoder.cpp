@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ParallelDecoder.h"
+
+#include "sdk/Job.h"
+#include "sdk/Logger.h"
+#include "sdk/ThreadPool.h"
+#include "sdk/Utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <exception>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace velocitas {
+
+namespace {
+
+// weight of a new observation in the moving average
+constexpr double OBSERVATION_WEIGHT = 0.125;
+// decode times of fewer entries are dominated by the per update overhead and not observed
+constexpr size_t MIN_OBSERVED_ENTRIES = 32;
+
+} // namespace
+
+struct ParallelDecoder::Batch {
+    const DecodeRange_t* m_decodeRange;
+    size_t               m_numEntries;
+    size_t               m_numChunks;
+
+    std::atomic<size_t>  m_nextChunk{0};
+    std::atomic<int64_t> m_busyNanos{0};
+
+    std::mutex              m_mutex;
+    std::condition_variable m_doneCondition;
+    size_t                  m_numDoneChunks{0};
+    std::exception_ptr      m_error;
+};
+
+ParallelDecoderConfig ParallelDecoderConfig::fromEnvironment() {
+    ParallelDecoderConfig config;
+    try {
+        const auto valueStr = getEnvVar("SDV_VDB_PARALLEL_DECODE_THRESHOLD_US");
+        if (!valueStr.empty()) {
+            config.m_splitThreshold = std::chrono::microseconds{std::stoul(valueStr)};
+        }
+    } catch (...) {
+        logger().error("Invalid value of env var SDV_VDB_PARALLEL_DECODE_THRESHOLD_US! Using "
+                       "default ({}).",
+                       DEFAULT_SPLIT_THRESHOLD.count());
+    }
+    return config;
+}
+
+ParallelDecoder::ParallelDecoder(ParallelDecoderConfig       config,
+                                 std::shared_ptr<ThreadPool> threadPool)
+    : m_config(config)
+    , m_threadPool(std::move(threadPool)) {}
+
+size_t ParallelDecoder::getNumChunks(size_t numEntries) const {
+    double nanosPerEntry{0.0};
+    {
+        std::lock_guard lock(m_mutex);
+        nanosPerEntry = m_nanosPerEntry;
+    }
+    const auto thresholdNanos =
+        std::chrono::duration<double, std::nano>(m_config.m_splitThreshold).count();
+    const auto expectedNanos = nanosPerEntry * static_cast<double>(numEntries);
+    if (thresholdNanos <= 0.0 || expectedNanos <= thresholdNanos) {
+        return 1;
+    }
+    const auto numChunks = static_cast<size_t>(std::ceil(expectedNanos / thresholdNanos));
+    // the calling thread decodes a chunk as well
+    const auto maxNumChunks = std::min(m_threadPool->getNumWorkerThreads() + 1,
+                                       numEntries / std::max<size_t>(m_config.m_minChunkSize, 1));
+    return std::max<size_t>(std::min(numChunks, maxNumChunks), 1);
+}
+
+size_t ParallelDecoder::decode(size_t numEntries, const DecodeRange_t& decodeRange) {
+    const auto numChunks = getNumChunks(numEntries);
+    if (numChunks == 1) {
+        const auto start = std::chrono::steady_clock::now();
+        decodeRange(0, numEntries);
+        recordDecode(numEntries, std::chrono::steady_clock::now() - start);
+        return 1;
+    }
+
+    // shared with the jobs, as ones not started before all chunks are done may run any time later
+    auto batch           = std::make_shared<Batch>();
+    batch->m_decodeRange = &decodeRange;
+    batch->m_numEntries  = numEntries;
+    batch->m_numChunks   = numChunks;
+    std::vector<JobPtr_t> jobs;
+    jobs.reserve(numChunks - 1);
+    for (size_t i = 1; i < numChunks; ++i) {
+        jobs.push_back(Job::create([batch]() { decodeNextChunk(*batch); }));
+    }
+    m_threadPool->enqueueBatch(std::move(jobs));
+
+    while (decodeNextChunk(*batch)) {
+    }
+    {
+        std::unique_lock<std::mutex> lock(batch->m_mutex);
+        batch->m_doneCondition.wait(
+            lock, [&batch]() { return batch->m_numDoneChunks == batch->m_numChunks; });
+    }
+    ++m_numSplitUpdates;
+    recordDecode(numEntries, std::chrono::nanoseconds(batch->m_busyNanos.load()));
+    if (batch->m_error) {
+        std::rethrow_exception(batch->m_error);
+    }
+    return numChunks;
+}
+
+bool ParallelDecoder::decodeNextChunk(Batch& batch) {
+    const auto chunk = batch.m_nextChunk.fetch_add(1);
+    if (chunk >= batch.m_numChunks) {
+        return false;
+    }
+    // chunks of about equal size complete at about the same time
+    const auto         begin = chunk * batch.m_numEntries / batch.m_numChunks;
+    const auto         end   = (chunk + 1) * batch.m_numEntries / batch.m_numChunks;
+    const auto         start = std::chrono::steady_clock::now();
+    std::exception_ptr error;
+    try {
+        (*batch.m_decodeRange)(begin, end);
+    } catch (...) {
+        error = std::current_exception();
+    }
+    batch.m_busyNanos += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+
+    std::lock_guard<std::mutex> lock(batch.m_mutex);
+    if (error && !batch.m_error) {
+        batch.m_error = error;
+    }
+    if (++batch.m_numDoneChunks == batch.m_numChunks) {
+        batch.m_doneCondition.notify_all();
+    }
+    return true;
+}
+
+void ParallelDecoder::recordDecode(size_t                              numEntries,
+                                   std::chrono::steady_clock::duration duration) {
+    if (numEntries < MIN_OBSERVED_ENTRIES) {
+        return;
+    }
+    const auto nanos = std::chrono::duration<double, std::nano>(duration).count() /
+                       static_cast<double>(numEntries);
+    std::lock_guard lock(m_mutex);
+    m_nanosPerEntry = m_nanosPerEntry == 0.0
+                          ? nanos
+                          : m_nanosPerEntry + OBSERVATION_WEIGHT * (nanos - m_nanosPerEntry);
+}
+
+} // namespace velocitas
@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_GRPC_COMMON_PARALLELDECODER_H
+#define VEHICLE_APP_SDK_VDB_GRPC_COMMON_PARALLELDECODER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace velocitas {
+
+class ThreadPool;
+
+struct ParallelDecoderConfig {
+    /** Updates expected to take longer than this to decode on a single thread are split */
+    std::chrono::microseconds m_splitThreshold{DEFAULT_SPLIT_THRESHOLD};
+    /** Chunks are not made smaller than this number of entries to keep the hop overhead low */
+    size_t m_minChunkSize{DEFAULT_MIN_CHUNK_SIZE};
+
+    static constexpr std::chrono::microseconds DEFAULT_SPLIT_THRESHOLD{500};
+    static constexpr size_t                    DEFAULT_MIN_CHUNK_SIZE = 256;
+
+    /**
+     * @brief Read the configuration from env var SDV_VDB_PARALLEL_DECODE_THRESHOLD_US; zero
+     * disables splitting.
+     */
+    static ParallelDecoderConfig fromEnvironment();
+};
+
+/**
+ * @brief Decodes the entries of wide updates (e.g. full snapshots after a resubscribe) in
+ * parallel chunks on the workers of a thread pool instead of on the single thread receiving them.
+ *
+ * Whether to split is decided by the decode time per entry observed so far: updates expected to
+ * decode within the split threshold, and all updates before any time was observed, are decoded by
+ * the calling thread right away, so small updates never hop threads. The calling thread decodes
+ * chunks as well and takes over the ones no worker picked up yet, so a busy pool does not delay
+ * the update beyond decoding it serially.
+ */
+class ParallelDecoder {
+public:
+    /** Decodes the entries [begin, end); called concurrently for disjoint ranges */
+    using DecodeRange_t = std::function<void(size_t begin, size_t end)>;
+
+    ParallelDecoder(ParallelDecoderConfig config, std::shared_ptr<ThreadPool> threadPool);
+
+    /**
+     * @brief Decode the entries [0, numEntries), returning once all are decoded.
+     *
+     * @return The number of chunks the entries were split into, 1 if not split.
+     * @throw The first exception thrown by decodeRange.
+     */
+    size_t decode(size_t numEntries, const DecodeRange_t& decodeRange);
+
+    /**
+     * @brief Get the number of chunks an update of the passed number of entries is split into.
+     */
+    [[nodiscard]] size_t getNumChunks(size_t numEntries) const;
+
+    /**
+     * @brief Record the time it took to decode the passed number of entries to adapt to.
+     */
+    void recordDecode(size_t numEntries, std::chrono::steady_clock::duration duration);
+
+    [[nodiscard]] uint64_t getNumSplitUpdates() const { return m_numSplitUpdates; }
+
+    [[nodiscard]] const ParallelDecoderConfig& getConfig() const { return m_config; }
+
+private:
+    struct Batch;
+
+    // decodes the next chunk of the batch not taken yet; returns false if there is none
+    static bool decodeNextChunk(Batch& batch);
+
+    const ParallelDecoderConfig       m_config;
+    const std::shared_ptr<ThreadPool> m_threadPool;
+    mutable std::mutex                m_mutex;
+    // exponentially weighted moving average of the observations, zero if none yet
+    double                            m_nanosPerEntry{0.0};
+    std::atomic<uint64_t>             m_numSplitUpdates{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_GRPC_COMMON_PARALLELDECODER_H
@@ -0,0 +1,137 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ReadCoalescer.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace velocitas {
+
+namespace {
+
+DataPointReply extractSignals(const DataPointReply&              reply,
+                              const std::vector<SignalHandle_t>& signals) {
+    DataPointReply extract;
+    extract.reserve(signals.size());
+    for (const auto signal : signals) {
+        if (const auto* entry = reply.find(signal)) {
+            // samples have value semantics, so readers do not share any value object
+            extract.set(signal, DataPointReply::getSample(*entry));
+        }
+    }
+    return extract;
+}
+
+} // namespace
+
+ReadCoalescer::ReadCoalescer(ReadFunction_t readFunction)
+    : m_readFunction(std::move(readFunction)) {}
+
+AsyncResultPtr_t<DataPointReply> ReadCoalescer::read(const std::vector<std::string>& signalPaths) {
+    if (signalPaths.empty()) {
+        return m_readFunction(signalPaths);
+    }
+
+    std::vector<SignalHandle_t> signals;
+    signals.reserve(signalPaths.size());
+    auto& registry = SignalPathRegistry::getInstance();
+    for (const auto& path : signalPaths) {
+        signals.push_back(registry.intern(path));
+    }
+    std::vector<SignalHandle_t> sortedSignals{signals};
+    std::sort(sortedSignals.begin(), sortedSignals.end());
+    sortedSignals.erase(std::unique(sortedSignals.begin(), sortedSignals.end()),
+                        sortedSignals.end());
+
+    auto                          result = std::make_shared<AsyncResult<DataPointReply>>();
+    std::shared_ptr<InFlightRead> inFlightRead;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& candidate : m_inFlightReads) {
+            if (std::includes(candidate->m_signals.cbegin(), candidate->m_signals.cend(),
+                              sortedSignals.cbegin(), sortedSignals.cend())) {
+                addReader(candidate, Reader{std::move(signals), result});
+                return result;
+            }
+        }
+        inFlightRead            = std::make_shared<InFlightRead>();
+        inFlightRead->m_signals = std::move(sortedSignals);
+        addReader(inFlightRead, Reader{std::move(signals), result});
+        m_inFlightReads.push_back(inFlightRead);
+    }
+
+    // the read may complete immediately, so it must not be initiated with m_mutex locked
+    auto sharedResult = m_readFunction(signalPaths);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        inFlightRead->m_sharedResult = sharedResult;
+    }
+    sharedResult->onError([this, inFlightRead](const Status& status) {
+        for (const auto& reader : finishRead(inFlightRead)) {
+            reader.m_result->insertError(Status(status));
+        }
+    });
+    sharedResult->onResult([this, inFlightRead](const DataPointReply& reply) {
+        for (const auto& reader : finishRead(inFlightRead)) {
+            reader.m_result->insertResult(extractSignals(reply, reader.m_signals));
+        }
+    });
+    return result;
+}
+
+size_t ReadCoalescer::getNumReadsInFlight() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_inFlightReads.size();
+}
+
+void ReadCoalescer::addReader(const std::shared_ptr<InFlightRead>& inFlightRead, Reader reader) {
+    reader.m_result->setCancellationHandler(
+        [this, weakInFlightRead = std::weak_ptr<InFlightRead>(inFlightRead)]() {
+            onReaderCancelled(weakInFlightRead);
+        });
+    inFlightRead->m_readers.push_back(std::move(reader));
+}
+
+void ReadCoalescer::onReaderCancelled(const std::weak_ptr<InFlightRead>& weakInFlightRead) {
+    AsyncResultPtr_t<DataPointReply> sharedResult;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto                        inFlightRead = weakInFlightRead.lock();
+        if (!inFlightRead) {
+            return;
+        }
+        const auto& readers = inFlightRead->m_readers;
+        if (std::all_of(readers.cbegin(), readers.cend(),
+                        [](const auto& reader) { return reader.m_result->isCancelled(); })) {
+            sharedResult = inFlightRead->m_sharedResult;
+        }
+    }
+    // nobody is interested in the response anymore
+    if (sharedResult) {
+        sharedResult->cancel();
+    }
+}
+
+std::vector<ReadCoalescer::Reader>
+ReadCoalescer::finishRead(const std::shared_ptr<InFlightRead>& inFlightRead) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_inFlightReads.erase(std::remove(m_inFlightReads.begin(), m_inFlightReads.end(), inFlightRead),
+                          m_inFlightReads.end());
+    return std::exchange(inFlightRead->m_readers, {});
+}
+
+} // namespace velocitas
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_GRPC_COMMON_READCOALESCER_H
+#define VEHICLE_APP_SDK_VDB_GRPC_COMMON_READCOALESCER_H
+
+#include "sdk/AsyncResult.h"
+#include "sdk/DataPointReply.h"
+#include "sdk/SignalPathRegistry.h"
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace velocitas {
+
+/**
+ * @brief Lets concurrent reads of data points share outstanding requests to the databroker.
+ *
+ * A read whose signals are all contained in a read which is still in flight does not issue a
+ * request of its own, but is completed from the response of the one in flight. All other reads
+ * are forwarded to the passed read function. The shared request is cancelled once all reads
+ * sharing it are cancelled.
+ */
+class ReadCoalescer {
+public:
+    /** Function actually requesting the passed signals from the databroker */
+    using ReadFunction_t =
+        std::function<AsyncResultPtr_t<DataPointReply>(const std::vector<std::string>&)>;
+
+    explicit ReadCoalescer(ReadFunction_t readFunction);
+
+    /**
+     * @brief Read the passed signals, sharing a request already in flight if possible.
+     *
+     * @param signalPaths  Paths of the signals to read.
+     * @return AsyncResultPtr_t<DataPointReply>  The reply containing the requested signals.
+     */
+    AsyncResultPtr_t<DataPointReply> read(const std::vector<std::string>& signalPaths);
+
+    /**
+     * @brief Get the number of requests currently in flight.
+     */
+    [[nodiscard]] size_t getNumReadsInFlight() const;
+
+private:
+    struct Reader {
+        std::vector<SignalHandle_t>      m_signals;
+        AsyncResultPtr_t<DataPointReply> m_result;
+    };
+
+    struct InFlightRead {
+        std::vector<SignalHandle_t>      m_signals; // sorted
+        std::vector<Reader>              m_readers;
+        AsyncResultPtr_t<DataPointReply> m_sharedResult;
+    };
+
+    void addReader(const std::shared_ptr<InFlightRead>& inFlightRead, Reader reader);
+    void onReaderCancelled(const std::weak_ptr<InFlightRead>& weakInFlightRead);
+    std::vector<Reader> finishRead(const std::shared_ptr<InFlightRead>& inFlightRead);
+
+    ReadFunction_t                             m_readFunction;
+    mutable std::mutex                         m_mutex;
+    std::vector<std::shared_ptr<InFlightRead>> m_inFlightReads;
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_GRPC_COMMON_READCOALESCER_H
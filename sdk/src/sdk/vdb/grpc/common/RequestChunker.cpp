@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "RequestChunker.h"
+
+#include "sdk/Logger.h"
+#include "sdk/Utils.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+namespace velocitas {
+
+namespace {
+
+// assumed size per element of a response until sizes were observed
+constexpr double INITIAL_RESPONSE_BYTES_PER_ELEMENT = 128.0;
+// only part of the message size limit is used to leave room for the envelope and outliers
+constexpr double MESSAGE_SIZE_HEADROOM = 0.75;
+// weight of a new observation in the moving averages
+constexpr double OBSERVATION_WEIGHT = 0.125;
+
+size_t getSizeFromEnv(const char* name, size_t defaultValue) {
+    size_t value{defaultValue};
+    try {
+        const auto valueStr = getEnvVar(name);
+        if (!valueStr.empty()) {
+            value = std::stoul(valueStr);
+        }
+    } catch (...) {
+        logger().error("Invalid value of env var {}! Using default ({}).", name, defaultValue);
+    }
+    if (value == 0) {
+        logger().warn("Env var {} must be at least 1! Using default ({}).", name, defaultValue);
+        value = defaultValue;
+    }
+    return value;
+}
+
+double addObservation(double average, double observation) {
+    if (average == 0.0) {
+        return observation;
+    }
+    return average + OBSERVATION_WEIGHT * (observation - average);
+}
+
+} // namespace
+
+RequestChunkerConfig RequestChunkerConfig::fromEnvironment(size_t maxMessageSize) {
+    RequestChunkerConfig config{maxMessageSize};
+    config.m_maxChunkSize  = getSizeFromEnv("SDV_VDB_MAX_CHUNK_SIZE", DEFAULT_MAX_CHUNK_SIZE);
+    config.m_minChunkSize  = std::min(config.m_minChunkSize, config.m_maxChunkSize);
+    config.m_targetLatency = std::chrono::milliseconds{getSizeFromEnv(
+        "SDV_VDB_CHUNK_TARGET_LATENCY_MS", static_cast<size_t>(DEFAULT_TARGET_LATENCY.count()))};
+    return config;
+}
+
+RequestChunker::RequestChunker(RequestChunkerConfig config)
+    : m_config(std::move(config)) {}
+
+size_t RequestChunker::getChunkSize(size_t bytesPerElement) const {
+    double nanosPerElement{0.0};
+    double responseBytesPerElement{0.0};
+    {
+        std::lock_guard lock(m_mutex);
+        nanosPerElement         = m_nanosPerElement;
+        responseBytesPerElement = m_responseBytesPerElement;
+    }
+    if (responseBytesPerElement == 0.0) {
+        responseBytesPerElement = INITIAL_RESPONSE_BYTES_PER_ELEMENT;
+    }
+
+    size_t chunkSize = m_config.m_maxChunkSize;
+    if (nanosPerElement > 0.0) {
+        const auto targetNanos =
+            std::chrono::duration<double, std::nano>(m_config.m_targetLatency).count();
+        chunkSize = std::min(chunkSize, static_cast<size_t>(targetNanos / nanosPerElement));
+    }
+    chunkSize = std::max(chunkSize, m_config.m_minChunkSize);
+
+    // the message size limit is a hard one, so it even overrules the minimum chunk size
+    const auto elementSize =
+        std::max(static_cast<double>(bytesPerElement), responseBytesPerElement);
+    const auto maxElements = static_cast<size_t>(
+        static_cast<double>(m_config.m_maxMessageSize) * MESSAGE_SIZE_HEADROOM / elementSize);
+    return std::max<size_t>(std::min(chunkSize, maxElements), 1);
+}
+
+std::vector<size_t> RequestChunker::split(size_t numElements, size_t bytesPerElement) const {
+    const auto chunkSize = getChunkSize(bytesPerElement);
+    if (numElements <= chunkSize) {
+        return {numElements};
+    }
+    // chunks of about equal size complete at about the same time
+    const auto          numChunks = (numElements + chunkSize - 1) / chunkSize;
+    std::vector<size_t> chunkSizes(numChunks, numElements / numChunks);
+    for (size_t i = 0; i < numElements % numChunks; ++i) {
+        ++chunkSizes[i];
+    }
+    return chunkSizes;
+}
+
+void RequestChunker::recordResponse(size_t numElements, std::chrono::steady_clock::duration latency,
+                                    size_t responseBytes) {
+    if (numElements == 0) {
+        return;
+    }
+    const auto elements = static_cast<double>(numElements);
+    std::lock_guard lock(m_mutex);
+    m_responseBytesPerElement =
+        addObservation(m_responseBytesPerElement, static_cast<double>(responseBytes) / elements);
+    // the latency of small requests is dominated by the per call overhead
+    if (numElements >= m_config.m_minChunkSize) {
+        const auto nanos  = std::chrono::duration<double, std::nano>(latency).count();
+        m_nanosPerElement = addObservation(m_nanosPerElement, nanos / elements);
+    }
+}
+
+} // namespace velocitas
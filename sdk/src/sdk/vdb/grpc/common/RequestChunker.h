@@ -0,0 +1,98 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_GRPC_COMMON_REQUESTCHUNKER_H
+#define VEHICLE_APP_SDK_VDB_GRPC_COMMON_REQUESTCHUNKER_H
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace velocitas {
+
+struct RequestChunkerConfig {
+    /** Maximum size of a request or response, chunks are sized to stay well below it */
+    size_t m_maxMessageSize;
+    /** Chunks are not made smaller than this number of elements to keep the call overhead low */
+    size_t m_minChunkSize{DEFAULT_MIN_CHUNK_SIZE};
+    /** Maximum number of elements per chunk */
+    size_t m_maxChunkSize{DEFAULT_MAX_CHUNK_SIZE};
+    /** Latency a single chunk should stay below, based on the observed latency per element */
+    std::chrono::milliseconds m_targetLatency{DEFAULT_TARGET_LATENCY};
+
+    static constexpr size_t                    DEFAULT_MIN_CHUNK_SIZE = 100;
+    static constexpr size_t                    DEFAULT_MAX_CHUNK_SIZE = 5000;
+    static constexpr std::chrono::milliseconds DEFAULT_TARGET_LATENCY{50};
+
+    /**
+     * @brief Read the configuration from env vars SDV_VDB_MAX_CHUNK_SIZE and
+     * SDV_VDB_CHUNK_TARGET_LATENCY_MS, using the passed message size limit.
+     */
+    static RequestChunkerConfig fromEnvironment(size_t maxMessageSize);
+};
+
+/**
+ * @brief Decides how to split requests addressing many elements (e.g. signals) into chunks
+ * issued in parallel.
+ *
+ * A chunk is limited by the message size limit, based on the size per element of the requests
+ * respectively of the responses observed so far, and by the target latency, based on the
+ * latency per element observed so far. Thus, large reads neither hit the message size limit
+ * nor block the databroker for long, while small requests are never split.
+ */
+class RequestChunker {
+public:
+    explicit RequestChunker(RequestChunkerConfig config);
+
+    /**
+     * @brief Get the sizes of the chunks to split a request of the passed number of elements
+     * into. The chunks are of about equal size, a request fitting into one chunk is not split.
+     *
+     * @param numElements      Number of elements addressed by the request.
+     * @param bytesPerElement  Size per element of the request or response, whichever is larger;
+     *                         zero to use the observed response size per element.
+     */
+    [[nodiscard]] std::vector<size_t> split(size_t numElements, size_t bytesPerElement = 0) const;
+
+    /**
+     * @brief Get the maximum number of elements of a chunk.
+     */
+    [[nodiscard]] size_t getChunkSize(size_t bytesPerElement = 0) const;
+
+    /**
+     * @brief Record a completed request to adapt the chunk size to.
+     *
+     * @param numElements    Number of elements addressed by the request.
+     * @param latency        Time from issuing the request until the response arrived.
+     * @param responseBytes  Size of the response message.
+     */
+    void recordResponse(size_t numElements, std::chrono::steady_clock::duration latency,
+                        size_t responseBytes);
+
+    [[nodiscard]] const RequestChunkerConfig& getConfig() const { return m_config; }
+
+private:
+    const RequestChunkerConfig m_config;
+    mutable std::mutex         m_mutex;
+    // exponentially weighted moving averages of the observations, zero if none yet
+    double m_nanosPerElement{0.0};
+    double m_responseBytesPerElement{0.0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_GRPC_COMMON_REQUESTCHUNKER_H
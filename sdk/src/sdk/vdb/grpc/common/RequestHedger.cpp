@@ -0,0 +1,260 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#include "RequestHedger.h"
+
+#include "sdk/Job.h"
+#include "sdk/Logger.h"
+#include "sdk/ThreadPool.h"
+#include "sdk/Utils.h"
+#include "sdk/grpc/GrpcCall.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <string>
+#include <utility>
+
+namespace velocitas {
+
+namespace {
+
+// the delay is derived anew after this number of observations, not on each one
+constexpr size_t DELAY_UPDATE_INTERVAL = 8;
+
+constexpr size_t NUM_ATTEMPTS = 2;
+constexpr size_t PRIMARY      = 0;
+constexpr size_t HEDGE        = 1;
+
+} // namespace
+
+struct RequestHedger::Request {
+    Issue_t                               m_issueAttempt;
+    std::chrono::steady_clock::time_point m_startTime;
+    size_t                                m_primaryIndex{0};
+
+    std::mutex                                        m_mutex;
+    bool                                              m_isDone{false};
+    bool                                              m_isHedgePending{false};
+    size_t                                            m_numPendingAttempts{0};
+    std::array<std::weak_ptr<GrpcCall>, NUM_ATTEMPTS> m_calls;
+    JobPtr_t                                          m_hedgeJob;
+};
+
+RequestHedgingConfig RequestHedgingConfig::fromEnvironment() {
+    RequestHedgingConfig config;
+    try {
+        const auto percentileStr = getEnvVar("SDV_VDB_HEDGE_PERCENTILE");
+        if (!percentileStr.empty()) {
+            config.m_percentile = std::stod(percentileStr);
+        }
+        const auto minDelayStr = getEnvVar("SDV_VDB_HEDGE_MIN_DELAY_MS");
+        if (!minDelayStr.empty()) {
+            config.m_minDelay = std::chrono::milliseconds{std::stoul(minDelayStr)};
+        }
+    } catch (...) {
+        logger().error("Invalid request hedging configuration specified via env vars! Using "
+                       "default (disabled).");
+        return RequestHedgingConfig{};
+    }
+    if (config.m_percentile < 0.0 || config.m_percentile >= 100.0) {
+        logger().error("Hedging percentile must be below 100! Using default (disabled).");
+        config.m_percentile = 0.0;
+    }
+    return config;
+}
+
+std::shared_ptr<RequestHedger> RequestHedger::create(const RequestHedgingConfig&  config,
+                                                     std::shared_ptr<ChannelPool> pool) {
+    if (config.m_percentile <= 0.0) {
+        return nullptr;
+    }
+    if (pool->getSize() == 1) {
+        logger().warn("Request hedging needs several channels or endpoints, disabled");
+        return nullptr;
+    }
+    return std::shared_ptr<RequestHedger>(new RequestHedger(config, std::move(pool)));
+}
+
+RequestHedger::RequestHedger(const RequestHedgingConfig& config, std::shared_ptr<ChannelPool> pool)
+    : m_config(config)
+    , m_pool(std::move(pool))
+    , m_hedgePool(ThreadPool::getInstance(ThreadPool::VDB_POOL))
+    , m_latencies(NUM_OBSERVATIONS) {}
+
+std::function<void()> RequestHedger::issue(Issue_t issueAttempt) {
+    auto request            = std::make_shared<Request>();
+    request->m_issueAttempt = std::move(issueAttempt);
+    request->m_startTime    = std::chrono::steady_clock::now();
+    auto lease              = m_pool->acquire();
+    request->m_primaryIndex = lease->getIndex();
+
+    request->m_numPendingAttempts = 1;
+    if (const auto delay = getDelay()) {
+        request->m_isHedgePending = true;
+        request->m_hedgeJob       = Job::create(
+            [weakThis = weak_from_this(), weakRequest = std::weak_ptr(request)]() {
+                auto thisPtr    = weakThis.lock();
+                auto requestPtr = weakRequest.lock();
+                if (thisPtr && requestPtr) {
+                    thisPtr->sendHedge(requestPtr);
+                }
+            },
+            *delay);
+        m_hedgePool->enqueue(request->m_hedgeJob);
+    }
+
+    auto call = request->m_issueAttempt(std::move(lease), false,
+                                        createCompletion(request, PRIMARY));
+    attachCall(*request, PRIMARY, std::move(call));
+    return [weakRequest = std::weak_ptr(request), hedgePool = m_hedgePool]() {
+        if (auto requestPtr = weakRequest.lock()) {
+            cancel(*requestPtr, *hedgePool);
+        }
+    };
+}
+
+void RequestHedger::sendHedge(const RequestPtr_t& request) {
+    {
+        std::lock_guard lock(request->m_mutex);
+        if (request->m_isDone || !request->m_isHedgePending) {
+            return;
+        }
+        request->m_isHedgePending = false;
+        request->m_hedgeJob.reset();
+        ++request->m_numPendingAttempts;
+    }
+    ++m_numHedges;
+    auto call = request->m_issueAttempt(m_pool->acquireAlternative(request->m_primaryIndex), true,
+                                        createCompletion(request, HEDGE));
+    attachCall(*request, HEDGE, std::move(call));
+}
+
+RequestHedger::Complete_t RequestHedger::createCompletion(const RequestPtr_t& request,
+                                                          size_t              attempt) {
+    return [weakThis = weak_from_this(), request, attempt](bool isReply) {
+        if (auto thisPtr = weakThis.lock()) {
+            return thisPtr->complete(*request, attempt, isReply);
+        }
+        std::lock_guard lock(request->m_mutex);
+        return !std::exchange(request->m_isDone, true);
+    };
+}
+
+bool RequestHedger::complete(Request& request, size_t attempt, bool isReply) {
+    JobPtr_t                               hedgeJob;
+    std::vector<std::shared_ptr<GrpcCall>> otherCalls;
+    {
+        std::lock_guard lock(request.m_mutex);
+        if (request.m_isDone) {
+            return false;
+        }
+        --request.m_numPendingAttempts;
+        if (!isReply && request.m_numPendingAttempts > 0) {
+            // the other attempt may still reply
+            return false;
+        }
+        request.m_isDone         = true;
+        request.m_isHedgePending = false;
+        hedgeJob                 = std::move(request.m_hedgeJob);
+        for (size_t i = 0; i < NUM_ATTEMPTS; ++i) {
+            auto call = request.m_calls[i].lock();
+            if (i != attempt && call) {
+                otherCalls.push_back(std::move(call));
+            }
+        }
+    }
+    if (hedgeJob) {
+        m_hedgePool->cancel(hedgeJob);
+    }
+    for (const auto& call : otherCalls) {
+        call->m_context.TryCancel();
+    }
+    if (isReply) {
+        recordLatency(std::chrono::steady_clock::now() - request.m_startTime);
+        if (attempt == HEDGE) {
+            ++m_numHedgeWins;
+        }
+    }
+    return true;
+}
+
+void RequestHedger::attachCall(Request& request, size_t attempt, std::shared_ptr<GrpcCall> call) {
+    if (!call) {
+        return;
+    }
+    {
+        std::lock_guard lock(request.m_mutex);
+        if (!request.m_isDone) {
+            request.m_calls[attempt] = call;
+            return;
+        }
+    }
+    // a call completed first while this one was issued
+    call->m_context.TryCancel();
+}
+
+void RequestHedger::cancel(Request& request, ThreadPool& hedgePool) {
+    JobPtr_t                               hedgeJob;
+    std::vector<std::shared_ptr<GrpcCall>> calls;
+    {
+        std::lock_guard lock(request.m_mutex);
+        // the cancelled attempts complete with an error, the last one being handled
+        request.m_isHedgePending = false;
+        hedgeJob                 = std::move(request.m_hedgeJob);
+        for (const auto& weakCall : request.m_calls) {
+            if (auto call = weakCall.lock()) {
+                calls.push_back(std::move(call));
+            }
+        }
+    }
+    if (hedgeJob) {
+        hedgePool.cancel(hedgeJob);
+    }
+    for (const auto& call : calls) {
+        call->m_context.TryCancel();
+    }
+}
+
+std::optional<std::chrono::milliseconds> RequestHedger::getDelay() const {
+    std::lock_guard lock(m_mutex);
+    return m_delay;
+}
+
+void RequestHedger::recordLatency(std::chrono::steady_clock::duration latency) {
+    std::lock_guard lock(m_mutex);
+    m_latencies[m_numObservations % NUM_OBSERVATIONS] =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(latency);
+    ++m_numObservations;
+    if (m_numObservations < MIN_OBSERVATIONS ||
+        (m_numObservations - MIN_OBSERVATIONS) % DELAY_UPDATE_INTERVAL != 0) {
+        return;
+    }
+
+    const auto numLatencies = std::min(m_numObservations, NUM_OBSERVATIONS);
+    std::vector<std::chrono::nanoseconds> latencies(
+        m_latencies.begin(), m_latencies.begin() + static_cast<std::ptrdiff_t>(numLatencies));
+    const auto rank = static_cast<size_t>(
+        std::ceil(m_config.m_percentile / 100.0 * static_cast<double>(numLatencies)));
+    const auto percentileIndex = std::clamp<size_t>(rank, 1, numLatencies) - 1;
+    const auto percentileIter  = latencies.begin() + static_cast<std::ptrdiff_t>(percentileIndex);
+    std::nth_element(latencies.begin(), percentileIter, latencies.end());
+    m_delay = std::max(std::chrono::ceil<std::chrono::milliseconds>(*percentileIter),
+                       m_config.m_minDelay);
+}
+
+} // namespace velocitas
@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#ifndef VEHICLE_APP_SDK_VDB_GRPC_COMMON_REQUESTHEDGER_H
+#define VEHICLE_APP_SDK_VDB_GRPC_COMMON_REQUESTHEDGER_H
+
+#include "sdk/vdb/grpc/common/ChannelPool.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace velocitas {
+
+class GrpcCall;
+class ThreadPool;
+
+struct RequestHedgingConfig {
+    /** Percentile of the observed latencies after which a duplicate of a request is sent, e.g.
+     * 95; zero disables hedging */
+    double m_percentile{0.0};
+    /** A duplicate is not sent earlier than this, so a fast databroker does not get duplicates of
+     * every slightly delayed request */
+    std::chrono::milliseconds m_minDelay{DEFAULT_MIN_DELAY};
+
+    static constexpr std::chrono::milliseconds DEFAULT_MIN_DELAY{2};
+
+    /**
+     * @brief Read the configuration from env vars SDV_VDB_HEDGE_PERCENTILE and
+     * SDV_VDB_HEDGE_MIN_DELAY_MS.
+     */
+    static RequestHedgingConfig fromEnvironment();
+};
+
+/**
+ * @brief Hedges requests against stalls of a single databroker (e.g. during garbage collection or
+ * provider churn): if a request got no reply within a delay, a duplicate is sent on an
+ * alternative channel of the pool, preferably to another endpoint. The first reply wins and the
+ * other attempt is cancelled.
+ *
+ * The delay is the configured percentile of the latencies observed recently, so only the slowest
+ * requests are duplicated. Until enough latencies are observed, requests are not hedged.
+ */
+class RequestHedger : public std::enable_shared_from_this<RequestHedger> {
+public:
+    /**
+     * @brief Called by an attempt of a request once it completed, telling whether it got a reply.
+     * Returns true if the outcome of the attempt is the one of the request and is to be handled,
+     * i.e. if it is the first reply, respectively the failure of the last attempt pending.
+     */
+    using Complete_t = std::function<bool(bool isReply)>;
+
+    /**
+     * @brief Issues an attempt of a request on the channel of the passed lease, which is a
+     * duplicate if isHedge is set. The attempt has to call complete once it completed.
+     */
+    using Issue_t = std::function<std::shared_ptr<GrpcCall>(
+        std::shared_ptr<ChannelPool::Lease> lease, bool isHedge, Complete_t complete)>;
+
+    /** Number of recent latencies the delay is derived from */
+    static constexpr size_t NUM_OBSERVATIONS = 256;
+    /** Requests are not hedged before this number of latencies was observed */
+    static constexpr size_t MIN_OBSERVATIONS = 20;
+
+    /**
+     * @brief Create a hedger issuing requests on the channels of the passed pool.
+     *
+     * @return The hedger, null if hedging is disabled or the pool has a single channel only.
+     */
+    static std::shared_ptr<RequestHedger> create(const RequestHedgingConfig&  config,
+                                                 std::shared_ptr<ChannelPool> pool);
+
+    /**
+     * @brief Issue a request on the next channel of the pool, and a duplicate on an alternative
+     * channel if there is no reply within the hedging delay. A failure is only handled once no
+     * other attempt may reply anymore; failed attempts are not retried.
+     *
+     * @param issueAttempt  Issues an attempt of the request.
+     * @return A function cancelling all attempts of the request.
+     */
+    std::function<void()> issue(Issue_t issueAttempt);
+
+    /**
+     * @brief Get the delay after which a duplicate of a request is sent, none until enough
+     * latencies were observed.
+     */
+    [[nodiscard]] std::optional<std::chrono::milliseconds> getDelay() const;
+
+    /**
+     * @brief Record the time from issuing a request until its first reply arrived.
+     */
+    void recordLatency(std::chrono::steady_clock::duration latency);
+
+    [[nodiscard]] uint64_t getNumHedges() const { return m_numHedges; }
+
+    /**
+     * @brief Get the number of requests answered by the duplicate first.
+     */
+    [[nodiscard]] uint64_t getNumHedgeWins() const { return m_numHedgeWins; }
+
+    RequestHedger(const RequestHedger&)            = delete;
+    RequestHedger(RequestHedger&&)                 = delete;
+    RequestHedger& operator=(const RequestHedger&) = delete;
+    RequestHedger& operator=(RequestHedger&&)      = delete;
+    ~RequestHedger()                               = default;
+
+private:
+    struct Request;
+    using RequestPtr_t = std::shared_ptr<Request>;
+
+    RequestHedger(const RequestHedgingConfig& config, std::shared_ptr<ChannelPool> pool);
+
+    void       sendHedge(const RequestPtr_t& request);
+    Complete_t createCompletion(const RequestPtr_t& request, size_t attempt);
+    bool       complete(Request& request, size_t attempt, bool isReply);
+
+    // keeps the call of the attempt to cancel it, or cancels it right away if the request is done
+    static void attachCall(Request& request, size_t attempt, std::shared_ptr<GrpcCall> call);
+    static void cancel(Request& request, ThreadPool& hedgePool);
+
+    const RequestHedgingConfig               m_config;
+    const std::shared_ptr<ChannelPool>       m_pool;
+    // runs the delayed hedge jobs; resolved once, as every request arms and cancels one
+    const std::shared_ptr<ThreadPool>        m_hedgePool;
+    mutable std::mutex                       m_mutex;
+    // ring buffer of the recent latencies
+    std::vector<std::chrono::nanoseconds>    m_latencies;
+    size_t                                   m_numObservations{0};
+    std::optional<std::chrono::milliseconds> m_delay;
+    std::atomic<uint64_t>                    m_numHedges{0};
+    std::atomic<uint64_t>                    m_numHedgeWins{0};
+};
+
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_GRPC_COMMON_REQUESTHEDGER_H
@@ -17,6 +17,14 @@
 #ifndef VEHICLE_APP_SDK_VDB_GRPC_COMMON_TYPECONVERSIONS_H
 #define VEHICLE_APP_SDK_VDB_GRPC_COMMON_TYPECONVERSIONS_H
 
+#include "sdk/DataPointValue.h"
+#include "sdk/Exceptions.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace google::protobuf {
 class Timestamp;
 }
@@ -27,6 +35,82 @@ class Timestamp;
 
 Timestamp convertFromGrpcTimestamp(const google::protobuf::Timestamp& grpcTimestamp) noexcept;
 
+namespace detail {
+template <typename T, typename TVisitor>
+decltype(auto) visitTypedValue(const DataPointValue& dataPoint, TVisitor&& visitor) {
+    // the type tag is set by TypedDataPointValue<T> only, so no dynamic_cast is needed
+    return std::forward<TVisitor>(visitor)(
+        static_cast<const TypedDataPointValue<T>&>(dataPoint).value());
+}
+} // namespace detail
+
+/**
+ * @brief Call the passed visitor with a reference to the value of the passed data point, typed
+ * according to its type tag (e.g. const std::vector<float>& for FLOAT_ARRAY). The value is
+ * neither copied nor looked up via RTTI, so the backends convert values by overloading the call
+ * operator of their visitor for the types (or groups of types) they distinguish.
+ *
+ * @throws InvalidValueException if the data point holds no valid value.
+ * @throws InvalidTypeException if the data point is not of a value type.
+ */
+template <typename TVisitor>
+decltype(auto) visitDataPointValue(const DataPointValue& dataPoint, TVisitor&& visitor) {
+    using detail::visitTypedValue;
+    auto&& vis = std::forward<TVisitor>(visitor);
+    switch (dataPoint.getType()) {
+    case DataPointValue::Type::BOOL:
+        return visitTypedValue<bool>(dataPoint, vis);
+    case DataPointValue::Type::BOOL_ARRAY:
+        return visitTypedValue<std::vector<bool>>(dataPoint, vis);
+    case DataPointValue::Type::INT8:
+        return visitTypedValue<int8_t>(dataPoint, vis);
+    case DataPointValue::Type::INT8_ARRAY:
+        return visitTypedValue<std::vector<int8_t>>(dataPoint, vis);
+    case DataPointValue::Type::INT16:
+        return visitTypedValue<int16_t>(dataPoint, vis);
+    case DataPointValue::Type::INT16_ARRAY:
+        return visitTypedValue<std::vector<int16_t>>(dataPoint, vis);
+    case DataPointValue::Type::INT32:
+        return visitTypedValue<int32_t>(dataPoint, vis);
+    case DataPointValue::Type::INT32_ARRAY:
+        return visitTypedValue<std::vector<int32_t>>(dataPoint, vis);
+    case DataPointValue::Type::INT64:
+        return visitTypedValue<int64_t>(dataPoint, vis);
+    case DataPointValue::Type::INT64_ARRAY:
+        return visitTypedValue<std::vector<int64_t>>(dataPoint, vis);
+    case DataPointValue::Type::UINT8:
+        return visitTypedValue<uint8_t>(dataPoint, vis);
+    case DataPointValue::Type::UINT8_ARRAY:
+        return visitTypedValue<std::vector<uint8_t>>(dataPoint, vis);
+    case DataPointValue::Type::UINT16:
+        return visitTypedValue<uint16_t>(dataPoint, vis);
+    case DataPointValue::Type::UINT16_ARRAY:
+        return visitTypedValue<std::vector<uint16_t>>(dataPoint, vis);
+    case DataPointValue::Type::UINT32:
+        return visitTypedValue<uint32_t>(dataPoint, vis);
+    case DataPointValue::Type::UINT32_ARRAY:
+        return visitTypedValue<std::vector<uint32_t>>(dataPoint, vis);
+    case DataPointValue::Type::UINT64:
+        return visitTypedValue<uint64_t>(dataPoint, vis);
+    case DataPointValue::Type::UINT64_ARRAY:
+        return visitTypedValue<std::vector<uint64_t>>(dataPoint, vis);
+    case DataPointValue::Type::FLOAT:
+        return visitTypedValue<float>(dataPoint, vis);
+    case DataPointValue::Type::FLOAT_ARRAY:
+        return visitTypedValue<std::vector<float>>(dataPoint, vis);
+    case DataPointValue::Type::DOUBLE:
+        return visitTypedValue<double>(dataPoint, vis);
+    case DataPointValue::Type::DOUBLE_ARRAY:
+        return visitTypedValue<std::vector<double>>(dataPoint, vis);
+    case DataPointValue::Type::STRING:
+        return visitTypedValue<std::string>(dataPoint, vis);
+    case DataPointValue::Type::STRING_ARRAY:
+        return visitTypedValue<std::vector<std::string>>(dataPoint, vis);
+    default:
+        throw InvalidTypeException("");
+    }
+}
+
 } // namespace velocitas
 
 #endif // VEHICLE_APP_SDK_VDB_GRPC_COMMON_TYPECONVERSIONS_H
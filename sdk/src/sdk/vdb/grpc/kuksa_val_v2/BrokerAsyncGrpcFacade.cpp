@@ -16,26 +16,78 @@
 
 #include "BrokerAsyncGrpcFacade.h"
 
+#include "sdk/AllocationTracker.h"
 #include "sdk/Logger.h"
 #include "sdk/grpc/GrpcCall.h"
+#include "sdk/vdb/grpc/common/ConnectivityWatcher.h"
 
 #include <grpcpp/channel.h>
 
+#include <tuple>
+
 namespace velocitas::kuksa_val_v2 {
 
+namespace {
+
+/**
+ * @brief Release the lease of a completed call. A call failed with UNAVAILABLE may indicate the
+ * databroker not being reachable, which lets the pool fail over to its next endpoint.
+ */
+void releaseLease(std::shared_ptr<ChannelPool::Lease>& lease, const grpc::Status& status) {
+    if (status.error_code() == grpc::StatusCode::UNAVAILABLE) {
+        lease->reportUnavailable();
+    }
+    lease.reset();
+}
+
+} // namespace
+
 BrokerAsyncGrpcFacade::BrokerAsyncGrpcFacade(const std::shared_ptr<grpc::Channel>& channel)
-    : m_stub{kuksa::val::v2::VAL::NewStub(channel)} {}
+    : BrokerAsyncGrpcFacade(ChannelPool::create({channel}, ChannelSelection::ROUND_ROBIN)) {}
+
+BrokerAsyncGrpcFacade::BrokerAsyncGrpcFacade(std::shared_ptr<ChannelPool> channelPool)
+    : m_channelPool{std::move(channelPool)} {
+    m_stubs.reserve(m_channelPool->getSize());
+    for (size_t i = 0; i < m_channelPool->getSize(); ++i) {
+        m_stubs.push_back(kuksa::val::v2::VAL::NewStub(m_channelPool->getChannel(i)));
+    }
+}
+
+std::pair<BrokerAsyncGrpcFacade::Stub_t*, std::shared_ptr<ChannelPool::Lease>>
+BrokerAsyncGrpcFacade::selectStub() {
+    auto lease = m_channelPool->acquire();
+    return {m_stubs[lease->getIndex()].get(), std::move(lease)};
+}
 
-void BrokerAsyncGrpcFacade::GetValues(
+void BrokerAsyncGrpcFacade::waitUntilConnected(std::chrono::milliseconds             timeout,
+                                               std::function<void(bool isConnected)> handler) {
+    // all channels of the active endpoint connect to the same databroker, so one represents it
+    ConnectivityWatcher::getInstance().waitUntilReady(m_channelPool->getPrimaryChannel(), timeout,
+                                                      std::move(handler));
+}
+
+std::shared_ptr<GrpcCall> BrokerAsyncGrpcFacade::GetValues(
     kuksa::val::v2::GetValuesRequest                                       request,
     std::function<void(const kuksa::val::v2::GetValuesResponse& response)> responseHandler,
-    std::function<void(const grpc::Status& status)>                        errorHandler) {
-    auto callData = std::make_shared<GrpcSingleResponseCall<kuksa::val::v2::GetValuesRequest,
-                                                            kuksa::val::v2::GetValuesResponse>>(
-        std::move(request));
+    std::function<void(const grpc::Status& status)>                        errorHandler,
+    Timeout_t                                                              timeout,
+    std::shared_ptr<ChannelPool::Lease>                                    lease) {
+    using Call_t = GrpcSingleResponseCall<kuksa::val::v2::GetValuesRequest,
+                                          kuksa::val::v2::GetValuesResponse>;
+    auto callData = makeSharedIn<AllocationDomain::GRPC_CALLS, Call_t>(std::move(request));
     applyContextModifier(*callData);
-
-    auto grpcResultHandler = [callData, responseHandler, errorHandler](grpc::Status status) {
+    applyDeadline(*callData, timeout);
+    applyCompression(*callData, callData->m_request);
+
+    Stub_t* stub{nullptr};
+    if (lease) {
+        stub = m_stubs[lease->getIndex()].get();
+    } else {
+        std::tie(stub, lease) = selectStub();
+    }
+    auto grpcResultHandler = [callData, responseHandler, errorHandler,
+                              lease = std::move(lease)](grpc::Status status) mutable {
+        callData->recordCompletion(status);
         try {
             if (status.ok()) {
                 responseHandler(callData->m_response);
@@ -45,23 +97,33 @@ void BrokerAsyncGrpcFacade::GetValues(
         } catch (std::exception& e) {
             logger().error("GRPC: Exception occurred during \"GetValues\": {}", e.what());
         }
+        releaseLease(lease, status);
         callData->m_isComplete = true;
     };
 
-    m_stub->async()->GetValues(&callData->m_context, &callData->m_request, &callData->m_response,
-                               grpcResultHandler);
+    addActiveCall(callData);
+
+    stub->async()->GetValues(&callData->m_context, &callData->m_request, &callData->m_response,
+                             grpcResultHandler);
+    return callData;
 }
 
-void BrokerAsyncGrpcFacade::BatchActuate(
+std::shared_ptr<GrpcCall> BrokerAsyncGrpcFacade::BatchActuate(
     kuksa::val::v2::BatchActuateRequest                                       request,
     std::function<void(const kuksa::val::v2::BatchActuateResponse& response)> responseHandler,
-    std::function<void(const grpc::Status& status)>                           errorHandler) {
-    auto callData = std::make_shared<GrpcSingleResponseCall<kuksa::val::v2::BatchActuateRequest,
-                                                            kuksa::val::v2::BatchActuateResponse>>(
-        std::move(request));
+    std::function<void(const grpc::Status& status)>                           errorHandler,
+    Timeout_t                                                                 timeout) {
+    using Call_t = GrpcSingleResponseCall<kuksa::val::v2::BatchActuateRequest,
+                                          kuksa::val::v2::BatchActuateResponse>;
+    auto callData = makeSharedIn<AllocationDomain::GRPC_CALLS, Call_t>(std::move(request));
     applyContextModifier(*callData);
+    applyDeadline(*callData, timeout);
+    applyCompression(*callData, callData->m_request);
 
-    auto grpcResultHandler = [callData, responseHandler, errorHandler](grpc::Status status) {
+    auto [stub, lease]     = selectStub();
+    auto grpcResultHandler = [callData, responseHandler, errorHandler,
+                              lease = std::move(lease)](grpc::Status status) mutable {
+        callData->recordCompletion(status);
         try {
             if (status.ok()) {
                 responseHandler(callData->m_response);
@@ -71,42 +133,80 @@ void BrokerAsyncGrpcFacade::BatchActuate(
         } catch (std::exception& e) {
             logger().error("GRPC: Exception occurred during \"BatchActuate\": {}", e.what());
         }
+        releaseLease(lease, status);
         callData->m_isComplete = true;
     };
 
-    m_stub->async()->BatchActuate(&callData->m_context, &callData->m_request, &callData->m_response,
-                                  grpcResultHandler);
+    addActiveCall(callData);
+
+    stub->async()->BatchActuate(&callData->m_context, &callData->m_request, &callData->m_response,
+                                grpcResultHandler);
+    return callData;
 }
 
 std::shared_ptr<GrpcCall> BrokerAsyncGrpcFacade::SubscribeById(
-    kuksa::val::v2::SubscribeByIdRequest                                       request,
-    std::function<void(const kuksa::val::v2::SubscribeByIdResponse& response)> updateHandler,
-    std::function<void(const grpc::Status& status)>                            finishHandler) {
-    auto callData =
-        std::make_shared<GrpcStreamingResponseCall<kuksa::val::v2::SubscribeByIdRequest,
-                                                   kuksa::val::v2::SubscribeByIdResponse>>(
-            std::move(request));
+    kuksa::val::v2::SubscribeByIdRequest                                 request,
+    std::function<void(kuksa::val::v2::SubscribeByIdResponse& response)> updateHandler,
+    std::function<void(const grpc::Status& status)>                      finishHandler) {
+    using Call_t = GrpcStreamingResponseCall<kuksa::val::v2::SubscribeByIdRequest,
+                                             kuksa::val::v2::SubscribeByIdResponse>;
+    auto callData = makeSharedIn<AllocationDomain::GRPC_CALLS, Call_t>(std::move(request));
     applyContextModifier(*callData);
+    applyCompression(*callData, callData->getRequest());
 
-    m_stub->async()->SubscribeById(&callData->m_context, &callData->getRequest(),
-                                   &callData->getReactor());
+    auto [stub, lease] = selectStub();
+    stub->async()->SubscribeById(&callData->m_context, &callData->getRequest(),
+                                 &callData->getReactor());
 
     callData->onData(updateHandler);
-    callData->onFinish(finishHandler);
+    callData->onFinish([finishHandler, lease = std::move(lease)](const auto& status) mutable {
+        releaseLease(lease, status);
+        finishHandler(status);
+    });
+    callData->startCall();
+    return callData;
+}
+
+std::shared_ptr<GrpcStreamingRequestCall<kuksa::val::v2::OpenProviderStreamRequest>>
+BrokerAsyncGrpcFacade::OpenProviderStream(
+    std::function<void(kuksa::val::v2::OpenProviderStreamResponse& response)> responseHandler,
+    std::function<void(bool isOk)>                                             writeDoneHandler,
+    std::function<void(const grpc::Status& status)>                            finishHandler) {
+    using Call_t = GrpcBidiStreamingCall<kuksa::val::v2::OpenProviderStreamRequest,
+                                         kuksa::val::v2::OpenProviderStreamResponse>;
+    auto callData = makeSharedIn<AllocationDomain::GRPC_CALLS, Call_t>();
+    applyContextModifier(*callData);
+    callData->setCompressionFilter(applyStreamCompression(*callData));
+
+    auto [stub, lease] = selectStub();
+    stub->async()->OpenProviderStream(&callData->m_context, &callData->getReactor());
+
+    callData->onData(responseHandler);
+    callData->onWriteDone(writeDoneHandler);
+    callData->onFinish([finishHandler, lease = std::move(lease)](const auto& status) mutable {
+        releaseLease(lease, status);
+        finishHandler(status);
+    });
     callData->startCall();
     return callData;
 }
 
-void BrokerAsyncGrpcFacade::ListMetadata(
+std::shared_ptr<GrpcCall> BrokerAsyncGrpcFacade::ListMetadata(
     kuksa::val::v2::ListMetadataRequest                                       request,
     std::function<void(const kuksa::val::v2::ListMetadataResponse& response)> responseHandler,
-    std::function<void(const grpc::Status& status)>                           errorHandler) {
-    auto callData = std::make_shared<GrpcSingleResponseCall<kuksa::val::v2::ListMetadataRequest,
-                                                            kuksa::val::v2::ListMetadataResponse>>(
-        std::move(request));
+    std::function<void(const grpc::Status& status)>                           errorHandler,
+    Timeout_t                                                                 timeout) {
+    using Call_t = GrpcSingleResponseCall<kuksa::val::v2::ListMetadataRequest,
+                                          kuksa::val::v2::ListMetadataResponse>;
+    auto callData = makeSharedIn<AllocationDomain::GRPC_CALLS, Call_t>(std::move(request));
     applyContextModifier(*callData);
+    applyDeadline(*callData, timeout);
+    applyCompression(*callData, callData->m_request);
 
-    auto grpcResultHandler = [callData, responseHandler, errorHandler](grpc::Status status) {
+    auto [stub, lease]     = selectStub();
+    auto grpcResultHandler = [callData, responseHandler, errorHandler,
+                              lease = std::move(lease)](grpc::Status status) mutable {
+        callData->recordCompletion(status);
         try {
             if (status.ok()) {
                 responseHandler(callData->m_response);
@@ -116,11 +216,15 @@ void BrokerAsyncGrpcFacade::ListMetadata(
         } catch (std::exception& e) {
             logger().error("GRPC: Exception occurred during \"ListMetadata\": {}", e.what());
         }
+        releaseLease(lease, status);
         callData->m_isComplete = true;
     };
 
-    m_stub->async()->ListMetadata(&callData->m_context, &callData->m_request, &callData->m_response,
-                                  grpcResultHandler);
+    addActiveCall(callData);
+
+    stub->async()->ListMetadata(&callData->m_context, &callData->m_request, &callData->m_response,
+                                grpcResultHandler);
+    return callData;
 }
 
 } // namespace velocitas::kuksa_val_v2
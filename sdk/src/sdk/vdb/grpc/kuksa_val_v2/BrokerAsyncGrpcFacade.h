@@ -19,11 +19,16 @@
 
 #include "sdk/grpc/AsyncGrpcFacade.h"
 #include "sdk/grpc/GrpcCall.h"
+#include "sdk/grpc/GrpcClient.h"
+#include "sdk/vdb/grpc/common/ChannelPool.h"
 
 #include "kuksa/val/v2/val.grpc.pb.h"
 
+#include <chrono>
 #include <functional>
 #include <memory>
+#include <optional>
+#include <vector>
 
 namespace grpc {
 class Channel;
@@ -32,31 +37,92 @@ class Status;
 
 namespace velocitas::kuksa_val_v2 {
 
-class BrokerAsyncGrpcFacade : public AsyncGrpcFacade {
+class BrokerAsyncGrpcFacade : public AsyncGrpcFacade, GrpcClient {
 public:
     explicit BrokerAsyncGrpcFacade(const std::shared_ptr<grpc::Channel>& channel);
 
-    void GetValues(kuksa::val::v2::GetValuesRequest                                    request,
-                   std::function<void(const kuksa::val::v2::GetValuesResponse& reply)> replyHandler,
-                   std::function<void(const grpc::Status& status)> errorHandler);
+    /**
+     * @brief Issue each call on one of the channels of the passed pool.
+     */
+    explicit BrokerAsyncGrpcFacade(std::shared_ptr<ChannelPool> channelPool);
+
+    /**
+     * @brief Calls expecting a single response fail with DEADLINE_EXCEEDED after the passed
+     * timeout, respectively after the facade's call timeout if none is passed. The returned
+     * call may be used to cancel it.
+     *
+     * GetValues is issued on the channel of the passed lease if any, e.g. to issue a duplicate
+     * of a call on another channel than the original one.
+     */
+    std::shared_ptr<GrpcCall>
+    GetValues(kuksa::val::v2::GetValuesRequest                                    request,
+              std::function<void(const kuksa::val::v2::GetValuesResponse& reply)> replyHandler,
+              std::function<void(const grpc::Status& status)>                     errorHandler,
+              Timeout_t                                                           timeout = {},
+              std::shared_ptr<ChannelPool::Lease>                                 lease   = {});
 
     std::shared_ptr<GrpcCall> SubscribeById(
-        kuksa::val::v2::SubscribeByIdRequest                                     request,
-        std::function<void(const kuksa::val::v2::SubscribeByIdResponse& update)> updateHandler,
-        std::function<void(const grpc::Status& status)>                          errorHandler);
+        kuksa::val::v2::SubscribeByIdRequest                               request,
+        std::function<void(kuksa::val::v2::SubscribeByIdResponse& update)> updateHandler,
+        std::function<void(const grpc::Status& status)>                    errorHandler);
 
-    void BatchActuate(
+    std::shared_ptr<GrpcCall> BatchActuate(
         kuksa::val::v2::BatchActuateRequest                                    request,
         std::function<void(const kuksa::val::v2::BatchActuateResponse& reply)> replyHandler,
-        std::function<void(const grpc::Status& status)>                        errorHandler);
+        std::function<void(const grpc::Status& status)>                        errorHandler,
+        Timeout_t                                                              timeout = {});
+
+    /**
+     * @brief Cancel the calls expecting a single response which are still awaiting it. Streaming
+     * calls are owned and cancelled by their users.
+     */
+    using GrpcClient::cancelActiveCalls;
 
-    void ListMetadata(
+    /**
+     * @brief Open a provider stream; requests written to the returned call are sent in order.
+     */
+    std::shared_ptr<GrpcStreamingRequestCall<kuksa::val::v2::OpenProviderStreamRequest>>
+    OpenProviderStream(
+        std::function<void(kuksa::val::v2::OpenProviderStreamResponse& response)> responseHandler,
+        std::function<void(bool isOk)>                                             writeDoneHandler,
+        std::function<void(const grpc::Status& status)>                            finishHandler);
+
+    std::shared_ptr<GrpcCall> ListMetadata(
         kuksa::val::v2::ListMetadataRequest                                    request,
         std::function<void(const kuksa::val::v2::ListMetadataResponse& reply)> replyHandler,
-        std::function<void(const grpc::Status& status)>                        errorHandler);
+        std::function<void(const grpc::Status& status)>                        errorHandler,
+        Timeout_t                                                              timeout = {});
+
+    /**
+     * @brief Wait for the connection to the databroker to be ready, watching the state of the
+     * channel instead of issuing calls.
+     *
+     * @param timeout  Maximum time to wait.
+     * @param handler  Called with true once connected, with false if not connected in time.
+     */
+    void waitUntilConnected(std::chrono::milliseconds             timeout,
+                            std::function<void(bool isConnected)> handler);
+
+    /**
+     * @brief Get the maximum size of requests and responses exchanged with the databroker.
+     */
+    [[nodiscard]] size_t getMaxMessageSize() const { return m_channelPool->getMaxMessageSize(); }
+
+    [[nodiscard]] const std::shared_ptr<ChannelPool>& getChannelPool() const {
+        return m_channelPool;
+    }
 
 private:
-    std::unique_ptr<kuksa::val::v2::VAL::StubInterface> m_stub;
+    using Stub_t = kuksa::val::v2::VAL::StubInterface;
+
+    /**
+     * @brief Select the stub to issue the next call on; the returned lease has to be kept until
+     * the call is complete.
+     */
+    std::pair<Stub_t*, std::shared_ptr<ChannelPool::Lease>> selectStub();
+
+    std::shared_ptr<ChannelPool>         m_channelPool;
+    std::vector<std::unique_ptr<Stub_t>> m_stubs;
 };
 
 } // namespace velocitas::kuksa_val_v2
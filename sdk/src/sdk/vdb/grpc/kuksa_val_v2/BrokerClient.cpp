@@ -17,24 +17,27 @@
 #include "BrokerClient.h"
 
 #include "sdk/DataPointValue.h"
+#include "sdk/Exceptions.h"
 #include "sdk/Logger.h"
-#include "sdk/ThreadPool.h"
+#include "sdk/SignalPathRegistry.h"
 #include "sdk/Utils.h"
 #include "sdk/grpc/GrpcCall.h"
-#include "sdk/grpc/GrpcClient.h"
 #include "sdk/middleware/Middleware.h"
-#include "sdk/vdb/grpc/common/ChannelConfiguration.h"
+#include "sdk/vdb/QueryPredicate.h"
+#include "sdk/vdb/grpc/common/ChannelPool.h"
 #include "sdk/vdb/grpc/kuksa_val_v2/BrokerAsyncGrpcFacade.h"
 #include "sdk/vdb/grpc/kuksa_val_v2/Metadata.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/ProviderStream.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/SubscriptionMultiplexer.h"
 #include "sdk/vdb/grpc/kuksa_val_v2/TypeConversions.h"
 
 #include <fmt/core.h>
 #include <grpcpp/channel.h>
-#include <grpcpp/create_channel.h>
-#include <grpcpp/security/credentials.h>
 
+#include <chrono>
 #include <limits>
-#include <shared_mutex>
+#include <mutex>
+#include <optional>
 #include <stdexcept>
 #include <utility>
 
@@ -42,12 +45,6 @@ namespace velocitas::kuksa_val_v2 {
 
 namespace {
 
-const unsigned int DEFAULT_SUBSCRIBE_BUFFER_SIZE = 0;
-
-const std::chrono::milliseconds RESUBSCRIBE_DELAY_INITIAL{100};
-const std::chrono::milliseconds RESUBSCRIBE_DELAY_MAX{2000};
-const unsigned int              RESUBSCRIBE_DELAY_FACTOR{2};
-
 int assertProtobufArrayLimits(size_t numElements) {
     if (numElements > std::numeric_limits<int>::max()) {
         throw std::runtime_error("# requested datapoints exceeds gRPC limits");
@@ -55,13 +52,150 @@ int assertProtobufArrayLimits(size_t numElements) {
     return static_cast<int>(numElements);
 }
 
+/**
+ * @brief Get the branches to prefetch the metadata of at connect time, as specified via the
+ * comma separated list in env var SDV_METADATA_PREFETCH, e.g. "Vehicle".
+ */
+std::vector<std::string> getPrefetchedBranches() {
+    std::vector<std::string> branches;
+    const auto               branchList = getEnvVar("SDV_METADATA_PREFETCH");
+    size_t                   begin      = 0;
+    while (begin <= branchList.size()) {
+        auto end = branchList.find(',', begin);
+        if (end == std::string::npos) {
+            end = branchList.size();
+        }
+        auto branch = branchList.substr(begin, end - begin);
+        branch.erase(0, branch.find_first_not_of(' '));
+        branch.erase(branch.find_last_not_of(' ') + 1);
+        if (!branch.empty()) {
+            branches.push_back(std::move(branch));
+        }
+        begin = end + 1;
+    }
+    return branches;
+}
+
+/**
+ * @brief Get the maximum age of subscribed values to answer getDatapoints with, as specified via
+ * env var SDV_LATEST_VALUE_CACHE_MAX_AGE_MS; zero (the default) disables answering from the
+ * subscriptions.
+ */
+std::chrono::milliseconds getLatestValueMaxAge() {
+    std::chrono::milliseconds maxAge{0};
+    try {
+        auto maxAgeStr = getEnvVar("SDV_LATEST_VALUE_CACHE_MAX_AGE_MS");
+        if (!maxAgeStr.empty()) {
+            maxAge = std::chrono::milliseconds{std::stoul(maxAgeStr)};
+        }
+    } catch (...) {
+        logger().error("Invalid latest value cache max age specified via env var! Using default "
+                       "(disabled).");
+    }
+    return maxAge;
+}
+
+/**
+ * @brief Let cancelling the passed result cancel the results of all of its chunks.
+ */
+template <typename TResultType>
+void bindChunkCancellation(AsyncResult<TResultType>&                         result,
+                           const std::vector<AsyncResultPtr_t<TResultType>>& chunkResults) {
+    // weak references only, as the chunk results refer to the result via the combined one
+    std::vector<std::weak_ptr<AsyncResult<TResultType>>> weakChunkResults(chunkResults.cbegin(),
+                                                                          chunkResults.cend());
+    result.setCancellationHandler([weakChunkResults = std::move(weakChunkResults)]() {
+        for (const auto& weakChunkResult : weakChunkResults) {
+            if (auto chunkResult = weakChunkResult.lock()) {
+                chunkResult->cancel();
+            }
+        }
+    });
+}
+
+/**
+ * @brief Create the request of the values of the known signals of the passed list. Ids are only
+ * valid for the databroker they were read from, so requests sent to another endpoint address the
+ * signals by path.
+ */
+kuksa::val::v2::GetValuesRequest createGetValuesRequest(const MetadataList_t& metadataList,
+                                                        bool                  isAddressedByPath) {
+    kuksa::val::v2::GetValuesRequest request;
+    auto&                            signalIds = *request.mutable_signal_ids();
+    signalIds.Reserve(assertProtobufArrayLimits(metadataList.size()));
+    for (const auto& metadata : metadataList) {
+        if (!metadata->m_isKnown) {
+            continue;
+        }
+        if (isAddressedByPath) {
+            signalIds.Add()->set_path(metadata->m_signalPath);
+        } else {
+            signalIds.Add()->set_id(metadata->m_id);
+        }
+    }
+    return request;
+}
+
+/**
+ * @brief Get the newest timestamp of the values of a response, a sample of the databroker's clock
+ * for the ClockOffsetEstimator.
+ */
+std::optional<Timestamp> getNewestTimestamp(const kuksa::val::v2::GetValuesResponse& response) {
+    std::optional<Timestamp> newestTimestamp;
+    for (const auto& dataPoint : response.data_points()) {
+        if (!dataPoint.has_timestamp()) {
+            continue;
+        }
+        const auto& timestamp = dataPoint.timestamp();
+        if (!newestTimestamp || timestamp.seconds() > newestTimestamp->seconds ||
+            (timestamp.seconds() == newestTimestamp->seconds &&
+             timestamp.nanos() > newestTimestamp->nanos)) {
+            newestTimestamp = Timestamp{timestamp.seconds(), timestamp.nanos()};
+        }
+    }
+    return newestTimestamp;
+}
+
+MetadataAgentConfig getMetadataAgentConfig(const std::string& vdbAddress) {
+    auto config = MetadataAgentConfig::fromEnvironment();
+    // a persisted cache is only valid for the databroker it was read from
+    config.m_brokerIdentity = vdbAddress;
+    return config;
+}
+
 } // namespace
 
 BrokerClient::BrokerClient(const std::string& vdbAddress, const std::string& vdbServiceName)
-    : m_asyncBrokerFacade(std::make_shared<BrokerAsyncGrpcFacade>(grpc::CreateCustomChannel(
-          vdbAddress, grpc::InsecureChannelCredentials(), getChannelArguments())))
-    , m_metadataAgent(MetadataAgent::create(m_asyncBrokerFacade))
-    , m_activeCalls(std::make_unique<GrpcClient>()) {
+    : m_asyncBrokerFacade(std::make_shared<BrokerAsyncGrpcFacade>(
+          ChannelPool::getShared(vdbAddress, ChannelPoolConfig::fromEnvironment())))
+    , m_metadataAgent(
+          MetadataAgent::create(m_asyncBrokerFacade, getMetadataAgentConfig(vdbAddress)))
+    , m_clockOffsetEstimator(std::make_shared<ClockOffsetEstimator>())
+    , m_subscriptionMultiplexer(SubscriptionMultiplexer::create(
+          [facade = m_asyncBrokerFacade](auto request, auto updateHandler, auto finishHandler) {
+              return facade->SubscribeById(std::move(request), std::move(updateHandler),
+                                           std::move(finishHandler));
+          },
+          m_metadataAgent, SubscriptionMultiplexer::DEFAULT_COALESCING_DELAY,
+          [facade = m_asyncBrokerFacade](auto timeout, auto handler) {
+              facade->waitUntilConnected(timeout, std::move(handler));
+          },
+          m_clockOffsetEstimator))
+    , m_providerStream(ProviderStream::create(
+          [facade = m_asyncBrokerFacade](auto responseHandler, auto writeDoneHandler,
+                                         auto finishHandler) {
+              return facade->OpenProviderStream(std::move(responseHandler),
+                                                std::move(writeDoneHandler),
+                                                std::move(finishHandler));
+          },
+          m_metadataAgent))
+    , m_latestValueMaxAge(getLatestValueMaxAge())
+    , m_readCoalescer([this](const auto& signalPaths) { return requestDatapoints(signalPaths); })
+    , m_readChunker(RequestChunkerConfig::fromEnvironment(m_asyncBrokerFacade->getMaxMessageSize()))
+    , m_actuateChunker(
+          RequestChunkerConfig::fromEnvironment(m_asyncBrokerFacade->getMaxMessageSize()))
+    , m_readHedger(RequestHedger::create(RequestHedgingConfig::fromEnvironment(),
+                                         m_asyncBrokerFacade->getChannelPool())) {
     logger().info("Connecting to data broker service '{}' via '{}'", vdbServiceName, vdbAddress);
     Middleware::Metadata metadata = Middleware::getInstance().getMetadata(vdbServiceName);
     m_asyncBrokerFacade->setContextModifier([metadata](auto& context) {
@@ -69,6 +203,23 @@ BrokerClient::BrokerClient(const std::string& vdbAddress, const std::string& vdb
             context.AddMetadata(metadatum.first, metadatum.second);
         }
     });
+    // signals may have got other ids than the (persistently) cached ones, so the running
+    // streams need to subscribe the new ids
+    m_metadataAgent->setChangeHandler(
+        [weakMultiplexer = std::weak_ptr<SubscriptionMultiplexer>(m_subscriptionMultiplexer)]() {
+            if (auto multiplexer = weakMultiplexer.lock()) {
+                multiplexer->restart();
+            }
+        });
+    // the channels connect concurrently to the prefetch of the metadata
+    const auto prewarmConfig = ChannelPrewarmConfig::fromEnvironment();
+    if (prewarmConfig.m_timeout.count() > 0) {
+        m_prewarmer = ChannelPrewarmer::start(*m_asyncBrokerFacade->getChannelPool(),
+                                              prewarmConfig.m_timeout);
+    }
+    for (const auto& branch : getPrefetchedBranches()) {
+        m_metadataAgent->prefetch(branch);
+    }
 }
 
 BrokerClient::BrokerClient(const std::string& vdbServiceName)
@@ -78,28 +229,173 @@ BrokerClient::~BrokerClient() {}
 
 AsyncResultPtr_t<DataPointReply>
 BrokerClient::getDatapoints(const std::vector<std::string>& signalPaths) {
+    if (m_latestValueMaxAge.count() == 0) {
+        return withCallbackExecutor(m_readCoalescer.read(signalPaths));
+    }
+
+    // answer from the values of active subscriptions, only the misses are requested
+    DataPointReply           cachedDataPoints;
+    std::vector<std::string> missingPaths;
+    auto&                    registry = SignalPathRegistry::getInstance();
+    for (const auto& path : signalPaths) {
+        const auto signal = registry.intern(path);
+        if (auto sample = m_subscriptionMultiplexer->getLatestSample(signal, m_latestValueMaxAge)) {
+            cachedDataPoints.set(signal, std::move(*sample));
+        } else {
+            missingPaths.push_back(path);
+        }
+    }
+    if (missingPaths.empty()) {
+        auto result = withCallbackExecutor(std::make_shared<AsyncResult<DataPointReply>>());
+        result->insertResult(std::move(cachedDataPoints));
+        return result;
+    }
+    if (cachedDataPoints.size() == 0) {
+        return withCallbackExecutor(m_readCoalescer.read(missingPaths));
+    }
+    return withCallbackExecutor(m_readCoalescer.read(missingPaths)->then(
+        [cachedDataPoints = std::move(cachedDataPoints)](const DataPointReply& fetched) {
+            auto reply = cachedDataPoints;
+            reply.reserve(reply.size() + fetched.size());
+            for (const auto& entry : fetched) {
+                reply.set(entry.m_handle, DataPointReply::getSample(entry));
+            }
+            return reply;
+        }));
+}
+
+AsyncResultPtr_t<Status> BrokerClient::prepare(const std::vector<std::string>& signalPaths,
+                                               std::chrono::milliseconds       timeout) {
+    auto result = withCallbackExecutor(std::make_shared<AsyncResult<Status>>());
+    m_asyncBrokerFacade->waitUntilConnected(
+        timeout, [result, signalPaths, weakAgent = std::weak_ptr<MetadataAgent>(m_metadataAgent),
+                  timeout](bool isConnected) {
+            if (!isConnected) {
+                result->insertError(Status(
+                    fmt::format("Databroker not connected within {} ms", timeout.count())));
+                return;
+            }
+            auto agent = weakAgent.lock();
+            if (!agent || signalPaths.empty()) {
+                result->insertResult(Status());
+                return;
+            }
+            agent->query(
+                signalPaths, [result](MetadataList_t&&) { result->insertResult(Status()); },
+                [result](const grpc::Status& status) {
+                    result->insertError(Status(status.error_message()));
+                });
+        });
+    return result;
+}
+
+AsyncResultPtr_t<Status> BrokerClient::whenReady() {
+    if (!m_prewarmer) {
+        return IVehicleDataBrokerClient::whenReady();
+    }
+    return withCallbackExecutor(m_prewarmer->whenReady());
+}
+
+size_t BrokerClient::cancelPendingRequests() { return m_asyncBrokerFacade->cancelActiveCalls(); }
+
+void BrokerClient::setExecutor(ExecutorPtr_t executor) {
+    IVehicleDataBrokerClient::setExecutor(executor);
+    m_metadataAgent->setExecutor(executor);
+    m_subscriptionMultiplexer->setExecutor(std::move(executor));
+}
+
+class BrokerClient::PreparedSet : public IPreparedSet {
+public:
+    PreparedSet(BrokerClient& client, const std::vector<std::string>& signalPaths)
+        : m_client(client) {
+        auto& registry = SignalPathRegistry::getInstance();
+        auto& requests = *m_request.mutable_actuate_requests();
+        requests.Reserve(assertProtobufArrayLimits(signalPaths.size()));
+        m_signals.reserve(signalPaths.size());
+        for (const auto& path : signalPaths) {
+            requests.Add()->mutable_signal_id()->set_path(path);
+            m_signals.push_back(registry.intern(path));
+        }
+    }
+
+    AsyncResultPtr_t<SetErrorMap_t>
+    apply(const std::vector<std::unique_ptr<DataPointValue>>& values, SetMode mode) override {
+        if (mode == SetMode::PUBLISH) {
+            return m_client.setDatapoints(values, mode);
+        }
+        if (values.size() != m_signals.size()) {
+            throw InvalidValueException(
+                fmt::format("Prepared set of {} signals applied with {} values", m_signals.size(),
+                            values.size()));
+        }
+
+        auto result = m_client.withCallbackExecutor(std::make_shared<AsyncResult<SetErrorMap_t>>());
+        kuksa::val::v2::BatchActuateRequest request;
+        std::vector<SignalHandle_t>         signalsById;
+        {
+            std::lock_guard lock(m_mutex);
+            for (size_t i = 0; i < m_signals.size(); ++i) {
+                auto& actuateRequest = *m_request.mutable_actuate_requests(static_cast<int>(i));
+                if (updateSignalId(m_signals[i], *actuateRequest.mutable_signal_id())) {
+                    signalsById.push_back(m_signals[i]);
+                }
+                convertToGrpcValue(*values[i], *actuateRequest.mutable_value());
+            }
+            // the call owns its request until it is sent, while the kept one is updated further
+            request = m_request;
+        }
+        m_client.batchActuate(std::move(request), result, std::move(signalsById));
+        return result;
+    }
+
+private:
+    // The id is looked up per apply, so ids changed by a databroker restart are picked up.
+    // Returns true if the signal is addressed by id.
+    bool updateSignalId(SignalHandle_t signal, kuksa::val::v2::SignalID& signalId) const {
+        const auto metadata = m_client.m_metadataAgent->getByHandle(signal);
+        if (metadata && metadata->m_isKnown) {
+            if (!signalId.has_id() || signalId.id() != metadata->m_id) {
+                signalId.set_id(metadata->m_id);
+            }
+            return true;
+        }
+        if (!signalId.has_path()) {
+            signalId.set_path(SignalPathRegistry::getInstance().getPath(signal));
+        }
+        return false;
+    }
+
+    BrokerClient&                       m_client;
+    std::vector<SignalHandle_t>         m_signals;
+    std::mutex                          m_mutex;
+    kuksa::val::v2::BatchActuateRequest m_request;
+};
+
+std::shared_ptr<IPreparedSet>
+BrokerClient::prepareSet(const std::vector<std::string>& signalPaths) {
+    auto preparedSet = std::make_shared<PreparedSet>(*this, signalPaths);
+    // resolves the ids in the background; until then the signals are addressed by path
+    m_metadataAgent->query(
+        signalPaths, [](MetadataList_t&&) {},
+        [](const grpc::Status& status) {
+            logger().debug("Prepared set addresses its signals by path: {}",
+                           status.error_message());
+        });
+    return preparedSet;
+}
+
+AsyncResultPtr_t<DataPointReply>
+BrokerClient::requestDatapoints(const std::vector<std::string>& signalPaths) {
     auto result = std::make_shared<AsyncResult<DataPointReply>>();
     m_metadataAgent->query(
         signalPaths,
         [this, result](MetadataList_t&& metadataList) {
-            kuksa::val::v2::GetValuesRequest request;
-            auto&                            signalIds = *request.mutable_signal_ids();
-            signalIds.Reserve(assertProtobufArrayLimits(metadataList.size()));
-            size_t numRequestedSignals = 0;
-            for (const auto& metadata : metadataList) {
-                if (metadata->m_isKnown) {
-                    signalIds.Add()->set_id(metadata->m_id);
-                    ++numRequestedSignals;
-                }
+            const auto chunkSizes = m_readChunker.split(metadataList.size());
+            if (chunkSizes.size() == 1) {
+                requestValues(metadataList, result);
+            } else {
+                requestValuesChunked(metadataList, chunkSizes, result);
             }
-            m_asyncBrokerFacade->GetValues(
-                std::move(request),
-                [this, result, metadataList, numRequestedSignals](auto response) {
-                    onGetValuesResponse(response, metadataList, numRequestedSignals, result);
-                },
-                [this, result, metadataList](auto status) {
-                    onGetValuesError(status, metadataList, result);
-                });
         },
         [this, result](const auto& status) {
             if (status.error_code() == grpc::StatusCode::UNAVAILABLE) {
@@ -111,27 +407,103 @@ BrokerClient::getDatapoints(const std::vector<std::string>& signalPaths) {
     return result;
 }
 
+void BrokerClient::requestValues(const MetadataList_t&                   metadataList,
+                                 const AsyncResultPtr_t<DataPointReply>& result) {
+    auto       request             = createGetValuesRequest(metadataList, false);
+    const auto numRequestedSignals = static_cast<size_t>(request.signal_ids_size());
+    const auto requestedAt         = std::chrono::steady_clock::now();
+
+    auto responseHandler = [this, result, metadataList, numRequestedSignals,
+                            requestedAt](const auto& response) {
+        const auto receivedAt = std::chrono::steady_clock::now();
+        m_readChunker.recordResponse(numRequestedSignals, receivedAt - requestedAt,
+                                     response.ByteSizeLong());
+        if (const auto newestTimestamp = getNewestTimestamp(response)) {
+            m_clockOffsetEstimator->addRoundTrip(requestedAt, *newestTimestamp, receivedAt);
+        }
+        onGetValuesResponse(response, metadataList, numRequestedSignals, result);
+    };
+    auto errorHandler    = [this, result, metadataList](const auto& status) {
+        onGetValuesError(status, metadataList, result);
+    };
+    if (!m_readHedger) {
+        auto call = m_asyncBrokerFacade->GetValues(std::move(request), std::move(responseHandler),
+                                                   std::move(errorHandler));
+        bindCancellation(*result, call);
+        return;
+    }
+
+    // a duplicate is sent to another endpoint if there are several, see ChannelPool
+    const auto isHedgeOnOtherEndpoint =
+        m_asyncBrokerFacade->getChannelPool()->getNumEndpoints() > 1;
+    result->setCancellationHandler(m_readHedger->issue(
+        [this, metadataList, request = std::move(request), responseHandler, errorHandler,
+         isHedgeOnOtherEndpoint](auto lease, bool isHedge, auto complete) {
+            return m_asyncBrokerFacade->GetValues(
+                (isHedge && isHedgeOnOtherEndpoint) ? createGetValuesRequest(metadataList, true)
+                                                    : request,
+                [responseHandler, complete](const auto& response) {
+                    if (complete(true)) {
+                        responseHandler(response);
+                    }
+                },
+                [errorHandler, complete](const auto& status) {
+                    if (complete(false)) {
+                        errorHandler(status);
+                    }
+                },
+                {}, std::move(lease));
+        }));
+}
+
+void BrokerClient::requestValuesChunked(const MetadataList_t&                   metadataList,
+                                        const std::vector<size_t>&              chunkSizes,
+                                        const AsyncResultPtr_t<DataPointReply>& result) {
+    logger().debug("Reading {} signals in {} chunks", metadataList.size(), chunkSizes.size());
+    std::vector<AsyncResultPtr_t<DataPointReply>> chunkResults;
+    chunkResults.reserve(chunkSizes.size());
+    auto chunkBegin = metadataList.cbegin();
+    for (const auto chunkSize : chunkSizes) {
+        auto chunkResult = std::make_shared<AsyncResult<DataPointReply>>();
+        requestValues(MetadataList_t(chunkBegin, chunkBegin + chunkSize), chunkResult);
+        chunkBegin += chunkSize;
+        chunkResults.push_back(std::move(chunkResult));
+    }
+    bindChunkCancellation(*result, chunkResults);
+    whenAll(chunkResults)
+        ->onResult([result, numSignals = metadataList.size()](const auto& chunkReplies) {
+            DataPointReply reply;
+            reply.reserve(numSignals);
+            for (const auto& chunkReply : chunkReplies) {
+                reply.merge(DataPointReply(chunkReply));
+            }
+            result->insertResult(std::move(reply));
+        })
+        ->onError([result](Status status) { result->insertError(std::move(status)); });
+}
+
 void BrokerClient::onGetValuesResponse(const kuksa::val::v2::GetValuesResponse& response,
                                        const MetadataList_t&                    metadataList,
                                        const size_t                             numRequestedSignals,
                                        const AsyncResultPtr_t<DataPointReply>&  result) {
-    DataPointMap_t resultMap;
+    DataPointReply reply;
     const auto&    dataPoints = response.data_points();
     if (dataPoints.size() == numRequestedSignals) {
+        reply.reserve(metadataList.size());
         auto dataPointIter = dataPoints.cbegin();
         for (const auto& metadata : metadataList) {
             if (metadata->m_isKnown) {
                 assert(dataPointIter != dataPoints.cend());
-                resultMap[metadata->m_signalPath] =
-                    convertFromGrpcDataPoint(metadata->m_signalPath, *dataPointIter);
+                reply.set(metadata->m_signalHandle,
+                          convertFromGrpcDataPointToSample(*dataPointIter));
                 ++dataPointIter;
             } else {
-                resultMap[metadata->m_signalPath] = std::make_shared<DataPointValue>(
-                    DataPointValue::Type::INVALID, metadata->m_signalPath, Timestamp{},
-                    DataPointValue::Failure::UNKNOWN_DATAPOINT);
+                reply.set(metadata->m_signalHandle,
+                          DataPointSample(DataPointValue::Type::INVALID,
+                                          DataPointValue::Failure::UNKNOWN_DATAPOINT));
             }
         }
-        result->insertResult(DataPointReply(std::move(resultMap)));
+        result->insertResult(std::move(reply));
     } else {
         result->insertError(Status(fmt::format("GetDatapoints: Mismatch in # returned data "
                                                "points (#req={}, #ret={})",
@@ -143,14 +515,16 @@ void BrokerClient::onGetValuesError(const grpc::Status& status, const MetadataLi
                                     const AsyncResultPtr_t<DataPointReply>& result) {
     if (status.error_code() == grpc::StatusCode::UNAVAILABLE) {
         m_metadataAgent->invalidate(status.error_code());
-        DataPointMap_t resultMap;
+        DataPointReply reply;
+        reply.reserve(metadataList.size());
         for (const auto& metadata : metadataList) {
-            resultMap[metadata->m_signalPath] = std::make_shared<DataPointValue>(
-                DataPointValue::Type::INVALID, metadata->m_signalPath, Timestamp{},
-                (metadata->m_isKnown ? DataPointValue::Failure::NOT_AVAILABLE
-                                     : DataPointValue::Failure::UNKNOWN_DATAPOINT));
+            reply.set(metadata->m_signalHandle,
+                      DataPointSample(DataPointValue::Type::INVALID,
+                                      (metadata->m_isKnown
+                                           ? DataPointValue::Failure::NOT_AVAILABLE
+                                           : DataPointValue::Failure::UNKNOWN_DATAPOINT)));
         }
-        result->insertResult(DataPointReply(std::move(resultMap)));
+        result->insertResult(std::move(reply));
     } else {
         result->insertError(
             Status(fmt::format("GetDatapoints failed: {}", status.error_message())));
@@ -169,240 +543,196 @@ bool isSignalProviderUnavailable(const grpc::Status& status) {
            (status.error_message().find(errorMessagePart2, part1Pos + errorMessagePart1.length()) !=
             std::string::npos);
 }
+
+// Whether the failure of an actuation may be caused by ids which are outdated, e.g. because the
+// databroker restarted in between.
+bool isStaleIdIndication(const grpc::Status& status) {
+    return status.error_code() == grpc::StatusCode::NOT_FOUND ||
+           (status.error_code() == grpc::StatusCode::UNAVAILABLE &&
+            !isSignalProviderUnavailable(status));
+}
+
+// Get the signals of the requests [begin, begin + count) addressed by id.
+std::vector<SignalHandle_t> getSignalsById(const std::vector<SignalHandle_t>& signalsById,
+                                           size_t begin, size_t count) {
+    std::vector<SignalHandle_t> signals;
+    for (size_t i = begin; i < begin + count; ++i) {
+        if (signalsById[i] != INVALID_SIGNAL_HANDLE) {
+            signals.push_back(signalsById[i]);
+        }
+    }
+    return signals;
+}
 } // namespace
 
 AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t>
 BrokerClient::setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints) {
-    auto result = std::make_shared<AsyncResult<SetErrorMap_t>>();
+    auto result = withCallbackExecutor(std::make_shared<AsyncResult<SetErrorMap_t>>());
 
     kuksa::val::v2::BatchActuateRequest batchRequest;
 
     auto& requests = *batchRequest.mutable_actuate_requests();
     requests.Reserve(assertProtobufArrayLimits(datapoints.size()));
 
+    auto&         registry = SignalPathRegistry::getInstance();
+    SetErrorMap_t typeErrors;
+    // per request, INVALID_SIGNAL_HANDLE for the ones addressing their signal by path
+    std::vector<SignalHandle_t> signalsById;
+    signalsById.reserve(datapoints.size());
+    std::vector<SignalHandle_t> unresolvedSignals;
     for (const auto& dataPoint : datapoints) {
         kuksa::val::v2::ActuateRequest& request = *requests.Add();
-        request.mutable_signal_id()->set_path(dataPoint->getPath());
-        *request.mutable_value() = convertToGrpcValue(*dataPoint);
+        // address signals whose id was resolved already (e.g. declared ones) by id, sparing the
+        // databroker the lookup of the path
+        const auto handle   = registry.intern(dataPoint->getPath());
+        const auto metadata = m_metadataAgent->getByHandle(handle);
+        if (metadata && metadata->m_isKnown) {
+            request.mutable_signal_id()->set_id(metadata->m_id);
+            signalsById.push_back(handle);
+            if (!isAssignableType(metadata->m_type, dataPoint->getType())) {
+                typeErrors[dataPoint->getPath()] =
+                    "ERROR_CODE_INVALID_ARGUMENT: Value does not match the data type of the signal";
+            }
+        } else {
+            request.mutable_signal_id()->set_path(dataPoint->getPath());
+            signalsById.push_back(INVALID_SIGNAL_HANDLE);
+            if (!metadata) {
+                unresolvedSignals.push_back(handle);
+            }
+        }
+        convertToGrpcValue(*dataPoint, *request.mutable_value());
+    }
+    // resolved in the background, so the next actuations of these signals address them by id
+    if (!unresolvedSignals.empty()) {
+        m_metadataAgent->resolve(unresolvedSignals);
+    }
+    // the databroker rejects the whole batch because of a single mismatching value, so it is
+    // rejected right away instead
+    if (!typeErrors.empty()) {
+        result->insertResult(std::move(typeErrors));
+        return result;
+    }
+
+    const auto bytesPerElement =
+        datapoints.empty() ? 0 : batchRequest.ByteSizeLong() / datapoints.size();
+    const auto chunkSizes = m_actuateChunker.split(datapoints.size(), bytesPerElement);
+    if (chunkSizes.size() == 1) {
+        batchActuate(std::move(batchRequest), result,
+                     getSignalsById(signalsById, 0, datapoints.size()));
+        return result;
+    }
+
+    logger().debug("Actuating {} signals in {} chunks", datapoints.size(), chunkSizes.size());
+    std::vector<AsyncResultPtr_t<SetErrorMap_t>> chunkResults;
+    chunkResults.reserve(chunkSizes.size());
+    int requestIndex = 0;
+    for (const auto chunkSize : chunkSizes) {
+        kuksa::val::v2::BatchActuateRequest chunkRequest;
+        auto& chunkRequests = *chunkRequest.mutable_actuate_requests();
+        chunkRequests.Reserve(static_cast<int>(chunkSize));
+        auto chunkSignalsById =
+            getSignalsById(signalsById, static_cast<size_t>(requestIndex), chunkSize);
+        for (size_t i = 0; i < chunkSize; ++i) {
+            chunkRequests.Add()->Swap(requests.Mutable(requestIndex++));
+        }
+        auto chunkResult = std::make_shared<AsyncResult<SetErrorMap_t>>();
+        batchActuate(std::move(chunkRequest), chunkResult, std::move(chunkSignalsById));
+        chunkResults.push_back(std::move(chunkResult));
     }
+    bindChunkCancellation(*result, chunkResults);
+    // chunks are applied independently, so a failing chunk does not revert the other ones
+    whenAll(chunkResults)
+        ->onResult([result](const auto& chunkErrors) {
+            SetErrorMap_t errors;
+            for (const auto& chunkError : chunkErrors) {
+                errors.insert(chunkError.cbegin(), chunkError.cend());
+            }
+            result->insertResult(std::move(errors));
+        })
+        ->onError([result](Status status) { result->insertError(std::move(status)); });
+    return result;
+}
 
-    m_asyncBrokerFacade->BatchActuate(
-        std::move(batchRequest),
-        [result](const kuksa::val::v2::BatchActuateResponse& reply) {
-            std::ignore = reply;
+void BrokerClient::batchActuate(kuksa::val::v2::BatchActuateRequest    request,
+                                const AsyncResultPtr_t<SetErrorMap_t>& result,
+                                std::vector<SignalHandle_t>            signalsById) {
+    const auto numSignals  = static_cast<size_t>(request.actuate_requests_size());
+    const auto requestedAt = std::chrono::steady_clock::now();
+    auto       call        = m_asyncBrokerFacade->BatchActuate(
+        std::move(request),
+        [this, result, numSignals, requestedAt](const kuksa::val::v2::BatchActuateResponse& reply) {
+            m_actuateChunker.recordResponse(
+                numSignals, std::chrono::steady_clock::now() - requestedAt, reply.ByteSizeLong());
             // Everything went fine, return empty map
             result->insertResult(SetErrorMap_t());
         },
-        [this, result](auto status) {
-            if (status.error_code() == grpc::StatusCode::UNAVAILABLE) {
-                // The error code UNAVAILABLE is also used by the databroker to indicate that the
-                // provider of at least one of the addressed signals is missing. This situation
-                // shall not lead to cache invalidation.
-                if (!isSignalProviderUnavailable(status)) {
-                    m_metadataAgent->invalidate(status.error_code());
-                }
+        [this, result, signalsById = std::move(signalsById)](auto status) {
+            // The error code UNAVAILABLE is also used by the databroker to indicate that the
+            // provider of at least one of the addressed signals is missing. This situation
+            // shall not lead to cache invalidation. Otherwise only the ids used by the request
+            // are invalidated, so failing actuations at a high rate do not wipe the whole cache
+            // over and over.
+            if (isStaleIdIndication(status) && !signalsById.empty()) {
+                m_metadataAgent->invalidateSignals(signalsById);
             }
             result->insertError(
                 Status(fmt::format("SetDatapoints failed: {} --- Error details: {}",
                                    status.error_message(), status.error_details())));
         });
-    return result;
+    bindCancellation(*result, call);
 }
 
-namespace {
-void clearUpdateStatus(DataPointMap_t& datapointMap) {
-    for (auto& entry : datapointMap) {
-        entry.second->clearUpdateStatus();
+AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t>
+BrokerClient::setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints,
+                            SetMode                                             mode) {
+    if (mode == SetMode::PUBLISH) {
+        return withCallbackExecutor(m_providerStream->publish(datapoints));
     }
+    return setDatapoints(datapoints);
 }
 
-uint32_t determineSubscribeBufferSize() {
-    uint32_t bufferSize = DEFAULT_SUBSCRIBE_BUFFER_SIZE;
-    try {
-        auto bufferSizeStr = getEnvVar("SDV_SUBSCRIBE_BUFFER_SIZE");
-        if (!bufferSizeStr.empty()) {
-            bufferSize = std::stoi(bufferSizeStr);
-        }
-    } catch (...) {
-        logger().error("Invalid Subscribe BufferSize specified via env var! Using default ({}).",
-                       bufferSize);
-    }
-    return bufferSize;
+AsyncSubscriptionPtr_t<DataPointReply> BrokerClient::subscribe(const std::string& query) {
+    return subscribe(query, SubscriptionMode::FULL_STATE);
 }
 
-uint32_t getSubscribeBufferSize() {
-    static uint32_t bufferSize = determineSubscribeBufferSize();
-    return bufferSize;
+AsyncSubscriptionPtr_t<DataPointReply> BrokerClient::subscribe(const std::string& query,
+                                                               SubscriptionMode   mode) {
+    return subscribe(query, SubscriptionOptions{mode});
 }
 
-std::string getSignalPathAbstract(const std::vector<std::string>& signalPaths) {
-    auto abstract{signalPaths.front()};
-    if (signalPaths.size() > 1) {
-        abstract.append(", etc");
-    }
-    return abstract;
+AsyncSubscriptionPtr_t<DataPointReply>
+BrokerClient::subscribe(const std::string& query, const SubscriptionOptions& options) {
+    auto effectiveOptions               = options;
+    effectiveOptions.m_callbackExecutor = resolveCallbackExecutor(options);
+    return m_subscriptionMultiplexer->subscribe(parseQuery(query), effectiveOptions);
 }
 
-// ToDo: Making this class a GrpcCall to store active subscriptions is a bit "quick &
-// dirty". Please check for a better solution!
-class SubscriptionHandler : public GrpcCall {
-public:
-    SubscriptionHandler(std::shared_ptr<BrokerAsyncGrpcFacade> asyncBrokerFacade,
-                        std::shared_ptr<MetadataAgent>         metadataAgent,
-                        std::vector<std::string>               signalPaths)
-        : m_asyncBrokerFacade(std::move(asyncBrokerFacade))
-        , m_metadataAgent(std::move(metadataAgent))
-        , m_signalPaths(std::move(signalPaths))
-        , m_subscription(std::make_shared<AsyncSubscription<DataPointReply>>())
-        , m_datapointUpdates(std::make_shared<DataPointMap_t>()) {}
-
-    void subscribe() {
-        m_metadataAgent->query(
-            m_signalPaths,
-            [this](auto&& metadataList) {
-                onMetadataPresent(std::forward<decltype(metadataList)>(metadataList));
-            },
-            [this](const auto& status) { onError(std::forward<decltype(status)>(status)); });
-    }
-
-    void onMetadataPresent(MetadataList_t&& metadataList) {
-        kuksa::val::v2::SubscribeByIdRequest request;
-        if (getSubscribeBufferSize() != DEFAULT_SUBSCRIBE_BUFFER_SIZE) {
-            request.set_buffer_size(getSubscribeBufferSize());
-        }
-        for (const auto& metadata : metadataList) {
-            if (metadata->m_isKnown) {
-                request.add_signal_ids(metadata->m_id);
-            } else {
-                (*m_datapointUpdates)[metadata->m_signalPath] = std::make_shared<DataPointValue>(
-                    DataPointValue::Type::INVALID, metadata->m_signalPath, Timestamp{},
-                    DataPointValue::Failure::UNKNOWN_DATAPOINT);
-            }
-        }
-
-        assert(!m_grpcSubscriptionCall || m_grpcSubscriptionCall->m_isComplete);
-        m_grpcSubscriptionCall = m_asyncBrokerFacade->SubscribeById(
-            std::move(request),
-            [this](auto&& update) { onUpdate(std::forward<decltype(update)>(update)); },
-            [this](auto&& status) { onError(std::forward<decltype(status)>(status)); });
+AsyncSubscriptionPtr_t<DataPointReply>
+BrokerClient::subscribe(const Query& query, const SubscriptionOptions& options) {
+    if (query.getSignals().empty()) {
+        throw std::runtime_error("Mallformed query selecting no signals!");
     }
+    auto effectiveOptions               = options;
+    effectiveOptions.m_callbackExecutor = resolveCallbackExecutor(options);
+    // the databroker does not support conditions, so they are evaluated on the client side
+    return m_subscriptionMultiplexer->subscribe(query.getSignals(), effectiveOptions,
+                                                QueryPredicate(query.getConditions()));
+}
 
-    void onUpdate(const kuksa::val::v2::SubscribeByIdResponse& update) {
-        resetResubscribeDelay();
-        const auto fieldsMap = update.entries();
-        for (const auto& [id, dataPoint] : fieldsMap) {
-            auto metadata = m_metadataAgent->getByNumericId(id);
-            if (metadata) {
-                const auto& path            = metadata->m_signalPath;
-                (*m_datapointUpdates)[path] = convertFromGrpcDataPoint(path, dataPoint);
-            } else {
-                logger().error("onSubscriptionUpdate: Unexpected signal id={} received.", id);
-            }
-        }
-        m_subscription->insertNewItem(DataPointReply(DataPointMap_t(*m_datapointUpdates)));
-        clearUpdateStatus(*m_datapointUpdates);
-    }
-
-    void onError(const grpc::Status& status) {
-        switch (status.error_code()) {
-        case grpc::StatusCode::OK:
-        case grpc::StatusCode::UNAVAILABLE:
-            // The databroker ended the connection or became unavailable. This is most
-            // probably a temporary error, so we try to subscribe again
-            logger().warn("Connection to databroker lost or failed");
-            m_metadataAgent->invalidate();
-            if (invalidateDataPointValues()) {
-                m_subscription->insertNewItem(DataPointReply(DataPointMap_t(*m_datapointUpdates)));
-                clearUpdateStatus(*m_datapointUpdates);
-            }
-            resubscribe();
-            break;
-        default:
-            // all other errors are rated unrecoverable, therefore retry does not make sense
-            m_subscription->insertError(Status(fmt::format(
-                "Subscribe failed: code={}, {}", static_cast<unsigned int>(status.error_code()),
-                status.error_message())));
-            m_isComplete = true;
-            break;
-        }
-    }
-
-    bool invalidateDataPointValues() {
-        bool anyValueInvalidated = false;
-        for (const auto& path : m_signalPaths) {
-            auto dpValueIter = m_datapointUpdates->find(path);
-            if (dpValueIter == m_datapointUpdates->end()) {
-                m_datapointUpdates->emplace(std::make_pair(
-                    std::string{path}, std::make_shared<DataPointValue>(
-                                           DataPointValue::Type::INVALID, path, Timestamp{},
-                                           DataPointValue::Failure::NOT_AVAILABLE)));
-                anyValueInvalidated = true;
-            } else {
-                auto& dpValue = dpValueIter->second;
-                switch (dpValue->getFailure()) {
-                case DataPointValue::Failure::NOT_AVAILABLE:
-                case DataPointValue::Failure::UNKNOWN_DATAPOINT:
-                case DataPointValue::Failure::ACCESS_DENIED:
-                    // nothing to do
-                    break;
-                default:
-                    dpValue =
-                        std::make_shared<DataPointValue>(dpValue->getType(), path, Timestamp{},
-                                                         DataPointValue::Failure::NOT_AVAILABLE);
-                    anyValueInvalidated = true;
-                    break;
-                }
-            }
-        }
-        return anyValueInvalidated;
-    }
-
-    void resubscribe() {
-        logger().debug("Initiating re-subscribe of {} after {}ms",
-                       getSignalPathAbstract(m_signalPaths), m_resubscribeDelay.count());
-        ThreadPool::getInstance()->enqueue(Job::create(
-            [this, start = std::chrono::steady_clock::now()]() {
-                const std::chrono::duration<double> diff = std::chrono::steady_clock::now() - start;
-                logger().debug("Try re-subscribing {} after {}s of waiting",
-                               getSignalPathAbstract(m_signalPaths), diff.count());
-                increaseResubscribeDelay();
-                subscribe();
-            },
-            m_resubscribeDelay));
-    }
-
-    void resetResubscribeDelay() { m_resubscribeDelay = RESUBSCRIBE_DELAY_INITIAL; }
-
-    void increaseResubscribeDelay() {
-        m_resubscribeDelay *= RESUBSCRIBE_DELAY_FACTOR;
-        if (m_resubscribeDelay > RESUBSCRIBE_DELAY_MAX) {
-            m_resubscribeDelay = RESUBSCRIBE_DELAY_MAX;
+bool BrokerClient::updateSubscription(const AsyncSubscriptionPtr_t<DataPointReply>& subscription,
+                                      const std::vector<std::string>&               addedSignals,
+                                      const std::vector<std::string>& removedSignals) {
+    auto&      registry = SignalPathRegistry::getInstance();
+    const auto intern   = [&registry](const std::vector<std::string>& paths) {
+        std::vector<SignalHandle_t> handles;
+        handles.reserve(paths.size());
+        for (const auto& path : paths) {
+            handles.push_back(registry.intern(path));
         }
-    }
-
-    [[nodiscard]] AsyncSubscriptionPtr_t<DataPointReply> getSubscription() const {
-        return m_subscription;
-    }
-
-private:
-    std::shared_ptr<BrokerAsyncGrpcFacade>             m_asyncBrokerFacade;
-    std::shared_ptr<MetadataAgent>                     m_metadataAgent;
-    std::vector<std::string>                           m_signalPaths;
-    std::shared_ptr<AsyncSubscription<DataPointReply>> m_subscription;
-    std::shared_ptr<DataPointMap_t>                    m_datapointUpdates;
-    std::shared_ptr<GrpcCall>                          m_grpcSubscriptionCall;
-    std::chrono::milliseconds m_resubscribeDelay{RESUBSCRIBE_DELAY_INITIAL};
-};
-
-} // namespace
-
-AsyncSubscriptionPtr_t<DataPointReply> BrokerClient::subscribe(const std::string& query) {
-    auto signalPaths         = parseQuery(query);
-    auto subscriptionHandler = std::make_shared<SubscriptionHandler>(
-        m_asyncBrokerFacade, m_metadataAgent, std::move(signalPaths));
-    m_activeCalls->addActiveCall(subscriptionHandler);
-    subscriptionHandler->subscribe();
-    return subscriptionHandler->getSubscription();
+        return handles;
+    };
+    return m_subscriptionMultiplexer->updateSignals(subscription, intern(addedSignals),
+                                                    intern(removedSignals));
 }
 
 } // namespace velocitas::kuksa_val_v2
@@ -20,18 +20,27 @@
 #include "BrokerAsyncGrpcFacade.h"
 #include "Metadata.h"
 #include "sdk/vdb/IVehicleDataBrokerClient.h"
+#include "sdk/vdb/grpc/common/ChannelPrewarmer.h"
+#include "sdk/vdb/grpc/common/ReadCoalescer.h"
+#include "sdk/vdb/grpc/common/RequestChunker.h"
+#include "sdk/vdb/grpc/common/RequestHedger.h"
 
+#include <chrono>
 #include <memory>
 #include <string>
+#include <vector>
 
-namespace velocitas {
+namespace velocitas::kuksa_val_v2 {
 
-class GrpcClient;
-
-namespace kuksa_val_v2 {
+class ProviderStream;
+class SubscriptionMultiplexer;
 
 /**
  * Provides the Graph API to access vehicle signals via the kuksa.val.v2 API
+ *
+ * Reads and actuations of many signals are split into chunks issued in parallel (see
+ * RequestChunker), whose results are merged into a single reply. Reads may be hedged against
+ * stalls of the databroker, see RequestHedger.
  */
 class BrokerClient : public IVehicleDataBrokerClient {
 public:
@@ -51,21 +60,100 @@ public:
     AsyncResultPtr_t<SetErrorMap_t>
     setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints) override;
 
+    AsyncResultPtr_t<SetErrorMap_t>
+    setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints,
+                  SetMode                                             mode) override;
+
+    using IVehicleDataBrokerClient::subscribe;
+
     AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string& query) override;
 
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string& query,
+                                                     SubscriptionMode   mode) override;
+
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string&         query,
+                                                     const SubscriptionOptions& options) override;
+
+    /**
+     * @brief Subscribe to the signals of the query directly, without parsing its string form.
+     *        The conditions of the query are evaluated on the client side, before the updates
+     *        are delivered.
+     *
+     * @throw InvalidTypeException if a condition has a neither numeric nor boolean operand.
+     */
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const Query&               query,
+                                                     const SubscriptionOptions& options) override;
+
+    /**
+     * @brief Update the subscription in place: the streams of the kept signals keep running,
+     *        added signals not received by any stream yet are requested via a new one.
+     */
+    bool updateSubscription(const AsyncSubscriptionPtr_t<DataPointReply>& subscription,
+                            const std::vector<std::string>&               addedSignals,
+                            const std::vector<std::string>&               removedSignals) override;
+
+    /**
+     * @brief Wait for the channel to be connected, then query the metadata of the signals.
+     */
+    AsyncResultPtr_t<Status> prepare(const std::vector<std::string>& signalPaths,
+                                     std::chrono::milliseconds       timeout) override;
+
+    AsyncResultPtr_t<Status> whenReady() override;
+
+    /**
+     * @brief Resolve the ids of the signals once; each actuation then only overwrites the values
+     *        of a kept request message addressing the signals by id. Values to be published are
+     *        forwarded to setDatapoints.
+     */
+    std::shared_ptr<IPreparedSet> prepareSet(const std::vector<std::string>& signalPaths) override;
+
+    size_t cancelPendingRequests() override;
+
+    void setExecutor(ExecutorPtr_t executor) override;
+
+    [[nodiscard]] ClockOffsetEstimatorPtr_t getClockOffsetEstimator() const override {
+        return m_clockOffsetEstimator;
+    }
+
 private:
+    class PreparedSet;
+
+    AsyncResultPtr_t<DataPointReply> requestDatapoints(const std::vector<std::string>& signalPaths);
+    void requestValues(const MetadataList_t&                   metadataList,
+                       const AsyncResultPtr_t<DataPointReply>& result);
+    void requestValuesChunked(const MetadataList_t&                   metadataList,
+                              const std::vector<size_t>&              chunkSizes,
+                              const AsyncResultPtr_t<DataPointReply>& result);
     void onGetValuesResponse(const kuksa::val::v2::GetValuesResponse& response,
                              const MetadataList_t& metadataList, size_t numRequestedSignals,
                              const AsyncResultPtr_t<DataPointReply>& result);
     void onGetValuesError(const grpc::Status& status, const MetadataList_t& metadataList,
                           const AsyncResultPtr_t<DataPointReply>& result);
-
-    std::shared_ptr<BrokerAsyncGrpcFacade> m_asyncBrokerFacade;
-    std::shared_ptr<MetadataAgent>         m_metadataAgent;
-    std::unique_ptr<GrpcClient>            m_activeCalls;
+    /**
+     * @param signalsById  The signals the request addresses by id, whose metadata is
+     *                     invalidated if the databroker rejects the request.
+     */
+    void batchActuate(kuksa::val::v2::BatchActuateRequest    request,
+                      const AsyncResultPtr_t<SetErrorMap_t>& result,
+                      std::vector<SignalHandle_t>            signalsById);
+
+    std::shared_ptr<BrokerAsyncGrpcFacade>   m_asyncBrokerFacade;
+    std::shared_ptr<MetadataAgent>           m_metadataAgent;
+    // fed by the reads and the traced updates, so it is created before the multiplexer
+    ClockOffsetEstimatorPtr_t                m_clockOffsetEstimator;
+    std::shared_ptr<SubscriptionMultiplexer> m_subscriptionMultiplexer;
+    std::shared_ptr<ProviderStream>          m_providerStream;
+    // connects the channels at creation; null if not configured
+    std::shared_ptr<ChannelPrewarmer>        m_prewarmer;
+    // getDatapoints is served from subscribed values not older than this; disabled if zero
+    const std::chrono::milliseconds m_latestValueMaxAge;
+    ReadCoalescer                   m_readCoalescer;
+    RequestChunker                  m_readChunker;
+    RequestChunker                  m_actuateChunker;
+    // duplicates slow reads; null if not configured
+    std::shared_ptr<RequestHedger> m_readHedger;
 };
 
-} // namespace kuksa_val_v2
-} // namespace velocitas
+} // namespace velocitas::kuksa_val_v2
 
 #endif // VEHICLE_APP_SDK_VDB_GRPC_KUKSA_VAL_V2_BROKERCLIENT_H
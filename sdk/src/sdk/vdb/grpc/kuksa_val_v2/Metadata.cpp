@@ -16,39 +16,97 @@
 
 #include "Metadata.h"
 
+#include "sdk/AllocationTracker.h"
 #include "sdk/Job.h"
 #include "sdk/Logger.h"
+#include "sdk/Metrics.h"
 #include "sdk/ThreadPool.h"
+#include "sdk/Utils.h"
 #include "sdk/vdb/grpc/kuksa_val_v2/BrokerAsyncGrpcFacade.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/TypeConversions.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstdio>
 #include <deque>
+#include <fstream>
+#include <iterator>
 #include <limits>
+#include <optional>
 #include <set>
 #include <shared_mutex>
+#include <sstream>
 #include <stdexcept>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 
 namespace velocitas::kuksa_val_v2 {
 
 namespace {
 
-const unsigned int MAX_PARALLEL_REQUESTS{5};
+template <typename T>
+using CacheAllocator_t = DomainAllocator_t<T, AllocationDomain::METADATA_CACHE>;
+
+using IdMap_t = std::unordered_map<numeric_id_t, MetadataPtr_t, std::hash<numeric_id_t>,
+                                   std::equal_to<numeric_id_t>,
+                                   CacheAllocator_t<std::pair<const numeric_id_t, MetadataPtr_t>>>;
+
+MetadataPtr_t createMetadata(Metadata&& metadata) {
+    metadata.m_decoder = getDataPointDecoder(metadata.m_type);
+    return makeSharedIn<AllocationDomain::METADATA_CACHE, Metadata>(std::move(metadata));
+}
+
+size_t determineMaxParallelRequests() {
+    size_t maxParallelRequests = MetadataAgentConfig::DEFAULT_MAX_PARALLEL_REQUESTS;
+    try {
+        auto maxParallelRequestsStr = getEnvVar("SDV_METADATA_MAX_PARALLEL_REQUESTS");
+        if (!maxParallelRequestsStr.empty()) {
+            maxParallelRequests = std::stoul(maxParallelRequestsStr);
+        }
+    } catch (...) {
+        logger().error("Invalid max number of parallel metadata requests specified via env var! "
+                       "Using default ({}).",
+                       maxParallelRequests);
+    }
+    return maxParallelRequests;
+}
+
+/**
+ * @brief Check if the signal is part of the branch, i.e. the branch path (ignoring a trailing
+ * wildcard) is equal to or a prefix of the signal path.
+ */
+bool isPartOfBranch(const std::string& signalPath, std::string_view branch) {
+    for (const std::string_view wildcard : {".**", ".*"}) {
+        if (branch.size() > wildcard.size() &&
+            branch.substr(branch.size() - wildcard.size()) == wildcard) {
+            branch.remove_suffix(wildcard.size());
+            break;
+        }
+    }
+    if (signalPath.size() < branch.size() || signalPath.compare(0, branch.size(), branch) != 0) {
+        return false;
+    }
+    return signalPath.size() == branch.size() || signalPath[branch.size()] == '.';
+}
 
 class Request {
 public:
     static std::shared_ptr<Request>
-    create(const std::string&                                                           signalPath,
+    create(SignalHandle_t                                                               signal,
            std::function<void(const std::shared_ptr<Request>&, const MetadataPtr_t&)>&& onMetadata,
            std::function<void(const std::shared_ptr<Request>&, const grpc::Status&)>&&  onError) {
         auto request = std::shared_ptr<Request>(
-            new Request(signalPath, std::move(onMetadata), std::move(onError)));
+            new Request(signal, std::move(onMetadata), std::move(onError)));
         request->setThisPtr(request);
         return request;
     }
 
-    void initiate(const std::shared_ptr<BrokerAsyncGrpcFacade>& brokerFacade) {
-        ThreadPool::getInstance()->enqueue(Job::create([thisPtr = getThisPtr(), brokerFacade]() {
+    /**
+     * @brief Create the function initiating the request asynchronously.
+     */
+    JobFunction createInitiation(const MetadataAgent::ListMetadataFunction_t& listMetadata) {
+        return [thisPtr = getThisPtr(), listMetadata]() {
             // !! Capturing a shared_ptr to this Request object (i.e. thisPtr) within this lambda
             // guarantees that this object is not destructed before the lambda is left, means
             // destruction happens outside any function of this class.
@@ -57,7 +115,7 @@ public:
             } else {
                 kuksa::val::v2::ListMetadataRequest request;
                 request.set_root(thisPtr->m_signalPath);
-                brokerFacade->ListMetadata(
+                listMetadata(
                     std::move(request),
                     [thisPtr](const auto& response) {
                         thisPtr->onResponse(std::forward<decltype(response)>(response));
@@ -66,18 +124,19 @@ public:
                         thisPtr->onError(std::forward<decltype(status)>(status));
                     });
             }
-        }));
+        };
     }
 
     void                             cancel() { m_isCancelled = true; }
     [[nodiscard]] bool               isCancelled() const { return m_isCancelled; }
-    [[nodiscard]] const std::string& getSignalPath() const { return m_signalPath; }
+    [[nodiscard]] SignalHandle_t     getSignalHandle() const { return m_signalHandle; }
 
 private:
-    Request(std::string                                                                  signalPath,
+    Request(SignalHandle_t                                                               signal,
             std::function<void(const std::shared_ptr<Request>&, const MetadataPtr_t&)>&& onMetadata,
             std::function<void(const std::shared_ptr<Request>&, const grpc::Status&)>&&  onError)
-        : m_signalPath(std::move(signalPath))
+        : m_signalPath(SignalPathRegistry::getInstance().getPath(signal))
+        , m_signalHandle(signal)
         , m_metadataCallback(std::move(onMetadata))
         , m_errorCallback(std::move(onError)) {}
 
@@ -87,9 +146,11 @@ private:
     void onResponse(const kuksa::val::v2::ListMetadataResponse& response) {
         if (!m_isCancelled) {
             if (response.metadata_size() == 1) {
-                m_metadataCallback(getThisPtr(),
-                                   std::make_shared<Metadata>(
-                                       Metadata{m_signalPath, response.metadata(0).id(), true}));
+                const auto& entry = response.metadata(0);
+                const auto  type  = convertFromGrpcDataType(entry.data_type());
+                m_metadataCallback(getThisPtr(), createMetadata(Metadata{m_signalPath, entry.id(),
+                                                                         true, m_signalHandle,
+                                                                         type}));
             } else {
                 if (response.metadata_size() == 0) {
                     logger().warn("Databroker returned empty metadata list for {} -> "
@@ -100,8 +161,8 @@ private:
                                   "assuming signal as 'unknown'",
                                   m_signalPath);
                 }
-                m_metadataCallback(getThisPtr(),
-                                   std::make_shared<Metadata>(Metadata{m_signalPath, 0, false}));
+                m_metadataCallback(getThisPtr(), createMetadata(Metadata{m_signalPath, 0, false,
+                                                                         m_signalHandle}));
             }
         } else {
             m_errorCallback(getThisPtr(), grpc::Status(grpc::StatusCode::CANCELLED, ""));
@@ -112,8 +173,8 @@ private:
         if (!m_isCancelled) {
             if (status.error_code() == grpc::StatusCode::NOT_FOUND ||
                 status.error_code() == grpc::StatusCode::PERMISSION_DENIED) {
-                m_metadataCallback(getThisPtr(),
-                                   std::make_shared<Metadata>(Metadata{m_signalPath, 0, false}));
+                m_metadataCallback(getThisPtr(), createMetadata(Metadata{m_signalPath, 0, false,
+                                                                         m_signalHandle}));
             } else {
                 m_errorCallback(getThisPtr(), status);
             }
@@ -122,70 +183,144 @@ private:
         }
     }
 
-    const std::string                                                          m_signalPath;
+    const std::string&                                                         m_signalPath;
+    const SignalHandle_t                                                       m_signalHandle;
     std::weak_ptr<Request>                                                     m_this;
     std::atomic<bool>                                                          m_isCancelled{false};
     std::function<void(const std::shared_ptr<Request>&, const MetadataPtr_t&)> m_metadataCallback;
     std::function<void(const std::shared_ptr<Request>&, const grpc::Status&)>  m_errorCallback;
 };
 
+/**
+ * Immutable lookup table from numeric id to metadata. The ids assigned by the databroker are
+ * mostly dense, so they are looked up by direct index; outliers are kept in a hash map.
+ */
+class IdIndex {
+public:
+    explicit IdIndex(const IdMap_t& idMap) {
+        const auto directSize = 2 * idMap.size() + DIRECT_INDEX_SLACK;
+        for (const auto& [id, metadata] : idMap) {
+            if (id >= 0 && static_cast<size_t>(id) < directSize) {
+                if (static_cast<size_t>(id) >= m_direct.size()) {
+                    m_direct.resize(id + 1);
+                }
+                m_direct[id] = metadata;
+            } else {
+                m_sparse.emplace(id, metadata);
+            }
+        }
+    }
+
+    [[nodiscard]] MetadataPtr_t find(numeric_id_t numericId) const {
+        if (numericId >= 0 && static_cast<size_t>(numericId) < m_direct.size()) {
+            return m_direct[numericId];
+        }
+        if (auto iter = m_sparse.find(numericId); iter != m_sparse.end()) {
+            return iter->second;
+        }
+        return {};
+    }
+
+private:
+    static constexpr size_t DIRECT_INDEX_SLACK{64};
+
+    std::vector<MetadataPtr_t, CacheAllocator_t<MetadataPtr_t>> m_direct;
+    IdMap_t                                                     m_sparse;
+};
+
+using IdIndexPtr_t = std::shared_ptr<const IdIndex>;
+
 class MetadataCache {
 public:
     void add(const MetadataPtr_t& metadata) {
-        assert(metadata);
-        m_pathMap[metadata->m_signalPath] = metadata;
+        assert(metadata && metadata->m_signalHandle != INVALID_SIGNAL_HANDLE);
+        if (metadata->m_signalHandle >= m_handleMap.size()) {
+            m_handleMap.resize(metadata->m_signalHandle + 1);
+        }
+        auto& cachedMetadata = m_handleMap[metadata->m_signalHandle];
+        if (cachedMetadata && cachedMetadata->m_isKnown) {
+            if (auto idIter = m_idMap.find(cachedMetadata->m_id);
+                idIter != m_idMap.end() && idIter->second == cachedMetadata) {
+                m_idMap.erase(idIter);
+            }
+        }
+        cachedMetadata = metadata;
         if (metadata->m_isKnown) {
             m_idMap[metadata->m_id] = metadata;
         }
+        m_version.fetch_add(1, std::memory_order_release);
     }
 
     void clear() {
-        m_pathMap.clear();
+        m_handleMap.clear();
         m_idMap.clear();
+        m_version.fetch_add(1, std::memory_order_release);
     }
 
-    [[nodiscard]] bool isPresent(const std::string& signalPath) const {
-        return (m_pathMap.find(signalPath) != m_pathMap.cend());
+    [[nodiscard]] bool isPresent(SignalHandle_t signal) const {
+        return getByHandle(signal) != nullptr;
     }
 
-    [[nodiscard]] MetadataPtr_t getByPath(const std::string& signalPath) const {
-        if (auto metadata = m_pathMap.find(signalPath); metadata != m_pathMap.end()) {
-            return metadata->second;
+    [[nodiscard]] MetadataPtr_t getByHandle(SignalHandle_t signal) const {
+        if (signal < m_handleMap.size()) {
+            return m_handleMap[signal];
         }
         return {};
     }
 
-    [[nodiscard]] MetadataPtr_t getById(numeric_id_t numericId) const {
-        if (auto metadata = m_idMap.find(numericId); metadata != m_idMap.end()) {
-            return metadata->second;
+    [[nodiscard]] const IdMap_t& getAllKnown() const {
+        return m_idMap;
+    }
+
+    /**
+     * @brief Get the version of the cache content. It is incremented by each modification and
+     * can be read without holding the lock of the cache owner.
+     */
+    [[nodiscard]] uint64_t getVersion() const { return m_version.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Get the id index of the current cache content; it is built on first demand after
+     * a modification. Needs to be called with the lock of the cache owner held exclusively.
+     *
+     * @param version  Receives the version of the cache content the index was built from.
+     */
+    IdIndexPtr_t getIdIndex(uint64_t& version) {
+        version = m_version.load(std::memory_order_relaxed);
+        if (!m_idIndex || m_idIndexVersion != version) {
+            m_idIndex = makeSharedIn<AllocationDomain::METADATA_CACHE, IdIndex>(m_idMap);
+            m_idIndexVersion = version;
         }
-        return {};
+        return m_idIndex;
     }
 
 private:
-    std::map<std::string, MetadataPtr_t>  m_pathMap;
-    std::map<numeric_id_t, MetadataPtr_t> m_idMap;
+    // indexed by the signal handle; handles are dense, so this is a direct lookup
+    std::vector<MetadataPtr_t, CacheAllocator_t<MetadataPtr_t>> m_handleMap;
+    IdMap_t                                                     m_idMap;
+    std::atomic<uint64_t>                                       m_version{0};
+    IdIndexPtr_t                                                m_idIndex;
+    uint64_t                                                    m_idIndexVersion{0};
 };
 
 class Query {
 public:
-    Query(const SignalPathList_t&                    signalPaths,
+    Query(const std::vector<SignalHandle_t>&         signals,
           std::function<void(MetadataList_t&&)>&&    successCallback,
           std::function<void(const grpc::Status&)>&& errorCallback)
-        : m_missingSignals(signalPaths.cbegin(), signalPaths.cend())
+        : m_missingSignals(signals.cbegin(), signals.cend())
         , m_successCallback(std::move(successCallback))
         , m_errorCallback(std::move(errorCallback)) {
-        m_cachedMetadata.reserve(signalPaths.size());
+        m_cachedMetadata.reserve(signals.size());
     }
 
     void addMetadata(const MetadataPtr_t& metadata) {
-        auto numErased = m_missingSignals.erase(metadata->m_signalPath);
+        auto numErased = m_missingSignals.erase(metadata->m_signalHandle);
         if (numErased > 0) {
             m_cachedMetadata.push_back(metadata);
         }
     }
     [[nodiscard]] bool isFulfilled() const { return m_missingSignals.empty(); }
-    [[nodiscard]] const std::set<std::string>& getMissingSignals() const {
+    [[nodiscard]] const std::set<SignalHandle_t>& getMissingSignals() const {
         return m_missingSignals;
     }
 
@@ -212,7 +347,7 @@ public:
 
 private:
     MetadataList_t                           m_cachedMetadata;
-    std::set<std::string>                    m_missingSignals;
+    std::set<SignalHandle_t>                 m_missingSignals;
     std::function<void(MetadataList_t&&)>    m_successCallback;
     std::function<void(const grpc::Status&)> m_errorCallback;
 };
@@ -229,47 +364,171 @@ void notifyQueryInitiators(std::deque<Query>&& queries, const grpc::Status& stat
     }
 }
 
+uint64_t getNextInstanceId() {
+    static std::atomic<uint64_t> nextInstanceId{1};
+    return nextInstanceId.fetch_add(1, std::memory_order_relaxed);
+}
+
+using PersistedEntries_t = std::vector<std::pair<numeric_id_t, std::string>>;
+
+const std::string PERSISTENT_CACHE_FORMAT{"velocitas-metadata-cache 1"};
+
+void writePersistentCache(const MetadataAgentConfig& config, const PersistedEntries_t& entries) {
+    // write to a temporary file first, so an interrupted write never leaves a broken cache
+    const auto tempFile = config.m_persistentCacheFile + ".tmp";
+    {
+        std::ofstream file(tempFile, std::ios::trunc);
+        file << PERSISTENT_CACHE_FORMAT << '\n'
+             << "broker " << config.m_brokerIdentity << '\n'
+             << "schema " << config.m_schemaVersion << '\n';
+        for (const auto& [id, path] : entries) {
+            file << id << ' ' << path << '\n';
+        }
+        if (!file.flush()) {
+            logger().warn("Failed to write signal metadata cache file {}", tempFile);
+            return;
+        }
+    }
+    if (std::rename(tempFile.c_str(), config.m_persistentCacheFile.c_str()) != 0) {
+        logger().warn("Failed to replace signal metadata cache file {}",
+                      config.m_persistentCacheFile);
+    }
+}
+
+PersistedEntries_t readPersistentCache(const MetadataAgentConfig& config) {
+    std::ifstream file(config.m_persistentCacheFile);
+    if (!file) {
+        return {};
+    }
+    std::string line;
+    if (!std::getline(file, line) || line != PERSISTENT_CACHE_FORMAT ||
+        !std::getline(file, line) || line != "broker " + config.m_brokerIdentity ||
+        !std::getline(file, line) || line != "schema " + config.m_schemaVersion) {
+        logger().info("Ignoring signal metadata cache file {} of other format, databroker or "
+                      "schema version",
+                      config.m_persistentCacheFile);
+        return {};
+    }
+    PersistedEntries_t entries;
+    while (std::getline(file, line)) {
+        std::istringstream lineStream(line);
+        numeric_id_t       id{0};
+        std::string        path;
+        if (!(lineStream >> id >> path)) {
+            logger().warn("Ignoring corrupt signal metadata cache file {}",
+                          config.m_persistentCacheFile);
+            return {};
+        }
+        entries.emplace_back(id, std::move(path));
+    }
+    return entries;
+}
+
+ExecutorPtr_t createDefaultExecutor() {
+    return IExecutor::createThreadPool(ThreadPool::getInstance(ThreadPool::METADATA_POOL));
+}
+
 } // namespace
 
 class MetadataAgentImpl : public MetadataAgent {
 public:
-    explicit MetadataAgentImpl(std::shared_ptr<BrokerAsyncGrpcFacade> asyncBrokerFacade)
-        : m_asyncBrokerFacade(std::move(asyncBrokerFacade)) {}
+    MetadataAgentImpl(ListMetadataFunction_t listMetadata, const MetadataAgentConfig& config)
+        : m_listMetadata(std::move(listMetadata))
+        , m_config(config) {
+        m_config.m_maxParallelRequests = std::max<size_t>(config.m_maxParallelRequests, 1);
+        if (isCachePersistent()) {
+            loadPersistentCache();
+        }
+    }
 
     void query(const SignalPathList_t&                    signalPaths,
                std::function<void(MetadataList_t&&)>&&    onSuccess,
                std::function<void(const grpc::Status&)>&& onError) override;
     void invalidate(grpc::StatusCode statusCode) override;
+    void invalidateSignals(const std::vector<SignalHandle_t>& signalHandles) override;
+    void resolve(const std::vector<SignalHandle_t>& signalHandles) override;
+    void prefetch(const std::string& branch) override;
 
-    [[nodiscard]] MetadataPtr_t getByNumericId(numeric_id_t numericId) const override {
-        std::shared_lock lock(m_mutex);
-        return m_cache.getById(numericId);
+    void setChangeHandler(std::function<void()> changeHandler) override {
+        std::unique_lock lock(m_mutex);
+        m_changeHandler = std::move(changeHandler);
+    }
+
+    void setExecutor(ExecutorPtr_t executor) override {
+        std::unique_lock lock(m_mutex);
+        m_executor = executor ? std::move(executor) : createDefaultExecutor();
     }
 
+    [[nodiscard]] MetadataPtr_t getByNumericId(numeric_id_t numericId) const override;
+    [[nodiscard]] MetadataPtr_t getByHandle(SignalHandle_t signalHandle) const override;
+
 private:
-    void              addCachedMetadata(Query& query, const SignalPathList_t& signalPaths);
+    void              addCachedMetadata(Query& query, const std::vector<SignalHandle_t>& signals);
     void              addQuery(Query&& query);
-    void              addSetOfSignalToRequestQueue(const std::set<std::string>& signals);
-    void              addSignalToRequestQueue(const std::string& signalPath);
-    bool              isSignalPartOfActiveRequests(const std::string& signalPath) const;
+    void              addSetOfSignalToRequestQueue(const std::set<SignalHandle_t>& signals);
+    void              addSignalToRequestQueue(SignalHandle_t signal);
+    bool              isSignalPartOfActiveRequests(SignalHandle_t signal) const;
     void              triggerMetadataRequests();
     void              updateActiveRequests(const std::shared_ptr<Request>& request);
     std::deque<Query> updateQueriesAndExtractFulfilled(const MetadataPtr_t& metadata);
-    std::deque<Query> extractAffectedQueries(const std::string& signalPath);
+    std::deque<Query> extractAffectedQueries(SignalHandle_t signal);
     void              cancelActiveRequests();
-
-    std::shared_ptr<BrokerAsyncGrpcFacade> m_asyncBrokerFacade;
+    bool              isSignalPartOfActivePrefetches(SignalHandle_t signal) const;
+    std::vector<std::string> restartOutdatedPrefetches();
+    void startPrefetch(const std::string& branch, uint64_t cacheGeneration);
+    void onPrefetchDone(const std::string& branch, uint64_t cacheGeneration,
+                        const kuksa::val::v2::ListMetadataResponse* response);
+    bool updateCache(const MetadataPtr_t& metadata);
+    [[nodiscard]] bool isCachePersistent() const { return !m_config.m_persistentCacheFile.empty(); }
+    void               loadPersistentCache();
+    std::optional<PersistedEntries_t> takeCacheSnapshotIfIdle();
+    void onCacheUpdated(bool isChanged, const std::optional<PersistedEntries_t>& snapshot);
+
+    ListMetadataFunction_t m_listMetadata;
+    MetadataAgentConfig    m_config;
+    // distinguishes the agents in the per thread copies of the id index
+    const uint64_t m_instanceId{getNextInstanceId()};
 
     mutable std::shared_mutex          m_mutex;
-    MetadataCache                      m_cache;
+    mutable MetadataCache              m_cache;
     std::deque<Query>                  m_pendingQueries;
-    std::deque<std::string>            m_pendingSignals;
+    std::deque<SignalHandle_t>         m_pendingSignals;
     std::set<std::shared_ptr<Request>> m_activeRequests;
+    std::vector<std::string>           m_prefetchedBranches;
+    std::vector<std::string>           m_activePrefetches;
+    bool                               m_isPrefetchOutdated{false};
+    // incremented on each invalidation, so outdated prefetch responses get ignored
+    uint64_t m_cacheGeneration{0};
+    // signals whose cached metadata was not confirmed by the databroker yet
+    std::set<SignalHandle_t> m_unverifiedSignals;
+    bool                     m_isCacheDirty{false};
+    std::function<void()>    m_changeHandler;
+    ExecutorPtr_t            m_executor{createDefaultExecutor()};
+    std::mutex               m_persistenceMutex;
 };
 
+MetadataAgentConfig MetadataAgentConfig::fromEnvironment() {
+    MetadataAgentConfig config;
+    config.m_maxParallelRequests = determineMaxParallelRequests();
+    config.m_persistentCacheFile = getEnvVar("SDV_METADATA_CACHE_FILE");
+    config.m_schemaVersion       = getEnvVar("SDV_METADATA_CACHE_SCHEMA_VERSION");
+    return config;
+}
+
 std::shared_ptr<MetadataAgent>
-MetadataAgent::create(const std::shared_ptr<BrokerAsyncGrpcFacade>& brokerFacade) {
-    return std::make_shared<MetadataAgentImpl>(brokerFacade);
+MetadataAgent::create(const std::shared_ptr<BrokerAsyncGrpcFacade>& brokerFacade,
+                      const MetadataAgentConfig&                    config) {
+    return create(
+        [brokerFacade](auto request, auto onResponse, auto onError) {
+            brokerFacade->ListMetadata(std::move(request), std::move(onResponse),
+                                       std::move(onError));
+        },
+        config);
+}
+
+std::shared_ptr<MetadataAgent> MetadataAgent::create(ListMetadataFunction_t     listMetadata,
+                                                     const MetadataAgentConfig& config) {
+    return std::make_shared<MetadataAgentImpl>(std::move(listMetadata), config);
 }
 
 void MetadataAgentImpl::cancelActiveRequests() {
@@ -283,35 +542,294 @@ void MetadataAgentImpl::invalidate(grpc::StatusCode statusCode) {
     std::deque<Query> openQueries;
     {
         std::unique_lock lock(m_mutex);
-        m_cache.clear();
+        if (isCachePersistent()) {
+            // keep using the cached metadata (most probably the databroker just restarted with
+            // the same signals), but have it verified again
+            for (const auto& [id, metadata] : m_cache.getAllKnown()) {
+                m_unverifiedSignals.insert(metadata->m_signalHandle);
+            }
+        } else {
+            m_cache.clear();
+        }
         m_pendingQueries.swap(openQueries);
         m_pendingSignals.clear();
         cancelActiveRequests();
+        ++m_cacheGeneration;
+        m_activePrefetches.clear();
+        m_isPrefetchOutdated = !m_prefetchedBranches.empty();
     }
     notifyQueryInitiators(std::move(openQueries), grpc::Status(statusCode, "Cache invalidation"));
 }
 
-void MetadataAgentImpl::addCachedMetadata(Query& query, const SignalPathList_t& signalPaths) {
-    for (const auto& path : signalPaths) {
-        if (auto metadata = m_cache.getByPath(path)) {
+void MetadataAgentImpl::invalidateSignals(const std::vector<SignalHandle_t>& signalHandles) {
+    logger().debug("Invalidating signal metadata of {} signals", signalHandles.size());
+    std::unique_lock lock(m_mutex);
+    for (const auto signal : signalHandles) {
+        if (m_cache.isPresent(signal)) {
+            // verified again like persisted metadata, so queries are not held up meanwhile
+            m_unverifiedSignals.insert(signal);
+            addSignalToRequestQueue(signal);
+        }
+    }
+    triggerMetadataRequests();
+}
+
+void MetadataAgentImpl::resolve(const std::vector<SignalHandle_t>& signalHandles) {
+    std::unique_lock lock(m_mutex);
+    for (const auto signal : signalHandles) {
+        if (!m_cache.isPresent(signal) || m_unverifiedSignals.count(signal) > 0) {
+            addSignalToRequestQueue(signal);
+        }
+    }
+    triggerMetadataRequests();
+}
+
+void MetadataAgentImpl::addCachedMetadata(Query&                             query,
+                                          const std::vector<SignalHandle_t>& signals) {
+    static auto& hits = MetricsRegistry::getInstance().getCounter(
+        "sdv_metadata_cache_hits_total", "Number of queried signals whose metadata was cached");
+    static auto& misses = MetricsRegistry::getInstance().getCounter(
+        "sdv_metadata_cache_misses_total",
+        "Number of queried signals whose metadata needed to be requested");
+    uint64_t numHits{0};
+    for (const auto signal : signals) {
+        if (auto metadata = m_cache.getByHandle(signal)) {
             query.addMetadata(metadata);
+            ++numHits;
         }
     }
+    hits.increment(numHits);
+    misses.increment(signals.size() - numHits);
 }
 
 void MetadataAgentImpl::query(const SignalPathList_t&                    signalPaths,
                               std::function<void(MetadataList_t&&)>&&    onSuccess,
                               std::function<void(const grpc::Status&)>&& onError) {
-    Query query(signalPaths, std::move(onSuccess), std::move(onError));
+    std::vector<SignalHandle_t> signals;
+    signals.reserve(signalPaths.size());
+    auto& registry = SignalPathRegistry::getInstance();
+    for (const auto& path : signalPaths) {
+        signals.push_back(registry.intern(path));
+    }
+
+    Query                    query(signals, std::move(onSuccess), std::move(onError));
+    bool                     isFulfilled{false};
+    std::vector<std::string> prefetches;
+    uint64_t                 cacheGeneration{0};
     {
         std::unique_lock lock(m_mutex);
-        addCachedMetadata(query, signalPaths);
-        if (!query.isFulfilled()) {
+        prefetches      = restartOutdatedPrefetches();
+        cacheGeneration = m_cacheGeneration;
+        addCachedMetadata(query, signals);
+        isFulfilled = query.isFulfilled();
+        if (!isFulfilled) {
             addQuery(std::move(query));
+        }
+        if (!m_unverifiedSignals.empty()) {
+            // verify in the background; the query does not wait for it
+            for (const auto signal : signals) {
+                if (m_unverifiedSignals.count(signal) > 0) {
+                    addSignalToRequestQueue(signal);
+                }
+            }
+            triggerMetadataRequests();
+        }
+    }
+    for (const auto& branch : prefetches) {
+        startPrefetch(branch, cacheGeneration);
+    }
+    if (isFulfilled) {
+        query.notifyInitiator();
+    }
+}
+
+void MetadataAgentImpl::prefetch(const std::string& branch) {
+    uint64_t cacheGeneration{0};
+    {
+        std::unique_lock lock(m_mutex);
+        if (std::find(m_prefetchedBranches.cbegin(), m_prefetchedBranches.cend(), branch) ==
+            m_prefetchedBranches.cend()) {
+            m_prefetchedBranches.push_back(branch);
+        }
+        if (std::find(m_activePrefetches.cbegin(), m_activePrefetches.cend(), branch) !=
+            m_activePrefetches.cend()) {
             return;
         }
+        m_activePrefetches.push_back(branch);
+        cacheGeneration = m_cacheGeneration;
+    }
+    startPrefetch(branch, cacheGeneration);
+}
+
+std::vector<std::string> MetadataAgentImpl::restartOutdatedPrefetches() {
+    if (!m_isPrefetchOutdated) {
+        return {};
+    }
+    m_isPrefetchOutdated = false;
+    m_activePrefetches   = m_prefetchedBranches;
+    return m_prefetchedBranches;
+}
+
+void MetadataAgentImpl::startPrefetch(const std::string& branch, uint64_t cacheGeneration) {
+    logger().debug("Prefetching signal metadata of branch {}", branch);
+    kuksa::val::v2::ListMetadataRequest request;
+    request.set_root(branch);
+    m_listMetadata(
+        std::move(request),
+        [this, branch, cacheGeneration](const auto& response) {
+            onPrefetchDone(branch, cacheGeneration, &response);
+        },
+        [this, branch, cacheGeneration](const auto& status) {
+            logger().warn("Prefetching signal metadata of branch {} failed: {}", branch,
+                          status.error_message());
+            onPrefetchDone(branch, cacheGeneration, nullptr);
+        });
+}
+
+void MetadataAgentImpl::onPrefetchDone(const std::string& branch, uint64_t cacheGeneration,
+                                       const kuksa::val::v2::ListMetadataResponse* response) {
+    std::deque<Query>                 fulfilledQueries;
+    bool                              isChanged{false};
+    std::optional<PersistedEntries_t> snapshot;
+    {
+        std::unique_lock lock(m_mutex);
+        if (cacheGeneration != m_cacheGeneration) {
+            return; // the cache got invalidated in the meantime
+        }
+        m_activePrefetches.erase(
+            std::remove(m_activePrefetches.begin(), m_activePrefetches.end(), branch),
+            m_activePrefetches.end());
+
+        if (response != nullptr) {
+            auto& registry = SignalPathRegistry::getInstance();
+            for (const auto& entry : response->metadata()) {
+                // older databroker versions do not provide the path
+                if (entry.path().empty()) {
+                    continue;
+                }
+                const auto type     = convertFromGrpcDataType(entry.data_type());
+                auto       metadata = createMetadata(
+                    Metadata{entry.path(), entry.id(), true, registry.intern(entry.path()), type});
+                isChanged |= updateCache(metadata);
+                auto newlyFulfilled = updateQueriesAndExtractFulfilled(metadata);
+                std::move(newlyFulfilled.begin(), newlyFulfilled.end(),
+                          std::back_inserter(fulfilledQueries));
+            }
+            m_pendingSignals.erase(std::remove_if(m_pendingSignals.begin(),
+                                                  m_pendingSignals.end(),
+                                                  [this](auto signal) {
+                                                      return m_cache.isPresent(signal);
+                                                  }),
+                                   m_pendingSignals.end());
+        }
+
+        // the signals which were waiting for the prefetch, but are not contained in its
+        // response (or if it failed) are requested one by one now
+        for (const auto& query : m_pendingQueries) {
+            addSetOfSignalToRequestQueue(query.getMissingSignals());
+        }
+        triggerMetadataRequests();
+        snapshot = takeCacheSnapshotIfIdle();
+    }
+    onCacheUpdated(isChanged, snapshot);
+    notifyQueryInitiators(std::move(fulfilledQueries));
+}
+
+MetadataPtr_t MetadataAgentImpl::getByNumericId(numeric_id_t numericId) const {
+    // Called for each entry of each subscription update, so it must not take any lock as long
+    // as the cache is unchanged: each thread keeps its own reference to the latest immutable
+    // id index and only replaces it if the cache got modified in the meantime.
+    struct ThreadLocalIndex {
+        uint64_t     m_instanceId{0};
+        uint64_t     m_version{0};
+        IdIndexPtr_t m_index;
+    };
+    thread_local ThreadLocalIndex threadLocalIndex;
+
+    if (threadLocalIndex.m_instanceId != m_instanceId ||
+        threadLocalIndex.m_version != m_cache.getVersion() || !threadLocalIndex.m_index) {
+        std::unique_lock lock(m_mutex);
+        threadLocalIndex.m_index      = m_cache.getIdIndex(threadLocalIndex.m_version);
+        threadLocalIndex.m_instanceId = m_instanceId;
+    }
+    return threadLocalIndex.m_index->find(numericId);
+}
+
+MetadataPtr_t MetadataAgentImpl::getByHandle(SignalHandle_t signalHandle) const {
+    std::shared_lock lock(m_mutex);
+    if (m_unverifiedSignals.count(signalHandle) > 0) {
+        return {};
+    }
+    return m_cache.getByHandle(signalHandle);
+}
+
+bool MetadataAgentImpl::updateCache(const MetadataPtr_t& metadata) {
+    const auto cachedMetadata = m_cache.getByHandle(metadata->m_signalHandle);
+    const bool isChanged =
+        cachedMetadata && (cachedMetadata->m_isKnown != metadata->m_isKnown ||
+                           cachedMetadata->m_id != metadata->m_id);
+    if (isChanged) {
+        logger().info("Databroker reports changed metadata for {}", metadata->m_signalPath);
+    }
+    m_unverifiedSignals.erase(metadata->m_signalHandle);
+    m_cache.add(metadata);
+    m_isCacheDirty = true;
+    return isChanged;
+}
+
+void MetadataAgentImpl::loadPersistentCache() {
+    auto& registry = SignalPathRegistry::getInstance();
+    for (auto& [id, path] : readPersistentCache(m_config)) {
+        const auto signal = registry.intern(path);
+        m_cache.add(createMetadata(Metadata{std::move(path), id, true, signal}));
+        m_unverifiedSignals.insert(signal);
+    }
+    if (!m_unverifiedSignals.empty()) {
+        logger().info("Loaded metadata of {} signals from {}", m_unverifiedSignals.size(),
+                      m_config.m_persistentCacheFile);
+    }
+}
+
+std::optional<PersistedEntries_t> MetadataAgentImpl::takeCacheSnapshotIfIdle() {
+    if (!isCachePersistent() || !m_isCacheDirty || !m_activeRequests.empty() ||
+        !m_pendingSignals.empty() || !m_activePrefetches.empty()) {
+        return std::nullopt;
+    }
+    m_isCacheDirty = false;
+    PersistedEntries_t entries;
+    entries.reserve(m_cache.getAllKnown().size());
+    for (const auto& [id, metadata] : m_cache.getAllKnown()) {
+        entries.emplace_back(id, metadata->m_signalPath);
+    }
+    return entries;
+}
+
+void MetadataAgentImpl::onCacheUpdated(bool                                     isChanged,
+                                       const std::optional<PersistedEntries_t>& snapshot) {
+    if (snapshot) {
+        std::lock_guard lock(m_persistenceMutex);
+        writePersistentCache(m_config, *snapshot);
+    }
+    if (isChanged) {
+        std::function<void()> changeHandler;
+        {
+            std::shared_lock lock(m_mutex);
+            changeHandler = m_changeHandler;
+        }
+        if (changeHandler) {
+            changeHandler();
+        }
     }
-    query.notifyInitiator();
+}
+
+bool MetadataAgentImpl::isSignalPartOfActivePrefetches(SignalHandle_t signal) const {
+    if (m_activePrefetches.empty()) {
+        return false;
+    }
+    const auto& signalPath = SignalPathRegistry::getInstance().getPath(signal);
+    return std::any_of(
+        m_activePrefetches.cbegin(), m_activePrefetches.cend(),
+        [&signalPath](const auto& branch) { return isPartOfBranch(signalPath, branch); });
 }
 
 void MetadataAgentImpl::addQuery(Query&& query) {
@@ -320,41 +838,47 @@ void MetadataAgentImpl::addQuery(Query&& query) {
     triggerMetadataRequests();
 }
 
-bool MetadataAgentImpl::isSignalPartOfActiveRequests(const std::string& signalPath) const {
+bool MetadataAgentImpl::isSignalPartOfActiveRequests(SignalHandle_t signal) const {
     return std::any_of(
         m_activeRequests.cbegin(), m_activeRequests.cend(),
-        [signalPath](const auto& request) { return signalPath == request->getSignalPath(); });
+        [signal](const auto& request) { return signal == request->getSignalHandle(); });
 }
 
-void MetadataAgentImpl::addSignalToRequestQueue(const std::string& signalPath) {
-    if (!isSignalPartOfActiveRequests(signalPath) &&
-        (std::find(m_pendingSignals.cbegin(), m_pendingSignals.cend(), signalPath) ==
+void MetadataAgentImpl::addSignalToRequestQueue(SignalHandle_t signal) {
+    if (!isSignalPartOfActiveRequests(signal) && !isSignalPartOfActivePrefetches(signal) &&
+        (std::find(m_pendingSignals.cbegin(), m_pendingSignals.cend(), signal) ==
          m_pendingSignals.end())) {
-        m_pendingSignals.push_back(signalPath);
+        m_pendingSignals.push_back(signal);
     }
 }
 
-void MetadataAgentImpl::addSetOfSignalToRequestQueue(const std::set<std::string>& signals) {
-    for (const auto& signalPath : signals) {
-        addSignalToRequestQueue(signalPath);
+void MetadataAgentImpl::addSetOfSignalToRequestQueue(const std::set<SignalHandle_t>& signals) {
+    for (const auto signal : signals) {
+        addSignalToRequestQueue(signal);
     }
 }
 
 void MetadataAgentImpl::triggerMetadataRequests() {
-    while (!m_pendingSignals.empty() && (m_activeRequests.size() < MAX_PARALLEL_REQUESTS)) {
+    std::vector<JobFunction> initiations;
+    while (!m_pendingSignals.empty() &&
+           (m_activeRequests.size() < m_config.m_maxParallelRequests)) {
         auto request = Request::create(
             m_pendingSignals.front(),
             [this](const auto& request, const auto& metadata) {
                 assert(request && metadata);
-                std::deque<Query> fulfilledQueries;
+                std::deque<Query>                 fulfilledQueries;
+                bool                              isChanged{false};
+                std::optional<PersistedEntries_t> snapshot;
                 {
                     std::unique_lock lock(m_mutex);
                     updateActiveRequests(request);
                     if (!request->isCancelled()) {
-                        m_cache.add(metadata);
+                        isChanged        = updateCache(metadata);
                         fulfilledQueries = updateQueriesAndExtractFulfilled(metadata);
+                        snapshot         = takeCacheSnapshotIfIdle();
                     }
                 }
+                onCacheUpdated(isChanged, snapshot);
                 notifyQueryInitiators(std::move(fulfilledQueries));
             },
             [this](const auto& request, const auto& status) {
@@ -364,14 +888,17 @@ void MetadataAgentImpl::triggerMetadataRequests() {
                     std::unique_lock lock(m_mutex);
                     updateActiveRequests(request);
                     if (!request->isCancelled()) {
-                        affectedQueries = extractAffectedQueries(request->getSignalPath());
+                        affectedQueries = extractAffectedQueries(request->getSignalHandle());
                     }
                 }
                 notifyQueryInitiators(std::move(affectedQueries), status);
             });
         m_pendingSignals.pop_front();
         m_activeRequests.insert(request);
-        request->initiate(m_asyncBrokerFacade);
+        initiations.push_back(request->createInitiation(m_listMetadata));
+    }
+    if (!initiations.empty()) {
+        m_executor->postBatch(std::move(initiations));
     }
 }
 
@@ -397,11 +924,11 @@ MetadataAgentImpl::updateQueriesAndExtractFulfilled(const MetadataPtr_t& metadat
     return fulfilledQueries;
 }
 
-std::deque<Query> MetadataAgentImpl::extractAffectedQueries(const std::string& signalPath) {
+std::deque<Query> MetadataAgentImpl::extractAffectedQueries(SignalHandle_t signal) {
     std::deque<Query> affectedQueries;
     auto              queryIter = m_pendingQueries.begin();
     while (queryIter != m_pendingQueries.end()) {
-        if (queryIter->getMissingSignals().count(signalPath) > 0) {
+        if (queryIter->getMissingSignals().count(signal) > 0) {
             affectedQueries.push_back(std::move(*queryIter));
             queryIter = m_pendingQueries.erase(queryIter);
         } else {
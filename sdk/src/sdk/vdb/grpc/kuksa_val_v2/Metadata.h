@@ -17,8 +17,17 @@
 #ifndef VEHICLE_APP_SDK_VDB_GRPC_KUKSA_VAL_V2_METADATA_H
 #define VEHICLE_APP_SDK_VDB_GRPC_KUKSA_VAL_V2_METADATA_H
 
+#include "sdk/DataPointValue.h"
+#include "sdk/Executor.h"
+#include "sdk/LazyDataPoint.h"
+#include "sdk/SignalPathRegistry.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/TypeConversions.h"
+
+#include "kuksa/val/v2/val.pb.h"
+
 #include <grpcpp/support/status_code_enum.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -35,9 +44,15 @@ namespace velocitas::kuksa_val_v2 {
 using numeric_id_t = int32_t;
 
 struct Metadata {
-    std::string  m_signalPath;
-    numeric_id_t m_id{0};
-    bool         m_isKnown{false};
+    std::string    m_signalPath;
+    numeric_id_t   m_id{0};
+    bool           m_isKnown{false};
+    SignalHandle_t m_signalHandle{INVALID_SIGNAL_HANDLE};
+    /** Type of the signal's data points; INVALID if not known, e.g. if loaded from a persisted
+     * cache and not verified yet */
+    DataPointValue::Type m_type{DataPointValue::Type::INVALID};
+    /** Decoder of the signal's data points received via subscriptions, bound to its type */
+    LazySample::Decoder_t m_decoder{getDataPointDecoder(DataPointValue::Type::INVALID)};
 };
 
 using MetadataPtr_t  = std::shared_ptr<Metadata>;
@@ -47,6 +62,39 @@ using SignalPathList_t = std::vector<std::string>;
 
 class BrokerAsyncGrpcFacade;
 
+/**
+ * Configuration of the MetadataAgent.
+ */
+struct MetadataAgentConfig {
+    /** Default maximum number of ListMetadata requests in flight at the same time */
+    static constexpr size_t DEFAULT_MAX_PARALLEL_REQUESTS = 5;
+
+    /** Maximum number of ListMetadata requests for single signals in flight at the same time */
+    size_t m_maxParallelRequests{DEFAULT_MAX_PARALLEL_REQUESTS};
+
+    /**
+     * File the cached metadata is persisted to, so it is available right away after a restart.
+     * Persisted metadata is used immediately but is verified against the databroker on first
+     * use. Empty if the cache shall not be persisted.
+     */
+    std::string m_persistentCacheFile;
+
+    /** Identity of the databroker (e.g. its address); persisted metadata of others is ignored */
+    std::string m_brokerIdentity;
+
+    /** Version of the signal schema (e.g. VSS) used by the app; persisted metadata of other
+     * schema versions is ignored */
+    std::string m_schemaVersion;
+
+    /**
+     * @brief Get the configuration as specified via environment variables:
+     *        SDV_METADATA_MAX_PARALLEL_REQUESTS  maximum number of parallel requests
+     *        SDV_METADATA_CACHE_FILE             file to persist the cache to
+     *        SDV_METADATA_CACHE_SCHEMA_VERSION   schema version of the persisted cache
+     */
+    static MetadataAgentConfig fromEnvironment();
+};
+
 /**
  * Provides access to (VSS) metadata hosted by the KUKSA Databroker.
  *
@@ -54,7 +102,20 @@ class BrokerAsyncGrpcFacade;
  */
 class MetadataAgent {
 public:
-    static std::shared_ptr<MetadataAgent> create(const std::shared_ptr<BrokerAsyncGrpcFacade>&);
+    using ListMetadataFunction_t = std::function<void(
+        kuksa::val::v2::ListMetadataRequest,
+        std::function<void(const kuksa::val::v2::ListMetadataResponse&)>,
+        std::function<void(const grpc::Status&)>)>;
+
+    static std::shared_ptr<MetadataAgent> create(const std::shared_ptr<BrokerAsyncGrpcFacade>&,
+                                                 const MetadataAgentConfig& config = {});
+
+    /**
+     * @brief Create an agent issuing its ListMetadata requests via the passed function, i.e.
+     *        BrokerAsyncGrpcFacade::ListMetadata.
+     */
+    static std::shared_ptr<MetadataAgent> create(ListMetadataFunction_t     listMetadata,
+                                                 const MetadataAgentConfig& config = {});
     virtual ~MetadataAgent() = default;
 
     /**
@@ -80,6 +141,52 @@ public:
      */
     virtual void invalidate(grpc::StatusCode statusCode = grpc::StatusCode::UNAVAILABLE) = 0;
 
+    /**
+     * @brief Invalidates the cached metadata of the passed signals only, e.g. because the
+     * databroker rejected a request addressing them by id. Their metadata is requested again
+     * right away; until it is confirmed, getByHandle returns nullptr for them, while queries keep
+     * being served from the cache. Pending queries are not affected.
+     *
+     * @param signalHandles Handles of the paths of the signals
+     */
+    virtual void invalidateSignals(const std::vector<SignalHandle_t>& signalHandles) = 0;
+
+    /**
+     * @brief Asynchronously requests the metadata of those of the passed signals which are not
+     * cached or not confirmed yet, without waiting for it, so they can be addressed by id once
+     * it is available (see getByHandle).
+     *
+     * @param signalHandles Handles of the paths of the signals
+     */
+    virtual void resolve(const std::vector<SignalHandle_t>& signalHandles) = 0;
+
+    /**
+     * @brief Asynchronously fetches the metadata of all signals of the passed branch via a
+     * single request and fills the cache with it. Queries for signals of the branch issued while
+     * the prefetch is running wait for it instead of requesting the signals one by one; signals
+     * not contained in the response are requested individually afterwards.
+     * Prefetched branches are fetched again by the first query after an invalidation.
+     *
+     * @param branch Path of the branch, e.g. "Vehicle"
+     */
+    virtual void prefetch(const std::string& branch) = 0;
+
+    /**
+     * @brief Set the function to be called if the databroker reports metadata differing from
+     * the cached one, i.e. a numeric id changed. Clients having used the outdated metadata (e.g.
+     * for subscriptions) need to request it again.
+     *
+     * @param changeHandler Function to call; it is called without any lock of the agent held.
+     */
+    virtual void setChangeHandler(std::function<void()> changeHandler) = 0;
+
+    /**
+     * @brief Set the executor initiating the metadata requests.
+     *
+     * @param executor  The executor to use; nullptr for the metadata thread pool.
+     */
+    virtual void setExecutor(ExecutorPtr_t executor) = 0;
+
     /**
      * @brief Get metadata of a signal reference by its numeric id.
      *
@@ -89,6 +196,16 @@ public:
      * nullptr is returned if the passed id is unknown.
      */
     [[nodiscard]] virtual MetadataPtr_t getByNumericId(numeric_id_t mumericId) const = 0;
+
+    /**
+     * @brief Get the cached metadata of a signal, without requesting it from the databroker.
+     *
+     * @param signalHandle Handle of the path of the signal
+     * @return MetadataPtr_t Points to the metadata of the signal if it is cached and was verified
+     * against the databroker of the current session (i.e. not only loaded from the persisted
+     * cache), a nullptr otherwise.
+     */
+    [[nodiscard]] virtual MetadataPtr_t getByHandle(SignalHandle_t signalHandle) const = 0;
 };
 
 } // namespace velocitas::kuksa_val_v2
@@ -0,0 +1,407 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/grpc/kuksa_val_v2/ProviderStream.h"
+
+#include "sdk/DataPointValue.h"
+#include "sdk/Job.h"
+#include "sdk/Logger.h"
+#include "sdk/ThreadPool.h"
+#include "sdk/grpc/GrpcClient.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/TypeConversions.h"
+
+#include <fmt/core.h>
+#include <grpcpp/support/status.h>
+
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+
+namespace velocitas::kuksa_val_v2 {
+
+namespace {
+
+using SetErrorMap_t = IVehicleDataBrokerClient::SetErrorMap_t;
+
+// Request ids of the stream are int32 values; map the sequence numbers to their positive range
+int32_t toRequestId(uint64_t sequenceNumber) {
+    return static_cast<int32_t>(sequenceNumber & 0x7FFFFFFFU);
+}
+
+std::string formatError(const kuksa::val::v2::Error& error) {
+    return fmt::format("{}: {}", kuksa::val::v2::ErrorCode_Name(error.code()), error.message());
+}
+
+struct PublishRequest {
+    kuksa::val::v2::PublishValuesRequest m_request;
+    std::map<int32_t, std::string>       m_signalPaths;
+    SetErrorMap_t                        m_errors;
+    AsyncResultPtr_t<SetErrorMap_t>      m_result;
+};
+
+/** Outcome of a publish request, passed to its result after releasing the lock */
+struct Completion {
+    AsyncResultPtr_t<SetErrorMap_t> m_result;
+    SetErrorMap_t                   m_errors;
+    std::optional<std::string>      m_failure;
+};
+
+void complete(std::vector<Completion>& completions) {
+    for (auto& completion : completions) {
+        if (completion.m_failure) {
+            completion.m_result->insertError(Status(*completion.m_failure));
+        } else {
+            completion.m_result->insertResult(std::move(completion.m_errors));
+        }
+    }
+}
+
+} // namespace
+
+class ProviderStreamImpl : public ProviderStream,
+                           public std::enable_shared_from_this<ProviderStreamImpl> {
+public:
+    ProviderStreamImpl(StreamOpener_t streamOpener, std::shared_ptr<MetadataAgent> metadataAgent,
+                       ProviderStreamConfig config)
+        : m_streamOpener(std::move(streamOpener))
+        , m_metadataAgent(std::move(metadataAgent))
+        , m_config(config) {}
+
+    ~ProviderStreamImpl() override {
+        std::vector<Completion> completions;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            closeCall();
+            failPendingRequests("Provider stream destroyed", completions);
+        }
+        complete(completions);
+    }
+
+    ProviderStreamImpl(const ProviderStreamImpl&)            = delete;
+    ProviderStreamImpl(ProviderStreamImpl&&)                 = delete;
+    ProviderStreamImpl& operator=(const ProviderStreamImpl&) = delete;
+    ProviderStreamImpl& operator=(ProviderStreamImpl&&)      = delete;
+
+    AsyncResultPtr_t<SetErrorMap_t>
+    publish(const std::vector<std::unique_ptr<DataPointValue>>& values) override;
+
+    [[nodiscard]] size_t getNumPendingRequests() const override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_numPendingRequests;
+    }
+
+private:
+    void onMetadataPresent(const MetadataList_t&                    metadataList,
+                           std::vector<kuksa::val::v2::Datapoint>&& dataPoints,
+                           const AsyncResultPtr_t<SetErrorMap_t>&   result);
+    void onQueryFailed();
+    void onResponse(uint64_t callGeneration, kuksa::val::v2::OpenProviderStreamResponse& response);
+    void onWriteDone(uint64_t callGeneration, bool isOk);
+    void onFinish(uint64_t callGeneration, const grpc::Status& status);
+    void acknowledge(uint64_t callGeneration, uint64_t sequenceNumber);
+
+    void sendQueuedRequests();
+    void openCall();
+    void closeCall();
+    void completeInFlightRequest(std::map<uint64_t, PublishRequest>::iterator iter,
+                                 std::vector<Completion>&                   completions);
+    void failPendingRequests(const std::string& reason, std::vector<Completion>& completions);
+
+    StreamOpener_t                 m_streamOpener;
+    std::shared_ptr<MetadataAgent> m_metadataAgent;
+    const ProviderStreamConfig     m_config;
+
+    mutable std::mutex                 m_mutex;
+    std::shared_ptr<ProviderCall_t>    m_call;
+    uint64_t                           m_callGeneration{0};
+    uint64_t                           m_nextSequenceNumber{1};
+    size_t                             m_numPendingRequests{0};
+    std::deque<PublishRequest>         m_queuedRequests;
+    std::map<uint64_t, PublishRequest> m_inFlightRequests;
+    // sequence numbers of the written requests not yet reported by the call, in write order
+    std::deque<uint64_t> m_unconfirmedWrites;
+    GrpcClient           m_closedCalls;
+};
+
+std::shared_ptr<ProviderStream> ProviderStream::create(StreamOpener_t                 streamOpener,
+                                                       std::shared_ptr<MetadataAgent> metadataAgent,
+                                                       ProviderStreamConfig           config) {
+    return std::make_shared<ProviderStreamImpl>(std::move(streamOpener), std::move(metadataAgent),
+                                                config);
+}
+
+AsyncResultPtr_t<SetErrorMap_t>
+ProviderStreamImpl::publish(const std::vector<std::unique_ptr<DataPointValue>>& values) {
+    auto result = std::make_shared<AsyncResult<SetErrorMap_t>>();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_numPendingRequests >= m_config.m_maxInFlightRequests + m_config.m_maxQueuedRequests) {
+            result->insertError(Status("PublishDatapoints failed: Too many pending requests"));
+            return result;
+        }
+        ++m_numPendingRequests;
+    }
+
+    SignalPathList_t                       signalPaths;
+    std::vector<kuksa::val::v2::Datapoint> dataPoints;
+    signalPaths.reserve(values.size());
+    dataPoints.reserve(values.size());
+    for (const auto& value : values) {
+        signalPaths.push_back(value->getPath());
+        auto& dataPoint = dataPoints.emplace_back();
+        convertToGrpcValue(*value, *dataPoint.mutable_value());
+        const auto& timestamp = value->getTimestamp();
+        if (!(timestamp == Timestamp{})) {
+            dataPoint.mutable_timestamp()->set_seconds(timestamp.seconds);
+            dataPoint.mutable_timestamp()->set_nanos(timestamp.nanos);
+        }
+    }
+
+    m_metadataAgent->query(
+        signalPaths,
+        [weakThis = weak_from_this(), result,
+         dataPoints = std::move(dataPoints)](MetadataList_t&& metadataList) mutable {
+            if (auto thisPtr = weakThis.lock()) {
+                thisPtr->onMetadataPresent(metadataList, std::move(dataPoints), result);
+            } else {
+                result->insertError(Status("PublishDatapoints failed: Provider stream destroyed"));
+            }
+        },
+        [weakThis = weak_from_this(), result](const grpc::Status& status) {
+            if (auto thisPtr = weakThis.lock()) {
+                thisPtr->onQueryFailed();
+            }
+            result->insertError(
+                Status(fmt::format("PublishDatapoints failed: {}", status.error_message())));
+        });
+    return result;
+}
+
+void ProviderStreamImpl::onMetadataPresent(const MetadataList_t&                    metadataList,
+                                           std::vector<kuksa::val::v2::Datapoint>&& dataPoints,
+                                           const AsyncResultPtr_t<SetErrorMap_t>&   result) {
+    PublishRequest request;
+    request.m_result      = result;
+    auto& requestedPoints = *request.m_request.mutable_data_points();
+    for (size_t i = 0; i < metadataList.size() && i < dataPoints.size(); ++i) {
+        const auto& metadata = *metadataList[i];
+        if (metadata.m_isKnown) {
+            const auto signalId             = static_cast<int32_t>(metadata.m_id);
+            requestedPoints[signalId]       = std::move(dataPoints[i]);
+            request.m_signalPaths[signalId] = metadata.m_signalPath;
+        } else {
+            request.m_errors[metadata.m_signalPath] =
+                "ERROR_CODE_NOT_FOUND: Signal is not known by the databroker";
+        }
+    }
+
+    if (requestedPoints.empty()) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            --m_numPendingRequests;
+        }
+        result->insertResult(std::move(request.m_errors));
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queuedRequests.push_back(std::move(request));
+    sendQueuedRequests();
+}
+
+void ProviderStreamImpl::onQueryFailed() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    --m_numPendingRequests;
+}
+
+void ProviderStreamImpl::onResponse(uint64_t                                    callGeneration,
+                                    kuksa::val::v2::OpenProviderStreamResponse& response) {
+    if (!response.has_publish_values_response()) {
+        return;
+    }
+    const auto&             publishResponse = response.publish_values_response();
+    std::vector<Completion> completions;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (callGeneration != m_callGeneration) {
+            return;
+        }
+        auto iter = std::find_if(m_inFlightRequests.begin(), m_inFlightRequests.end(),
+                                 [&publishResponse](const auto& entry) {
+                                     return toRequestId(entry.first) ==
+                                            publishResponse.request_id();
+                                 });
+        if (iter == m_inFlightRequests.end()) {
+            logger().warn("Provider stream: Response to unknown request {}",
+                          publishResponse.request_id());
+            return;
+        }
+
+        // the databroker processes the requests in order: all earlier ones were accepted
+        while (m_inFlightRequests.begin() != iter) {
+            completeInFlightRequest(m_inFlightRequests.begin(), completions);
+        }
+        auto& errors = iter->second.m_errors;
+        for (const auto& [signalId, error] : publishResponse.status()) {
+            const auto pathIter = iter->second.m_signalPaths.find(signalId);
+            errors[pathIter != iter->second.m_signalPaths.end()
+                       ? pathIter->second
+                       : fmt::format("<signal id {}>", signalId)] = formatError(error);
+        }
+        completeInFlightRequest(iter, completions);
+        sendQueuedRequests();
+    }
+    complete(completions);
+}
+
+void ProviderStreamImpl::onWriteDone(uint64_t callGeneration, bool isOk) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (callGeneration != m_callGeneration || m_unconfirmedWrites.empty()) {
+        return;
+    }
+    const auto sequenceNumber = m_unconfirmedWrites.front();
+    m_unconfirmedWrites.pop_front();
+    if (!isOk) {
+        // the stream is broken, its requests are failed once it is finished
+        return;
+    }
+    ThreadPool::getInstance(ThreadPool::VDB_POOL)
+        ->enqueue(Job::create(
+            [weakThis = weak_from_this(), callGeneration, sequenceNumber]() {
+                if (auto thisPtr = weakThis.lock()) {
+                    thisPtr->acknowledge(callGeneration, sequenceNumber);
+                }
+            },
+            m_config.m_acknowledgeDelay));
+}
+
+void ProviderStreamImpl::acknowledge(uint64_t callGeneration, uint64_t sequenceNumber) {
+    std::vector<Completion> completions;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (callGeneration != m_callGeneration) {
+            return;
+        }
+        auto iter = m_inFlightRequests.find(sequenceNumber);
+        if (iter == m_inFlightRequests.end()) {
+            // already completed by a response to a later request
+            return;
+        }
+        completeInFlightRequest(iter, completions);
+        sendQueuedRequests();
+    }
+    complete(completions);
+}
+
+void ProviderStreamImpl::onFinish(uint64_t callGeneration, const grpc::Status& status) {
+    std::vector<Completion> completions;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (callGeneration != m_callGeneration) {
+            return;
+        }
+        logger().warn("Provider stream closed: {} ({})", status.error_message(),
+                      static_cast<int>(status.error_code()));
+        closeCall();
+        failPendingRequests(
+            fmt::format("Provider stream closed: {}", status.error_message()), completions);
+    }
+    if (status.error_code() == grpc::StatusCode::UNAVAILABLE) {
+        m_metadataAgent->invalidate(status.error_code());
+    }
+    complete(completions);
+}
+
+void ProviderStreamImpl::sendQueuedRequests() {
+    while (!m_queuedRequests.empty() &&
+           m_inFlightRequests.size() < m_config.m_maxInFlightRequests) {
+        if (!m_call) {
+            openCall();
+        }
+        const auto sequenceNumber = m_nextSequenceNumber++;
+        auto& request =
+            m_inFlightRequests.emplace(sequenceNumber, std::move(m_queuedRequests.front()))
+                .first->second;
+        m_queuedRequests.pop_front();
+
+        kuksa::val::v2::OpenProviderStreamRequest streamRequest;
+        auto& publishRequest = *streamRequest.mutable_publish_values_request();
+        publishRequest.Swap(&request.m_request);
+        publishRequest.set_request_id(toRequestId(sequenceNumber));
+        m_unconfirmedWrites.push_back(sequenceNumber);
+        m_call->write(std::move(streamRequest));
+    }
+}
+
+void ProviderStreamImpl::openCall() {
+    const auto callGeneration = ++m_callGeneration;
+    m_unconfirmedWrites.clear();
+    m_call = m_streamOpener(
+        [weakThis = weak_from_this(),
+         callGeneration](kuksa::val::v2::OpenProviderStreamResponse& response) {
+            if (auto thisPtr = weakThis.lock()) {
+                thisPtr->onResponse(callGeneration, response);
+            }
+        },
+        [weakThis = weak_from_this(), callGeneration](bool isOk) {
+            if (auto thisPtr = weakThis.lock()) {
+                thisPtr->onWriteDone(callGeneration, isOk);
+            }
+        },
+        [weakThis = weak_from_this(), callGeneration](const grpc::Status& status) {
+            if (auto thisPtr = weakThis.lock()) {
+                thisPtr->onFinish(callGeneration, status);
+            }
+        });
+}
+
+void ProviderStreamImpl::closeCall() {
+    ++m_callGeneration;
+    m_unconfirmedWrites.clear();
+    if (m_call) {
+        m_call->m_context.TryCancel();
+        m_closedCalls.addActiveCall(std::move(m_call));
+        m_call.reset();
+    }
+}
+
+void ProviderStreamImpl::completeInFlightRequest(
+    std::map<uint64_t, PublishRequest>::iterator iter, std::vector<Completion>& completions) {
+    completions.push_back(
+        Completion{std::move(iter->second.m_result), std::move(iter->second.m_errors), {}});
+    m_inFlightRequests.erase(iter);
+    --m_numPendingRequests;
+}
+
+void ProviderStreamImpl::failPendingRequests(const std::string&       reason,
+                                             std::vector<Completion>& completions) {
+    const auto failure = fmt::format("PublishDatapoints failed: {}", reason);
+    for (auto& [sequenceNumber, request] : m_inFlightRequests) {
+        completions.push_back(Completion{std::move(request.m_result), {}, failure});
+    }
+    for (auto& request : m_queuedRequests) {
+        completions.push_back(Completion{std::move(request.m_result), {}, failure});
+    }
+    m_numPendingRequests -= m_inFlightRequests.size() + m_queuedRequests.size();
+    m_inFlightRequests.clear();
+    m_queuedRequests.clear();
+}
+
+} // namespace velocitas::kuksa_val_v2
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_VDB_GRPC_KUKSA_VAL_V2_PROVIDERSTREAM_H
+#define VEHICLE_APP_SDK_VDB_GRPC_KUKSA_VAL_V2_PROVIDERSTREAM_H
+
+#include "sdk/AsyncResult.h"
+#include "sdk/grpc/GrpcCall.h"
+#include "sdk/vdb/IVehicleDataBrokerClient.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/Metadata.h"
+
+#include "kuksa/val/v2/val.pb.h"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace velocitas::kuksa_val_v2 {
+
+/**
+ * Configuration of the ProviderStream.
+ */
+struct ProviderStreamConfig {
+    /** Default maximum number of publish requests written but not yet acknowledged */
+    static constexpr size_t DEFAULT_MAX_IN_FLIGHT_REQUESTS = 16;
+
+    /** Default maximum number of publish requests waiting for a free in-flight slot */
+    static constexpr size_t DEFAULT_MAX_QUEUED_REQUESTS = 256;
+
+    /** Default time after writing a request without an error reported, to consider it accepted */
+    static constexpr std::chrono::milliseconds DEFAULT_ACKNOWLEDGE_DELAY{100};
+
+    /** Maximum number of publish requests written but not yet acknowledged */
+    size_t m_maxInFlightRequests{DEFAULT_MAX_IN_FLIGHT_REQUESTS};
+
+    /** Maximum number of publish requests waiting; further requests fail immediately */
+    size_t m_maxQueuedRequests{DEFAULT_MAX_QUEUED_REQUESTS};
+
+    /** Time after writing a request without an error reported, to consider it accepted */
+    std::chrono::milliseconds m_acknowledgeDelay{DEFAULT_ACKNOWLEDGE_DELAY};
+};
+
+/**
+ * Publishes values via a persistent OpenProviderStream of the KUKSA Databroker.
+ *
+ * The stream is opened by the first publish request and re-opened by the first request after
+ * it was closed. Requests are pipelined: up to m_maxInFlightRequests are written to the stream
+ * without waiting for each other, further ones are queued.
+ *
+ * The databroker only responds to a publish request if it was (partially) rejected. As it
+ * processes the requests of a stream in order, a response also acknowledges all requests written
+ * before the rejected one; requests without any response are considered accepted after the
+ * acknowledge delay.
+ */
+class ProviderStream {
+public:
+    using ProviderCall_t     = GrpcStreamingRequestCall<kuksa::val::v2::OpenProviderStreamRequest>;
+    using ResponseHandler_t  = std::function<void(kuksa::val::v2::OpenProviderStreamResponse&)>;
+    using WriteDoneHandler_t = std::function<void(bool)>;
+    using FinishHandler_t    = std::function<void(const grpc::Status&)>;
+
+    /** Function opening a new provider stream, i.e. BrokerAsyncGrpcFacade::OpenProviderStream */
+    using StreamOpener_t = std::function<std::shared_ptr<ProviderCall_t>(
+        ResponseHandler_t, WriteDoneHandler_t, FinishHandler_t)>;
+
+    static std::shared_ptr<ProviderStream> create(StreamOpener_t                 streamOpener,
+                                                  std::shared_ptr<MetadataAgent> metadataAgent,
+                                                  ProviderStreamConfig           config = {});
+
+    virtual ~ProviderStream() = default;
+
+    /**
+     * @brief Publish the current values of signals.
+     *
+     * @param values  The values to publish.
+     * @return AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t>  The result containing
+     * [path, error] entries for the signals rejected by the databroker; an error if the request
+     * could not be sent or its outcome is unknown because the stream was closed meanwhile.
+     */
+    virtual AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t>
+    publish(const std::vector<std::unique_ptr<DataPointValue>>& values) = 0;
+
+    /**
+     * @brief Get the number of publish requests queued or in flight.
+     */
+    [[nodiscard]] virtual size_t getNumPendingRequests() const = 0;
+};
+
+} // namespace velocitas::kuksa_val_v2
+
+#endif // VEHICLE_APP_SDK_VDB_GRPC_KUKSA_VAL_V2_PROVIDERSTREAM_H
@@ -0,0 +1,1136 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "SubscriptionMultiplexer.h"
+
+#include "sdk/AllocationTracker.h"
+#include "sdk/ClockOffsetEstimator.h"
+#include "sdk/DataPointSample.h"
+#include "sdk/DataPointValue.h"
+#include "sdk/Job.h"
+#include "sdk/LatencyTracer.h"
+#include "sdk/LazyDataPoint.h"
+#include "sdk/Logger.h"
+#include "sdk/Metrics.h"
+#include "sdk/SignalHistory.h"
+#include "sdk/SignalMirror.h"
+#include "sdk/SignalPathRegistry.h"
+#include "sdk/ThreadPool.h"
+#include "sdk/TraceEvents.h"
+#include "sdk/Utils.h"
+#include "sdk/grpc/GrpcCall.h"
+#include "sdk/grpc/GrpcClient.h"
+#include "sdk/vdb/SignalUpdateFilter.h"
+
+#include <fmt/core.h>
+#include <grpcpp/support/status.h>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <set>
+#include <unordered_map>
+#include <utility>
+
+namespace velocitas::kuksa_val_v2 {
+
+namespace {
+
+const unsigned int DEFAULT_SUBSCRIBE_BUFFER_SIZE = 0;
+
+const std::chrono::milliseconds RECONNECT_DELAY_INITIAL{100};
+const std::chrono::milliseconds RECONNECT_DELAY_MAX{2000};
+const unsigned int              RECONNECT_DELAY_FACTOR{2};
+
+// Half of the delay is kept, the other half is random, so clients losing the connection at the
+// same time (e.g. due to a databroker restart) spread their reconnects.
+std::chrono::milliseconds addJitter(std::chrono::milliseconds delay) {
+    thread_local std::minstd_rand generator{std::random_device{}()};
+    const auto randomPart = delay.count() / 2;
+    std::uniform_int_distribution<std::chrono::milliseconds::rep> distribution(0, randomPart);
+    return std::chrono::milliseconds{delay.count() - randomPart + distribution(generator)};
+}
+
+Counter& getResubscriptionCounter() {
+    static auto& counter = MetricsRegistry::getInstance().getCounter(
+        "sdv_vdb_resubscriptions_total",
+        "Number of subscription streams re-subscribed after an interruption or a restart");
+    return counter;
+}
+
+uint32_t determineSubscribeBufferSize() {
+    uint32_t bufferSize = DEFAULT_SUBSCRIBE_BUFFER_SIZE;
+    try {
+        auto bufferSizeStr = getEnvVar("SDV_SUBSCRIBE_BUFFER_SIZE");
+        if (!bufferSizeStr.empty()) {
+            bufferSize = std::stoi(bufferSizeStr);
+        }
+    } catch (...) {
+        logger().error("Invalid Subscribe BufferSize specified via env var! Using default ({}).",
+                       bufferSize);
+    }
+    return bufferSize;
+}
+
+uint32_t determineLatencyTracingInterval() {
+    uint32_t interval = 0;
+    try {
+        auto intervalStr = getEnvVar("SDV_LATENCY_TRACING_INTERVAL");
+        if (!intervalStr.empty()) {
+            interval = static_cast<uint32_t>(std::stoul(intervalStr));
+        }
+    } catch (...) {
+        logger().error("Invalid latency tracing interval specified via env var! Tracing disabled.");
+    }
+    return interval;
+}
+
+uint32_t getLatencyTracingInterval(const SubscriptionOptions& options) {
+    static uint32_t defaultInterval = determineLatencyTracingInterval();
+    return options.m_latencyTracingInterval > 0 ? options.m_latencyTracingInterval
+                                                : defaultInterval;
+}
+
+// The broker timestamp of the newest value is converted to the local clock via the estimator,
+// which the update is a sample of as well. Without estimate, it is compared against the system
+// clock of the app.
+LatencyTrace createTrace(const kuksa::val::v2::SubscribeByIdResponse& update,
+                         std::chrono::steady_clock::time_point        receivedAt,
+                         ClockOffsetEstimator*                        clockOffsetEstimator) {
+    const auto   now = std::chrono::system_clock::now();
+    LatencyTrace trace;
+    trace.stamp(LatencyStage::STREAM_READ, receivedAt);
+    std::optional<Timestamp> newestTimestamp;
+    for (const auto& [id, dataPoint] : update.entries()) {
+        if (!dataPoint.has_timestamp()) {
+            continue;
+        }
+        const Timestamp timestamp{dataPoint.timestamp().seconds(), dataPoint.timestamp().nanos()};
+        if (!newestTimestamp || timestamp.seconds > newestTimestamp->seconds ||
+            (timestamp.seconds == newestTimestamp->seconds &&
+             timestamp.nanos > newestTimestamp->nanos)) {
+            newestTimestamp = timestamp;
+        }
+    }
+    if (!newestTimestamp) {
+        return trace;
+    }
+    if (clockOffsetEstimator != nullptr) {
+        clockOffsetEstimator->addOneWay(*newestTimestamp, receivedAt);
+        trace.brokerLatency = clockOffsetEstimator->getLatency(*newestTimestamp, receivedAt);
+    }
+    if (!trace.brokerLatency) {
+        const std::chrono::system_clock::time_point sentAt{
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                std::chrono::seconds{newestTimestamp->seconds} +
+                std::chrono::nanoseconds{newestTimestamp->nanos})};
+        trace.brokerLatency = std::chrono::duration_cast<std::chrono::nanoseconds>(now - sentAt);
+    }
+    return trace;
+}
+
+uint32_t getSubscribeBufferSize() {
+    static uint32_t bufferSize = determineSubscribeBufferSize();
+    return bufferSize;
+}
+
+std::string getSignalPathAbstract(const SignalPathList_t& signalPaths) {
+    if (signalPaths.empty()) {
+        return {};
+    }
+    auto abstract{signalPaths.front()};
+    if (signalPaths.size() > 1) {
+        abstract.append(", etc");
+    }
+    return abstract;
+}
+
+bool isInvalidatedFailure(DataPointValue::Failure failure) {
+    switch (failure) {
+    case DataPointValue::Failure::NOT_AVAILABLE:
+    case DataPointValue::Failure::UNKNOWN_DATAPOINT:
+    case DataPointValue::Failure::ACCESS_DENIED:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * One AsyncSubscription served by the multiplexer. Updates are staged (by any stream containing
+ * one of its signals) and are then delivered as a single item.
+ */
+class Consumer {
+public:
+    Consumer(std::vector<SignalHandle_t> signals, const SubscriptionOptions& options,
+             QueryPredicate predicate)
+        : m_signals(std::move(signals))
+        , m_mode(options.m_mode)
+        , m_options(options)
+        , m_isFiltering(SignalUpdateFilter::isFiltering(options))
+        , m_predicate(std::move(predicate))
+        , m_subscription(std::make_shared<AsyncSubscription<DataPointReply>>())
+        , m_state(std::make_shared<State>()) {
+        m_subscription->setCallbackExecutor(options.m_callbackExecutor);
+        if (options.m_isCoalescingDeliveries) {
+            m_subscription->setOverflowPolicy(OverflowPolicy::CONFLATE_LATEST);
+        }
+        if (const auto interval = getLatencyTracingInterval(options); interval > 0) {
+            m_subscription->setLatencyTracer(std::make_shared<LatencyTracer>(interval));
+        }
+        m_subscription->setSharedSnapshotProvider(
+            [state = m_state]() -> std::shared_ptr<const DataPointReply> {
+                std::lock_guard<std::mutex> lock(state->m_mutex);
+                return state->m_dataPoints;
+            });
+    }
+
+    [[nodiscard]] const std::vector<SignalHandle_t>& getSignals() const { return m_signals; }
+
+    // returns false if the signal is contained already
+    bool addSignal(SignalHandle_t signal) {
+        auto iter = std::lower_bound(m_signals.begin(), m_signals.end(), signal);
+        if (iter != m_signals.end() && *iter == signal) {
+            return false;
+        }
+        m_signals.insert(iter, signal);
+        return true;
+    }
+
+    // returns false if the signal is not contained or is needed by the predicate
+    bool removeSignal(SignalHandle_t signal) {
+        auto iter = std::lower_bound(m_signals.begin(), m_signals.end(), signal);
+        if (iter == m_signals.end() || *iter != signal) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(m_state->m_mutex);
+        if (m_predicate.refersTo(signal)) {
+            return false;
+        }
+        m_signals.erase(iter);
+        m_state->getMutableDataPoints().erase(signal);
+        m_changedDataPoints.erase(signal);
+        m_filters.erase(signal);
+        return true;
+    }
+
+    [[nodiscard]] const AsyncSubscriptionPtr_t<DataPointReply>& getSubscription() const {
+        return m_subscription;
+    }
+
+    // also true once the application dropped a subscription consumed via next()
+    [[nodiscard]] bool isCancelled() const {
+        return AsyncSubscription<DataPointReply>::isAbandoned(m_subscription);
+    }
+
+    [[nodiscard]] bool isTracing() const { return m_subscription->getLatencyTracer() != nullptr; }
+
+    void stage(SignalHandle_t signal, const LazySamplePtr_t& sample) {
+        std::lock_guard<std::mutex> lock(m_state->m_mutex);
+        // the conditions see every update, also ones dropped by the filters
+        if (m_predicate.refersTo(signal)) {
+            m_predicate.update(signal, sample->get());
+        }
+        // filtering needs the value, the others decode it on first access by the application
+        if (m_isFiltering && !m_filters[signal].accept(m_options, sample->get(),
+                                                       SignalUpdateFilter::Clock_t::now())) {
+            return;
+        }
+        // each consumer gets its own value objects, as their update status is per consumer
+        auto value = makeSharedIn<AllocationDomain::REPLY_MAPS, LazyDataPointValue>(sample);
+        if (m_mode == SubscriptionMode::DELTA_ONLY) {
+            m_changedDataPoints.set(signal, value);
+        }
+        m_state->getMutableDataPoints().set(signal, std::move(value));
+        m_hasStagedUpdate = true;
+    }
+
+    /**
+     * @param streamTrace  The stages passed by the update of the stream; nullptr if the update
+     *                     was not received via a stream or is not traced.
+     */
+    void deliverUpdate(const LatencyTrace* streamTrace) {
+        // serializes deliveries from different streams, so items are delivered in order
+        std::lock_guard<std::mutex> deliveryLock(m_deliveryMutex);
+        DataPointReply              dataPoints;
+        {
+            std::lock_guard<std::mutex> lock(m_state->m_mutex);
+            if (!m_hasStagedUpdate) {
+                return;
+            }
+            m_hasStagedUpdate = false;
+            // updates not meeting the WHERE conditions never reach the callback executor
+            if (!m_predicate.isMet()) {
+                m_changedDataPoints = {};
+                return;
+            }
+            if (m_mode == SubscriptionMode::DELTA_ONLY) {
+                dataPoints = std::exchange(m_changedDataPoints, {});
+            } else {
+                dataPoints = *m_state->m_dataPoints;
+            }
+        }
+        // only the delivered values can have their update status set
+        for (const auto& entry : dataPoints) {
+            m_deliveredValues.push_back(entry.m_lazyValue);
+        }
+        const auto& tracer   = m_subscription->getLatencyTracer();
+        const bool  isTraced = streamTrace != nullptr && tracer && tracer->shallTrace();
+        if (!m_subscription->isDispatchingInline()) {
+            // the callback runs later; as dispatching keeps the order, the values are still
+            // cleared before the callback gets the next delivery
+            JobFunction onDelivered = [values = std::exchange(m_deliveredValues, {})]() {
+                clearUpdateStatus(values);
+            };
+            if (isTraced) {
+                m_subscription->insertNewItem(std::move(dataPoints), std::move(onDelivered),
+                                              *streamTrace);
+            } else {
+                m_subscription->insertNewItem(std::move(dataPoints), std::move(onDelivered));
+            }
+            return;
+        }
+        if (isTraced) {
+            m_subscription->insertNewItem(std::move(dataPoints), nullptr, *streamTrace);
+        } else {
+            m_subscription->insertNewItem(std::move(dataPoints));
+        }
+        clearUpdateStatus(m_deliveredValues);
+        m_deliveredValues.clear();
+    }
+
+private:
+    static void
+    clearUpdateStatus(const std::vector<std::shared_ptr<LazyDataPointValue>>& values) {
+        for (const auto& value : values) {
+            value->clearUpdateStatus();
+        }
+    }
+
+    // Latest values of all signals of the subscription, also used for snapshots.
+    struct State {
+        std::mutex                      m_mutex;
+        // copied on write while shared with snapshots, so taking a snapshot copies nothing
+        std::shared_ptr<DataPointReply> m_dataPoints{
+            makeSharedIn<AllocationDomain::REPLY_MAPS, DataPointReply>()};
+
+        // to be called with the mutex locked
+        DataPointReply& getMutableDataPoints() {
+            // snapshots are only taken with the mutex locked, so a count of 1 cannot grow
+            if (m_dataPoints.use_count() > 1) {
+                m_dataPoints =
+                    makeSharedIn<AllocationDomain::REPLY_MAPS, DataPointReply>(*m_dataPoints);
+            }
+            return *m_dataPoints;
+        }
+    };
+
+    // sorted, guarded by the mutex of the multiplexer
+    std::vector<SignalHandle_t>                            m_signals;
+    const SubscriptionMode                                 m_mode;
+    const SubscriptionOptions                              m_options;
+    const bool                                             m_isFiltering;
+    // guarded by the mutex of m_state
+    QueryPredicate                                         m_predicate;
+    // per signal, guarded by the mutex of m_state
+    std::unordered_map<SignalHandle_t, SignalUpdateFilter> m_filters;
+    AsyncSubscriptionPtr_t<DataPointReply>                 m_subscription;
+    std::shared_ptr<State>                                 m_state;
+    DataPointReply                                         m_changedDataPoints;
+    bool                                                   m_hasStagedUpdate{false};
+    std::mutex                                             m_deliveryMutex;
+    std::vector<std::shared_ptr<LazyDataPointValue>>       m_deliveredValues;
+};
+
+using ConsumerPtr_t  = std::shared_ptr<Consumer>;
+using ConsumerList_t = std::vector<ConsumerPtr_t>;
+
+/** One SubscribeById stream, requesting a fixed set of signals */
+struct Stream {
+    std::vector<SignalHandle_t> m_signals;
+    size_t                      m_numActiveSignals{0};
+    std::shared_ptr<GrpcCall>   m_call;
+    // incremented on each (re-)subscribe, so callbacks of superseded calls get ignored
+    uint64_t                    m_callGeneration{0};
+    bool                        m_isClosed{false};
+
+    [[nodiscard]] bool isOutdated(uint64_t callGeneration) const {
+        return m_isClosed || callGeneration != m_callGeneration;
+    }
+};
+
+using StreamPtr_t = std::shared_ptr<Stream>;
+
+/** Routing information of a signal contained in at least one subscription */
+struct Signal {
+    Stream*                                              m_stream{nullptr}; // nullptr if pending
+    LazySamplePtr_t                                      m_latestSample;
+    // set if m_latestSample was received from the databroker (and not set locally)
+    std::optional<std::chrono::steady_clock::time_point> m_receivedAt;
+    ConsumerList_t                                       m_consumers;
+};
+
+void deliverUpdates(ConsumerList_t& consumers, const LatencyTrace* streamTrace = nullptr) {
+    std::sort(consumers.begin(), consumers.end());
+    consumers.erase(std::unique(consumers.begin(), consumers.end()), consumers.end());
+    for (const auto& consumer : consumers) {
+        consumer->deliverUpdate(streamTrace);
+    }
+}
+
+ExecutorPtr_t createDefaultExecutor() {
+    return IExecutor::createThreadPool(ThreadPool::getInstance(ThreadPool::VDB_POOL));
+}
+
+} // namespace
+
+class SubscriptionMultiplexerImpl
+    : public SubscriptionMultiplexer,
+      public std::enable_shared_from_this<SubscriptionMultiplexerImpl> {
+public:
+    SubscriptionMultiplexerImpl(StreamOpener_t streamOpener,
+                                std::shared_ptr<MetadataAgent> metadataAgent,
+                                std::chrono::milliseconds      coalescingDelay,
+                                ConnectionWaiter_t             connectionWaiter,
+                                ClockOffsetEstimatorPtr_t      clockOffsetEstimator)
+        : m_streamOpener(std::move(streamOpener))
+        , m_metadataAgent(std::move(metadataAgent))
+        , m_coalescingDelay(coalescingDelay)
+        , m_connectionWaiter(std::move(connectionWaiter))
+        , m_clockOffsetEstimator(std::move(clockOffsetEstimator)) {}
+
+    ~SubscriptionMultiplexerImpl() override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        while (!m_streams.empty()) {
+            closeStream(*m_streams.begin());
+        }
+    }
+
+    SubscriptionMultiplexerImpl(const SubscriptionMultiplexerImpl&)            = delete;
+    SubscriptionMultiplexerImpl(SubscriptionMultiplexerImpl&&)                 = delete;
+    SubscriptionMultiplexerImpl& operator=(const SubscriptionMultiplexerImpl&) = delete;
+    SubscriptionMultiplexerImpl& operator=(SubscriptionMultiplexerImpl&&)      = delete;
+
+    using SubscriptionMultiplexer::subscribe;
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(std::vector<SignalHandle_t> signals,
+                                                     const SubscriptionOptions&  options,
+                                                     QueryPredicate predicate) override;
+
+    bool updateSignals(const AsyncSubscriptionPtr_t<DataPointReply>& subscription,
+                       const std::vector<SignalHandle_t>&            addedSignals,
+                       const std::vector<SignalHandle_t>&            removedSignals) override;
+
+    void restart() override;
+
+    [[nodiscard]] std::optional<DataPointSample>
+    getLatestSample(SignalHandle_t signal, std::chrono::milliseconds maxAge) const override;
+
+    [[nodiscard]] size_t getNumStreams() const override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_streams.size();
+    }
+
+    void setExecutor(ExecutorPtr_t executor) override {
+        std::atomic_store(&m_executor, executor ? std::move(executor) : createDefaultExecutor());
+    }
+
+private:
+    [[nodiscard]] ExecutorPtr_t getExecutor() const { return std::atomic_load(&m_executor); }
+
+    void flushPendingSignals();
+    void subscribeStream(const StreamPtr_t& stream);
+    void onMetadataPresent(const StreamPtr_t& stream, uint64_t callGeneration,
+                           const MetadataList_t& metadataList);
+    void onUpdate(const StreamPtr_t& stream, uint64_t callGeneration,
+                  kuksa::val::v2::SubscribeByIdResponse& update);
+    void onError(const StreamPtr_t& stream, uint64_t callGeneration, const grpc::Status& status);
+    void scheduleReconnect();
+    void awaitConnection();
+    void onReconnectDue(bool isConnected);
+    // returns false, ending the reconnect, if all interrupted streams got closed meanwhile
+    bool hasInterruptedStreams();
+    void reconnect();
+    void onReconnectMetadataPresent(const std::vector<StreamPtr_t>& streams,
+                                    const std::vector<uint64_t>&    callGenerations,
+                                    const MetadataList_t&           metadataList);
+
+    // all functions below need to be called with m_mutex being locked
+    bool    beginNextCall(Stream& stream, uint64_t& callGeneration, SignalPathList_t& signalPaths);
+    Signal* findSignal(SignalHandle_t handle, const Stream& stream);
+    void    updateSignal(SignalHandle_t handle, Signal& signal, LazySamplePtr_t sample,
+                         ConsumerList_t& affectedConsumers);
+    void    updateSignal(SignalHandle_t handle, Signal& signal, DataPointSample sample,
+                         ConsumerList_t& affectedConsumers) {
+        updateSignal(handle, signal, std::make_shared<const LazySample>(std::move(sample)),
+                     affectedConsumers);
+    }
+    void    removeCancelledConsumers(ConsumerList_t& consumers);
+    void    removeCancelledConsumers();
+    void    removeConsumer(const ConsumerPtr_t& consumer);
+    // returns true if the current value of the signal got staged for the consumer
+    bool    addConsumerSignal(SignalHandle_t handle, const ConsumerPtr_t& consumer);
+    void    removeConsumerSignal(SignalHandle_t handle, const ConsumerPtr_t& consumer);
+    void    scheduleFlush();
+    void    onConsumerCancelled();
+    void    closeStream(StreamPtr_t stream);
+
+    StreamOpener_t                 m_streamOpener;
+    std::shared_ptr<MetadataAgent> m_metadataAgent;
+    std::chrono::milliseconds      m_coalescingDelay;
+    ConnectionWaiter_t             m_connectionWaiter;
+    ClockOffsetEstimatorPtr_t      m_clockOffsetEstimator;
+    ExecutorPtr_t                  m_executor{createDefaultExecutor()};
+
+    mutable std::mutex                         m_mutex;
+    std::unordered_map<SignalHandle_t, Signal> m_signals;
+    std::vector<SignalHandle_t>                m_pendingSignals;
+    bool                                       m_isFlushScheduled{false};
+    std::set<StreamPtr_t>                      m_streams;
+    ConsumerList_t                             m_consumers;
+    // streams interrupted by a connection loss, restored together by the next reconnect
+    std::vector<StreamPtr_t>                   m_interruptedStreams;
+    bool                                       m_isConnectionLost{false};
+    bool                                       m_isReconnectScheduled{false};
+    std::chrono::milliseconds                  m_reconnectDelay{RECONNECT_DELAY_INITIAL};
+    // calls of closed streams are kept until gRPC is done with them
+    GrpcClient m_closedCalls;
+};
+
+std::shared_ptr<SubscriptionMultiplexer>
+SubscriptionMultiplexer::create(StreamOpener_t streamOpener,
+                                std::shared_ptr<MetadataAgent> metadataAgent,
+                                std::chrono::milliseconds      coalescingDelay,
+                                ConnectionWaiter_t             connectionWaiter,
+                                ClockOffsetEstimatorPtr_t      clockOffsetEstimator) {
+    return std::make_shared<SubscriptionMultiplexerImpl>(
+        std::move(streamOpener), std::move(metadataAgent), coalescingDelay,
+        std::move(connectionWaiter), std::move(clockOffsetEstimator));
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+SubscriptionMultiplexer::subscribe(const SignalPathList_t&    signalPaths,
+                                   const SubscriptionOptions& options) {
+    std::vector<SignalHandle_t> signals;
+    signals.reserve(signalPaths.size());
+    auto& registry = SignalPathRegistry::getInstance();
+    for (const auto& path : signalPaths) {
+        signals.push_back(registry.intern(path));
+    }
+    return subscribe(std::move(signals), options);
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+SubscriptionMultiplexerImpl::subscribe(std::vector<SignalHandle_t> signals,
+                                       const SubscriptionOptions&  options,
+                                       QueryPredicate              predicate) {
+    signals.insert(signals.end(), predicate.getSignals().cbegin(), predicate.getSignals().cend());
+    std::sort(signals.begin(), signals.end());
+    signals.erase(std::unique(signals.begin(), signals.end()), signals.end());
+
+    auto consumer = std::make_shared<Consumer>(std::move(signals), options, std::move(predicate));
+    // held until returned, so the consumer is not taken as abandoned before the caller has it
+    auto subscription = consumer->getSubscription();
+    // stops the streams no longer needed right away instead of with their next update
+    subscription->setCancellationHandler([weakThis = weak_from_this()]() {
+        auto multiplexer = weakThis.lock();
+        if (!multiplexer) {
+            return;
+        }
+        multiplexer->getExecutor()->post([weakThis]() {
+            if (auto thisPtr = weakThis.lock()) {
+                thisPtr->onConsumerCancelled();
+            }
+        });
+    });
+    bool isSeeded = true;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        removeCancelledConsumers();
+        m_consumers.push_back(consumer);
+        for (const auto handle : consumer->getSignals()) {
+            if (!addConsumerSignal(handle, consumer)) {
+                isSeeded = false;
+            }
+        }
+        scheduleFlush();
+    }
+    // all signals are served by running streams already -> deliver their current values
+    if (isSeeded) {
+        consumer->deliverUpdate(nullptr);
+    }
+    return subscription;
+}
+
+bool SubscriptionMultiplexerImpl::updateSignals(
+    const AsyncSubscriptionPtr_t<DataPointReply>& subscription,
+    const std::vector<SignalHandle_t>&            addedSignals,
+    const std::vector<SignalHandle_t>&            removedSignals) {
+    ConsumerPtr_t consumer;
+    bool          hasStagedSignal = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto iter = std::find_if(m_consumers.cbegin(), m_consumers.cend(),
+                                 [&subscription](const auto& candidate) {
+                                     return candidate->getSubscription() == subscription;
+                                 });
+        if (iter == m_consumers.cend() || (*iter)->isCancelled()) {
+            return false;
+        }
+        consumer = *iter;
+        // the other signals stay with their streams, so their delivery is not interrupted
+        for (const auto handle : addedSignals) {
+            if (consumer->addSignal(handle) && addConsumerSignal(handle, consumer)) {
+                hasStagedSignal = true;
+            }
+        }
+        for (const auto handle : removedSignals) {
+            if (consumer->removeSignal(handle)) {
+                removeConsumerSignal(handle, consumer);
+            }
+        }
+        scheduleFlush();
+    }
+    // added signals served by running streams already -> deliver their current values
+    if (hasStagedSignal) {
+        consumer->deliverUpdate(nullptr);
+    }
+    return true;
+}
+
+void SubscriptionMultiplexerImpl::flushPendingSignals() {
+    auto stream = std::make_shared<Stream>();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isFlushScheduled = false;
+        if (m_pendingSignals.empty()) {
+            return;
+        }
+        stream->m_signals.swap(m_pendingSignals);
+        stream->m_numActiveSignals = stream->m_signals.size();
+        for (const auto handle : stream->m_signals) {
+            m_signals[handle].m_stream = stream.get();
+        }
+        m_streams.insert(stream);
+    }
+    logger().debug("Opening subscription stream for {} signal(s)", stream->m_signals.size());
+    subscribeStream(stream);
+}
+
+void SubscriptionMultiplexerImpl::restart() {
+    std::vector<StreamPtr_t> streams;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        streams.assign(m_streams.cbegin(), m_streams.cend());
+    }
+    logger().info("Re-subscribing {} subscription stream(s)", streams.size());
+    getResubscriptionCounter().increment(streams.size());
+    for (const auto& stream : streams) {
+        subscribeStream(stream);
+    }
+}
+
+std::optional<DataPointSample>
+SubscriptionMultiplexerImpl::getLatestSample(SignalHandle_t            signal,
+                                             std::chrono::milliseconds maxAge) const {
+    const auto                  now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto                        iter = m_signals.find(signal);
+    if (iter == m_signals.end() || !iter->second.m_receivedAt ||
+        (now - *iter->second.m_receivedAt) > maxAge) {
+        return std::nullopt;
+    }
+    return iter->second.m_latestSample->get();
+}
+
+void SubscriptionMultiplexerImpl::subscribeStream(const StreamPtr_t& stream) {
+    SignalPathList_t signalPaths;
+    uint64_t         callGeneration{0};
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!beginNextCall(*stream, callGeneration, signalPaths)) {
+            return;
+        }
+    }
+
+    // the metadata agent may call back immediately, so it must not be called with m_mutex locked
+    m_metadataAgent->query(
+        signalPaths,
+        [weakThis = weak_from_this(), stream, callGeneration](MetadataList_t&& metadataList) {
+            if (auto thisPtr = weakThis.lock()) {
+                thisPtr->onMetadataPresent(stream, callGeneration, metadataList);
+            }
+        },
+        [weakThis = weak_from_this(), stream, callGeneration](const grpc::Status& status) {
+            if (auto thisPtr = weakThis.lock()) {
+                thisPtr->onError(stream, callGeneration, status);
+            }
+        });
+}
+
+void SubscriptionMultiplexerImpl::onMetadataPresent(const StreamPtr_t&    stream,
+                                                    uint64_t              callGeneration,
+                                                    const MetadataList_t& metadataList) {
+    ConsumerList_t affectedConsumers;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (stream->isOutdated(callGeneration)) {
+            return;
+        }
+        kuksa::val::v2::SubscribeByIdRequest request;
+        if (getSubscribeBufferSize() != DEFAULT_SUBSCRIBE_BUFFER_SIZE) {
+            request.set_buffer_size(getSubscribeBufferSize());
+        }
+        for (const auto& metadata : metadataList) {
+            auto* signal = findSignal(metadata->m_signalHandle, *stream);
+            if (signal == nullptr) {
+                continue;
+            }
+            if (metadata->m_isKnown) {
+                request.add_signal_ids(metadata->m_id);
+            } else {
+                updateSignal(metadata->m_signalHandle, *signal,
+                             DataPointSample(DataPointValue::Type::INVALID,
+                                             DataPointValue::Failure::UNKNOWN_DATAPOINT),
+                             affectedConsumers);
+            }
+        }
+
+        if (request.signal_ids_size() > 0) {
+            // the unknown signals are delivered together with the first update of the stream
+            affectedConsumers.clear();
+            stream->m_call = m_streamOpener(
+                std::move(request),
+                [weakThis = weak_from_this(), stream, callGeneration](auto& update) {
+                    if (auto thisPtr = weakThis.lock()) {
+                        thisPtr->onUpdate(stream, callGeneration, update);
+                    }
+                },
+                [weakThis = weak_from_this(), stream, callGeneration](const auto& status) {
+                    if (auto thisPtr = weakThis.lock()) {
+                        thisPtr->onError(stream, callGeneration, status);
+                    }
+                });
+        }
+        removeCancelledConsumers(affectedConsumers);
+    }
+    deliverUpdates(affectedConsumers);
+}
+
+void SubscriptionMultiplexerImpl::onUpdate(const StreamPtr_t& stream, uint64_t callGeneration,
+                                           kuksa::val::v2::SubscribeByIdResponse& update) {
+    VELOCITAS_TRACE_SPAN("vdb", "SubscriptionMultiplexer::onUpdate");
+    ConsumerList_t              affectedConsumers;
+    std::optional<LatencyTrace> trace;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (stream->isOutdated(callGeneration)) {
+            return;
+        }
+        m_isConnectionLost    = false;
+        m_reconnectDelay      = RECONNECT_DELAY_INITIAL;
+        const auto receivedAt = std::chrono::steady_clock::now();
+        // the entries are decoded on first access only, so they keep the message alive
+        auto message = std::make_shared<kuksa::val::v2::SubscribeByIdResponse>();
+        message->Swap(&update);
+        for (const auto& [id, dataPoint] : message->entries()) {
+            auto metadata = m_metadataAgent->getByNumericId(id);
+            if (!metadata) {
+                logger().error("onSubscriptionUpdate: Unexpected signal id={} received.", id);
+                continue;
+            }
+            // signals not contained in any subscription anymore are just skipped
+            if (auto* signal = findSignal(metadata->m_signalHandle, *stream)) {
+                updateSignal(metadata->m_signalHandle, *signal,
+                             std::make_shared<const LazySample>(
+                                 std::shared_ptr<const void>(message, &dataPoint),
+                                 metadata->m_decoder),
+                             affectedConsumers);
+                signal->m_receivedAt = receivedAt;
+            }
+        }
+        removeCancelledConsumers(affectedConsumers);
+        if (std::any_of(affectedConsumers.cbegin(), affectedConsumers.cend(),
+                        [](const auto& consumer) { return consumer->isTracing(); })) {
+            trace = createTrace(*message, receivedAt, m_clockOffsetEstimator.get());
+        }
+    }
+    if (trace) {
+        trace->stamp(LatencyStage::DECODED);
+    }
+    deliverUpdates(affectedConsumers, trace ? &*trace : nullptr);
+}
+
+void SubscriptionMultiplexerImpl::onError(const StreamPtr_t& stream, uint64_t callGeneration,
+                                          const grpc::Status& status) {
+    switch (status.error_code()) {
+    case grpc::StatusCode::OK:
+    case grpc::StatusCode::UNAVAILABLE: {
+        bool isConnectionLost = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (stream->isOutdated(callGeneration)) {
+                return;
+            }
+            isConnectionLost   = !m_isConnectionLost;
+            m_isConnectionLost = true;
+        }
+        // The databroker ended the connection or became unavailable. This is most
+        // probably a temporary error, so we try to subscribe again. The metadata is
+        // re-resolved once per connection loss, not once per interrupted stream.
+        if (isConnectionLost) {
+            logger().warn("Connection to databroker lost or failed");
+            m_metadataAgent->invalidate();
+        }
+
+        ConsumerList_t affectedConsumers;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (stream->isOutdated(callGeneration)) {
+                return;
+            }
+            for (const auto handle : stream->m_signals) {
+                auto* signal = findSignal(handle, *stream);
+                if (signal == nullptr) {
+                    continue;
+                }
+                if (!signal->m_latestSample) {
+                    updateSignal(handle, *signal,
+                                 DataPointSample(DataPointValue::Type::INVALID,
+                                                 DataPointValue::Failure::NOT_AVAILABLE),
+                                 affectedConsumers);
+                } else if (!isInvalidatedFailure(signal->m_latestSample->get().getFailure())) {
+                    updateSignal(handle, *signal,
+                                 DataPointSample(signal->m_latestSample->get().getType(),
+                                                 DataPointValue::Failure::NOT_AVAILABLE),
+                                 affectedConsumers);
+                }
+            }
+            if (std::find(m_interruptedStreams.cbegin(), m_interruptedStreams.cend(), stream) ==
+                m_interruptedStreams.cend()) {
+                m_interruptedStreams.push_back(stream);
+            }
+            removeCancelledConsumers(affectedConsumers);
+        }
+        deliverUpdates(affectedConsumers);
+        scheduleReconnect();
+        break;
+    }
+    default: {
+        // all other errors are rated unrecoverable, therefore retry does not make sense
+        ConsumerList_t failedConsumers;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (stream->isOutdated(callGeneration)) {
+                return;
+            }
+            for (const auto handle : stream->m_signals) {
+                if (auto* signal = findSignal(handle, *stream)) {
+                    failedConsumers.insert(failedConsumers.end(), signal->m_consumers.cbegin(),
+                                           signal->m_consumers.cend());
+                }
+            }
+            std::sort(failedConsumers.begin(), failedConsumers.end());
+            failedConsumers.erase(std::unique(failedConsumers.begin(), failedConsumers.end()),
+                                  failedConsumers.end());
+            for (const auto& consumer : failedConsumers) {
+                removeConsumer(consumer);
+            }
+            closeStream(stream);
+        }
+        for (const auto& consumer : failedConsumers) {
+            consumer->getSubscription()->insertError(Status(fmt::format(
+                "Subscribe failed: code={}, {}", static_cast<unsigned int>(status.error_code()),
+                status.error_message())));
+        }
+        break;
+    }
+    }
+}
+
+void SubscriptionMultiplexerImpl::scheduleReconnect() {
+    std::chrono::milliseconds delay;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_isReconnectScheduled) {
+            return;
+        }
+        m_isReconnectScheduled = true;
+        delay                  = addJitter(m_reconnectDelay);
+        m_reconnectDelay = std::min(m_reconnectDelay * RECONNECT_DELAY_FACTOR, RECONNECT_DELAY_MAX);
+    }
+    // the backoff also applies if the channel stays connected but the databroker keeps ending
+    // the streams; afterwards the channel state is watched instead of issuing doomed calls
+    getExecutor()->scheduleAfter(delay, [weakThis = weak_from_this()]() {
+        if (auto thisPtr = weakThis.lock()) {
+            thisPtr->awaitConnection();
+        }
+    });
+}
+
+void SubscriptionMultiplexerImpl::awaitConnection() {
+    if (!hasInterruptedStreams()) {
+        return;
+    }
+    if (!m_connectionWaiter) {
+        onReconnectDue(true);
+        return;
+    }
+    // the waiter might call back right away or from a gRPC thread, so hop onto the executor
+    m_connectionWaiter(RECONNECT_DELAY_MAX, [weakThis = weak_from_this(),
+                                             executor = getExecutor()](bool isConnected) {
+        executor->post([weakThis, isConnected]() {
+            if (auto thisPtr = weakThis.lock()) {
+                thisPtr->onReconnectDue(isConnected);
+            }
+        });
+    });
+}
+
+void SubscriptionMultiplexerImpl::onReconnectDue(bool isConnected) {
+    if (!isConnected) {
+        if (!hasInterruptedStreams()) {
+            return;
+        }
+        // keep watching the connection instead of issuing calls bound to fail
+        logger().debug("Databroker still not reachable, waiting for the connection");
+        awaitConnection();
+        return;
+    }
+    reconnect();
+}
+
+bool SubscriptionMultiplexerImpl::hasInterruptedStreams() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto&                       streams = m_interruptedStreams;
+    streams.erase(std::remove_if(streams.begin(), streams.end(),
+                                 [](const auto& stream) { return stream->m_isClosed; }),
+                  streams.end());
+    if (streams.empty()) {
+        m_isReconnectScheduled = false;
+        return false;
+    }
+    return true;
+}
+
+void SubscriptionMultiplexerImpl::reconnect() {
+    std::vector<StreamPtr_t> streams;
+    std::vector<uint64_t>    callGenerations;
+    SignalPathList_t         signalPaths;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isReconnectScheduled = false;
+        for (auto& stream : std::exchange(m_interruptedStreams, {})) {
+            uint64_t callGeneration{0};
+            if (beginNextCall(*stream, callGeneration, signalPaths)) {
+                streams.push_back(std::move(stream));
+                callGenerations.push_back(callGeneration);
+            }
+        }
+    }
+    if (streams.empty()) {
+        return;
+    }
+    logger().info("Re-subscribing {} interrupted subscription stream(s)", streams.size());
+    getResubscriptionCounter().increment(streams.size());
+
+    // one metadata query for all streams; it may call back immediately, so m_mutex is not locked
+    m_metadataAgent->query(
+        signalPaths,
+        [weakThis = weak_from_this(), streams, callGenerations](MetadataList_t&& metadataList) {
+            if (auto thisPtr = weakThis.lock()) {
+                thisPtr->onReconnectMetadataPresent(streams, callGenerations, metadataList);
+            }
+        },
+        [weakThis = weak_from_this(), streams, callGenerations](const grpc::Status& status) {
+            if (auto thisPtr = weakThis.lock()) {
+                for (size_t i = 0; i < streams.size(); ++i) {
+                    thisPtr->onError(streams[i], callGenerations[i], status);
+                }
+            }
+        });
+}
+
+void SubscriptionMultiplexerImpl::onReconnectMetadataPresent(
+    const std::vector<StreamPtr_t>& streams, const std::vector<uint64_t>& callGenerations,
+    const MetadataList_t& metadataList) {
+    std::unordered_map<const Stream*, MetadataList_t> metadataByStream;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& metadata : metadataList) {
+            auto iter = m_signals.find(metadata->m_signalHandle);
+            if (iter != m_signals.end() && iter->second.m_stream != nullptr) {
+                metadataByStream[iter->second.m_stream].push_back(metadata);
+            }
+        }
+    }
+    for (size_t i = 0; i < streams.size(); ++i) {
+        onMetadataPresent(streams[i], callGenerations[i], metadataByStream[streams[i].get()]);
+    }
+}
+
+bool SubscriptionMultiplexerImpl::beginNextCall(Stream& stream, uint64_t& callGeneration,
+                                                SignalPathList_t& signalPaths) {
+    if (stream.m_isClosed) {
+        return false;
+    }
+    callGeneration = ++stream.m_callGeneration;
+    if (stream.m_call) {
+        // superseded by the new call
+        stream.m_call->m_context.TryCancel();
+        m_closedCalls.addActiveCall(std::move(stream.m_call));
+    }
+    // drop the signals which were removed since the stream was opened
+    auto& signals = stream.m_signals;
+    signals.erase(std::remove_if(signals.begin(), signals.end(),
+                                 [this, &stream](auto handle) {
+                                     return findSignal(handle, stream) == nullptr;
+                                 }),
+                  signals.end());
+    auto& registry = SignalPathRegistry::getInstance();
+    signalPaths.reserve(signalPaths.size() + signals.size());
+    for (const auto handle : signals) {
+        signalPaths.push_back(registry.getPath(handle));
+    }
+    return true;
+}
+
+Signal* SubscriptionMultiplexerImpl::findSignal(SignalHandle_t handle, const Stream& stream) {
+    auto iter = m_signals.find(handle);
+    if (iter == m_signals.end() || iter->second.m_stream != &stream) {
+        return nullptr;
+    }
+    return &iter->second;
+}
+
+void SubscriptionMultiplexerImpl::updateSignal(SignalHandle_t handle, Signal& signal,
+                                               LazySamplePtr_t sample,
+                                               ConsumerList_t& affectedConsumers) {
+    // recorded once per received value, independent of the consumers' filters
+    if (auto& historyStore = SignalHistoryStore::getInstance(); historyStore.isRecording(handle)) {
+        historyStore.record(handle, sample->get());
+    }
+    if (auto& mirror = SignalMirror::getInstance(); mirror.isMirroring(handle)) {
+        mirror.record(handle, sample->get());
+    }
+    for (const auto& consumer : signal.m_consumers) {
+        consumer->stage(handle, sample);
+        affectedConsumers.push_back(consumer);
+    }
+    signal.m_latestSample = std::move(sample);
+    signal.m_receivedAt.reset();
+}
+
+void SubscriptionMultiplexerImpl::removeCancelledConsumers(ConsumerList_t& consumers) {
+    ConsumerList_t cancelledConsumers;
+    auto           cancelledBegin = std::stable_partition(
+        consumers.begin(), consumers.end(), [](const auto& consumer) {
+            return !consumer->isCancelled();
+        });
+    cancelledConsumers.assign(cancelledBegin, consumers.end());
+    consumers.erase(cancelledBegin, consumers.end());
+    for (const auto& consumer : cancelledConsumers) {
+        removeConsumer(consumer);
+    }
+}
+
+void SubscriptionMultiplexerImpl::removeCancelledConsumers() {
+    // on a copy, as removeConsumer() looks the consumers up in m_consumers
+    auto consumers = m_consumers;
+    removeCancelledConsumers(consumers);
+}
+
+void SubscriptionMultiplexerImpl::removeConsumer(const ConsumerPtr_t& consumer) {
+    auto consumerIter = std::find(m_consumers.begin(), m_consumers.end(), consumer);
+    if (consumerIter == m_consumers.end()) {
+        return; // removed already
+    }
+    m_consumers.erase(consumerIter);
+
+    for (const auto handle : consumer->getSignals()) {
+        removeConsumerSignal(handle, consumer);
+    }
+}
+
+bool SubscriptionMultiplexerImpl::addConsumerSignal(SignalHandle_t       handle,
+                                                    const ConsumerPtr_t& consumer) {
+    auto [iter, isNew] = m_signals.try_emplace(handle);
+    auto& signal       = iter->second;
+    signal.m_consumers.push_back(consumer);
+    if (isNew) {
+        m_pendingSignals.push_back(handle);
+    }
+    if (!signal.m_latestSample) {
+        return false;
+    }
+    consumer->stage(handle, signal.m_latestSample);
+    return true;
+}
+
+void SubscriptionMultiplexerImpl::removeConsumerSignal(SignalHandle_t       handle,
+                                                       const ConsumerPtr_t& consumer) {
+    auto signalIter = m_signals.find(handle);
+    if (signalIter == m_signals.end()) {
+        return;
+    }
+    auto& consumers = signalIter->second.m_consumers;
+    consumers.erase(std::remove(consumers.begin(), consumers.end(), consumer), consumers.end());
+    if (!consumers.empty()) {
+        return;
+    }
+
+    auto* stream = signalIter->second.m_stream;
+    m_signals.erase(signalIter);
+    if (stream == nullptr) {
+        m_pendingSignals.erase(
+            std::remove(m_pendingSignals.begin(), m_pendingSignals.end(), handle),
+            m_pendingSignals.end());
+    } else if (--stream->m_numActiveSignals == 0) {
+        auto streamIter = std::find_if(m_streams.begin(), m_streams.end(),
+                                       [stream](const auto& ptr) { return ptr.get() == stream; });
+        if (streamIter != m_streams.end()) {
+            closeStream(*streamIter);
+        }
+    }
+}
+
+void SubscriptionMultiplexerImpl::scheduleFlush() {
+    if (m_pendingSignals.empty() || m_isFlushScheduled) {
+        return;
+    }
+    m_isFlushScheduled = true;
+    getExecutor()->scheduleAfter(m_coalescingDelay, [weakThis = weak_from_this()]() {
+        if (auto thisPtr = weakThis.lock()) {
+            thisPtr->flushPendingSignals();
+        }
+    });
+}
+
+void SubscriptionMultiplexerImpl::onConsumerCancelled() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    removeCancelledConsumers();
+}
+
+void SubscriptionMultiplexerImpl::closeStream(StreamPtr_t stream) {
+    stream->m_isClosed = true;
+    m_streams.erase(stream);
+    if (stream->m_call) {
+        stream->m_call->m_context.TryCancel();
+        m_closedCalls.addActiveCall(std::move(stream->m_call));
+    }
+}
+
+} // namespace velocitas::kuksa_val_v2
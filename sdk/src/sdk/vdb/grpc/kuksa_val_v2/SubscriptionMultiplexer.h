@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef VEHICLE_APP_SDK_VDB_GRPC_KUKSA_VAL_V2_SUBSCRIPTIONMULTIPLEXER_H
+#define VEHICLE_APP_SDK_VDB_GRPC_KUKSA_VAL_V2_SUBSCRIPTIONMULTIPLEXER_H
+
+#include "sdk/AsyncResult.h"
+#include "sdk/ClockOffsetEstimator.h"
+#include "sdk/DataPointReply.h"
+#include "sdk/Executor.h"
+#include "sdk/vdb/IVehicleDataBrokerClient.h"
+#include "sdk/vdb/QueryPredicate.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/Metadata.h"
+
+#include "kuksa/val/v2/val.pb.h"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace velocitas {
+
+class GrpcCall;
+
+namespace kuksa_val_v2 {
+
+/**
+ * Shares SubscribeById streams of the KUKSA Databroker among all subscriptions of a client.
+ *
+ * Each signal is requested by exactly one stream, no matter how many subscriptions contain it.
+ * Signals which are not part of any stream yet are collected for a short coalescing delay and
+ * are then requested together via one new stream. Updates received from a stream are fanned out
+ * to all subscriptions containing the updated signals.
+ *
+ * Cancelling an AsyncSubscription removes it from the multiplexer. A stream is closed once none
+ * of its signals is contained in any subscription anymore (also after removing signals via
+ * updateSignals), other streams are not affected.
+ *
+ * Reconnecting is coordinated for all streams: the first stream losing the connection
+ * invalidates the metadata cache, all interrupted streams then wait together for a jittered
+ * exponential backoff and for the connection to be ready again and are restored at once, using
+ * a single metadata query for all of their signals.
+ */
+class SubscriptionMultiplexer {
+public:
+    /** Handler of stream updates; it takes over the payloads of the passed update */
+    using UpdateHandler_t = std::function<void(kuksa::val::v2::SubscribeByIdResponse&)>;
+    using FinishHandler_t = std::function<void(const grpc::Status&)>;
+
+    /** Function opening a new SubscribeById stream, i.e. BrokerAsyncGrpcFacade::SubscribeById */
+    using StreamOpener_t = std::function<std::shared_ptr<GrpcCall>(
+        kuksa::val::v2::SubscribeByIdRequest, UpdateHandler_t, FinishHandler_t)>;
+
+    /**
+     * Function calling the passed handler once the databroker is connected or the timeout
+     * expired, i.e. BrokerAsyncGrpcFacade::waitUntilConnected
+     */
+    using ConnectionWaiter_t = std::function<void(std::chrono::milliseconds timeout,
+                                                  std::function<void(bool isConnected)>)>;
+
+    /** Default time to collect new signals before requesting them via a new stream */
+    static constexpr std::chrono::milliseconds DEFAULT_COALESCING_DELAY{10};
+
+    /**
+     * @brief Create a new multiplexer.
+     *
+     * @param streamOpener          Function opening the SubscribeById streams.
+     * @param metadataAgent         Agent resolving the ids of the signals.
+     * @param coalescingDelay       Time to collect new signals before opening a stream for them.
+     * @param connectionWaiter      Function waiting for the connection before interrupted
+     *                              streams are restored. If nullptr, they are restored after
+     *                              the backoff.
+     * @param clockOffsetEstimator  Estimator fed by the traced updates, converting their broker
+     *                              timestamps to the local clock. If nullptr, the broker
+     *                              latency is measured against the system clock.
+     */
+    static std::shared_ptr<SubscriptionMultiplexer>
+    create(StreamOpener_t streamOpener, std::shared_ptr<MetadataAgent> metadataAgent,
+           std::chrono::milliseconds coalescingDelay      = DEFAULT_COALESCING_DELAY,
+           ConnectionWaiter_t        connectionWaiter     = nullptr,
+           ClockOffsetEstimatorPtr_t clockOffsetEstimator = nullptr);
+
+    virtual ~SubscriptionMultiplexer() = default;
+
+    /**
+     * @brief Subscribe to the passed signals, delivering updates only while the predicate is met.
+     *
+     * @param signals    Interned handles of the signals to subscribe to. The signals the
+     *                   predicate refers to are subscribed as well.
+     * @param options    Whether items contain all signals or the changed ones only, and the
+     *                   limits of the updates to deliver per signal.
+     * @param predicate  The compiled WHERE conditions of the query, evaluated before an update is
+     *                   delivered; updates not meeting it are dropped.
+     * @return AsyncSubscriptionPtr_t<DataPointReply>  The subscription providing the updates.
+     */
+    virtual AsyncSubscriptionPtr_t<DataPointReply>
+    subscribe(std::vector<SignalHandle_t> signals, const SubscriptionOptions& options,
+              QueryPredicate predicate) = 0;
+
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(std::vector<SignalHandle_t> signals,
+                                                     const SubscriptionOptions&  options) {
+        return subscribe(std::move(signals), options, QueryPredicate{});
+    }
+
+    /**
+     * @brief Subscribe to the passed signals.
+     *
+     * @param signalPaths  Paths of the signals to subscribe to.
+     * @param options      Whether items contain all signals or the changed ones only, and the
+     *                     limits of the updates to deliver per signal.
+     * @return AsyncSubscriptionPtr_t<DataPointReply>  The subscription providing the updates.
+     */
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const SignalPathList_t&    signalPaths,
+                                                     const SubscriptionOptions& options);
+
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const SignalPathList_t& signalPaths,
+                                                     SubscriptionMode        mode) {
+        return subscribe(signalPaths, SubscriptionOptions{mode});
+    }
+
+    /**
+     * @brief Add signals to and remove signals from a subscription of this multiplexer. The
+     * streams of the other signals are not interrupted: added signals served by a running stream
+     * are delivered right away, the others are requested via a new stream after the coalescing
+     * delay. Signals the predicate of the subscription refers to are not removed.
+     *
+     * @param subscription    The subscription to update.
+     * @param addedSignals    Interned handles of the signals to add.
+     * @param removedSignals  Interned handles of the signals to remove.
+     * @return false if the subscription is not served by this multiplexer or is cancelled.
+     */
+    virtual bool updateSignals(const AsyncSubscriptionPtr_t<DataPointReply>& subscription,
+                               const std::vector<SignalHandle_t>&            addedSignals,
+                               const std::vector<SignalHandle_t>&            removedSignals) = 0;
+
+    /**
+     * @brief Re-subscribe all streams, e.g. because the signal metadata changed. Updates of the
+     * superseded calls are ignored.
+     */
+    virtual void restart() = 0;
+
+    /**
+     * @brief Get the latest value of a signal as received by a running stream.
+     *
+     * @param signal  Handle of the signal.
+     * @param maxAge  Maximum time since the value was received.
+     * @return std::optional<DataPointSample>  The value, std::nullopt if the signal is not part of
+     * any subscription, no value was received yet, the stream was interrupted since or the value
+     * is older than maxAge.
+     */
+    [[nodiscard]] virtual std::optional<DataPointSample>
+    getLatestSample(SignalHandle_t signal, std::chrono::milliseconds maxAge) const = 0;
+
+    /**
+     * @brief Get the number of currently open (or opening) SubscribeById streams.
+     */
+    [[nodiscard]] virtual size_t getNumStreams() const = 0;
+
+    /**
+     * @brief Set the executor restoring interrupted streams, opening streams for new signals
+     * and closing the ones no longer needed.
+     *
+     * @param executor  The executor to use; nullptr for the VDB thread pool.
+     */
+    virtual void setExecutor(ExecutorPtr_t executor) = 0;
+};
+
+} // namespace kuksa_val_v2
+} // namespace velocitas
+
+#endif // VEHICLE_APP_SDK_VDB_GRPC_KUKSA_VAL_V2_SUBSCRIPTIONMULTIPLEXER_H
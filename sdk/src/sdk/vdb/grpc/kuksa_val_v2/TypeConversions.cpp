@@ -16,151 +16,156 @@
 
 #include "TypeConversions.h"
 
+#include "sdk/ArrayConversions.h"
 #include "sdk/DataPointValue.h"
 #include "sdk/Logger.h"
 #include "sdk/vdb/grpc/common/TypeConversions.h"
 
+#include <cstdint>
+#include <iterator>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace velocitas::kuksa_val_v2 {
 
-kuksa::val::v2::Value convertToGrpcValue(const DataPointValue& dataPoint) {
-    kuksa::val::v2::Value grpcValue;
+namespace {
 
-    switch (dataPoint.getType()) {
-    case DataPointValue::Type::BOOL: {
-        grpcValue.set_bool_(dynamic_cast<const TypedDataPointValue<bool>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::BOOL_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<bool>>*>(&dataPoint)->value();
-        grpcValue.mutable_bool_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::INT8: {
-        grpcValue.set_int32(dynamic_cast<const TypedDataPointValue<int8_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::INT8_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<int8_t>>*>(&dataPoint)->value();
-        grpcValue.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::INT16: {
-        grpcValue.set_int32(dynamic_cast<const TypedDataPointValue<int16_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::INT16_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<int16_t>>*>(&dataPoint)->value();
-        grpcValue.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::INT32: {
-        grpcValue.set_int32(dynamic_cast<const TypedDataPointValue<int32_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::INT32_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<int32_t>>*>(&dataPoint)->value();
-        grpcValue.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::INT64: {
-        grpcValue.set_int64(dynamic_cast<const TypedDataPointValue<int64_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::INT64_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<int64_t>>*>(&dataPoint)->value();
-        grpcValue.mutable_int64_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::UINT8: {
-        grpcValue.set_uint32(
-            dynamic_cast<const TypedDataPointValue<uint8_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::UINT8_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<uint8_t>>*>(&dataPoint)->value();
-        grpcValue.mutable_uint32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::UINT16: {
-        grpcValue.set_uint32(
-            dynamic_cast<const TypedDataPointValue<uint16_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::UINT16_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<uint16_t>>*>(&dataPoint)->value();
-        grpcValue.mutable_uint32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::UINT32: {
-        grpcValue.set_uint32(
-            dynamic_cast<const TypedDataPointValue<uint32_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::UINT32_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<uint32_t>>*>(&dataPoint)->value();
-        grpcValue.mutable_uint32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::UINT64: {
-        grpcValue.set_uint64(
-            dynamic_cast<const TypedDataPointValue<uint64_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::UINT64_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<uint64_t>>*>(&dataPoint)->value();
-        grpcValue.mutable_uint64_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::FLOAT: {
-        grpcValue.set_float_(dynamic_cast<const TypedDataPointValue<float>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::FLOAT_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<float>>*>(&dataPoint)->value();
-        grpcValue.mutable_float_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::DOUBLE: {
-        grpcValue.set_double_(
-            dynamic_cast<const TypedDataPointValue<double>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::DOUBLE_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<double>>*>(&dataPoint)->value();
-        grpcValue.mutable_double_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
+/**
+ * @brief Sets the visited value as the matching typed value of a kuksa::val::v2::Value; values
+ * of integer types narrower than 32 bit are widened to 32 bit.
+ */
+class GrpcValueSetter {
+public:
+    explicit GrpcValueSetter(kuksa::val::v2::Value& grpcValue)
+        : m_grpcValue(grpcValue) {}
+
+    template <typename T> void operator()(const T& value) {
+        if constexpr (std::is_same_v<T, bool>) {
+            m_grpcValue.set_bool_(value);
+        } else if constexpr (std::is_same_v<T, float>) {
+            m_grpcValue.set_float_(value);
+        } else if constexpr (std::is_same_v<T, double>) {
+            m_grpcValue.set_double_(value);
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            m_grpcValue.set_string(value);
+        } else if constexpr (std::is_signed_v<T>) {
+            if constexpr (sizeof(T) <= sizeof(int32_t)) {
+                m_grpcValue.set_int32(value);
+            } else {
+                m_grpcValue.set_int64(value);
+            }
+        } else if constexpr (sizeof(T) <= sizeof(uint32_t)) {
+            m_grpcValue.set_uint32(value);
+        } else {
+            m_grpcValue.set_uint64(value);
+        }
     }
-    case DataPointValue::Type::STRING: {
-        grpcValue.set_string(
-            dynamic_cast<const TypedDataPointValue<std::string>*>(&dataPoint)->value());
-        break;
+
+    template <typename T> void operator()(const std::vector<T>& values) {
+        if constexpr (std::is_same_v<T, bool>) {
+            assign(*m_grpcValue.mutable_bool_array(), values);
+        } else if constexpr (std::is_same_v<T, float>) {
+            assign(*m_grpcValue.mutable_float_array(), values);
+        } else if constexpr (std::is_same_v<T, double>) {
+            assign(*m_grpcValue.mutable_double_array(), values);
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            assign(*m_grpcValue.mutable_string_array(), values);
+        } else if constexpr (std::is_signed_v<T>) {
+            if constexpr (sizeof(T) <= sizeof(int32_t)) {
+                assign(*m_grpcValue.mutable_int32_array(), values);
+            } else {
+                assign(*m_grpcValue.mutable_int64_array(), values);
+            }
+        } else if constexpr (sizeof(T) <= sizeof(uint32_t)) {
+            assign(*m_grpcValue.mutable_uint32_array(), values);
+        } else {
+            assign(*m_grpcValue.mutable_uint64_array(), values);
+        }
     }
-    case DataPointValue::Type::STRING_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<std::string>>*>(&dataPoint)->value();
-        grpcValue.mutable_string_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
+
+private:
+    // the elements are read from the data point directly, without copying the vector first
+    template <typename TArray, typename T>
+    static void assign(TArray& grpcArray, const std::vector<T>& values) {
+        auto& grpcValues = *grpcArray.mutable_values();
+        if constexpr (std::is_integral_v<T> && sizeof(T) < sizeof(int32_t) &&
+                      !std::is_same_v<T, bool>) {
+            // converted by the vectorized kernels directly into the (only reserved) array
+            const auto count = static_cast<int>(values.size());
+            grpcValues.Clear();
+            grpcValues.Reserve(count);
+            widenIntegers(values.data(), values.size(), grpcValues.AddNAlreadyReserved(count));
+        } else {
+            grpcValues.Assign(values.cbegin(), values.cend());
+        }
     }
+
+    kuksa::val::v2::Value& m_grpcValue;
+};
+
+using ValueCase_t = kuksa::val::v2::Value::TypedValueCase;
+
+// the value case data points of the passed type are transferred as
+ValueCase_t getValueCase(DataPointValue::Type type) {
+    switch (type) {
+    case DataPointValue::Type::BOOL:
+        return ValueCase_t::kBool;
+    case DataPointValue::Type::BOOL_ARRAY:
+        return ValueCase_t::kBoolArray;
+    case DataPointValue::Type::INT8:
+    case DataPointValue::Type::INT16:
+    case DataPointValue::Type::INT32:
+        return ValueCase_t::kInt32;
+    case DataPointValue::Type::INT8_ARRAY:
+    case DataPointValue::Type::INT16_ARRAY:
+    case DataPointValue::Type::INT32_ARRAY:
+        return ValueCase_t::kInt32Array;
+    case DataPointValue::Type::INT64:
+        return ValueCase_t::kInt64;
+    case DataPointValue::Type::INT64_ARRAY:
+        return ValueCase_t::kInt64Array;
+    case DataPointValue::Type::UINT8:
+    case DataPointValue::Type::UINT16:
+    case DataPointValue::Type::UINT32:
+        return ValueCase_t::kUint32;
+    case DataPointValue::Type::UINT8_ARRAY:
+    case DataPointValue::Type::UINT16_ARRAY:
+    case DataPointValue::Type::UINT32_ARRAY:
+        return ValueCase_t::kUint32Array;
+    case DataPointValue::Type::UINT64:
+        return ValueCase_t::kUint64;
+    case DataPointValue::Type::UINT64_ARRAY:
+        return ValueCase_t::kUint64Array;
+    case DataPointValue::Type::FLOAT:
+        return ValueCase_t::kFloat;
+    case DataPointValue::Type::FLOAT_ARRAY:
+        return ValueCase_t::kFloatArray;
+    case DataPointValue::Type::DOUBLE:
+        return ValueCase_t::kDouble;
+    case DataPointValue::Type::DOUBLE_ARRAY:
+        return ValueCase_t::kDoubleArray;
+    case DataPointValue::Type::STRING:
+        return ValueCase_t::kString;
+    case DataPointValue::Type::STRING_ARRAY:
+        return ValueCase_t::kStringArray;
     default:
-        throw InvalidTypeException("");
+        return ValueCase_t::TYPED_VALUE_NOT_SET;
     }
+}
+
+} // namespace
 
+kuksa::val::v2::Value convertToGrpcValue(const DataPointValue& dataPoint) {
+    kuksa::val::v2::Value grpcValue;
+    convertToGrpcValue(dataPoint, grpcValue);
     return grpcValue;
 }
 
+void convertToGrpcValue(const DataPointValue& dataPoint, kuksa::val::v2::Value& grpcValue) {
+    visitDataPointValue(dataPoint, GrpcValueSetter(grpcValue));
+}
+
 template <typename DATA_TYPE, typename ARRAY_CLASS>
 std::vector<DATA_TYPE> convertValueArray(const ARRAY_CLASS& arrayObject) {
     const auto&            valueArray = arrayObject.values();
@@ -168,64 +173,245 @@ std::vector<DATA_TYPE> convertValueArray(const ARRAY_CLASS& arrayObject) {
     return result;
 }
 
-std::shared_ptr<DataPointValue> convertFromGrpcValue(const std::string&           path,
-                                                     const kuksa::val::v2::Value& value,
-                                                     const Timestamp&             timestamp) {
+template <typename ARRAY_CLASS> std::vector<std::string> moveStringArray(ARRAY_CLASS& arrayObject) {
+    auto& valueArray = *arrayObject.mutable_values();
+    return {std::make_move_iterator(valueArray.begin()), std::make_move_iterator(valueArray.end())};
+}
+
+DataPointSample convertFromGrpcValueToSample(const kuksa::val::v2::Value& value,
+                                             const Timestamp&             timestamp) {
     switch (value.typed_value_case()) {
     case kuksa::val::v2::Value::TypedValueCase::kString:
-        return std::make_shared<TypedDataPointValue<std::string>>(path, value.string(), timestamp);
+        return DataPointSample(value.string(), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kBool:
-        return std::make_shared<TypedDataPointValue<bool>>(path, value.bool_(), timestamp);
+        return DataPointSample(value.bool_(), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kInt32:
-        return std::make_shared<TypedDataPointValue<int32_t>>(path, value.int32(), timestamp);
+        return DataPointSample(value.int32(), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kInt64:
-        return std::make_shared<TypedDataPointValue<int64_t>>(path, value.int64(), timestamp);
+        return DataPointSample(value.int64(), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kUint32:
-        return std::make_shared<TypedDataPointValue<uint32_t>>(path, value.uint32(), timestamp);
+        return DataPointSample(value.uint32(), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kUint64:
-        return std::make_shared<TypedDataPointValue<uint64_t>>(path, value.uint64(), timestamp);
+        return DataPointSample(value.uint64(), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kFloat:
-        return std::make_shared<TypedDataPointValue<float>>(path, value.float_(), timestamp);
+        return DataPointSample(value.float_(), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kDouble:
-        return std::make_shared<TypedDataPointValue<double>>(path, value.double_(), timestamp);
+        return DataPointSample(value.double_(), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kStringArray:
-        return std::make_shared<TypedDataPointValue<std::vector<std::string>>>(
-            path, convertValueArray<std::string>(value.string_array()), timestamp);
+        return DataPointSample(convertValueArray<std::string>(value.string_array()), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kBoolArray:
-        return std::make_shared<TypedDataPointValue<std::vector<bool>>>(
-            path, convertValueArray<bool>(value.bool_array()), timestamp);
+        return DataPointSample(convertValueArray<bool>(value.bool_array()), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kInt32Array:
-        return std::make_shared<TypedDataPointValue<std::vector<int32_t>>>(
-            path, convertValueArray<int32_t>(value.int32_array()), timestamp);
+        return DataPointSample(convertValueArray<int32_t>(value.int32_array()), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kInt64Array:
-        return std::make_shared<TypedDataPointValue<std::vector<int64_t>>>(
-            path, convertValueArray<int64_t>(value.int64_array()), timestamp);
+        return DataPointSample(convertValueArray<int64_t>(value.int64_array()), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kUint32Array:
-        return std::make_shared<TypedDataPointValue<std::vector<uint32_t>>>(
-            path, convertValueArray<uint32_t>(value.uint32_array()), timestamp);
+        return DataPointSample(convertValueArray<uint32_t>(value.uint32_array()), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kUint64Array:
-        return std::make_shared<TypedDataPointValue<std::vector<uint64_t>>>(
-            path, convertValueArray<uint64_t>(value.uint64_array()), timestamp);
+        return DataPointSample(convertValueArray<uint64_t>(value.uint64_array()), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kFloatArray:
-        return std::make_shared<TypedDataPointValue<std::vector<float>>>(
-            path, convertValueArray<float>(value.float_array()), timestamp);
+        return DataPointSample(convertValueArray<float>(value.float_array()), timestamp);
     case kuksa::val::v2::Value::TypedValueCase::kDoubleArray:
-        return std::make_shared<TypedDataPointValue<std::vector<double>>>(
-            path, convertValueArray<double>(value.double_array()), timestamp);
+        return DataPointSample(convertValueArray<double>(value.double_array()), timestamp);
     default:
         throw RpcException("Unknown value case!");
     }
 }
 
-std::shared_ptr<DataPointValue>
-convertFromGrpcDataPoint(const std::string& path, const kuksa::val::v2::Datapoint& grpcDataPoint) {
+DataPointSample convertFromGrpcDataPointToSample(const kuksa::val::v2::Datapoint& grpcDataPoint) {
+    auto timestamp = convertFromGrpcTimestamp(grpcDataPoint.timestamp());
+    if (grpcDataPoint.has_value()) {
+        return convertFromGrpcValueToSample(grpcDataPoint.value(), timestamp);
+    }
+
+    return DataPointSample(DataPointValue::Type::INVALID, DataPointValue::Failure::NOT_AVAILABLE,
+                           timestamp);
+}
+
+DataPointSample convertFromGrpcValueToSample(kuksa::val::v2::Value&& value,
+                                             const Timestamp&        timestamp) {
+    switch (value.typed_value_case()) {
+    case kuksa::val::v2::Value::TypedValueCase::kString:
+        return DataPointSample(std::move(*value.mutable_string()), timestamp);
+    case kuksa::val::v2::Value::TypedValueCase::kStringArray:
+        return DataPointSample(moveStringArray(*value.mutable_string_array()), timestamp);
+    default:
+        // all other payloads are trivially copyable, i.e. copied in one go
+        return convertFromGrpcValueToSample(std::as_const(value), timestamp);
+    }
+}
+
+DataPointSample convertFromGrpcDataPointToSample(kuksa::val::v2::Datapoint&& grpcDataPoint) {
     auto timestamp = convertFromGrpcTimestamp(grpcDataPoint.timestamp());
     if (grpcDataPoint.has_value()) {
-        return convertFromGrpcValue(path, grpcDataPoint.value(), timestamp);
+        return convertFromGrpcValueToSample(std::move(*grpcDataPoint.mutable_value()), timestamp);
+    }
+
+    return DataPointSample(DataPointValue::Type::INVALID, DataPointValue::Failure::NOT_AVAILABLE,
+                           timestamp);
+}
+
+namespace {
+
+DataPointSample decodeAnyDataPoint(const void* source) {
+    return convertFromGrpcDataPointToSample(*static_cast<const kuksa::val::v2::Datapoint*>(source));
+}
+
+template <ValueCase_t VALUE_CASE> DataPointSample decodeDataPointOf(const void* source) {
+    const auto& grpcDataPoint = *static_cast<const kuksa::val::v2::Datapoint*>(source);
+    // the default instance of absent values has no value case
+    const auto& value = grpcDataPoint.value();
+    if (value.typed_value_case() != VALUE_CASE) {
+        return convertFromGrpcDataPointToSample(grpcDataPoint);
     }
 
-    return std::make_shared<DataPointValue>(DataPointValue::Type::INVALID, path, timestamp,
-                                            DataPointValue::Failure::NOT_AVAILABLE);
+    auto timestamp = convertFromGrpcTimestamp(grpcDataPoint.timestamp());
+    if constexpr (VALUE_CASE == ValueCase_t::kString) {
+        return DataPointSample(value.string(), timestamp);
+    } else if constexpr (VALUE_CASE == ValueCase_t::kBool) {
+        return DataPointSample(value.bool_(), timestamp);
+    } else if constexpr (VALUE_CASE == ValueCase_t::kInt32) {
+        return DataPointSample(value.int32(), timestamp);
+    } else if constexpr (VALUE_CASE == ValueCase_t::kInt64) {
+        return DataPointSample(value.int64(), timestamp);
+    } else if constexpr (VALUE_CASE == ValueCase_t::kUint32) {
+        return DataPointSample(value.uint32(), timestamp);
+    } else if constexpr (VALUE_CASE == ValueCase_t::kUint64) {
+        return DataPointSample(value.uint64(), timestamp);
+    } else if constexpr (VALUE_CASE == ValueCase_t::kFloat) {
+        return DataPointSample(value.float_(), timestamp);
+    } else if constexpr (VALUE_CASE == ValueCase_t::kDouble) {
+        return DataPointSample(value.double_(), timestamp);
+    } else if constexpr (VALUE_CASE == ValueCase_t::kStringArray) {
+        return DataPointSample(convertValueArray<std::string>(value.string_array()), timestamp);
+    } else if constexpr (VALUE_CASE == ValueCase_t::kBoolArray) {
+        return DataPointSample(convertValueArray<bool>(value.bool_array()), timestamp);
+    } else if constexpr (VALUE_CASE == ValueCase_t::kInt32Array) {
+        return DataPointSample(convertValueArray<int32_t>(value.int32_array()), timestamp);
+    } else if constexpr (VALUE_CASE == ValueCase_t::kInt64Array) {
+        return DataPointSample(convertValueArray<int64_t>(value.int64_array()), timestamp);
+    } else if constexpr (VALUE_CASE == ValueCase_t::kUint32Array) {
+        return DataPointSample(convertValueArray<uint32_t>(value.uint32_array()), timestamp);
+    } else if constexpr (VALUE_CASE == ValueCase_t::kUint64Array) {
+        return DataPointSample(convertValueArray<uint64_t>(value.uint64_array()), timestamp);
+    } else if constexpr (VALUE_CASE == ValueCase_t::kFloatArray) {
+        return DataPointSample(convertValueArray<float>(value.float_array()), timestamp);
+    } else {
+        static_assert(VALUE_CASE == ValueCase_t::kDoubleArray);
+        return DataPointSample(convertValueArray<double>(value.double_array()), timestamp);
+    }
+}
+
+} // namespace
+
+DataPointValue::Type convertFromGrpcDataType(kuksa::val::v2::DataType dataType) {
+    switch (dataType) {
+    case kuksa::val::v2::DATA_TYPE_STRING:
+        return DataPointValue::Type::STRING;
+    case kuksa::val::v2::DATA_TYPE_BOOLEAN:
+        return DataPointValue::Type::BOOL;
+    case kuksa::val::v2::DATA_TYPE_INT8:
+        return DataPointValue::Type::INT8;
+    case kuksa::val::v2::DATA_TYPE_INT16:
+        return DataPointValue::Type::INT16;
+    case kuksa::val::v2::DATA_TYPE_INT32:
+        return DataPointValue::Type::INT32;
+    case kuksa::val::v2::DATA_TYPE_INT64:
+        return DataPointValue::Type::INT64;
+    case kuksa::val::v2::DATA_TYPE_UINT8:
+        return DataPointValue::Type::UINT8;
+    case kuksa::val::v2::DATA_TYPE_UINT16:
+        return DataPointValue::Type::UINT16;
+    case kuksa::val::v2::DATA_TYPE_UINT32:
+        return DataPointValue::Type::UINT32;
+    case kuksa::val::v2::DATA_TYPE_UINT64:
+        return DataPointValue::Type::UINT64;
+    case kuksa::val::v2::DATA_TYPE_FLOAT:
+        return DataPointValue::Type::FLOAT;
+    case kuksa::val::v2::DATA_TYPE_DOUBLE:
+        return DataPointValue::Type::DOUBLE;
+    case kuksa::val::v2::DATA_TYPE_STRING_ARRAY:
+        return DataPointValue::Type::STRING_ARRAY;
+    case kuksa::val::v2::DATA_TYPE_BOOLEAN_ARRAY:
+        return DataPointValue::Type::BOOL_ARRAY;
+    case kuksa::val::v2::DATA_TYPE_INT8_ARRAY:
+        return DataPointValue::Type::INT8_ARRAY;
+    case kuksa::val::v2::DATA_TYPE_INT16_ARRAY:
+        return DataPointValue::Type::INT16_ARRAY;
+    case kuksa::val::v2::DATA_TYPE_INT32_ARRAY:
+        return DataPointValue::Type::INT32_ARRAY;
+    case kuksa::val::v2::DATA_TYPE_INT64_ARRAY:
+        return DataPointValue::Type::INT64_ARRAY;
+    case kuksa::val::v2::DATA_TYPE_UINT8_ARRAY:
+        return DataPointValue::Type::UINT8_ARRAY;
+    case kuksa::val::v2::DATA_TYPE_UINT16_ARRAY:
+        return DataPointValue::Type::UINT16_ARRAY;
+    case kuksa::val::v2::DATA_TYPE_UINT32_ARRAY:
+        return DataPointValue::Type::UINT32_ARRAY;
+    case kuksa::val::v2::DATA_TYPE_UINT64_ARRAY:
+        return DataPointValue::Type::UINT64_ARRAY;
+    case kuksa::val::v2::DATA_TYPE_FLOAT_ARRAY:
+        return DataPointValue::Type::FLOAT_ARRAY;
+    case kuksa::val::v2::DATA_TYPE_DOUBLE_ARRAY:
+        return DataPointValue::Type::DOUBLE_ARRAY;
+    default:
+        return DataPointValue::Type::INVALID;
+    }
+}
+
+bool isAssignableType(DataPointValue::Type signalType, DataPointValue::Type valueType) {
+    return signalType == DataPointValue::Type::INVALID ||
+           getValueCase(signalType) == getValueCase(valueType);
+}
+
+LazySample::Decoder_t getDataPointDecoder(DataPointValue::Type type) {
+    switch (getValueCase(type)) {
+    case ValueCase_t::kString:
+        return &decodeDataPointOf<ValueCase_t::kString>;
+    case ValueCase_t::kBool:
+        return &decodeDataPointOf<ValueCase_t::kBool>;
+    case ValueCase_t::kInt32:
+        return &decodeDataPointOf<ValueCase_t::kInt32>;
+    case ValueCase_t::kInt64:
+        return &decodeDataPointOf<ValueCase_t::kInt64>;
+    case ValueCase_t::kUint32:
+        return &decodeDataPointOf<ValueCase_t::kUint32>;
+    case ValueCase_t::kUint64:
+        return &decodeDataPointOf<ValueCase_t::kUint64>;
+    case ValueCase_t::kFloat:
+        return &decodeDataPointOf<ValueCase_t::kFloat>;
+    case ValueCase_t::kDouble:
+        return &decodeDataPointOf<ValueCase_t::kDouble>;
+    case ValueCase_t::kStringArray:
+        return &decodeDataPointOf<ValueCase_t::kStringArray>;
+    case ValueCase_t::kBoolArray:
+        return &decodeDataPointOf<ValueCase_t::kBoolArray>;
+    case ValueCase_t::kInt32Array:
+        return &decodeDataPointOf<ValueCase_t::kInt32Array>;
+    case ValueCase_t::kInt64Array:
+        return &decodeDataPointOf<ValueCase_t::kInt64Array>;
+    case ValueCase_t::kUint32Array:
+        return &decodeDataPointOf<ValueCase_t::kUint32Array>;
+    case ValueCase_t::kUint64Array:
+        return &decodeDataPointOf<ValueCase_t::kUint64Array>;
+    case ValueCase_t::kFloatArray:
+        return &decodeDataPointOf<ValueCase_t::kFloatArray>;
+    case ValueCase_t::kDoubleArray:
+        return &decodeDataPointOf<ValueCase_t::kDoubleArray>;
+    default:
+        return &decodeAnyDataPoint;
+    }
+}
+
+std::shared_ptr<DataPointValue> convertFromGrpcValue(const std::string&           path,
+                                                     const kuksa::val::v2::Value& value,
+                                                     const Timestamp&             timestamp) {
+    return convertFromGrpcValueToSample(value, timestamp).toDataPointValue(path);
+}
+
+std::shared_ptr<DataPointValue>
+convertFromGrpcDataPoint(const std::string& path, const kuksa::val::v2::Datapoint& grpcDataPoint) {
+    return convertFromGrpcDataPointToSample(grpcDataPoint).toDataPointValue(path);
 }
 
 static const std::string SELECT_STATEMENT{"SELECT "}; // NOLINT(runtime/string)
@@ -19,7 +19,9 @@
 
 #include "kuksa/val/v2/val.grpc.pb.h"
 
+#include "sdk/DataPointSample.h"
 #include "sdk/DataPointValue.h"
+#include "sdk/LazyDataPoint.h"
 
 #include <memory>
 #include <string>
@@ -29,6 +31,12 @@ namespace velocitas::kuksa_val_v2 {
 
 kuksa::val::v2::Value convertToGrpcValue(const DataPointValue& dataPoint);
 
+/**
+ * @brief Convert the value of the passed data point into the passed gRPC value, e.g. a field of
+ *        a request, which saves constructing and moving a temporary one.
+ */
+void convertToGrpcValue(const DataPointValue& dataPoint, kuksa::val::v2::Value& grpcValue);
+
 std::shared_ptr<DataPointValue> convertFromGrpcValue(const std::string&           path,
                                                      const kuksa::val::v2::Value& value,
                                                      const Timestamp&             timestamp);
@@ -36,6 +44,41 @@ std::shared_ptr<DataPointValue> convertFromGrpcValue(const std::string&
 std::shared_ptr<DataPointValue>
 convertFromGrpcDataPoint(const std::string& path, const kuksa::val::v2::Datapoint& grpcDataPoint);
 
+DataPointSample convertFromGrpcValueToSample(const kuksa::val::v2::Value& value,
+                                             const Timestamp&             timestamp);
+
+DataPointSample convertFromGrpcDataPointToSample(const kuksa::val::v2::Datapoint& grpcDataPoint);
+
+/**
+ * @brief Convert a value/data point the caller does not need anymore; string payloads (incl. the
+ *        elements of string arrays) are moved into the sample instead of being copied.
+ */
+DataPointSample convertFromGrpcValueToSample(kuksa::val::v2::Value&& value,
+                                             const Timestamp&        timestamp);
+
+DataPointSample convertFromGrpcDataPointToSample(kuksa::val::v2::Datapoint&& grpcDataPoint);
+
+/**
+ * @brief Get the type of the data points of signals of the passed databroker data type; INVALID
+ *        for data types not supported by the SDK (e.g. timestamps).
+ */
+DataPointValue::Type convertFromGrpcDataType(kuksa::val::v2::DataType dataType);
+
+/**
+ * @brief Check whether a value of the passed type can be set to a signal of the passed type, i.e.
+ *        whether both are transferred as the same typed value (the range of narrow integers is
+ *        checked by the databroker). Any value can be set to signals of unknown (INVALID) type.
+ */
+bool isAssignableType(DataPointValue::Type signalType, DataPointValue::Type valueType);
+
+/**
+ * @brief Get the decoder of lazy samples sourced by kuksa::val::v2::Datapoints of signals of the
+ *        passed type: it reads the typed value the signal's data points are transferred as right
+ *        away instead of dispatching on the value case. Data points not holding a value of that
+ *        type (e.g. failures) are converted like by convertFromGrpcDataPointToSample.
+ */
+LazySample::Decoder_t getDataPointDecoder(DataPointValue::Type type);
+
 std::vector<std::string> parseQuery(const std::string& query);
 
 } // namespace velocitas::kuksa_val_v2
@@ -16,6 +16,7 @@
 
 #include "BrokerAsyncGrpcFacade.h"
 
+#include "sdk/AllocationTracker.h"
 #include "sdk/Logger.h"
 #include "sdk/grpc/GrpcCall.h"
 
@@ -23,24 +24,59 @@
 
 namespace velocitas::sdv_databroker_v1 {
 
+namespace {
+
+/**
+ * @brief Release the lease of a completed call. A call failed with UNAVAILABLE may indicate the
+ * databroker not being reachable, which lets the pool fail over to its next endpoint.
+ */
+void releaseLease(std::shared_ptr<ChannelPool::Lease>& lease, const grpc::Status& status) {
+    if (status.error_code() == grpc::StatusCode::UNAVAILABLE) {
+        lease->reportUnavailable();
+    }
+    lease.reset();
+}
+
+} // namespace
+
 BrokerAsyncGrpcFacade::BrokerAsyncGrpcFacade(const std::shared_ptr<grpc::Channel>& channel)
-    : m_stub{sdv::databroker::v1::Broker::NewStub(channel)} {}
+    : BrokerAsyncGrpcFacade(ChannelPool::create({channel}, ChannelSelection::ROUND_ROBIN)) {}
+
+BrokerAsyncGrpcFacade::BrokerAsyncGrpcFacade(std::shared_ptr<ChannelPool> channelPool)
+    : m_channelPool{std::move(channelPool)} {
+    m_stubs.reserve(m_channelPool->getSize());
+    for (size_t i = 0; i < m_channelPool->getSize(); ++i) {
+        m_stubs.push_back(sdv::databroker::v1::Broker::NewStub(m_channelPool->getChannel(i)));
+    }
+}
+
+std::pair<BrokerAsyncGrpcFacade::Stub_t*, std::shared_ptr<ChannelPool::Lease>>
+BrokerAsyncGrpcFacade::selectStub() {
+    auto lease = m_channelPool->acquire();
+    return {m_stubs[lease->getIndex()].get(), std::move(lease)};
+}
 
-void BrokerAsyncGrpcFacade::GetDatapoints(
+std::shared_ptr<GrpcCall> BrokerAsyncGrpcFacade::GetDatapoints(
     const std::vector<std::string>&                                           datapoints,
     std::function<void(const sdv::databroker::v1::GetDatapointsReply& reply)> replyHandler,
-    std::function<void(const grpc::Status& status)>                           errorHandler) {
-    auto callData =
-        std::make_shared<GrpcSingleResponseCall<sdv::databroker::v1::GetDatapointsRequest,
-                                                sdv::databroker::v1::GetDatapointsReply>>();
+    std::function<void(const grpc::Status& status)>                           errorHandler,
+    Timeout_t                                                                 timeout) {
+    using Call_t = GrpcSingleResponseCall<sdv::databroker::v1::GetDatapointsRequest,
+                                          sdv::databroker::v1::GetDatapointsReply>;
+    auto callData = makeSharedIn<AllocationDomain::GRPC_CALLS, Call_t>();
 
     std::for_each(datapoints.begin(), datapoints.end(), [&callData](const auto& dataPoint) {
         callData->m_request.add_datapoints(dataPoint);
     });
 
     applyContextModifier(*callData);
+    applyDeadline(*callData, timeout);
+    applyCompression(*callData, callData->m_request);
 
-    const auto grpcResultHandler = [callData, replyHandler, errorHandler](grpc::Status status) {
+    auto [stub, lease]     = selectStub();
+    auto grpcResultHandler = [callData, replyHandler, errorHandler,
+                              lease = std::move(lease)](grpc::Status status) mutable {
+        callData->recordCompletion(status);
         try {
             if (status.ok()) {
                 replyHandler(callData->m_response);
@@ -50,30 +86,38 @@ void BrokerAsyncGrpcFacade::GetDatapoints(
         } catch (std::exception& e) {
             logger().error("GRPC: Exception occurred during \"GetDatapoints\": {}", e.what());
         }
+        releaseLease(lease, status);
         callData->m_isComplete = true;
     };
 
     addActiveCall(callData);
 
-    m_stub->async()->GetDatapoints(&callData->m_context, &callData->m_request,
-                                   &callData->m_response, grpcResultHandler);
+    stub->async()->GetDatapoints(&callData->m_context, &callData->m_request, &callData->m_response,
+                                 grpcResultHandler);
+    return callData;
 }
 
-void BrokerAsyncGrpcFacade::SetDatapoints(
+std::shared_ptr<GrpcCall> BrokerAsyncGrpcFacade::SetDatapoints(
     const std::map<std::string, sdv::databroker::v1::Datapoint>&              datapoints,
     std::function<void(const sdv::databroker::v1::SetDatapointsReply& reply)> replyHandler,
-    std::function<void(const grpc::Status& status)>                           errorHandler) {
-    auto callData =
-        std::make_shared<GrpcSingleResponseCall<sdv::databroker::v1::SetDatapointsRequest,
-                                                sdv::databroker::v1::SetDatapointsReply>>();
+    std::function<void(const grpc::Status& status)>                           errorHandler,
+    Timeout_t                                                                 timeout) {
+    using Call_t = GrpcSingleResponseCall<sdv::databroker::v1::SetDatapointsRequest,
+                                          sdv::databroker::v1::SetDatapointsReply>;
+    auto callData = makeSharedIn<AllocationDomain::GRPC_CALLS, Call_t>();
 
     for (const auto [key, value] : datapoints) {
         (*callData->m_request.mutable_datapoints())[key] = value;
     }
 
     applyContextModifier(*callData);
+    applyDeadline(*callData, timeout);
+    applyCompression(*callData, callData->m_request);
 
-    auto grpcResultHandler = [callData, replyHandler, errorHandler](grpc::Status status) {
+    auto [stub, lease]     = selectStub();
+    auto grpcResultHandler = [callData, replyHandler, errorHandler,
+                              lease = std::move(lease)](grpc::Status status) mutable {
+        callData->recordCompletion(status);
         try {
             if (status.ok()) {
                 replyHandler(callData->m_response);
@@ -83,22 +127,24 @@ void BrokerAsyncGrpcFacade::SetDatapoints(
         } catch (std::exception& e) {
             logger().error("GRPC: Exception occurred during \"SetDatapoints\": {}", e.what());
         }
+        releaseLease(lease, status);
         callData->m_isComplete = true;
     };
 
     addActiveCall(callData);
 
-    m_stub->async()->SetDatapoints(&callData->m_context, &callData->m_request,
-                                   &callData->m_response, grpcResultHandler);
+    stub->async()->SetDatapoints(&callData->m_context, &callData->m_request, &callData->m_response,
+                                 grpcResultHandler);
+    return callData;
 }
 
-void BrokerAsyncGrpcFacade::Subscribe(
+std::shared_ptr<GrpcCall> BrokerAsyncGrpcFacade::Subscribe(
     const std::string&                                                    query,
     std::function<void(const sdv::databroker::v1::SubscribeReply& reply)> itemHandler,
     std::function<void(const grpc::Status& status)>                       errorHandler) {
-    auto callData =
-        std::make_shared<GrpcStreamingResponseCall<sdv::databroker::v1::SubscribeRequest,
-                                                   sdv::databroker::v1::SubscribeReply>>();
+    using Call_t = GrpcStreamingResponseCall<sdv::databroker::v1::SubscribeRequest,
+                                             sdv::databroker::v1::SubscribeReply>;
+    auto callData = makeSharedIn<AllocationDomain::GRPC_CALLS, Call_t>();
 
     callData->getRequest().set_query(query);
 
@@ -106,19 +152,23 @@ void BrokerAsyncGrpcFacade::Subscribe(
 
     addActiveCall(callData);
 
-    m_stub->async()->Subscribe(&callData->m_context, &callData->getRequest(),
-                               &callData->getReactor());
+    auto [stub, lease] = selectStub();
+    stub->async()->Subscribe(&callData->m_context, &callData->getRequest(),
+                             &callData->getReactor());
 
     callData->onData(itemHandler);
 
-    callData->onFinish([callData, errorHandler](const auto& status) {
-        if (!status.ok()) {
-            errorHandler(status);
-        }
-        callData->m_isComplete = true;
-    });
+    callData->onFinish(
+        [callData, errorHandler, lease = std::move(lease)](const auto& status) mutable {
+            if (!status.ok()) {
+                errorHandler(status);
+            }
+            releaseLease(lease, status);
+            callData->m_isComplete = true;
+        });
 
     callData->startCall();
+    return callData;
 }
 
 } // namespace velocitas::sdv_databroker_v1
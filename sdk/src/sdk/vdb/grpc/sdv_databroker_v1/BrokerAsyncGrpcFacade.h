@@ -19,6 +19,7 @@
 
 #include "sdk/grpc/AsyncGrpcFacade.h"
 #include "sdk/grpc/GrpcClient.h"
+#include "sdk/vdb/grpc/common/ChannelPool.h"
 
 #include "sdv/databroker/v1/broker.grpc.pb.h"
 
@@ -26,6 +27,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace grpc {
@@ -39,23 +41,48 @@ class BrokerAsyncGrpcFacade : public AsyncGrpcFacade, GrpcClient {
 public:
     explicit BrokerAsyncGrpcFacade(const std::shared_ptr<grpc::Channel>& channel);
 
-    void GetDatapoints(
+    /**
+     * @brief Issue each call on one of the channels of the passed pool.
+     */
+    explicit BrokerAsyncGrpcFacade(std::shared_ptr<ChannelPool> channelPool);
+
+    /**
+     * @brief Calls expecting a single response fail with DEADLINE_EXCEEDED after the passed
+     * timeout, respectively after the facade's call timeout if none is passed. The returned
+     * call may be used to cancel it.
+     */
+    std::shared_ptr<GrpcCall> GetDatapoints(
         const std::vector<std::string>&                                           datapoints,
         std::function<void(const sdv::databroker::v1::GetDatapointsReply& reply)> replyHandler,
-        std::function<void(const grpc::Status& status)>                           errorHandler);
+        std::function<void(const grpc::Status& status)>                           errorHandler,
+        Timeout_t                                                                 timeout = {});
 
-    void SetDatapoints(
+    std::shared_ptr<GrpcCall> SetDatapoints(
         const std::map<std::string, sdv::databroker::v1::Datapoint>&              datapoints,
         std::function<void(const sdv::databroker::v1::SetDatapointsReply& reply)> replyHandler,
-        std::function<void(const grpc::Status& status)>                           errorHandler);
+        std::function<void(const grpc::Status& status)>                           errorHandler,
+        Timeout_t                                                                 timeout = {});
 
-    void
+    std::shared_ptr<GrpcCall>
     Subscribe(const std::string&                                                    query,
               std::function<void(const sdv::databroker::v1::SubscribeReply& reply)> itemHandler,
               std::function<void(const grpc::Status& status)>                       errorHandler);
 
+    [[nodiscard]] const std::shared_ptr<ChannelPool>& getChannelPool() const {
+        return m_channelPool;
+    }
+
 private:
-    std::unique_ptr<sdv::databroker::v1::Broker::StubInterface> m_stub;
+    using Stub_t = sdv::databroker::v1::Broker::StubInterface;
+
+    /**
+     * @brief Select the stub to issue the next call on; the returned lease has to be kept until
+     * the call is complete.
+     */
+    std::pair<Stub_t*, std::shared_ptr<ChannelPool::Lease>> selectStub();
+
+    std::shared_ptr<ChannelPool>         m_channelPool;
+    std::vector<std::unique_ptr<Stub_t>> m_stubs;
 };
 
 } // namespace velocitas::sdv_databroker_v1
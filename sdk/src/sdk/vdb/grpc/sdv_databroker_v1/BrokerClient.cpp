@@ -16,35 +16,56 @@
 
 #include "BrokerClient.h"
 
+#include "sdk/DataPointSample.h"
 #include "sdk/DataPointValue.h"
 #include "sdk/Exceptions.h"
 #include "sdk/Logger.h"
+#include "sdk/SignalHistory.h"
+#include "sdk/SignalMirror.h"
+#include "sdk/SignalPathRegistry.h"
+#include "sdk/ThreadPool.h"
+#include "sdk/grpc/GrpcCall.h"
 
 #include "sdk/middleware/Middleware.h"
-#include "sdk/vdb/grpc/common/ChannelConfiguration.h"
+#include "sdk/vdb/SignalUpdateFilter.h"
+#include "sdk/vdb/grpc/common/ChannelPool.h"
+#include "sdk/vdb/grpc/common/TypeConversions.h"
 #include "sdk/vdb/grpc/sdv_databroker_v1/BrokerAsyncGrpcFacade.h"
-#include "sdk/vdb/grpc/sdv_databroker_v1/GrpcDataPointValueProvider.h"
+#include "sdk/vdb/grpc/sdv_databroker_v1/TypeConversions.h"
 
 #include <fmt/core.h>
 #include <grpcpp/channel.h>
-#include <grpcpp/create_channel.h>
-#include <grpcpp/security/credentials.h>
 
+#include <cstdint>
+#include <map>
+#include <string>
 #include <thread>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace velocitas::sdv_databroker_v1 {
 
-BrokerClient::BrokerClient(const std::string& vdbAddress, const std::string& vdbServiceName) {
+BrokerClient::BrokerClient(const std::string& vdbAddress, const std::string& vdbServiceName)
+    : m_readCoalescer([this](const auto& datapoints) { return requestDatapoints(datapoints); })
+    , m_parallelDecoder(
+          std::make_shared<ParallelDecoder>(ParallelDecoderConfig::fromEnvironment(),
+                                            ThreadPool::getInstance(ThreadPool::VDB_POOL))) {
     logger().info("Connecting to data broker service '{}' via '{}'", vdbServiceName, vdbAddress);
-    m_asyncBrokerFacade = std::make_shared<BrokerAsyncGrpcFacade>(grpc::CreateCustomChannel(
-        vdbAddress, grpc::InsecureChannelCredentials(), getChannelArguments()));
+    m_asyncBrokerFacade = std::make_shared<BrokerAsyncGrpcFacade>(
+        ChannelPool::getShared(vdbAddress, ChannelPoolConfig::fromEnvironment()));
     Middleware::Metadata metadata = Middleware::getInstance().getMetadata(vdbServiceName);
     m_asyncBrokerFacade->setContextModifier([metadata](auto& context) {
         for (auto metadatum : metadata) {
             context.AddMetadata(metadatum.first, metadatum.second);
         }
     });
+    const auto prewarmConfig = ChannelPrewarmConfig::fromEnvironment();
+    if (prewarmConfig.m_timeout.count() > 0) {
+        m_prewarmer = ChannelPrewarmer::start(*m_asyncBrokerFacade->getChannelPool(),
+                                              prewarmConfig.m_timeout);
+    }
 }
 
 BrokerClient::BrokerClient(const std::string& vdbServiceName)
@@ -71,248 +92,43 @@ static sdv::databroker::v1::Datapoint_Failure mapToGrpcType(DataPointValue::Fail
     }
 }
 
-sdv::databroker::v1::Datapoint convertToGrpcDataPoint(const DataPointValue& dataPoint) {
-    sdv::databroker::v1::Datapoint grpcDataPoint{};
-
-    switch (dataPoint.getType()) {
-    case DataPointValue::Type::BOOL: {
-        grpcDataPoint.set_bool_value(
-            dynamic_cast<const TypedDataPointValue<bool>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::BOOL_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<bool>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_bool_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::DOUBLE: {
-        grpcDataPoint.set_double_value(
-            dynamic_cast<const TypedDataPointValue<double>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::DOUBLE_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<double>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_double_array()->mutable_values()->Assign(array.cbegin(),
-                                                                       array.cend());
-        break;
-    }
-    case DataPointValue::Type::FLOAT: {
-        grpcDataPoint.set_float_value(
-            dynamic_cast<const TypedDataPointValue<float>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::FLOAT_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<float>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_float_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::INT8: {
-        grpcDataPoint.set_int32_value(
-            dynamic_cast<const TypedDataPointValue<int8_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::INT8_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<int8_t>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::INT16: {
-        grpcDataPoint.set_int32_value(
-            dynamic_cast<const TypedDataPointValue<int16_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::INT16_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<int16_t>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::INT32: {
-        grpcDataPoint.set_int32_value(
-            dynamic_cast<const TypedDataPointValue<int32_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::INT32_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<int32_t>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::INT64: {
-        grpcDataPoint.set_int64_value(
-            dynamic_cast<const TypedDataPointValue<int64_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::INT64_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<int64_t>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_int64_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::STRING: {
-        grpcDataPoint.set_string_value(
-            dynamic_cast<const TypedDataPointValue<std::string>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::STRING_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<std::string>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_string_array()->mutable_values()->Assign(array.cbegin(),
-                                                                       array.cend());
-        break;
-    }
-    case DataPointValue::Type::UINT8: {
-        grpcDataPoint.set_int32_value(
-            dynamic_cast<const TypedDataPointValue<uint8_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::UINT8_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<uint8_t>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::UINT16: {
-        grpcDataPoint.set_int32_value(
-            dynamic_cast<const TypedDataPointValue<uint16_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::UINT16_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<uint16_t>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_int32_array()->mutable_values()->Assign(array.cbegin(), array.cend());
-        break;
-    }
-    case DataPointValue::Type::UINT32: {
-        grpcDataPoint.set_uint32_value(
-            dynamic_cast<const TypedDataPointValue<uint32_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::UINT32_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<uint32_t>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_uint32_array()->mutable_values()->Assign(array.cbegin(),
-                                                                       array.cend());
-        break;
-    }
-    case DataPointValue::Type::UINT64: {
-        grpcDataPoint.set_uint64_value(
-            dynamic_cast<const TypedDataPointValue<uint64_t>*>(&dataPoint)->value());
-        break;
-    }
-    case DataPointValue::Type::UINT64_ARRAY: {
-        auto array =
-            dynamic_cast<const TypedDataPointValue<std::vector<uint64_t>>*>(&dataPoint)->value();
-        grpcDataPoint.mutable_uint64_array()->mutable_values()->Assign(array.cbegin(),
-                                                                       array.cend());
-        break;
-    }
-    default:
-        throw InvalidTypeException("");
-    }
-
-    return grpcDataPoint;
-}
-
-std::shared_ptr<DataPointValue>
-convertDataPointToInternal(const std::string&                    name,
-                           const sdv::databroker::v1::Datapoint& grpcDataPoint) {
-    GrpcDataPointValueProvider valueProvider{grpcDataPoint};
-
-    switch (grpcDataPoint.value_case()) {
-    case sdv::databroker::v1::Datapoint::ValueCase::kFailureValue:
-        return std::make_shared<DataPointValue>(DataPointValue::Type::INVALID, name,
-                                                valueProvider.getTimestamp(),
-                                                valueProvider.getFailure());
-    case sdv::databroker::v1::Datapoint::ValueCase::kStringValue:
-        return std::make_shared<TypedDataPointValue<std::string>>(
-            name, valueProvider.getStringValue(), valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kBoolValue:
-        return std::make_shared<TypedDataPointValue<bool>>(name, valueProvider.getBoolValue(),
-                                                           valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kInt32Value:
-        return std::make_shared<TypedDataPointValue<int32_t>>(name, valueProvider.getInt32Value(),
-                                                              valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kInt64Value:
-        return std::make_shared<TypedDataPointValue<int64_t>>(name, valueProvider.getInt64Value(),
-                                                              valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kUint32Value:
-        return std::make_shared<TypedDataPointValue<uint32_t>>(name, valueProvider.getUint32Value(),
-                                                               valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kUint64Value:
-        return std::make_shared<TypedDataPointValue<uint64_t>>(name, valueProvider.getUint64Value(),
-                                                               valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kFloatValue:
-        return std::make_shared<TypedDataPointValue<float>>(name, valueProvider.getFloatValue(),
-                                                            valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kDoubleValue:
-        return std::make_shared<TypedDataPointValue<double>>(name, valueProvider.getDoubleValue(),
-                                                             valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kStringArray:
-        return std::make_shared<TypedDataPointValue<std::vector<std::string>>>(
-            name, valueProvider.getStringArrayValue(), valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kBoolArray:
-        return std::make_shared<TypedDataPointValue<std::vector<bool>>>(
-            name, valueProvider.getBoolArrayValue(), valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kInt32Array:
-        return std::make_shared<TypedDataPointValue<std::vector<int32_t>>>(
-            name, valueProvider.getInt32ArrayValue(), valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kInt64Array:
-        return std::make_shared<TypedDataPointValue<std::vector<int64_t>>>(
-            name, valueProvider.getInt64ArrayValue(), valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kUint32Array:
-        return std::make_shared<TypedDataPointValue<std::vector<uint32_t>>>(
-            name, valueProvider.getUint32ArrayValue(), valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kUint64Array:
-        return std::make_shared<TypedDataPointValue<std::vector<uint64_t>>>(
-            name, valueProvider.getUint64ArrayValue(), valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kFloatArray:
-        return std::make_shared<TypedDataPointValue<std::vector<float>>>(
-            name, valueProvider.getFloatArrayValue(), valueProvider.getTimestamp());
-    case sdv::databroker::v1::Datapoint::ValueCase::kDoubleArray:
-        return std::make_shared<TypedDataPointValue<std::vector<double>>>(
-            name, valueProvider.getDoubleArrayValue(), valueProvider.getTimestamp());
-    default:
-        throw RpcException("Unknown value case!");
-    }
-
-    return nullptr;
+AsyncResultPtr_t<DataPointReply>
+BrokerClient::getDatapoints(const std::vector<std::string>& datapoints) {
+    return withCallbackExecutor(m_readCoalescer.read(datapoints));
 }
 
 AsyncResultPtr_t<DataPointReply>
-BrokerClient::getDatapoints(const std::vector<std::string>& datapoints) {
+BrokerClient::requestDatapoints(const std::vector<std::string>& datapoints) {
     auto result = std::make_shared<AsyncResult<DataPointReply>>();
-    m_asyncBrokerFacade->GetDatapoints(
+    auto call   = m_asyncBrokerFacade->GetDatapoints(
         datapoints,
-        [result](auto reply) {
-            DataPointMap_t resultMap;
-            for (const auto [key, value] : reply.datapoints()) {
-                resultMap[key] = convertDataPointToInternal(key, value);
+        [result](const auto& reply) {
+            DataPointReply dataPoints;
+            dataPoints.reserve(reply.datapoints().size());
+            for (const auto& [key, value] : reply.datapoints()) {
+                dataPoints.set(key, convertFromGrpcDataPointToSample(value));
             }
 
-            result->insertResult(DataPointReply(std::move(resultMap)));
+            result->insertResult(std::move(dataPoints));
         },
         [result](auto status) {
             result->insertError(
                 Status(fmt::format("RPC 'GetDatapoints' failed: {}", status.error_message())));
         });
+    bindCancellation(*result, call);
     return result;
 }
 
 AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t>
 BrokerClient::setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints) {
-    auto result = std::make_shared<AsyncResult<SetErrorMap_t>>();
+    auto result = withCallbackExecutor(std::make_shared<AsyncResult<SetErrorMap_t>>());
 
     std::map<std::string, sdv::databroker::v1::Datapoint> grpcDataPoints{};
     for (const auto& dataPoint : datapoints) {
-        grpcDataPoints[dataPoint->getPath()] = convertToGrpcDataPoint(*dataPoint);
+        convertToGrpcDataPoint(*dataPoint, grpcDataPoints[dataPoint->getPath()]);
     }
 
-    m_asyncBrokerFacade->SetDatapoints(
+    auto call = m_asyncBrokerFacade->SetDatapoints(
         grpcDataPoints,
         [result](const sdv::databroker::v1::SetDatapointsReply& reply) {
             SetErrorMap_t errorMap;
@@ -325,27 +141,91 @@ BrokerClient::setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>&
             result->insertError(
                 Status(fmt::format("RPC 'SetDatapoints' failed: {}", status.error_message())));
         });
+    bindCancellation(*result, call);
     return result;
 }
 
 AsyncSubscriptionPtr_t<DataPointReply> BrokerClient::subscribe(const std::string& query) {
+    return subscribe(query, SubscriptionOptions{});
+}
+
+AsyncSubscriptionPtr_t<DataPointReply>
+BrokerClient::subscribe(const std::string& query, const SubscriptionOptions& options) {
     auto subscription = std::make_shared<AsyncSubscription<DataPointReply>>();
-    m_asyncBrokerFacade->Subscribe(
+    subscription->setCallbackExecutor(resolveCallbackExecutor(options));
+    if (options.m_isCoalescingDeliveries) {
+        subscription->setOverflowPolicy(OverflowPolicy::CONFLATE_LATEST);
+    }
+    // updates of a stream are handled one after the other, so the filters need no lock
+    std::shared_ptr<std::unordered_map<SignalHandle_t, SignalUpdateFilter>> filters;
+    if (SignalUpdateFilter::isFiltering(options)) {
+        filters = std::make_shared<std::unordered_map<SignalHandle_t, SignalUpdateFilter>>();
+    }
+    // the item handler holds the only reference of the producer, so dropping the subscription
+    // is noticed with the next update; the stream is then cancelled like on cancel()
+    auto call = m_asyncBrokerFacade->Subscribe(
         query,
-        [subscription](const auto& item) {
-            DataPointMap_t resultFields;
-            const auto     fieldsMap = item.fields();
-            for (const auto& [key, value] : fieldsMap) {
-                resultFields[key] = convertDataPointToInternal(key, value);
+        [subscription, options, filters, decoder = m_parallelDecoder](const auto& item) {
+            if (AsyncSubscription<DataPointReply>::isAbandoned(subscription)) {
+                subscription->cancel();
+                return;
+            }
+            const auto  receivedAt = SignalUpdateFilter::Clock_t::now();
+            const auto& fieldsMap  = item.fields();
+
+            // decoded into samples keyed by the interned path, wide updates in parallel chunks
+            std::vector<decltype(&*fieldsMap.begin())> fields;
+            fields.reserve(fieldsMap.size());
+            for (const auto& field : fieldsMap) {
+                fields.push_back(&field);
+            }
+            std::vector<std::pair<SignalHandle_t, DataPointSample>> samples(fields.size());
+            decoder->decode(fields.size(), [&fields, &samples](size_t begin, size_t end) {
+                auto& registry = SignalPathRegistry::getInstance();
+                for (size_t i = begin; i < end; ++i) {
+                    samples[i] = {registry.intern(fields[i]->first),
+                                  convertFromGrpcDataPointToSample(fields[i]->second)};
+                }
+            });
+
+            DataPointReply resultFields;
+            resultFields.reserve(samples.size());
+            for (auto& [handle, sample] : samples) {
+                if (auto& historyStore = SignalHistoryStore::getInstance();
+                    historyStore.isRecording(handle)) {
+                    historyStore.record(handle, sample);
+                }
+                if (auto& mirror = SignalMirror::getInstance(); mirror.isMirroring(handle)) {
+                    mirror.record(handle, sample, receivedAt);
+                }
+                if (filters && !(*filters)[handle].accept(options, sample, receivedAt)) {
+                    continue;
+                }
+                resultFields.set(handle, std::move(sample));
             }
-            subscription->insertNewItem(DataPointReply(std::move(resultFields)));
+            if (filters && resultFields.empty()) {
+                return;
+            }
+            subscription->insertNewItem(std::move(resultFields));
         },
-        [subscription](const auto& status) {
-            subscription->insertError(
+        [weakSubscription =
+             std::weak_ptr<AsyncSubscription<DataPointReply>>(subscription)](const auto& status) {
+            auto subscriptionPtr = weakSubscription.lock();
+            if (!subscriptionPtr || subscriptionPtr->isCancelled()) {
+                return;
+            }
+            subscriptionPtr->insertError(
                 Status(fmt::format("RPC 'Subscribe' failed: {}", status.error_message())));
         });
-
+    bindCancellation(*subscription, call);
     return subscription;
 }
 
+AsyncResultPtr_t<Status> BrokerClient::whenReady() {
+    if (!m_prewarmer) {
+        return IVehicleDataBrokerClient::whenReady();
+    }
+    return withCallbackExecutor(m_prewarmer->whenReady());
+}
+
 } // namespace velocitas::sdv_databroker_v1
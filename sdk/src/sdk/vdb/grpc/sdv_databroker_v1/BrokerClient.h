@@ -18,6 +18,9 @@
 #define VEHICLE_APP_SDK_BROKERCLIENT_H
 
 #include "sdk/vdb/IVehicleDataBrokerClient.h"
+#include "sdk/vdb/grpc/common/ChannelPrewarmer.h"
+#include "sdk/vdb/grpc/common/ParallelDecoder.h"
+#include "sdk/vdb/grpc/common/ReadCoalescer.h"
 
 #include <memory>
 #include <string>
@@ -49,10 +52,31 @@ public:
     AsyncResultPtr_t<SetErrorMap_t>
     setDatapoints(const std::vector<std::unique_ptr<DataPointValue>>& datapoints) override;
 
+    using IVehicleDataBrokerClient::setDatapoints;
+
+    using IVehicleDataBrokerClient::subscribe;
+
     AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string& query) override;
 
+    /**
+     * @brief The Broker API has no subscription modes, so replies always hold the fields of the
+     * query updated by the databroker, minus the ones dropped by the filter options. Updates with
+     * many fields are decoded in parallel, see ParallelDecoder.
+     */
+    AsyncSubscriptionPtr_t<DataPointReply> subscribe(const std::string&         query,
+                                                     const SubscriptionOptions& options) override;
+
+    AsyncResultPtr_t<Status> whenReady() override;
+
 private:
+    AsyncResultPtr_t<DataPointReply> requestDatapoints(const std::vector<std::string>& datapoints);
+
     std::shared_ptr<BrokerAsyncGrpcFacade> m_asyncBrokerFacade;
+    ReadCoalescer                          m_readCoalescer;
+    // shared with the subscription callbacks, which may outlive the client
+    std::shared_ptr<ParallelDecoder>       m_parallelDecoder;
+    // connects the channels at creation; null if not configured
+    std::shared_ptr<ChannelPrewarmer>      m_prewarmer;
 };
 
 } // namespace velocitas::sdv_databroker_v1
@@ -0,0 +1,218 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/grpc/sdv_databroker_v1/TypeConversions.h"
+
+#include "sdk/ArrayConversions.h"
+#include "sdk/Exceptions.h"
+#include "sdk/Logger.h"
+#include "sdk/vdb/grpc/common/TypeConversions.h"
+
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace velocitas::sdv_databroker_v1 {
+
+namespace {
+
+/**
+ * @brief Sets the visited value as the matching typed value of a sdv::databroker::v1::Datapoint;
+ * values of integer types narrower than 32 bit (incl. the unsigned ones) are set as int32.
+ */
+class GrpcDataPointSetter {
+public:
+    explicit GrpcDataPointSetter(sdv::databroker::v1::Datapoint& grpcDataPoint)
+        : m_grpcDataPoint(grpcDataPoint) {}
+
+    template <typename T> void operator()(const T& value) {
+        if constexpr (std::is_same_v<T, bool>) {
+            m_grpcDataPoint.set_bool_value(value);
+        } else if constexpr (std::is_same_v<T, float>) {
+            m_grpcDataPoint.set_float_value(value);
+        } else if constexpr (std::is_same_v<T, double>) {
+            m_grpcDataPoint.set_double_value(value);
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            m_grpcDataPoint.set_string_value(value);
+        } else if constexpr (sizeof(T) < sizeof(int32_t) || std::is_same_v<T, int32_t>) {
+            m_grpcDataPoint.set_int32_value(value);
+        } else if constexpr (std::is_same_v<T, int64_t>) {
+            m_grpcDataPoint.set_int64_value(value);
+        } else if constexpr (std::is_same_v<T, uint32_t>) {
+            m_grpcDataPoint.set_uint32_value(value);
+        } else {
+            m_grpcDataPoint.set_uint64_value(value);
+        }
+    }
+
+    template <typename T> void operator()(const std::vector<T>& values) {
+        if constexpr (std::is_same_v<T, bool>) {
+            assign(*m_grpcDataPoint.mutable_bool_array(), values);
+        } else if constexpr (std::is_same_v<T, float>) {
+            assign(*m_grpcDataPoint.mutable_float_array(), values);
+        } else if constexpr (std::is_same_v<T, double>) {
+            assign(*m_grpcDataPoint.mutable_double_array(), values);
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            assign(*m_grpcDataPoint.mutable_string_array(), values);
+        } else if constexpr (sizeof(T) < sizeof(int32_t) || std::is_same_v<T, int32_t>) {
+            assign(*m_grpcDataPoint.mutable_int32_array(), values);
+        } else if constexpr (std::is_same_v<T, int64_t>) {
+            assign(*m_grpcDataPoint.mutable_int64_array(), values);
+        } else if constexpr (std::is_same_v<T, uint32_t>) {
+            assign(*m_grpcDataPoint.mutable_uint32_array(), values);
+        } else {
+            assign(*m_grpcDataPoint.mutable_uint64_array(), values);
+        }
+    }
+
+private:
+    // the elements are read from the data point directly, without copying the vector first
+    template <typename TArray, typename T>
+    static void assign(TArray& grpcArray, const std::vector<T>& values) {
+        auto& grpcValues = *grpcArray.mutable_values();
+        if constexpr (std::is_integral_v<T> && sizeof(T) < sizeof(int32_t) &&
+                      !std::is_same_v<T, bool>) {
+            // converted by the vectorized kernels directly into the (only reserved) array; the
+            // unsigned ones are zero extended into the int32 array via its unsigned view
+            const auto count = static_cast<int>(values.size());
+            grpcValues.Clear();
+            grpcValues.Reserve(count);
+            auto* dst = grpcValues.AddNAlreadyReserved(count);
+            if constexpr (std::is_signed_v<T>) {
+                widenIntegers(values.data(), values.size(), dst);
+            } else {
+                widenIntegers(values.data(), values.size(), reinterpret_cast<uint32_t*>(dst));
+            }
+        } else {
+            grpcValues.Assign(values.cbegin(), values.cend());
+        }
+    }
+
+    sdv::databroker::v1::Datapoint& m_grpcDataPoint;
+};
+
+void convertToGrpcDataPoint(const DataPointValue&           dataPoint,
+                            sdv::databroker::v1::Datapoint& grpcDataPoint) {
+    visitDataPointValue(dataPoint, GrpcDataPointSetter(grpcDataPoint));
+}
+
+template <typename T, typename TArray> std::vector<T> convertValueArray(const TArray& arrayObject) {
+    const auto& valueArray = arrayObject.values();
+    return std::vector<T>{valueArray.cbegin(), valueArray.cend()};
+}
+
+template <typename TArray> std::vector<std::string> moveStringArray(TArray& arrayObject) {
+    auto& valueArray = *arrayObject.mutable_values();
+    return {std::make_move_iterator(valueArray.begin()), std::make_move_iterator(valueArray.end())};
+}
+
+DataPointValue::Failure convertFromGrpcFailure(sdv::databroker::v1::Datapoint_Failure failure) {
+    switch (failure) {
+    case sdv::databroker::v1::Datapoint_Failure_INVALID_VALUE:
+        return DataPointValue::Failure::INVALID_VALUE;
+    case sdv::databroker::v1::Datapoint_Failure_NOT_AVAILABLE:
+        return DataPointValue::Failure::NOT_AVAILABLE;
+    case sdv::databroker::v1::Datapoint_Failure_UNKNOWN_DATAPOINT:
+        return DataPointValue::Failure::UNKNOWN_DATAPOINT;
+    case sdv::databroker::v1::Datapoint_Failure_ACCESS_DENIED:
+        return DataPointValue::Failure::ACCESS_DENIED;
+    case sdv::databroker::v1::Datapoint_Failure_INTERNAL_ERROR:
+        return DataPointValue::Failure::INTERNAL_ERROR;
+    default:
+        logger().error("Unknown 'DataPointValue::Failure': {}", static_cast<int>(failure));
+        assert(false);
+        return DataPointValue::Failure::INTERNAL_ERROR;
+    }
+}
+
+} // namespace
+
+void convertToGrpcDataPoint(const DataPointValue&           dataPoint,
+                            sdv::databroker::v1::Datapoint& grpcDataPoint) {
+    visitDataPointValue(dataPoint, GrpcDataPointSetter(grpcDataPoint));
+}
+
+DataPointSample
+convertFromGrpcDataPointToSample(const sdv::databroker::v1::Datapoint& grpcDataPoint) {
+    const auto timestamp = convertFromGrpcTimestamp(grpcDataPoint.timestamp());
+    switch (grpcDataPoint.value_case()) {
+    case sdv::databroker::v1::Datapoint::ValueCase::kFailureValue:
+        return DataPointSample(DataPointValue::Type::INVALID,
+                               convertFromGrpcFailure(grpcDataPoint.failure_value()), timestamp);
+    case sdv::databroker::v1::Datapoint::ValueCase::kStringValue:
+        return DataPointSample(grpcDataPoint.string_value(), timestamp);
+    case sdv::databroker::v1::Datapoint::ValueCase::kBoolValue:
+        return DataPointSample(grpcDataPoint.bool_value(), timestamp);
+    case sdv::databroker::v1::Datapoint::ValueCase::kInt32Value:
+        return DataPointSample(grpcDataPoint.int32_value(), timestamp);
+    case sdv::databroker::v1::Datapoint::ValueCase::kInt64Value:
+        return DataPointSample(grpcDataPoint.int64_value(), timestamp);
+    case sdv::databroker::v1::Datapoint::ValueCase::kUint32Value:
+        return DataPointSample(grpcDataPoint.uint32_value(), timestamp);
+    case sdv::databroker::v1::Datapoint::ValueCase::kUint64Value:
+        return DataPointSample(grpcDataPoint.uint64_value(), timestamp);
+    case sdv::databroker::v1::Datapoint::ValueCase::kFloatValue:
+        return DataPointSample(grpcDataPoint.float_value(), timestamp);
+    case sdv::databroker::v1::Datapoint::ValueCase::kDoubleValue:
+        return DataPointSample(grpcDataPoint.double_value(), timestamp);
+    case sdv::databroker::v1::Datapoint::ValueCase::kStringArray:
+        return DataPointSample(convertValueArray<std::string>(grpcDataPoint.string_array()),
+                               timestamp);
+    case sdv::databroker::v1::Datapoint::ValueCase::kBoolArray:
+        return DataPointSample(convertValueArray<bool>(grpcDataPoint.bool_array()), timestamp);
+    case sdv::databroker::v1::Datapoint::ValueCase::kInt32Array:
+        return DataPointSample(convertValueArray<int32_t>(grpcDataPoint.int32_array()), timestamp);
+    case sdv::databroker::v1::Datapoint::ValueCase::kInt64Array:
+        return DataPointSample(convertValueArray<int64_t>(grpcDataPoint.int64_array()), timestamp);
+    case sdv::databroker::v1::Datapoint::ValueCase::kUint32Array:
+        return DataPointSample(convertValueArray<uint32_t>(grpcDataPoint.uint32_array()),
+                               timestamp);
+    case sdv::databroker::v1::Datapoint::ValueCase::kUint64Array:
+        return DataPointSample(convertValueArray<uint64_t>(grpcDataPoint.uint64_array()),
+                               timestamp);
+    case sdv::databroker::v1::Datapoint::ValueCase::kFloatArray:
+        return DataPointSample(convertValueArray<float>(grpcDataPoint.float_array()), timestamp);
+    case sdv::databroker::v1::Datapoint::ValueCase::kDoubleArray:
+        return DataPointSample(convertValueArray<double>(grpcDataPoint.double_array()), timestamp);
+    default:
+        throw RpcException("Unknown value case!");
+    }
+}
+
+DataPointSample convertFromGrpcDataPointToSample(sdv::databroker::v1::Datapoint&& grpcDataPoint) {
+    switch (grpcDataPoint.value_case()) {
+    case sdv::databroker::v1::Datapoint::ValueCase::kStringValue:
+        return DataPointSample(std::move(*grpcDataPoint.mutable_string_value()),
+                               convertFromGrpcTimestamp(grpcDataPoint.timestamp()));
+    case sdv::databroker::v1::Datapoint::ValueCase::kStringArray:
+        return DataPointSample(moveStringArray(*grpcDataPoint.mutable_string_array()),
+                               convertFromGrpcTimestamp(grpcDataPoint.timestamp()));
+    default:
+        // all other payloads are trivially copyable, i.e. copied in one go
+        return convertFromGrpcDataPointToSample(std::as_const(grpcDataPoint));
+    }
+}
+
+std::shared_ptr<DataPointValue>
+convertFromGrpcDataPoint(const std::string&                    path,
+                         const sdv::databroker::v1::Datapoint& grpcDataPoint) {
+    return convertFromGrpcDataPointToSample(grpcDataPoint).toDataPointValue(path);
+}
+
+} // namespace velocitas::sdv_databroker_v1
@@ -0,0 +1,66 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/AsyncResult.h"
+#include "sdk/DataPointReply.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+
+using namespace velocitas;
+
+namespace {
+
+void BM_AsyncSubscription_insertNewItemAndNext(benchmark::State& state) {
+    AsyncSubscription<int> subscription;
+    for (auto _ : state) {
+        subscription.insertNewItem(1);
+        benchmark::DoNotOptimize(subscription.next());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AsyncSubscription_insertNewItemAndNext);
+
+void BM_AsyncSubscription_insertBurstThenNext(benchmark::State& state) {
+    const auto             burstSize = static_cast<size_t>(state.range(0));
+    AsyncSubscription<int> subscription(burstSize);
+    for (auto _ : state) {
+        for (size_t i = 0; i < burstSize; ++i) {
+            subscription.insertNewItem(static_cast<int>(i));
+        }
+        for (size_t i = 0; i < burstSize; ++i) {
+            benchmark::DoNotOptimize(subscription.next());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AsyncSubscription_insertBurstThenNext)->Arg(16)->Arg(256);
+
+void BM_AsyncSubscription_insertReplyAndNext(benchmark::State& state) {
+    AsyncSubscription<DataPointReply> subscription;
+    for (auto _ : state) {
+        DataPointReply reply;
+        reply.set("Vehicle.Speed", std::make_shared<TypedDataPointValue<float>>("Vehicle.Speed",
+                                                                                 42.0F));
+        subscription.insertNewItem(std::move(reply));
+        benchmark::DoNotOptimize(subscription.next());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AsyncSubscription_insertReplyAndNext);
+
+} // namespace
@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/DataPointReply.h"
+
+#include "Vehicle.h"
+
+#include <benchmark/benchmark.h>
+
+#include <iterator>
+#include <memory>
+
+using namespace velocitas;
+
+namespace {
+
+void BM_DataPointReply_construct(benchmark::State& state) {
+    Vehicle    vehicle;
+    const auto handle = vehicle.Speed.getSignalHandle();
+    for (auto _ : state) {
+        DataPointReply reply;
+        reply.set(handle, std::make_shared<TypedDataPointValue<float>>(vehicle.Speed.getPath(),
+                                                                        42.0F));
+        benchmark::DoNotOptimize(reply);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DataPointReply_construct);
+
+void BM_DataPointReply_constructFromSamples(benchmark::State& state) {
+    Vehicle              vehicle;
+    const SignalHandle_t handles[] = {
+        vehicle.Speed.getSignalHandle(),
+        vehicle.Cabin.Seat.Row1.DriverSide.Position.getSignalHandle(),
+        vehicle.Cabin.Seat.Row1.Middle.Position.getSignalHandle(),
+        vehicle.Cabin.Seat.Row1.PassengerSide.Position.getSignalHandle(),
+    };
+    for (auto _ : state) {
+        DataPointReply reply;
+        reply.reserve(std::size(handles));
+        for (const auto handle : handles) {
+            reply.set(handle, DataPointSample{42U, Timestamp{}});
+        }
+        benchmark::DoNotOptimize(reply);
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(handles));
+}
+BENCHMARK(BM_DataPointReply_constructFromSamples);
+
+void BM_DataPointReply_get(benchmark::State& state) {
+    Vehicle        vehicle;
+    DataPointReply reply;
+    reply.set(vehicle.Speed.getSignalHandle(),
+              std::make_shared<TypedDataPointValue<float>>(vehicle.Speed.getPath(), 42.0F));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(reply.get(vehicle.Speed)->value());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DataPointReply_get);
+
+void BM_DataPointReply_getSample(benchmark::State& state) {
+    Vehicle        vehicle;
+    DataPointReply reply;
+    reply.set(vehicle.Speed.getSignalHandle(), DataPointSample{42.0F, Timestamp{}});
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(reply.getSample(vehicle.Speed.getSignalHandle()));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DataPointReply_getSample);
+
+} // namespace
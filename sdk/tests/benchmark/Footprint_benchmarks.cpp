@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/AllocationTracker.h"
+#include "sdk/AsyncResult.h"
+#include "sdk/BuildProfile.h"
+#include "sdk/DataPointReply.h"
+#include "sdk/Job.h"
+#include "sdk/SignalPathRegistry.h"
+
+#include <benchmark/benchmark.h>
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Footprint of the SDK structures of an app, to be compared between the build profiles (configure
+// with -DSDK_PROFILE=embedded or default). Each benchmark reports the growth of the resident set
+// size and, if allocation tracking is enabled, of the heap held by the SDK subsystems and the
+// number of allocations done for the structures.
+
+using namespace velocitas;
+
+namespace {
+
+double getResidentBytes() {
+    std::ifstream statm("/proc/self/statm");
+    uint64_t      numPages{0};
+    uint64_t      numResidentPages{0};
+    statm >> numPages >> numResidentPages;
+    return static_cast<double>(numResidentPages) * static_cast<double>(sysconf(_SC_PAGESIZE));
+}
+
+uint64_t getNumAllocations() {
+    uint64_t numAllocations = 0;
+    for (size_t i = 0; i < NUM_ALLOCATION_DOMAINS; ++i) {
+        numAllocations +=
+            AllocationTracker::getStatistics(static_cast<AllocationDomain>(i)).numAllocations;
+    }
+    return numAllocations;
+}
+
+class FootprintCounters {
+public:
+    FootprintCounters()
+        : m_residentBytes(getResidentBytes())
+        , m_heldBytes(AllocationTracker::getTotalHeldBytes())
+        , m_numAllocations(getNumAllocations()) {}
+
+    void report(benchmark::State& state) const {
+        state.counters["rss_bytes"] = getResidentBytes() - m_residentBytes;
+        state.counters["sdk_held_bytes"] =
+            static_cast<double>(AllocationTracker::getTotalHeldBytes() - m_heldBytes);
+        state.counters["sdk_allocations"] =
+            static_cast<double>(getNumAllocations() - m_numAllocations);
+        state.SetLabel(BUILD_PROFILE_NAME);
+    }
+
+private:
+    double   m_residentBytes;
+    uint64_t m_heldBytes;
+    uint64_t m_numAllocations;
+};
+
+// subscriptions with the default buffer capacity, each one holding a full buffer of replies
+void BM_Footprint_subscriptionsWithFullBuffers(benchmark::State& state) {
+    const auto numSubscriptions = static_cast<size_t>(state.range(0));
+    const auto speed = SignalPathRegistry::getInstance().intern("Vehicle.Speed");
+    for (auto _ : state) {
+        const FootprintCounters                             counters;
+        std::vector<AsyncSubscriptionPtr_t<DataPointReply>> subscriptions;
+        subscriptions.reserve(numSubscriptions);
+        for (size_t i = 0; i < numSubscriptions; ++i) {
+            auto subscription = std::make_shared<AsyncSubscription<DataPointReply>>();
+            for (size_t item = 0; item < AsyncSubscription<int>::DEFAULT_BUFFER_CAPACITY; ++item) {
+                DataPointReply reply;
+                reply.set(speed, DataPointSample(static_cast<float>(item), Timestamp{}));
+                subscription->insertNewItem(std::move(reply));
+            }
+            subscriptions.push_back(std::move(subscription));
+        }
+        counters.report(state);
+        benchmark::DoNotOptimize(subscriptions.data());
+    }
+}
+BENCHMARK(BM_Footprint_subscriptionsWithFullBuffers)->Arg(1)->Arg(16)->Arg(128)->Iterations(1);
+
+// jobs existing at once, e.g. queued behind a busy worker
+void BM_Footprint_pendingJobs(benchmark::State& state) {
+    const auto numJobs = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        const FootprintCounters counters;
+        std::vector<JobPtr_t>   jobs;
+        jobs.reserve(numJobs);
+        for (size_t i = 0; i < numJobs; ++i) {
+            jobs.push_back(LightJob::create([]() {}));
+        }
+        counters.report(state);
+        state.counters["job_pool_size"] = static_cast<double>(LightJob::getPoolSize());
+        benchmark::DoNotOptimize(jobs.data());
+    }
+}
+BENCHMARK(BM_Footprint_pendingJobs)->Arg(16)->Arg(256)->Arg(4096)->Iterations(1);
+
+} // namespace
@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/Metrics.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+using namespace velocitas;
+
+namespace {
+
+void BM_Metrics_counterIncrement(benchmark::State& state) {
+    static auto& counter =
+        MetricsRegistry::getInstance().getCounter("bench_events_total", "Benchmark events");
+    for (auto _ : state) {
+        counter.increment();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Metrics_counterIncrement)->ThreadRange(1, 8)->UseRealTime();
+
+void BM_Metrics_gaugeAdd(benchmark::State& state) {
+    static auto& gauge = MetricsRegistry::getInstance().getGauge("bench_level", "Benchmark level");
+    for (auto _ : state) {
+        gauge.add(1);
+        gauge.add(-1);
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_Metrics_gaugeAdd)->ThreadRange(1, 8)->UseRealTime();
+
+void BM_Metrics_histogramRecord(benchmark::State& state) {
+    static auto& histogram = MetricsRegistry::getInstance().getHistogram(
+        "bench_latency_nanoseconds", "Benchmark latency");
+    uint64_t value = 1;
+    for (auto _ : state) {
+        histogram.record(value);
+        value = (value * 7) % 1'000'003;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Metrics_histogramRecord)->ThreadRange(1, 8)->UseRealTime();
+
+void BM_Metrics_collectAndFormat(benchmark::State& state) {
+    MetricsRegistry registry;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        registry.getCounter("bench_calls_total", "Benchmark calls", {{"rpc", std::to_string(i)}})
+            .increment();
+        registry.getHistogram("bench_call_duration", "Benchmark call duration",
+                              {{"rpc", std::to_string(i)}})
+            .record(static_cast<uint64_t>(i) * 1000);
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(toPrometheusText(registry.collect()));
+    }
+}
+BENCHMARK(BM_Metrics_collectAndFormat)->Arg(10)->Arg(100);
+
+} // namespace
@@ -0,0 +1,43 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/Node.h"
+
+#include "Vehicle.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace velocitas;
+
+namespace {
+
+void BM_Node_getPath_root(benchmark::State& state) {
+    Vehicle vehicle;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vehicle.Speed.getPath());
+    }
+}
+BENCHMARK(BM_Node_getPath_root);
+
+void BM_Node_getPath_nested(benchmark::State& state) {
+    Vehicle     vehicle;
+    const auto& position = vehicle.Cabin.Seat.Row2.PassengerSide.Position;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(position.getPath());
+    }
+}
+BENCHMARK(BM_Node_getPath_nested);
+
+} // namespace
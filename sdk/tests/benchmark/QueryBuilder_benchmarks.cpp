@@ -0,0 +1,48 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/QueryBuilder.h"
+
+#include "Vehicle.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace velocitas;
+
+namespace {
+
+void BM_QueryBuilder_build_select(benchmark::State& state) {
+    Vehicle vehicle;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(QueryBuilder::select(vehicle.Speed).build());
+    }
+}
+BENCHMARK(BM_QueryBuilder_build_select);
+
+void BM_QueryBuilder_build_selectMultipleWhere(benchmark::State& state) {
+    Vehicle vehicle;
+    auto&   row = vehicle.Cabin.Seat.Row1;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(QueryBuilder::select({vehicle.Speed, row.DriverSide.Position,
+                                                       row.Middle.Position,
+                                                       row.PassengerSide.Position})
+                                     .where(vehicle.Speed)
+                                     .gt(10.0F)
+                                     .build());
+    }
+}
+BENCHMARK(BM_QueryBuilder_build_selectMultipleWhere);
+
+} // namespace
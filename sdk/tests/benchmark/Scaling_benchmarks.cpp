@@ -0,0 +1,267 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+// Sweeps producer and consumer thread counts and job sizes over the concurrency hot spots of the
+// SDK. Run it pinned to different numbers of cores (e.g. via taskset) to see how they scale.
+//
+// Besides the throughput, each configuration reports latency percentiles in nanoseconds:
+//   latency_*  from handing over a job/item until it was processed,
+//   blocked_*  the time a producer spent in the call handing it over; as the calls themselves
+//              are short, this is dominated by waiting for the contended lock.
+
+#include "sdk/AsyncResult.h"
+#include "sdk/Histogram.h"
+#include "sdk/Job.h"
+#include "sdk/ThreadPool.h"
+#include "sdk/grpc/GrpcCall.h"
+#include "sdk/grpc/GrpcClient.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+// bounds the jobs/items in flight, so producers outpacing the consumers do not grow the queues
+// without limit, but measure the sustained rate of the consumers instead
+constexpr int64_t MAX_IN_FLIGHT = 1024;
+
+constexpr std::chrono::milliseconds CONSUMER_POLL_INTERVAL{10};
+
+int64_t nowNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// simulates a job of the passed size
+void spinFor(int64_t nanos) {
+    if (nanos <= 0) {
+        return;
+    }
+    const auto until = nowNanos() + nanos;
+    while (nowNanos() < until) {
+    }
+}
+
+void recordSince(Histogram& histogram, int64_t startNanos) {
+    histogram.record(static_cast<uint64_t>(nowNanos() - startNanos));
+}
+
+void acquireInFlightSlot(std::atomic<int64_t>& numInFlight) {
+    while (numInFlight.fetch_add(1) >= MAX_IN_FLIGHT) {
+        --numInFlight;
+        std::this_thread::yield();
+    }
+}
+
+void waitUntilNoneInFlight(const std::atomic<int64_t>& numInFlight) {
+    while (numInFlight.load() > 0) {
+        std::this_thread::yield();
+    }
+}
+
+// counters are summed up over all benchmark threads, so they are set by a single one
+void reportPercentiles(benchmark::State& state, const std::string& name,
+                       const HistogramSnapshot& snapshot) {
+    state.counters[name + "_p50"] = static_cast<double>(snapshot.getPercentile(50.0));
+    state.counters[name + "_p99"] = static_cast<double>(snapshot.getPercentile(99.0));
+}
+
+struct PoolScenario {
+    PoolScenario(size_t numWorkers, SchedulingMode schedulingMode)
+        : m_pool(numWorkers, schedulingMode) {}
+
+    ThreadPool           m_pool;
+    Histogram            m_latency;
+    Histogram            m_blocked;
+    std::atomic<int64_t> m_numInFlight{0};
+};
+
+// shared by the benchmark threads (the producers) of a run
+std::unique_ptr<PoolScenario> poolScenario;
+
+void setUpPoolScenario(const benchmark::State& state) {
+    poolScenario = std::make_unique<PoolScenario>(static_cast<size_t>(state.range(1)),
+                                                  static_cast<SchedulingMode>(state.range(0)));
+}
+
+void tearDownPoolScenario(const benchmark::State& /*state*/) { poolScenario.reset(); }
+
+void BM_Scaling_ThreadPool_enqueue(benchmark::State& state) {
+    auto&      scenario = *poolScenario;
+    const auto jobNanos = state.range(2);
+    for (auto _ : state) {
+        acquireInFlightSlot(scenario.m_numInFlight);
+        const auto enqueuedAt = nowNanos();
+        scenario.m_pool.enqueue(Job::create([&scenario, enqueuedAt, jobNanos]() {
+            spinFor(jobNanos);
+            recordSince(scenario.m_latency, enqueuedAt);
+            --scenario.m_numInFlight;
+        }));
+        recordSince(scenario.m_blocked, enqueuedAt);
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0) {
+        waitUntilNoneInFlight(scenario.m_numInFlight);
+        const auto metrics = scenario.m_pool.getMetrics();
+        reportPercentiles(state, "latency", scenario.m_latency.getSnapshot());
+        reportPercentiles(state, "blocked", scenario.m_blocked.getSnapshot());
+        reportPercentiles(state, "scheduling", metrics.schedulingLatency);
+        state.counters["peak_queue_depth"] = static_cast<double>(metrics.peakQueueDepth);
+    }
+}
+BENCHMARK(BM_Scaling_ThreadPool_enqueue)
+    ->ArgsProduct({{static_cast<int64_t>(SchedulingMode::SHARED_QUEUE),
+                    static_cast<int64_t>(SchedulingMode::WORK_STEALING)},
+                   {1, 2, 4, 8},
+                   {0, 1000, 10000}})
+    ->ArgNames({"mode", "workers", "job_ns"})
+    ->ThreadRange(1, 8)
+    ->Setup(setUpPoolScenario)
+    ->Teardown(tearDownPoolScenario)
+    ->UseRealTime();
+
+struct SubscriptionScenario {
+    // never full, as there are no more items in flight than it can buffer
+    AsyncSubscription<int64_t> m_subscription{MAX_IN_FLIGHT};
+    Histogram                  m_latency;
+    Histogram                  m_blocked;
+    std::atomic<int64_t>       m_numInFlight{0};
+    std::atomic_bool           m_isStopping{false};
+    std::vector<std::thread>   m_consumers;
+};
+
+std::unique_ptr<SubscriptionScenario> subscriptionScenario;
+
+void consumeItems(SubscriptionScenario& scenario, int64_t itemNanos) {
+    while (!scenario.m_isStopping) {
+        const auto insertedAt = scenario.m_subscription.nextFor(CONSUMER_POLL_INTERVAL);
+        if (insertedAt) {
+            spinFor(itemNanos);
+            recordSince(scenario.m_latency, *insertedAt);
+            --scenario.m_numInFlight;
+        }
+    }
+}
+
+void setUpSubscriptionScenario(const benchmark::State& state) {
+    subscriptionScenario = std::make_unique<SubscriptionScenario>();
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        subscriptionScenario->m_consumers.emplace_back(
+            [scenario = subscriptionScenario.get(), itemNanos = state.range(1)]() {
+                consumeItems(*scenario, itemNanos);
+            });
+    }
+}
+
+void tearDownSubscriptionScenario(const benchmark::State& /*state*/) {
+    subscriptionScenario->m_isStopping = true;
+    for (auto& consumer : subscriptionScenario->m_consumers) {
+        consumer.join();
+    }
+    subscriptionScenario.reset();
+}
+
+void BM_Scaling_AsyncSubscription_buffer(benchmark::State& state) {
+    auto& scenario = *subscriptionScenario;
+    for (auto _ : state) {
+        acquireInFlightSlot(scenario.m_numInFlight);
+        const auto insertedAt = nowNanos();
+        scenario.m_subscription.insertNewItem(int64_t{insertedAt});
+        recordSince(scenario.m_blocked, insertedAt);
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0) {
+        waitUntilNoneInFlight(scenario.m_numInFlight);
+        reportPercentiles(state, "latency", scenario.m_latency.getSnapshot());
+        reportPercentiles(state, "blocked", scenario.m_blocked.getSnapshot());
+    }
+}
+BENCHMARK(BM_Scaling_AsyncSubscription_buffer)
+    ->ArgsProduct({{1, 2, 4}, {0, 1000}})
+    ->ArgNames({"consumers", "item_ns"})
+    ->ThreadRange(1, 8)
+    ->Setup(setUpSubscriptionScenario)
+    ->Teardown(tearDownSubscriptionScenario)
+    ->UseRealTime();
+
+struct CallScenario {
+    GrpcClient m_client;
+    Histogram  m_blocked;
+    Histogram  m_completion;
+};
+
+std::unique_ptr<CallScenario> callScenario;
+
+void setUpCallScenario(const benchmark::State& /*state*/) {
+    callScenario = std::make_unique<CallScenario>();
+}
+
+void tearDownCallScenario(const benchmark::State& /*state*/) { callScenario.reset(); }
+
+// each producer keeps the passed number of calls active, completing the oldest one per new call
+void BM_Scaling_GrpcClient_addActiveCall(benchmark::State& state) {
+    auto&                                 scenario = *callScenario;
+    const auto                            numCallsInFlight = static_cast<size_t>(state.range(0));
+    std::deque<std::shared_ptr<GrpcCall>> activeCalls;
+    for (auto _ : state) {
+        auto       call    = std::make_shared<GrpcCall>();
+        const auto addedAt = nowNanos();
+        scenario.m_client.addActiveCall(call);
+        recordSince(scenario.m_blocked, addedAt);
+        activeCalls.push_back(std::move(call));
+
+        if (activeCalls.size() > numCallsInFlight) {
+            const auto completedAt            = nowNanos();
+            activeCalls.front()->m_isComplete = true;
+            recordSince(scenario.m_completion, completedAt);
+            activeCalls.pop_front();
+        }
+    }
+    for (auto& call : activeCalls) {
+        call->m_isComplete = true;
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0) {
+        reportPercentiles(state, "blocked", scenario.m_blocked.getSnapshot());
+        reportPercentiles(state, "completion", scenario.m_completion.getSnapshot());
+    }
+}
+BENCHMARK(BM_Scaling_GrpcClient_addActiveCall)
+    ->ArgName("calls_in_flight")
+    ->Arg(1)
+    ->Arg(64)
+    ->Arg(1024)
+    ->ThreadRange(1, 8)
+    ->Setup(setUpCallScenario)
+    ->Teardown(tearDownCallScenario)
+    ->UseRealTime();
+
+} // namespace
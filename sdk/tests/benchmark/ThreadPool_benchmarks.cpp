@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/Job.h"
+#include "sdk/ThreadPool.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+// shared by all benchmark threads to create contention on the job queue
+ThreadPool& getPool() {
+    static ThreadPool pool;
+    return pool;
+}
+
+void waitForExecutedJobs(const std::atomic_int64_t& numExecutedJobs, int64_t numJobs) {
+    while (numExecutedJobs.load() < numJobs) {
+        std::this_thread::yield();
+    }
+}
+
+void BM_ThreadPool_enqueue(benchmark::State& state) {
+    std::atomic_int64_t numExecutedJobs{0};
+    for (auto _ : state) {
+        getPool().enqueue(Job::create([&numExecutedJobs]() { ++numExecutedJobs; }));
+    }
+    waitForExecutedJobs(numExecutedJobs, static_cast<int64_t>(state.iterations()));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ThreadPool_enqueue)->ThreadRange(1, 8)->UseRealTime();
+
+void BM_ThreadPool_enqueueBatch(benchmark::State& state) {
+    const auto          batchSize = static_cast<size_t>(state.range(0));
+    std::atomic_int64_t numExecutedJobs{0};
+    for (auto _ : state) {
+        std::vector<JobPtr_t> jobs;
+        jobs.reserve(batchSize);
+        for (size_t i = 0; i < batchSize; ++i) {
+            jobs.push_back(Job::create([&numExecutedJobs]() { ++numExecutedJobs; }));
+        }
+        getPool().enqueueBatch(std::move(jobs));
+    }
+    waitForExecutedJobs(numExecutedJobs, static_cast<int64_t>(state.iterations()) *
+                                             static_cast<int64_t>(batchSize));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ThreadPool_enqueueBatch)->Arg(16)->ThreadRange(1, 8)->UseRealTime();
+
+void BM_ThreadPool_enqueueAndWait(benchmark::State& state) {
+    std::atomic_int64_t numExecutedJobs{0};
+    int64_t             numJobs{0};
+    for (auto _ : state) {
+        getPool().enqueue(Job::create([&numExecutedJobs]() { ++numExecutedJobs; }));
+        waitForExecutedJobs(numExecutedJobs, ++numJobs);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ThreadPool_enqueueAndWait)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "FakeDatabroker.h"
+#include "sdk/DataPointValue.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/BrokerClient.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+using namespace velocitas::kuksa_val_v2;
+
+namespace {
+
+constexpr auto SERVICE_NAME = "vehicledatabroker";
+
+// The fake broker answers on the gRPC threads without any processing worth mentioning, so the
+// measured time is the one spent by the SDK and the loopback transport.
+
+void BM_BrokerClient_getDatapoints(benchmark::State& state) {
+    FakeDatabroker broker(FakeDatabrokerConfig{{}, static_cast<size_t>(state.range(0))});
+    BrokerClient   client(broker.getAddress(), SERVICE_NAME);
+    const auto&    paths = broker.getSignalPaths();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(client.getDatapoints(paths)->await());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BrokerClient_getDatapoints)->Arg(1)->Arg(100)->Arg(1000)->UseRealTime();
+
+void BM_BrokerClient_setDatapoints(benchmark::State& state) {
+    FakeDatabroker broker(FakeDatabrokerConfig{{}, static_cast<size_t>(state.range(0))});
+    BrokerClient   client(broker.getAddress(), SERVICE_NAME);
+
+    std::vector<std::unique_ptr<DataPointValue>> datapoints;
+    for (const auto& path : broker.getSignalPaths()) {
+        datapoints.push_back(std::make_unique<TypedDataPointValue<float>>(path, 1.0F));
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(client.setDatapoints(datapoints)->await());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BrokerClient_setDatapoints)->Arg(1)->Arg(100)->Arg(1000)->UseRealTime();
+
+// Args: number of subscribed signals, number of signals per update
+void BM_BrokerClient_subscribe(benchmark::State& state) {
+    FakeDatabrokerConfig config;
+    config.m_numSignals       = static_cast<size_t>(state.range(0));
+    config.m_signalsPerUpdate = static_cast<size_t>(state.range(1));
+    config.m_updateInterval   = std::chrono::microseconds{0};
+    FakeDatabroker broker(config);
+    BrokerClient   client(broker.getAddress(), SERVICE_NAME);
+
+    std::string query = "SELECT ";
+    for (const auto& path : broker.getSignalPaths()) {
+        query += path + ",";
+    }
+    query.pop_back();
+
+    std::atomic<uint64_t> numUpdates{0};
+    auto                  subscription = client.subscribe(query);
+    subscription->onItem([&numUpdates](const DataPointReply& /*reply*/) {
+        numUpdates.fetch_add(1, std::memory_order_relaxed);
+    });
+
+    for (auto _ : state) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(numUpdates.load()));
+    state.counters["sent"] = static_cast<double>(broker.getNumSentUpdates());
+}
+BENCHMARK(BM_BrokerClient_subscribe)
+    ->Args({10, 1})
+    ->Args({1000, 1})
+    ->Args({1000, 100})
+    ->Args({1000, 0})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace
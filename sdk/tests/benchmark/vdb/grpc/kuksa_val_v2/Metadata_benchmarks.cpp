@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/vdb/grpc/kuksa_val_v2/Metadata.h"
+
+#include <benchmark/benchmark.h>
+
+#include <future>
+#include <memory>
+#include <string>
+
+using namespace velocitas;
+using namespace velocitas::kuksa_val_v2;
+
+namespace {
+
+constexpr numeric_id_t FIRST_NUMERIC_ID = 1000;
+
+// The agent gets the metadata of each queried signal below Bench.Meta
+// with the numeric id FIRST_NUMERIC_ID + <index of the signal>.
+std::shared_ptr<MetadataAgent> createPopulatedAgent(size_t numSignals) {
+    auto agent = MetadataAgent::create(
+        [](auto request, auto onResponse, auto /*onError*/) {
+            const auto& path  = request.root();
+            const auto  index = std::stoul(path.substr(path.rfind('.') + 1));
+
+            kuksa::val::v2::ListMetadataResponse response;
+            auto*                                metadata = response.add_metadata();
+            metadata->set_path(path);
+            metadata->set_id(static_cast<numeric_id_t>(FIRST_NUMERIC_ID + index));
+            onResponse(response);
+        },
+        MetadataAgentConfig{});
+
+    SignalPathList_t signalPaths;
+    for (size_t i = 0; i < numSignals; ++i) {
+        signalPaths.push_back("Bench.Meta." + std::to_string(i));
+    }
+    std::promise<void> isPopulated;
+    agent->query(
+        signalPaths, [&isPopulated](MetadataList_t&&) { isPopulated.set_value(); },
+        [&isPopulated](const grpc::Status&) { isPopulated.set_value(); });
+    isPopulated.get_future().wait();
+    return agent;
+}
+
+void BM_MetadataAgent_getByNumericId(benchmark::State& state) {
+    const auto numSignals = static_cast<size_t>(state.range(0));
+    const auto agent      = createPopulatedAgent(numSignals);
+
+    size_t index{0};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            agent->getByNumericId(static_cast<numeric_id_t>(FIRST_NUMERIC_ID + index)));
+        index = (index + 1) % numSignals;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MetadataAgent_getByNumericId)->Arg(16)->Arg(1024);
+
+void BM_MetadataAgent_getByNumericId_contended(benchmark::State& state) {
+    static std::shared_ptr<MetadataAgent> agent;
+    if (state.thread_index() == 0) {
+        agent = createPopulatedAgent(1024);
+    }
+    // the library synchronizes all threads before entering the measured loop
+    size_t index{static_cast<size_t>(state.thread_index())};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            agent->getByNumericId(static_cast<numeric_id_t>(FIRST_NUMERIC_ID + index)));
+        index = (index + 1) % 1024;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MetadataAgent_getByNumericId_contended)->ThreadRange(1, 8)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/vdb/grpc/kuksa_val_v2/TypeConversions.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+template <typename T> T createValue();
+template <> bool        createValue() { return true; }
+template <> int32_t     createValue() { return -42; }
+template <> int64_t     createValue() { return -4200000000; }
+template <> uint32_t    createValue() { return 42U; }
+template <> float       createValue() { return 42.5F; }
+template <> double      createValue() { return 42.5; }
+template <> std::string createValue() { return "Vehicle.Cabin.Infotainment.Media.Played.Track"; }
+template <> std::vector<float> createValue() { return std::vector<float>(16, 42.5F); }
+
+template <typename T> void BM_TypeConversion_convertToGrpcValue(benchmark::State& state) {
+    const TypedDataPointValue<T> dataPoint("Vehicle.Speed", createValue<T>());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(kuksa_val_v2::convertToGrpcValue(dataPoint));
+    }
+}
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertToGrpcValue, bool);
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertToGrpcValue, int32_t);
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertToGrpcValue, int64_t);
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertToGrpcValue, uint32_t);
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertToGrpcValue, float);
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertToGrpcValue, double);
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertToGrpcValue, std::string);
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertToGrpcValue, std::vector<float>);
+
+template <typename T> void BM_TypeConversion_convertToGrpcValueReused(benchmark::State& state) {
+    const TypedDataPointValue<T> dataPoint("Vehicle.Speed", createValue<T>());
+    kuksa::val::v2::Value        grpcValue;
+    for (auto _ : state) {
+        kuksa_val_v2::convertToGrpcValue(dataPoint, grpcValue);
+        benchmark::DoNotOptimize(grpcValue);
+    }
+}
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertToGrpcValueReused, float);
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertToGrpcValueReused, std::string);
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertToGrpcValueReused, std::vector<float>);
+
+template <typename T> void BM_TypeConversion_convertFromGrpcValue(benchmark::State& state) {
+    const std::string           path{"Vehicle.Speed"};
+    const kuksa::val::v2::Value grpcValue =
+        kuksa_val_v2::convertToGrpcValue(TypedDataPointValue<T>(path, createValue<T>()));
+    const Timestamp timestamp{42, 0};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(kuksa_val_v2::convertFromGrpcValue(path, grpcValue, timestamp));
+    }
+}
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertFromGrpcValue, bool);
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertFromGrpcValue, int32_t);
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertFromGrpcValue, int64_t);
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertFromGrpcValue, uint32_t);
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertFromGrpcValue, float);
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertFromGrpcValue, double);
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertFromGrpcValue, std::string);
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertFromGrpcValue, std::vector<float>);
+
+template <typename T>
+void BM_TypeConversion_convertFromGrpcValueToSample(benchmark::State& state) {
+    const kuksa::val::v2::Value grpcValue =
+        kuksa_val_v2::convertToGrpcValue(TypedDataPointValue<T>("Vehicle.Speed", createValue<T>()));
+    const Timestamp timestamp{42, 0};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(kuksa_val_v2::convertFromGrpcValueToSample(grpcValue, timestamp));
+    }
+}
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertFromGrpcValueToSample, float);
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertFromGrpcValueToSample, std::string);
+BENCHMARK_TEMPLATE(BM_TypeConversion_convertFromGrpcValueToSample, std::vector<float>);
+
+void BM_TypeConversion_parseQuery(benchmark::State& state) {
+    const std::string query{"SELECT Vehicle.Speed, Vehicle.Cabin.Seat.Row1.DriverSide.Position, "
+                            "Vehicle.Cabin.Seat.Row1.PassengerSide.Position"};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(kuksa_val_v2::parseQuery(query));
+    }
+}
+BENCHMARK(BM_TypeConversion_parseQuery);
+
+} // namespace
@@ -0,0 +1,504 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "FakeDatabroker.h"
+
+#include "kuksa/val/v2/val.grpc.pb.h"
+
+#include <fmt/format.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+namespace velocitas::kuksa_val_v2 {
+
+namespace {
+
+void setToNow(google::protobuf::Timestamp& timestamp) {
+    const auto sinceEpoch = std::chrono::system_clock::now().time_since_epoch();
+    const auto seconds    = std::chrono::duration_cast<std::chrono::seconds>(sinceEpoch);
+    timestamp.set_seconds(seconds.count());
+    timestamp.set_nanos(static_cast<int32_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(sinceEpoch - seconds).count()));
+}
+
+void setDatapoint(kuksa::val::v2::Datapoint& datapoint, float value) {
+    setToNow(*datapoint.mutable_timestamp());
+    datapoint.mutable_value()->set_float_(value);
+}
+
+std::vector<std::string> getServedSignalPaths(const FakeDatabrokerConfig& config) {
+    if (!config.m_signalPaths.empty()) {
+        return config.m_signalPaths;
+    }
+    std::vector<std::string> signalPaths;
+    signalPaths.reserve(config.m_numSignals);
+    for (size_t i = 0; i < config.m_numSignals; ++i) {
+        signalPaths.push_back(FakeDatabroker::getGeneratedSignalPath(i));
+    }
+    return signalPaths;
+}
+
+} // namespace
+
+class FakeDatabroker::Service final : public kuksa::val::v2::VAL::CallbackService {
+public:
+    explicit Service(FakeDatabrokerConfig config);
+    ~Service() override;
+
+    /**
+     * @brief Stop sending updates; to be called before shutting down the server.
+     */
+    void stopUpdates();
+
+    grpc::ServerUnaryReactor* GetValues(grpc::CallbackServerContext*            context,
+                                        const kuksa::val::v2::GetValuesRequest* request,
+                                        kuksa::val::v2::GetValuesResponse*      response) override;
+
+    grpc::ServerWriteReactor<kuksa::val::v2::SubscribeByIdResponse>*
+    SubscribeById(grpc::CallbackServerContext*                context,
+                  const kuksa::val::v2::SubscribeByIdRequest* request) override;
+
+    grpc::ServerUnaryReactor*
+    BatchActuate(grpc::CallbackServerContext*               context,
+                 const kuksa::val::v2::BatchActuateRequest* request,
+                 kuksa::val::v2::BatchActuateResponse*      response) override;
+
+    grpc::ServerUnaryReactor*
+    ListMetadata(grpc::CallbackServerContext*               context,
+                 const kuksa::val::v2::ListMetadataRequest* request,
+                 kuksa::val::v2::ListMetadataResponse*      response) override;
+
+    grpc::ServerUnaryReactor*
+    GetServerInfo(grpc::CallbackServerContext*                context,
+                  const kuksa::val::v2::GetServerInfoRequest* request,
+                  kuksa::val::v2::GetServerInfoResponse*      response) override;
+
+    [[nodiscard]] const std::vector<std::string>& getSignalPaths() const { return m_signalPaths; }
+    [[nodiscard]] float                           getValue(const std::string& signalPath) const;
+
+    [[nodiscard]] uint64_t getNumGetValuesCalls() const { return m_numGetValuesCalls; }
+    [[nodiscard]] uint64_t getNumBatchActuateCalls() const { return m_numBatchActuateCalls; }
+    [[nodiscard]] uint64_t getNumActuationsByPath() const { return m_numActuationsByPath; }
+    [[nodiscard]] uint64_t getNumSentUpdates() const { return m_numSentUpdates; }
+    [[nodiscard]] size_t   getNumActiveSubscriptions() const;
+
+    Service(const Service&)            = delete;
+    Service(Service&&)                 = delete;
+    Service& operator=(const Service&) = delete;
+    Service& operator=(Service&&)      = delete;
+
+private:
+    class Subscription;
+
+    /**
+     * @brief Get the index of the identified signal in the signal table, if it is served.
+     */
+    [[nodiscard]] std::optional<size_t> find(const kuksa::val::v2::SignalID& signalId) const;
+    [[nodiscard]] std::optional<size_t> find(int32_t numericId) const;
+
+    void sendUpdates();
+
+    const FakeDatabrokerConfig     m_config;
+    const std::vector<std::string> m_signalPaths; // numeric id == index + 1
+    std::map<std::string, size_t>  m_indexByPath;
+
+    mutable std::mutex m_valuesMutex;
+    std::vector<float> m_values;
+
+    std::atomic<uint64_t> m_numGetValuesCalls{0};
+    std::atomic<uint64_t> m_numBatchActuateCalls{0};
+    std::atomic<uint64_t> m_numActuationsByPath{0};
+    std::atomic<uint64_t> m_numSentUpdates{0};
+
+    mutable std::mutex      m_subscriptionsMutex;
+    std::condition_variable m_updateCondition;
+    std::set<Subscription*> m_subscriptions;
+    bool                    m_isStopped{false};
+    std::thread             m_updateThread;
+};
+
+/**
+ * @brief A single SubscribeById stream; it deletes itself once the stream is done.
+ *
+ * At most one write is in flight at a time: if the client does not keep up, the updates due in
+ * the meantime are skipped instead of queued, like the databroker does.
+ */
+class FakeDatabroker::Service::Subscription final
+    : public grpc::ServerWriteReactor<kuksa::val::v2::SubscribeByIdResponse> {
+public:
+    Subscription(Service& service, std::vector<size_t> signalIndices)
+        : m_service{service}
+        , m_signalIndices{std::move(signalIndices)} {
+        m_isWriting = true;
+        writeUpdate(m_signalIndices.size(), false);
+    }
+
+    Subscription(Service& service, const grpc::Status& status)
+        : m_service{service} {
+        m_isFinished = true;
+        Finish(status);
+    }
+
+    /**
+     * @brief Send the next update unless the previous one is still being written.
+     */
+    void sendUpdateIfIdle() {
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_isWriting || m_isFinished) {
+                return;
+            }
+            m_isWriting = true;
+        }
+        writeNextUpdate();
+    }
+
+    void OnWriteDone(bool isOk) override {
+        bool isWritingNext{false};
+        bool isFinishing{false};
+        {
+            std::lock_guard lock(m_mutex);
+            m_isWriting = false;
+            if (!isOk || m_isCancelled) {
+                m_isFinished = true;
+                isFinishing  = true;
+            } else if (m_service.m_config.m_updateInterval.count() == 0) {
+                m_isWriting   = true;
+                isWritingNext = true;
+            }
+        }
+        if (isWritingNext) {
+            writeNextUpdate();
+        } else if (isFinishing) {
+            Finish(grpc::Status::CANCELLED);
+        }
+    }
+
+    void OnCancel() override {
+        {
+            std::lock_guard lock(m_mutex);
+            m_isCancelled = true;
+            if (m_isWriting || m_isFinished) {
+                return;
+            }
+            m_isFinished = true;
+        }
+        Finish(grpc::Status::CANCELLED);
+    }
+
+    void OnDone() override {
+        {
+            std::lock_guard lock(m_service.m_subscriptionsMutex);
+            m_service.m_subscriptions.erase(this);
+        }
+        delete this;
+    }
+
+private:
+    void writeNextUpdate() {
+        const auto width = m_service.m_config.m_signalsPerUpdate;
+        writeUpdate(width == 0 ? m_signalIndices.size() : std::min(width, m_signalIndices.size()),
+                    true);
+    }
+
+    /**
+     * @brief Write the values of the next numSignals subscribed signals, incrementing them
+     * before if requested; only to be called by the one having set m_isWriting.
+     */
+    void writeUpdate(size_t numSignals, bool isIncrementing) {
+        m_response.Clear();
+        auto& entries = *m_response.mutable_entries();
+        {
+            std::lock_guard lock(m_service.m_valuesMutex);
+            for (size_t i = 0; i < numSignals; ++i) {
+                const auto index = m_signalIndices[m_nextSignal];
+                m_nextSignal     = (m_nextSignal + 1) % m_signalIndices.size();
+                if (isIncrementing) {
+                    m_service.m_values[index] += 1.0F;
+                }
+                setDatapoint(entries[static_cast<int32_t>(index + 1)], m_service.m_values[index]);
+            }
+        }
+        m_service.m_numSentUpdates.fetch_add(1, std::memory_order_relaxed);
+        StartWrite(&m_response);
+    }
+
+    Service&                               m_service;
+    const std::vector<size_t>              m_signalIndices;
+    size_t                                 m_nextSignal{0};
+    kuksa::val::v2::SubscribeByIdResponse m_response;
+
+    std::mutex m_mutex;
+    bool       m_isWriting{false};
+    bool       m_isCancelled{false};
+    bool       m_isFinished{false};
+};
+
+FakeDatabroker::Service::Service(FakeDatabrokerConfig config)
+    : m_config{std::move(config)}
+    , m_signalPaths{getServedSignalPaths(m_config)}
+    , m_values(m_signalPaths.size(), 0.0F) {
+    for (size_t i = 0; i < m_signalPaths.size(); ++i) {
+        m_indexByPath[m_signalPaths[i]] = i;
+    }
+    if (m_config.m_updateInterval.count() > 0) {
+        m_updateThread = std::thread(&Service::sendUpdates, this);
+    }
+}
+
+FakeDatabroker::Service::~Service() { stopUpdates(); }
+
+void FakeDatabroker::Service::stopUpdates() {
+    {
+        std::lock_guard lock(m_subscriptionsMutex);
+        m_isStopped = true;
+    }
+    m_updateCondition.notify_all();
+    if (m_updateThread.joinable()) {
+        m_updateThread.join();
+    }
+}
+
+void FakeDatabroker::Service::sendUpdates() {
+    auto             nextUpdate = std::chrono::steady_clock::now();
+    std::unique_lock lock(m_subscriptionsMutex);
+    while (!m_isStopped) {
+        nextUpdate += m_config.m_updateInterval;
+        const auto now = std::chrono::steady_clock::now();
+        if (nextUpdate < now) {
+            nextUpdate = now; // fallen behind, do not try to catch up
+        }
+        m_updateCondition.wait_until(lock, nextUpdate, [this]() { return m_isStopped; });
+        if (m_isStopped) {
+            break;
+        }
+        // a subscription is removed only after the stream is finished, which never happens
+        // while one of its writes is in flight
+        for (auto* subscription : m_subscriptions) {
+            subscription->sendUpdateIfIdle();
+        }
+    }
+}
+
+std::optional<size_t> FakeDatabroker::Service::find(int32_t numericId) const {
+    if (numericId < 1 || static_cast<size_t>(numericId) > m_signalPaths.size()) {
+        return std::nullopt;
+    }
+    return static_cast<size_t>(numericId - 1);
+}
+
+std::optional<size_t> FakeDatabroker::Service::find(const kuksa::val::v2::SignalID& signalId) const {
+    if (signalId.has_id()) {
+        return find(signalId.id());
+    }
+    const auto iter = m_indexByPath.find(signalId.path());
+    if (iter == m_indexByPath.cend()) {
+        return std::nullopt;
+    }
+    return iter->second;
+}
+
+float FakeDatabroker::Service::getValue(const std::string& signalPath) const {
+    const auto index = m_indexByPath.at(signalPath);
+    std::lock_guard lock(m_valuesMutex);
+    return m_values[index];
+}
+
+size_t FakeDatabroker::Service::getNumActiveSubscriptions() const {
+    std::lock_guard lock(m_subscriptionsMutex);
+    return m_subscriptions.size();
+}
+
+grpc::ServerUnaryReactor*
+FakeDatabroker::Service::GetValues(grpc::CallbackServerContext*            context,
+                                   const kuksa::val::v2::GetValuesRequest* request,
+                                   kuksa::val::v2::GetValuesResponse*      response) {
+    m_numGetValuesCalls.fetch_add(1, std::memory_order_relaxed);
+    auto*           reactor = context->DefaultReactor();
+    std::lock_guard lock(m_valuesMutex);
+    for (const auto& signalId : request->signal_ids()) {
+        const auto index = find(signalId);
+        if (!index) {
+            reactor->Finish(grpc::Status(grpc::StatusCode::NOT_FOUND, "Signal not found"));
+            return reactor;
+        }
+        setDatapoint(*response->add_data_points(), m_values[*index]);
+    }
+    reactor->Finish(grpc::Status::OK);
+    return reactor;
+}
+
+grpc::ServerWriteReactor<kuksa::val::v2::SubscribeByIdResponse>*
+FakeDatabroker::Service::SubscribeById(grpc::CallbackServerContext* /*context*/,
+                                       const kuksa::val::v2::SubscribeByIdRequest* request) {
+    std::vector<size_t> signalIndices;
+    for (const auto numericId : request->signal_ids()) {
+        const auto index = find(numericId);
+        if (!index) {
+            return new Subscription(*this, grpc::Status(grpc::StatusCode::NOT_FOUND,
+                                                        "Signal not found"));
+        }
+        signalIndices.push_back(*index);
+    }
+    if (signalIndices.empty()) {
+        return new Subscription(
+            *this, grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "No signals subscribed"));
+    }
+
+    std::lock_guard lock(m_subscriptionsMutex);
+    auto*           subscription = new Subscription(*this, std::move(signalIndices));
+    m_subscriptions.insert(subscription);
+    return subscription;
+}
+
+grpc::ServerUnaryReactor*
+FakeDatabroker::Service::BatchActuate(grpc::CallbackServerContext*               context,
+                                      const kuksa::val::v2::BatchActuateRequest* request,
+                                      kuksa::val::v2::BatchActuateResponse* /*response*/) {
+    m_numBatchActuateCalls.fetch_add(1, std::memory_order_relaxed);
+    auto* reactor = context->DefaultReactor();
+
+    std::vector<std::pair<size_t, float>> actuations;
+    actuations.reserve(request->actuate_requests_size());
+    for (const auto& actuateRequest : request->actuate_requests()) {
+        if (actuateRequest.signal_id().has_path()) {
+            m_numActuationsByPath.fetch_add(1, std::memory_order_relaxed);
+        }
+        const auto index = find(actuateRequest.signal_id());
+        if (!index) {
+            reactor->Finish(grpc::Status(grpc::StatusCode::NOT_FOUND, "Signal not found"));
+            return reactor;
+        }
+        if (!actuateRequest.value().has_float_()) {
+            reactor->Finish(grpc::Status(
+                grpc::StatusCode::INVALID_ARGUMENT,
+                fmt::format("Signal {} is of type float", m_signalPaths[*index])));
+            return reactor;
+        }
+        actuations.emplace_back(*index, actuateRequest.value().float_());
+    }
+    {
+        std::lock_guard lock(m_valuesMutex);
+        for (const auto& [index, value] : actuations) {
+            m_values[index] = value;
+        }
+    }
+    reactor->Finish(grpc::Status::OK);
+    return reactor;
+}
+
+grpc::ServerUnaryReactor*
+FakeDatabroker::Service::ListMetadata(grpc::CallbackServerContext*               context,
+                                      const kuksa::val::v2::ListMetadataRequest* request,
+                                      kuksa::val::v2::ListMetadataResponse*      response) {
+    const auto& root = request->root();
+    for (size_t i = 0; i < m_signalPaths.size(); ++i) {
+        const auto& path = m_signalPaths[i];
+        if (path == root || (path.size() > root.size() && path.compare(0, root.size(), root) == 0 &&
+                             path[root.size()] == '.')) {
+            auto* metadata = response->add_metadata();
+            metadata->set_path(path);
+            metadata->set_id(static_cast<int32_t>(i + 1));
+            metadata->set_data_type(kuksa::val::v2::DATA_TYPE_FLOAT);
+            metadata->set_entry_type(kuksa::val::v2::ENTRY_TYPE_SENSOR);
+        }
+    }
+    auto* reactor = context->DefaultReactor();
+    reactor->Finish(response->metadata().empty()
+                        ? grpc::Status(grpc::StatusCode::NOT_FOUND, "No signal matches the root")
+                        : grpc::Status::OK);
+    return reactor;
+}
+
+grpc::ServerUnaryReactor*
+FakeDatabroker::Service::GetServerInfo(grpc::CallbackServerContext* context,
+                                       const kuksa::val::v2::GetServerInfoRequest* /*request*/,
+                                       kuksa::val::v2::GetServerInfoResponse* response) {
+    response->set_name("fake-databroker");
+    response->set_version("0.0.0");
+    auto* reactor = context->DefaultReactor();
+    reactor->Finish(grpc::Status::OK);
+    return reactor;
+}
+
+FakeDatabroker::FakeDatabroker(FakeDatabrokerConfig config)
+    : m_service{std::make_unique<Service>(std::move(config))} {
+    int                 port{0};
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+    builder.SetMaxReceiveMessageSize(-1);
+    builder.RegisterService(m_service.get());
+    m_server = builder.BuildAndStart();
+    if (!m_server || port == 0) {
+        throw std::runtime_error("Failed to start the fake databroker");
+    }
+    m_address = fmt::format("127.0.0.1:{}", port);
+}
+
+FakeDatabroker::~FakeDatabroker() {
+    m_service->stopUpdates();
+    // cancels the running subscriptions and waits for them to be done
+    m_server->Shutdown(std::chrono::system_clock::now());
+    m_server->Wait();
+}
+
+const std::string& FakeDatabroker::getAddress() const { return m_address; }
+
+std::shared_ptr<grpc::Channel> FakeDatabroker::createInProcessChannel() const {
+    grpc::ChannelArguments args;
+    args.SetMaxReceiveMessageSize(-1);
+    return m_server->InProcessChannel(args);
+}
+
+std::string FakeDatabroker::getGeneratedSignalPath(size_t index) {
+    return fmt::format("Vehicle.Fake.Signal{}", index);
+}
+
+const std::vector<std::string>& FakeDatabroker::getSignalPaths() const {
+    return m_service->getSignalPaths();
+}
+
+float FakeDatabroker::getValue(const std::string& signalPath) const {
+    return m_service->getValue(signalPath);
+}
+
+uint64_t FakeDatabroker::getNumGetValuesCalls() const { return m_service->getNumGetValuesCalls(); }
+
+uint64_t FakeDatabroker::getNumBatchActuateCalls() const {
+    return m_service->getNumBatchActuateCalls();
+}
+
+uint64_t FakeDatabroker::getNumActuationsByPath() const {
+    return m_service->getNumActuationsByPath();
+}
+
+uint64_t FakeDatabroker::getNumSentUpdates() const { return m_service->getNumSentUpdates(); }
+
+size_t FakeDatabroker::getNumActiveSubscriptions() const {
+    return m_service->getNumActiveSubscriptions();
+}
+
+} // namespace velocitas::kuksa_val_v2
@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VEHICLE_APP_SDK_FAKEDATABROKER_H
+#define VEHICLE_APP_SDK_FAKEDATABROKER_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace grpc {
+class Channel;
+class Server;
+} // namespace grpc
+
+namespace velocitas::kuksa_val_v2 {
+
+struct FakeDatabrokerConfig {
+    /** Paths of the served signals; if empty, m_numSignals generated signals are served */
+    std::vector<std::string> m_signalPaths;
+    size_t                   m_numSignals{100};
+
+    /** Interval between two updates sent on a subscription; zero sends as fast as possible */
+    std::chrono::microseconds m_updateInterval{std::chrono::milliseconds{1}};
+
+    /** Number of subscribed signals contained in each update; zero means all of them */
+    size_t m_signalsPerUpdate{0};
+};
+
+/**
+ * @brief In-process implementation of the kuksa.val.v2 VAL service, serving a table of float
+ * signals without any persistence or access control.
+ *
+ * Subscriptions get the current values of all subscribed signals first, then updates of
+ * m_signalsPerUpdate signals (cycling through the subscribed ones) every m_updateInterval,
+ * each update incrementing the values. Reads and actuations are answered right away on the
+ * gRPC threads, so the SDK's own overhead can be measured without a real databroker.
+ */
+class FakeDatabroker {
+public:
+    explicit FakeDatabroker(FakeDatabrokerConfig config = {});
+    ~FakeDatabroker();
+
+    /**
+     * @brief Get the loopback address the broker listens on, e.g. for a BrokerClient.
+     */
+    [[nodiscard]] const std::string& getAddress() const;
+
+    /**
+     * @brief Create a channel to the broker bypassing the network stack.
+     */
+    [[nodiscard]] std::shared_ptr<grpc::Channel> createInProcessChannel() const;
+
+    /**
+     * @brief Get the path of the generated signal at the passed index.
+     */
+    [[nodiscard]] static std::string getGeneratedSignalPath(size_t index);
+
+    [[nodiscard]] const std::vector<std::string>& getSignalPaths() const;
+
+    /**
+     * @brief Get the current value of the signal with the passed path.
+     *
+     * @throws std::out_of_range if the signal is not served.
+     */
+    [[nodiscard]] float getValue(const std::string& signalPath) const;
+
+    [[nodiscard]] uint64_t getNumGetValuesCalls() const;
+    [[nodiscard]] uint64_t getNumBatchActuateCalls() const;
+    /** Number of signals actuated so far which were addressed by path instead of by id */
+    [[nodiscard]] uint64_t getNumActuationsByPath() const;
+    [[nodiscard]] uint64_t getNumSentUpdates() const;
+    [[nodiscard]] size_t   getNumActiveSubscriptions() const;
+
+    FakeDatabroker(const FakeDatabroker&)            = delete;
+    FakeDatabroker(FakeDatabroker&&)                 = delete;
+    FakeDatabroker& operator=(const FakeDatabroker&) = delete;
+    FakeDatabroker& operator=(FakeDatabroker&&)      = delete;
+
+private:
+    class Service;
+
+    std::unique_ptr<Service>      m_service;
+    std::unique_ptr<grpc::Server> m_server;
+    std::string                   m_address;
+};
+
+} // namespace velocitas::kuksa_val_v2
+
+#endif // VEHICLE_APP_SDK_FAKEDATABROKER_H
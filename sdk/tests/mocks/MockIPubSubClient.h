@@ -19,6 +19,11 @@ public:
     MOCK_METHOD(PublishStatus, publishOnTopic,
                 (const std::string& topic, const std::string& data, int timeout_ms), (override));
 
+    MOCK_METHOD(AsyncResultPtr_t<PublishStatus>, publishAsync,
+                (const std::string& topic, const std::string& data,
+                 std::chrono::milliseconds timeout),
+                (override));
+
     MOCK_METHOD(AsyncSubscriptionPtr_t<std::string>, subscribeTopic, (const std::string& topic),
                 (override));
 
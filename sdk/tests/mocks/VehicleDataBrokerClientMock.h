@@ -31,7 +31,16 @@ public:
     MOCK_METHOD(AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t>, setDatapoints,
                 (const std::vector<std::unique_ptr<DataPointValue>>& datapoints));
 
+    using IVehicleDataBrokerClient::setDatapoints;
+
+    using IVehicleDataBrokerClient::subscribe;
+
     MOCK_METHOD(AsyncSubscriptionPtr_t<DataPointReply>, subscribe, (const std::string& query));
+
+    MOCK_METHOD(AsyncResultPtr_t<Status>, prepare,
+                (const std::vector<std::string>& signalPaths, std::chrono::milliseconds timeout));
+
+    MOCK_METHOD(size_t, cancelPendingRequests, ());
 };
 
 } // namespace velocitas
@@ -0,0 +1,192 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/AggregationPipeline.h"
+
+#include "sdk/CallbackExecutor.h"
+#include "sdk/Exceptions.h"
+
+#include "MockIPubSubClient.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::Return;
+
+namespace {
+
+DataPointReply replyOf(const std::string& path, DataPointSample sample) {
+    DataPointReply reply;
+    reply.set(SignalPathRegistry::getInstance().intern(path), std::move(sample));
+    return reply;
+}
+
+AsyncResultPtr_t<PublishStatus> makeResult(PublishStatus status) {
+    auto result = std::make_shared<AsyncResult<PublishStatus>>();
+    result->insertResult(std::move(status));
+    return result;
+}
+
+class Test_AggregationPipeline : public ::testing::Test {
+protected:
+    std::shared_ptr<AggregationPipeline> createPipeline(AggregationPipelineConfig config) {
+        // long window, so the tests close the windows explicitly
+        config.m_topic  = "vehicle/aggregates";
+        config.m_window = std::chrono::hours{1};
+        m_subscription->setCallbackExecutor(CallbackExecutor::createInline());
+        return AggregationPipeline::create(m_subscription, m_mockClient, std::move(config));
+    }
+
+    void receive(const std::string& path, DataPointSample sample) {
+        m_subscription->insertNewItem(replyOf(path, std::move(sample)));
+    }
+
+    AsyncSubscriptionPtr_t<DataPointReply> m_subscription =
+        std::make_shared<AsyncSubscription<DataPointReply>>();
+    std::shared_ptr<MockIPubSubClient> m_mockClient = std::make_shared<MockIPubSubClient>();
+};
+
+} // namespace
+
+TEST_F(Test_AggregationPipeline, flush_receivedValues_aggregatesPublishedAsJson) {
+    std::string payload;
+    EXPECT_CALL(*m_mockClient, publishAsync("vehicle/aggregates", _, _))
+        .WillOnce(Invoke([&payload](const std::string&, const std::string& data, auto) {
+            payload = data;
+            return makeResult(PublishStatus::Success);
+        }));
+    auto pipeline = createPipeline({});
+
+    receive("Vehicle.Test.Speed", DataPointSample(10.0F, Timestamp{}));
+    receive("Vehicle.Test.Speed", DataPointSample(30.0F, Timestamp{}));
+    receive("Vehicle.Test.Speed", DataPointSample(20.0F, Timestamp{}));
+    receive("Vehicle.Test.Gear", DataPointSample(int32_t{3}, Timestamp{}));
+    receive("Vehicle.Test.Name", DataPointSample(std::string("not numeric"), Timestamp{}));
+    pipeline->flush();
+
+    const auto json = nlohmann::json::parse(payload);
+    EXPECT_LE(json["start"].get<int64_t>(), json["end"].get<int64_t>());
+    ASSERT_EQ(2, json["signals"].size());
+    const auto& speed = json["signals"]["Vehicle.Test.Speed"];
+    EXPECT_EQ(3, speed["count"].get<int>());
+    EXPECT_DOUBLE_EQ(20.0, speed["mean"].get<double>());
+    EXPECT_DOUBLE_EQ(10.0, speed["min"].get<double>());
+    EXPECT_DOUBLE_EQ(30.0, speed["max"].get<double>());
+    EXPECT_DOUBLE_EQ(10.0, speed["first"].get<double>());
+    EXPECT_DOUBLE_EQ(20.0, speed["last"].get<double>());
+    EXPECT_DOUBLE_EQ(3.0, json["signals"]["Vehicle.Test.Gear"]["sum"].get<double>());
+
+    const auto metrics = pipeline->getMetrics();
+    EXPECT_EQ(5, metrics.numUpdates);
+    EXPECT_EQ(1, metrics.numWindows);
+    EXPECT_EQ(1, metrics.numPublishedWindows);
+}
+
+TEST_F(Test_AggregationPipeline, flush_emptyWindow_notPublished) {
+    EXPECT_CALL(*m_mockClient, publishAsync(_, _, _)).Times(0);
+    auto pipeline = createPipeline({});
+
+    pipeline->flush();
+
+    EXPECT_EQ(1, pipeline->getMetrics().numWindows);
+    EXPECT_EQ(0, pipeline->getMetrics().numPublishedWindows);
+}
+
+TEST_F(Test_AggregationPipeline, flush_customSerializer_windowSerializedByIt) {
+    EXPECT_CALL(*m_mockClient, publishAsync("vehicle/aggregates", "Vehicle.Test.Speed:2", _))
+        .WillOnce(Return(makeResult(PublishStatus::Success)));
+    AggregationPipelineConfig config;
+    config.m_serializer = [](const AggregationWindow& window) {
+        return window.signals[0].path + ":" + std::to_string(window.signals[0].count);
+    };
+    auto pipeline = createPipeline(config);
+
+    receive("Vehicle.Test.Speed", DataPointSample(1.0, Timestamp{}));
+    receive("Vehicle.Test.Speed", DataPointSample(2.0, Timestamp{}));
+    pipeline->flush();
+}
+
+TEST_F(Test_AggregationPipeline, flush_publisherNotKeepingUp_windowsQueuedAndOldestDropped) {
+    std::vector<AsyncResultPtr_t<PublishStatus>> pendingResults;
+    std::vector<std::string>                     payloads;
+    EXPECT_CALL(*m_mockClient, publishAsync(_, _, _))
+        .WillRepeatedly(Invoke([&](const std::string&, const std::string& data, auto) {
+            payloads.push_back(data);
+            pendingResults.push_back(std::make_shared<AsyncResult<PublishStatus>>());
+            return pendingResults.back();
+        }));
+    AggregationPipelineConfig config;
+    config.m_maxQueuedWindows = 2;
+    config.m_serializer = [](const AggregationWindow& window) {
+        return std::to_string(window.signals[0].last);
+    };
+    auto pipeline = createPipeline(config);
+
+    for (int window = 1; window <= 4; ++window) {
+        receive("Vehicle.Test.Speed", DataPointSample(static_cast<double>(window), Timestamp{}));
+        pipeline->flush();
+    }
+    // the first window is in flight, the second one got dropped for the third and fourth one
+    ASSERT_EQ(1, payloads.size());
+    EXPECT_EQ(1, pipeline->getMetrics().numDroppedWindows);
+
+    pendingResults[0]->insertResult(PublishStatus::Success);
+    ASSERT_EQ(2, payloads.size());
+    EXPECT_EQ(std::to_string(3.0), payloads[1]);
+    pendingResults[1]->insertResult(PublishStatus::Timeout);
+    ASSERT_EQ(3, payloads.size());
+    EXPECT_EQ(std::to_string(4.0), payloads[2]);
+    pendingResults[2]->insertResult(PublishStatus::Success);
+
+    const auto metrics = pipeline->getMetrics();
+    EXPECT_EQ(2, metrics.numPublishedWindows);
+    EXPECT_EQ(1, metrics.numFailedWindows);
+}
+
+TEST_F(Test_AggregationPipeline, stop_pendingValues_lastWindowPublishedAndSubscriptionCancelled) {
+    EXPECT_CALL(*m_mockClient, publishAsync(_, _, _))
+        .WillOnce(Return(makeResult(PublishStatus::Success)));
+    auto pipeline = createPipeline({});
+
+    receive("Vehicle.Test.Speed", DataPointSample(1.0, Timestamp{}));
+    pipeline->stop();
+    pipeline->stop();
+
+    EXPECT_TRUE(m_subscription->isCancelled());
+    EXPECT_EQ(1, pipeline->getMetrics().numPublishedWindows);
+}
+
+TEST_F(Test_AggregationPipeline, create_invalidConfig_throws) {
+    AggregationPipelineConfig config;
+    EXPECT_THROW(AggregationPipeline::create(m_subscription, m_mockClient, config),
+                 InvalidValueException);
+    config.m_topic  = "topic";
+    config.m_window = std::chrono::milliseconds::zero();
+    EXPECT_THROW(AggregationPipeline::create(m_subscription, m_mockClient, config),
+                 InvalidValueException);
+    config.m_window = std::chrono::milliseconds(100);
+    EXPECT_THROW(AggregationPipeline::create(m_subscription, nullptr, config),
+                 InvalidValueException);
+}
@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/AllocationTracker.h"
+#include "sdk/Exceptions.h"
+#include "sdk/RingBuffer.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+// the statistics are process wide and other tests allocate as well, so only a domain not used by
+// the code under test here is checked, by the difference to the initial statistics
+constexpr auto DOMAIN = AllocationDomain::REPLY_MAPS;
+
+template <typename T> using Allocator_t = TrackingAllocator<T, DOMAIN>;
+
+} // namespace
+
+TEST(Test_AllocationTracker, trackingAllocator_vector_allocationsAccounted) {
+    const auto initial = AllocationTracker::getStatistics(DOMAIN);
+    {
+        std::vector<uint64_t, Allocator_t<uint64_t>> values;
+        values.reserve(16);
+
+        const auto statistics = AllocationTracker::getStatistics(DOMAIN);
+        EXPECT_EQ(initial.numAllocations + 1, statistics.numAllocations);
+        EXPECT_EQ(initial.allocatedBytes + 16 * sizeof(uint64_t), statistics.allocatedBytes);
+        EXPECT_EQ(initial.heldBytes + 16 * sizeof(uint64_t), statistics.heldBytes);
+        EXPECT_GE(statistics.peakHeldBytes, statistics.heldBytes);
+    }
+    const auto statistics = AllocationTracker::getStatistics(DOMAIN);
+    EXPECT_EQ(initial.numDeallocations + 1, statistics.numDeallocations);
+    EXPECT_EQ(initial.heldBytes, statistics.heldBytes);
+}
+
+TEST(Test_AllocationTracker, trackingAllocator_ringBuffer_slotsAccounted) {
+    const auto initial = AllocationTracker::getStatistics(DOMAIN);
+    {
+        RingBuffer<uint64_t, Allocator_t<uint64_t>> buffer(8);
+        EXPECT_TRUE(buffer.tryPush(uint64_t{42}));
+        EXPECT_EQ(42, buffer.tryPop().value_or(0));
+
+        const auto statistics = AllocationTracker::getStatistics(DOMAIN);
+        EXPECT_EQ(initial.numAllocations + 1, statistics.numAllocations);
+        EXPECT_GE(statistics.heldBytes - initial.heldBytes, 8 * sizeof(uint64_t));
+    }
+    EXPECT_EQ(initial.heldBytes, AllocationTracker::getStatistics(DOMAIN).heldBytes);
+}
+
+TEST(Test_AllocationTracker, reset_memoryHeld_countersClearedButHeldBytesKept) {
+    std::vector<uint8_t, Allocator_t<uint8_t>> values(100);
+    AllocationTracker::reset();
+
+    const auto statistics = AllocationTracker::getStatistics(DOMAIN);
+    EXPECT_EQ(0, statistics.numAllocations);
+    EXPECT_EQ(0, statistics.allocatedBytes);
+    EXPECT_GE(statistics.heldBytes, 100);
+    EXPECT_EQ(statistics.heldBytes, statistics.peakHeldBytes);
+}
+
+TEST(Test_AllocationTracker, getName_allDomains_distinctNames) {
+    EXPECT_EQ("subscription_buffers",
+              AllocationTracker::getName(AllocationDomain::SUBSCRIPTION_BUFFERS));
+    EXPECT_EQ("metadata_cache", AllocationTracker::getName(AllocationDomain::METADATA_CACHE));
+    EXPECT_EQ("reply_maps", AllocationTracker::getName(AllocationDomain::REPLY_MAPS));
+    EXPECT_EQ("grpc_calls", AllocationTracker::getName(AllocationDomain::GRPC_CALLS));
+    EXPECT_EQ("jobs", AllocationTracker::getName(AllocationDomain::JOBS));
+}
+
+TEST(Test_AllocationTracker, makeSharedIn_trackingEnabled_objectAndControlBlockAccounted) {
+    if constexpr (!IS_ALLOCATION_TRACKING_ENABLED) {
+        GTEST_SKIP() << "Allocation tracking is disabled";
+    }
+    const auto initial = AllocationTracker::getStatistics(AllocationDomain::JOBS);
+    auto       value   = makeSharedIn<AllocationDomain::JOBS, uint64_t>(uint64_t{7});
+
+    const auto statistics = AllocationTracker::getStatistics(AllocationDomain::JOBS);
+    EXPECT_EQ(7, *value);
+    EXPECT_GE(statistics.numAllocations, initial.numAllocations + 1);
+    EXPECT_GT(statistics.allocatedBytes - initial.allocatedBytes, sizeof(uint64_t));
+}
+
+TEST(Test_AllocationTracker, trackingAllocator_limitExceeded_throwsAndNothingAccounted) {
+    const auto initial = AllocationTracker::getStatistics(DOMAIN);
+    AllocationTracker::setLimit(AllocationTracker::getTotalHeldBytes() + 64);
+    EXPECT_EQ(AllocationTracker::getTotalHeldBytes() + 64, AllocationTracker::getLimit());
+
+    std::vector<uint8_t, Allocator_t<uint8_t>> values;
+    EXPECT_NO_THROW(values.reserve(32));
+    EXPECT_THROW(values.reserve(1024), MemoryLimitExceededException);
+    AllocationTracker::setLimit(0);
+
+    const auto statistics = AllocationTracker::getStatistics(DOMAIN);
+    EXPECT_EQ(initial.numAllocations + 1, statistics.numAllocations);
+    EXPECT_EQ(initial.heldBytes + 32, statistics.heldBytes);
+    EXPECT_NO_THROW(values.reserve(1024));
+}
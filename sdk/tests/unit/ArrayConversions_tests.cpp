@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/ArrayConversions.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+// more elements than handled by one iteration of the vectorized kernels, incl. a scalar tail
+constexpr size_t NUM_ELEMENTS = 45;
+
+template <typename TNarrow, typename TWide> void testWidening() {
+    std::vector<TNarrow> narrow(NUM_ELEMENTS);
+    for (size_t i = 0; i < NUM_ELEMENTS; ++i) {
+        narrow[i] = static_cast<TNarrow>(std::numeric_limits<TNarrow>::min() + i * 37);
+    }
+    narrow[3] = std::numeric_limits<TNarrow>::max();
+
+    std::vector<TWide> wide(NUM_ELEMENTS);
+    widenIntegers(narrow.data(), narrow.size(), wide.data());
+
+    for (size_t i = 0; i < NUM_ELEMENTS; ++i) {
+        EXPECT_EQ(static_cast<TWide>(narrow[i]), wide[i]) << "at index " << i;
+    }
+}
+
+template <typename TWide, typename TNarrow> void testExactNarrowing() {
+    std::vector<TWide> wide(NUM_ELEMENTS);
+    for (size_t i = 0; i < NUM_ELEMENTS; ++i) {
+        wide[i] = static_cast<TWide>(std::numeric_limits<TNarrow>::max() - i * 5);
+    }
+    wide[17] = std::numeric_limits<TNarrow>::min();
+
+    std::vector<TNarrow> narrow(NUM_ELEMENTS);
+    EXPECT_EQ(0, narrowIntegers(wide.data(), wide.size(), narrow.data()));
+    for (size_t i = 0; i < NUM_ELEMENTS; ++i) {
+        EXPECT_EQ(wide[i], static_cast<TWide>(narrow[i])) << "at index " << i;
+    }
+}
+
+template <typename TWide, typename TNarrow> void testSaturatingNarrowing() {
+    std::vector<TWide> wide(NUM_ELEMENTS, 1);
+    wide[0]  = std::numeric_limits<TWide>::max();
+    wide[20] = static_cast<TWide>(std::numeric_limits<TNarrow>::max()) + 1;
+    wide[44] = std::numeric_limits<TWide>::max(); // in the scalar tail
+    size_t expectedOutOfRange = 3;
+    if constexpr (std::is_signed_v<TWide>) {
+        wide[5]  = std::numeric_limits<TWide>::min();
+        wide[33] = static_cast<TWide>(std::numeric_limits<TNarrow>::min()) - 1;
+        expectedOutOfRange += 2;
+    }
+
+    std::vector<TNarrow> narrow(NUM_ELEMENTS);
+    EXPECT_EQ(expectedOutOfRange, narrowIntegers(wide.data(), wide.size(), narrow.data()));
+    EXPECT_EQ(std::numeric_limits<TNarrow>::max(), narrow[0]);
+    EXPECT_EQ(std::numeric_limits<TNarrow>::max(), narrow[20]);
+    EXPECT_EQ(std::numeric_limits<TNarrow>::max(), narrow[44]);
+    EXPECT_EQ(1, narrow[1]);
+    if constexpr (std::is_signed_v<TWide>) {
+        EXPECT_EQ(std::numeric_limits<TNarrow>::min(), narrow[5]);
+        EXPECT_EQ(std::numeric_limits<TNarrow>::min(), narrow[33]);
+    }
+}
+
+} // namespace
+
+TEST(Test_ArrayConversions, widenIntegers_allNarrowTypes_valuesPreserved) {
+    testWidening<int8_t, int32_t>();
+    testWidening<int16_t, int32_t>();
+    testWidening<uint8_t, uint32_t>();
+    testWidening<uint16_t, uint32_t>();
+}
+
+TEST(Test_ArrayConversions, narrowIntegers_valuesInRange_convertedExactly) {
+    testExactNarrowing<int32_t, int8_t>();
+    testExactNarrowing<int32_t, int16_t>();
+    testExactNarrowing<uint32_t, uint8_t>();
+    testExactNarrowing<uint32_t, uint16_t>();
+}
+
+TEST(Test_ArrayConversions, narrowIntegers_valuesOutOfRange_saturatedAndCounted) {
+    testSaturatingNarrowing<int32_t, int8_t>();
+    testSaturatingNarrowing<int32_t, int16_t>();
+    testSaturatingNarrowing<uint32_t, uint8_t>();
+    testSaturatingNarrowing<uint32_t, uint16_t>();
+}
+
+TEST(Test_ArrayConversions, narrowIntegers_noElements_nothingWritten) {
+    int8_t dst = 42;
+    EXPECT_EQ(0, narrowIntegers(static_cast<const int32_t*>(nullptr), 0, &dst));
+    EXPECT_EQ(42, dst);
+}
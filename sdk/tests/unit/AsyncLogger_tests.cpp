@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/AsyncLogger.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+struct Log {
+    std::mutex               m_mutex;
+    std::vector<std::string> m_lines;
+    size_t                   m_numFlushes{0};
+    std::atomic_bool         m_isBlocked{false};
+    std::atomic_bool         m_isWaiting{false};
+};
+
+class RecordingLogger : public ILogger {
+public:
+    explicit RecordingLogger(std::shared_ptr<Log> log)
+        : m_log{std::move(log)} {}
+
+    void info(const std::string& msg) override { record("I:" + msg); }
+    void warn(const std::string& msg) override { record("W:" + msg); }
+    void error(const std::string& msg) override { record("E:" + msg); }
+    void debug(const std::string& msg) override { record("D:" + msg); }
+    void flush() override {
+        std::lock_guard<std::mutex> lock(m_log->m_mutex);
+        ++m_log->m_numFlushes;
+    }
+
+private:
+    void record(std::string line) {
+        while (m_log->m_isBlocked) {
+            m_log->m_isWaiting = true;
+            std::this_thread::yield();
+        }
+        std::lock_guard<std::mutex> lock(m_log->m_mutex);
+        m_log->m_lines.push_back(std::move(line));
+    }
+
+    std::shared_ptr<Log> m_log;
+};
+
+std::vector<std::string> getLines(Log& log) {
+    std::lock_guard<std::mutex> lock(log.m_mutex);
+    return log.m_lines;
+}
+
+} // namespace
+
+class Test_AsyncLogger : public ::testing::Test {
+protected:
+    std::unique_ptr<AsyncLogger> createLogger(AsyncLoggerConfig config = {}) {
+        return std::make_unique<AsyncLogger>(std::make_unique<RecordingLogger>(m_log), config);
+    }
+
+    std::shared_ptr<Log> m_log{std::make_shared<Log>()};
+};
+
+TEST_F(Test_AsyncLogger, flush_messagesLogged_allWrittenInOrderOfLevelsAndSinkFlushed) {
+    auto cut = createLogger();
+
+    cut->info("a");
+    cut->warn("b");
+    cut->debug("c");
+    cut->flush();
+
+    EXPECT_EQ(getLines(*m_log), (std::vector<std::string>{"I:a", "W:b", "D:c"}));
+    std::lock_guard<std::mutex> lock(m_log->m_mutex);
+    EXPECT_GE(m_log->m_numFlushes, 1);
+}
+
+TEST_F(Test_AsyncLogger, error_flushingErrors_writtenWhenReturning) {
+    auto cut = createLogger();
+
+    cut->info("a");
+    cut->error("b");
+
+    EXPECT_EQ(getLines(*m_log), (std::vector<std::string>{"I:a", "E:b"}));
+}
+
+TEST_F(Test_AsyncLogger, destructor_messagesBuffered_allWritten) {
+    auto cut = createLogger();
+    for (int i = 0; i < 1000; ++i) {
+        cut->info(std::to_string(i));
+    }
+
+    cut.reset();
+
+    const auto lines = getLines(*m_log);
+    ASSERT_EQ(lines.size(), 1000);
+    EXPECT_EQ(lines.back(), "I:999");
+}
+
+TEST_F(Test_AsyncLogger, info_concurrentThreads_orderPerThreadPreserved) {
+    constexpr int NUM_THREADS  = 4;
+    constexpr int NUM_MESSAGES = 2000;
+    auto          cut          = createLogger({16, AsyncLoggerConfig::OverflowPolicy::BLOCK});
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([&cut, t]() {
+            for (int i = 0; i < NUM_MESSAGES; ++i) {
+                cut->info(fmt::format("{}.{}", t, i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    cut->flush();
+
+    const auto lines = getLines(*m_log);
+    ASSERT_EQ(lines.size(), NUM_THREADS * NUM_MESSAGES);
+    std::vector<int> next(NUM_THREADS, 0);
+    for (const auto& line : lines) {
+        const auto separator = line.find('.');
+        const int  thread    = std::stoi(line.substr(2, separator - 2));
+        EXPECT_EQ(std::stoi(line.substr(separator + 1)), next[thread]++);
+    }
+    EXPECT_EQ(cut->getNumDropped(), 0);
+}
+
+TEST_F(Test_AsyncLogger, info_bufferFullWithDropPolicy_droppedAndReported) {
+    auto cut = createLogger({4, AsyncLoggerConfig::OverflowPolicy::DROP, false});
+
+    m_log->m_isBlocked = true;
+    cut->info("first");
+    // wait for the sink to be busy with the first message, so the buffer can be filled up
+    while (!m_log->m_isWaiting) {
+        std::this_thread::yield();
+    }
+    for (int i = 0; i < 10; ++i) {
+        cut->info(std::to_string(i));
+    }
+    EXPECT_EQ(cut->getNumDropped(), 6);
+    m_log->m_isBlocked = false;
+    cut->flush();
+
+    const auto lines = getLines(*m_log);
+    EXPECT_EQ(lines, (std::vector<std::string>{"I:first", "I:0", "I:1", "I:2", "I:3",
+                                               "W:Log buffer overflow: dropped 6 messages"}));
+}
+
+TEST_F(Test_AsyncLogger, logDeferred_record_formattedByBackgroundThread) {
+    auto        cut = createLogger();
+    std::string str{"World"};
+
+    cut->logDeferred(LogLevel::INFO, LogRecord{"Hello {} {}", str, 42});
+    str = "changed";
+    cut->logDeferred(LogLevel::WARN, LogRecord{"{} {}", 1});
+    cut->flush();
+
+    const auto lines = getLines(*m_log);
+    ASSERT_EQ(lines.size(), 2);
+    EXPECT_EQ(lines[0], "I:Hello World 42");
+    const std::string expectedError{R"(E:Failed to format log message "{} {}")"};
+    EXPECT_EQ(lines[1].substr(0, expectedError.size()), expectedError);
+}
+
+TEST_F(Test_AsyncLogger, logger_deferringImplementation_literalFormatsDeferred) {
+    Logger cut;
+    cut.setLoggerImplementation(createLogger());
+
+    cut.info("Hello {}", "World");
+    cut.info(std::string{"Hello {}"}, "again");
+    cut.flush();
+
+    EXPECT_EQ(getLines(*m_log), (std::vector<std::string>{"I:Hello World", "I:Hello again"}));
+}
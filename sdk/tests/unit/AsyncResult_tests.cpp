@@ -18,8 +18,34 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
 using namespace velocitas;
 
+namespace {
+// counts the copies made of it, to check continuations pass results on by reference or move
+struct CopyCounted {
+    CopyCounted() = default;
+    CopyCounted(const CopyCounted& other)
+        : numCopies(other.numCopies + 1) {}
+    CopyCounted(CopyCounted&&)                 = default;
+    CopyCounted& operator=(const CopyCounted&) = default;
+    CopyCounted& operator=(CopyCounted&&)      = default;
+    ~CopyCounted()                             = default;
+
+    int numCopies{0};
+};
+} // namespace
+
 TEST(Test_AsyncResult, await_withBufferedValue_returnsValueImmediately) {
     AsyncResult<int> asyncResult;
     asyncResult.insertResult(5);
@@ -66,3 +92,292 @@ TEST(Test_AsyncResult, onResult_whileAwaiting_throws) {
     asyncResult.insertResult(4);
     thread.join();
 }
+
+TEST(Test_AsyncResult, await_moveOnlyResult_resultMovedOutToAwaiter) {
+    AsyncResult<std::unique_ptr<int>> asyncResult;
+    asyncResult.insertResult(std::make_unique<int>(3));
+    auto result = asyncResult.await();
+    ASSERT_NE(nullptr, result);
+    EXPECT_EQ(3, *result);
+}
+
+TEST(Test_AsyncResult, await_errorInsertedConcurrently_throws) {
+    AsyncResult<int> asyncResult;
+    std::thread      thread([&asyncResult]() { asyncResult.insertError(Status("failed")); });
+    EXPECT_THROW(asyncResult.await(), AsyncException);
+    thread.join();
+}
+
+TEST(Test_AsyncResult, insertResult_insertedTwice_firstResultKept) {
+    AsyncResult<int> asyncResult;
+    asyncResult.insertResult(1);
+    asyncResult.insertResult(2);
+    asyncResult.insertError(Status("failed"));
+    EXPECT_EQ(1, asyncResult.await());
+}
+
+TEST(Test_AsyncResult, onResult_registeredTwice_throws) {
+    AsyncResult<int> asyncResult;
+    asyncResult.onResult([](int) {});
+    EXPECT_THROW(asyncResult.onResult([](int) {}), std::runtime_error);
+}
+
+TEST(Test_AsyncResult, onError_afterErrorInserted_callbackCalledImmediately) {
+    std::string      errorMessage;
+    AsyncResult<int> asyncResult;
+    asyncResult.insertError(Status("failed"));
+    asyncResult.onError(
+        [&errorMessage](const Status& status) { errorMessage = status.errorMessage(); });
+    EXPECT_EQ("failed", errorMessage);
+}
+
+TEST(Test_AsyncResult, onResult_racingWithInsertResult_callbackCalledExactlyOnce) {
+    constexpr auto NUM_ROUNDS{1000};
+
+    for (int round = 0; round < NUM_ROUNDS; ++round) {
+        auto             asyncResult = std::make_shared<AsyncResult<int>>();
+        std::atomic<int> numCalls{0};
+        std::atomic<int> receivedResult{-1};
+
+        std::thread thread([asyncResult, round]() {
+            int temp = round;
+            asyncResult->insertResult(std::move(temp));
+        });
+        asyncResult->onResult([&numCalls, &receivedResult](int result) {
+            receivedResult = result;
+            ++numCalls;
+        });
+        thread.join();
+
+        ASSERT_EQ(1, numCalls.load());
+        ASSERT_EQ(round, receivedResult.load());
+    }
+}
+
+TEST(Test_AsyncResult, then_resultInserted_continuationRunInlineWithResult) {
+    auto asyncResult  = std::make_shared<AsyncResult<int>>();
+    auto continuation = asyncResult->then([](const int& value) { return std::to_string(value); });
+
+    const auto      completingThread = std::this_thread::get_id();
+    std::thread::id continuationThread;
+    continuation->onResult([&continuationThread](const std::string&) {
+        continuationThread = std::this_thread::get_id();
+    });
+    asyncResult->insertResult(5);
+
+    EXPECT_EQ(completingThread, continuationThread);
+}
+
+TEST(Test_AsyncResult, then_withExecutor_continuationRunOnPool) {
+    auto pool         = std::make_shared<ThreadPool>(1);
+    auto asyncResult  = std::make_shared<AsyncResult<int>>();
+    auto continuation =
+        asyncResult->then([](const int&) { return std::this_thread::get_id(); }, pool);
+
+    asyncResult->insertResult(5);
+    EXPECT_NE(std::this_thread::get_id(), continuation->await());
+}
+
+TEST(Test_AsyncResult, setCallbackExecutor_pool_callbackRunOnPoolAfterResultReleased) {
+    const auto executor    = CallbackExecutor::createPool();
+    auto       asyncResult = std::make_shared<AsyncResult<std::string>>();
+    asyncResult->setCallbackExecutor(executor);
+    std::promise<std::pair<std::string, std::thread::id>> received;
+    asyncResult->onResult([&received](const std::string& value) {
+        received.set_value({value, std::this_thread::get_id()});
+    });
+
+    asyncResult->insertResult("value");
+    asyncResult.reset();
+
+    auto future = received.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(1)));
+    const auto [value, callbackThread] = future.get();
+    EXPECT_EQ("value", value);
+    EXPECT_NE(std::this_thread::get_id(), callbackThread);
+}
+
+TEST(Test_AsyncResult, setCallbackExecutor_inline_errorCallbackMeasured) {
+    const auto executor    = CallbackExecutor::createInline();
+    auto       asyncResult = std::make_shared<AsyncResult<int>>();
+    asyncResult->setCallbackExecutor(executor);
+    Status receivedStatus;
+    asyncResult->onError([&receivedStatus](const Status& status) { receivedStatus = status; });
+
+    asyncResult->insertError(Status("failure"));
+
+    EXPECT_EQ("failure", receivedStatus.errorMessage());
+    EXPECT_EQ(1, executor->getMetrics().executionTime.count);
+}
+
+TEST(Test_AsyncResult, then_errorInserted_errorPropagated) {
+    auto asyncResult  = std::make_shared<AsyncResult<int>>();
+    auto continuation = asyncResult->then([](const int& value) { return value * 2; });
+
+    asyncResult->insertError(Status("failure"));
+    EXPECT_THROW(continuation->await(), AsyncException);
+}
+
+TEST(Test_AsyncResult, then_continuationThrows_errorInserted) {
+    auto asyncResult  = std::make_shared<AsyncResult<int>>();
+    auto continuation = asyncResult->then([](const int&) -> int {
+        throw std::runtime_error("failure");
+    });
+
+    asyncResult->insertResult(5);
+    EXPECT_THROW(continuation->await(), AsyncException);
+}
+
+TEST(Test_AsyncResult, then_inline_resultNotCopied) {
+    auto asyncResult  = std::make_shared<AsyncResult<CopyCounted>>();
+    auto continuation = asyncResult->then([](const CopyCounted& item) { return item.numCopies; });
+
+    asyncResult->insertResult(CopyCounted{});
+    EXPECT_EQ(0, continuation->await());
+}
+
+TEST(Test_AsyncResult, flatMap_inline_resultsNotCopied) {
+    auto asyncResult  = std::make_shared<AsyncResult<int>>();
+    auto nextResult   = std::make_shared<AsyncResult<CopyCounted>>();
+    auto continuation = asyncResult->flatMap([nextResult](const int&) { return nextResult; });
+
+    asyncResult->insertResult(5);
+    nextResult->insertResult(CopyCounted{});
+    EXPECT_EQ(0, continuation->await().numCopies);
+}
+
+TEST(Test_AsyncResult, flatMap_nextOperationCompletes_resultOfNextOperation) {
+    auto asyncResult  = std::make_shared<AsyncResult<int>>();
+    auto nextResult   = std::make_shared<AsyncResult<std::string>>();
+    auto continuation = asyncResult->flatMap([nextResult](const int&) { return nextResult; });
+
+    asyncResult->insertResult(5);
+    nextResult->insertResult("done");
+    EXPECT_EQ("done", continuation->await());
+}
+
+TEST(Test_AsyncResult, flatMap_innerResultDispatchedByPool_forwardedAfterInnerReleased) {
+    ASSERT_TRUE(
+        ThreadPool::configure({"test_flatMapInner", 1, SchedulingMode::SHARED_QUEUE, {}, 0}));
+    auto               pool = ThreadPool::getInstance("test_flatMapInner");
+    std::promise<void> release;
+    auto               released = release.get_future().share();
+    // blocks the single worker, so the inner callback runs only after the inner result is gone
+    pool->post([released]() { released.wait(); });
+
+    auto asyncResult = std::make_shared<AsyncResult<int>>();
+    auto inner       = std::make_shared<AsyncResult<std::string>>();
+    inner->setCallbackExecutor(CallbackExecutor::createPool("test_flatMapInner"));
+    auto continuation = asyncResult->flatMap([&inner](const int&) { return inner; });
+    asyncResult->insertResult(5);
+    // the producer completes the inner result and drops it before its callback was run
+    inner->insertResult(std::string(64, 'x'));
+    inner.reset();
+    release.set_value();
+
+    EXPECT_EQ(std::string(64, 'x'), continuation->await());
+}
+
+TEST(Test_AsyncResult, whenAll_allResultsInserted_combinedResultHoldsAll) {
+    auto intResult    = std::make_shared<AsyncResult<int>>();
+    auto stringResult = std::make_shared<AsyncResult<std::string>>();
+    auto combined     = whenAll(intResult, stringResult);
+
+    stringResult->insertResult("a");
+    intResult->insertResult(1);
+    EXPECT_EQ(std::make_tuple(1, std::string("a")), combined->await());
+}
+
+TEST(Test_AsyncResult, whenAll_oneResultFails_combinedResultFails) {
+    auto firstResult  = std::make_shared<AsyncResult<int>>();
+    auto secondResult = std::make_shared<AsyncResult<int>>();
+    auto combined     = whenAll(firstResult, secondResult);
+
+    firstResult->insertResult(1);
+    secondResult->insertError(Status("failure"));
+    EXPECT_THROW(combined->await(), AsyncException);
+}
+
+TEST(Test_AsyncResult, whenAll_vectorCompletedConcurrently_resultsInOrder) {
+    constexpr size_t                   NUM_RESULTS = 8;
+    std::vector<AsyncResultPtr_t<int>> results;
+    for (size_t i = 0; i < NUM_RESULTS; ++i) {
+        results.push_back(std::make_shared<AsyncResult<int>>());
+    }
+    auto combined = whenAll(results);
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < NUM_RESULTS; ++i) {
+        threads.emplace_back([&results, i]() { results[i]->insertResult(static_cast<int>(i)); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7}), combined->await());
+}
+
+TEST(Test_AsyncResult, whenAny_secondCompletesFirst_combinedHoldsSecond) {
+    std::vector<AsyncResultPtr_t<int>> results{std::make_shared<AsyncResult<int>>(),
+                                               std::make_shared<AsyncResult<int>>()};
+    auto                               combined = whenAny(results);
+
+    results[1]->insertResult(2);
+    results[0]->insertResult(1);
+    EXPECT_EQ(std::make_pair(size_t{1}, 2), combined->await());
+}
+
+TEST(Test_AsyncResult, whenAny_allFail_combinedResultFails) {
+    std::vector<AsyncResultPtr_t<int>> results{std::make_shared<AsyncResult<int>>(),
+                                               std::make_shared<AsyncResult<int>>()};
+    auto                               combined = whenAny(results);
+
+    results[0]->insertError(Status("first"));
+    results[1]->insertError(Status("second"));
+    EXPECT_THROW(combined->await(), AsyncException);
+}
+
+TEST(Test_AsyncResult, cancel_pendingResult_failsAndAbortsOperation) {
+    auto result    = std::make_shared<AsyncResult<int>>();
+    int  numAborts = 0;
+    result->setCancellationHandler([&numAborts]() { ++numAborts; });
+
+    result->cancel();
+    result->insertResult(1);
+
+    EXPECT_TRUE(result->isCancelled());
+    EXPECT_EQ(1, numAborts);
+    EXPECT_THROW(result->await(), AsyncException);
+}
+
+TEST(Test_AsyncResult, cancel_resultAvailable_noEffect) {
+    auto result    = std::make_shared<AsyncResult<int>>();
+    int  numAborts = 0;
+    result->setCancellationHandler([&numAborts]() { ++numAborts; });
+    result->insertResult(1);
+
+    result->cancel();
+
+    EXPECT_FALSE(result->isCancelled());
+    EXPECT_EQ(0, numAborts);
+    EXPECT_EQ(1, result->await());
+}
+
+TEST(Test_AsyncResult, setCancellationHandler_alreadyCancelled_calledImmediately) {
+    auto result    = std::make_shared<AsyncResult<int>>();
+    int  numAborts = 0;
+    result->cancel();
+
+    result->setCancellationHandler([&numAborts]() { ++numAborts; });
+
+    EXPECT_EQ(1, numAborts);
+}
+
+TEST(Test_AsyncResult, cancel_continuation_cancelsSourceResult) {
+    auto source = std::make_shared<AsyncResult<int>>();
+    auto next   = source->then([](int value) { return value * 2; });
+
+    next->cancel();
+
+    EXPECT_TRUE(source->isCancelled());
+    EXPECT_THROW(next->await(), AsyncException);
+}
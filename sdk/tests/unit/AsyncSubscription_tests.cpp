@@ -15,11 +15,37 @@
  */
 
 #include "sdk/AsyncResult.h"
+#include "sdk/DataPointReply.h"
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
 using namespace velocitas;
 
+namespace {
+struct CopyCountingItem {
+    explicit CopyCountingItem(int* numCopies)
+        : m_numCopies(numCopies) {}
+    CopyCountingItem(const CopyCountingItem& other)
+        : m_numCopies(other.m_numCopies) {
+        ++*m_numCopies;
+    }
+    CopyCountingItem(CopyCountingItem&&) noexcept            = default;
+    CopyCountingItem& operator=(const CopyCountingItem&)     = delete;
+    CopyCountingItem& operator=(CopyCountingItem&&) noexcept = default;
+    ~CopyCountingItem()                                      = default;
+
+    int* m_numCopies;
+};
+} // namespace
+
 TEST(Test_AsyncSubcription, next_withBufferedItems_returnsItemsInOrder) {
     AsyncSubscription<int> asyncSubscription;
     asyncSubscription.insertNewItem(1);
@@ -42,3 +68,446 @@ TEST(Test_AsyncSubcription, next_noBufferedItems_blocksUntilItemsInserted) {
     EXPECT_EQ(asyncSubscription.next(), INT_RESULT);
     thread.join();
 }
+
+TEST(Test_AsyncSubcription, insertNewItem_bufferFull_oldestItemDropped) {
+    AsyncSubscription<int> asyncSubscription(2);
+    asyncSubscription.insertNewItem(1);
+    asyncSubscription.insertNewItem(2);
+    asyncSubscription.insertNewItem(3);
+
+    EXPECT_EQ(asyncSubscription.next(), 2);
+    EXPECT_EQ(asyncSubscription.next(), 3);
+}
+
+TEST(Test_AsyncSubcription, insertNewItem_bufferFull_droppedItemsCounted) {
+    AsyncSubscription<int> asyncSubscription(2);
+    for (int i = 0; i < 5; ++i) {
+        asyncSubscription.insertNewItem(std::move(i));
+    }
+
+    EXPECT_EQ(3, asyncSubscription.getNumDroppedItems());
+    EXPECT_EQ(0, asyncSubscription.getNumConflatedItems());
+}
+
+TEST(Test_AsyncSubcription, insertNewItem_dropNewestAndBufferFull_newItemDropped) {
+    AsyncSubscription<int> asyncSubscription(2, OverflowPolicy::DROP_NEWEST);
+    asyncSubscription.insertNewItem(1);
+    asyncSubscription.insertNewItem(2);
+    asyncSubscription.insertNewItem(3);
+
+    EXPECT_EQ(1, asyncSubscription.getNumDroppedItems());
+    EXPECT_EQ(asyncSubscription.next(), 1);
+    EXPECT_EQ(asyncSubscription.next(), 2);
+}
+
+TEST(Test_AsyncSubcription, insertNewItem_conflateLatest_onlyLatestItemReturned) {
+    AsyncSubscription<std::string> asyncSubscription(2, OverflowPolicy::CONFLATE_LATEST);
+    asyncSubscription.insertNewItem("a");
+    asyncSubscription.insertNewItem("b");
+    asyncSubscription.insertNewItem("c");
+
+    EXPECT_EQ(2, asyncSubscription.getNumConflatedItems());
+    EXPECT_EQ(0, asyncSubscription.getNumDroppedItems());
+    EXPECT_EQ(asyncSubscription.next(), "c");
+}
+
+TEST(Test_AsyncSubcription, insertNewItem_conflateDataPointReplies_mergedPerPath) {
+    AsyncSubscription<DataPointReply> asyncSubscription(2, OverflowPolicy::CONFLATE_LATEST);
+    asyncSubscription.insertNewItem(
+        DataPointReply({{"A", std::make_shared<TypedDataPointValue<int32_t>>("A", 1)},
+                        {"B", std::make_shared<TypedDataPointValue<int32_t>>("B", 2)}}));
+    asyncSubscription.insertNewItem(
+        DataPointReply({{"A", std::make_shared<TypedDataPointValue<int32_t>>("A", 3)}}));
+
+    const auto reply = asyncSubscription.next();
+    EXPECT_EQ(3, std::dynamic_pointer_cast<TypedDataPointValue<int32_t>>(reply.getUntyped("A"))
+                     ->value());
+    EXPECT_EQ(2, std::dynamic_pointer_cast<TypedDataPointValue<int32_t>>(reply.getUntyped("B"))
+                     ->value());
+    EXPECT_EQ(1, asyncSubscription.getNumConflatedItems());
+}
+
+TEST(Test_AsyncSubcription, setOverflowPolicy_switchToConflation_bufferedItemsReturnedFirst) {
+    AsyncSubscription<int> asyncSubscription;
+    asyncSubscription.insertNewItem(1);
+    asyncSubscription.setOverflowPolicy(OverflowPolicy::CONFLATE_LATEST);
+    asyncSubscription.insertNewItem(2);
+    asyncSubscription.insertNewItem(3);
+
+    EXPECT_EQ(OverflowPolicy::CONFLATE_LATEST, asyncSubscription.getOverflowPolicy());
+    EXPECT_EQ(asyncSubscription.next(), 1);
+    EXPECT_EQ(asyncSubscription.next(), 3);
+}
+
+TEST(Test_AsyncSubcription, insertNewItem_moveOnlyPayload_movedToConsumer) {
+    AsyncSubscription<std::unique_ptr<int>> asyncSubscription;
+    asyncSubscription.insertNewItem(std::make_unique<int>(42));
+
+    EXPECT_EQ(*asyncSubscription.next(), 42);
+}
+
+TEST(Test_AsyncSubcription, next_errorInserted_throws) {
+    AsyncSubscription<int> asyncSubscription;
+    std::thread            thread([&asyncSubscription]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        asyncSubscription.insertError(Status("failure"));
+    });
+
+    EXPECT_THROW(asyncSubscription.next(), AsyncException);
+    thread.join();
+}
+
+TEST(Test_AsyncSubcription, next_concurrentProducer_allItemsReceivedInOrder) {
+    constexpr int          NUM_ITEMS = 10000;
+    AsyncSubscription<int> asyncSubscription(NUM_ITEMS);
+    std::thread            thread([&asyncSubscription]() {
+        for (int i = 0; i < NUM_ITEMS; ++i) {
+            int item = i;
+            asyncSubscription.insertNewItem(std::move(item));
+        }
+    });
+
+    for (int i = 0; i < NUM_ITEMS; ++i) {
+        ASSERT_EQ(asyncSubscription.next(), i);
+    }
+    thread.join();
+}
+
+TEST(Test_AsyncSubcription, tryNext_noItems_returnsNullopt) {
+    AsyncSubscription<int> asyncSubscription;
+    EXPECT_FALSE(asyncSubscription.tryNext().has_value());
+
+    asyncSubscription.insertNewItem(1);
+    EXPECT_EQ(1, asyncSubscription.tryNext());
+    EXPECT_FALSE(asyncSubscription.tryNext().has_value());
+}
+
+TEST(Test_AsyncSubcription, tryNext_conflatedItem_returnsIt) {
+    AsyncSubscription<int> asyncSubscription(2, OverflowPolicy::CONFLATE_LATEST);
+    asyncSubscription.insertNewItem(1);
+    asyncSubscription.insertNewItem(2);
+
+    EXPECT_EQ(2, asyncSubscription.tryNext());
+    EXPECT_FALSE(asyncSubscription.tryNext().has_value());
+}
+
+TEST(Test_AsyncSubcription, tryNext_errorInserted_throws) {
+    AsyncSubscription<int> asyncSubscription;
+    asyncSubscription.insertError(Status("failure"));
+
+    EXPECT_THROW(asyncSubscription.tryNext(), AsyncException);
+    EXPECT_THROW(asyncSubscription.drain(), AsyncException);
+}
+
+TEST(Test_AsyncSubcription, nextFor_noItems_returnsNulloptAfterTimeout) {
+    AsyncSubscription<int> asyncSubscription;
+    const auto             start = std::chrono::steady_clock::now();
+
+    EXPECT_FALSE(asyncSubscription.nextFor(std::chrono::milliseconds(20)).has_value());
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+}
+
+TEST(Test_AsyncSubcription, nextFor_itemInsertedWhileWaiting_returnsItem) {
+    AsyncSubscription<int> asyncSubscription;
+    std::thread            thread([&asyncSubscription]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        asyncSubscription.insertNewItem(42);
+    });
+
+    EXPECT_EQ(42, asyncSubscription.nextFor(std::chrono::seconds(1)));
+    thread.join();
+}
+
+TEST(Test_AsyncSubcription, drain_bufferedItems_returnsAllInOrder) {
+    AsyncSubscription<int> asyncSubscription;
+    for (int i = 0; i < 5; ++i) {
+        asyncSubscription.insertNewItem(std::move(i));
+    }
+
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3, 4}), asyncSubscription.drain());
+    EXPECT_TRUE(asyncSubscription.drain().empty());
+}
+
+TEST(Test_AsyncSubcription, drain_maxItems_returnsAtMostMaxItems) {
+    AsyncSubscription<int> asyncSubscription;
+    for (int i = 0; i < 5; ++i) {
+        asyncSubscription.insertNewItem(std::move(i));
+    }
+
+    EXPECT_EQ((std::vector<int>{0, 1}), asyncSubscription.drain(2));
+    EXPECT_EQ((std::vector<int>{2, 3, 4}), asyncSubscription.drain(10));
+}
+
+TEST(Test_AsyncSubcription, getStrand_noStrandSet_createsStrandOnce) {
+    AsyncSubscription<int> asyncSubscription;
+    auto                   strand = asyncSubscription.getStrand();
+
+    ASSERT_NE(nullptr, strand);
+    EXPECT_EQ(strand, asyncSubscription.getStrand());
+}
+
+TEST(Test_AsyncSubcription, setStrand_strandSet_getStrandReturnsIt) {
+    AsyncSubscription<int> asyncSubscription;
+    auto                   strand = Strand::create();
+
+    asyncSubscription.setStrand(strand);
+    EXPECT_EQ(strand, asyncSubscription.getStrand());
+}
+
+TEST(Test_AsyncSubcription, isDispatchingInline_noOrInlineExecutor_true) {
+    AsyncSubscription<int> asyncSubscription;
+    EXPECT_TRUE(asyncSubscription.isDispatchingInline());
+
+    asyncSubscription.setCallbackExecutor(CallbackExecutor::createInline());
+    EXPECT_TRUE(asyncSubscription.isDispatchingInline());
+
+    asyncSubscription.setCallbackExecutor(CallbackExecutor::createPool());
+    EXPECT_FALSE(asyncSubscription.isDispatchingInline());
+}
+
+TEST(Test_AsyncSubcription, setCallbackExecutor_pool_itemsDeliveredInOrderByWorker) {
+    constexpr int          NUM_ITEMS = 50;
+    const auto             executor  = CallbackExecutor::createPool();
+    AsyncSubscription<int> asyncSubscription;
+    asyncSubscription.setCallbackExecutor(executor);
+    std::vector<int> receivedItems;
+    std::thread::id  callbackThread;
+    asyncSubscription.onItem([&receivedItems, &callbackThread](const int& item) {
+        receivedItems.push_back(item);
+        callbackThread = std::this_thread::get_id();
+    });
+
+    std::promise<void> delivered;
+    for (int i = 0; i < NUM_ITEMS; ++i) {
+        asyncSubscription.insertNewItem(int{i}, [&delivered, i]() {
+            if (i == NUM_ITEMS - 1) {
+                delivered.set_value();
+            }
+        });
+    }
+
+    ASSERT_EQ(std::future_status::ready,
+              delivered.get_future().wait_for(std::chrono::seconds(1)));
+    ASSERT_EQ(NUM_ITEMS, receivedItems.size());
+    for (int i = 0; i < NUM_ITEMS; ++i) {
+        EXPECT_EQ(i, receivedItems[i]);
+    }
+    EXPECT_NE(std::this_thread::get_id(), callbackThread);
+    EXPECT_EQ(NUM_ITEMS, executor->getMetrics().dispatchLatency.count);
+}
+
+TEST(Test_AsyncSubcription, insertNewItem_noCallback_onDeliveredCalledAfterBuffering) {
+    AsyncSubscription<int> asyncSubscription;
+    bool                   isDelivered{false};
+
+    asyncSubscription.insertNewItem(7, [&isDelivered]() { isDelivered = true; });
+
+    EXPECT_TRUE(isDelivered);
+    EXPECT_EQ(7, asyncSubscription.next());
+}
+
+TEST(Test_AsyncSubcription, onItemMoved_moveOnlyItem_ownershipHandedToCallback) {
+    std::unique_ptr<int>                    receivedItem;
+    AsyncSubscription<std::unique_ptr<int>> asyncSubscription;
+    asyncSubscription.onItemMoved(
+        [&receivedItem](std::unique_ptr<int>&& item) { receivedItem = std::move(item); });
+
+    asyncSubscription.insertNewItem(std::make_unique<int>(42));
+
+    ASSERT_NE(nullptr, receivedItem);
+    EXPECT_EQ(42, *receivedItem);
+}
+
+TEST(Test_AsyncSubcription, onItemShared_itemKeptByCallbacks_itemNeverCopied) {
+    int                                                  numCopies{0};
+    std::vector<std::shared_ptr<const CopyCountingItem>> receivedItems;
+    AsyncSubscription<CopyCountingItem>                  asyncSubscription;
+    asyncSubscription.onItemShared([&receivedItems](std::shared_ptr<const CopyCountingItem> item) {
+        receivedItems.push_back(item);
+        receivedItems.push_back(std::move(item));
+    });
+
+    asyncSubscription.insertNewItem(CopyCountingItem(&numCopies));
+
+    ASSERT_EQ(2, receivedItems.size());
+    EXPECT_EQ(receivedItems[0], receivedItems[1]);
+    EXPECT_EQ(0, numCopies);
+}
+
+TEST(Test_AsyncSubcription, onItem_constRefCallback_itemNotCopiedForDelivery) {
+    int                                 numCopies{0};
+    AsyncSubscription<CopyCountingItem> asyncSubscription;
+    asyncSubscription.onItem([](const CopyCountingItem&) {});
+
+    asyncSubscription.insertNewItem(CopyCountingItem(&numCopies));
+
+    EXPECT_EQ(0, numCopies);
+}
+
+TEST(Test_AsyncSubcription, getSnapshot_noSnapshotProvider_returnsNullopt) {
+    AsyncSubscription<int> asyncSubscription;
+    EXPECT_FALSE(asyncSubscription.getSnapshot().has_value());
+}
+
+TEST(Test_AsyncSubcription, getSnapshot_withSnapshotProvider_returnsProvidedState) {
+    AsyncSubscription<int> asyncSubscription;
+    asyncSubscription.setSnapshotProvider([]() { return 17; });
+    asyncSubscription.insertNewItem(1);
+
+    EXPECT_EQ(17, asyncSubscription.getSnapshot());
+    EXPECT_EQ(1, asyncSubscription.next());
+}
+
+TEST(Test_AsyncSubcription, getSharedSnapshot_sharedSnapshotProvider_returnsSharedState) {
+    AsyncSubscription<int> asyncSubscription;
+    EXPECT_EQ(nullptr, asyncSubscription.getSharedSnapshot());
+    const auto state = std::make_shared<const int>(17);
+    asyncSubscription.setSharedSnapshotProvider([state]() { return state; });
+
+    EXPECT_EQ(state, asyncSubscription.getSharedSnapshot());
+    EXPECT_EQ(17, asyncSubscription.getSnapshot());
+}
+
+TEST(Test_AsyncSubcription, getSharedSnapshot_snapshotProvider_returnsCopyOfProvidedState) {
+    AsyncSubscription<int> asyncSubscription;
+    asyncSubscription.setSnapshotProvider([]() { return 17; });
+
+    const auto snapshot = asyncSubscription.getSharedSnapshot();
+    ASSERT_NE(nullptr, snapshot);
+    EXPECT_EQ(17, *snapshot);
+}
+
+TEST(Test_AsyncSubcription, insertNewItem_tracedWithPoolExecutor_callbackStagesRecorded) {
+    AsyncSubscription<int> asyncSubscription;
+    const auto             tracer = std::make_shared<LatencyTracer>(1);
+    asyncSubscription.setCallbackExecutor(CallbackExecutor::createPool());
+    asyncSubscription.setLatencyTracer(tracer);
+    asyncSubscription.onItem([](const int&) {});
+
+    LatencyTrace trace;
+    trace.stamp(LatencyStage::STREAM_READ);
+    trace.stamp(LatencyStage::DECODED);
+    std::promise<void> delivered;
+    asyncSubscription.insertNewItem(1, [&delivered]() { delivered.set_value(); }, trace);
+
+    ASSERT_EQ(std::future_status::ready,
+              delivered.get_future().wait_for(std::chrono::seconds(1)));
+    const auto metrics = tracer->getMetrics();
+    EXPECT_EQ(1, metrics.numTracedUpdates);
+    EXPECT_EQ(1, metrics.dispatchLatency.count);
+    EXPECT_EQ(1, metrics.executionTime.count);
+    EXPECT_EQ(1, metrics.totalLatency.count);
+}
+
+TEST(Test_AsyncSubcription, insertNewItem_tracedWithoutCallback_recordedUpToEnqueue) {
+    AsyncSubscription<int> asyncSubscription;
+    const auto             tracer = std::make_shared<LatencyTracer>(1);
+    asyncSubscription.setLatencyTracer(tracer);
+
+    LatencyTrace trace;
+    trace.stamp(LatencyStage::STREAM_READ);
+    trace.stamp(LatencyStage::DECODED);
+    asyncSubscription.insertNewItem(1, nullptr, trace);
+
+    EXPECT_EQ(1, asyncSubscription.next());
+    const auto metrics = tracer->getMetrics();
+    EXPECT_EQ(1, metrics.enqueueLatency.count);
+    EXPECT_EQ(0, metrics.executionTime.count);
+}
+
+TEST(Test_AsyncSubcription, insertNewItem_conflatingWhileCallbackBusy_latestStateDeliveredOnce) {
+    AsyncSubscription<DataPointReply> asyncSubscription(2, OverflowPolicy::CONFLATE_LATEST);
+    asyncSubscription.setCallbackExecutor(CallbackExecutor::createPool());
+    const auto speed = SignalPathRegistry::getInstance().intern("Vehicle.Test.Speed");
+    const auto gear  = SignalPathRegistry::getInstance().intern("Vehicle.Test.Gear");
+    std::promise<void>          firstStarted;
+    std::promise<void>          release;
+    auto                        released = release.get_future().share();
+    std::promise<void>          allDelivered;
+    std::vector<DataPointReply> replies;
+    asyncSubscription.onItemMoved([&](DataPointReply&& reply) {
+        replies.push_back(std::move(reply));
+        if (replies.size() == 1) {
+            firstStarted.set_value();
+            released.wait();
+        } else {
+            allDelivered.set_value();
+        }
+    });
+
+    const auto insert = [&](SignalHandle_t signal, float value) {
+        DataPointReply reply;
+        reply.set(signal, DataPointSample(value, Timestamp{}));
+        asyncSubscription.insertNewItem(std::move(reply));
+    };
+    insert(speed, 1.0F);
+    firstStarted.get_future().wait();
+    insert(speed, 2.0F);
+    insert(gear, 3.0F);
+    std::atomic_bool isLastHandedOver{false};
+    DataPointReply   last;
+    last.set(speed, DataPointSample(4.0F, Timestamp{}));
+    asyncSubscription.insertNewItem(std::move(last), [&]() { isLastHandedOver = true; });
+    // conflated items are handed over with the pending item
+    EXPECT_FALSE(isLastHandedOver);
+    release.set_value();
+
+    ASSERT_EQ(std::future_status::ready,
+              allDelivered.get_future().wait_for(std::chrono::seconds(1)));
+    ASSERT_EQ(2, replies.size());
+    ASSERT_NE(nullptr, replies[1].getSample(speed).getIf<float>());
+    EXPECT_EQ(4.0F, *replies[1].getSample(speed).getIf<float>());
+    EXPECT_TRUE(replies[1].getSample(gear).isValid());
+    EXPECT_EQ(2, asyncSubscription.getNumConflatedItems());
+}
+
+TEST(Test_AsyncSubcription, insertNewItem_conflatingWithIdleCallback_everyItemDelivered) {
+    AsyncSubscription<int> asyncSubscription(2, OverflowPolicy::CONFLATE_LATEST);
+    asyncSubscription.setCallbackExecutor(CallbackExecutor::createPool());
+    std::vector<int> items;
+    asyncSubscription.onItem([&items](const int& item) { items.push_back(item); });
+
+    for (int item = 1; item <= 3; ++item) {
+        std::promise<void> delivered;
+        asyncSubscription.insertNewItem(int{item}, [&delivered]() { delivered.set_value(); });
+        ASSERT_EQ(std::future_status::ready,
+                  delivered.get_future().wait_for(std::chrono::seconds(1)));
+    }
+
+    EXPECT_EQ((std::vector<int>{1, 2, 3}), items);
+    EXPECT_EQ(0, asyncSubscription.getNumConflatedItems());
+}
+
+TEST(Test_AsyncSubcription, cancel_withCancellationHandler_handlerCalledOnceBufferDropped) {
+    AsyncSubscription<int> asyncSubscription;
+    int                    numCalls{0};
+    asyncSubscription.setCancellationHandler([&numCalls]() { ++numCalls; });
+    asyncSubscription.insertNewItem(1);
+
+    asyncSubscription.cancel();
+    asyncSubscription.cancel();
+    asyncSubscription.insertNewItem(2);
+
+    EXPECT_EQ(1, numCalls);
+    EXPECT_TRUE(asyncSubscription.isCancelled());
+    EXPECT_FALSE(asyncSubscription.tryNext().has_value());
+
+    // set after the cancellation -> called right away
+    asyncSubscription.setCancellationHandler([&numCalls]() { ++numCalls; });
+    EXPECT_EQ(2, numCalls);
+}
+
+TEST(Test_AsyncSubcription, isAbandoned_onlyProducerReferenceLeft_trueWithoutItemCallback) {
+    auto subscription = std::make_shared<AsyncSubscription<int>>();
+    auto consumer     = subscription;
+    EXPECT_FALSE(AsyncSubscription<int>::isAbandoned(subscription));
+
+    consumer.reset();
+    EXPECT_TRUE(AsyncSubscription<int>::isAbandoned(subscription));
+
+    // callbacks are commonly registered without keeping the subscription
+    subscription->onItem([](const int&) {});
+    EXPECT_FALSE(AsyncSubscription<int>::isAbandoned(subscription));
+    subscription->cancel();
+    EXPECT_TRUE(AsyncSubscription<int>::isAbandoned(subscription));
+}
@@ -0,0 +1,209 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/CallbackExecutor.h"
+#include "sdk/AsyncResult.h"
+#include "sdk/EventLoop.h"
+#include "sdk/Exceptions.h"
+#include "sdk/Executor.h"
+#include "sdk/Strand.h"
+#include "sdk/ThreadPool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+using namespace std::chrono_literals;
+
+namespace {
+constexpr auto DEFAULT_TIMEOUT = 1s;
+
+// wait until all callbacks executed so far have been executed
+bool drain(const CallbackExecutorPtr_t& executor, const StrandPtr_t& strand = nullptr) {
+    std::promise<void> drained;
+    executor->execute([&drained]() { drained.set_value(); }, strand);
+    return drained.get_future().wait_for(DEFAULT_TIMEOUT) == std::future_status::ready;
+}
+} // namespace
+
+TEST(Test_CallbackExecutor, createInline_execute_runsInCallingThreadAndRecordsMetrics) {
+    auto executor = CallbackExecutor::createInline();
+    ASSERT_EQ(CallbackExecution::INLINE, executor->getExecution());
+    EXPECT_EQ(nullptr, executor->getThreadPool());
+
+    std::thread::id callbackThread;
+    executor->execute([&callbackThread]() {
+        callbackThread = std::this_thread::get_id();
+        std::this_thread::sleep_for(1ms);
+    });
+
+    EXPECT_EQ(std::this_thread::get_id(), callbackThread);
+    const auto metrics = executor->getMetrics();
+    EXPECT_EQ(1, metrics.dispatchLatency.count);
+    EXPECT_EQ(1, metrics.executionTime.count);
+    EXPECT_GE(metrics.executionTime.max, std::chrono::nanoseconds(1ms).count());
+}
+
+TEST(Test_CallbackExecutor, createPool_execute_runsOnWorkerOfPool) {
+    auto executor = CallbackExecutor::createPool();
+    ASSERT_EQ(CallbackExecution::POOL, executor->getExecution());
+    EXPECT_EQ(ThreadPool::getInstance(), executor->getThreadPool());
+
+    std::promise<std::thread::id> callbackThread;
+    executor->execute(
+        [&callbackThread]() { callbackThread.set_value(std::this_thread::get_id()); });
+
+    auto future = callbackThread.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(DEFAULT_TIMEOUT));
+    EXPECT_NE(std::this_thread::get_id(), future.get());
+    ASSERT_TRUE(drain(executor));
+    EXPECT_EQ(2, executor->getMetrics().dispatchLatency.count);
+}
+
+TEST(Test_CallbackExecutor, createPool_executeViaStrand_executedInOrder) {
+    constexpr int    NUM_CALLBACKS = 100;
+    auto             executor      = CallbackExecutor::createPool();
+    auto             strand        = Strand::create(executor->getThreadPool());
+    std::vector<int> executionOrder;
+    for (int i = 0; i < NUM_CALLBACKS; ++i) {
+        executor->execute([&executionOrder, i]() { executionOrder.push_back(i); }, strand);
+    }
+
+    ASSERT_TRUE(drain(executor, strand));
+    ASSERT_EQ(NUM_CALLBACKS, executionOrder.size());
+    for (int i = 0; i < NUM_CALLBACKS; ++i) {
+        EXPECT_EQ(i, executionOrder[i]);
+    }
+}
+
+TEST(Test_CallbackExecutor, createStrand_executeFromMultipleThreads_neverExecutedConcurrently) {
+    constexpr int NUM_THREADS              = 4;
+    constexpr int NUM_CALLBACKS_PER_THREAD = 100;
+    auto          executor                 = CallbackExecutor::createStrand();
+    ASSERT_EQ(CallbackExecution::STRAND, executor->getExecution());
+
+    std::atomic_int          numRunning{0};
+    std::atomic_bool         overlapDetected{false};
+    int                      numExecuted{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < NUM_CALLBACKS_PER_THREAD; ++i) {
+                executor->execute([&]() {
+                    if (numRunning.fetch_add(1) != 0) {
+                        overlapDetected = true;
+                    }
+                    ++numExecuted;
+                    numRunning.fetch_sub(1);
+                });
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_TRUE(drain(executor));
+    EXPECT_FALSE(overlapDetected);
+    EXPECT_EQ(NUM_THREADS * NUM_CALLBACKS_PER_THREAD, numExecuted);
+}
+
+TEST(Test_CallbackExecutor, createEventLoop_execute_runByLoopInOrder) {
+    auto eventLoop = EventLoop::create();
+    auto executor  = CallbackExecutor::createEventLoop(eventLoop);
+    ASSERT_EQ(CallbackExecution::EVENT_LOOP, executor->getExecution());
+    EXPECT_EQ(eventLoop, executor->getEventLoop());
+    EXPECT_EQ(nullptr, executor->getThreadPool());
+
+    std::vector<int> order;
+    executor->execute([&order]() { order.push_back(1); });
+    executor->execute([&order]() { order.push_back(2); }, Strand::create());
+    EXPECT_TRUE(order.empty());
+
+    EXPECT_EQ(2, eventLoop->poll());
+    EXPECT_EQ((std::vector<int>{1, 2}), order);
+    EXPECT_EQ(2, executor->getMetrics().executionTime.count);
+}
+
+TEST(Test_CallbackExecutor, createExecutor_execute_postedToExecutor) {
+    auto eventLoop = EventLoop::create();
+    auto executor  = IExecutor::createEventLoop(eventLoop);
+    auto callbacks = CallbackExecutor::createExecutor(executor);
+    ASSERT_EQ(CallbackExecution::EXECUTOR, callbacks->getExecution());
+    EXPECT_EQ(executor, callbacks->getExecutor());
+    EXPECT_EQ(nullptr, callbacks->getThreadPool());
+
+    std::vector<int> order;
+    callbacks->execute([&order]() { order.push_back(1); });
+    callbacks->execute([&order]() { order.push_back(2); });
+    EXPECT_TRUE(order.empty());
+
+    EXPECT_EQ(2, eventLoop->poll());
+    EXPECT_EQ((std::vector<int>{1, 2}), order);
+    EXPECT_EQ(2, callbacks->getMetrics().dispatchLatency.count);
+    EXPECT_THROW(CallbackExecutor::createExecutor(nullptr), InvalidValueException);
+}
+
+TEST(Test_CallbackExecutor, execute_callbackThrows_exceptionPropagatedAndTimeRecorded) {
+    auto executor = CallbackExecutor::createInline();
+
+    EXPECT_THROW(executor->execute([]() { throw std::runtime_error("callback failed"); }),
+                 std::runtime_error);
+    EXPECT_EQ(1, executor->getMetrics().executionTime.count);
+}
+
+TEST(Test_CallbackExecutor, resetMetrics_afterExecutions_metricsCleared) {
+    auto executor = CallbackExecutor::createInline();
+    executor->execute([]() {});
+
+    executor->resetMetrics();
+
+    const auto metrics = executor->getMetrics();
+    EXPECT_EQ(0, metrics.dispatchLatency.count);
+    EXPECT_EQ(0, metrics.executionTime.count);
+}
+
+TEST(Test_CallbackExecutor, getPriorityInstance_subscription_itemsScheduledWithItsClass) {
+    const auto& executor = CallbackExecutor::getPriorityInstance(JobPriority::HIGH);
+    ASSERT_EQ(executor, CallbackExecutor::getPriorityInstance(JobPriority::HIGH));
+    EXPECT_EQ(JobPriority::HIGH, executor->getPriority());
+    EXPECT_EQ(CallbackExecution::POOL, executor->getExecution());
+    const auto numHighPriorityJobs =
+        executor->getThreadPool()->getMetrics().schedulingLatencyByPriority[0].count;
+
+    AsyncSubscription<int> subscription;
+    subscription.setCallbackExecutor(executor);
+    std::promise<void> delivered;
+    subscription.onItem([&delivered](const int&) { delivered.set_value(); });
+    subscription.insertNewItem(1);
+
+    ASSERT_EQ(std::future_status::ready, delivered.get_future().wait_for(DEFAULT_TIMEOUT));
+    EXPECT_GT(executor->getThreadPool()->getMetrics().schedulingLatencyByPriority[0].count,
+              numHighPriorityJobs);
+}
+
+TEST(Test_CallbackExecutor, createStrand_strandOfPriorityClass_executorOfSameClass) {
+    auto executor = CallbackExecutor::createStrand(Strand::create(nullptr, JobPriority::LOW));
+
+    EXPECT_EQ(JobPriority::LOW, executor->getPriority());
+    EXPECT_EQ(JobPriority::NORMAL, CallbackExecutor::createPool()->getPriority());
+}
@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#include "sdk/ClockOffsetEstimator.h"
+
+#include "sdk/Exceptions.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+using namespace velocitas;
+using namespace std::chrono_literals;
+
+namespace {
+
+using Clock_t = ClockOffsetEstimator::Clock_t;
+
+// the broker's clock is 1000 s ahead of the local one
+constexpr auto OFFSET = 1000s;
+
+const Clock_t::time_point START{10s};
+
+// broker timestamp taken at the passed local time point
+Timestamp brokerTimeAt(Clock_t::time_point localTime) {
+    const auto nanos =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(localTime.time_since_epoch() + OFFSET)
+            .count();
+    return Timestamp{nanos / 1000000000, static_cast<int32_t>(nanos % 1000000000)};
+}
+
+} // namespace
+
+TEST(Test_ClockOffsetEstimator, getOffset_noSamples_noEstimate) {
+    ClockOffsetEstimator estimator;
+    EXPECT_FALSE(estimator.getOffset().has_value());
+    EXPECT_FALSE(estimator.toLocal(brokerTimeAt(START)).has_value());
+
+    estimator.addOneWay(Timestamp{}, START);
+    EXPECT_FALSE(estimator.getOffset().has_value());
+    EXPECT_EQ(0, estimator.getNumSamples());
+}
+
+TEST(Test_ClockOffsetEstimator, getOffset_roundTrips_leastDelayedSampleWithHalfRoundTrip) {
+    ClockOffsetEstimator estimator;
+    // stamped in the middle of a round trip of 2 ms
+    estimator.addRoundTrip(START, brokerTimeAt(START + 1ms), START + 2ms);
+    // stale value, read by a longer round trip
+    estimator.addRoundTrip(START + 10ms, brokerTimeAt(START), START + 15ms);
+
+    ASSERT_TRUE(estimator.getOffset().has_value());
+    EXPECT_EQ(OFFSET, *estimator.getOffset());
+    EXPECT_EQ(START + 1ms, estimator.toLocal(brokerTimeAt(START + 1ms)));
+    EXPECT_EQ(4ms, estimator.getLatency(brokerTimeAt(START + 1ms), START + 5ms));
+    EXPECT_EQ(2, estimator.getNumSamples());
+}
+
+TEST(Test_ClockOffsetEstimator, getOffset_oneWaySamples_tightestBoundUsed) {
+    ClockOffsetEstimator estimator;
+    estimator.addRoundTrip(START, brokerTimeAt(START + 1ms), START + 2ms);
+    // an update delivered faster than the round trips suggest tightens the bound
+    estimator.addOneWay(brokerTimeAt(START + 5ms), START + 5ms + 200us);
+    estimator.addOneWay(brokerTimeAt(START + 6ms), START + 9ms);
+
+    EXPECT_EQ(OFFSET + 800us, *estimator.getOffset());
+}
+
+TEST(Test_ClockOffsetEstimator, getOffset_samplesOutsideWindow_expired) {
+    ClockOffsetEstimator estimator(8s);
+    estimator.addOneWay(brokerTimeAt(START), START);
+    EXPECT_EQ(OFFSET, *estimator.getOffset());
+
+    // the broker's clock was set back by 1 s, which the old sample hides until it expires
+    auto       now         = START + 1s;
+    const auto steppedBack = [](Clock_t::time_point localTime) {
+        auto timestamp = brokerTimeAt(localTime);
+        timestamp.seconds -= 1;
+        return timestamp;
+    };
+    estimator.addOneWay(steppedBack(now), now);
+    EXPECT_EQ(OFFSET, *estimator.getOffset());
+
+    now = START + 10s;
+    estimator.addOneWay(steppedBack(now), now);
+    EXPECT_EQ(OFFSET - 1s, *estimator.getOffset());
+
+    // late samples of expired buckets are ignored
+    estimator.addOneWay(brokerTimeAt(START), START);
+    EXPECT_EQ(OFFSET - 1s, *estimator.getOffset());
+}
+
+TEST(Test_ClockOffsetEstimator, constructor_tooShortWindow_throws) {
+    EXPECT_THROW(ClockOffsetEstimator(0s), InvalidValueException);
+}
@@ -0,0 +1,239 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/ColumnarBatch.h"
+
+#include "sdk/DataPoint.h"
+#include "sdk/DataPointReply.h"
+#include "sdk/Exceptions.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+
+TEST(Test_ColumnarBatch, append_scalarSamples_storedInColumnBuffers) {
+    ColumnarBatch batch;
+
+    batch.append("A.Speed", DataPointSample(1.5F, Timestamp{1, 2}));
+    batch.append("A.Speed", DataPointSample(DataPointValue::Type::FLOAT,
+                                            DataPointValue::Failure::NOT_AVAILABLE, Timestamp{3}));
+    batch.append("A.Speed", DataPointSample(3.5F, Timestamp{4, 5}));
+
+    ASSERT_EQ(1, batch.size());
+    const auto* column = batch.find("A.Speed");
+    ASSERT_NE(nullptr, column);
+    EXPECT_EQ("A.Speed", column->getPath());
+    EXPECT_EQ(DataPointValue::Type::FLOAT, column->getType());
+    ASSERT_EQ(3, column->size());
+    EXPECT_EQ(1, column->getNullCount());
+    EXPECT_EQ((std::vector<int64_t>{1000000002, 3000000000, 4000000005}),
+              column->getTimestamps());
+    EXPECT_EQ((std::vector<uint8_t>{0b101}), column->getValidity());
+    EXPECT_EQ(3 * sizeof(float), column->getValueBuffer().size());
+    EXPECT_EQ(1.5F, column->getValues<float>()[0]);
+    EXPECT_EQ(3.5F, column->getValues<float>()[2]);
+
+    EXPECT_EQ(DataPointSample(3.5F, Timestamp{4, 5}), column->getSample(2));
+    EXPECT_FALSE(column->getSample(1).isValid());
+    EXPECT_EQ((Timestamp{3}), column->getSample(1).getTimestamp());
+}
+
+TEST(Test_ColumnarBatch, append_stringsAndArrays_storedWithOffsets) {
+    ColumnarBatch batch;
+
+    batch.append("A.Name", DataPointSample(std::string("ab")));
+    batch.append("A.Name", DataPointSample(std::string("cde")));
+    batch.append("A.Names", DataPointSample(std::vector<std::string>{"x", "yz"}));
+    batch.append("A.Names", DataPointSample(std::vector<std::string>{}));
+    batch.append("A.Names", DataPointSample(std::vector<std::string>{"w"}));
+    batch.append("A.Flags", DataPointSample(std::vector<bool>{true, false, true}));
+    batch.append("A.Flags", DataPointSample(std::vector<bool>{false, true}));
+
+    const auto* names = batch.find("A.Name");
+    ASSERT_NE(nullptr, names);
+    EXPECT_EQ((std::vector<int32_t>{0, 2, 5}), names->getOffsets());
+    EXPECT_EQ("abcde", std::string(names->getCharData().begin(), names->getCharData().end()));
+
+    const auto* arrays = batch.find("A.Names");
+    ASSERT_NE(nullptr, arrays);
+    EXPECT_EQ((std::vector<int32_t>{0, 2, 2, 3}), arrays->getOffsets());
+    EXPECT_EQ((std::vector<int32_t>{0, 1, 3, 4}), arrays->getElementOffsets());
+    EXPECT_EQ(DataPointSample(std::vector<std::string>{"x", "yz"}), arrays->getSample(0));
+    EXPECT_EQ(DataPointSample(std::vector<std::string>{"w"}), arrays->getSample(2));
+
+    const auto* flags = batch.find("A.Flags");
+    ASSERT_NE(nullptr, flags);
+    EXPECT_EQ((std::vector<int32_t>{0, 3, 5}), flags->getOffsets());
+    EXPECT_EQ((std::vector<uint8_t>{0b10101}), flags->getValueBuffer());
+    EXPECT_EQ(DataPointSample(std::vector<bool>{false, true}), flags->getSample(1));
+}
+
+TEST(Test_ColumnarBatch, append_reply_oneColumnPerSignal) {
+    DataPointReply reply;
+    reply.set("A.X", DataPointSample(int32_t{1}));
+    reply.set("A.Y", std::make_shared<TypedDataPointValue<double>>("A.Y", 2.0));
+    ColumnarBatch batch;
+
+    batch.append(reply);
+    batch.append(reply);
+
+    ASSERT_EQ(2, batch.size());
+    EXPECT_EQ(2, batch.find("A.X")->size());
+    EXPECT_EQ(1, batch.find("A.X")->getValues<int32_t>()[1]);
+    EXPECT_EQ(2.0, batch.find("A.Y")->getValues<double>()[1]);
+}
+
+TEST(Test_ColumnarBatch, append_dataPointValue_columnOfDataPointType) {
+    DataPointInt16 dataPoint{"A.Gear", nullptr};
+    ColumnarBatch  batch;
+
+    batch.append(dataPoint, int16_t{-3}, Timestamp{7});
+
+    const auto* column = batch.find(dataPoint.getSignalHandle());
+    ASSERT_NE(nullptr, column);
+    EXPECT_EQ(DataPointValue::Type::INT16, column->getType());
+    EXPECT_EQ(-3, column->getValues<int16_t>()[0]);
+}
+
+TEST(Test_ColumnarBatch, append_transportedValueOfNarrowColumn_narrowedOrNull) {
+    ColumnarBatch batch;
+    batch.addColumn("A.Level", DataPointValue::Type::UINT8);
+
+    batch.append("A.Level", DataPointSample(uint32_t{200}));
+    batch.append("A.Level", DataPointSample(uint32_t{300}));
+
+    const auto* column = batch.find("A.Level");
+    ASSERT_EQ(2, column->size());
+    EXPECT_EQ(2, column->getValueBuffer().size());
+    EXPECT_EQ(200, column->getValues<uint8_t>()[0]);
+    EXPECT_TRUE(column->isValid(0));
+    EXPECT_FALSE(column->isValid(1));
+    EXPECT_EQ(1, column->getNullCount());
+}
+
+TEST(Test_ColumnarBatch, append_sampleOfOtherType_throws) {
+    ColumnarBatch batch;
+    batch.append("A.X", DataPointSample(int32_t{1}));
+
+    EXPECT_THROW(batch.append("A.X", DataPointSample(1.0F)), InvalidTypeException);
+    EXPECT_EQ(1, batch.find("A.X")->size());
+}
+
+TEST(Test_ColumnarBatch, append_typeUnknownUntilValidSample_priorRowsNull) {
+    ColumnarBatch batch;
+
+    batch.append("A.X", DataPointSample(DataPointValue::Type::INVALID,
+                                        DataPointValue::Failure::UNKNOWN_DATAPOINT));
+    batch.append("A.X", DataPointSample(uint64_t{9}));
+
+    const auto* column = batch.find("A.X");
+    EXPECT_EQ(DataPointValue::Type::UINT64, column->getType());
+    EXPECT_EQ(2 * sizeof(uint64_t), column->getValueBuffer().size());
+    EXPECT_FALSE(column->isValid(0));
+    EXPECT_EQ(9, column->getValues<uint64_t>()[1]);
+}
+
+TEST(Test_ColumnarBatch, clear_rowsRemovedColumnsKept) {
+    ColumnarBatch batch;
+    batch.append("A.Name", DataPointSample(std::string("ab")));
+
+    batch.clear();
+    batch.append("A.Name", DataPointSample(std::string("c")));
+
+    ASSERT_EQ(1, batch.size());
+    EXPECT_EQ(1, batch.find("A.Name")->size());
+    EXPECT_EQ((std::vector<int32_t>{0, 1}), batch.find("A.Name")->getOffsets());
+}
+
+TEST(Test_ColumnarBatch, exportToArrow_scalarColumn_structOfTimestampAndValue) {
+    ColumnarBatch batch;
+    batch.append("A.Speed", DataPointSample(1.5F, Timestamp{1}));
+    batch.append("A.Speed", DataPointSample(DataPointValue::Type::FLOAT,
+                                            DataPointValue::Failure::NOT_AVAILABLE, Timestamp{2}));
+    const auto handle = batch.find("A.Speed")->getHandle();
+
+    ArrowSchema schema{};
+    ArrowArray  array{};
+    batch.exportToArrow(handle, &schema, &array);
+
+    EXPECT_STREQ("+s", schema.format);
+    EXPECT_STREQ("A.Speed", schema.name);
+    ASSERT_EQ(2, schema.n_children);
+    EXPECT_STREQ("tsn:UTC", schema.children[0]->format);
+    EXPECT_STREQ("timestamp", schema.children[0]->name);
+    EXPECT_STREQ("f", schema.children[1]->format);
+    EXPECT_EQ(ARROW_FLAG_NULLABLE, schema.children[1]->flags);
+
+    EXPECT_EQ(2, array.length);
+    ASSERT_EQ(2, array.n_children);
+    const auto* timestamps = static_cast<const int64_t*>(array.children[0]->buffers[1]);
+    EXPECT_EQ(2000000000, timestamps[1]);
+    const auto* values = array.children[1];
+    EXPECT_EQ(1, values->null_count);
+    EXPECT_EQ(0b01, *static_cast<const uint8_t*>(values->buffers[0]));
+    EXPECT_EQ(1.5F, static_cast<const float*>(values->buffers[1])[0]);
+
+    EXPECT_TRUE(batch.find(handle)->empty());
+    EXPECT_EQ(DataPointValue::Type::FLOAT, batch.find(handle)->getType());
+
+    array.release(&array);
+    schema.release(&schema);
+    EXPECT_EQ(nullptr, array.release);
+    EXPECT_EQ(nullptr, schema.release);
+}
+
+TEST(Test_ColumnarBatch, exportToArrow_arrayColumn_listWithChildArray) {
+    ColumnarBatch batch;
+    batch.append("A.Names", DataPointSample(std::vector<std::string>{"x", "yz"}));
+    const auto handle = batch.find("A.Names")->getHandle();
+
+    ArrowSchema schema{};
+    ArrowArray  array{};
+    batch.exportToArrow(handle, &schema, &array);
+
+    const auto* valueSchema = schema.children[1];
+    EXPECT_STREQ("+l", valueSchema->format);
+    ASSERT_EQ(1, valueSchema->n_children);
+    EXPECT_STREQ("u", valueSchema->children[0]->format);
+
+    const auto* elements = array.children[1]->children[0];
+    EXPECT_EQ(2, elements->length);
+    const auto* offsets = static_cast<const int32_t*>(elements->buffers[1]);
+    const auto* chars   = static_cast<const char*>(elements->buffers[2]);
+    EXPECT_EQ("yz", std::string(chars + offsets[1], offsets[2] - offsets[1]));
+
+    // a child moved out by the consumer outlives its parent
+    ArrowArray movedElements = *array.children[1]->children[0];
+    array.children[1]->children[0]->release = nullptr;
+    array.release(&array);
+    EXPECT_EQ(0, std::memcmp("xyz", movedElements.buffers[2], 3));
+    movedElements.release(&movedElements);
+    schema.release(&schema);
+}
+
+TEST(Test_ColumnarBatch, exportToArrow_unknownSignal_throws) {
+    ColumnarBatch batch;
+    ArrowSchema   schema{};
+    ArrowArray    array{};
+
+    EXPECT_THROW(batch.exportToArrow(SignalPathRegistry::getInstance().intern("A.Unknown"),
+                                     &schema, &array),
+                 InvalidValueException);
+}
@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/Coroutine.h"
+
+#include <gtest/gtest.h>
+
+// coroutines are only available when compiling with C++20 or later
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+using namespace std::chrono_literals;
+
+namespace {
+constexpr auto DEFAULT_TIMEOUT = 1s;
+
+template <typename T> AsyncResultPtr_t<T> completeLater(T value) {
+    auto result = std::make_shared<AsyncResult<T>>();
+    std::thread([result, value]() mutable {
+        std::this_thread::sleep_for(5ms);
+        result->insertResult(std::move(value));
+    }).detach();
+    return result;
+}
+
+Task<int> add(int left, int right) {
+    const auto leftValue  = co_await completeLater(left);
+    const auto rightValue = co_await completeLater(right);
+    co_return leftValue + rightValue;
+}
+} // namespace
+
+class Test_Coroutine : public ::testing::Test {
+protected:
+    // Detached tasks may release their reference to the pool after the test finished, so the
+    // pool is kept alive by the registry (releasing the last reference by a worker would join it
+    // to itself).
+    static void SetUpTestSuite() {
+        ThreadPool::configure({"coroutine", 2, SchedulingMode::SHARED_QUEUE, {}, 0});
+    }
+
+    std::shared_ptr<ThreadPool> m_pool{ThreadPool::getInstance("coroutine")};
+};
+
+TEST_F(Test_Coroutine, coAwait_asyncResults_resultsReturned) {
+    std::promise<int> sum;
+    spawn(
+        [](std::promise<int>& sum) -> Task<> { sum.set_value(co_await add(1, 2)); }(sum),
+        m_pool);
+
+    auto future = sum.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(DEFAULT_TIMEOUT));
+    EXPECT_EQ(3, future.get());
+}
+
+TEST_F(Test_Coroutine, coAwait_failedAsyncResult_throwsAsyncException) {
+    std::promise<std::string> error;
+    spawn(
+        [](std::promise<std::string>& error) -> Task<> {
+            auto result = std::make_shared<AsyncResult<int>>();
+            result->insertError(Status("failure"));
+            try {
+                co_await result;
+            } catch (const AsyncException& e) {
+                error.set_value(e.what());
+            }
+        }(error),
+        m_pool);
+
+    auto future = error.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(DEFAULT_TIMEOUT));
+    EXPECT_EQ("failure", future.get());
+}
+
+TEST_F(Test_Coroutine, coAwait_asyncResult_resumedOnExecutor) {
+    ThreadPool::configure({"coroutine-single", 1, SchedulingMode::SHARED_QUEUE, {}, 0});
+    auto                          pool = ThreadPool::getInstance("coroutine-single");
+    std::promise<std::thread::id> workerThread;
+    pool->post([&workerThread]() { workerThread.set_value(std::this_thread::get_id()); });
+
+    std::promise<std::thread::id> resumingThread;
+    spawn(
+        [](std::promise<std::thread::id>& resumingThread) -> Task<> {
+            // completed by a thread not belonging to the pool
+            co_await completeLater(1);
+            resumingThread.set_value(std::this_thread::get_id());
+        }(resumingThread),
+        pool);
+
+    auto future = resumingThread.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(DEFAULT_TIMEOUT));
+    EXPECT_EQ(workerThread.get_future().get(), future.get());
+}
+
+TEST_F(Test_Coroutine, spawn_manyConcurrentFlows_allComplete) {
+    constexpr int      NUM_FLOWS = 1000;
+    std::atomic_int    numCompleted{0};
+    std::promise<void> allCompleted;
+    for (int i = 0; i < NUM_FLOWS; ++i) {
+        spawn(
+            [](std::atomic_int& numCompleted, std::promise<void>& allCompleted) -> Task<> {
+                auto result = std::make_shared<AsyncResult<int>>();
+                result->insertResult(1);
+                co_await result;
+                if (++numCompleted == NUM_FLOWS) {
+                    allCompleted.set_value();
+                }
+            }(numCompleted, allCompleted),
+            m_pool);
+    }
+
+    ASSERT_EQ(std::future_status::ready, allCompleted.get_future().wait_for(DEFAULT_TIMEOUT));
+}
+
+TEST_F(Test_Coroutine, spawn_taskThrows_workerNotTerminated) {
+    spawn([]() -> Task<> { throw std::runtime_error("failure"); co_return; }(), m_pool);
+
+    std::promise<void> executed;
+    m_pool->post([&executed]() { executed.set_value(); });
+    EXPECT_EQ(std::future_status::ready, executed.get_future().wait_for(DEFAULT_TIMEOUT));
+}
+
+TEST_F(Test_Coroutine, subscriptionStream_itemsInsertedLater_itemsReturnedInOrder) {
+    auto                           subscription = std::make_shared<AsyncSubscription<int>>();
+    std::promise<std::vector<int>> items;
+    spawn(
+        [](AsyncSubscriptionPtr_t<int> subscription,
+           std::promise<std::vector<int>>& items) -> Task<> {
+            AsyncSubscriptionStream<int> stream{std::move(subscription)};
+            std::vector<int>             received;
+            for (int i = 0; i < 3; ++i) {
+                received.push_back(co_await stream.next());
+            }
+            items.set_value(received);
+        }(subscription, items),
+        m_pool);
+
+    for (int i = 0; i < 3; ++i) {
+        std::this_thread::sleep_for(2ms);
+        subscription->insertNewItem(std::move(i));
+    }
+
+    auto future = items.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(DEFAULT_TIMEOUT));
+    EXPECT_EQ((std::vector<int>{0, 1, 2}), future.get());
+}
+
+TEST_F(Test_Coroutine, subscriptionStream_errorInserted_throws) {
+    auto               subscription = std::make_shared<AsyncSubscription<int>>();
+    std::promise<bool> failed;
+    spawn(
+        [](AsyncSubscriptionPtr_t<int> subscription, std::promise<bool>& failed) -> Task<> {
+            AsyncSubscriptionStream<int> stream{std::move(subscription)};
+            try {
+                co_await stream.next();
+                failed.set_value(false);
+            } catch (const AsyncException&) {
+                failed.set_value(true);
+            }
+        }(subscription, failed),
+        m_pool);
+
+    std::this_thread::sleep_for(5ms);
+    subscription->insertError(Status("failure"));
+
+    auto future = failed.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(DEFAULT_TIMEOUT));
+    EXPECT_TRUE(future.get());
+}
+
+#endif // __cpp_impl_coroutine
@@ -27,6 +27,7 @@
 #include <gtest/gtest.h>
 
 using namespace velocitas;
+using ::testing::InSequence;
 using ::testing::Pointee;
 using ::testing::Return;
 using ::testing::UnorderedElementsAre;
@@ -123,3 +124,39 @@ TEST_F(Test_DataPointBatch, apply_threePoints_requestContainsThreePoints) {
     const auto errorMap = batch.apply()->await();
     EXPECT_TRUE(errorMap.empty());
 }
+
+TEST_F(Test_DataPointBatch, prepare_noPoints_throwException) {
+    DataPointBatch batch;
+    EXPECT_THROW(batch.prepare(), InvalidValueException);
+}
+
+TEST_F(Test_DataPointBatch, preparedApply_valuesChanged_requestContainsCurrentValues) {
+    DataPointInt32 dataPoint1{"foo", nullptr};
+    DataPointFloat dataPoint2{"bar", nullptr};
+    {
+        InSequence sequence;
+        EXPECT_CALL(*m_vdbcMock,
+                    setDatapoints(UnorderedElementsAre(
+                        Pointee(TypedDataPointValue<DataPointInt32::value_type>("foo", 1)),
+                        Pointee(TypedDataPointValue<DataPointFloat::value_type>("bar", 2.F)))))
+            .WillOnce(Return(m_asyncResult));
+        EXPECT_CALL(*m_vdbcMock,
+                    setDatapoints(UnorderedElementsAre(
+                        Pointee(TypedDataPointValue<DataPointInt32::value_type>("foo", 3)),
+                        Pointee(TypedDataPointValue<DataPointFloat::value_type>("bar", 2.F)))))
+            .WillOnce(Return(m_asyncResult));
+    }
+
+    auto batch = DataPointBatch().add(dataPoint1, 1).add(dataPoint2, 2.F).prepare();
+    EXPECT_EQ(2, batch.size());
+    EXPECT_TRUE(batch.apply()->await().empty());
+    EXPECT_TRUE(batch.set(dataPoint1, 3).apply()->await().empty());
+}
+
+TEST_F(Test_DataPointBatch, preparedSet_pointNotInBatch_throwException) {
+    DataPointInt32 dataPoint1{"foo", nullptr};
+    DataPointInt32 dataPoint2{"bar", nullptr};
+
+    auto batch = DataPointBatch().add(dataPoint1, 1).prepare();
+    EXPECT_THROW(batch.set(dataPoint2, 2), InvalidValueException);
+}
@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/DataPointReply.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+std::shared_ptr<DataPointValue> createValue(const std::string& path, int32_t value) {
+    return std::make_shared<TypedDataPointValue<int32_t>>(path, value);
+}
+} // namespace
+
+TEST(Test_DataPointReply, getUntyped_pathContained_returnsValue) {
+    DataPointReply reply;
+    reply.set("A.B", createValue("A.B", 1));
+    reply.set("A.C", createValue("A.C", 2));
+
+    EXPECT_EQ("A.C", reply.getUntyped("A.C")->getPath());
+    EXPECT_EQ(2, reply.size());
+}
+
+TEST(Test_DataPointReply, getUntyped_pathNotContained_throws) {
+    DataPointReply reply;
+    EXPECT_THROW(reply.getUntyped("A.B"), InvalidValueException);
+    reply.set("A.B", createValue("A.B", 1));
+    EXPECT_THROW(reply.getUntyped("A.C"), InvalidValueException);
+}
+
+TEST(Test_DataPointReply, find_pathNotContained_returnsNullptr) {
+    DataPointReply reply;
+    EXPECT_EQ(nullptr, reply.find("A.B"));
+    reply.set("A.B", createValue("A.B", 1));
+    EXPECT_EQ(nullptr, reply.find("A.C"));
+    EXPECT_NE(nullptr, reply.find("A.B"));
+}
+
+TEST(Test_DataPointReply, set_pathContainedAlready_valueReplaced) {
+    DataPointReply reply;
+    auto           newValue = createValue("A.B", 2);
+    reply.set("A.B", createValue("A.B", 1));
+    reply.set("A.B", newValue);
+
+    EXPECT_EQ(1, reply.size());
+    EXPECT_EQ(newValue, reply.getUntyped("A.B"));
+}
+
+TEST(Test_DataPointReply, set_manyDataPoints_allFoundInInsertionOrder) {
+    constexpr auto NUM_DATA_POINTS{1000};
+
+    DataPointReply reply;
+    for (int i = 0; i < NUM_DATA_POINTS; ++i) {
+        const auto path = "Vehicle.Signal" + std::to_string(i);
+        reply.set(path, createValue(path, i));
+    }
+
+    ASSERT_EQ(NUM_DATA_POINTS, reply.size());
+    for (int i = 0; i < NUM_DATA_POINTS; ++i) {
+        const auto path = "Vehicle.Signal" + std::to_string(i);
+        EXPECT_EQ(path, reply.getUntyped(path)->getPath());
+    }
+    int index = 0;
+    for (const auto& entry : reply) {
+        EXPECT_EQ("Vehicle.Signal" + std::to_string(index++), entry.getPath());
+    }
+}
+
+TEST(Test_DataPointReply, erase_containedDataPoint_othersKeptInOrder) {
+    auto&          registry = SignalPathRegistry::getInstance();
+    DataPointReply reply;
+    reply.set("A", createValue("A", 1));
+    reply.set("B", createValue("B", 2));
+    reply.set("C", createValue("C", 3));
+
+    EXPECT_TRUE(reply.erase(registry.intern("A")));
+    EXPECT_FALSE(reply.erase(registry.intern("A")));
+
+    ASSERT_EQ(2, reply.size());
+    EXPECT_EQ(nullptr, reply.find("A"));
+    EXPECT_EQ("B", reply.getUntyped("B")->getPath());
+    EXPECT_EQ("C", reply.getUntyped("C")->getPath());
+    EXPECT_EQ("B", reply.begin()->getPath());
+}
+
+TEST(Test_DataPointReply, constructFromMap_allDataPointsContained) {
+    DataPointReply reply(DataPointMap_t{{"A", createValue("A", 1)}, {"B", createValue("B", 2)}});
+
+    EXPECT_EQ(2, reply.size());
+    EXPECT_EQ("A", reply.getUntyped("A")->getPath());
+    EXPECT_EQ("B", reply.getUntyped("B")->getPath());
+}
+
+TEST(Test_DataPointReply, merge_overlappingReplies_newerValuesWin) {
+    auto           newValue = createValue("B", 3);
+    DataPointReply reply;
+    reply.set("A", createValue("A", 1));
+    reply.set("B", createValue("B", 2));
+    DataPointReply newerReply;
+    newerReply.set("B", newValue);
+    newerReply.set("C", createValue("C", 4));
+
+    reply.merge(std::move(newerReply));
+
+    EXPECT_EQ(3, reply.size());
+    EXPECT_EQ(newValue, reply.getUntyped("B"));
+    EXPECT_NE(nullptr, reply.find("C"));
+}
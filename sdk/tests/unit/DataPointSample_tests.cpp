@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/DataPointReply.h"
+#include "sdk/DataPointSample.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+
+TEST(Test_DataPointSample, getIf_validValueOfRequestedType_returnsValue) {
+    DataPointSample sample(42.5F, Timestamp{1, 2});
+
+    ASSERT_NE(nullptr, sample.getIf<float>());
+    EXPECT_EQ(42.5F, *sample.getIf<float>());
+    EXPECT_EQ(DataPointValue::Type::FLOAT, sample.getType());
+    EXPECT_TRUE(sample.isValid());
+    EXPECT_EQ((Timestamp{1, 2}), sample.getTimestamp());
+}
+
+TEST(Test_DataPointSample, getIf_otherType_returnsNullptr) {
+    DataPointSample sample(int32_t{3});
+    EXPECT_EQ(nullptr, sample.getIf<float>());
+}
+
+TEST(Test_DataPointSample, get_otherType_throws) {
+    DataPointSample sample(std::string("foo"));
+    EXPECT_THROW(std::ignore = sample.get<int32_t>(), InvalidTypeException);
+    EXPECT_EQ("foo", sample.get<std::string>());
+}
+
+TEST(Test_DataPointSample, get_noValidValue_throws) {
+    DataPointSample sample(DataPointValue::Type::INT32, DataPointValue::Failure::NOT_AVAILABLE);
+
+    EXPECT_FALSE(sample.isValid());
+    EXPECT_EQ(nullptr, sample.getIf<int32_t>());
+    EXPECT_THROW(std::ignore = sample.get<int32_t>(), InvalidValueException);
+}
+
+TEST(Test_DataPointSample, toDataPointValue_validValue_typedValueCreated) {
+    DataPointSample sample(std::vector<uint16_t>{1, 2, 3}, Timestamp{5, 6});
+
+    auto value = sample.toDataPointValue("A.B");
+
+    auto typedValue = std::dynamic_pointer_cast<TypedDataPointValue<std::vector<uint16_t>>>(value);
+    ASSERT_NE(nullptr, typedValue);
+    EXPECT_EQ("A.B", typedValue->getPath());
+    EXPECT_EQ((std::vector<uint16_t>{1, 2, 3}), typedValue->value());
+    EXPECT_EQ((Timestamp{5, 6}), typedValue->getTimestamp());
+}
+
+TEST(Test_DataPointSample, toDataPointValue_noValidValue_failureKept) {
+    DataPointSample sample(DataPointValue::Type::BOOL, DataPointValue::Failure::ACCESS_DENIED);
+
+    auto value = sample.toDataPointValue("A.B");
+
+    EXPECT_EQ(DataPointValue::Type::BOOL, value->getType());
+    EXPECT_EQ(DataPointValue::Failure::ACCESS_DENIED, value->getFailure());
+}
+
+TEST(Test_DataPointSample, fromDataPointValue_typedValue_sampleEqualsValue) {
+    TypedDataPointValue<double> value("A.B", 1.5, Timestamp{7, 8});
+
+    auto sample = DataPointSample::fromDataPointValue(value);
+
+    EXPECT_EQ(DataPointSample(1.5, Timestamp{7, 8}), sample);
+}
+
+TEST(Test_DataPointSample, toTypedValue_validValue_typedValueCreated) {
+    DataPointSample sample(true);
+
+    auto typedValue = sample.toTypedValue<bool>("A.B");
+
+    EXPECT_EQ("A.B", typedValue.getPath());
+    EXPECT_TRUE(typedValue.value());
+}
+
+TEST(Test_DataPointSample, toTypedValue_narrowTypeInTransportRange_narrowedValueCreated) {
+    DataPointSample sample(std::vector<int32_t>{-128, 0, 127});
+
+    auto typedValue = sample.toTypedValue<std::vector<int8_t>>("A.B");
+
+    ASSERT_TRUE(typedValue.isValid());
+    EXPECT_EQ((std::vector<int8_t>{-128, 0, 127}), typedValue.value());
+    EXPECT_EQ(uint16_t{65535},
+              DataPointSample(uint32_t{65535}).toTypedValue<uint16_t>("A").value());
+}
+
+TEST(Test_DataPointSample, toTypedValue_narrowTypeOutOfTransportRange_invalidValueFailure) {
+    DataPointSample sample(std::vector<uint32_t>{1, 256});
+
+    auto typedValue = sample.toTypedValue<std::vector<uint8_t>>("A.B");
+
+    EXPECT_FALSE(typedValue.isValid());
+    EXPECT_EQ(DataPointValue::Failure::INVALID_VALUE, typedValue.getFailure());
+    EXPECT_EQ(DataPointValue::Failure::INVALID_VALUE,
+              DataPointSample(int32_t{-129}).toTypedValue<int8_t>("A").getFailure());
+}
+
+TEST(Test_DataPointReply, getUntyped_sampleSet_adapterValueReturned) {
+    DataPointReply reply;
+    reply.set("A.B", DataPointSample(int64_t{12}));
+
+    auto typedValue =
+        std::dynamic_pointer_cast<TypedDataPointValue<int64_t>>(reply.getUntyped("A.B"));
+    ASSERT_NE(nullptr, typedValue);
+    EXPECT_EQ(12, typedValue->value());
+}
+
+TEST(Test_DataPointReply, getSample_dataPointValueSet_sampleOfValueReturned) {
+    DataPointReply reply;
+    reply.set("A.B", std::make_shared<TypedDataPointValue<uint8_t>>("A.B", 7));
+
+    EXPECT_EQ(7, reply.getSample("A.B").get<uint8_t>());
+}
@@ -135,3 +135,13 @@ TEST(Test_DataPoint, get_allDataTypes_forwardedToVdbc) {
     getTestCaseImpl<DataPointString>("foo");                      // NOLINT
     getTestCaseImpl<DataPointStringArray>({"foo", "bar", "baz"}); // NOLINT
 }
+
+TEST(Test_DataPoint, getSignalHandle_internsPath) {
+    Node           parent{"Vehicle"};
+    DataPointFloat dataPoint{"Speed", &parent};
+    DataPointInt32 otherDataPoint{"Speed", &parent};
+
+    EXPECT_EQ("Vehicle.Speed",
+              SignalPathRegistry::getInstance().getPath(dataPoint.getSignalHandle()));
+    EXPECT_EQ(dataPoint.getSignalHandle(), otherDataPoint.getSignalHandle());
+}
@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/EventLoop.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+using namespace std::chrono_literals;
+
+TEST(Test_EventLoop, post_fromOtherThreads_executedInOrderByLoopThread) {
+    constexpr int NUM_FUNCTIONS = 1000;
+    auto          eventLoop     = EventLoop::create();
+    // accessed by the loop thread only, so no synchronization needed
+    std::vector<int> executed;
+    bool             isAlwaysInLoopThread = true;
+
+    std::thread poster([&]() {
+        for (int i = 0; i < NUM_FUNCTIONS; ++i) {
+            eventLoop->post([&, i]() {
+                executed.push_back(i);
+                isAlwaysInLoopThread = isAlwaysInLoopThread && eventLoop->isInLoopThread();
+                if (i == NUM_FUNCTIONS - 1) {
+                    eventLoop->stop();
+                }
+            });
+        }
+    });
+    eventLoop->run();
+    poster.join();
+
+    ASSERT_EQ(NUM_FUNCTIONS, executed.size());
+    for (int i = 0; i < NUM_FUNCTIONS; ++i) {
+        EXPECT_EQ(i, executed[i]);
+    }
+    EXPECT_TRUE(isAlwaysInLoopThread);
+    EXPECT_FALSE(eventLoop->isInLoopThread());
+    const auto metrics = eventLoop->getMetrics();
+    EXPECT_EQ(NUM_FUNCTIONS, metrics.batchSize.sum);
+    EXPECT_LE(metrics.batchSize.count, NUM_FUNCTIONS);
+}
+
+TEST(Test_EventLoop, post_delayed_executedWhenDueInOrderOfDueTime) {
+    auto             eventLoop = EventLoop::create();
+    std::vector<int> executed;
+    const auto       start = EventLoop::Clock_t::now();
+    eventLoop->post([&]() { executed.push_back(3); }, 30ms);
+    eventLoop->post([&]() { executed.push_back(2); }, 10ms);
+    eventLoop->post([&]() { executed.push_back(1); });
+    eventLoop->post(
+        [&]() {
+            executed.push_back(4);
+            eventLoop->stop();
+        },
+        30ms);
+
+    eventLoop->run();
+
+    EXPECT_GE(EventLoop::Clock_t::now() - start, 30ms);
+    EXPECT_EQ((std::vector<int>{1, 2, 3, 4}), executed);
+    EXPECT_EQ(0, eventLoop->getNumPendingFunctions());
+}
+
+TEST(Test_EventLoop, poll_postedAndNotDueFunctions_onlyPostedOnesExecutedInOneBatch) {
+    auto eventLoop   = EventLoop::create();
+    int  numExecuted = 0;
+    for (int i = 0; i < 3; ++i) {
+        eventLoop->post([&numExecuted]() { ++numExecuted; });
+    }
+    eventLoop->post([&numExecuted]() { ++numExecuted; }, 1h);
+
+    EXPECT_EQ(3, eventLoop->poll());
+    EXPECT_EQ(3, numExecuted);
+    EXPECT_EQ(1, eventLoop->getNumPendingFunctions());
+    EXPECT_EQ(0, eventLoop->poll());
+    const auto metrics = eventLoop->getMetrics();
+    EXPECT_EQ(1, metrics.batchSize.count);
+    EXPECT_EQ(3, metrics.batchSize.max);
+}
+
+TEST(Test_EventLoop, stop_functionsPostedAfterwards_discarded) {
+    auto eventLoop   = EventLoop::create();
+    int  numExecuted = 0;
+    eventLoop->post([&]() {
+        ++numExecuted;
+        eventLoop->stop();
+        eventLoop->post([&numExecuted]() { ++numExecuted; });
+    });
+
+    eventLoop->run();
+    EXPECT_TRUE(eventLoop->isStopped());
+    // a stopped loop returns right away
+    eventLoop->run();
+    EXPECT_EQ(1, numExecuted);
+    EXPECT_EQ(0, eventLoop->getNumPendingFunctions());
+}
+
+TEST(Test_EventLoop, post_functionThrows_loopContinuesAndFailureCounted) {
+    auto eventLoop  = EventLoop::create();
+    bool isExecuted = false;
+    eventLoop->post([]() { throw std::runtime_error("test"); });
+    eventLoop->post([&isExecuted]() { isExecuted = true; });
+
+    EXPECT_EQ(2, eventLoop->poll());
+    EXPECT_TRUE(isExecuted);
+    EXPECT_EQ(1, eventLoop->getMetrics().numFailedFunctions);
+}
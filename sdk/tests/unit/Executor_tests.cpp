@@ -0,0 +1,180 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#include "sdk/Executor.h"
+
+#include "sdk/EventLoop.h"
+#include "sdk/Exceptions.h"
+#include "sdk/Strand.h"
+#include "sdk/ThreadPool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using namespace velocitas;
+using namespace std::chrono_literals;
+
+namespace {
+constexpr auto DEFAULT_TIMEOUT = 1s;
+
+// wait until all functions posted so far have been executed
+bool drain(IExecutor& executor) {
+    std::promise<void> drained;
+    executor.post([&drained]() { drained.set_value(); });
+    return drained.get_future().wait_for(DEFAULT_TIMEOUT) == std::future_status::ready;
+}
+
+// executes the posted functions when asked to, like the loop of another framework
+class ManualExecutor : public IExecutor {
+public:
+    void post(JobFunction fun) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_posted.push_back(std::move(fun));
+    }
+
+    void scheduleAt(Clock_t::time_point timepoint, JobFunction fun) override {
+        std::ignore = timepoint;
+        post(std::move(fun));
+    }
+
+    size_t runPosted() {
+        std::vector<JobFunction> posted;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            posted.swap(m_posted);
+        }
+        for (auto& fun : posted) {
+            fun();
+        }
+        return posted.size();
+    }
+
+private:
+    std::mutex               m_mutex;
+    std::vector<JobFunction> m_posted;
+};
+} // namespace
+
+TEST(Test_Executor, createThreadPool_post_runsOnWorkerOfPool) {
+    auto executor = IExecutor::createThreadPool();
+
+    std::promise<std::thread::id> executingThread;
+    executor->post(
+        [&executingThread]() { executingThread.set_value(std::this_thread::get_id()); });
+
+    auto future = executingThread.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(DEFAULT_TIMEOUT));
+    EXPECT_NE(std::this_thread::get_id(), future.get());
+}
+
+TEST(Test_Executor, createThreadPool_postBatch_allExecuted) {
+    constexpr int NUM_FUNCTIONS = 100;
+    auto          executor      = IExecutor::createThreadPool(ThreadPool::getInstance());
+
+    std::atomic_int          numExecuted{0};
+    std::vector<JobFunction> funs;
+    for (int i = 0; i < NUM_FUNCTIONS; ++i) {
+        funs.emplace_back([&numExecuted]() { ++numExecuted; });
+    }
+    executor->postBatch(std::move(funs));
+
+    const auto deadline = std::chrono::steady_clock::now() + DEFAULT_TIMEOUT;
+    while (numExecuted < NUM_FUNCTIONS && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_EQ(NUM_FUNCTIONS, numExecuted);
+}
+
+TEST(Test_Executor, createThreadPool_scheduleAt_notExecutedBeforeTimepoint) {
+    auto       executor  = IExecutor::createThreadPool();
+    const auto timepoint = IExecutor::Clock_t::now() + 30ms;
+
+    std::promise<IExecutor::Clock_t::time_point> executedAt;
+    executor->scheduleAt(timepoint, [&executedAt]() {
+        executedAt.set_value(IExecutor::Clock_t::now());
+    });
+
+    auto future = executedAt.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(DEFAULT_TIMEOUT));
+    EXPECT_GE(future.get(), timepoint);
+}
+
+TEST(Test_Executor, createStrand_postAndScheduleAfter_executedInOrderByStrand) {
+    auto strand   = Strand::create();
+    auto executor = IExecutor::createStrand(strand);
+    // accessed by functions of the strand only, so no synchronization needed
+    std::vector<int> executed;
+    bool             isAlwaysInStrand = true;
+
+    executor->scheduleAfter(10ms, [&]() {
+        executed.push_back(2);
+        isAlwaysInStrand = isAlwaysInStrand && strand->isRunningInThisThread();
+    });
+    for (int i = 0; i < 2; ++i) {
+        executor->post([&, i]() {
+            executed.push_back(i);
+            isAlwaysInStrand = isAlwaysInStrand && strand->isRunningInThisThread();
+        });
+    }
+    std::this_thread::sleep_for(50ms);
+
+    ASSERT_TRUE(drain(*executor));
+    EXPECT_EQ(std::vector<int>({0, 1, 2}), executed);
+    EXPECT_TRUE(isAlwaysInStrand);
+}
+
+TEST(Test_Executor, createEventLoop_postAndScheduleAfter_executedByLoop) {
+    auto eventLoop = EventLoop::create();
+    auto executor  = IExecutor::createEventLoop(eventLoop);
+    // accessed by the loop thread only, so no synchronization needed
+    std::vector<int> executed;
+
+    executor->scheduleAfter(10ms, [&]() {
+        executed.push_back(1);
+        eventLoop->stop();
+    });
+    executor->defer([&]() { executed.push_back(0); });
+    eventLoop->run();
+
+    EXPECT_EQ(std::vector<int>({0, 1}), executed);
+}
+
+TEST(Test_Executor, createEventLoop_noLoop_throws) {
+    EXPECT_THROW(IExecutor::createEventLoop(nullptr), InvalidValueException);
+}
+
+TEST(Test_Executor, customExecutor_deferAndPostBatch_postedToExecutor) {
+    ManualExecutor executor;
+    int            numExecuted{0};
+
+    executor.defer([&numExecuted]() { ++numExecuted; });
+    std::vector<JobFunction> funs;
+    funs.emplace_back([&numExecuted]() { ++numExecuted; });
+    funs.emplace_back([&numExecuted]() { ++numExecuted; });
+    executor.postBatch(std::move(funs));
+    EXPECT_EQ(0, numExecuted);
+
+    EXPECT_EQ(3, executor.runPosted());
+    EXPECT_EQ(3, numExecuted);
+}
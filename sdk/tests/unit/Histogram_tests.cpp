@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/Histogram.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+
+TEST(Test_Histogram, getBucketIndex_powersOfTwo_startNewBucket) {
+    EXPECT_EQ(0, Histogram::getBucketIndex(0));
+    EXPECT_EQ(1, Histogram::getBucketIndex(1));
+    EXPECT_EQ(2, Histogram::getBucketIndex(2));
+    EXPECT_EQ(2, Histogram::getBucketIndex(3));
+    EXPECT_EQ(3, Histogram::getBucketIndex(4));
+    EXPECT_EQ(11, Histogram::getBucketIndex(1024));
+    EXPECT_EQ(64, Histogram::getBucketIndex(std::numeric_limits<uint64_t>::max()));
+}
+
+TEST(Test_Histogram, getSnapshot_noValues_allZero) {
+    Histogram  histogram;
+    const auto snapshot = histogram.getSnapshot();
+    EXPECT_EQ(0, snapshot.count);
+    EXPECT_EQ(0, snapshot.min);
+    EXPECT_EQ(0, snapshot.max);
+    EXPECT_EQ(0.0, snapshot.getMean());
+    EXPECT_EQ(0, snapshot.getPercentile(50));
+}
+
+TEST(Test_Histogram, record_someValues_statisticsUpdated) {
+    Histogram histogram;
+    histogram.record(5);
+    histogram.record(1);
+    histogram.record(12);
+
+    const auto snapshot = histogram.getSnapshot();
+    EXPECT_EQ(3, snapshot.count);
+    EXPECT_EQ(18, snapshot.sum);
+    EXPECT_EQ(1, snapshot.min);
+    EXPECT_EQ(12, snapshot.max);
+    EXPECT_DOUBLE_EQ(6.0, snapshot.getMean());
+    EXPECT_EQ(1, snapshot.buckets[Histogram::getBucketIndex(5)]);
+}
+
+TEST(Test_Histogram, getPercentile_uniformValues_upperBoundOfBucket) {
+    Histogram histogram;
+    for (uint64_t value = 1; value <= 100; ++value) {
+        histogram.record(value);
+    }
+
+    const auto snapshot = histogram.getSnapshot();
+    // 50th value is in bucket [32, 64), 99th in [64, 128) which is capped to the maximum
+    EXPECT_EQ(63, snapshot.getPercentile(50));
+    EXPECT_EQ(100, snapshot.getPercentile(99));
+    EXPECT_EQ(1, snapshot.getPercentile(0));
+    EXPECT_EQ(100, snapshot.getPercentile(100));
+}
+
+TEST(Test_Histogram, reset_afterRecording_empty) {
+    Histogram histogram;
+    histogram.record(42);
+    histogram.reset();
+
+    const auto snapshot = histogram.getSnapshot();
+    EXPECT_EQ(0, snapshot.count);
+    EXPECT_EQ(0, snapshot.sum);
+    EXPECT_EQ(0, snapshot.max);
+}
+
+TEST(Test_Histogram, record_concurrently_noValueLost) {
+    constexpr uint64_t       NUM_THREADS           = 4;
+    constexpr uint64_t       NUM_VALUES_PER_THREAD = 10000;
+    Histogram                histogram;
+    std::vector<std::thread> threads;
+    for (uint64_t i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([&histogram, i]() {
+            for (uint64_t value = 0; value < NUM_VALUES_PER_THREAD; ++value) {
+                histogram.record(value + i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto snapshot = histogram.getSnapshot();
+    EXPECT_EQ(NUM_THREADS * NUM_VALUES_PER_THREAD, snapshot.count);
+    EXPECT_EQ(0, snapshot.min);
+    EXPECT_EQ(NUM_VALUES_PER_THREAD - 1 + NUM_THREADS - 1, snapshot.max);
+}
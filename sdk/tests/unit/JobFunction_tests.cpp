@@ -0,0 +1,98 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/JobFunction.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <string>
+
+using namespace velocitas;
+
+TEST(Test_JobFunction, ctor_default_isEmpty) {
+    JobFunction fun;
+    EXPECT_FALSE(fun);
+    EXPECT_FALSE(fun.isStoredInline());
+}
+
+TEST(Test_JobFunction, ctor_smallLambda_storedInlineAndInvocable) {
+    int         numCalls = 0;
+    JobFunction fun([&numCalls] { ++numCalls; });
+
+    ASSERT_TRUE(fun);
+    EXPECT_TRUE(fun.isStoredInline());
+    fun();
+    fun();
+    EXPECT_EQ(2, numCalls);
+}
+
+TEST(Test_JobFunction, ctor_typicalCaptures_storedInline) {
+    auto        pointer = std::make_shared<int>(1);
+    std::string payload{"payload"};
+    JobFunction fun([pointer, payload] {});
+
+    EXPECT_TRUE(fun.isStoredInline());
+}
+
+TEST(Test_JobFunction, ctor_bigLambda_storedOnHeapAndInvocable) {
+    std::array<char, JobFunction::INLINE_CAPACITY + 1> buffer{};
+    buffer[0] = 'x';
+    char        result{};
+    JobFunction fun([buffer, &result] { result = buffer[0]; });
+
+    EXPECT_FALSE(fun.isStoredInline());
+    fun();
+    EXPECT_EQ('x', result);
+}
+
+TEST(Test_JobFunction, moveCtor_sourceBecomesEmpty) {
+    int         numCalls = 0;
+    JobFunction source([&numCalls] { ++numCalls; });
+
+    JobFunction target(std::move(source));
+    EXPECT_FALSE(source); // NOLINT(bugprone-use-after-move)
+    ASSERT_TRUE(target);
+    target();
+    EXPECT_EQ(1, numCalls);
+}
+
+TEST(Test_JobFunction, moveAssignment_previousCallableDestroyed) {
+    auto        tracker = std::make_shared<int>(0);
+    JobFunction target([tracker] {});
+    EXPECT_EQ(2, tracker.use_count());
+
+    target = JobFunction([] {});
+    EXPECT_EQ(1, tracker.use_count());
+}
+
+TEST(Test_JobFunction, dtor_heapStoredCallable_destroyed) {
+    auto tracker = std::make_shared<int>(0);
+    {
+        std::array<char, JobFunction::INLINE_CAPACITY> buffer{};
+        JobFunction                                    fun([tracker, buffer] {});
+        EXPECT_FALSE(fun.isStoredInline());
+        EXPECT_EQ(2, tracker.use_count());
+    }
+    EXPECT_EQ(1, tracker.use_count());
+}
+
+TEST(Test_JobFunction, assignNullptr_becomesEmpty) {
+    JobFunction fun([] {});
+    fun = nullptr;
+    EXPECT_FALSE(fun);
+}
@@ -14,6 +14,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include "sdk/AllocationTracker.h"
+#include "sdk/Exceptions.h"
 #include "sdk/Job.h"
 
 #include <gtest/gtest.h>
@@ -269,3 +271,146 @@ TEST(Test_Job, execute_cancelled_passedFunctionIsNotExecuted) {
     job.execute();
     EXPECT_FALSE(executeWasCalled);
 }
+
+TEST(Test_PeriodicJob, ctor_zeroPeriod_throws) {
+    EXPECT_THROW(PeriodicJob([] {}, 0ms), InvalidValueException);
+}
+
+TEST(Test_PeriodicJob, create_firstTickDueAfterOnePeriod) {
+    const auto before = Clock::now();
+    auto       job    = PeriodicJob::create([] {}, 50ms);
+
+    EXPECT_TRUE(job->shallRecur());
+    EXPECT_FALSE(job->isDue());
+    EXPECT_GE(job->getTimepointToExecute(), before + 50ms);
+    EXPECT_LE(job->getTimepointToExecute(), Clock::now() + 50ms);
+}
+
+TEST(Test_PeriodicJob, execute_inTime_nextDeadlineIsOnePeriodLater) {
+    int  numCalls = 0;
+    auto job      = PeriodicJob::create([&numCalls] { ++numCalls; }, 40ms);
+    const auto firstDeadline = job->getTimepointToExecute();
+
+    std::this_thread::sleep_until(firstDeadline);
+    job->execute();
+
+    EXPECT_EQ(1, numCalls);
+    EXPECT_EQ(firstDeadline + 40ms, job->getTimepointToExecute());
+    EXPECT_EQ(1, job->getJitterStatistics().numExecutions);
+    EXPECT_EQ(0, job->getJitterStatistics().numMissedTicks);
+}
+
+TEST(Test_PeriodicJob, execute_ticksMissedWithSkipPolicy_nextDeadlineInFuture) {
+    auto       job           = PeriodicJob::create([] {}, 40ms, MissedTickPolicy::SKIP);
+    const auto firstDeadline = job->getTimepointToExecute();
+
+    std::this_thread::sleep_until(firstDeadline + 100ms);
+    job->execute();
+
+    EXPECT_EQ(firstDeadline + 3 * 40ms, job->getTimepointToExecute());
+    EXPECT_EQ(2, job->getJitterStatistics().numMissedTicks);
+    EXPECT_GE(job->getJitterStatistics().maxJitter, 100ms);
+}
+
+TEST(Test_PeriodicJob, execute_ticksMissedWithCatchUpPolicy_nextDeadlineIsNextTick) {
+    auto       job           = PeriodicJob::create([] {}, 40ms, MissedTickPolicy::CATCH_UP);
+    const auto firstDeadline = job->getTimepointToExecute();
+
+    std::this_thread::sleep_until(firstDeadline + 100ms);
+    job->execute();
+
+    EXPECT_EQ(firstDeadline + 40ms, job->getTimepointToExecute());
+    EXPECT_TRUE(job->isDue());
+    EXPECT_EQ(0, job->getJitterStatistics().numMissedTicks);
+}
+
+TEST(Test_PeriodicJob, execute_ticksMissedWithCoalescePolicy_nextDeadlineIsLatestMissedTick) {
+    auto       job           = PeriodicJob::create([] {}, 40ms, MissedTickPolicy::COALESCE);
+    const auto firstDeadline = job->getTimepointToExecute();
+
+    std::this_thread::sleep_until(firstDeadline + 100ms);
+    job->execute();
+
+    EXPECT_EQ(firstDeadline + 2 * 40ms, job->getTimepointToExecute());
+    EXPECT_TRUE(job->isDue());
+    EXPECT_EQ(1, job->getJitterStatistics().numMissedTicks);
+}
+
+TEST(Test_PeriodicJob, execute_cancelled_functionNotExecuted) {
+    int  numCalls = 0;
+    auto job      = PeriodicJob::create([&numCalls] { ++numCalls; }, 10ms);
+    job->cancel();
+
+    job->execute();
+    EXPECT_EQ(0, numCalls);
+    EXPECT_FALSE(job->shallRecur());
+    EXPECT_EQ(0, job->getJitterStatistics().numExecutions);
+}
+
+TEST(Test_LightJob, create_returnsNonNullPtrNotRecurring) {
+    auto job = LightJob::create([] {});
+    ASSERT_TRUE(job);
+    EXPECT_FALSE(job->shallRecur());
+    EXPECT_TRUE(job->isDue());
+}
+
+TEST(Test_LightJob, execute_passedFunctionIsExecuted) {
+    bool executeWasCalled = false;
+    auto job              = LightJob::create([&executeWasCalled] { executeWasCalled = true; });
+
+    job->execute();
+    EXPECT_TRUE(executeWasCalled);
+}
+
+TEST(Test_LightJob, create_withDelay_notDueBeforeDelay) {
+    auto job = LightJob::create([] {}, 50ms);
+    EXPECT_FALSE(job->isDue());
+    EXPECT_GT(job->getTimepointToExecute(), Clock::now());
+}
+
+TEST(Test_LightJob, create_afterReleasingJob_memoryBlockIsReused) {
+    auto        job     = LightJob::create([] {});
+    const void* address = job.get();
+    job.reset();
+
+    auto otherJob = LightJob::create([] {});
+    EXPECT_EQ(address, otherJob.get());
+}
+
+TEST(Test_LightJob, create_smallLambdaAfterWarmUp_doesNotAllocate) {
+    int  numExecutions = 0;
+    auto fun           = [&numExecutions] { ++numExecutions; };
+    ASSERT_TRUE(JobFunction(fun).isStoredInline());
+    // warm-up: the pool holds a free block afterwards
+    LightJob::create(fun);
+    const auto poolSize = LightJob::getPoolSize();
+    const auto initial  = AllocationTracker::getStatistics(AllocationDomain::JOBS);
+
+    for (int i = 0; i < 100; ++i) {
+        LightJob::create(fun)->execute();
+    }
+
+    EXPECT_EQ(100, numExecutions);
+    EXPECT_EQ(poolSize, LightJob::getPoolSize());
+    EXPECT_EQ(initial.numAllocations,
+              AllocationTracker::getStatistics(AllocationDomain::JOBS).numAllocations);
+}
+
+TEST(Test_LightJob, create_moveOnlyCapture_isExecuted) {
+    auto value  = std::make_unique<int>(42);
+    int  result = 0;
+    auto job    = LightJob::create([value = std::move(value), &result] { result = *value; });
+
+    job->execute();
+    EXPECT_EQ(42, result);
+}
+
+TEST(Test_LightJob, reservePool_moreJobsThanHeld_poolGrownAndNotShrunk) {
+    const auto initialSize = LightJob::getPoolSize();
+    LightJob::reservePool(initialSize + 100);
+    EXPECT_GE(LightJob::getPoolSize(), initialSize + 100);
+
+    const auto reservedSize = LightJob::getPoolSize();
+    LightJob::reservePool(1);
+    EXPECT_EQ(reservedSize, LightJob::getPoolSize());
+}
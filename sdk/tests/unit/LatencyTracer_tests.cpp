@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/LatencyTracer.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+using namespace velocitas;
+using namespace std::chrono_literals;
+
+namespace {
+LatencyTrace createTrace(LatencyStage lastStage) {
+    const auto   start = LatencyTrace::Clock_t::now();
+    LatencyTrace trace;
+    for (size_t stage = 0; stage <= static_cast<size_t>(lastStage); ++stage) {
+        trace.stamp(static_cast<LatencyStage>(stage), start + std::chrono::microseconds{stage});
+    }
+    return trace;
+}
+} // namespace
+
+TEST(Test_LatencyTracer, shallTrace_samplingInterval_tracesEveryNthUpdate) {
+    LatencyTracer tracer(3);
+
+    EXPECT_TRUE(tracer.shallTrace());
+    EXPECT_FALSE(tracer.shallTrace());
+    EXPECT_FALSE(tracer.shallTrace());
+    EXPECT_TRUE(tracer.shallTrace());
+    EXPECT_EQ(4, tracer.getMetrics().numUpdates);
+}
+
+TEST(Test_LatencyTracer, shallTrace_zeroInterval_tracesNothing) {
+    LatencyTracer tracer(0);
+
+    EXPECT_FALSE(tracer.shallTrace());
+    EXPECT_FALSE(tracer.shallTrace());
+}
+
+TEST(Test_LatencyTracer, record_allStagesStamped_recordsLatencyPerStage) {
+    LatencyTracer tracer(1);
+    auto          trace = createTrace(LatencyStage::CALLBACK_END);
+    trace.brokerLatency = 5ms;
+
+    tracer.record(trace);
+
+    const auto metrics = tracer.getMetrics();
+    EXPECT_EQ(1, metrics.numTracedUpdates);
+    EXPECT_EQ(5'000'000, metrics.brokerLatency.max);
+    EXPECT_EQ(1'000, metrics.decodeLatency.max);
+    EXPECT_EQ(1'000, metrics.enqueueLatency.max);
+    EXPECT_EQ(1'000, metrics.dispatchLatency.max);
+    EXPECT_EQ(1'000, metrics.executionTime.max);
+    EXPECT_EQ(4'000, metrics.totalLatency.max);
+}
+
+TEST(Test_LatencyTracer, record_callbackStagesMissing_recordsStampedStagesOnly) {
+    LatencyTracer tracer(1);
+
+    tracer.record(createTrace(LatencyStage::ENQUEUED));
+
+    const auto metrics = tracer.getMetrics();
+    EXPECT_EQ(0, metrics.brokerLatency.count);
+    EXPECT_EQ(1, metrics.decodeLatency.count);
+    EXPECT_EQ(1, metrics.enqueueLatency.count);
+    EXPECT_EQ(0, metrics.dispatchLatency.count);
+    EXPECT_EQ(0, metrics.executionTime.count);
+    EXPECT_EQ(0, metrics.totalLatency.count);
+}
+
+TEST(Test_LatencyTracer, record_negativeBrokerLatency_recordedAsZero) {
+    LatencyTracer tracer(1);
+    LatencyTrace  trace;
+    trace.brokerLatency = -1ms;
+
+    tracer.record(trace);
+
+    EXPECT_EQ(1, tracer.getMetrics().brokerLatency.count);
+    EXPECT_EQ(0, tracer.getMetrics().brokerLatency.max);
+}
+
+TEST(Test_LatencyTracer, reset_afterRecording_metricsCleared) {
+    LatencyTracer tracer(1);
+    std::ignore = tracer.shallTrace();
+    tracer.record(createTrace(LatencyStage::CALLBACK_END));
+
+    tracer.reset();
+
+    const auto metrics = tracer.getMetrics();
+    EXPECT_EQ(0, metrics.numUpdates);
+    EXPECT_EQ(0, metrics.numTracedUpdates);
+    EXPECT_EQ(0, metrics.totalLatency.count);
+}
@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/LazyDataPoint.h"
+
+#include "sdk/DataPointReply.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+std::atomic<int> numDecodes{0};
+
+DataPointSample decodeInt(const void* source) {
+    ++numDecodes;
+    return DataPointSample(*static_cast<const int32_t*>(source), Timestamp{1});
+}
+
+LazySamplePtr_t createLazySample(int32_t value) {
+    return std::make_shared<const LazySample>(std::make_shared<const int32_t>(value), &decodeInt);
+}
+
+class Test_LazyDataPoint : public ::testing::Test {
+protected:
+    void SetUp() override { numDecodes = 0; }
+};
+
+} // namespace
+
+TEST_F(Test_LazyDataPoint, get_calledConcurrently_decodedOnce) {
+    auto sample = createLazySample(42);
+    EXPECT_EQ(0, numDecodes);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&sample]() { EXPECT_EQ(42, sample->get().get<int32_t>()); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(1, numDecodes);
+}
+
+TEST_F(Test_LazyDataPoint, get_decodedSample_sampleReturned) {
+    LazySample sample(DataPointSample(1.5F));
+
+    EXPECT_EQ(1.5F, sample.get().get<float>());
+}
+
+TEST_F(Test_LazyDataPoint, clearUpdateStatus_beforeValueCreated_notDecodedAndCreatedNotUpdated) {
+    LazyDataPointValue value(createLazySample(7));
+    EXPECT_TRUE(value.wasUpdated());
+
+    value.clearUpdateStatus();
+
+    EXPECT_FALSE(value.wasUpdated());
+    EXPECT_EQ(0, numDecodes);
+    auto dataPointValue = value.get("A.B");
+    EXPECT_FALSE(dataPointValue->wasUpdated());
+    EXPECT_EQ("A.B", dataPointValue->getPath());
+    EXPECT_EQ(dataPointValue, value.get("A.B"));
+}
+
+TEST_F(Test_LazyDataPoint, clearUpdateStatus_afterValueCreated_valueNotUpdated) {
+    LazyDataPointValue value(createLazySample(7));
+    auto               dataPointValue = value.get("A.B");
+
+    value.clearUpdateStatus();
+
+    EXPECT_FALSE(dataPointValue->wasUpdated());
+    EXPECT_FALSE(value.wasUpdated());
+}
+
+TEST_F(Test_LazyDataPoint, dataPointReply_lazyEntries_decodedOnAccessOnly) {
+    DataPointReply reply;
+    reply.set(SignalPathRegistry::getInstance().intern("A.X"),
+              std::make_shared<LazyDataPointValue>(createLazySample(1)));
+    reply.set(SignalPathRegistry::getInstance().intern("A.Y"),
+              std::make_shared<LazyDataPointValue>(createLazySample(2)));
+
+    const auto handleY = SignalPathRegistry::getInstance().intern("A.Y");
+    EXPECT_TRUE(reply.wasUpdated(handleY));
+    EXPECT_EQ(0, numDecodes);
+
+    auto value = std::dynamic_pointer_cast<TypedDataPointValue<int32_t>>(reply.getUntyped("A.Y"));
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(2, value->value());
+    EXPECT_EQ(2, reply.getSample(handleY).get<int32_t>());
+    EXPECT_EQ(1, numDecodes);
+}
@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/LogRateLimiter.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr char const* SITE       = "Unexpected signal id={} received.";
+constexpr char const* OTHER_SITE = "Connection lost";
+
+} // namespace
+
+class Test_LogRateLimiter : public ::testing::Test {
+protected:
+    LogRateLimiter                            m_cut{LogRateLimitConfig{2.0, 3.0}};
+    const LogRateLimiter::Clock_t::time_point m_start{LogRateLimiter::Clock_t::now()};
+    uint64_t                                  m_numSuppressed{0};
+};
+
+TEST_F(Test_LogRateLimiter, tryAcquire_burstExhausted_suppressedUntilRefilled) {
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(m_cut.tryAcquire(SITE, m_numSuppressed, m_start));
+    }
+    EXPECT_FALSE(m_cut.tryAcquire(SITE, m_numSuppressed, m_start));
+    EXPECT_FALSE(m_cut.tryAcquire(SITE, m_numSuppressed, m_start + 100ms));
+
+    EXPECT_TRUE(m_cut.tryAcquire(SITE, m_numSuppressed, m_start + 500ms));
+    EXPECT_EQ(m_numSuppressed, 2);
+    EXPECT_FALSE(m_cut.tryAcquire(SITE, m_numSuppressed, m_start + 500ms));
+}
+
+TEST_F(Test_LogRateLimiter, tryAcquire_differentSites_limitedIndependently) {
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(m_cut.tryAcquire(SITE, m_numSuppressed, m_start));
+    }
+
+    EXPECT_TRUE(m_cut.tryAcquire(OTHER_SITE, m_numSuppressed, m_start));
+    EXPECT_EQ(m_numSuppressed, 0);
+}
+
+TEST_F(Test_LogRateLimiter, getMetrics_messagesSuppressed_countedPerSite) {
+    for (int i = 0; i < 10; ++i) {
+        m_cut.tryAcquire(SITE, m_numSuppressed, m_start);
+    }
+    for (int i = 0; i < 5; ++i) {
+        m_cut.tryAcquire(OTHER_SITE, m_numSuppressed, m_start);
+    }
+
+    const auto metrics = m_cut.getMetrics();
+    EXPECT_EQ(metrics.numSuppressed, 9);
+    ASSERT_EQ(metrics.sites.size(), 2);
+    EXPECT_EQ(metrics.sites[0].format, SITE);
+    EXPECT_EQ(metrics.sites[0].numSuppressed, 7);
+    EXPECT_EQ(metrics.sites[1].format, OTHER_SITE);
+    EXPECT_EQ(metrics.sites[1].numSuppressed, 2);
+}
+
+TEST_F(Test_LogRateLimiter, tryAcquire_siteTableFull_newSiteNotLimited) {
+    std::vector<std::string> formats;
+    for (int i = 0; i < 16 * 1024; ++i) {
+        formats.push_back("site " + std::to_string(i));
+    }
+    for (const auto& format : formats) {
+        m_cut.tryAcquire(format.c_str(), m_numSuppressed, m_start);
+    }
+
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_TRUE(m_cut.tryAcquire(SITE, m_numSuppressed, m_start));
+    }
+}
@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/LogRecord.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace velocitas;
+
+namespace {
+
+struct Point {
+    int m_x;
+    int m_y;
+};
+
+} // namespace
+
+template <> struct fmt::formatter<Point> : fmt::formatter<std::string> {
+    auto format(const Point& point, format_context& ctx) const {
+        return fmt::format_to(ctx.out(), "({}, {})", point.m_x, point.m_y);
+    }
+};
+
+TEST(Test_LogRecord, format_noArguments_messageReturnedAsIs) {
+    const LogRecord cut{"Hello {}"};
+
+    EXPECT_TRUE(cut.isValid());
+    EXPECT_EQ(cut.format(), "Hello {}");
+}
+
+TEST(Test_LogRecord, format_rawValueArguments_formattedLikeFmt) {
+    const int8_t   narrow     = -8;
+    const uint16_t unsigned16 = 65535;
+
+    const LogRecord cut{"{} {} {} {} {:.1f} {} {:x}", true, 'c', narrow, -1234567890123LL, 9.312F,
+                        9.5, unsigned16};
+
+    EXPECT_EQ(cut.format(), "true c -8 -1234567890123 9.3 9.5 ffff");
+}
+
+TEST(Test_LogRecord, format_stringArguments_copiedIntoRecord) {
+    std::string str{"World"};
+    const char* cstr = "again";
+
+    const LogRecord cut{"Hello {} {}", str, cstr};
+    str = "changed";
+
+    EXPECT_EQ(cut.format(), "Hello World again");
+}
+
+TEST(Test_LogRecord, format_argumentsExceedingInlineBuffer_movedRecordFormatted) {
+    const std::string longStr(200, 'x');
+
+    LogRecord       record{"{} {} {}", longStr, 42, longStr};
+    const LogRecord cut{std::move(record)};
+
+    EXPECT_FALSE(record.isValid()); // NOLINT(bugprone-use-after-move)
+    EXPECT_EQ(cut.format(), longStr + " 42 " + longStr);
+}
+
+TEST(Test_LogRecord, format_customType_formattedWhenRecorded) {
+    const LogRecord cut{"at {}", Point{1, 2}};
+
+    EXPECT_EQ(cut.format(), "at (1, 2)");
+}
+
+TEST(Test_LogRecord, format_argumentsNotMatchingFormat_throws) {
+    const LogRecord cut{"{} {}", 1};
+
+    EXPECT_THROW(static_cast<void>(cut.format()), std::runtime_error);
+}
@@ -16,8 +16,13 @@
 
 #include "sdk/Logger.h"
 
+#include "TestBaseUsingEnvVars.h"
+
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <thread>
+
 using namespace velocitas;
 
 const char JSON_TEST_STRING[] =
@@ -64,6 +69,11 @@ public:
         logger().setLoggerImplementation(std::move(stringLogger));
     }
 
+    void TearDown() override {
+        logger().setLevel(LogLevel::DEBUG);
+        logger().setRateLimit(std::nullopt);
+    }
+
     StringLogger* m_stringLogger{};
 };
 
@@ -214,3 +224,79 @@ TEST_F(Test_Logger, debug_withArguments_correctMessageLoggedOnCorrectLevel) {
     EXPECT_EQ(m_stringLogger->getLogLevel(), StringLogger::LogLevel::Debug);
     EXPECT_EQ(m_stringLogger->getLogMessage(), "Foo, 1337, 9.312");
 }
+
+TEST_F(Test_Logger, setLevel_messagesBelowLevel_discardedWithoutFormatting) {
+    logger().setLevel(LogLevel::WARN);
+
+    logger().warn("Hello");
+    logger().info("World");
+    // the arguments would not match the format message
+    EXPECT_NO_THROW(logger().debug("Hello World {} {}", "Next missing"));
+
+    EXPECT_EQ(m_stringLogger->getLogLevel(), StringLogger::LogLevel::Warn);
+    EXPECT_EQ(m_stringLogger->getLogMessage(), "Hello");
+    EXPECT_FALSE(logger().isEnabled(LogLevel::INFO));
+    EXPECT_TRUE(logger().isEnabled(LogLevel::ERROR));
+}
+
+TEST_F(Test_Logger, setLevel_off_nothingLogged) {
+    logger().setLevel(LogLevel::OFF);
+
+    logger().error("Hello World");
+
+    EXPECT_EQ(m_stringLogger->getLogLevel(), StringLogger::LogLevel::Unknown);
+}
+
+TEST_F(Test_Logger, setRateLimit_burstExceeded_suppressedAndReportedLater) {
+    logger().setRateLimit(LogRateLimitConfig{1000.0, 2.0});
+
+    for (int i = 0; i < 5; ++i) {
+        logger().error("Unexpected signal id={} received.", i);
+    }
+    EXPECT_EQ(m_stringLogger->getLogMessage(), "Unexpected signal id=1 received.");
+    EXPECT_EQ(logger().getMetrics().numSuppressed, 3);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    logger().error("Unexpected signal id={} received.", 5);
+    EXPECT_EQ(m_stringLogger->getLogMessage(), "Unexpected signal id=5 received.");
+}
+
+TEST_F(Test_Logger, setRateLimit_nonLiteralMessage_notLimited) {
+    logger().setRateLimit(LogRateLimitConfig{1.0, 1.0});
+    const std::string msg{"Hello {}"};
+
+    for (int i = 0; i < 3; ++i) {
+        logger().info(msg, i);
+    }
+
+    EXPECT_EQ(m_stringLogger->getLogMessage(), "Hello 2");
+    EXPECT_EQ(logger().getMetrics().numSuppressed, 0);
+}
+
+class Test_LoggerLevel : public TestUsingEnvVars {};
+
+TEST_F(Test_LoggerLevel, ctor_levelSetViaEnvVar_levelUsed) {
+    setEnvVar("SDV_LOG_LEVEL", "Error");
+
+    Logger cut;
+
+    EXPECT_EQ(cut.getLevel(), LogLevel::ERROR);
+}
+
+TEST_F(Test_LoggerLevel, ctor_invalidLevel_debugUsed) {
+    setEnvVar("SDV_LOG_LEVEL", "verbose");
+
+    Logger cut;
+
+    EXPECT_EQ(cut.getLevel(), LogLevel::DEBUG);
+}
+
+TEST_F(Test_LoggerLevel, ctor_rateLimitSetViaEnvVar_messagesLimited) {
+    setEnvVar("SDV_LOG_RATE_LIMIT", "1,1");
+
+    Logger cut;
+    cut.info("Hello");
+    cut.info("Hello");
+
+    EXPECT_EQ(cut.getMetrics().numSuppressed, 1);
+}
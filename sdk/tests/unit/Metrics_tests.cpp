@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/Metrics.h"
+
+#include "sdk/Exceptions.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace velocitas;
+using namespace std::chrono_literals;
+using ::testing::HasSubstr;
+
+namespace {
+
+class CollectingSink : public IMetricsSink {
+public:
+    void write(const std::vector<MetricSnapshot>& metrics) override {
+        ++m_numWrites;
+        m_metrics = metrics;
+    }
+
+    size_t                      m_numWrites{0};
+    std::vector<MetricSnapshot> m_metrics;
+};
+
+std::string readFile(const std::string& path) {
+    std::ifstream     file(path);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+} // namespace
+
+TEST(Test_MetricsRegistry, getCounter_sameNameAndLabels_returnsSameCounter) {
+    MetricsRegistry registry;
+
+    auto& counter = registry.getCounter("calls_total", "Calls", {{"rpc", "Get"}});
+    counter.increment(2);
+
+    EXPECT_EQ(&counter, &registry.getCounter("calls_total", "Calls", {{"rpc", "Get"}}));
+    EXPECT_NE(&counter, &registry.getCounter("calls_total", "Calls", {{"rpc", "Set"}}));
+    EXPECT_EQ(2, registry.getCounter("calls_total", "Calls", {{"rpc", "Get"}}).getValue());
+}
+
+TEST(Test_MetricsRegistry, getGauge_nameRegisteredAsCounter_throws) {
+    MetricsRegistry registry;
+    registry.getCounter("calls_total", "Calls");
+
+    EXPECT_THROW(registry.getGauge("calls_total", "Calls"), InvalidTypeException);
+}
+
+TEST(Test_MetricsRegistry, collect_registeredMetrics_returnsValuesSortedByNameAndLabels) {
+    MetricsRegistry registry;
+    registry.getGauge("streams", "Streams").set(-3);
+    registry.getCounter("calls_total", "Calls", {{"rpc", "Set"}}).increment();
+    registry.getCounter("calls_total", "Calls", {{"rpc", "Get"}}).increment(5);
+    registry.getHistogram("latency_nanoseconds", "Latency").record(100);
+
+    const auto metrics = registry.collect();
+
+    ASSERT_EQ(4, metrics.size());
+    EXPECT_EQ("calls_total", metrics[0].name);
+    EXPECT_EQ("Get", metrics[0].labels[0].second);
+    EXPECT_EQ(5.0, metrics[0].value);
+    EXPECT_EQ("Set", metrics[1].labels[0].second);
+    EXPECT_EQ(MetricType::HISTOGRAM, metrics[2].type);
+    EXPECT_EQ(1, metrics[2].histogram.count);
+    EXPECT_EQ(MetricType::GAUGE, metrics[3].type);
+    EXPECT_EQ(-3.0, metrics[3].value);
+}
+
+TEST(Test_MetricsRegistry, collect_collectorRegistered_addsItsMetricsUntilHandleIsDestroyed) {
+    MetricsRegistry registry;
+    {
+        auto handle = registry.addCollector([](std::vector<MetricSnapshot>& metrics) {
+            MetricSnapshot metric;
+            metric.name  = "queue_depth";
+            metric.type  = MetricType::GAUGE;
+            metric.value = 7.0;
+            metrics.push_back(metric);
+        });
+
+        const auto metrics = registry.collect();
+        ASSERT_EQ(1, metrics.size());
+        EXPECT_EQ(7.0, metrics[0].value);
+    }
+
+    EXPECT_TRUE(registry.collect().empty());
+}
+
+TEST(Test_MetricsRegistry, toPrometheusText_counterAndGauge_formatsOneSeriesPerLine) {
+    MetricsRegistry registry;
+    registry.getCounter("calls_total", "Number of calls", {{"rpc", "Get"}}).increment(3);
+    registry.getCounter("calls_total", "Number of calls", {{"rpc", "Set"}}).increment();
+    registry.getGauge("streams", "Open \\ streams").set(2);
+
+    EXPECT_EQ("# HELP calls_total Number of calls\n"
+              "# TYPE calls_total counter\n"
+              "calls_total{rpc=\"Get\"} 3\n"
+              "calls_total{rpc=\"Set\"} 1\n"
+              "# HELP streams Open \\\\ streams\n"
+              "# TYPE streams gauge\n"
+              "streams 2\n",
+              toPrometheusText(registry.collect()));
+}
+
+TEST(Test_MetricsRegistry, toPrometheusText_labelValueWithQuote_escapesIt) {
+    MetricsRegistry registry;
+    registry.getCounter("errors_total", "Errors", {{"reason", "say \"hi\"\n"}}).increment();
+
+    EXPECT_THAT(toPrometheusText(registry.collect()),
+                HasSubstr("errors_total{reason=\"say \\\"hi\\\"\\n\"} 1\n"));
+}
+
+TEST(Test_MetricsRegistry, toPrometheusText_histogram_formatsCumulativeBucketsSumAndCount) {
+    MetricsRegistry registry;
+    auto&           histogram = registry.getHistogram("latency", "Latency", {{"rpc", "Get"}});
+    histogram.record(0);
+    histogram.record(2);
+    histogram.record(3);
+
+    EXPECT_EQ("# HELP latency Latency\n"
+              "# TYPE latency histogram\n"
+              "latency_bucket{rpc=\"Get\",le=\"0\"} 1\n"
+              "latency_bucket{rpc=\"Get\",le=\"1\"} 1\n"
+              "latency_bucket{rpc=\"Get\",le=\"3\"} 3\n"
+              "latency_bucket{rpc=\"Get\",le=\"+Inf\"} 3\n"
+              "latency_sum{rpc=\"Get\"} 5\n"
+              "latency_count{rpc=\"Get\"} 3\n",
+              toPrometheusText(registry.collect()));
+}
+
+TEST(Test_MetricsExporter, stop_exportsFinalMetrics) {
+    MetricsRegistry registry;
+    registry.getCounter("calls_total", "Calls").increment();
+    auto  sink    = std::make_unique<CollectingSink>();
+    auto* sinkPtr = sink.get();
+
+    MetricsExporter exporter(std::move(sink), 1h, registry);
+    exporter.stop();
+
+    EXPECT_EQ(1, sinkPtr->m_numWrites);
+    ASSERT_EQ(1, sinkPtr->m_metrics.size());
+    EXPECT_EQ("calls_total", sinkPtr->m_metrics[0].name);
+}
+
+TEST(Test_MetricsExporter, prometheusFileSink_writesMetricsToFile) {
+    const auto      path = ::testing::TempDir() + "metrics_test.prom";
+    MetricsRegistry registry;
+    registry.getGauge("streams", "Streams").set(4);
+
+    MetricsExporter(IMetricsSink::createPrometheusFile(path), 1h, registry).stop();
+
+    EXPECT_THAT(readFile(path), HasSubstr("streams 4\n"));
+    std::remove(path.c_str());
+}
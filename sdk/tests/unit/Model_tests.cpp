@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/Model.h"
+
+#include "sdk/DataPoint.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+std::atomic<int> numConstructedBranches{0}; // NOLINT
+
+class TestBranch : public Model {
+public:
+    TestBranch(const std::string& name, Model* parent, int id)
+        : Model(name, parent)
+        , Position("Position", this)
+        , m_id(id) {
+        ++numConstructedBranches;
+    }
+
+    DataPointUint32 Position;
+    const int       m_id;
+};
+
+class TestModel : public Model {
+public:
+    TestModel()
+        : Model("TestModel")
+        , Branch("Branch", this, 42) {}
+
+    LazyBranch<TestBranch, const char*, Model*, int> Branch;
+};
+
+} // namespace
+
+TEST(Test_LazyBranch, construction_branchNotConstructed) {
+    numConstructedBranches = 0;
+    const TestModel model;
+
+    EXPECT_FALSE(model.Branch.isConstructed());
+    EXPECT_EQ(0, numConstructedBranches);
+}
+
+TEST(Test_LazyBranch, get_firstAccess_constructsBranchOnce) {
+    numConstructedBranches = 0;
+    TestModel model;
+
+    const auto& position = model.Branch->Position;
+
+    EXPECT_TRUE(model.Branch.isConstructed());
+    EXPECT_EQ(42, model.Branch.get().m_id);
+    EXPECT_EQ(&model, model.Branch->getParent());
+    EXPECT_EQ("TestModel.Branch.Position", position.getPath());
+    EXPECT_EQ(&position, &(*model.Branch).Position);
+    EXPECT_EQ(1, numConstructedBranches);
+}
+
+TEST(Test_LazyBranch, get_concurrentFirstAccess_sameBranchForAllThreads) {
+    const TestModel                model;
+    std::vector<const TestBranch*> branches(8);
+    std::vector<std::thread>       threads;
+    for (auto& branch : branches) {
+        threads.emplace_back([&model, &branch]() { branch = &model.Branch.get(); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto* branch : branches) {
+        EXPECT_EQ(&model.Branch.get(), branch);
+    }
+}
@@ -0,0 +1,135 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/MulticastSubscription.h"
+
+#include "sdk/DataPointReply.h"
+#include "sdk/SignalPathRegistry.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+DataPointReply replyOf(const std::string& path, float value) {
+    DataPointReply reply;
+    reply.set(SignalPathRegistry::getInstance().intern(path),
+              DataPointSample(value, Timestamp{}));
+    return reply;
+}
+
+} // namespace
+
+TEST(Test_MulticastSubscription, addListener_severalListeners_allGetTheSameItem) {
+    auto source    = std::make_shared<AsyncSubscription<int>>();
+    auto multicast = MulticastSubscription<int>::create(source);
+
+    std::vector<std::shared_ptr<const int>> received;
+    multicast->addListener([&received](const auto& item) { received.push_back(item); });
+    auto listener = multicast->addListener();
+    source->insertNewItem(42);
+
+    ASSERT_EQ(1, received.size());
+    EXPECT_EQ(42, *received[0]);
+    const auto buffered = listener->next();
+    EXPECT_EQ(received[0].get(), buffered.get());
+    EXPECT_EQ(2, multicast->getNumListeners());
+}
+
+TEST(Test_MulticastSubscription, addListener_ownBufferPolicies_appliedPerListener) {
+    auto source    = std::make_shared<AsyncSubscription<int>>();
+    auto multicast = MulticastSubscription<int>::create(source);
+
+    MulticastListenerConfig dropNewest;
+    dropNewest.m_bufferCapacity = 2;
+    dropNewest.m_overflowPolicy = OverflowPolicy::DROP_NEWEST;
+    auto first                  = multicast->addListener(dropNewest);
+    auto second                 = multicast->addListener();
+    for (int item = 1; item <= 3; ++item) {
+        source->insertNewItem(int{item});
+    }
+
+    EXPECT_EQ(1, *first->next());
+    EXPECT_EQ(2, *first->next());
+    EXPECT_FALSE(first->tryNext().has_value());
+    EXPECT_EQ(1, first->getNumDroppedItems());
+    EXPECT_EQ(3, second->drain().size());
+}
+
+TEST(Test_MulticastSubscription, insertNewItem_cancelledListener_removed) {
+    auto source    = std::make_shared<AsyncSubscription<int>>();
+    auto multicast = MulticastSubscription<int>::create(source);
+
+    auto cancelled = multicast->addListener();
+    auto remaining = multicast->addListener();
+    cancelled->cancel();
+    source->insertNewItem(1);
+
+    EXPECT_FALSE(cancelled->tryNext().has_value());
+    EXPECT_EQ(1, *remaining->next());
+    EXPECT_EQ(1, multicast->getNumListeners());
+    EXPECT_FALSE(source->isCancelled());
+}
+
+TEST(Test_MulticastSubscription, insertError_source_passedOnToAllListeners) {
+    auto source    = std::make_shared<AsyncSubscription<int>>();
+    auto multicast = MulticastSubscription<int>::create(source);
+
+    auto first  = multicast->addListener();
+    auto second = multicast->addListener();
+    source->insertError(Status("stream broken"));
+
+    EXPECT_THROW(first->next(), AsyncException);
+    EXPECT_THROW(second->next(), AsyncException);
+}
+
+TEST(Test_MulticastSubscription, cancel_destroyed_sourceCancelled) {
+    auto source = std::make_shared<AsyncSubscription<int>>();
+    {
+        auto multicast = MulticastSubscription<int>::create(source);
+        auto listener  = multicast->addListener();
+        multicast->cancel();
+        EXPECT_TRUE(listener->isCancelled());
+    }
+    EXPECT_TRUE(source->isCancelled());
+
+    auto otherSource = std::make_shared<AsyncSubscription<int>>();
+    MulticastSubscription<int>::create(otherSource);
+    EXPECT_TRUE(otherSource->isCancelled());
+}
+
+TEST(Test_MulticastSubscription, conflateLatest_dataPointReplies_mergedIntoCopy) {
+    auto source    = std::make_shared<AsyncSubscription<DataPointReply>>();
+    auto multicast = MulticastSubscription<DataPointReply>::create(source);
+
+    MulticastListenerConfig conflating;
+    conflating.m_overflowPolicy = OverflowPolicy::CONFLATE_LATEST;
+    auto conflated              = multicast->addListener(conflating);
+    auto unconflated            = multicast->addListener();
+    source->insertNewItem(replyOf("Vehicle.Test.Speed", 1.0F));
+    source->insertNewItem(replyOf("Vehicle.Test.Gear", 2.0F));
+
+    const auto merged = conflated->next();
+    EXPECT_EQ(2, merged->size());
+    EXPECT_FLOAT_EQ(1.0F, merged->getSample("Vehicle.Test.Speed").get<float>());
+    EXPECT_FLOAT_EQ(2.0F, merged->getSample("Vehicle.Test.Gear").get<float>());
+    EXPECT_EQ(1, unconflated->next()->size());
+}
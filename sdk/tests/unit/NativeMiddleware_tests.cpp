@@ -15,6 +15,7 @@
  */
 
 #include "sdk/middleware/NativeMiddleware.h"
+#include "sdk/pubsub/InProcessPubSubClient.h"
 
 #include "TestBaseUsingEnvVars.h"
 #include <gtest/gtest.h>
@@ -40,6 +41,17 @@ TEST_F(Test_NativeMiddleware, createPubSubClient__validPointer) {
     EXPECT_NE(nullptr, pubSubClient.get());
 }
 
+TEST_F(Test_NativeMiddleware, createPubSubClient_inProcessType_inProcessClient) {
+    setEnvVar(NativeMiddleware::PUBSUB_TYPE_ENV_VAR_NAME, "InProcess");
+    auto pubSubClient = getCut().createPubSubClient("My Test Id");
+    EXPECT_NE(nullptr, std::dynamic_pointer_cast<InProcessPubSubClient>(pubSubClient));
+}
+
+TEST_F(Test_NativeMiddleware, createPubSubClient_unknownType_throwsRuntimeError) {
+    setEnvVar(NativeMiddleware::PUBSUB_TYPE_ENV_VAR_NAME, "carrier-pigeon");
+    EXPECT_THROW(getCut().createPubSubClient("My Test Id"), std::runtime_error);
+}
+
 TEST_F(Test_NativeMiddleware, getServiceLocation_envVarNotSet_throwsRuntimeError) {
     EXPECT_THROW(getCut().getServiceLocation("UnknownService"), std::runtime_error);
 }
@@ -61,6 +73,12 @@ TEST_F(Test_NativeMiddleware, getServiceLocation_envVarSetWithUrl_contentOfUrlsN
     EXPECT_EQ("some-host:port", serviceLocation);
 }
 
+TEST_F(Test_NativeMiddleware, getServiceLocation_envVarSetWithUrlList_netLocationsOfAllUrls) {
+    setEnvVar("SDV_SOMESERVICE_ADDRESS", "scheme://host-a:1234/path, host-b:5678");
+    auto serviceLocation = getCut().getServiceLocation("SomeService");
+    EXPECT_EQ("host-a:1234,host-b:5678", serviceLocation);
+}
+
 TEST_F(Test_NativeMiddleware, getMetadata__emptyMap) {
     Middleware::Metadata metadata = getCut().getMetadata("don't care");
     EXPECT_TRUE(metadata.empty());
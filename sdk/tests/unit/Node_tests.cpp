@@ -35,3 +35,13 @@ TEST(Test_Node, constructor_withParent_isLeaf) {
     EXPECT_EQ(node.getParent(), &nodeRoot);
     EXPECT_EQ(node.getPath(), "root.foo");
 }
+
+TEST(Test_Node, getPath_nestedNodes_returnsStableFullPath) {
+    Node nodeRoot{"root"};
+    Node nodeBranch{"branch", &nodeRoot};
+    Node node{"foo", &nodeBranch};
+
+    const auto& path = node.getPath();
+    EXPECT_EQ(path, "root.branch.foo");
+    EXPECT_EQ(&path, &node.getPath());
+}
@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/PayloadCodec.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+
+using namespace velocitas;
+
+namespace {
+
+std::string createTelemetry() {
+    std::string telemetry;
+    for (int i = 0; i < 50; ++i) {
+        telemetry += R"({"path":"Vehicle.Speed","value":)" + std::to_string(i) + "},";
+    }
+    return telemetry;
+}
+
+} // namespace
+
+TEST(Test_PayloadCodec, createDeflate_encodeDecode_compressedRoundTrip) {
+    auto       codec     = IPayloadCodec::createDeflate();
+    const auto telemetry = createTelemetry();
+
+    const auto encoded = codec->encode(telemetry);
+    EXPECT_LT(encoded.size() * 5, telemetry.size());
+    EXPECT_EQ(telemetry, codec->decode(encoded));
+    EXPECT_EQ("deflate", codec->getName());
+}
+
+TEST(Test_PayloadCodec, createDeflate_withDictionary_smallerAndNamedByDictionary) {
+    const std::string payload = R"({"path":"Vehicle.Cabin.Seat.Row1.Pos1.Position","value":42})";
+    auto              plain   = IPayloadCodec::createDeflate();
+    auto              withDictionary =
+        IPayloadCodec::createDeflate(-1, R"({"path":"Vehicle.Cabin.Seat.Row1.Pos1.Position"})");
+
+    const auto encoded = withDictionary->encode(payload);
+    EXPECT_LT(encoded.size(), plain->encode(payload).size());
+    EXPECT_EQ(payload, withDictionary->decode(encoded));
+    EXPECT_EQ(0, withDictionary->getName().find("deflate-"));
+    EXPECT_THROW(plain->decode(encoded), std::runtime_error);
+}
+
+TEST(Test_PayloadCodec, decode_corruptPayload_throwsRuntimeError) {
+    auto codec   = IPayloadCodec::createDeflate();
+    auto encoded = codec->encode(createTelemetry());
+    EXPECT_THROW(codec->decode(encoded.substr(0, encoded.size() / 2)), std::runtime_error);
+    EXPECT_THROW(codec->decode("not deflated"), std::runtime_error);
+}
+
+TEST(Test_PayloadCodec, createDeflate_invalidLevel_throwsInvalidArgument) {
+    EXPECT_THROW(IPayloadCodec::createDeflate(10), std::invalid_argument);
+}
@@ -50,3 +50,34 @@ TEST(Test_QueryBuilder, whereCondition_eq) {
     const auto       query = QueryBuilder::select(foo).where(foo).eq(true).build();
     ASSERT_EQ(query, "SELECT foo WHERE foo = 1");
 }
+
+TEST(Test_QueryBuilder, select_variadicDataPoints_sameAsList) {
+    DataPointFloat foo{"foo", nullptr};
+    DataPointInt32 bar{"bar", nullptr};
+    const auto     query = QueryBuilder::select(foo, bar).build();
+    ASSERT_EQ(query, "SELECT foo, bar");
+}
+
+TEST(Test_QueryBuilder, buildQuery_noCondition_signalsInSelectionOrder) {
+    DataPointFloat foo{"foo", nullptr};
+    DataPointFloat bar{"bar", nullptr};
+    const auto     query = QueryBuilder::select(bar, foo).buildQuery();
+
+    EXPECT_EQ(query.toString(), "SELECT bar, foo");
+    EXPECT_EQ(query.getSignals(),
+              (std::vector<SignalHandle_t>{bar.getSignalHandle(), foo.getSignalHandle()}));
+    EXPECT_EQ(query.getSignalPaths(), (std::vector<std::string>{"bar", "foo"}));
+    EXPECT_TRUE(query.getConditions().empty());
+}
+
+TEST(Test_QueryBuilder, buildQuery_whereCondition_containsCondition) {
+    DataPointInt32 foo{"foo", nullptr};
+    const auto     query = QueryBuilder::select(foo).where(foo).lt(100).buildQuery();
+
+    EXPECT_EQ(query.toString(), "SELECT foo WHERE foo < 100");
+    ASSERT_EQ(query.getConditions().size(), 1);
+    const auto& condition = query.getConditions().front();
+    EXPECT_EQ(condition.m_signal, foo.getSignalHandle());
+    EXPECT_EQ(condition.m_operator, QueryCondition::Operator::LESS);
+    EXPECT_EQ(condition.m_operand.get<int32_t>(), 100);
+}
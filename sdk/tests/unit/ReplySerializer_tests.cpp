@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#include "sdk/ReplySerializer.h"
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+struct Motion {
+    SignalField<float>       speed;
+    SignalField<int32_t>     gear;
+    SignalField<std::string> mode;
+};
+
+DataPointReply createReply() {
+    DataPointReply reply;
+    reply.set("A.Speed", DataPointSample(42.5F, Timestamp{1, 5}));
+    reply.set("A.Gear", DataPointSample(DataPointValue::Type::INT32,
+                                        DataPointValue::Failure::NOT_AVAILABLE, Timestamp{2}));
+    reply.set("A.Ids", DataPointSample(std::vector<int64_t>{-1, 300}, Timestamp{}));
+    return reply;
+}
+
+} // namespace
+
+TEST(Test_ReplySerializer, serialize_replyAsJson_memberPerSignal) {
+    ReplySerializer serializer;
+
+    EXPECT_EQ("{\"A.Speed\":{\"value\":42.5,\"timestamp\":1000000005},"
+              "\"A.Gear\":{\"failure\":\"NOT_AVAILABLE\",\"timestamp\":2000000000},"
+              "\"A.Ids\":{\"value\":[-1,300],\"timestamp\":0}}",
+              serializer.serialize(createReply()));
+    EXPECT_EQ(3, serializer.getNumCachedKeys());
+}
+
+TEST(Test_ReplySerializer, serialize_specialValues_escapedOrNull) {
+    ReplySerializer serializer;
+    DataPointReply  reply;
+    reply.set("A.\"Quoted\"", DataPointSample(std::string("a\\b\n\x01"), Timestamp{}));
+    reply.set("A.Ratio", DataPointSample(std::numeric_limits<double>::infinity(), Timestamp{}));
+    reply.set("A.Flags", DataPointSample(std::vector<bool>{true, false}, Timestamp{}));
+    reply.set("A.Small", DataPointSample(int8_t{-8}, Timestamp{}));
+
+    const auto& payload = serializer.serialize(reply);
+
+    EXPECT_EQ("{\"A.\\\"Quoted\\\"\":{\"value\":\"a\\\\b\\n\\u0001\",\"timestamp\":0},"
+              "\"A.Ratio\":{\"value\":null,\"timestamp\":0},"
+              "\"A.Flags\":{\"value\":[true,false],\"timestamp\":0},"
+              "\"A.Small\":{\"value\":-8,\"timestamp\":0}}",
+              payload);
+    EXPECT_EQ("a\\b\n\x01", nlohmann::json::parse(payload)["A.\"Quoted\""]["value"]);
+}
+
+TEST(Test_ReplySerializer, serialize_replyAsCbor_sameStructureAsJson) {
+    ReplySerializer serializer(ReplySerializer::Format::CBOR);
+    DataPointReply  reply = createReply();
+    reply.set("A.Big", DataPointSample(std::numeric_limits<int64_t>::min(), Timestamp{}));
+    reply.set("A.Path", DataPointSample(std::string(300, 'x'), Timestamp{}));
+
+    const auto& payload = serializer.serialize(reply);
+
+    const auto decoded = nlohmann::json::from_cbor(payload);
+    ASSERT_EQ(5, decoded.size());
+    EXPECT_EQ(42.5F, decoded["A.Speed"]["value"].get<float>());
+    EXPECT_EQ(1000000005, decoded["A.Speed"]["timestamp"]);
+    EXPECT_EQ("NOT_AVAILABLE", decoded["A.Gear"]["failure"]);
+    EXPECT_EQ((std::vector<int64_t>{-1, 300}),
+              decoded["A.Ids"]["value"].get<std::vector<int64_t>>());
+    EXPECT_EQ(std::numeric_limits<int64_t>::min(), decoded["A.Big"]["value"].get<int64_t>());
+    EXPECT_EQ(std::string(300, 'x'), decoded["A.Path"]["value"]);
+}
+
+TEST(Test_ReplySerializer, serialize_repeatedly_bufferAndKeysReused) {
+    ReplySerializer serializer;
+    const auto      reply = createReply();
+
+    const auto& payload  = serializer.serialize(reply);
+    const auto  expected = payload;
+    const auto* data     = payload.data();
+    EXPECT_EQ(expected, serializer.serialize(reply));
+    // the buffer keeps its capacity, so the payload is written into the same memory again
+    EXPECT_EQ(data, serializer.getBuffer().data());
+    EXPECT_EQ(3, serializer.getNumCachedKeys());
+
+    EXPECT_EQ("{}", serializer.serialize(DataPointReply{}));
+}
+
+TEST(Test_ReplySerializer, serialize_view_boundFieldsInOrder) {
+    const auto view = SubscriptionView<Motion>()
+                          .bind(&Motion::speed, SignalPathRegistry::getInstance().intern("A.Speed"))
+                          .bind(&Motion::gear, SignalPathRegistry::getInstance().intern("A.Gear"))
+                          .bind(&Motion::mode, SignalPathRegistry::getInstance().intern("A.Mode"));
+    Motion motion;
+    view.fill(motion, createReply());
+
+    ReplySerializer serializer;
+    EXPECT_EQ("{\"A.Speed\":{\"value\":42.5,\"timestamp\":1000000005},"
+              "\"A.Gear\":{\"failure\":\"NOT_AVAILABLE\",\"timestamp\":2000000000},"
+              "\"A.Mode\":{\"failure\":\"NOT_AVAILABLE\",\"timestamp\":0}}",
+              serializer.serialize(view, motion));
+
+    ReplySerializer cborSerializer(ReplySerializer::Format::CBOR);
+    const auto decoded = nlohmann::json::from_cbor(cborSerializer.serialize(view, motion));
+    EXPECT_EQ(3, decoded.size());
+    EXPECT_EQ(42.5F, decoded["A.Speed"]["value"].get<float>());
+}
+
+TEST(Test_ReplySerializer, serialize_batch_columnOfTimestampsAndValues) {
+    ColumnarBatch batch;
+    batch.append("A.Speed", DataPointSample(1.5F, Timestamp{1}));
+    batch.append("A.Speed", DataPointSample(DataPointValue::Type::FLOAT,
+                                            DataPointValue::Failure::NOT_AVAILABLE, Timestamp{2}));
+    batch.append("A.Mode", DataPointSample(std::string("eco"), Timestamp{3}));
+    batch.append("A.Mode", DataPointSample(std::string("sport"), Timestamp{4}));
+
+    ReplySerializer serializer;
+    EXPECT_EQ("{\"A.Speed\":{\"timestamps\":[1000000000,2000000000],\"values\":[1.5,null]},"
+              "\"A.Mode\":{\"timestamps\":[3000000000,4000000000],\"values\":[\"eco\",\"sport\"]}}",
+              serializer.serialize(batch));
+
+    ReplySerializer cborSerializer(ReplySerializer::Format::CBOR);
+    const auto      decoded = nlohmann::json::from_cbor(cborSerializer.serialize(batch));
+    EXPECT_TRUE(decoded["A.Speed"]["values"][1].is_null());
+    EXPECT_EQ("sport", decoded["A.Mode"]["values"][1]);
+}
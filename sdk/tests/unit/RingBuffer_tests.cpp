@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/RingBuffer.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+
+TEST(Test_RingBuffer, ctor_capacityNoPowerOfTwo_roundedUp) {
+    EXPECT_EQ(2, RingBuffer<int>(0).capacity());
+    EXPECT_EQ(8, RingBuffer<int>(5).capacity());
+    EXPECT_EQ(16, RingBuffer<int>(16).capacity());
+}
+
+TEST(Test_RingBuffer, tryPop_emptyBuffer_returnsNullopt) {
+    RingBuffer<int> buffer(4);
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_FALSE(buffer.tryPop().has_value());
+}
+
+TEST(Test_RingBuffer, tryPush_someItems_poppedInOrder) {
+    RingBuffer<std::string> buffer(4);
+    EXPECT_TRUE(buffer.tryPush("a"));
+    EXPECT_TRUE(buffer.tryPush("b"));
+    EXPECT_FALSE(buffer.empty());
+    EXPECT_EQ(2, buffer.size());
+
+    EXPECT_EQ("a", buffer.tryPop());
+    EXPECT_EQ("b", buffer.tryPop());
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST(Test_RingBuffer, tryPush_bufferFull_returnsFalse) {
+    RingBuffer<int> buffer(2);
+    EXPECT_TRUE(buffer.tryPush(1));
+    EXPECT_TRUE(buffer.tryPush(2));
+    EXPECT_FALSE(buffer.tryPush(3));
+
+    EXPECT_EQ(1, buffer.tryPop());
+    EXPECT_TRUE(buffer.tryPush(3));
+    EXPECT_EQ(2, buffer.tryPop());
+    EXPECT_EQ(3, buffer.tryPop());
+}
+
+TEST(Test_RingBuffer, tryPush_moveOnlyType_movedInAndOut) {
+    RingBuffer<std::unique_ptr<int>> buffer(2);
+    EXPECT_TRUE(buffer.tryPush(std::make_unique<int>(42)));
+
+    auto item = buffer.tryPop();
+    ASSERT_TRUE(item.has_value());
+    EXPECT_EQ(42, **item);
+}
+
+TEST(Test_RingBuffer, dtor_remainingItems_destroyed) {
+    auto item = std::make_shared<int>(1);
+    {
+        RingBuffer<std::shared_ptr<int>> buffer(2);
+        buffer.tryPush(item);
+        EXPECT_EQ(2, item.use_count());
+    }
+    EXPECT_EQ(1, item.use_count());
+}
+
+TEST(Test_RingBuffer, tryPush_multipleProducersAndConsumers_noItemLostOrDuplicated) {
+    constexpr int            NUM_PRODUCERS          = 2;
+    constexpr int            NUM_CONSUMERS          = 2;
+    constexpr int            NUM_ITEMS_PER_PRODUCER = 20000;
+    RingBuffer<int>          buffer(64);
+    std::atomic<long long>   sum{0};
+    std::atomic_int          numConsumed{0};
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < NUM_PRODUCERS; ++producer) {
+        threads.emplace_back([&buffer]() {
+            for (int i = 1; i <= NUM_ITEMS_PER_PRODUCER; ++i) {
+                while (!buffer.tryPush(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int consumer = 0; consumer < NUM_CONSUMERS; ++consumer) {
+        threads.emplace_back([&]() {
+            while (numConsumed.load() < NUM_PRODUCERS * NUM_ITEMS_PER_PRODUCER) {
+                auto item = buffer.tryPop();
+                if (item) {
+                    sum += *item;
+                    ++numConsumed;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    constexpr long long EXPECTED_SUM =
+        NUM_PRODUCERS * (static_cast<long long>(NUM_ITEMS_PER_PRODUCER) *
+                         (NUM_ITEMS_PER_PRODUCER + 1) / 2);
+    EXPECT_EQ(EXPECTED_SUM, sum);
+    EXPECT_TRUE(buffer.empty());
+}
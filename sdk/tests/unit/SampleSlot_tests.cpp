@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/SampleSlot.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+using namespace velocitas;
+
+namespace {
+
+// leaves the slot locked like a writer dying between beginning and ending a write
+void abandonWrite(SampleSlot& slot) {
+    static_assert(std::is_standard_layout_v<SampleSlot>, "the sequence must be the first field");
+    reinterpret_cast<std::atomic<uint64_t>*>(&slot)->fetch_add(1);
+}
+
+} // namespace
+
+TEST(Test_SampleSlot, read_writtenScalars_sameSamples) {
+    SampleSlot slot;
+    EXPECT_EQ(0, slot.read().numUpdates);
+    EXPECT_EQ(DataPointValue::Failure::NOT_AVAILABLE, slot.read().sample.getFailure());
+
+    const auto receivedAt = SampleSlot::Clock_t::now();
+    EXPECT_TRUE(slot.write(DataPointSample(int8_t{-8}, Timestamp{1, 2}), receivedAt));
+    auto reading = slot.read();
+    EXPECT_EQ(-8, reading.sample.get<int8_t>());
+    EXPECT_EQ(1, reading.sample.getTimestamp().seconds);
+    EXPECT_EQ(2, reading.sample.getTimestamp().nanos);
+    EXPECT_EQ(receivedAt, reading.receivedAt);
+    EXPECT_EQ(1, reading.numUpdates);
+
+    EXPECT_TRUE(slot.write(DataPointSample(uint64_t{1} << 60, Timestamp{}), receivedAt));
+    EXPECT_EQ(uint64_t{1} << 60, slot.read().sample.get<uint64_t>());
+    EXPECT_TRUE(slot.write(DataPointSample(2.5, Timestamp{}), receivedAt));
+    EXPECT_DOUBLE_EQ(2.5, slot.read().sample.get<double>());
+    EXPECT_EQ(3, slot.getNumUpdates());
+
+    slot.reset();
+    EXPECT_EQ(0, slot.getNumUpdates());
+}
+
+TEST(Test_SampleSlot, write_failureOrNonScalar_failureKeptNonScalarRejected) {
+    SampleSlot slot;
+    const auto receivedAt = SampleSlot::Clock_t::now();
+    EXPECT_TRUE(slot.write(DataPointSample(DataPointValue::Type::FLOAT,
+                                           DataPointValue::Failure::ACCESS_DENIED, Timestamp{3, 0}),
+                           receivedAt));
+    const auto reading = slot.read();
+    EXPECT_EQ(DataPointValue::Failure::ACCESS_DENIED, reading.sample.getFailure());
+    EXPECT_EQ(DataPointValue::Type::FLOAT, reading.sample.getType());
+
+    EXPECT_FALSE(slot.write(DataPointSample(std::string("text"), Timestamp{}), receivedAt));
+    EXPECT_EQ(1, slot.getNumUpdates());
+}
+
+TEST(Test_SampleSlot, read_concurrentWrites_neverTorn) {
+    SampleSlot        slot;
+    std::atomic<bool> isStopping{false};
+    std::thread       writer([&]() {
+        for (int64_t i = 0; !isStopping; ++i) {
+            // value and timestamp are written together, so a torn read mixes them up
+            slot.write(DataPointSample(i, Timestamp{i, 0}), SampleSlot::Clock_t::now());
+        }
+    });
+    for (int i = 0; i < 100000; ++i) {
+        const auto reading = slot.read();
+        if (reading.numUpdates > 0) {
+            ASSERT_EQ(reading.sample.get<int64_t>(), reading.sample.getTimestamp().seconds);
+        }
+    }
+    isStopping = true;
+    writer.join();
+}
+
+TEST(Test_SampleSlot, tryRead_writeNeverCompleted_givesUp) {
+    SampleSlot slot;
+    slot.write(DataPointSample(1.5F, Timestamp{}), SampleSlot::Clock_t::now());
+    const auto reading = slot.tryRead(1);
+    ASSERT_TRUE(reading.has_value());
+    EXPECT_FLOAT_EQ(1.5F, reading->sample.get<float>());
+
+    abandonWrite(slot);
+    EXPECT_FALSE(slot.tryRead(64).has_value());
+}
@@ -0,0 +1,175 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/SignalHistory.h"
+
+#include "sdk/DataPointReply.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+SignalHistorySample sampleAt(int64_t milliseconds, double value) {
+    return {Timestamp{milliseconds / 1000, static_cast<int32_t>(milliseconds % 1000) * 1000000},
+            value};
+}
+
+} // namespace
+
+TEST(Test_SignalHistory, getAggregates_noSample_nullopt) {
+    const SignalHistory history;
+    EXPECT_FALSE(history.getAggregates().has_value());
+    EXPECT_TRUE(history.getSamples().empty());
+}
+
+TEST(Test_SignalHistory, getAggregates_someSamples_aggregatesOfAll) {
+    SignalHistory history;
+    history.record(sampleAt(0, 2.0));
+    history.record(sampleAt(500, 8.0));
+    history.record(sampleAt(2000, 5.0));
+
+    const auto aggregates = history.getAggregates();
+    ASSERT_TRUE(aggregates.has_value());
+    EXPECT_EQ(3, aggregates->count);
+    EXPECT_DOUBLE_EQ(15.0, aggregates->sum);
+    EXPECT_DOUBLE_EQ(5.0, aggregates->mean);
+    EXPECT_DOUBLE_EQ(2.0, aggregates->min);
+    EXPECT_DOUBLE_EQ(8.0, aggregates->max);
+    EXPECT_DOUBLE_EQ(1.5, aggregates->rateOfChange);
+    EXPECT_DOUBLE_EQ(5.0, aggregates->latest.value);
+}
+
+TEST(Test_SignalHistory, record_capacityExceeded_oldestSamplesEvicted) {
+    SignalHistory history({3, std::chrono::milliseconds{0}});
+    history.record(sampleAt(0, 9.0));
+    history.record(sampleAt(1, 1.0));
+    history.record(sampleAt(2, 4.0));
+    history.record(sampleAt(3, 3.0));
+    history.record(sampleAt(4, 2.0));
+
+    const auto aggregates = history.getAggregates();
+    ASSERT_TRUE(aggregates.has_value());
+    EXPECT_EQ(3, aggregates->count);
+    EXPECT_DOUBLE_EQ(9.0, aggregates->sum);
+    EXPECT_DOUBLE_EQ(2.0, aggregates->min);
+    EXPECT_DOUBLE_EQ(4.0, aggregates->max);
+
+    const auto samples = history.getSamples();
+    ASSERT_EQ(3, samples.size());
+    EXPECT_DOUBLE_EQ(4.0, samples[0].value);
+    EXPECT_DOUBLE_EQ(2.0, samples[2].value);
+}
+
+TEST(Test_SignalHistory, record_samplesLeaveWindow_excludedFromAggregates) {
+    SignalHistory history({16, std::chrono::milliseconds{1000}});
+    history.record(sampleAt(0, 100.0));
+    history.record(sampleAt(600, 1.0));
+    history.record(sampleAt(1200, 3.0));
+    history.record(sampleAt(1400, 2.0));
+
+    const auto aggregates = history.getAggregates();
+    ASSERT_TRUE(aggregates.has_value());
+    EXPECT_EQ(3, aggregates->count);
+    EXPECT_DOUBLE_EQ(6.0, aggregates->sum);
+    EXPECT_DOUBLE_EQ(1.0, aggregates->min);
+    EXPECT_DOUBLE_EQ(3.0, aggregates->max);
+    EXPECT_DOUBLE_EQ(1.25, aggregates->rateOfChange);
+}
+
+TEST(Test_SignalHistory, record_outOfOrderSample_recordedAtNewestTime) {
+    SignalHistory history;
+    history.record(sampleAt(1000, 1.0));
+    history.record(sampleAt(500, 2.0));
+
+    const auto samples = history.getSamples();
+    ASSERT_EQ(2, samples.size());
+    EXPECT_EQ(samples[0].timestamp, samples[1].timestamp);
+    EXPECT_DOUBLE_EQ(0.0, history.getAggregates()->rateOfChange);
+}
+
+TEST(Test_SignalHistory, record_manySamples_minMaxMatchBruteForce) {
+    SignalHistory history({8, std::chrono::milliseconds{50}});
+    std::vector<SignalHistorySample> recorded;
+    for (int i = 0; i < 200; ++i) {
+        const auto value = static_cast<double>((i * 37) % 23);
+        recorded.push_back(sampleAt(i * 10, value));
+        history.record(recorded.back());
+
+        const auto samples = history.getSamples();
+        ASSERT_FALSE(samples.empty());
+        double min = samples.front().value;
+        double max = samples.front().value;
+        for (const auto& sample : samples) {
+            min = std::min(min, sample.value);
+            max = std::max(max, sample.value);
+        }
+        const auto aggregates = history.getAggregates();
+        EXPECT_DOUBLE_EQ(min, aggregates->min);
+        EXPECT_DOUBLE_EQ(max, aggregates->max);
+        EXPECT_LE(aggregates->count, 6);
+    }
+}
+
+TEST(Test_SignalHistory, clear_someSamples_empty) {
+    SignalHistory history;
+    history.record(sampleAt(0, 1.0));
+    history.clear();
+
+    EXPECT_FALSE(history.getAggregates().has_value());
+    history.record(sampleAt(10, 4.0));
+    EXPECT_DOUBLE_EQ(4.0, history.getAggregates()->sum);
+}
+
+TEST(Test_SignalHistoryStore, record_enabledSignal_numericValuesRecorded) {
+    auto&      store  = SignalHistoryStore::getInstance();
+    const auto signal = SignalPathRegistry::getInstance().intern("Test.SignalHistory.Enabled");
+    store.enable(signal);
+    EXPECT_TRUE(store.isRecording(signal));
+
+    store.record(signal, DataPointSample(3.0F, Timestamp{1, 0}));
+    store.record(signal, DataPointSample(DataPointValue::Type::FLOAT,
+                                         DataPointValue::Failure::NOT_AVAILABLE));
+    store.record(signal, DataPointSample(std::string{"text"}));
+    DataPointReply reply;
+    reply.set(signal, DataPointSample(5.0F, Timestamp{2, 0}));
+    store.record(reply);
+
+    const auto aggregates = store.getAggregates(signal);
+    ASSERT_TRUE(aggregates.has_value());
+    EXPECT_EQ(2, aggregates->count);
+    EXPECT_DOUBLE_EQ(8.0, aggregates->sum);
+    EXPECT_DOUBLE_EQ(2.0, aggregates->rateOfChange);
+
+    store.disable(signal);
+    EXPECT_FALSE(store.isRecording(signal));
+    EXPECT_FALSE(store.getAggregates(signal).has_value());
+}
+
+TEST(Test_SignalHistoryStore, record_notEnabledSignal_nothingRecorded) {
+    auto&      store  = SignalHistoryStore::getInstance();
+    const auto signal = SignalPathRegistry::getInstance().intern("Test.SignalHistory.Disabled");
+    store.record(signal, DataPointSample(1));
+
+    EXPECT_FALSE(store.isRecording(signal));
+    EXPECT_FALSE(store.getAggregates(signal).has_value());
+    EXPECT_TRUE(store.getSamples(signal).empty());
+}
@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/SignalMirror.h"
+
+#include "sdk/DataPoint.h"
+#include "sdk/DataPointReply.h"
+#include "sdk/Exceptions.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+using namespace velocitas;
+
+TEST(Test_SignalMirror, getLatest_enabledSignal_latestValueWithFreshness) {
+    auto&      mirror = SignalMirror::getInstance();
+    const auto signal = SignalPathRegistry::getInstance().intern("Test.SignalMirror.Enabled");
+    mirror.enable(signal);
+    EXPECT_TRUE(mirror.isMirroring(signal));
+    EXPECT_EQ(DataPointValue::Failure::NOT_AVAILABLE, mirror.getLatest<float>(signal).failure);
+    EXPECT_FALSE(mirror.getLatest<float>(signal).isFresh(std::chrono::hours{1}));
+
+    mirror.record(signal, DataPointSample(3.0F, Timestamp{1, 0}));
+    DataPointReply reply;
+    reply.set(signal, DataPointSample(5.0F, Timestamp{2, 0}));
+    mirror.record(reply);
+
+    const auto latest = mirror.getLatest<float>(signal);
+    EXPECT_TRUE(latest.isValid());
+    EXPECT_FLOAT_EQ(5.0F, latest.value);
+    EXPECT_EQ(2, latest.timestamp.seconds);
+    EXPECT_EQ(2, latest.numUpdates);
+    EXPECT_TRUE(latest.isFresh(std::chrono::hours{1}));
+    EXPECT_FALSE(latest.isFresh(std::chrono::nanoseconds{-1}));
+
+    mirror.disable(signal);
+    EXPECT_FALSE(mirror.isMirroring(signal));
+    EXPECT_EQ(0, mirror.getLatest<float>(signal).numUpdates);
+}
+
+TEST(Test_SignalMirror, getLatest_failureOrOtherType_latestValueInvalid) {
+    auto&      mirror = SignalMirror::getInstance();
+    const auto signal = SignalPathRegistry::getInstance().intern("Test.SignalMirror.Failure");
+    mirror.enable(signal);
+
+    mirror.record(signal, DataPointSample(int32_t{7}));
+    EXPECT_EQ(DataPointValue::Failure::INVALID_VALUE, mirror.getLatest<float>(signal).failure);
+    mirror.record(signal, DataPointSample(DataPointValue::Type::INT32,
+                                          DataPointValue::Failure::ACCESS_DENIED));
+    EXPECT_EQ(DataPointValue::Failure::ACCESS_DENIED, mirror.getLatest<int32_t>(signal).failure);
+    // values which are not scalar are not mirrored
+    mirror.record(signal, DataPointSample(std::string{"text"}));
+    EXPECT_EQ(2, mirror.getLatest<int32_t>(signal).numUpdates);
+
+    mirror.disable(signal);
+}
+
+TEST(Test_SignalMirror, getLatest_transportedAsWiderType_narrowed) {
+    auto&      mirror = SignalMirror::getInstance();
+    const auto signal = SignalPathRegistry::getInstance().intern("Test.SignalMirror.Narrowed");
+    mirror.enable(signal);
+
+    mirror.record(signal, DataPointSample(int32_t{-5}));
+    EXPECT_EQ(-5, mirror.getLatest<int8_t>(signal).value);
+    mirror.record(signal, DataPointSample(int32_t{300}));
+    EXPECT_EQ(DataPointValue::Failure::INVALID_VALUE, mirror.getLatest<int8_t>(signal).failure);
+
+    mirror.disable(signal);
+}
+
+TEST(Test_SignalMirror, getLatest_notEnabledSignal_notAvailable) {
+    const auto signal = SignalPathRegistry::getInstance().intern("Test.SignalMirror.Disabled");
+    SignalMirror::getInstance().record(signal, DataPointSample(1.0));
+
+    const auto latest = SignalMirror::getInstance().getLatest<double>(signal);
+    EXPECT_FALSE(latest.isValid());
+    EXPECT_EQ(0, latest.numUpdates);
+}
+
+TEST(Test_SignalMirror, enable_handleExceedingCapacity_throws) {
+    EXPECT_THROW(SignalMirror::getInstance().enable(SignalMirror::MAX_NUM_SIGNALS),
+                 InvalidValueException);
+}
+
+TEST(Test_SignalMirror, getLatest_concurrentWrites_readsConsistent) {
+    auto&      mirror = SignalMirror::getInstance();
+    const auto signal = SignalPathRegistry::getInstance().intern("Test.SignalMirror.Concurrent");
+    mirror.enable(signal);
+
+    std::atomic_bool isWriting{true};
+    std::thread      writer([&]() {
+        for (int64_t i = 1; i <= 100000; ++i) {
+            mirror.record(signal, DataPointSample(i, Timestamp{i, 0}));
+        }
+        isWriting = false;
+    });
+    int64_t previous = 0;
+    while (isWriting) {
+        const auto latest = mirror.getLatest<int64_t>(signal);
+        if (latest.isValid()) {
+            ASSERT_EQ(latest.value, latest.timestamp.seconds);
+            ASSERT_GE(latest.value, previous);
+            previous = latest.value;
+        }
+    }
+    writer.join();
+
+    EXPECT_EQ(100000, mirror.getLatest<int64_t>(signal).value);
+    mirror.disable(signal);
+}
+
+TEST(Test_SignalMirror, latest_mirroredDataPoint_readViaDataPoint) {
+    const DataPointFloat dataPoint{"Test.SignalMirror.DataPoint", nullptr};
+    dataPoint.enableMirror();
+
+    SignalMirror::getInstance().record(dataPoint.getSignalHandle(), DataPointSample(42.0F));
+
+    EXPECT_FLOAT_EQ(42.0F, dataPoint.latest().value);
+    dataPoint.disableMirror();
+    EXPECT_FALSE(dataPoint.latest().isValid());
+}
@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/SignalPathRegistry.h"
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using namespace velocitas;
+
+TEST(Test_SignalPathRegistry, intern_samePath_returnsSameHandle) {
+    auto& registry = SignalPathRegistry::getInstance();
+    auto  handle   = registry.intern("Test.SignalPathRegistry.Same");
+    EXPECT_EQ(handle, registry.intern(std::string("Test.SignalPathRegistry.Same")));
+    EXPECT_NE(handle, registry.intern("Test.SignalPathRegistry.Other"));
+}
+
+TEST(Test_SignalPathRegistry, getPath_internedHandle_returnsPath) {
+    auto& registry = SignalPathRegistry::getInstance();
+    auto  handle   = registry.intern("Test.SignalPathRegistry.GetPath");
+    EXPECT_EQ("Test.SignalPathRegistry.GetPath", registry.getPath(handle));
+}
+
+TEST(Test_SignalPathRegistry, find_unknownPath_returnsNullopt) {
+    auto& registry = SignalPathRegistry::getInstance();
+    EXPECT_FALSE(registry.find("Test.SignalPathRegistry.NeverInterned").has_value());
+
+    auto handle = registry.intern("Test.SignalPathRegistry.Find");
+    EXPECT_EQ(handle, registry.find("Test.SignalPathRegistry.Find"));
+}
+
+TEST(Test_SignalPathRegistry, getPath_unknownHandle_throwsOutOfRange) {
+    auto& registry = SignalPathRegistry::getInstance();
+    EXPECT_THROW(std::ignore = registry.getPath(INVALID_SIGNAL_HANDLE), std::out_of_range);
+    EXPECT_THROW(std::ignore = registry.getPath(static_cast<SignalHandle_t>(registry.size())),
+                 std::out_of_range);
+}
+
+TEST(Test_SignalPathRegistry, intern_concurrently_assignsOneHandlePerPath) {
+    constexpr int NUM_THREADS = 4;
+    constexpr int NUM_PATHS   = 2000;
+
+    auto&                                    registry = SignalPathRegistry::getInstance();
+    std::vector<std::vector<SignalHandle_t>> handles(NUM_THREADS);
+    std::vector<std::thread>                 threads;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([&registry, &result = handles[t]]() {
+            for (int i = 0; i < NUM_PATHS; ++i) {
+                result.push_back(
+                    registry.intern("Test.SignalPathRegistry.Concurrent." + std::to_string(i)));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::set<SignalHandle_t> distinctHandles(handles[0].cbegin(), handles[0].cend());
+    EXPECT_EQ(NUM_PATHS, distinctHandles.size());
+    for (int t = 1; t < NUM_THREADS; ++t) {
+        EXPECT_EQ(handles[0], handles[t]);
+    }
+    for (int i = 0; i < NUM_PATHS; ++i) {
+        EXPECT_EQ("Test.SignalPathRegistry.Concurrent." + std::to_string(i),
+                  registry.getPath(handles[0][i]));
+    }
+}
@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/SignalTable.h"
+
+#include "sdk/DataPoint.h"
+#include "sdk/Model.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+constexpr std::array<SignalDescriptor, 2> TEST_SIGNALS{{
+    {"TestModel.Speed", DataPointValue::Type::FLOAT, Node::Type::SENSOR},
+    {"TestModel.Branch.Position", DataPointValue::Type::UINT32, Node::Type::ACTUATOR},
+}};
+
+const SignalTable& getTestSignalTable() {
+    static const SignalTable table(TEST_SIGNALS);
+    return table;
+}
+
+} // namespace
+
+TEST(Test_SignalTable, construction_allPathsInterned) {
+    const auto& table = getTestSignalTable();
+
+    ASSERT_EQ(2, table.size());
+    auto& registry = SignalPathRegistry::getInstance();
+    EXPECT_EQ(registry.find("TestModel.Speed"), table.getHandle(0));
+    EXPECT_EQ(registry.find("TestModel.Branch.Position"), table.getHandle(1));
+}
+
+TEST(Test_SignalTable, getDescriptor_outOfRange_throws) {
+    EXPECT_THROW(static_cast<void>(getTestSignalTable().getDescriptor(2)), std::out_of_range);
+    EXPECT_THROW(static_cast<void>(getTestSignalTable().getHandle(2)), std::out_of_range);
+}
+
+TEST(Test_SignalTable, findIndex_tableAndForeignHandles) {
+    const auto& table = getTestSignalTable();
+
+    EXPECT_EQ(std::optional<size_t>{1}, table.findIndex(table.getHandle(1)));
+    EXPECT_FALSE(table.findIndex(SignalPathRegistry::getInstance().intern("Foreign.Signal")));
+}
+
+TEST(Test_SignalTable, getSignalPaths_tableOrder) {
+    EXPECT_EQ((std::vector<std::string>{"TestModel.Speed", "TestModel.Branch.Position"}),
+              getTestSignalTable().getSignalPaths());
+}
+
+TEST(Test_SignalTable, dataPointConstruction_fromTable_sameAsFromNames) {
+    const auto& table = getTestSignalTable();
+    Model       model("TestModel");
+    Model       branch("Branch", &model);
+
+    const DataPointUint32 fromTable(table, 1, &branch);
+
+    EXPECT_EQ("Position", fromTable.getName());
+    EXPECT_EQ("TestModel.Branch.Position", fromTable.getPath());
+    EXPECT_EQ(Node::Type::ACTUATOR, fromTable.getType());
+    EXPECT_EQ(table.getHandle(1), fromTable.getSignalHandle());
+    EXPECT_EQ(&branch, fromTable.getParent());
+
+    const DataPointUint32 fromNames("Position", &branch);
+    EXPECT_EQ(fromNames.getPath(), fromTable.getPath());
+    EXPECT_EQ(fromNames.getSignalHandle(), fromTable.getSignalHandle());
+}
@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/Strand.h"
+#include "sdk/ThreadPool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+using namespace std::chrono_literals;
+
+namespace {
+constexpr auto DEFAULT_TIMEOUT = 1s;
+} // namespace
+
+class Test_Strand : public ::testing::Test {
+protected:
+    // wait until all functions posted so far have been executed
+    bool drain(const StrandPtr_t& strand) {
+        std::promise<void> drained;
+        strand->post([&drained]() { drained.set_value(); });
+        return drained.get_future().wait_for(DEFAULT_TIMEOUT) == std::future_status::ready;
+    }
+
+    std::shared_ptr<ThreadPool> m_pool{std::make_shared<ThreadPool>(4)};
+    StrandPtr_t                 m_strand{Strand::create(m_pool)};
+};
+
+TEST_F(Test_Strand, create_noPool_usesDefaultPool) {
+    EXPECT_EQ(ThreadPool::getInstance(), Strand::create()->getThreadPool());
+    EXPECT_EQ(m_pool, m_strand->getThreadPool());
+}
+
+TEST_F(Test_Strand, post_manyFunctions_executedInOrder) {
+    constexpr int    NUM_JOBS = 100;
+    std::vector<int> executionOrder;
+    for (int i = 0; i < NUM_JOBS; ++i) {
+        m_strand->post([&executionOrder, i]() { executionOrder.push_back(i); });
+    }
+
+    ASSERT_TRUE(drain(m_strand));
+    ASSERT_EQ(NUM_JOBS, executionOrder.size());
+    for (int i = 0; i < NUM_JOBS; ++i) {
+        EXPECT_EQ(i, executionOrder[i]);
+    }
+}
+
+TEST_F(Test_Strand, post_fromMultipleThreads_neverExecutedConcurrently) {
+    constexpr int            NUM_THREADS         = 4;
+    constexpr int            NUM_JOBS_PER_THREAD = 250;
+    std::atomic_int          numRunning{0};
+    std::atomic_bool         overlapDetected{false};
+    int                      numExecuted{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < NUM_JOBS_PER_THREAD; ++j) {
+                m_strand->post([&]() {
+                    if (numRunning.fetch_add(1) != 0) {
+                        overlapDetected = true;
+                    }
+                    ++numExecuted;
+                    numRunning.fetch_sub(1);
+                });
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_TRUE(drain(m_strand));
+    EXPECT_FALSE(overlapDetected);
+    EXPECT_EQ(NUM_THREADS * NUM_JOBS_PER_THREAD, numExecuted);
+}
+
+TEST_F(Test_Strand, post_functionThrows_laterFunctionsExecuted) {
+    std::atomic_bool executed{false};
+    m_strand->post([]() { throw std::runtime_error("failure"); });
+    m_strand->post([&executed]() { executed = true; });
+
+    ASSERT_TRUE(drain(m_strand));
+    EXPECT_TRUE(executed);
+}
+
+TEST_F(Test_Strand, isRunningInThisThread_insideAndOutsideOfStrand) {
+    std::atomic_bool insideStrand{false};
+    std::atomic_bool insideOtherStrand{true};
+    auto             otherStrand = Strand::create(m_pool);
+    m_strand->post([&]() {
+        insideStrand      = m_strand->isRunningInThisThread();
+        insideOtherStrand = otherStrand->isRunningInThisThread();
+    });
+
+    ASSERT_TRUE(drain(m_strand));
+    EXPECT_TRUE(insideStrand);
+    EXPECT_FALSE(insideOtherStrand);
+    EXPECT_FALSE(m_strand->isRunningInThisThread());
+}
+
+TEST_F(Test_Strand, push_strandAlreadyScheduled_returnsNoJob) {
+    auto job = m_strand->push([]() {});
+    ASSERT_NE(nullptr, job);
+    EXPECT_EQ(nullptr, m_strand->push([]() {}));
+    EXPECT_EQ(2, m_strand->getNumPendingJobs());
+
+    m_pool->enqueue(job);
+    ASSERT_TRUE(drain(m_strand));
+    EXPECT_EQ(0, m_strand->getNumPendingJobs());
+}
+
+TEST_F(Test_Strand, post_differentStrands_executedInParallel) {
+    std::promise<void> firstStarted;
+    std::promise<void> secondExecuted;
+    auto               secondExecutedFuture = secondExecuted.get_future();
+    auto               otherStrand          = Strand::create(m_pool);
+
+    m_strand->post([&]() {
+        firstStarted.set_value();
+        // blocks this strand until the other one made progress
+        secondExecutedFuture.wait_for(DEFAULT_TIMEOUT);
+    });
+    firstStarted.get_future().wait();
+    otherStrand->post([&secondExecuted]() { secondExecuted.set_value(); });
+
+    EXPECT_TRUE(drain(otherStrand));
+    EXPECT_TRUE(drain(m_strand));
+}
+
+TEST_F(Test_Strand, post_lastPoolReferenceDroppedByStrandJob_poolDestroyedOnWorker) {
+    auto                      pool = std::make_shared<ThreadPool>(2);
+    std::weak_ptr<ThreadPool> weakPool{pool};
+    std::promise<void>        started;
+    std::promise<void>        release;
+    auto                      releaseFuture = release.get_future();
+    {
+        auto strand = Strand::create(std::move(pool));
+        strand->post([&started, &releaseFuture]() {
+            started.set_value();
+            releaseFuture.wait();
+        });
+    }
+    started.get_future().wait();
+    // the running job now holds the only reference to the strand and thereby to the pool
+    EXPECT_FALSE(weakPool.expired());
+    release.set_value();
+
+    const auto deadline = std::chrono::steady_clock::now() + DEFAULT_TIMEOUT;
+    while (!weakPool.expired() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_TRUE(weakPool.expired());
+}
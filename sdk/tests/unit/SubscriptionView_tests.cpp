@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/SubscriptionView.h"
+
+#include "sdk/CallbackExecutor.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+struct Motion {
+    SignalField<float>       speed;
+    SignalField<int32_t>     gear;
+    SignalField<std::string> driver;
+};
+
+class Test_SubscriptionView : public ::testing::Test {
+protected:
+    Test_SubscriptionView() {
+        m_view.bind(&Motion::speed, m_speed)
+            .bind(&Motion::gear, m_gear)
+            .bind(&Motion::driver, m_driver.getSignalHandle());
+        m_source->setCallbackExecutor(CallbackExecutor::createInline());
+    }
+
+    DataPointFloat           m_speed{"Vehicle.Test.View.Speed", nullptr};
+    DataPointInt32           m_gear{"Vehicle.Test.View.Gear", nullptr};
+    DataPointString          m_driver{"Vehicle.Test.View.Driver", nullptr};
+    SubscriptionView<Motion> m_view;
+
+    AsyncSubscriptionPtr_t<DataPointReply> m_source =
+        std::make_shared<AsyncSubscription<DataPointReply>>();
+};
+
+} // namespace
+
+TEST_F(Test_SubscriptionView, fill_replyWithBoundSignals_fieldsSetWithValidity) {
+    DataPointReply reply;
+    reply.set(m_speed.getSignalHandle(), DataPointSample(12.5F, Timestamp{42, 0}));
+    reply.set(m_gear.getSignalHandle(), DataPointSample(DataPointValue::Type::INT32,
+                                                        DataPointValue::Failure::NOT_AVAILABLE));
+
+    Motion motion;
+    m_view.fill(motion, reply);
+
+    EXPECT_TRUE(motion.speed.isValid);
+    EXPECT_TRUE(motion.speed.wasUpdated);
+    EXPECT_FLOAT_EQ(12.5F, motion.speed.value);
+    EXPECT_EQ(42, motion.speed.timestamp.seconds);
+    EXPECT_FALSE(motion.gear.isValid);
+    EXPECT_EQ(DataPointValue::Failure::NOT_AVAILABLE, motion.gear.failure);
+    EXPECT_FALSE(motion.driver.isValid);
+    EXPECT_FALSE(motion.driver.wasUpdated);
+}
+
+TEST_F(Test_SubscriptionView, fill_valueOfOtherType_fieldInvalid) {
+    DataPointReply reply;
+    reply.set(m_gear.getSignalHandle(), DataPointSample(3.0F, Timestamp{}));
+
+    Motion motion;
+    m_view.fill(motion, reply);
+
+    EXPECT_FALSE(motion.gear.isValid);
+    EXPECT_EQ(DataPointValue::Failure::INVALID_VALUE, motion.gear.failure);
+}
+
+TEST_F(Test_SubscriptionView, buildQuery_boundSignals_selectedInOrderOfBinding) {
+    const auto query = m_view.buildQuery();
+
+    EXPECT_EQ((std::vector<SignalHandle_t>{m_speed.getSignalHandle(), m_gear.getSignalHandle(),
+                                           m_driver.getSignalHandle()}),
+              query.getSignals());
+    EXPECT_EQ("SELECT Vehicle.Test.View.Speed, Vehicle.Test.View.Gear, Vehicle.Test.View.Driver",
+              query.toString());
+}
+
+TEST_F(Test_SubscriptionView, attach_deltaReplies_fieldsKeptBetweenReplies) {
+    std::vector<Motion> motions;
+    m_view.attach(m_source)->onItem(
+        [&motions](const Motion& motion) { motions.push_back(motion); });
+
+    DataPointReply first;
+    first.set(m_speed.getSignalHandle(), DataPointSample(10.0F, Timestamp{}));
+    first.set(m_driver.getSignalHandle(), DataPointSample(std::string("Jane"), Timestamp{}));
+    m_source->insertNewItem(std::move(first));
+    DataPointReply second;
+    second.set(m_speed.getSignalHandle(), DataPointSample(20.0F, Timestamp{}));
+    m_source->insertNewItem(std::move(second));
+
+    ASSERT_EQ(2, motions.size());
+    EXPECT_FLOAT_EQ(20.0F, motions[1].speed.value);
+    EXPECT_TRUE(motions[1].speed.wasUpdated);
+    EXPECT_EQ("Jane", motions[1].driver.value);
+    EXPECT_TRUE(motions[1].driver.isValid);
+    EXPECT_FALSE(motions[1].driver.wasUpdated);
+}
+
+TEST_F(Test_SubscriptionView, attach_viewSubscriptionCancelled_sourceCancelledWithNextReply) {
+    auto subscription = m_view.attach(m_source);
+    subscription->onItem([](const Motion&) {});
+
+    subscription->cancel();
+    m_source->insertNewItem(DataPointReply());
+
+    EXPECT_TRUE(m_source->isCancelled());
+}
+
+TEST_F(Test_SubscriptionView, attach_sourceFails_errorPassedOn) {
+    std::string error;
+    m_view.attach(m_source)
+        ->onItem([](const Motion&) {})
+        ->onError([&error](const Status& status) { error = status.errorMessage(); });
+
+    m_source->insertError(Status("broker gone"));
+
+    EXPECT_EQ("broker gone", error);
+}
+
+TEST_F(Test_SubscriptionView, getSnapshot_sourceWithSnapshot_viewFilledFromIt) {
+    m_source->setSnapshotProvider([this]() {
+        DataPointReply snapshot;
+        snapshot.set(m_gear.getSignalHandle(), DataPointSample(int32_t{4}, Timestamp{}));
+        return snapshot;
+    });
+
+    const auto snapshot = m_view.attach(m_source)->getSnapshot();
+
+    ASSERT_TRUE(snapshot.has_value());
+    EXPECT_EQ(4, snapshot->gear.value);
+    EXPECT_TRUE(snapshot->gear.isValid);
+}
+
+TEST_F(Test_SubscriptionView, attach_noSource_throws) {
+    EXPECT_THROW(m_view.attach(nullptr), InvalidValueException);
+}
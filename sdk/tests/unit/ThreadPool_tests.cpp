@@ -16,10 +16,19 @@
 
 #include "sdk/ThreadPool.h"
 
+#include <array>
 #include <atomic>
 #include <exception>
+#include <future>
+#include <queue>
+#include <stdexcept>
 #include <gtest/gtest.h>
 
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 using namespace velocitas;
 using namespace std::chrono_literals;
 
@@ -64,6 +73,13 @@ public:
         return m_executionStateCV.wait_for(lock, timeout,
                                            [this] { return m_executionState == Executing; });
     }
+    bool waitForExecutionCount(unsigned int                     executionCount,
+                               const std::chrono::milliseconds& timeout = DEFAULT_TIMEOUT) {
+        std::unique_lock lock{m_executionMutex};
+        return m_executionStateCV.wait_for(lock, timeout, [this, executionCount] {
+            return m_executionState == Executing && m_executionCount >= executionCount;
+        });
+    }
     bool waitForFinished(const std::chrono::milliseconds& timeout = DEFAULT_TIMEOUT) {
         std::unique_lock lock{m_executionMutex};
         return m_executionStateCV.wait_for(lock, timeout,
@@ -125,6 +141,17 @@ protected:
         return true;
     }
 
+    // the metrics of a job are recorded right after its execution returned
+    ThreadPoolMetrics waitForExecutedJobs(uint64_t numJobs) {
+        const auto start   = Clock::now();
+        auto       metrics = m_pool->getMetrics();
+        while (metrics.numExecutedJobs < numJobs && Clock::now() - start < DEFAULT_TIMEOUT) {
+            std::this_thread::sleep_for(1ms);
+            metrics = m_pool->getMetrics();
+        }
+        return metrics;
+    }
+
     std::shared_ptr<ThreadPool> m_pool;
     std::queue<FakeJobPtr_t>    m_fakeJobs;
 };
@@ -200,6 +227,107 @@ TEST_F(Test_ThreadPool, destroyThreadPool_oneQueuedJob_cleanlyTerminates) {
     EXPECT_NO_THROW(poolKiller.join());
 }
 
+TEST_F(Test_ThreadPool, destroyThreadPool_byExecutingJob_workerLeavesPoolUntouched) {
+    // the job holds the only reference to the pool and drops it while executing
+    auto pool     = std::make_shared<std::shared_ptr<ThreadPool>>(std::move(m_pool));
+    auto sentinel = std::make_shared<int>(0);
+    std::weak_ptr<int> weakSentinel = sentinel;
+    (*pool)->enqueue(Job::create([pool, sentinel]() { pool->reset(); }));
+    pool.reset();
+    sentinel.reset();
+
+    // the worker releases the job after being done with the pool
+    const auto deadline = std::chrono::steady_clock::now() + DEFAULT_TIMEOUT;
+    while (!weakSentinel.expired() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_TRUE(weakSentinel.expired());
+}
+
+namespace {
+// a delayed job, which is discarded as soon as the pool starts shutting down
+std::weak_ptr<int> enqueueShutdownSentinel(ThreadPool& pool) {
+    auto sentinel = std::make_shared<int>(0);
+    pool.enqueue(Job::create([sentinel]() {}, 1h));
+    return sentinel;
+}
+
+bool waitForShutdownStarted(const std::weak_ptr<int>& sentinel) {
+    const auto start = Clock::now();
+    while (!sentinel.expired() && Clock::now() - start < DEFAULT_TIMEOUT) {
+        std::this_thread::sleep_for(1ms);
+    }
+    return sentinel.expired();
+}
+} // namespace
+
+TEST_F(Test_ThreadPool, shutdown_queuedJobs_drainedBeforeDeadline) {
+    ASSERT_TRUE(occupyAllWorkers());
+    std::atomic_int numExecutedJobs{0};
+    for (int i = 0; i < 5; ++i) {
+        m_pool->post([&numExecutedJobs]() { ++numExecutedJobs; });
+    }
+    const auto sentinel = enqueueShutdownSentinel(*m_pool);
+
+    auto report = std::async(std::launch::async, [this]() { return m_pool->shutdown(10s); });
+    ASSERT_TRUE(waitForShutdownStarted(sentinel));
+    stopCreatedJobs();
+
+    const auto result = report.get();
+    EXPECT_TRUE(result.isDrained);
+    EXPECT_EQ(result.numDrainedJobs, 5 + m_pool->getNumWorkerThreads());
+    EXPECT_EQ(result.numDroppedJobs, 0);
+    EXPECT_EQ(result.numDroppedDelayedJobs, 1);
+    EXPECT_EQ(numExecutedJobs, 5);
+}
+
+TEST_F(Test_ThreadPool, shutdown_deadlineExpired_remainingJobsDropped) {
+    ASSERT_TRUE(occupyAllWorkers());
+    std::atomic_int numExecutedJobs{0};
+    for (int i = 0; i < 3; ++i) {
+        m_pool->post([&numExecutedJobs]() { ++numExecutedJobs; });
+    }
+
+    auto report = std::async(std::launch::async, [this]() { return m_pool->shutdown(20ms); });
+    // jobs being executed at the deadline are waited for
+    EXPECT_EQ(report.wait_for(100ms), std::future_status::timeout);
+    stopCreatedJobs();
+
+    const auto result = report.get();
+    EXPECT_FALSE(result.isDrained);
+    EXPECT_EQ(result.numDroppedJobs, 3);
+    EXPECT_EQ(numExecutedJobs, 0);
+}
+
+TEST_F(Test_ThreadPool, shutdown_whileDraining_continuationsAcceptedOtherJobsRejected) {
+    std::atomic_bool isContinuationExecuted{false};
+    std::atomic_bool isOtherJobExecuted{false};
+    auto             job = std::make_shared<FakeJob>();
+    m_fakeJobs.push(job);
+    m_pool->post([this, job, &isContinuationExecuted]() {
+        job->execute();
+        m_pool->post([&isContinuationExecuted]() { isContinuationExecuted = true; });
+    });
+    ASSERT_TRUE(job->waitForExecution());
+    const auto sentinel = enqueueShutdownSentinel(*m_pool);
+
+    auto report = std::async(std::launch::async, [this]() { return m_pool->shutdown(10s); });
+    ASSERT_TRUE(waitForShutdownStarted(sentinel));
+    m_pool->post([&isOtherJobExecuted]() { isOtherJobExecuted = true; });
+    stopCreatedJobs();
+
+    const auto result = report.get();
+    EXPECT_TRUE(result.isDrained);
+    EXPECT_EQ(result.numRejectedJobs, 1);
+    EXPECT_TRUE(isContinuationExecuted);
+    EXPECT_FALSE(isOtherJobExecuted);
+}
+
+TEST_F(Test_ThreadPool, shutdown_calledTwice_secondReportEmpty) {
+    EXPECT_TRUE(m_pool->shutdown(1s).isDrained);
+    EXPECT_FALSE(m_pool->shutdown(1s).isDrained);
+}
+
 TEST_F(Test_ThreadPool, finishJob_jobExecuting_jobNotExecutedAgain) {
     auto job = std::make_shared<FakeJob>();
     m_pool->enqueue(job);
@@ -226,8 +354,9 @@ TEST_F(Test_ThreadPool, finishRecurringJob_jobExecuting_jobIsExecutedAgain) {
     m_pool->enqueue(job);
     ASSERT_TRUE(job->waitForExecution());
 
-    finishJob(job);
-    EXPECT_TRUE(job->waitForExecution(10ms));
+    // the job is re-executed right away, so its Finished state may not be observable
+    job->finish();
+    EXPECT_TRUE(job->waitForExecutionCount(2));
     EXPECT_EQ(2, job->m_executionCount);
 
     job->cancel();
@@ -242,3 +371,457 @@ TEST_F(Test_ThreadPool, jobThrows_executing_workerNotTerminated) {
     // It should be still possible to get jobs executed on all (initial) workers
     EXPECT_TRUE(occupyAllWorkers());
 }
+
+class Test_ThreadPoolWorkStealing : public Test_ThreadPool {
+protected:
+    void SetUp() override {
+        m_pool = std::make_shared<ThreadPool>(2, SchedulingMode::WORK_STEALING);
+    }
+};
+
+TEST_F(Test_ThreadPoolWorkStealing, getSchedulingMode_returnsWorkStealing) {
+    EXPECT_EQ(SchedulingMode::WORK_STEALING, m_pool->getSchedulingMode());
+    EXPECT_EQ(SchedulingMode::SHARED_QUEUE, ThreadPool().getSchedulingMode());
+}
+
+TEST_F(Test_ThreadPoolWorkStealing, enqueueOccupyingAllWorkers_noActiveWorkers_allJobExecuting) {
+    EXPECT_TRUE(occupyAllWorkers());
+}
+
+TEST_F(Test_ThreadPoolWorkStealing, stopExecutingOneJob_queuedJob_jobExecuted) {
+    ASSERT_TRUE(occupyAllWorkers());
+    ASSERT_FALSE(createAndExecuteJob(10ms));
+
+    ASSERT_TRUE(finishJob(m_fakeJobs.front()));
+    EXPECT_TRUE(m_fakeJobs.back()->waitForExecution());
+}
+
+TEST_F(Test_ThreadPoolWorkStealing, enqueueFromWorker_enqueuingWorkerBusy_jobStolenByIdleWorker) {
+    auto stolenJob = std::make_shared<FakeJob>();
+    m_fakeJobs.push(stolenJob);
+    auto blockingJob = std::make_shared<FakeJob>();
+    m_fakeJobs.push(blockingJob);
+
+    // the job is queued to the local queue of the worker executing the lambda which is then
+    // blocked until the end of the test
+    m_pool->enqueue(Job::create([this, stolenJob, blockingJob]() {
+        m_pool->enqueue(stolenJob);
+        blockingJob->execute();
+    }));
+
+    ASSERT_TRUE(blockingJob->waitForExecution());
+    EXPECT_TRUE(stolenJob->waitForExecution());
+}
+
+TEST_F(Test_ThreadPoolWorkStealing, enqueueDelayedJob_notDue_jobExecutedAfterDelay) {
+    std::atomic_bool isExecuted{false};
+    const auto       start = Clock::now();
+    Timepoint        executionTime;
+    auto             job = Job::create(
+        [&isExecuted, &executionTime]() {
+            executionTime = Clock::now();
+            isExecuted    = true;
+        },
+        50ms);
+
+    m_pool->enqueue(job);
+    EXPECT_TRUE(createAndExecuteJob());
+    EXPECT_FALSE(isExecuted);
+
+    while (!isExecuted) {
+        std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_GE(executionTime - start, 50ms);
+}
+
+TEST_F(Test_ThreadPoolWorkStealing, finishRecurringJob_jobExecuting_jobIsExecutedAgain) {
+    auto job = std::make_shared<FakeRecurringJob>();
+    m_pool->enqueue(job);
+    ASSERT_TRUE(job->waitForExecution());
+
+    // the job is re-executed right away, so its Finished state may not be observable
+    job->finish();
+    EXPECT_TRUE(job->waitForExecutionCount(2));
+    EXPECT_EQ(2, job->m_executionCount);
+
+    job->cancel();
+    job->finish();
+}
+
+TEST_F(Test_ThreadPoolWorkStealing, jobThrows_executing_workerNotTerminated) {
+    ASSERT_TRUE(createAndExecuteJob());
+    m_fakeJobs.front()->throwException();
+
+    EXPECT_TRUE(occupyAllWorkers());
+}
+
+TEST_F(Test_ThreadPoolWorkStealing, destroyThreadPool_oneQueuedJob_cleanlyTerminates) {
+    ASSERT_TRUE(occupyAllWorkers());
+    auto queuedJob = std::make_shared<FakeJob>();
+    m_pool->enqueue(queuedJob);
+    m_fakeJobs.push(queuedJob);
+
+    std::thread poolKiller([this] { m_pool.reset(); });
+    stopCreatedJobs();
+    EXPECT_NO_THROW(poolKiller.join());
+}
+
+TEST_F(Test_ThreadPool, cancel_delayedJobPending_jobNotExecuted) {
+    std::atomic_bool isExecuted{false};
+    auto             job = Job::create([&isExecuted]() { isExecuted = true; }, 20ms);
+    m_pool->enqueue(job);
+
+    EXPECT_TRUE(m_pool->cancel(job));
+    std::this_thread::sleep_for(50ms);
+    EXPECT_FALSE(isExecuted);
+}
+
+TEST_F(Test_ThreadPool, cancel_jobAlreadyExecuted_returnsFalse) {
+    auto job = Job::create([]() {});
+    m_pool->enqueue(job);
+    std::dynamic_pointer_cast<Job>(job)->waitForTermination();
+
+    EXPECT_FALSE(m_pool->cancel(job));
+}
+
+TEST_F(Test_ThreadPool, enqueueDelayedJobs_differentDelays_executedInOrderOfDueTime) {
+    std::mutex       mutex;
+    std::vector<int> executionOrder;
+    auto             record = [&mutex, &executionOrder](int id) {
+        return [&mutex, &executionOrder, id]() {
+            std::lock_guard lock{mutex};
+            executionOrder.push_back(id);
+        };
+    };
+    m_pool->enqueue(Job::create(record(3), 90ms));
+    m_pool->enqueue(Job::create(record(1), 10ms));
+    m_pool->enqueue(Job::create(record(2), 50ms));
+
+    std::this_thread::sleep_for(200ms);
+    std::lock_guard lock{mutex};
+    EXPECT_EQ((std::vector<int>{1, 2, 3}), executionOrder);
+}
+
+TEST_F(Test_ThreadPool, enqueuePeriodicJob_executedAtFixedRate) {
+    std::atomic_int numCalls{0};
+    auto            job   = PeriodicJob::create([&numCalls] { ++numCalls; }, 20ms);
+    const auto      start = Clock::now();
+    m_pool->enqueue(job);
+
+    while (numCalls < 5 && Clock::now() - start < DEFAULT_TIMEOUT) {
+        std::this_thread::sleep_for(1ms);
+    }
+    job->cancel();
+
+    EXPECT_GE(numCalls, 5);
+    EXPECT_GE(Clock::now() - start, 5 * 20ms);
+    EXPECT_GE(job->getJitterStatistics().numExecutions, 5);
+    EXPECT_LE(job->getJitterStatistics().minJitter, job->getJitterStatistics().getMeanJitter());
+}
+
+TEST(Test_ThreadPoolRegistry, getInstance_unconfiguredName_returnsDefaultPool) {
+    EXPECT_EQ(ThreadPool::getInstance(), ThreadPool::getInstance("test_unconfigured"));
+    EXPECT_EQ(ThreadPool::getInstance(), ThreadPool::getInstance(ThreadPool::DEFAULT_POOL));
+}
+
+TEST(Test_ThreadPoolRegistry, getInstance_configuredName_returnsSeparateConfiguredPool) {
+    ThreadPoolConfig config;
+    config.name             = "test_configured";
+    config.numWorkerThreads = 3;
+    config.schedulingMode   = SchedulingMode::WORK_STEALING;
+    ASSERT_TRUE(ThreadPool::configure(config));
+
+    auto pool = ThreadPool::getInstance("test_configured");
+    EXPECT_NE(ThreadPool::getInstance(), pool);
+    EXPECT_EQ(pool, ThreadPool::getInstance("test_configured"));
+    EXPECT_EQ("test_configured", pool->getName());
+    EXPECT_EQ(3, pool->getNumWorkerThreads());
+    EXPECT_EQ(SchedulingMode::WORK_STEALING, pool->getSchedulingMode());
+}
+
+TEST(Test_ThreadPoolRegistry, configure_poolAlreadyCreated_returnsFalse) {
+    ThreadPoolConfig config;
+    config.name = "test_alreadyCreated";
+    ASSERT_TRUE(ThreadPool::configure(config));
+    ThreadPool::getInstance("test_alreadyCreated");
+
+    EXPECT_FALSE(ThreadPool::configure(config));
+}
+
+TEST(Test_ThreadPoolRegistry, configure_nameAlreadyResolvedToDefaultPool_returnsFalse) {
+    auto pool = ThreadPool::getInstance("test_lateConfigured");
+    ASSERT_EQ(ThreadPool::getInstance(), pool);
+
+    ThreadPoolConfig config;
+    config.name = "test_lateConfigured";
+    EXPECT_FALSE(ThreadPool::configure(config));
+    EXPECT_EQ(pool, ThreadPool::getInstance("test_lateConfigured"));
+}
+
+#ifdef __linux__
+TEST(Test_ThreadPoolConfig, ctor_nameAndAffinity_appliedToWorkerThreads) {
+    ThreadPoolConfig config;
+    config.name             = "unittest";
+    config.numWorkerThreads = 1;
+    config.cpuAffinity      = {0};
+    ThreadPool pool(config);
+
+    std::promise<std::pair<std::string, bool>> threadSettings;
+    pool.enqueue(Job::create([&threadSettings]() {
+        std::array<char, 16> name{};
+        pthread_getname_np(pthread_self(), name.data(), name.size());
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        pthread_getaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+        threadSettings.set_value({std::string(name.data()),
+                                  CPU_ISSET(0, &cpuSet) && (CPU_COUNT(&cpuSet) == 1)});
+    }));
+
+    auto future = threadSettings.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(DEFAULT_TIMEOUT));
+    const auto [name, isBoundToCpu0] = future.get();
+    EXPECT_EQ("unittest-0", name);
+    EXPECT_TRUE(isBoundToCpu0);
+}
+#endif
+
+TEST_F(Test_ThreadPool, post_function_isExecuted) {
+    std::promise<void> executed;
+    m_pool->post([&executed]() { executed.set_value(); });
+
+    EXPECT_EQ(std::future_status::ready, executed.get_future().wait_for(DEFAULT_TIMEOUT));
+}
+
+TEST_F(Test_ThreadPoolWorkStealing, post_withDelay_isExecutedAfterDelay) {
+    std::promise<Timepoint> executed;
+    const auto              start = Clock::now();
+    m_pool->post([&executed]() { executed.set_value(Clock::now()); }, 20ms);
+
+    auto future = executed.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(DEFAULT_TIMEOUT));
+    EXPECT_GE(future.get() - start, 20ms);
+}
+
+TEST_F(Test_ThreadPool, enqueueBatch_immediateAndDelayedJobs_allExecuted) {
+    std::atomic_int       numExecuted{0};
+    std::vector<JobPtr_t> jobs;
+    for (int i = 0; i < 10; ++i) {
+        jobs.push_back(Job::create([&numExecuted]() { ++numExecuted; },
+                                   (i % 2 == 0) ? 0ms : std::chrono::milliseconds(i)));
+    }
+    jobs.push_back(nullptr);
+
+    m_pool->enqueueBatch(std::move(jobs));
+    const auto start = Clock::now();
+    while (numExecuted < 10 && Clock::now() - start < DEFAULT_TIMEOUT) {
+        std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_EQ(10, numExecuted);
+}
+
+TEST_F(Test_ThreadPool, enqueueBatch_moreJobsThanWorkers_allWorkersOccupied) {
+    std::vector<JobPtr_t> jobs;
+    for (size_t i = 0; i < m_pool->getNumWorkerThreads() + 1; ++i) {
+        auto job = std::make_shared<FakeJob>();
+        m_fakeJobs.push(job);
+        jobs.push_back(job);
+    }
+
+    m_pool->enqueueBatch(jobs);
+    for (size_t i = 0; i < m_pool->getNumWorkerThreads(); ++i) {
+        EXPECT_TRUE(std::static_pointer_cast<FakeJob>(jobs[i])->waitForExecution());
+    }
+    EXPECT_FALSE(m_fakeJobs.back()->waitForExecution(10ms));
+}
+
+TEST_F(Test_ThreadPoolWorkStealing, enqueueBatch_oneJobPerWorker_allJobsExecutingInParallel) {
+    std::vector<JobPtr_t> jobs;
+    for (size_t i = 0; i < m_pool->getNumWorkerThreads(); ++i) {
+        auto job = std::make_shared<FakeJob>();
+        m_fakeJobs.push(job);
+        jobs.push_back(job);
+    }
+
+    m_pool->enqueueBatch(jobs);
+    for (const auto& job : jobs) {
+        EXPECT_TRUE(std::static_pointer_cast<FakeJob>(job)->waitForExecution());
+    }
+}
+
+TEST_F(Test_ThreadPool, enqueueBatch_emptyBatch_noThrow) {
+    EXPECT_NO_THROW(m_pool->enqueueBatch({}));
+}
+
+TEST_F(Test_ThreadPool, getMetrics_noJobs_emptyMetrics) {
+    const auto metrics = m_pool->getMetrics();
+    EXPECT_EQ(0, metrics.numExecutedJobs);
+    EXPECT_EQ(0, metrics.numFailedJobs);
+    EXPECT_EQ(0, metrics.currentQueueDepth);
+    EXPECT_EQ(0, metrics.schedulingLatency.count);
+    ASSERT_EQ(m_pool->getNumWorkerThreads(), metrics.workers.size());
+    for (const auto& worker : metrics.workers) {
+        EXPECT_EQ(0, worker.numExecutedJobs);
+        EXPECT_EQ(0.0, worker.utilization);
+    }
+}
+
+TEST_F(Test_ThreadPool, getMetrics_jobsExecuted_latencyAndExecutionTimeRecorded) {
+    constexpr uint64_t NUM_JOBS = 10;
+    for (uint64_t i = 0; i < NUM_JOBS; ++i) {
+        m_pool->post([]() { std::this_thread::sleep_for(1ms); }, (i % 2 == 0) ? 0ms : 2ms);
+    }
+
+    const auto metrics = waitForExecutedJobs(NUM_JOBS);
+    EXPECT_EQ(NUM_JOBS, metrics.numExecutedJobs);
+    EXPECT_EQ(NUM_JOBS, metrics.schedulingLatency.count);
+    EXPECT_EQ(NUM_JOBS, metrics.executionTime.count);
+    EXPECT_GE(metrics.executionTime.min, std::chrono::nanoseconds(1ms).count());
+    EXPECT_EQ(0, metrics.numFailedJobs);
+
+    uint64_t                 numExecutedByWorkers = 0;
+    std::chrono::nanoseconds busyTime{0};
+    for (const auto& worker : metrics.workers) {
+        numExecutedByWorkers += worker.numExecutedJobs;
+        busyTime += worker.busyTime;
+        EXPECT_GE(worker.utilization, 0.0);
+        EXPECT_LE(worker.utilization, 1.0);
+    }
+    EXPECT_EQ(NUM_JOBS, numExecutedByWorkers);
+    EXPECT_GE(busyTime, NUM_JOBS * 1ms);
+}
+
+TEST_F(Test_ThreadPool, getMetrics_jobThrows_countedAsFailed) {
+    m_pool->post([]() { throw std::runtime_error("failure"); });
+    m_pool->post([]() {});
+
+    const auto metrics = waitForExecutedJobs(2);
+    EXPECT_EQ(2, metrics.numExecutedJobs);
+    EXPECT_EQ(1, metrics.numFailedJobs);
+}
+
+TEST_F(Test_ThreadPool, getMetrics_allWorkersOccupied_queuedJobsCounted) {
+    ASSERT_TRUE(occupyAllWorkers());
+    auto queuedJob = std::make_shared<FakeJob>();
+    m_fakeJobs.push(queuedJob);
+    m_pool->enqueue(queuedJob);
+
+    const auto metrics = m_pool->getMetrics();
+    EXPECT_EQ(1, metrics.currentQueueDepth);
+    EXPECT_GE(metrics.peakQueueDepth, 1);
+    EXPECT_GE(metrics.queueDepth.count, m_pool->getNumWorkerThreads() + 1);
+}
+
+TEST_F(Test_ThreadPool, resetMetrics_afterExecution_metricsCleared) {
+    m_pool->post([]() { throw std::runtime_error("failure"); });
+    ASSERT_EQ(1, waitForExecutedJobs(1).numExecutedJobs);
+
+    m_pool->resetMetrics();
+    const auto metrics = m_pool->getMetrics();
+    EXPECT_EQ(0, metrics.numExecutedJobs);
+    EXPECT_EQ(0, metrics.numFailedJobs);
+    EXPECT_EQ(0, metrics.peakQueueDepth);
+    EXPECT_EQ(0, metrics.workers.front().numExecutedJobs);
+}
+
+TEST_F(Test_ThreadPoolWorkStealing, getMetrics_jobsExecuted_countedPerWorker) {
+    constexpr uint64_t NUM_JOBS = 10;
+    for (uint64_t i = 0; i < NUM_JOBS; ++i) {
+        m_pool->post([]() {});
+    }
+    m_pool->post([]() { throw std::runtime_error("failure"); });
+
+    const auto metrics = waitForExecutedJobs(NUM_JOBS + 1);
+    EXPECT_EQ(NUM_JOBS + 1, metrics.numExecutedJobs);
+    EXPECT_EQ(1, metrics.numFailedJobs);
+    EXPECT_EQ(NUM_JOBS + 1,
+              metrics.workers[0].numExecutedJobs + metrics.workers[1].numExecutedJobs);
+}
+
+TEST_F(Test_ThreadPoolWorkStealing, getMetrics_allWorkersOccupied_queuedJobsCounted) {
+    ASSERT_TRUE(occupyAllWorkers());
+    auto queuedJob = std::make_shared<FakeJob>();
+    m_fakeJobs.push(queuedJob);
+    m_pool->enqueue(queuedJob);
+
+    EXPECT_EQ(1, m_pool->getMetrics().currentQueueDepth);
+}
+
+namespace {
+ThreadPoolConfig singleWorkerConfig(SchedulingMode            schedulingMode,
+                                    std::chrono::milliseconds starvationLimit) {
+    ThreadPoolConfig config;
+    config.numWorkerThreads = 1;
+    config.schedulingMode   = schedulingMode;
+    config.starvationLimit  = starvationLimit;
+    return config;
+}
+
+// posts one job per class in the order LOW, NORMAL, HIGH while the only worker is occupied
+std::vector<JobPriority> executeOneJobPerPriority(ThreadPool& pool) {
+    auto blockingJob = std::make_shared<FakeJob>();
+    pool.enqueue(blockingJob);
+    EXPECT_TRUE(blockingJob->waitForExecution());
+
+    std::mutex               mutex;
+    std::vector<JobPriority> executionOrder;
+    std::promise<void>       allExecuted;
+    for (const auto priority : {JobPriority::LOW, JobPriority::NORMAL, JobPriority::HIGH}) {
+        pool.post(
+            [&, priority]() {
+                std::lock_guard lock(mutex);
+                executionOrder.push_back(priority);
+                if (executionOrder.size() == 3) {
+                    allExecuted.set_value();
+                }
+            },
+            0ms, priority);
+    }
+    blockingJob->finish();
+    EXPECT_EQ(std::future_status::ready, allExecuted.get_future().wait_for(DEFAULT_TIMEOUT));
+    std::lock_guard lock(mutex);
+    return executionOrder;
+}
+} // namespace
+
+TEST(Test_ThreadPoolPriority, post_jobsOfAllClassesQueued_executedInOrderOfPriority) {
+    ThreadPool pool(singleWorkerConfig(SchedulingMode::SHARED_QUEUE, 0ms));
+
+    EXPECT_EQ((std::vector<JobPriority>{JobPriority::HIGH, JobPriority::NORMAL, JobPriority::LOW}),
+              executeOneJobPerPriority(pool));
+    // the job occupying the worker is of the NORMAL class as well
+    const auto metrics = pool.getMetrics();
+    EXPECT_EQ(1, metrics.schedulingLatencyByPriority[0].count);
+    EXPECT_EQ(2, metrics.schedulingLatencyByPriority[1].count);
+    EXPECT_EQ(1, metrics.schedulingLatencyByPriority[2].count);
+    EXPECT_LE(metrics.schedulingLatencyByPriority[0].max,
+              metrics.schedulingLatencyByPriority[2].max);
+}
+
+TEST(Test_ThreadPoolPriority, post_workStealing_executedInOrderOfPriority) {
+    ThreadPool pool(singleWorkerConfig(SchedulingMode::WORK_STEALING, 0ms));
+
+    EXPECT_EQ((std::vector<JobPriority>{JobPriority::HIGH, JobPriority::NORMAL, JobPriority::LOW}),
+              executeOneJobPerPriority(pool));
+}
+
+TEST(Test_ThreadPoolPriority, post_lowPriorityJobWaitingBeyondStarvationLimit_executedFirst) {
+    ThreadPool pool(singleWorkerConfig(SchedulingMode::SHARED_QUEUE, 10ms));
+    auto       blockingJob = std::make_shared<FakeJob>();
+    pool.enqueue(blockingJob);
+    ASSERT_TRUE(blockingJob->waitForExecution());
+
+    std::vector<JobPriority> executionOrder;
+    std::promise<void>       allExecuted;
+    pool.post([&]() { executionOrder.push_back(JobPriority::LOW); }, 0ms, JobPriority::LOW);
+    std::this_thread::sleep_for(20ms);
+    pool.post(
+        [&]() {
+            executionOrder.push_back(JobPriority::HIGH);
+            allExecuted.set_value();
+        },
+        0ms, JobPriority::HIGH);
+    blockingJob->finish();
+
+    ASSERT_EQ(std::future_status::ready, allExecuted.get_future().wait_for(DEFAULT_TIMEOUT));
+    EXPECT_EQ((std::vector<JobPriority>{JobPriority::LOW, JobPriority::HIGH}), executionOrder);
+}
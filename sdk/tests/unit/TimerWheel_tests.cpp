@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/TimerWheel.h"
+
+#include <gtest/gtest.h>
+
+using namespace velocitas;
+using namespace std::chrono_literals;
+
+namespace {
+JobPtr_t createJob() {
+    return Job::create([] {});
+}
+} // namespace
+
+class Test_TimerWheel : public ::testing::Test {
+protected:
+    std::vector<JobPtr_t> advanceTo(std::chrono::milliseconds sinceStart) {
+        std::vector<JobPtr_t> dueJobs;
+        m_wheel.advance(m_start + sinceStart, dueJobs);
+        return dueJobs;
+    }
+
+    Timepoint  m_start{Clock::now()};
+    TimerWheel m_wheel{1ms, m_start};
+};
+
+TEST_F(Test_TimerWheel, ctor_emptyWheel_noNextExpiry) {
+    EXPECT_TRUE(m_wheel.empty());
+    EXPECT_FALSE(m_wheel.getNextExpiry().has_value());
+}
+
+TEST_F(Test_TimerWheel, advance_beforeDue_jobNotReturned) {
+    m_wheel.arm(createJob(), m_start + 10ms);
+
+    EXPECT_TRUE(advanceTo(9ms).empty());
+    EXPECT_EQ(1, m_wheel.size());
+}
+
+TEST_F(Test_TimerWheel, advance_jobDue_jobReturnedAndRemoved) {
+    auto job = createJob();
+    m_wheel.arm(job, m_start + 10ms);
+
+    auto dueJobs = advanceTo(10ms);
+    ASSERT_EQ(1, dueJobs.size());
+    EXPECT_EQ(job, dueJobs.front());
+    EXPECT_TRUE(m_wheel.empty());
+}
+
+TEST_F(Test_TimerWheel, arm_timepointInThePast_dueWithNextTick) {
+    auto job = createJob();
+    advanceTo(5ms);
+    m_wheel.arm(job, m_start + 1ms);
+
+    auto dueJobs = advanceTo(6ms);
+    ASSERT_EQ(1, dueJobs.size());
+    EXPECT_EQ(job, dueJobs.front());
+}
+
+TEST_F(Test_TimerWheel, advance_jobsOnDifferentLevels_returnedOrderedByDueTime) {
+    auto jobLevel2 = createJob();
+    auto jobLevel1 = createJob();
+    auto jobLevel0 = createJob();
+    m_wheel.arm(jobLevel2, m_start + 5000ms);
+    m_wheel.arm(jobLevel1, m_start + 100ms);
+    m_wheel.arm(jobLevel0, m_start + 30ms);
+
+    auto dueJobs = advanceTo(10s);
+    ASSERT_EQ(3, dueJobs.size());
+    EXPECT_EQ(jobLevel0, dueJobs[0]);
+    EXPECT_EQ(jobLevel1, dueJobs[1]);
+    EXPECT_EQ(jobLevel2, dueJobs[2]);
+}
+
+TEST_F(Test_TimerWheel, advance_stepwiseOverCascades_jobReturnedExactlyWhenDue) {
+    auto job = createJob();
+    m_wheel.arm(job, m_start + 4200ms);
+
+    for (auto ms = 1ms; ms < 4200ms; ms += 1ms) {
+        ASSERT_TRUE(advanceTo(ms).empty()) << "at " << ms.count() << "ms";
+    }
+    EXPECT_EQ(1, advanceTo(4200ms).size());
+}
+
+TEST_F(Test_TimerWheel, advance_beyondWheelRange_jobReturnedWhenDue) {
+    const auto wheelRange = std::chrono::milliseconds(int64_t{1} << 24);
+    auto       job        = createJob();
+    m_wheel.arm(job, m_start + 2 * wheelRange);
+
+    EXPECT_TRUE(advanceTo(wheelRange).empty());
+    EXPECT_TRUE(advanceTo(2 * wheelRange - 1ms).empty());
+    EXPECT_EQ(1, advanceTo(2 * wheelRange).size());
+}
+
+TEST_F(Test_TimerWheel, getNextExpiry_jobArmed_notLaterThanDueTime) {
+    m_wheel.arm(createJob(), m_start + 10ms);
+    ASSERT_TRUE(m_wheel.getNextExpiry().has_value());
+    EXPECT_EQ(m_start + 10ms, *m_wheel.getNextExpiry());
+
+    m_wheel.arm(createJob(), m_start + 3ms);
+    EXPECT_EQ(m_start + 3ms, *m_wheel.getNextExpiry());
+}
+
+TEST_F(Test_TimerWheel, getNextExpiry_jobOnHigherLevel_expiresAtCascade) {
+    m_wheel.arm(createJob(), m_start + 200ms);
+    ASSERT_TRUE(m_wheel.getNextExpiry().has_value());
+    EXPECT_EQ(m_start + 192ms, *m_wheel.getNextExpiry());
+
+    advanceTo(192ms);
+    EXPECT_EQ(m_start + 200ms, *m_wheel.getNextExpiry());
+}
+
+TEST_F(Test_TimerWheel, cancel_armedJob_removedAndNotReturned) {
+    auto job   = createJob();
+    auto other = createJob();
+    m_wheel.arm(job, m_start + 10ms);
+    m_wheel.arm(other, m_start + 10ms);
+
+    EXPECT_TRUE(m_wheel.cancel(job.get()));
+    EXPECT_EQ(1, m_wheel.size());
+
+    auto dueJobs = advanceTo(20ms);
+    ASSERT_EQ(1, dueJobs.size());
+    EXPECT_EQ(other, dueJobs.front());
+}
+
+TEST_F(Test_TimerWheel, cancel_unknownJob_returnsFalse) {
+    auto job = createJob();
+    EXPECT_FALSE(m_wheel.cancel(job.get()));
+}
+
+TEST_F(Test_TimerWheel, cancel_afterCascade_removed) {
+    auto job = createJob();
+    m_wheel.arm(job, m_start + 200ms);
+    advanceTo(195ms);
+
+    EXPECT_TRUE(m_wheel.cancel(job.get()));
+    EXPECT_TRUE(m_wheel.empty());
+    EXPECT_FALSE(m_wheel.getNextExpiry().has_value());
+}
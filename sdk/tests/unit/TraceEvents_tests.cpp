@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/TraceEvents.h"
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace velocitas;
+
+TEST(Test_TraceRecorder, record_notStarted_eventDiscarded) {
+    TraceRecorder recorder(4);
+    recorder.record({"test", "event", 0, 1, 1});
+
+    EXPECT_TRUE(recorder.drain().empty());
+}
+
+TEST(Test_TraceRecorder, record_bufferFull_eventsDroppedAndCounted) {
+    TraceRecorder recorder(2);
+    recorder.start();
+    for (int i = 0; i < 5; ++i) {
+        recorder.record({"test", "event", i, 1, 1});
+    }
+
+    const auto events = recorder.drain();
+    ASSERT_EQ(2, events.size());
+    EXPECT_EQ(0, events[0].startNs);
+    EXPECT_EQ(1, events[1].startNs);
+    EXPECT_EQ(3, recorder.getNumDroppedEvents());
+}
+
+TEST(Test_TraceRecorder, writeChromeJson_someEvents_validTraceEventJson) {
+    TraceRecorder recorder(8);
+    recorder.start();
+    const auto threadId = TraceRecorder::getCurrentThreadId();
+    recorder.record({"vdb", "onUpdate", 2000, 1500, threadId});
+    recorder.record({"app", "callback \"quoted\"", 4000, 500, threadId});
+
+    std::stringstream stream;
+    recorder.writeChromeJson(stream);
+
+    const auto trace  = nlohmann::json::parse(stream.str());
+    const auto events = trace.at("traceEvents");
+    ASSERT_GE(events.size(), 2);
+    EXPECT_EQ("X", events[0].at("ph"));
+    EXPECT_EQ("vdb", events[0].at("cat"));
+    EXPECT_EQ("onUpdate", events[0].at("name"));
+    EXPECT_DOUBLE_EQ(2.0, events[0].at("ts").get<double>());
+    EXPECT_DOUBLE_EQ(1.5, events[0].at("dur").get<double>());
+    EXPECT_EQ(threadId, events[0].at("tid").get<uint32_t>());
+    EXPECT_EQ("callback \"quoted\"", events[1].at("name"));
+    // the metadata event naming the thread
+    const auto isThreadName = [](const auto& event) { return event.at("ph") == "M"; };
+    EXPECT_NE(std::find_if(events.begin(), events.end(), isThreadName), events.end());
+    EXPECT_TRUE(recorder.drain().empty());
+}
+
+TEST(Test_TraceRecorder, getCurrentThreadId_differentThreads_differentIds) {
+    const auto mainThreadId  = TraceRecorder::getCurrentThreadId();
+    uint32_t   otherThreadId = 0;
+    std::thread([&otherThreadId]() { otherThreadId = TraceRecorder::getCurrentThreadId(); })
+        .join();
+
+    EXPECT_EQ(mainThreadId, TraceRecorder::getCurrentThreadId());
+    EXPECT_NE(mainThreadId, otherThreadId);
+}
+
+TEST(Test_ScopedTraceSpan, destruction_recording_spanRecorded) {
+    auto& recorder = TraceRecorder::getInstance();
+    static_cast<void>(recorder.drain());
+    recorder.start();
+    {
+        const ScopedTraceSpan span("test", "Test_ScopedTraceSpan");
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    recorder.stop();
+
+    const auto events = recorder.drain();
+    const auto span   = std::find_if(events.begin(), events.end(), [](const auto& event) {
+        return std::string{event.name} == "Test_ScopedTraceSpan";
+    });
+    ASSERT_NE(span, events.end());
+    EXPECT_STREQ("test", span->category);
+    EXPECT_GE(span->durationNs, 1000000);
+    EXPECT_EQ(TraceRecorder::getCurrentThreadId(), span->threadId);
+}
+
+TEST(Test_ScopedTraceSpan, destruction_notRecording_nothingRecorded) {
+    auto& recorder = TraceRecorder::getInstance();
+    recorder.stop();
+    static_cast<void>(recorder.drain());
+    { const ScopedTraceSpan span("test", "Test_ScopedTraceSpan"); }
+
+    EXPECT_TRUE(recorder.drain().empty());
+}
@@ -80,6 +80,15 @@ TEST(StringUtils, join_vectorWithMultipleElements_elementsJoinedWithSeparator) {
     EXPECT_EQ(result, "foo,bar,baz");
 }
 
+TEST(StringUtils, split_emptyString_emptyVector) {
+    EXPECT_TRUE(StringUtils::split("", ',').empty());
+}
+
+TEST(StringUtils, split_stringWithSeparators_trimmedNonEmptyParts) {
+    auto result = StringUtils::split(" foo, bar ,,baz,", ',');
+    EXPECT_EQ(result, (std::vector<std::string>{"foo", "bar", "baz"}));
+}
+
 TEST(SimpleUrlParse, emptyString) {
     SimpleUrlParse cut("");
     EXPECT_EQ("", cut.getScheme());
@@ -125,4 +134,21 @@ TEST(SimpleUrlParse, ctor_unix_domain_socket) {
     SimpleUrlParse cut("unix:///some/path/to/socket");
     EXPECT_EQ("unix", cut.getScheme());
     EXPECT_EQ("unix:///some/path/to/socket", cut.getNetLocation());
+    EXPECT_TRUE(cut.isUnixDomainSocket());
+}
+TEST(SimpleUrlParse, ctor_unix_domain_socket_withoutSlashes) {
+    SimpleUrlParse cut("unix:/some/path/to/socket");
+    EXPECT_EQ("unix", cut.getScheme());
+    EXPECT_EQ("unix:/some/path/to/socket", cut.getNetLocation());
+    EXPECT_TRUE(cut.isUnixDomainSocket());
+}
+TEST(SimpleUrlParse, ctor_abstract_unix_domain_socket) {
+    SimpleUrlParse cut("unix-abstract:databroker");
+    EXPECT_EQ("unix-abstract", cut.getScheme());
+    EXPECT_EQ("unix-abstract:databroker", cut.getNetLocation());
+    EXPECT_TRUE(cut.isUnixDomainSocket());
+}
+TEST(SimpleUrlParse, isUnixDomainSocket_tcpAddress_false) {
+    EXPECT_FALSE(SimpleUrlParse("localhost:55555").isUnixDomainSocket());
+    EXPECT_FALSE(SimpleUrlParse("http://unix:42").isUnixDomainSocket());
 }
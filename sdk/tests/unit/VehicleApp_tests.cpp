@@ -0,0 +1,230 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/VehicleApp.h"
+
+#include "sdk/DataPoint.h"
+#include "sdk/EventLoop.h"
+#include "sdk/Executor.h"
+
+#include "MockIPubSubClient.h"
+#include "VehicleDataBrokerClientMock.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <thread>
+
+using namespace velocitas;
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::InSequence;
+using ::testing::Invoke;
+using ::testing::Return;
+
+namespace {
+
+class StartupApp : public VehicleApp {
+public:
+    StartupApp(std::shared_ptr<IVehicleDataBrokerClient> vdbClient,
+               std::shared_ptr<IPubSubClient>            pubSubClient)
+        : VehicleApp(std::move(vdbClient), std::move(pubSubClient)) {
+        declareSignals({m_speed});
+    }
+
+    void onStart() override { m_isStarted = true; }
+
+    using VehicleApp::post;
+
+    std::atomic_bool m_isStarted{false};
+
+private:
+    DataPointFloat m_speed{"Vehicle.Speed", nullptr};
+};
+
+class EventLoopApp : public VehicleApp {
+public:
+    EventLoopApp(std::shared_ptr<IVehicleDataBrokerClient> vdbClient,
+                 std::shared_ptr<IPubSubClient>            pubSubClient)
+        : VehicleApp(std::move(vdbClient), std::move(pubSubClient)) {
+        setExecutionMode(AppExecutionMode::EVENT_LOOP);
+    }
+
+    void onStart() override {
+        m_startThread = std::this_thread::get_id();
+        post([this]() {
+            m_postedThread = std::this_thread::get_id();
+            post([this]() { stop(); }, std::chrono::milliseconds(5));
+        });
+    }
+
+    std::thread::id m_startThread;
+    std::thread::id m_postedThread;
+};
+
+} // namespace
+
+class Test_VehicleApp : public ::testing::Test {
+protected:
+    std::thread start() {
+        std::thread runner([this]() { m_app.run(); });
+        while (!m_app.m_isStarted) {
+            std::this_thread::yield();
+        }
+        return runner;
+    }
+
+    void runUntilStarted() {
+        auto runner = start();
+        m_app.stop();
+        runner.join();
+    }
+
+    std::shared_ptr<VehicleDataBrokerClientMock> m_vdbClient{
+        std::make_shared<VehicleDataBrokerClientMock>()};
+    std::shared_ptr<MockIPubSubClient> m_pubSubClient{std::make_shared<MockIPubSubClient>()};
+    AsyncResultPtr_t<Status>           m_prepared{std::make_shared<AsyncResult<Status>>()};
+    StartupApp                         m_app{m_vdbClient, m_pubSubClient};
+};
+
+TEST_F(Test_VehicleApp, run_declaredSignals_preparedWhileConnectingPubSub) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(*m_vdbClient, prepare(ElementsAre("Vehicle.Speed"), _))
+            .WillOnce(Return(m_prepared));
+        // the databroker client gets ready while the pub/sub client is still connecting
+        EXPECT_CALL(*m_pubSubClient, connect()).WillOnce(Invoke([this]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            m_prepared->insertResult(Status());
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }));
+    }
+    EXPECT_CALL(*m_pubSubClient, disconnect());
+
+    runUntilStarted();
+
+    const auto metrics = m_app.getStartupMetrics();
+    EXPECT_GE(metrics.pubSubConnect, std::chrono::milliseconds(20));
+    EXPECT_GE(metrics.vdbPrepare, std::chrono::milliseconds(10));
+    EXPECT_LT(metrics.vdbPrepare, metrics.pubSubConnect);
+    EXPECT_GE(metrics.total, metrics.pubSubConnect + metrics.onStart);
+}
+
+TEST_F(Test_VehicleApp, run_prepareFails_appStartedAnyway) {
+    EXPECT_CALL(*m_vdbClient, prepare(_, _)).WillOnce(Return(m_prepared));
+    EXPECT_CALL(*m_pubSubClient, connect()).WillOnce(Invoke([this]() {
+        m_prepared->insertError(Status("Databroker not connected"));
+    }));
+    EXPECT_CALL(*m_pubSubClient, disconnect());
+
+    runUntilStarted();
+
+    EXPECT_TRUE(m_app.m_isStarted);
+}
+
+TEST_F(Test_VehicleApp, stop_pendingRequests_cancelledAndReported) {
+    EXPECT_CALL(*m_vdbClient, prepare(_, _)).WillOnce(Return(m_prepared));
+    EXPECT_CALL(*m_pubSubClient, connect()).WillOnce(Invoke([this]() {
+        m_prepared->insertResult(Status());
+    }));
+    EXPECT_CALL(*m_pubSubClient, disconnect());
+    EXPECT_CALL(*m_vdbClient, cancelPendingRequests()).WillOnce(Return(2));
+
+    auto       runner = start();
+    const auto report = m_app.stop(std::chrono::seconds(5));
+    runner.join();
+
+    EXPECT_EQ(report.numCancelledRequests, 2);
+    EXPECT_EQ(report.numDroppedPublishes, 0);
+    EXPECT_TRUE(report.isDrained);
+    EXPECT_LT(report.duration, std::chrono::seconds(5));
+}
+
+TEST_F(Test_VehicleApp, stop_jobPublishingWhileDraining_publishedBeforeDisconnect) {
+    EXPECT_CALL(*m_vdbClient, prepare(_, _)).WillOnce(Return(m_prepared));
+    EXPECT_CALL(*m_pubSubClient, connect()).WillOnce(Invoke([this]() {
+        m_prepared->insertResult(Status());
+    }));
+    {
+        InSequence sequence;
+        EXPECT_CALL(*m_pubSubClient, publishOnTopic("result", "done", _))
+            .WillOnce(Return(PublishStatus::Success));
+        EXPECT_CALL(*m_pubSubClient, disconnect());
+    }
+
+    auto               runner = start();
+    std::promise<void> jobStarted;
+    m_app.post([this, &jobStarted]() {
+        jobStarted.set_value();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        m_pubSubClient->publishOnTopic("result", "done", 100);
+    });
+    jobStarted.get_future().wait();
+    const auto report = m_app.stop(std::chrono::seconds(5));
+    runner.join();
+
+    EXPECT_TRUE(report.isDrained);
+    EXPECT_EQ(report.numDroppedPublishes, 0);
+}
+
+TEST(Test_VehicleAppEventLoop, run_eventLoopMode_onStartAndPostedFunctionsOnRunThread) {
+    auto vdbClient    = std::make_shared<VehicleDataBrokerClientMock>();
+    auto pubSubClient = std::make_shared<MockIPubSubClient>();
+    EXPECT_CALL(*vdbClient, prepare(_, _))
+        .WillOnce(Return(std::make_shared<AsyncResult<Status>>()));
+    EXPECT_CALL(*pubSubClient, connect());
+    EXPECT_CALL(*pubSubClient, disconnect());
+    EventLoopApp app{vdbClient, pubSubClient};
+    ASSERT_EQ(AppExecutionMode::EVENT_LOOP, app.getExecutionMode());
+    EXPECT_EQ(CallbackExecution::EVENT_LOOP, vdbClient->getCallbackExecutor()->getExecution());
+    EXPECT_EQ(app.getEventLoop(), pubSubClient->getCallbackExecutor()->getEventLoop());
+
+    std::thread::id runThread;
+    std::thread     runner([&]() {
+        runThread = std::this_thread::get_id();
+        app.run();
+    });
+    runner.join();
+
+    EXPECT_EQ(runThread, app.m_startThread);
+    EXPECT_EQ(runThread, app.m_postedThread);
+    EXPECT_TRUE(app.getEventLoop()->isStopped());
+}
+
+TEST(Test_VehicleAppExecutor, setExecutor_customExecutor_appliedToClientsAndPostedFunctions) {
+    auto vdbClient    = std::make_shared<VehicleDataBrokerClientMock>();
+    auto pubSubClient = std::make_shared<MockIPubSubClient>();
+    auto eventLoop    = EventLoop::create();
+    auto executor     = IExecutor::createEventLoop(eventLoop);
+    StartupApp app{vdbClient, pubSubClient};
+
+    app.setExecutor(executor);
+    EXPECT_EQ(executor, app.getExecutor());
+    EXPECT_EQ(executor, vdbClient->getExecutor());
+    EXPECT_EQ(executor, pubSubClient->getExecutor());
+    EXPECT_EQ(executor, vdbClient->getCallbackExecutor()->getExecutor());
+    EXPECT_EQ(executor, pubSubClient->getCallbackExecutor()->getExecutor());
+
+    bool isExecuted{false};
+    app.post([&isExecuted]() { isExecuted = true; });
+    EXPECT_EQ(1, eventLoop->poll());
+    EXPECT_TRUE(isExecuted);
+
+    app.setExecutor(nullptr);
+    EXPECT_EQ(nullptr, vdbClient->getExecutor());
+    EXPECT_EQ(nullptr, pubSubClient->getCallbackExecutor());
+}
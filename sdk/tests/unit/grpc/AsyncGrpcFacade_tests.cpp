@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/grpc/AsyncGrpcFacade.h"
+#include "sdk/grpc/GrpcCall.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+using namespace velocitas;
+
+namespace {
+
+class TestFacade : public AsyncGrpcFacade {
+public:
+    using AsyncGrpcFacade::applyDeadline;
+};
+
+std::chrono::milliseconds getRemainingTime(const GrpcCall& call) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(call.m_context.deadline() -
+                                                                 std::chrono::system_clock::now());
+}
+
+} // namespace
+
+TEST(Test_AsyncGrpcFacade, applyDeadline_noCallTimeout_defaultTimeoutApplied) {
+    TestFacade facade;
+    facade.setCallTimeout(std::chrono::seconds{5});
+    GrpcCall call;
+
+    facade.applyDeadline(call, {});
+
+    EXPECT_GT(getRemainingTime(call), std::chrono::seconds{4});
+    EXPECT_LE(getRemainingTime(call), std::chrono::seconds{5});
+}
+
+TEST(Test_AsyncGrpcFacade, applyDeadline_callTimeout_overridesDefault) {
+    TestFacade facade;
+    facade.setCallTimeout(std::chrono::seconds{5});
+    GrpcCall call;
+
+    facade.applyDeadline(call, std::chrono::seconds{60});
+
+    EXPECT_GT(getRemainingTime(call), std::chrono::seconds{59});
+}
+
+TEST(Test_AsyncGrpcFacade, applyDeadline_zeroTimeout_noDeadline) {
+    TestFacade facade;
+    facade.setCallTimeout(std::chrono::milliseconds{0});
+    GrpcCall call;
+
+    facade.applyDeadline(call, {});
+
+    EXPECT_GT(getRemainingTime(call), std::chrono::hours{24 * 365});
+}
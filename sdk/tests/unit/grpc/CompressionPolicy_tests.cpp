@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#include "sdk/grpc/CompressionPolicy.h"
+
+#include "kuksa/val/v2/val.pb.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <random>
+#include <string>
+
+using namespace velocitas;
+
+namespace {
+
+const std::string RPC_TYPE = "kuksa.val.v2.GetValuesRequest"; // NOLINT(runtime/string)
+
+CompressionPolicyConfig createConfig() {
+    CompressionPolicyConfig config;
+    config.m_minMessageSize = 256;
+    config.m_sampleInterval = 4;
+    return config;
+}
+
+kuksa::val::v2::GetValuesRequest createRequest(size_t numSignals, bool isCompressible) {
+    // random ASCII characters, so paths stay valid UTF-8
+    std::minstd_rand                   generator{42};
+    std::uniform_int_distribution<int> distribution(1, 127);
+
+    kuksa::val::v2::GetValuesRequest request;
+    for (size_t i = 0; i < numSignals; ++i) {
+        std::string path = "Vehicle.Body.Lights.Beam.Low.IsOn";
+        if (!isCompressible) {
+            for (auto& character : path) {
+                character = static_cast<char>(distribution(generator));
+            }
+        }
+        request.add_signal_ids()->set_path(path);
+    }
+    return request;
+}
+
+} // namespace
+
+TEST(Test_CompressionPolicy, shallCompress_defaultConfig_nothingCompressed) {
+    CompressionPolicy policy(CompressionPolicyConfig{});
+
+    EXPECT_FALSE(policy.isEnabled());
+    EXPECT_FALSE(policy.shallCompress(createRequest(100, true)));
+    EXPECT_EQ(0, policy.getStats(RPC_TYPE).m_numUncompressed);
+}
+
+TEST(Test_CompressionPolicy, shallCompress_smallRequest_notCompressedNorSampled) {
+    CompressionPolicy policy(createConfig());
+
+    EXPECT_FALSE(policy.shallCompress(createRequest(1, true)));
+
+    const auto stats = policy.getStats(RPC_TYPE);
+    EXPECT_EQ(0, stats.m_numCompressed);
+    EXPECT_EQ(1, stats.m_numUncompressed);
+    EXPECT_EQ(0, stats.m_numSampled);
+}
+
+TEST(Test_CompressionPolicy, shallCompress_largeCompressibleRequests_compressedEveryNthSampled) {
+    CompressionPolicy policy(createConfig());
+    const auto        request = createRequest(100, true);
+
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_TRUE(policy.shallCompress(request));
+    }
+
+    const auto stats = policy.getStats(RPC_TYPE);
+    EXPECT_EQ(5, stats.m_numCompressed);
+    EXPECT_EQ(0, stats.m_numUncompressed);
+    EXPECT_EQ(2, stats.m_numSampled);
+    EXPECT_EQ(2 * request.ByteSizeLong(), stats.m_sampledBytes);
+    EXPECT_LT(stats.getRatio(), 0.2);
+}
+
+TEST(Test_CompressionPolicy, shallCompress_largeIncompressibleRequests_sentUncompressed) {
+    CompressionPolicy policy(createConfig());
+
+    EXPECT_FALSE(policy.shallCompress(createRequest(100, false)));
+    // a compressible request of the same type is not sampled before the next interval
+    EXPECT_FALSE(policy.shallCompress(createRequest(100, true)));
+
+    const auto stats = policy.getStats(RPC_TYPE);
+    EXPECT_EQ(2, stats.m_numUncompressed);
+    EXPECT_EQ(1, stats.m_numSampled);
+    EXPECT_GT(stats.getRatio(), createConfig().m_maxRatio);
+}
+
+TEST(Test_CompressionPolicy, fromEnvironment_validAndInvalidValues_parsedOrDefault) {
+    ::setenv("SDV_GRPC_COMPRESSION_MIN_SIZE", "1024", /*overwrite=*/1);
+    ::setenv("SDV_GRPC_COMPRESSION_ALGORITHM", "deflate", /*overwrite=*/1);
+    auto config = CompressionPolicyConfig::fromEnvironment();
+    EXPECT_EQ(1024, config.m_minMessageSize);
+    EXPECT_EQ(GRPC_COMPRESS_DEFLATE, config.m_algorithm);
+
+    ::setenv("SDV_GRPC_COMPRESSION_ALGORITHM", "brotli", /*overwrite=*/1);
+    config = CompressionPolicyConfig::fromEnvironment();
+    EXPECT_EQ(GRPC_COMPRESS_GZIP, config.m_algorithm);
+
+    ::unsetenv("SDV_GRPC_COMPRESSION_MIN_SIZE");
+    ::unsetenv("SDV_GRPC_COMPRESSION_ALGORITHM");
+    EXPECT_EQ(0, CompressionPolicyConfig::fromEnvironment().m_minMessageSize);
+}
@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/grpc/GrpcCall.h"
+
+#include "kuksa/val/v2/val.pb.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace velocitas;
+
+namespace {
+
+std::string createSerializedResponse(const std::string& value) {
+    kuksa::val::v2::GetValuesResponse response;
+    response.add_data_points()->mutable_value()->mutable_string_array()->add_values(value);
+    return response.SerializeAsString();
+}
+
+} // namespace
+
+TEST(Test_ArenaMessage, get_messageAllocatedOnArena) {
+    ArenaMessage<kuksa::val::v2::GetValuesResponse> message;
+
+    EXPECT_NE(nullptr, message.get().GetArena());
+}
+
+TEST(Test_ArenaMessage, renew_parsedMessage_providesEmptyMessage) {
+    ArenaMessage<kuksa::val::v2::GetValuesResponse> message;
+    ASSERT_TRUE(message.get().ParseFromString(createSerializedResponse("first")));
+    ASSERT_EQ(1, message.get().data_points_size());
+
+    auto& renewed = message.renew();
+
+    EXPECT_EQ(0, renewed.data_points_size());
+    EXPECT_NE(nullptr, renewed.GetArena());
+    ASSERT_TRUE(renewed.ParseFromString(createSerializedResponse("second")));
+    EXPECT_EQ("second", renewed.data_points(0).value().string_array().values(0));
+}
+
+TEST(Test_ArenaMessage, get_movedFromString_keepsValue) {
+    ArenaMessage<kuksa::val::v2::GetValuesResponse> message;
+    const std::string longValue(100, 'x');
+    ASSERT_TRUE(message.get().ParseFromString(createSerializedResponse(longValue)));
+
+    auto* values = message.get().mutable_data_points(0)->mutable_value()->mutable_string_array();
+    auto taken = std::move(*values->mutable_values(0));
+    message.renew();
+
+    EXPECT_EQ(longValue, taken);
+}
+
+TEST(Test_GrpcSingleResponseCall, response_allocatedOnArena) {
+    GrpcSingleResponseCall<kuksa::val::v2::GetValuesRequest, kuksa::val::v2::GetValuesResponse>
+        call;
+
+    EXPECT_NE(nullptr, call.m_response.GetArena());
+    EXPECT_EQ(nullptr, call.m_request.GetArena());
+}
+
+TEST(Test_GrpcSingleResponseCall, recordCompletion_countsCallByRpcTypeAndStatusCode) {
+    const MetricLabels_t labels{{"rpc", "kuksa.val.v2.GetValuesRequest"}, {"code", "NOT_FOUND"}};
+    const auto           getNumCalls = [&labels]() {
+        for (const auto& metric : MetricsRegistry::getInstance().collect()) {
+            if (metric.name == "sdv_grpc_calls_total" && metric.labels == labels) {
+                return metric.value;
+            }
+        }
+        return 0.0;
+    };
+    const auto numCalls = getNumCalls();
+    GrpcSingleResponseCall<kuksa::val::v2::GetValuesRequest, kuksa::val::v2::GetValuesResponse>
+        call;
+
+    call.recordCompletion(grpc::Status(grpc::StatusCode::NOT_FOUND, "unknown signal"));
+
+    EXPECT_EQ(numCalls + 1, getNumCalls());
+}
@@ -17,8 +17,13 @@
 #include "sdk/grpc/GrpcCall.h"
 #include "sdk/grpc/GrpcClient.h"
 
+#include "kuksa/val/v2/val.pb.h"
+
 #include <gtest/gtest.h>
 
+#include <map>
+#include <string>
+
 using namespace velocitas;
 
 TEST(Test_GrpcClient, addActiveCall_newlyCreatedGrpcClient_oneActiveCall) {
@@ -69,3 +74,80 @@ TEST(Test_GrpcClient, addActiveCall_oneFinishedAndOneActiveCallPresent_finishedC
     EXPECT_EQ(2, activeCall.use_count());
     EXPECT_EQ(2, anotherActiveCall.use_count());
 }
+
+TEST(Test_GrpcClient, completeCall_activeCallPresent_callReleasedImmediately) {
+    // preparation
+    GrpcClient cut;
+    auto       call = std::make_shared<GrpcCall>();
+    cut.addActiveCall(call);
+    EXPECT_EQ(2, call.use_count());
+
+    // test
+    call->m_isComplete = true;
+    EXPECT_EQ(0, cut.getNumActiveCalls());
+    EXPECT_EQ(1, call.use_count());
+}
+
+TEST(Test_GrpcClient, addActiveCall_completedCall_notTracked) {
+    // preparation
+    GrpcClient cut;
+    auto       call    = std::make_shared<GrpcCall>();
+    call->m_isComplete = true;
+
+    // test
+    cut.addActiveCall(call);
+    EXPECT_EQ(0, cut.getNumActiveCalls());
+    EXPECT_EQ(1, call.use_count());
+}
+
+TEST(Test_GrpcClient, completeCall_clientDestroyed_callKeptAliveUntilComplete) {
+    // preparation
+    auto call = std::make_shared<GrpcCall>();
+    {
+        GrpcClient cut;
+        cut.addActiveCall(call);
+    }
+    EXPECT_EQ(2, call.use_count());
+
+    // test
+    call->m_isComplete = true;
+    EXPECT_TRUE(call->m_isComplete);
+    EXPECT_EQ(1, call.use_count());
+}
+
+TEST(Test_GrpcClient, cancelActiveCalls_activeAndCompletedCall_activeOneCancelled) {
+    // preparation
+    GrpcClient cut;
+    cut.addActiveCall(std::make_shared<GrpcCall>());
+    auto completedCall = std::make_shared<GrpcCall>();
+    cut.addActiveCall(completedCall);
+    completedCall->m_isComplete = true;
+
+    // test
+    EXPECT_EQ(1, cut.cancelActiveCalls());
+    // cancelled calls are released once they complete
+    EXPECT_EQ(1, cut.getNumActiveCalls());
+}
+
+TEST(Test_GrpcClient, getNumActiveCallsByRpcType_callsOfDifferentTypes_countedPerType) {
+    // preparation
+    using GetValuesCall_t = GrpcSingleResponseCall<kuksa::val::v2::GetValuesRequest,
+                                                   kuksa::val::v2::GetValuesResponse>;
+    using ActuateCall_t   = GrpcSingleResponseCall<kuksa::val::v2::BatchActuateRequest,
+                                                   kuksa::val::v2::BatchActuateResponse>;
+    GrpcClient cut;
+    cut.addActiveCall(std::make_shared<GetValuesCall_t>());
+    cut.addActiveCall(std::make_shared<GetValuesCall_t>());
+    auto actuateCall = std::make_shared<ActuateCall_t>();
+    cut.addActiveCall(actuateCall);
+    cut.addActiveCall(std::make_shared<GrpcCall>());
+
+    // test
+    const std::map<std::string, size_t> expected{{"", 1},
+                                                 {"kuksa.val.v2.BatchActuateRequest", 1},
+                                                 {"kuksa.val.v2.GetValuesRequest", 2}};
+    EXPECT_EQ(expected, cut.getNumActiveCallsByRpcType());
+
+    actuateCall->m_isComplete = true;
+    EXPECT_EQ(0, cut.getNumActiveCallsByRpcType().count("kuksa.val.v2.BatchActuateRequest"));
+}
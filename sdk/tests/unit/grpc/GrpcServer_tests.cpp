@@ -0,0 +1,189 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#include "sdk/grpc/GrpcServer.h"
+
+#include "kuksa/val/v2/val.grpc.pb.h"
+
+#include <gtest/gtest.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+using namespace velocitas;
+
+namespace {
+
+using Allocator_t =
+    PooledMessageAllocator<kuksa::val::v2::GetValueRequest, kuksa::val::v2::GetValueResponse>;
+
+// Answers GetServerInfo with the version provided by the test via an AsyncResult.
+class PendingInfoService final : public kuksa::val::v2::VAL::CallbackService {
+public:
+    grpc::ServerUnaryReactor*
+    GetServerInfo(grpc::CallbackServerContext* /*context*/,
+                  const kuksa::val::v2::GetServerInfoRequest* /*request*/,
+                  kuksa::val::v2::GetServerInfoResponse* response) override {
+        auto result = std::make_shared<AsyncResult<std::string>>();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_result = result;
+        }
+        return finishOnResult(result, [response](const std::string& version) {
+            response->set_version(version);
+            return grpc::Status::OK;
+        });
+    }
+
+    AsyncResultPtr_t<std::string> waitForCall() {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+        while (std::chrono::steady_clock::now() < deadline) {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_result) {
+                    return m_result;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+        return nullptr;
+    }
+
+private:
+    std::mutex                    m_mutex;
+    AsyncResultPtr_t<std::string> m_result;
+};
+
+} // namespace
+
+class Test_GrpcServer : public ::testing::Test {
+protected:
+    void SetUp() override {
+        int port{0};
+        m_server = startGrpcServer("127.0.0.1:0", m_service, GrpcServerConfig{}, &port);
+        m_stub   = kuksa::val::v2::VAL::NewStub(grpc::CreateChannel(
+            "127.0.0.1:" + std::to_string(port), grpc::InsecureChannelCredentials()));
+    }
+
+    void TearDown() override { m_server->Shutdown(std::chrono::system_clock::now()); }
+
+    PendingInfoService                         m_service;
+    std::unique_ptr<grpc::Server>              m_server;
+    std::unique_ptr<kuksa::val::v2::VAL::Stub> m_stub;
+};
+
+TEST_F(Test_GrpcServer, finishOnResult_resultInsertedLater_callAnsweredWithResult) {
+    grpc::ClientContext                   context;
+    kuksa::val::v2::GetServerInfoResponse response;
+    grpc::Status                          status;
+    std::thread                           client([&]() {
+        status = m_stub->GetServerInfo(&context, kuksa::val::v2::GetServerInfoRequest{}, &response);
+    });
+
+    auto result = m_service.waitForCall();
+    ASSERT_NE(nullptr, result);
+    result->insertResult("1.2.3");
+    client.join();
+
+    EXPECT_TRUE(status.ok());
+    EXPECT_EQ("1.2.3", response.version());
+}
+
+TEST_F(Test_GrpcServer, finishOnResult_resultFailed_callUnavailable) {
+    grpc::ClientContext                   context;
+    kuksa::val::v2::GetServerInfoResponse response;
+    std::thread failer([this]() {
+        if (auto result = m_service.waitForCall()) {
+            result->insertError(Status("databroker not reachable"));
+        }
+    });
+
+    const auto status =
+        m_stub->GetServerInfo(&context, kuksa::val::v2::GetServerInfoRequest{}, &response);
+    failer.join();
+
+    EXPECT_EQ(grpc::StatusCode::UNAVAILABLE, status.error_code());
+    EXPECT_EQ("databroker not reachable", status.error_message());
+}
+
+TEST_F(Test_GrpcServer, finishOnResult_deadlineExceeded_resultCancelled) {
+    grpc::ClientContext                   context;
+    kuksa::val::v2::GetServerInfoResponse response;
+    context.set_deadline(std::chrono::system_clock::now() + std::chrono::milliseconds{100});
+
+    const auto status =
+        m_stub->GetServerInfo(&context, kuksa::val::v2::GetServerInfoRequest{}, &response);
+
+    EXPECT_EQ(grpc::StatusCode::DEADLINE_EXCEEDED, status.error_code());
+    auto result = m_service.waitForCall();
+    ASSERT_NE(nullptr, result);
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+    while (!result->isCancelled() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    EXPECT_TRUE(result->isCancelled());
+}
+
+TEST(Test_PooledMessageAllocator, allocateMessages_releasedHolder_reusedCleared) {
+    Allocator_t allocator(1);
+    auto*       holder = allocator.AllocateMessages();
+    holder->request()->mutable_signal_id()->set_path("Vehicle.Speed");
+    holder->Release();
+
+    auto* reused = allocator.AllocateMessages();
+    EXPECT_EQ(holder, reused);
+    EXPECT_FALSE(reused->request()->has_signal_id());
+    auto* other = allocator.AllocateMessages();
+    EXPECT_NE(reused, other);
+    EXPECT_EQ(2, allocator.getNumAllocated());
+    EXPECT_EQ(1, allocator.getNumReused());
+
+    // exceeds the pool size -> freed
+    reused->Release();
+    other->Release();
+    auto* last = allocator.AllocateMessages();
+    EXPECT_EQ(reused, last);
+    EXPECT_EQ(2, allocator.getNumReused());
+    last->Release();
+}
+
+TEST(Test_PooledMessageAllocator, release_allocatorDestroyed_holderFreed) {
+    auto  allocator = std::make_unique<Allocator_t>();
+    auto* holder    = allocator->AllocateMessages();
+    allocator.reset();
+
+    holder->Release();
+}
+
+TEST(Test_GrpcServerConfig, fromEnvironment_validAndInvalidValues_parsedOrDefault) {
+    ::setenv("SDV_GRPC_SERVER_MAX_THREADS", "8", /*overwrite=*/1);
+    ::setenv("SDV_GRPC_SERVER_MESSAGE_POOL_SIZE", "many", /*overwrite=*/1);
+    const auto config = GrpcServerConfig::fromEnvironment();
+    EXPECT_EQ(8, config.m_maxThreads);
+    EXPECT_EQ(GrpcServerConfig::DEFAULT_MESSAGE_POOL_SIZE, config.m_messagePoolSize);
+
+    ::unsetenv("SDV_GRPC_SERVER_MAX_THREADS");
+    ::unsetenv("SDV_GRPC_SERVER_MESSAGE_POOL_SIZE");
+    EXPECT_EQ(0, GrpcServerConfig::fromEnvironment().m_maxThreads);
+}
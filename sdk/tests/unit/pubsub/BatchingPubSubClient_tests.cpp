@@ -0,0 +1,167 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/pubsub/BatchingPubSubClient.h"
+
+#include "sdk/EventLoop.h"
+#include "sdk/Executor.h"
+
+#include "MockIPubSubClient.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using namespace velocitas;
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::Return;
+
+namespace {
+
+AsyncResultPtr_t<PublishStatus> makeResult(PublishStatus status) {
+    auto result = std::make_shared<AsyncResult<PublishStatus>>();
+    result->insertResult(std::move(status));
+    return result;
+}
+
+class Test_BatchingPubSubClient : public ::testing::Test {
+protected:
+    std::shared_ptr<BatchingPubSubClient> createClient(PublishBatchingConfig config) {
+        // long window, so the tests flush explicitly
+        config.m_flushWindow = std::chrono::hours{1};
+        return std::make_shared<BatchingPubSubClient>(m_mockClient, std::move(config));
+    }
+
+    std::shared_ptr<MockIPubSubClient> m_mockClient = std::make_shared<MockIPubSubClient>();
+};
+
+} // namespace
+
+TEST_F(Test_BatchingPubSubClient, publishAsync_latestOnly_onlyLatestPublishedWithOutcomeForAll) {
+    auto client = createClient(PublishBatchingConfig{});
+    EXPECT_CALL(*m_mockClient, publishAsync("a/b", "3", _))
+        .WillOnce(Return(makeResult(PublishStatus::Success)));
+
+    auto result1 = client->publishAsync("a/b", "1", std::chrono::milliseconds::zero());
+    auto result2 = client->publishAsync("a/b", "2", std::chrono::milliseconds::zero());
+    auto result3 = client->publishAsync("a/b", "3", std::chrono::milliseconds::zero());
+    client->flush();
+
+    EXPECT_EQ(PublishStatus::Success, result1->await());
+    EXPECT_EQ(PublishStatus::Success, result2->await());
+    EXPECT_EQ(PublishStatus::Success, result3->await());
+}
+
+TEST_F(Test_BatchingPubSubClient, setExecutor_eventLoop_forwardedAndFlushedByLoop) {
+    PublishBatchingConfig config;
+    config.m_flushWindow = std::chrono::milliseconds{1};
+
+    auto client    = std::make_shared<BatchingPubSubClient>(m_mockClient, std::move(config));
+    auto eventLoop = EventLoop::create();
+    auto executor  = IExecutor::createEventLoop(eventLoop);
+    client->setExecutor(executor);
+    EXPECT_EQ(executor, m_mockClient->getExecutor());
+    EXPECT_CALL(*m_mockClient, publishAsync("a/b", "1", _))
+        .WillOnce(Return(makeResult(PublishStatus::Success)));
+
+    auto result = client->publishAsync("a/b", "1", std::chrono::milliseconds::zero());
+    while (eventLoop->poll() == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    EXPECT_EQ(PublishStatus::Success, result->await());
+}
+
+TEST_F(Test_BatchingPubSubClient, publishAsync_aggregate_framedIntoOneMessage) {
+    PublishBatchingConfig config;
+    config.m_mode = PublishBatchingConfig::Mode::AGGREGATE;
+    auto        client = createClient(config);
+    std::string message;
+    EXPECT_CALL(*m_mockClient, publishAsync("a/b", _, _))
+        .WillOnce([&message](const std::string& /*topic*/, const std::string& data,
+                             std::chrono::milliseconds /*timeout*/) {
+            message = data;
+            return makeResult(PublishStatus::Failure);
+        });
+
+    auto result1 = client->publishAsync("a/b", R"({"v":1})", std::chrono::milliseconds::zero());
+    auto result2 = client->publishAsync("a/b", "", std::chrono::milliseconds::zero());
+    client->flush();
+
+    EXPECT_THAT(IPubSubClient::splitAggregatedPayload(message), ElementsAre(R"({"v":1})", ""));
+    EXPECT_EQ(PublishStatus::Failure, result1->await());
+    EXPECT_EQ(PublishStatus::Failure, result2->await());
+}
+
+TEST_F(Test_BatchingPubSubClient, publishAsync_aggregateReachesLimit_publishedRightAway) {
+    PublishBatchingConfig config;
+    config.m_mode             = PublishBatchingConfig::Mode::AGGREGATE;
+    config.m_maxBatchMessages = 2;
+    auto client               = createClient(config);
+    EXPECT_CALL(*m_mockClient, publishAsync("a/b", _, _))
+        .WillOnce(Return(makeResult(PublishStatus::Success)));
+
+    client->publishAsync("a/b", "1", std::chrono::milliseconds::zero());
+    auto result = client->publishAsync("a/b", "2", std::chrono::milliseconds::zero());
+
+    EXPECT_EQ(PublishStatus::Success, result->await());
+}
+
+TEST_F(Test_BatchingPubSubClient, publishAsync_topicModeNone_forwardedUnbatched) {
+    PublishBatchingConfig config;
+    config.m_topicModes["direct"] = PublishBatchingConfig::Mode::NONE;
+    auto client                   = createClient(config);
+    EXPECT_CALL(*m_mockClient, publishAsync("direct", "1", std::chrono::milliseconds{50}))
+        .WillOnce(Return(makeResult(PublishStatus::Timeout)));
+
+    EXPECT_EQ(PublishStatus::Timeout,
+              client->publishAsync("direct", "1", std::chrono::milliseconds{50})->await());
+}
+
+TEST_F(Test_BatchingPubSubClient, flush_batchOfTopics_shortestTimeoutApplied) {
+    auto client = createClient(PublishBatchingConfig{});
+    EXPECT_CALL(*m_mockClient, publishAsync("a", "2", std::chrono::milliseconds{10}))
+        .WillOnce(Return(makeResult(PublishStatus::Success)));
+    EXPECT_CALL(*m_mockClient, publishAsync("b", "3", std::chrono::milliseconds::zero()))
+        .WillOnce(Return(makeResult(PublishStatus::Success)));
+
+    client->publishAsync("a", "1", std::chrono::milliseconds{10});
+    client->publishAsync("a", "2", std::chrono::milliseconds{20});
+    client->publishOnTopic("b", "3");
+    client->flush();
+}
+
+TEST_F(Test_BatchingPubSubClient, publishAsync_flushWindowEnds_published) {
+    PublishBatchingConfig config;
+    config.m_flushWindow = std::chrono::milliseconds{10};
+    auto client          = std::make_shared<BatchingPubSubClient>(m_mockClient, config);
+    EXPECT_CALL(*m_mockClient, publishAsync("a", "1", _))
+        .WillOnce(Return(makeResult(PublishStatus::Success)));
+
+    EXPECT_EQ(PublishStatus::Success, client->publishOnTopic("a", "1", 0));
+}
+
+TEST(Test_IPubSubClient, splitAggregatedPayload_truncated_throws) {
+    EXPECT_THROW(IPubSubClient::splitAggregatedPayload(std::string("\0\0", 2)),
+                 std::invalid_argument);
+    EXPECT_THROW(IPubSubClient::splitAggregatedPayload(std::string("\0\0\0\5abc", 7)),
+                 std::invalid_argument);
+}
@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/pubsub/EncodingPubSubClient.h"
+
+#include "MockIPubSubClient.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+using namespace velocitas;
+using ::testing::_;
+using ::testing::Return;
+using ::testing::SaveArg;
+
+namespace {
+
+constexpr std::chrono::milliseconds DELIVERY_TIMEOUT{1000};
+
+const std::string PAYLOAD(200, 'x');
+
+PayloadCodecConfig createConfig() {
+    PayloadCodecConfig config;
+    config.m_codec                   = IPayloadCodec::createDeflate();
+    config.m_topicCodecs["plain/#"]  = nullptr;
+    config.m_topicCodecs["plain/on"] = config.m_codec;
+    return config;
+}
+
+} // namespace
+
+class Test_EncodingPubSubClient : public ::testing::Test {
+protected:
+    std::shared_ptr<MockIPubSubClient>    m_client{std::make_shared<MockIPubSubClient>()};
+    std::shared_ptr<EncodingPubSubClient> m_cut{
+        std::make_shared<EncodingPubSubClient>(m_client, createConfig())};
+};
+
+TEST_F(Test_EncodingPubSubClient, publishOnTopic_topicWithCodec_encodedPayload) {
+    std::string published;
+    EXPECT_CALL(*m_client, publishOnTopic("a/b", _)).WillOnce(SaveArg<1>(&published));
+
+    m_cut->publishOnTopic("a/b", PAYLOAD);
+    EXPECT_LT(published.size(), PAYLOAD.size());
+    EXPECT_EQ(PAYLOAD, m_cut->decode(published));
+}
+
+TEST_F(Test_EncodingPubSubClient, publishOnTopic_topicOrPayloadWithoutCodec_unchanged) {
+    EXPECT_CALL(*m_client, publishOnTopic("a/b", "small"));
+    EXPECT_CALL(*m_client, publishOnTopic("plain/off", PAYLOAD));
+    std::string published;
+    EXPECT_CALL(*m_client, publishOnTopic("plain/on", _)).WillOnce(SaveArg<1>(&published));
+
+    m_cut->publishOnTopic("a/b", "small");
+    m_cut->publishOnTopic("plain/off", PAYLOAD);
+    m_cut->publishOnTopic("plain/on", PAYLOAD);
+    EXPECT_NE(PAYLOAD, published);
+}
+
+TEST_F(Test_EncodingPubSubClient, encode_unencodedPayloadLookingLikeFrame_decodedUnchanged) {
+    const std::string payload = "\x1bSDV\x07" "deflate";
+    EXPECT_EQ(payload, m_cut->decode(m_cut->encode("plain/off", payload)));
+    EXPECT_FALSE(m_cut->decode("plain").has_value());
+}
+
+TEST_F(Test_EncodingPubSubClient, publishAsync_topicWithCodec_encodedOnPoolWithResultOfClient) {
+    auto        clientResult = std::make_shared<AsyncResult<PublishStatus>>();
+    std::string published;
+    EXPECT_CALL(*m_client, publishAsync("a/b", _, std::chrono::milliseconds(10)))
+        .WillOnce(::testing::DoAll(SaveArg<1>(&published), Return(clientResult)));
+
+    auto result = m_cut->publishAsync("a/b", PAYLOAD, std::chrono::milliseconds(10));
+    clientResult->insertResult(PublishStatus::Timeout);
+    EXPECT_EQ(PublishStatus::Timeout, result->await());
+    EXPECT_EQ(PAYLOAD, m_cut->decode(published));
+}
+
+TEST_F(Test_EncodingPubSubClient, subscribeTopic_encodedAndUnknownPayloads_decodedOrDropped) {
+    auto clientSubscription = std::make_shared<AsyncSubscription<std::string>>();
+    EXPECT_CALL(*m_client, subscribeTopic("a/#")).WillOnce(Return(clientSubscription));
+
+    auto subscription = m_cut->subscribeTopic("a/#");
+    clientSubscription->insertNewItem(std::string("\x1bSDV\x03lz4payload"));
+    clientSubscription->insertNewItem(m_cut->encode("a/b", PAYLOAD));
+    clientSubscription->insertNewItem(std::string("plain"));
+
+    EXPECT_EQ(PAYLOAD, subscription->nextFor(DELIVERY_TIMEOUT));
+    EXPECT_EQ("plain", subscription->nextFor(DELIVERY_TIMEOUT));
+}
+
+TEST(Test_EncodingPubSubClientInProcess, subscribeTopicBinary_encodedPayload_decodedWithTopic) {
+    auto client = IPubSubClient::createEncoding(IPubSubClient::createInProcess("encoding"),
+                                                createConfig());
+    client->connect();
+
+    auto subscription = client->subscribeTopicBinary("encoding/binary");
+    client->publishOnTopic("encoding/binary", PAYLOAD);
+
+    auto message = subscription->nextFor(DELIVERY_TIMEOUT);
+    ASSERT_TRUE(message.has_value());
+    EXPECT_EQ("encoding/binary", message->getTopic());
+    EXPECT_EQ(PAYLOAD, message->getPayload());
+}
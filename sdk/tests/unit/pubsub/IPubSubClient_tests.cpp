@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/IPubSubClient.h"
+
+#include "MockIPubSubClient.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+using namespace velocitas;
+using ::testing::Return;
+
+TEST(Test_PubSubMessage, getNativeMessage_keepsBufferOfViews) {
+    std::optional<PubSubMessage> message;
+    {
+        auto native = std::make_shared<const std::string>("a/b:payload");
+        message.emplace(native, std::string_view(*native).substr(0, 3),
+                        std::string_view(*native).substr(4), 1, true);
+    }
+    EXPECT_EQ("a/b", message->getTopic());
+    EXPECT_EQ("payload", message->getPayload());
+    EXPECT_EQ(1, message->getQos());
+    EXPECT_TRUE(message->isRetained());
+    EXPECT_EQ("a/b:payload", *std::static_pointer_cast<const std::string>(
+                                 message->getNativeMessage()));
+}
+
+TEST(Test_IPubSubClient, subscribeTopicBinary_notSupported_payloadsOfTextSubscription) {
+    auto client           = std::make_shared<MockIPubSubClient>();
+    auto textSubscription = std::make_shared<AsyncSubscription<std::string>>();
+    EXPECT_CALL(*client, subscribeTopic("a/b")).WillOnce(Return(textSubscription));
+
+    auto subscription = client->subscribeTopicBinary("a/b");
+    textSubscription->insertNewItem(std::string("\x01\x00\x02", 3));
+
+    auto message = subscription->tryNext();
+    ASSERT_TRUE(message.has_value());
+    EXPECT_EQ("a/b", message->getTopic());
+    EXPECT_EQ(std::string_view("\x01\x00\x02", 3), message->getPayload());
+}
+
+TEST(Test_IPubSubClient, createInstance_invalidQos_throwsInvalidArgument) {
+    MqttClientOptions options;
+    options.m_qos = 3;
+    EXPECT_THROW(IPubSubClient::createInstance("localhost:1883", "client", options),
+                 std::invalid_argument);
+}
+
+TEST(Test_IPubSubClient, createInstance_invalidTopicQos_throwsInvalidArgument) {
+    MqttClientOptions options;
+    options.m_topicQos["a/#"] = -1;
+    EXPECT_THROW(IPubSubClient::createInstance("localhost:1883", "client", options),
+                 std::invalid_argument);
+}
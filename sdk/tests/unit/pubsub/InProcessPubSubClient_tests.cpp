@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/pubsub/InProcessPubSubClient.h"
+
+#include "MockIPubSubClient.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+using namespace velocitas;
+using ::testing::Return;
+
+namespace {
+
+constexpr std::chrono::milliseconds DELIVERY_TIMEOUT{1000};
+constexpr std::chrono::milliseconds NO_DELIVERY_TIMEOUT{50};
+
+std::shared_ptr<IPubSubClient> createConnectedClient(const std::string& clientId) {
+    auto client = IPubSubClient::createInProcess(clientId);
+    client->connect();
+    return client;
+}
+
+} // namespace
+
+TEST(Test_InProcessPubSubClient, publishOnTopic_matchingSubscriptionOfOtherClient_delivered) {
+    auto publisher  = createConnectedClient("publisher");
+    auto subscriber = createConnectedClient("subscriber");
+
+    auto subscription = subscriber->subscribeTopic("inprocess/deliver/+");
+    publisher->publishOnTopic("inprocess/deliver/a", "1");
+    publisher->publishOnTopic("inprocess/other/a", "2");
+    publisher->publishOnTopic("inprocess/deliver/b", "3");
+
+    EXPECT_EQ("1", subscription->nextFor(DELIVERY_TIMEOUT));
+    EXPECT_EQ("3", subscription->nextFor(DELIVERY_TIMEOUT));
+    EXPECT_FALSE(subscription->nextFor(NO_DELIVERY_TIMEOUT).has_value());
+}
+
+TEST(Test_InProcessPubSubClient, subscribeTopicBinary_twoSubscriptions_shareOnePayload) {
+    auto client = createConnectedClient("client");
+    auto first  = client->subscribeTopicBinary("inprocess/binary");
+    auto second = client->subscribeTopicBinary("inprocess/#");
+    client->publishOnTopic("inprocess/binary", std::string("\x01\x00", 2));
+
+    auto firstMessage  = first->nextFor(DELIVERY_TIMEOUT);
+    auto secondMessage = second->nextFor(DELIVERY_TIMEOUT);
+    ASSERT_TRUE(firstMessage.has_value());
+    ASSERT_TRUE(secondMessage.has_value());
+    EXPECT_EQ("inprocess/binary", firstMessage->getTopic());
+    EXPECT_EQ(std::string_view("\x01\x00", 2), firstMessage->getPayload());
+    EXPECT_EQ(firstMessage->getPayload().data(), secondMessage->getPayload().data());
+}
+
+TEST(Test_InProcessPubSubClient, unsubscribeTopic_sameFilterOfOtherClient_stillDelivered) {
+    auto first  = createConnectedClient("first");
+    auto second = createConnectedClient("second");
+
+    auto firstSubscription  = first->subscribeTopic("inprocess/unsubscribe");
+    auto secondSubscription = second->subscribeTopic("inprocess/unsubscribe");
+    first->unsubscribeTopic("inprocess/unsubscribe");
+    first->publishOnTopic("inprocess/unsubscribe", "1");
+
+    EXPECT_EQ("1", secondSubscription->nextFor(DELIVERY_TIMEOUT));
+    EXPECT_FALSE(firstSubscription->nextFor(NO_DELIVERY_TIMEOUT).has_value());
+}
+
+TEST(Test_InProcessPubSubClient, destructor_subscriptionsOfClientRemoved) {
+    auto publisher    = createConnectedClient("publisher");
+    auto subscriber   = createConnectedClient("subscriber");
+    auto subscription = subscriber->subscribeTopic("inprocess/destroyed");
+    subscriber.reset();
+
+    publisher->publishOnTopic("inprocess/destroyed", "1");
+    EXPECT_FALSE(subscription->nextFor(NO_DELIVERY_TIMEOUT).has_value());
+}
+
+TEST(Test_InProcessPubSubClient, publishAsync_notConnected_failure) {
+    auto client = IPubSubClient::createInProcess("client");
+    EXPECT_EQ(PublishStatus::Failure,
+              client->publishAsync("inprocess/disconnected", "1", std::chrono::milliseconds(0))
+                  ->await());
+    EXPECT_THROW(client->publishOnTopic("inprocess/disconnected", "1"), std::runtime_error);
+}
+
+TEST(Test_InProcessPubSubClient, bridgedTopics_publishedAndSubscribedViaBridge) {
+    auto bridge = std::make_shared<MockIPubSubClient>();
+    auto client = IPubSubClient::createInProcess("client", bridge, {"inprocess/bridged/#"});
+
+    auto bridgeSubscription = std::make_shared<AsyncSubscription<std::string>>();
+    EXPECT_CALL(*bridge, connect());
+    EXPECT_CALL(*bridge, publishOnTopic("inprocess/bridged/a", "1"));
+    EXPECT_CALL(*bridge, subscribeTopic("inprocess/bridged/+"))
+        .WillOnce(Return(bridgeSubscription));
+
+    client->connect();
+    client->publishOnTopic("inprocess/bridged/a", "1");
+    EXPECT_EQ(bridgeSubscription, client->subscribeTopic("inprocess/bridged/+"));
+
+    auto local = client->subscribeTopic("inprocess/local");
+    client->publishOnTopic("inprocess/local", "2");
+    EXPECT_EQ("2", local->nextFor(DELIVERY_TIMEOUT));
+}
+
+TEST(Test_InProcessPubSubClient, createInProcess_bridgedTopicsWithoutBridge_throws) {
+    EXPECT_THROW(IPubSubClient::createInProcess("client", nullptr, {"a/#"}),
+                 std::invalid_argument);
+}
@@ -0,0 +1,208 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/pubsub/OfflineQueue.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace velocitas;
+
+namespace {
+
+// 24 bytes of record header, 1 byte of topic and 7 bytes of payload
+constexpr size_t RECORD_SIZE = 32;
+// the file starts with the queue header of five 64 bit fields
+constexpr size_t FILE_HEADER_SIZE = 40;
+
+std::string payloadOf(int index) {
+    auto number = std::to_string(index % 10000);
+    return "msg" + std::string(4 - number.size(), '0') + number;
+}
+
+} // namespace
+
+class Test_OfflineQueue : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_path = std::filesystem::temp_directory_path() /
+                 (std::string("offline_queue_") +
+                  ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove(m_path);
+    }
+
+    void TearDown() override { std::filesystem::remove(m_path); }
+
+    std::unique_ptr<OfflineQueue>
+    open(size_t                    capacity,
+         OfflineQueue::DropPolicy  dropPolicy = OfflineQueue::DropPolicy::DROP_OLDEST,
+         std::chrono::milliseconds retention  = std::chrono::milliseconds(0)) {
+        return std::make_unique<OfflineQueue>(m_path.string(), capacity, dropPolicy, retention);
+    }
+
+    // overwrite the topic size of the record at the given offset of the ring
+    void corruptTopicSize(size_t offset, uint32_t topicSize) {
+        std::fstream file(m_path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(static_cast<std::streamoff>(FILE_HEADER_SIZE + offset));
+        file.write(reinterpret_cast<const char*>(&topicSize), sizeof(topicSize));
+    }
+
+private:
+    std::filesystem::path m_path;
+};
+
+TEST_F(Test_OfflineQueue, peek_pushedMessages_inOrderUntilPopped) {
+    auto queue = open(1024);
+    EXPECT_TRUE(queue->push("a", "payloadA", 1));
+    EXPECT_TRUE(queue->push("topic/b", "", 2));
+
+    auto records = queue->peek(10);
+    ASSERT_EQ(2, records.size());
+    EXPECT_EQ("a", records[0].m_topic);
+    EXPECT_EQ("payloadA", records[0].m_payload);
+    EXPECT_EQ(1, records[0].m_qos);
+    EXPECT_EQ("topic/b", records[1].m_topic);
+    EXPECT_EQ("", records[1].m_payload);
+    EXPECT_EQ(2, records[1].m_qos);
+
+    queue->pop(1);
+    EXPECT_EQ(1, queue->size());
+    EXPECT_EQ("topic/b", queue->peek(10).at(0).m_topic);
+    queue->pop(1);
+    EXPECT_TRUE(queue->empty());
+}
+
+TEST_F(Test_OfflineQueue, push_beyondEndOfRing_wrapsAroundInOrder) {
+    // room for three records and a bit, so the ring wraps at varying offsets
+    auto queue    = open(3 * RECORD_SIZE + 10);
+    int  nextPush = 0;
+    int  nextPeek = 0;
+    for (int round = 0; round < 50; ++round) {
+        while (queue->size() < 3) {
+            ASSERT_TRUE(queue->push("t", payloadOf(nextPush++), 0));
+        }
+        const auto numPopped = static_cast<size_t>(1 + round % 3);
+        auto       records   = queue->peek(numPopped);
+        ASSERT_EQ(numPopped, records.size());
+        for (const auto& record : records) {
+            EXPECT_EQ(payloadOf(nextPeek++), record.m_payload);
+        }
+        queue->pop(numPopped);
+    }
+    EXPECT_EQ(0, queue->getNumDropped());
+}
+
+TEST_F(Test_OfflineQueue, push_fullWithDropOldest_oldestDropped) {
+    auto queue = open(2 * RECORD_SIZE);
+    EXPECT_TRUE(queue->push("t", payloadOf(0), 0));
+    EXPECT_TRUE(queue->push("t", payloadOf(1), 0));
+    EXPECT_TRUE(queue->push("t", payloadOf(2), 0));
+
+    auto records = queue->peek(10);
+    ASSERT_EQ(2, records.size());
+    EXPECT_EQ(payloadOf(1), records[0].m_payload);
+    EXPECT_EQ(payloadOf(2), records[1].m_payload);
+    EXPECT_EQ(1, queue->getNumDropped());
+}
+
+TEST_F(Test_OfflineQueue, popUntil_oldestDroppedWhileBatchInFlight_laterRecordsKept) {
+    auto queue = open(4 * RECORD_SIZE);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue->push("t", payloadOf(i), 0));
+    }
+    const auto batch = queue->peek(2);
+    ASSERT_EQ(2, batch.size());
+    // queued while the batch is published, dropping its first record
+    ASSERT_TRUE(queue->push("t", payloadOf(4), 0));
+
+    queue->popUntil(batch.back().m_id);
+
+    const auto records = queue->peek(10);
+    ASSERT_EQ(3, records.size());
+    EXPECT_EQ(payloadOf(2), records[0].m_payload);
+    EXPECT_EQ(payloadOf(3), records[1].m_payload);
+    EXPECT_EQ(payloadOf(4), records[2].m_payload);
+    EXPECT_EQ(1, queue->getNumDropped());
+}
+
+TEST_F(Test_OfflineQueue, push_fullWithDropNewest_newDropped) {
+    auto queue = open(2 * RECORD_SIZE, OfflineQueue::DropPolicy::DROP_NEWEST);
+    EXPECT_TRUE(queue->push("t", payloadOf(0), 0));
+    EXPECT_TRUE(queue->push("t", payloadOf(1), 0));
+    EXPECT_FALSE(queue->push("t", payloadOf(2), 0));
+    EXPECT_FALSE(queue->push("t", std::string(3 * RECORD_SIZE, 'x'), 0));
+
+    EXPECT_EQ(payloadOf(0), queue->peek(1).at(0).m_payload);
+    EXPECT_EQ(2, queue->getNumDropped());
+}
+
+TEST_F(Test_OfflineQueue, peek_messagesExceedingRetention_dropped) {
+    auto queue = open(1024, OfflineQueue::DropPolicy::DROP_OLDEST, std::chrono::milliseconds(20));
+    queue->push("t", payloadOf(0), 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    queue->push("t", payloadOf(1), 0);
+
+    auto records = queue->peek(10);
+    ASSERT_EQ(1, records.size());
+    EXPECT_EQ(payloadOf(1), records[0].m_payload);
+    EXPECT_EQ(1, queue->getNumDropped());
+}
+
+TEST_F(Test_OfflineQueue, open_existingFileOfSameCapacity_messagesKept) {
+    open(1024)->push("t", payloadOf(0), 1);
+
+    auto reopened = open(1024);
+    ASSERT_EQ(1, reopened->size());
+    EXPECT_EQ(payloadOf(0), reopened->peek(1).at(0).m_payload);
+    reopened.reset();
+
+    EXPECT_TRUE(open(2048)->empty());
+}
+
+TEST_F(Test_OfflineQueue, open_wrappedRecords_messagesKept) {
+    {
+        auto queue = open(3 * RECORD_SIZE + 10);
+        for (int i = 0; i < 5; ++i) {
+            ASSERT_TRUE(queue->push("t", payloadOf(i), 0));
+        }
+    }
+
+    auto reopened = open(3 * RECORD_SIZE + 10);
+    auto records  = reopened->peek(10);
+    ASSERT_EQ(3, records.size());
+    EXPECT_EQ(payloadOf(2), records[0].m_payload);
+    EXPECT_EQ(payloadOf(4), records[2].m_payload);
+}
+
+TEST_F(Test_OfflineQueue, open_recordExceedingRing_queueReset) {
+    {
+        auto queue = open(1024);
+        queue->push("t", payloadOf(0), 0);
+        queue->push("t", payloadOf(1), 0);
+    }
+    // a torn write left a record pointing beyond the end of the mapping
+    corruptTopicSize(RECORD_SIZE, 4096);
+
+    auto reopened = open(1024);
+    EXPECT_TRUE(reopened->empty());
+    EXPECT_TRUE(reopened->push("t", payloadOf(2), 0));
+    EXPECT_EQ(payloadOf(2), reopened->peek(1).at(0).m_payload);
+}
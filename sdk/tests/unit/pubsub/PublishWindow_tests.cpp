@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/pubsub/PublishWindow.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+/** Collects the started publishes, so the test completes them */
+class FakeTransport {
+public:
+    PublishWindow::Sender_t sender() {
+        return [this](PublishWindow::DoneHandler_t onDone) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_started.push_back(std::move(onDone));
+        };
+    }
+
+    size_t getNumStarted() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_started.size();
+    }
+
+    void complete(size_t index, PublishStatus status) {
+        PublishWindow::DoneHandler_t onDone;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            onDone = m_started.at(index);
+        }
+        onDone(status);
+    }
+
+private:
+    std::mutex                                m_mutex;
+    std::vector<PublishWindow::DoneHandler_t> m_started;
+};
+
+const std::chrono::milliseconds NO_TIMEOUT{0};
+
+} // namespace
+
+TEST(Test_PublishWindow, submit_windowNotFull_sentRightAway) {
+    auto          window = std::make_shared<PublishWindow>(2);
+    FakeTransport transport;
+
+    auto result1 = window->submit(transport.sender(), NO_TIMEOUT);
+    auto result2 = window->submit(transport.sender(), NO_TIMEOUT);
+
+    EXPECT_EQ(2, transport.getNumStarted());
+    EXPECT_EQ(2, window->getNumInFlight());
+    EXPECT_EQ(0, window->getNumQueued());
+    transport.complete(1, PublishStatus::Success);
+    transport.complete(0, PublishStatus::Failure);
+    EXPECT_EQ(PublishStatus::Failure, result1->await());
+    EXPECT_EQ(PublishStatus::Success, result2->await());
+    EXPECT_EQ(0, window->getNumInFlight());
+}
+
+TEST(Test_PublishWindow, submit_windowFull_queuedUntilEarlierCompletes) {
+    auto          window = std::make_shared<PublishWindow>(1);
+    FakeTransport transport;
+
+    auto result1 = window->submit(transport.sender(), NO_TIMEOUT);
+    auto result2 = window->submit(transport.sender(), NO_TIMEOUT);
+    EXPECT_EQ(1, transport.getNumStarted());
+    EXPECT_EQ(1, window->getNumQueued());
+
+    transport.complete(0, PublishStatus::Success);
+    EXPECT_EQ(PublishStatus::Success, result1->await());
+    EXPECT_EQ(2, transport.getNumStarted());
+    EXPECT_EQ(1, window->getNumInFlight());
+    EXPECT_EQ(0, window->getNumQueued());
+
+    transport.complete(1, PublishStatus::Success);
+    EXPECT_EQ(PublishStatus::Success, result2->await());
+    EXPECT_EQ(0, window->getNumInFlight());
+}
+
+TEST(Test_PublishWindow, submit_senderThrows_failureAndSlotReleased) {
+    auto window = std::make_shared<PublishWindow>(1);
+
+    auto result = window->submit(
+        [](const PublishWindow::DoneHandler_t& /*onDone*/) { throw std::runtime_error("fail"); },
+        NO_TIMEOUT);
+
+    EXPECT_EQ(PublishStatus::Failure, result->await());
+    EXPECT_EQ(0, window->getNumInFlight());
+}
+
+TEST(Test_PublishWindow, submit_inFlightTimesOut_timeoutButSlotKeptUntilCompletion) {
+    auto          window = std::make_shared<PublishWindow>(1);
+    FakeTransport transport;
+
+    auto result = window->submit(transport.sender(), std::chrono::milliseconds{20});
+    EXPECT_EQ(PublishStatus::Timeout, result->await());
+    EXPECT_EQ(1, window->getNumInFlight());
+
+    transport.complete(0, PublishStatus::Success);
+    EXPECT_EQ(0, window->getNumInFlight());
+}
+
+TEST(Test_PublishWindow, submit_queuedTimesOut_neverSent) {
+    auto          window = std::make_shared<PublishWindow>(1);
+    FakeTransport transport;
+
+    auto result1 = window->submit(transport.sender(), NO_TIMEOUT);
+    auto result2 = window->submit(transport.sender(), std::chrono::milliseconds{20});
+    EXPECT_EQ(PublishStatus::Timeout, result2->await());
+    EXPECT_EQ(0, window->getNumQueued());
+
+    transport.complete(0, PublishStatus::Success);
+    EXPECT_EQ(PublishStatus::Success, result1->await());
+    EXPECT_EQ(1, transport.getNumStarted());
+    EXPECT_EQ(0, window->getNumInFlight());
+}
+
+TEST(Test_PublishWindow, submit_completedBeforeTimeout_resultKept) {
+    auto          window = std::make_shared<PublishWindow>(1);
+    FakeTransport transport;
+
+    auto result = window->submit(transport.sender(), std::chrono::milliseconds{20});
+    transport.complete(0, PublishStatus::Success);
+    std::this_thread::sleep_for(std::chrono::milliseconds{40});
+    EXPECT_EQ(PublishStatus::Success, result->await());
+}
@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/pubsub/TopicTrie.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+using ::testing::IsEmpty;
+using ::testing::UnorderedElementsAre;
+
+TEST(Test_TopicTrie, match_exactFilter_onlySameTopic) {
+    TopicTrie<int> trie;
+    trie.insert("a/b", 1);
+    trie.insert("a/b", 2);
+    trie.insert("a/c", 3);
+
+    EXPECT_THAT(trie.match("a/b"), UnorderedElementsAre(1, 2));
+    EXPECT_THAT(trie.match("a"), IsEmpty());
+    EXPECT_THAT(trie.match("a/b/c"), IsEmpty());
+}
+
+TEST(Test_TopicTrie, match_singleLevelWildcard_matchesOneLevel) {
+    TopicTrie<int> trie;
+    trie.insert("a/+/c", 1);
+    trie.insert("+", 2);
+
+    EXPECT_THAT(trie.match("a/b/c"), UnorderedElementsAre(1));
+    EXPECT_THAT(trie.match("a//c"), UnorderedElementsAre(1));
+    EXPECT_THAT(trie.match("a/b/d"), IsEmpty());
+    EXPECT_THAT(trie.match("a"), UnorderedElementsAre(2));
+    EXPECT_THAT(trie.match("a/b"), IsEmpty());
+}
+
+TEST(Test_TopicTrie, match_multiLevelWildcard_matchesParentAndChildLevels) {
+    TopicTrie<int> trie;
+    trie.insert("a/#", 1);
+    trie.insert("#", 2);
+
+    EXPECT_THAT(trie.match("a"), UnorderedElementsAre(1, 2));
+    EXPECT_THAT(trie.match("a/b/c"), UnorderedElementsAre(1, 2));
+    EXPECT_THAT(trie.match("b"), UnorderedElementsAre(2));
+}
+
+TEST(Test_TopicTrie, match_systemTopic_noWildcardMatchAtFirstLevel) {
+    TopicTrie<int> trie;
+    trie.insert("#", 1);
+    trie.insert("+/info", 2);
+    trie.insert("$SYS/#", 3);
+
+    EXPECT_THAT(trie.match("$SYS/info"), UnorderedElementsAre(3));
+}
+
+TEST(Test_TopicTrie, match_sharedSubscription_oneSubscriberOfGroupRoundRobin) {
+    TopicTrie<int> trie;
+    trie.insert("$share/group/a/+", 1);
+    trie.insert("$share/group/a/+", 2);
+    trie.insert("a/b", 3);
+
+    std::vector<int> receivers;
+    for (int i = 0; i < 4; ++i) {
+        auto matches = trie.match("a/b");
+        ASSERT_EQ(2, matches.size());
+        EXPECT_EQ(3, matches.front());
+        receivers.push_back(matches.back());
+    }
+    EXPECT_EQ((std::vector<int>{1, 2, 1, 2}), receivers);
+}
+
+TEST(Test_TopicTrie, remove_filter_allItsSubscribersRemoved) {
+    TopicTrie<int> trie;
+    trie.insert("a/+", 1);
+    trie.insert("a/+", 2);
+    trie.insert("$share/group/a/+", 3);
+
+    EXPECT_TRUE(trie.remove("a/+"));
+    EXPECT_FALSE(trie.remove("a/+"));
+    EXPECT_FALSE(trie.remove("a/b"));
+    EXPECT_THAT(trie.match("a/b"), UnorderedElementsAre(3));
+
+    EXPECT_TRUE(trie.remove("$share/group/a/+"));
+    EXPECT_TRUE(trie.empty());
+}
+
+TEST(Test_TopicTrie, removeIf_predicate_onlyMatchingSubscribersRemoved) {
+    TopicTrie<int> trie;
+    trie.insert("a/#", 1);
+    trie.insert("a/#", 2);
+    trie.insert("$share/group/a/#", 3);
+
+    const auto isOdd = [](int subscriber) { return subscriber % 2 == 1; };
+    EXPECT_TRUE(trie.removeIf("a/#", isOdd));
+    EXPECT_FALSE(trie.removeIf("a/#", isOdd));
+    EXPECT_TRUE(trie.removeIf("$share/group/a/#", isOdd));
+    EXPECT_THAT(trie.match("a/b"), UnorderedElementsAre(2));
+}
+
+TEST(Test_TopicTrie, match_concurrentModification_readsConsistentSnapshot) {
+    TopicTrie<int> trie;
+    trie.insert("a/b", 0);
+
+    std::thread writer([&trie]() {
+        for (int i = 1; i <= 1000; ++i) {
+            trie.insert("a/+", i);
+            trie.remove("a/+");
+        }
+    });
+    for (int i = 0; i < 1000; ++i) {
+        auto matches = trie.match("a/b");
+        ASSERT_GE(matches.size(), 1);
+        ASSERT_LE(matches.size(), 2);
+    }
+    writer.join();
+    EXPECT_THAT(trie.match("a/b"), UnorderedElementsAre(0));
+}
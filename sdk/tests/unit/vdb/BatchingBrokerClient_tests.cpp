@@ -0,0 +1,198 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/BatchingBrokerClient.h"
+
+#include "VehicleDataBrokerClientMock.h"
+#include "sdk/DataPointReply.h"
+#include "sdk/VehicleModelContext.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::Return;
+using ::testing::SizeIs;
+using ::testing::UnorderedElementsAre;
+
+namespace {
+
+class Test_BatchingBrokerClient : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_mock   = std::make_shared<VehicleDataBrokerClientMock>();
+        m_client = std::make_shared<BatchingBrokerClient>(m_mock, std::chrono::seconds{10});
+    }
+
+    static std::vector<std::unique_ptr<DataPointValue>> createValues(const std::string& path,
+                                                                     float              value) {
+        std::vector<std::unique_ptr<DataPointValue>> values;
+        values.push_back(std::make_unique<TypedDataPointValue<float>>(path, value));
+        return values;
+    }
+
+    std::shared_ptr<VehicleDataBrokerClientMock> m_mock;
+    std::shared_ptr<BatchingBrokerClient>        m_client;
+};
+
+} // namespace
+
+TEST_F(Test_BatchingBrokerClient, getDatapoints_withinWindow_mergedIntoOneCall) {
+    auto brokerResult = std::make_shared<AsyncResult<DataPointReply>>();
+    DataPointReply reply;
+    reply.set("Batch.Get.A", DataPointSample(1.0F));
+    reply.set("Batch.Get.B", DataPointSample(2.0F));
+    brokerResult->insertResult(std::move(reply));
+    EXPECT_CALL(*m_mock, getDatapoints(ElementsAre("Batch.Get.A", "Batch.Get.B")))
+        .WillOnce(Return(brokerResult));
+
+    auto result1 = m_client->getDatapoints({"Batch.Get.A"});
+    auto result2 = m_client->getDatapoints({"Batch.Get.A", "Batch.Get.B"});
+    m_client->flush();
+
+    auto reply1 = result1->await();
+    ASSERT_EQ(1, reply1.size());
+    EXPECT_EQ(1.0F, reply1.getSample("Batch.Get.A").get<float>());
+    EXPECT_EQ(2, result2->await().size());
+}
+
+TEST_F(Test_BatchingBrokerClient, setCallbackExecutor_executorSet_appliedToResults) {
+    EXPECT_CALL(*m_mock, getDatapoints(_))
+        .WillRepeatedly(Return(std::make_shared<AsyncResult<DataPointReply>>()));
+    EXPECT_CALL(*m_mock, setDatapoints(_))
+        .WillOnce(Return(std::make_shared<AsyncResult<IVehicleDataBrokerClient::SetErrorMap_t>>()));
+    const auto executor = CallbackExecutor::createPool();
+    m_client->setCallbackExecutor(executor);
+
+    EXPECT_EQ(executor, m_client->getDatapoints({"Batch.Get.A"})->getCallbackExecutor());
+    EXPECT_EQ(executor,
+              m_client->setDatapoints(createValues("Batch.Set.A", 1.0F))->getCallbackExecutor());
+    m_client->setCallbackExecutor(nullptr);
+    EXPECT_EQ(nullptr, m_client->getDatapoints({"Batch.Get.A"})->getCallbackExecutor());
+}
+
+TEST_F(Test_BatchingBrokerClient, setDatapoints_withinWindow_mergedAndErrorsSplit) {
+    auto brokerResult = std::make_shared<AsyncResult<IVehicleDataBrokerClient::SetErrorMap_t>>();
+    brokerResult->insertResult({{"Batch.Set.B", "read only"}});
+    EXPECT_CALL(*m_mock, setDatapoints(SizeIs(2))).WillOnce(Return(brokerResult));
+
+    auto result1 = m_client->setDatapoints(createValues("Batch.Set.A", 1.0F));
+    auto result2 = m_client->setDatapoints(createValues("Batch.Set.B", 2.0F));
+    m_client->flush();
+
+    EXPECT_TRUE(result1->await().empty());
+    EXPECT_EQ(1, result2->await().count("Batch.Set.B"));
+}
+
+TEST_F(Test_BatchingBrokerClient, setDatapoints_sameSignalTwice_previousBatchIssuedFirst) {
+    auto brokerResult = std::make_shared<AsyncResult<IVehicleDataBrokerClient::SetErrorMap_t>>();
+    brokerResult->insertResult({});
+    auto secondBrokerResult =
+        std::make_shared<AsyncResult<IVehicleDataBrokerClient::SetErrorMap_t>>();
+    secondBrokerResult->insertResult({});
+    EXPECT_CALL(*m_mock, setDatapoints(SizeIs(1)))
+        .WillOnce(Return(brokerResult))
+        .WillOnce(Return(secondBrokerResult));
+
+    auto result1 = m_client->setDatapoints(createValues("Batch.Twice.A", 1.0F));
+    auto result2 = m_client->setDatapoints(createValues("Batch.Twice.A", 2.0F));
+    EXPECT_TRUE(result1->await().empty());
+    m_client->flush();
+    EXPECT_TRUE(result2->await().empty());
+}
+
+TEST_F(Test_BatchingBrokerClient, setDatapoints_coalescingSameSignal_latestValueWrittenOnce) {
+    auto client = std::make_shared<BatchingBrokerClient>(
+        m_mock, BatchingConfig{std::chrono::seconds{10}, 0, true});
+    auto brokerResult = std::make_shared<AsyncResult<IVehicleDataBrokerClient::SetErrorMap_t>>();
+    brokerResult->insertResult({{"Batch.Coalesce.A", "out of range"}});
+    EXPECT_CALL(*m_mock, setDatapoints(SizeIs(2)))
+        .WillOnce([brokerResult](const auto& dataPoints) {
+            EXPECT_EQ("Batch.Coalesce.A", dataPoints[0]->getPath());
+            EXPECT_EQ(3.0F,
+                      dynamic_cast<const TypedDataPointValue<float>&>(*dataPoints[0]).value());
+            return brokerResult;
+        });
+
+    auto result1 = client->setDatapoints(createValues("Batch.Coalesce.A", 1.0F));
+    auto result2 = client->setDatapoints(createValues("Batch.Coalesce.B", 2.0F));
+    auto result3 = client->setDatapoints(createValues("Batch.Coalesce.A", 3.0F));
+    client->flush();
+
+    EXPECT_EQ(1, result1->await().count("Batch.Coalesce.A"));
+    EXPECT_TRUE(result2->await().empty());
+    EXPECT_EQ(1, result3->await().count("Batch.Coalesce.A"));
+}
+
+TEST_F(Test_BatchingBrokerClient, setDatapoints_maxBatchSizeReached_issuedWithoutFlush) {
+    auto client = std::make_shared<BatchingBrokerClient>(
+        m_mock, BatchingConfig{std::chrono::seconds{10}, 2, false});
+    auto brokerResult = std::make_shared<AsyncResult<IVehicleDataBrokerClient::SetErrorMap_t>>();
+    brokerResult->insertResult({});
+    EXPECT_CALL(*m_mock, setDatapoints(SizeIs(2))).WillOnce(Return(brokerResult));
+
+    auto result1 = client->setDatapoints(createValues("Batch.Full.A", 1.0F));
+    auto result2 = client->setDatapoints(createValues("Batch.Full.B", 2.0F));
+
+    EXPECT_TRUE(result1->await().empty());
+    EXPECT_TRUE(result2->await().empty());
+}
+
+TEST_F(Test_BatchingBrokerClient, getDatapoints_brokerCallFails_allCallersFail) {
+    auto brokerResult = std::make_shared<AsyncResult<DataPointReply>>();
+    brokerResult->insertError(Status("failed"));
+    EXPECT_CALL(*m_mock, getDatapoints(_)).WillOnce(Return(brokerResult));
+
+    auto result1 = m_client->getDatapoints({"Batch.Fail.A"});
+    auto result2 = m_client->getDatapoints({"Batch.Fail.B"});
+    m_client->flush();
+
+    EXPECT_THROW(result1->await(), AsyncException);
+    EXPECT_THROW(result2->await(), AsyncException);
+}
+
+TEST_F(Test_BatchingBrokerClient, getDatapoints_windowElapsed_issuedWithoutFlush) {
+    auto client = std::make_shared<BatchingBrokerClient>(m_mock, std::chrono::milliseconds{5});
+    auto brokerResult = std::make_shared<AsyncResult<DataPointReply>>();
+    brokerResult->insertResult({});
+    EXPECT_CALL(*m_mock, getDatapoints(UnorderedElementsAre("Batch.Window.A")))
+        .WillOnce(Return(brokerResult));
+
+    auto result = client->getDatapoints({"Batch.Window.A"});
+
+    EXPECT_EQ(0, result->await().size());
+}
+
+TEST(Test_VehicleModelContext, setBatchingWindow_nonZero_batchesClientCalls) {
+    auto mock = std::make_shared<VehicleDataBrokerClientMock>();
+    VehicleModelContext::getInstance().setVdbc(mock);
+
+    VehicleModelContext::getInstance().setBatchingWindow(std::chrono::milliseconds{5});
+    auto batchingClient = std::dynamic_pointer_cast<BatchingBrokerClient>(
+        VehicleModelContext::getInstance().getVdbc());
+    ASSERT_NE(nullptr, batchingClient);
+    EXPECT_EQ(mock, batchingClient->getClient());
+
+    VehicleModelContext::getInstance().setBatchingWindow(std::chrono::milliseconds{0});
+    EXPECT_EQ(mock, VehicleModelContext::getInstance().getVdbc());
+}
@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/vdb/QueryPredicate.h"
+
+#include "sdk/Exceptions.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+using namespace velocitas;
+
+namespace {
+
+const SignalHandle_t SIGNAL_A = SignalPathRegistry::getInstance().intern("Predicate.A");
+const SignalHandle_t SIGNAL_B = SignalPathRegistry::getInstance().intern("Predicate.B");
+
+QueryCondition makeCondition(SignalHandle_t signal, QueryCondition::Operator op,
+                             DataPointSample operand) {
+    return QueryCondition{signal, op, std::move(operand)};
+}
+
+} // namespace
+
+TEST(Test_QueryPredicate, isMet_noConditions_true) {
+    QueryPredicate predicate;
+    EXPECT_TRUE(predicate.empty());
+    EXPECT_TRUE(predicate.isMet());
+}
+
+TEST(Test_QueryPredicate, isMet_noSampleYet_false) {
+    QueryPredicate predicate(
+        {makeCondition(SIGNAL_A, QueryCondition::Operator::GREATER, DataPointSample(10.0F))});
+    EXPECT_FALSE(predicate.isMet());
+}
+
+TEST(Test_QueryPredicate, isMet_operators_comparedToLatestSample) {
+    QueryPredicate greater(
+        {makeCondition(SIGNAL_A, QueryCondition::Operator::GREATER, DataPointSample(10.0F))});
+    QueryPredicate less(
+        {makeCondition(SIGNAL_A, QueryCondition::Operator::LESS, DataPointSample(int32_t{100}))});
+    QueryPredicate equal(
+        {makeCondition(SIGNAL_A, QueryCondition::Operator::EQUAL, DataPointSample(true))});
+
+    greater.update(SIGNAL_A, DataPointSample(10.5F));
+    less.update(SIGNAL_A, DataPointSample(int32_t{100}));
+    equal.update(SIGNAL_A, DataPointSample(true));
+    EXPECT_TRUE(greater.isMet());
+    EXPECT_FALSE(less.isMet());
+    EXPECT_TRUE(equal.isMet());
+
+    greater.update(SIGNAL_A, DataPointSample(10.0F));
+    less.update(SIGNAL_A, DataPointSample(int32_t{-5}));
+    equal.update(SIGNAL_A, DataPointSample(false));
+    EXPECT_FALSE(greater.isMet());
+    EXPECT_TRUE(less.isMet());
+    EXPECT_FALSE(equal.isMet());
+}
+
+TEST(Test_QueryPredicate, isMet_mixedSignedness_comparedByValue) {
+    QueryPredicate predicate(
+        {makeCondition(SIGNAL_A, QueryCondition::Operator::LESS, DataPointSample(uint64_t{1}))});
+
+    predicate.update(SIGNAL_A, DataPointSample(int64_t{-1}));
+    EXPECT_TRUE(predicate.isMet());
+    predicate.update(SIGNAL_A, DataPointSample(std::numeric_limits<int64_t>::max()));
+    EXPECT_FALSE(predicate.isMet());
+    predicate.update(SIGNAL_A, DataPointSample(0.5));
+    EXPECT_TRUE(predicate.isMet());
+}
+
+TEST(Test_QueryPredicate, isMet_invalidOrNanSample_false) {
+    QueryPredicate predicate(
+        {makeCondition(SIGNAL_A, QueryCondition::Operator::LESS, DataPointSample(10.0))});
+
+    predicate.update(SIGNAL_A, DataPointSample(std::nan("")));
+    EXPECT_FALSE(predicate.isMet());
+    predicate.update(SIGNAL_A, DataPointSample(DataPointValue::Type::DOUBLE,
+                                               DataPointValue::Failure::NOT_AVAILABLE));
+    EXPECT_FALSE(predicate.isMet());
+}
+
+TEST(Test_QueryPredicate, isMet_multipleConditions_allNeedToBeMet) {
+    QueryPredicate predicate(
+        {makeCondition(SIGNAL_A, QueryCondition::Operator::GREATER, DataPointSample(int32_t{0})),
+         makeCondition(SIGNAL_A, QueryCondition::Operator::LESS, DataPointSample(int32_t{10})),
+         makeCondition(SIGNAL_B, QueryCondition::Operator::EQUAL, DataPointSample(true))});
+    EXPECT_EQ((std::vector<SignalHandle_t>{SIGNAL_A, SIGNAL_B}), predicate.getSignals());
+    EXPECT_TRUE(predicate.refersTo(SIGNAL_B));
+
+    predicate.update(SIGNAL_A, DataPointSample(int32_t{5}));
+    EXPECT_FALSE(predicate.isMet());
+    predicate.update(SIGNAL_B, DataPointSample(true));
+    EXPECT_TRUE(predicate.isMet());
+    predicate.update(SIGNAL_A, DataPointSample(int32_t{10}));
+    EXPECT_FALSE(predicate.isMet());
+}
+
+TEST(Test_QueryPredicate, ctor_stringOperand_throws) {
+    EXPECT_THROW(QueryPredicate({makeCondition(SIGNAL_A, QueryCondition::Operator::EQUAL,
+                                               DataPointSample(std::string("foo")))}),
+                 InvalidTypeException);
+}
@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#include "sdk/vdb/ShardedBrokerClient.h"
+
+#include "VehicleDataBrokerClientMock.h"
+#include "sdk/DataPointReply.h"
+#include "sdk/Exceptions.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+using ::testing::ElementsAre;
+using ::testing::Return;
+
+namespace {
+
+AsyncResultPtr_t<DataPointReply> createReply(const std::string& path, float value) {
+    DataPointReply reply;
+    reply.set(path, DataPointSample(value));
+    auto result = std::make_shared<AsyncResult<DataPointReply>>();
+    result->insertResult(std::move(reply));
+    return result;
+}
+
+class Test_ShardedBrokerClient : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_body    = std::make_shared<VehicleDataBrokerClientMock>();
+        m_central = std::make_shared<VehicleDataBrokerClientMock>();
+        m_client  = std::make_shared<ShardedBrokerClient>(
+            std::vector<ShardRoute>{{"", m_central}, {"Vehicle.Body", m_body}});
+    }
+
+    std::shared_ptr<VehicleDataBrokerClientMock> m_body;
+    std::shared_ptr<VehicleDataBrokerClientMock> m_central;
+    std::shared_ptr<ShardedBrokerClient>         m_client;
+};
+
+} // namespace
+
+TEST_F(Test_ShardedBrokerClient, findRoute_nestedSubtrees_longestSubtreeWins) {
+    auto vehicle = std::make_shared<VehicleDataBrokerClientMock>();
+    auto body    = std::make_shared<VehicleDataBrokerClientMock>();
+    auto other   = std::make_shared<VehicleDataBrokerClientMock>();
+    ShardedBrokerClient client({{"Vehicle", vehicle}, {"", other}, {"Vehicle.Body", body}});
+
+    EXPECT_EQ(body, client.getRoutes()[*client.findRoute("Vehicle.Body.Lights.IsOn")].m_client);
+    EXPECT_EQ(body, client.getRoutes()[*client.findRoute("Vehicle.Body")].m_client);
+    EXPECT_EQ(vehicle, client.getRoutes()[*client.findRoute("Vehicle.BodyType")].m_client);
+    EXPECT_EQ(other, client.getRoutes()[*client.findRoute("Other.Speed")].m_client);
+
+    ShardedBrokerClient bodyOnly({{"Vehicle.Body", body}});
+    EXPECT_FALSE(bodyOnly.findRoute("Vehicle.Speed").has_value());
+}
+
+TEST_F(Test_ShardedBrokerClient, constructor_invalidRoutes_throw) {
+    EXPECT_THROW(ShardedBrokerClient({}), InvalidValueException);
+    EXPECT_THROW(ShardedBrokerClient({{"Vehicle.Body", nullptr}}), InvalidValueException);
+    EXPECT_THROW(ShardedBrokerClient({{"Vehicle.Body", m_body}, {"Vehicle.Body", m_central}}),
+                 InvalidValueException);
+}
+
+TEST_F(Test_ShardedBrokerClient, getDatapoints_singleRoute_forwarded) {
+    const auto brokerResult = createReply("Vehicle.Body.Horn.IsActive", 1.0F);
+    EXPECT_CALL(*m_body, getDatapoints(ElementsAre("Vehicle.Body.Horn.IsActive")))
+        .WillOnce(Return(brokerResult));
+
+    EXPECT_EQ(brokerResult, m_client->getDatapoints({"Vehicle.Body.Horn.IsActive"}));
+    EXPECT_EQ(0, m_client->getNumSplitRequests());
+}
+
+TEST_F(Test_ShardedBrokerClient, getDatapoints_severalRoutes_splitAndMerged) {
+    EXPECT_CALL(*m_body, getDatapoints(ElementsAre("Vehicle.Body.Horn.IsActive")))
+        .WillOnce(Return(createReply("Vehicle.Body.Horn.IsActive", 1.0F)));
+    EXPECT_CALL(*m_central, getDatapoints(ElementsAre("Vehicle.Speed")))
+        .WillOnce(Return(createReply("Vehicle.Speed", 2.0F)));
+
+    const auto reply =
+        m_client->getDatapoints({"Vehicle.Speed", "Vehicle.Body.Horn.IsActive"})->await();
+
+    ASSERT_EQ(2, reply.size());
+    EXPECT_EQ(1.0F, reply.getSample("Vehicle.Body.Horn.IsActive").get<float>());
+    EXPECT_EQ(2.0F, reply.getSample("Vehicle.Speed").get<float>());
+    EXPECT_EQ(1, m_client->getNumSplitRequests());
+}
+
+TEST_F(Test_ShardedBrokerClient, getDatapoints_unroutedSignal_unknownDatapoint) {
+    ShardedBrokerClient client({{"Vehicle.Body", m_body}});
+    EXPECT_CALL(*m_body, getDatapoints(ElementsAre("Vehicle.Body.Horn.IsActive")))
+        .WillOnce(Return(createReply("Vehicle.Body.Horn.IsActive", 1.0F)));
+
+    const auto reply =
+        client.getDatapoints({"Vehicle.Body.Horn.IsActive", "Vehicle.Speed"})->await();
+
+    EXPECT_EQ(1.0F, reply.getSample("Vehicle.Body.Horn.IsActive").get<float>());
+    EXPECT_EQ(DataPointValue::Failure::UNKNOWN_DATAPOINT,
+              reply.getSample("Vehicle.Speed").getFailure());
+}
+
+TEST_F(Test_ShardedBrokerClient, setDatapoints_severalRoutes_errorsMerged) {
+    auto bodyResult = std::make_shared<AsyncResult<IVehicleDataBrokerClient::SetErrorMap_t>>();
+    bodyResult->insertResult({{"Vehicle.Body.Horn.IsActive", "access denied"}});
+    auto centralResult = std::make_shared<AsyncResult<IVehicleDataBrokerClient::SetErrorMap_t>>();
+    centralResult->insertResult({});
+    EXPECT_CALL(*m_body, setDatapoints(testing::SizeIs(1))).WillOnce(Return(bodyResult));
+    EXPECT_CALL(*m_central, setDatapoints(testing::SizeIs(1))).WillOnce(Return(centralResult));
+
+    std::vector<std::unique_ptr<DataPointValue>> values;
+    values.push_back(
+        std::make_unique<TypedDataPointValue<bool>>("Vehicle.Body.Horn.IsActive", true));
+    values.push_back(std::make_unique<TypedDataPointValue<float>>("Vehicle.Speed", 1.0F));
+    const auto errors = m_client->setDatapoints(values)->await();
+
+    ASSERT_EQ(1, errors.size());
+    EXPECT_EQ("access denied", errors.at("Vehicle.Body.Horn.IsActive"));
+}
+
+TEST_F(Test_ShardedBrokerClient, subscribe_severalRoutes_updatesMergedIntoFullState) {
+    auto bodyPart    = std::make_shared<AsyncSubscription<DataPointReply>>();
+    auto centralPart = std::make_shared<AsyncSubscription<DataPointReply>>();
+    EXPECT_CALL(*m_body, subscribe("SELECT Vehicle.Body.Horn.IsActive")).WillOnce(Return(bodyPart));
+    EXPECT_CALL(*m_central, subscribe("SELECT Vehicle.Speed")).WillOnce(Return(centralPart));
+
+    auto subscription =
+        m_client->subscribe("SELECT Vehicle.Speed, Vehicle.Body.Horn.IsActive");
+    DataPointReply speed;
+    speed.set("Vehicle.Speed", DataPointSample(50.0F));
+    centralPart->insertNewItem(std::move(speed));
+    DataPointReply horn;
+    horn.set("Vehicle.Body.Horn.IsActive", DataPointSample(true));
+    bodyPart->insertNewItem(std::move(horn));
+
+    ASSERT_EQ(1, subscription->nextFor(std::chrono::seconds(1))->size());
+    const auto update = subscription->nextFor(std::chrono::seconds(1));
+    ASSERT_TRUE(update.has_value());
+    ASSERT_EQ(2, update->size());
+    EXPECT_EQ(50.0F, update->getSample("Vehicle.Speed").get<float>());
+    EXPECT_TRUE(update->getSample("Vehicle.Body.Horn.IsActive").get<bool>());
+
+    subscription->cancel();
+    DataPointReply later;
+    later.set("Vehicle.Speed", DataPointSample(60.0F));
+    centralPart->insertNewItem(std::move(later));
+    EXPECT_TRUE(centralPart->isCancelled());
+}
+
+TEST_F(Test_ShardedBrokerClient, subscribe_unroutedSignal_throws) {
+    ShardedBrokerClient client({{"Vehicle.Body", m_body}});
+
+    EXPECT_THROW(client.subscribe("SELECT Vehicle.Speed"), InvalidValueException);
+    EXPECT_THROW(client.subscribe("SELECT Vehicle.Body.Horn.IsActive WHERE Vehicle.Speed > 2"),
+                 InvalidValueException);
+}
@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/SharedStateTable.h"
+
+#include "sdk/DataPointReply.h"
+#include "sdk/Exceptions.h"
+#include "sdk/SignalPathRegistry.h"
+#include "sdk/vdb/IVehicleDataBrokerClient.h"
+#include "sdk/vdb/SharedStatePublisher.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+const std::string SPEED = "Vehicle.Test.SharedState.Speed";       // NOLINT(runtime/string)
+const std::string GEAR  = "Vehicle.Test.SharedState.Gear";        // NOLINT(runtime/string)
+const std::string OTHER = "Vehicle.Test.SharedState.Unpublished"; // NOLINT(runtime/string)
+
+DataPointReply replyOf(const std::string& path, DataPointSample sample) {
+    DataPointReply reply;
+    reply.set(SignalPathRegistry::getInstance().intern(path), std::move(sample));
+    return reply;
+}
+
+} // namespace
+
+class Test_SharedState : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_tableName = std::string("/sdv_shared_state_") +
+                      ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    }
+
+    [[nodiscard]] const std::string& tableName() const { return m_tableName; }
+
+private:
+    std::string m_tableName;
+};
+
+TEST_F(Test_SharedState, open_createdTable_sameSignalsAndSlots) {
+    auto table  = SharedStateTable::create(tableName(), {SPEED, GEAR});
+    auto reader = SharedStateTable::open(tableName());
+    ASSERT_EQ(2, reader->getNumSignals());
+    EXPECT_EQ(GEAR, reader->getPath(1));
+    const auto index = reader->findIndex(SignalPathRegistry::getInstance().intern(GEAR));
+    ASSERT_TRUE(index.has_value());
+    EXPECT_EQ(1, *index);
+    EXPECT_FALSE(reader->findIndex(SignalPathRegistry::getInstance().intern(OTHER)).has_value());
+
+    table->getSlot(1).write(DataPointSample(int32_t{3}, Timestamp{}), SampleSlot::Clock_t::now());
+    EXPECT_EQ(3, reader->getSlot(1).read().sample.get<int32_t>());
+    EXPECT_FALSE(reader->isClosed());
+
+    table.reset();
+    EXPECT_TRUE(reader->isClosed());
+    EXPECT_THROW(SharedStateTable::open(tableName()), std::runtime_error);
+}
+
+TEST_F(Test_SharedState, create_tooLongPath_throws) {
+    EXPECT_THROW(SharedStateTable::create(tableName(), {std::string(300, 'x')}),
+                 InvalidValueException);
+}
+
+TEST_F(Test_SharedState, waitForChange_notifiedByOtherThread_returnsBeforeTimeout) {
+    auto       table       = SharedStateTable::create(tableName(), {SPEED});
+    auto       reader      = SharedStateTable::open(tableName());
+    const auto changeCount = reader->getChangeCount();
+
+    std::thread notifier([&table]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        table->notifyChange();
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    while (reader->getChangeCount() == changeCount) {
+        reader->waitForChange(changeCount, std::chrono::seconds(5));
+    }
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+    notifier.join();
+}
+
+TEST_F(Test_SharedState, getDatapoints_publishedSignals_servedFromTable) {
+    SharedStatePublisher publisher(tableName(), {SPEED, GEAR});
+    publisher.publish(replyOf(SPEED, DataPointSample(42.0F, Timestamp{7, 0})));
+    publisher.publish(replyOf(OTHER, DataPointSample(1.0F, Timestamp{})));
+    EXPECT_EQ(1, publisher.getNumPublishedUpdates());
+
+    auto client = IVehicleDataBrokerClient::createSharedState(tableName());
+    auto reply  = client->getDatapoints({SPEED, GEAR, OTHER})->await();
+    EXPECT_FLOAT_EQ(42.0F, reply.getSample(SPEED).get<float>());
+    EXPECT_EQ(7, reply.getSample(SPEED).getTimestamp().seconds);
+    EXPECT_EQ(DataPointValue::Failure::NOT_AVAILABLE, reply.getSample(GEAR).getFailure());
+    EXPECT_EQ(DataPointValue::Failure::UNKNOWN_DATAPOINT, reply.getSample(OTHER).getFailure());
+}
+
+TEST_F(Test_SharedState, getDatapoints_slotAbandonedByPublisher_notAvailable) {
+    auto table = SharedStateTable::create(tableName(), {SPEED, GEAR});
+    table->getSlot(0).write(DataPointSample(1.0F, Timestamp{}), SampleSlot::Clock_t::now());
+    table->getSlot(1).write(DataPointSample(int32_t{4}, Timestamp{}), SampleSlot::Clock_t::now());
+    // a publisher dying in the middle of a write leaves the slot locked
+    reinterpret_cast<std::atomic<uint64_t>*>(&table->getSlot(0))->fetch_add(1);
+
+    auto reader = SharedStateTable::open(tableName());
+    EXPECT_FALSE(reader->readSlot(0).has_value());
+    EXPECT_TRUE(reader->readSlot(1).has_value());
+
+    auto client = IVehicleDataBrokerClient::createSharedState(tableName());
+    auto reply  = client->getDatapoints({SPEED, GEAR})->await();
+    EXPECT_EQ(DataPointValue::Failure::NOT_AVAILABLE, reply.getSample(SPEED).getFailure());
+    EXPECT_EQ(4, reply.getSample(GEAR).get<int32_t>());
+}
+
+TEST_F(Test_SharedState, subscribe_publishedUpdates_deliveredAsChanges) {
+    SharedStatePublisher publisher(tableName(), {SPEED, GEAR});
+    publisher.publish(replyOf(SPEED, DataPointSample(1.0F, Timestamp{})));
+
+    SubscriptionOptions options;
+    options.m_mode    = SubscriptionMode::DELTA_ONLY;
+    auto client       = IVehicleDataBrokerClient::createSharedState(tableName());
+    auto subscription = client->subscribe("SELECT " + SPEED + ", " + GEAR, options);
+    auto update       = subscription->nextFor(std::chrono::seconds(5));
+    ASSERT_TRUE(update.has_value());
+    EXPECT_FLOAT_EQ(1.0F, update->getSample(SPEED).get<float>());
+
+    publisher.publish(replyOf(GEAR, DataPointSample(int32_t{2}, Timestamp{})));
+    update = subscription->nextFor(std::chrono::seconds(5));
+    ASSERT_TRUE(update.has_value());
+    EXPECT_EQ(1, update->size());
+    EXPECT_EQ(2, update->getSample(GEAR).get<int32_t>());
+    EXPECT_EQ(2, subscription->getSnapshot()->size());
+}
+
+TEST_F(Test_SharedState, subscribe_publisherStartedLater_updatesDeliveredOnceCreated) {
+    auto client       = IVehicleDataBrokerClient::createSharedState(tableName());
+    auto subscription = client->subscribe("SELECT " + SPEED);
+
+    SharedStatePublisher publisher(tableName(), {SPEED});
+    publisher.publish(replyOf(SPEED, DataPointSample(5.0F, Timestamp{})));
+    const auto update = subscription->nextFor(std::chrono::seconds(5));
+    ASSERT_TRUE(update.has_value());
+    EXPECT_FLOAT_EQ(5.0F, update->getSample(SPEED).get<float>());
+}
+
+TEST_F(Test_SharedState, setDatapoints_noFallback_errorPerDataPoint) {
+    SharedStatePublisher publisher(tableName(), {SPEED});
+    auto                 client = IVehicleDataBrokerClient::createSharedState(tableName());
+
+    std::vector<std::unique_ptr<DataPointValue>> values;
+    values.push_back(std::make_unique<TypedDataPointValue<float>>(SPEED, 1.0F));
+    const auto errors = client->setDatapoints(values)->await();
+    EXPECT_EQ(1, errors.count(SPEED));
+}
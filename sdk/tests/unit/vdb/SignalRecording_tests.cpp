@@ -0,0 +1,192 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/SignalRecording.h"
+
+#include "sdk/DataPointReply.h"
+#include "sdk/SignalPathRegistry.h"
+#include "sdk/vdb/IVehicleDataBrokerClient.h"
+#include "sdk/vdb/SignalRecorder.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+const Timestamp TIMESTAMP{1234, 5678};
+
+SignalHandle_t handleOf(const std::string& path) {
+    return SignalPathRegistry::getInstance().intern(path);
+}
+
+DataPointReply replyOf(const std::string& path, DataPointSample sample) {
+    DataPointReply reply;
+    reply.set(handleOf(path), std::move(sample));
+    return reply;
+}
+
+} // namespace
+
+class Test_SignalRecording : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_path = std::filesystem::temp_directory_path() /
+                 (std::string("signal_recording_") +
+                  ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove(m_path);
+    }
+
+    void TearDown() override { std::filesystem::remove(m_path); }
+
+    [[nodiscard]] std::string path() const { return m_path.string(); }
+
+private:
+    std::filesystem::path m_path;
+};
+
+TEST_F(Test_SignalRecording, next_recordedUpdates_sameSamplesInOrder) {
+    DataPointReply first;
+    first.set(handleOf("Vehicle.Test.Bool"), DataPointSample(true, TIMESTAMP));
+    first.set(handleOf("Vehicle.Test.Int8"), DataPointSample(int8_t{-8}, TIMESTAMP));
+    first.set(handleOf("Vehicle.Test.Uint64"), DataPointSample(uint64_t{1} << 60, TIMESTAMP));
+    first.set(handleOf("Vehicle.Test.Double"), DataPointSample(2.5, TIMESTAMP));
+    first.set(handleOf("Vehicle.Test.String"), DataPointSample(std::string("text"), TIMESTAMP));
+    DataPointReply second;
+    second.set(handleOf("Vehicle.Test.BoolArray"),
+               DataPointSample(std::vector<bool>{true, false, true}, TIMESTAMP));
+    second.set(handleOf("Vehicle.Test.FloatArray"),
+               DataPointSample(std::vector<float>{1.5F, -2.0F}, TIMESTAMP));
+    second.set(handleOf("Vehicle.Test.StringArray"),
+               DataPointSample(std::vector<std::string>{"a", "", "bc"}, TIMESTAMP));
+    second.set(handleOf("Vehicle.Test.Int8"),
+               DataPointSample(DataPointValue::Type::INT8, DataPointValue::Failure::NOT_AVAILABLE,
+                               TIMESTAMP));
+    {
+        SignalRecorder recorder(path());
+        recorder.record(first);
+        recorder.record(second);
+        EXPECT_EQ(2, recorder.getNumRecordedUpdates());
+    }
+
+    SignalRecordingReader reader(path());
+    auto                  update = reader.next();
+    ASSERT_TRUE(update.has_value());
+    EXPECT_EQ(5, update->m_dataPoints.size());
+    EXPECT_TRUE(update->m_dataPoints.getSample("Vehicle.Test.Bool").get<bool>());
+    EXPECT_EQ(-8, update->m_dataPoints.getSample("Vehicle.Test.Int8").get<int8_t>());
+    EXPECT_EQ(uint64_t{1} << 60,
+              update->m_dataPoints.getSample("Vehicle.Test.Uint64").get<uint64_t>());
+    EXPECT_DOUBLE_EQ(2.5, update->m_dataPoints.getSample("Vehicle.Test.Double").get<double>());
+    const auto text = update->m_dataPoints.getSample("Vehicle.Test.String");
+    EXPECT_EQ("text", text.get<std::string>());
+    EXPECT_EQ(TIMESTAMP.seconds, text.getTimestamp().seconds);
+    EXPECT_EQ(TIMESTAMP.nanos, text.getTimestamp().nanos);
+
+    const auto firstOffset = update->m_offset;
+    update                 = reader.next();
+    ASSERT_TRUE(update.has_value());
+    EXPECT_GE(update->m_offset, firstOffset);
+    EXPECT_EQ((std::vector<bool>{true, false, true}),
+              update->m_dataPoints.getSample("Vehicle.Test.BoolArray").get<std::vector<bool>>());
+    EXPECT_EQ((std::vector<float>{1.5F, -2.0F}),
+              update->m_dataPoints.getSample("Vehicle.Test.FloatArray").get<std::vector<float>>());
+    EXPECT_EQ((std::vector<std::string>{"a", "", "bc"}),
+              update->m_dataPoints.getSample("Vehicle.Test.StringArray")
+                  .get<std::vector<std::string>>());
+    const auto failure = update->m_dataPoints.getSample("Vehicle.Test.Int8");
+    EXPECT_FALSE(failure.isValid());
+    EXPECT_EQ(DataPointValue::Failure::NOT_AVAILABLE, failure.getFailure());
+    EXPECT_EQ(DataPointValue::Type::INT8, failure.getType());
+
+    EXPECT_FALSE(reader.next().has_value());
+    reader.rewind();
+    EXPECT_TRUE(reader.next().has_value());
+}
+
+TEST_F(Test_SignalRecording, next_wantedSignals_onlyUpdatesOfWantedSignals) {
+    {
+        SignalRecorder recorder(path());
+        recorder.record(replyOf("Vehicle.Test.Speed", DataPointSample(1.0F, TIMESTAMP)));
+        recorder.record(replyOf("Vehicle.Test.Other", DataPointSample(2.0F, TIMESTAMP)));
+        recorder.record(replyOf("Vehicle.Test.Speed", DataPointSample(3.0F, TIMESTAMP)));
+    }
+    const auto        speed = handleOf("Vehicle.Test.Speed");
+    std::vector<bool> wantedSignals(speed + 1, false);
+    wantedSignals[speed] = true;
+
+    SignalRecordingReader reader(path());
+    auto                  update = reader.next(&wantedSignals);
+    ASSERT_TRUE(update.has_value());
+    EXPECT_FLOAT_EQ(1.0F, update->m_dataPoints.getSample(speed).get<float>());
+    update = reader.next(&wantedSignals);
+    ASSERT_TRUE(update.has_value());
+    EXPECT_EQ(1, update->m_dataPoints.size());
+    EXPECT_FLOAT_EQ(3.0F, update->m_dataPoints.getSample(speed).get<float>());
+    EXPECT_FALSE(reader.next(&wantedSignals).has_value());
+}
+
+TEST_F(Test_SignalRecording, next_truncatedLastRecord_endsBeforeIt) {
+    {
+        SignalRecorder recorder(path());
+        recorder.record(replyOf("Vehicle.Test.Speed", DataPointSample(1.0F, TIMESTAMP)));
+        recorder.record(replyOf("Vehicle.Test.Speed", DataPointSample(2.0F, TIMESTAMP)));
+    }
+    std::filesystem::resize_file(path(), std::filesystem::file_size(path()) - 3);
+
+    SignalRecordingReader reader(path());
+    auto                  update = reader.next();
+    ASSERT_TRUE(update.has_value());
+    EXPECT_FLOAT_EQ(1.0F, update->m_dataPoints.getSample("Vehicle.Test.Speed").get<float>());
+    EXPECT_FALSE(reader.next().has_value());
+}
+
+TEST_F(Test_SignalRecording, ctor_noRecording_throws) {
+    EXPECT_THROW(SignalRecordingReader{path()}, std::runtime_error);
+    {
+        std::FILE* file = std::fopen(path().c_str(), "wb");
+        std::fputs("no recording at all", file);
+        std::fclose(file);
+    }
+    EXPECT_THROW(SignalRecordingReader{path()}, std::runtime_error);
+}
+
+TEST_F(Test_SignalRecording, createReplay_subscription_recordedUpdatesOfItsSignals) {
+    {
+        SignalRecorder recorder(path());
+        recorder.record(replyOf("Vehicle.Test.Speed", DataPointSample(1.0F, TIMESTAMP)));
+        recorder.record(replyOf("Vehicle.Test.Other", DataPointSample(2.0F, TIMESTAMP)));
+        recorder.record(replyOf("Vehicle.Test.Speed", DataPointSample(3.0F, TIMESTAMP)));
+    }
+    ReplayConfig config;
+    config.m_speed      = 0.0;
+    config.m_startDelay = std::chrono::milliseconds(0);
+    auto client         = IVehicleDataBrokerClient::createReplay(path(), config);
+
+    auto subscription = client->subscribe("SELECT Vehicle.Test.Speed");
+    auto update       = subscription->nextFor(std::chrono::seconds(5));
+    ASSERT_TRUE(update.has_value());
+    EXPECT_FLOAT_EQ(1.0F, update->getSample("Vehicle.Test.Speed").get<float>());
+    update = subscription->nextFor(std::chrono::seconds(5));
+    ASSERT_TRUE(update.has_value());
+    EXPECT_FLOAT_EQ(3.0F, update->getSample("Vehicle.Test.Speed").get<float>());
+}
@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/vdb/SignalUpdateFilter.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+class Test_SignalUpdateFilter : public ::testing::Test {
+protected:
+    bool accept(const DataPointSample& sample, std::chrono::milliseconds receivedAfterStart) {
+        return m_filter.accept(m_options, sample, m_start + receivedAfterStart);
+    }
+
+    SubscriptionOptions                     m_options;
+    SignalUpdateFilter                      m_filter;
+    SignalUpdateFilter::Clock_t::time_point m_start{SignalUpdateFilter::Clock_t::now()};
+};
+
+} // namespace
+
+TEST_F(Test_SignalUpdateFilter, isFiltering_defaultOptions_false) {
+    EXPECT_FALSE(SignalUpdateFilter::isFiltering(SubscriptionOptions{}));
+    EXPECT_FALSE(
+        SignalUpdateFilter::isFiltering(SubscriptionOptions{SubscriptionMode::DELTA_ONLY}));
+}
+
+TEST_F(Test_SignalUpdateFilter, accept_withinMinInterval_dropped) {
+    m_options.m_minInterval = std::chrono::milliseconds{100};
+
+    EXPECT_TRUE(accept(DataPointSample(1), std::chrono::milliseconds{0}));
+    EXPECT_FALSE(accept(DataPointSample(2), std::chrono::milliseconds{50}));
+    EXPECT_TRUE(accept(DataPointSample(3), std::chrono::milliseconds{100}));
+    EXPECT_FALSE(accept(DataPointSample(4), std::chrono::milliseconds{150}));
+}
+
+TEST_F(Test_SignalUpdateFilter, accept_aboveMaxRate_dropped) {
+    m_options.m_maxRate = 10.0;
+
+    EXPECT_TRUE(accept(DataPointSample(1.0), std::chrono::milliseconds{0}));
+    EXPECT_FALSE(accept(DataPointSample(2.0), std::chrono::milliseconds{99}));
+    EXPECT_TRUE(accept(DataPointSample(3.0), std::chrono::milliseconds{100}));
+}
+
+TEST_F(Test_SignalUpdateFilter, accept_withinAbsoluteDeadband_droppedUntilDeviationExceedsIt) {
+    m_options.m_absoluteDeadband = 1.0;
+
+    EXPECT_TRUE(accept(DataPointSample(10.0F), std::chrono::milliseconds{0}));
+    EXPECT_FALSE(accept(DataPointSample(10.5F), std::chrono::milliseconds{1}));
+    EXPECT_FALSE(accept(DataPointSample(11.0F), std::chrono::milliseconds{2}));
+    EXPECT_TRUE(accept(DataPointSample(11.5F), std::chrono::milliseconds{3}));
+    EXPECT_FALSE(accept(DataPointSample(10.6F), std::chrono::milliseconds{4}));
+}
+
+TEST_F(Test_SignalUpdateFilter, accept_withinRelativeDeadband_dropped) {
+    m_options.m_relativeDeadband = 0.1;
+
+    EXPECT_TRUE(accept(DataPointSample(int64_t{-100}), std::chrono::milliseconds{0}));
+    EXPECT_FALSE(accept(DataPointSample(int64_t{-91}), std::chrono::milliseconds{1}));
+    EXPECT_TRUE(accept(DataPointSample(int64_t{-89}), std::chrono::milliseconds{2}));
+}
+
+TEST_F(Test_SignalUpdateFilter, accept_nonNumericValueWithDeadband_delivered) {
+    m_options.m_absoluteDeadband = 1.0;
+
+    EXPECT_TRUE(accept(DataPointSample(std::string{"a"}), std::chrono::milliseconds{0}));
+    EXPECT_TRUE(accept(DataPointSample(std::string{"b"}), std::chrono::milliseconds{1}));
+    EXPECT_TRUE(accept(DataPointSample(true), std::chrono::milliseconds{2}));
+}
+
+TEST_F(Test_SignalUpdateFilter, accept_changeOfValidity_alwaysDelivered) {
+    m_options.m_minInterval      = std::chrono::milliseconds{100};
+    m_options.m_absoluteDeadband = 1.0;
+
+    EXPECT_TRUE(accept(DataPointSample(1.0), std::chrono::milliseconds{0}));
+    EXPECT_TRUE(accept(DataPointSample(DataPointValue::Type::DOUBLE,
+                                       DataPointValue::Failure::NOT_AVAILABLE),
+                       std::chrono::milliseconds{1}));
+    EXPECT_TRUE(accept(DataPointSample(1.0), std::chrono::milliseconds{2}));
+    EXPECT_FALSE(accept(DataPointSample(5.0), std::chrono::milliseconds{3}));
+}
+
+TEST_F(Test_SignalUpdateFilter, accept_distinctUntilChangedSameValue_dropped) {
+    m_options.m_distinctUntilChanged = true;
+    EXPECT_TRUE(SignalUpdateFilter::isFiltering(m_options));
+
+    EXPECT_TRUE(accept(DataPointSample(1.5F), std::chrono::milliseconds{0}));
+    EXPECT_FALSE(accept(DataPointSample(1.5F), std::chrono::milliseconds{1}));
+    EXPECT_TRUE(accept(DataPointSample(2.5F), std::chrono::milliseconds{2}));
+    EXPECT_TRUE(accept(DataPointSample(1.5F), std::chrono::milliseconds{3}));
+}
+
+TEST_F(Test_SignalUpdateFilter, accept_distinctUntilChangedArraysAndStrings_comparedByValue) {
+    m_options.m_distinctUntilChanged = true;
+
+    EXPECT_TRUE(accept(DataPointSample(std::vector<int32_t>{1, 2}), std::chrono::milliseconds{0}));
+    EXPECT_FALSE(accept(DataPointSample(std::vector<int32_t>{1, 2}), std::chrono::milliseconds{1}));
+    EXPECT_TRUE(accept(DataPointSample(std::vector<int32_t>{1, 3}), std::chrono::milliseconds{2}));
+    EXPECT_TRUE(accept(DataPointSample(std::string{"a"}), std::chrono::milliseconds{3}));
+    EXPECT_FALSE(accept(DataPointSample(std::string{"a"}), std::chrono::milliseconds{4}));
+}
+
+TEST_F(Test_SignalUpdateFilter, accept_distinctUntilChangedSameFailure_dropped) {
+    m_options.m_distinctUntilChanged = true;
+    const DataPointSample notAvailable(DataPointValue::Type::DOUBLE,
+                                       DataPointValue::Failure::NOT_AVAILABLE);
+
+    EXPECT_TRUE(accept(notAvailable, std::chrono::milliseconds{0}));
+    EXPECT_FALSE(accept(notAvailable, std::chrono::milliseconds{1}));
+    EXPECT_TRUE(accept(DataPointSample(1.0), std::chrono::milliseconds{2}));
+    EXPECT_TRUE(accept(notAvailable, std::chrono::milliseconds{3}));
+}
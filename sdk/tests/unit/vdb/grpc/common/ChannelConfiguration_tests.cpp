@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/vdb/grpc/common/ChannelConfiguration.h"
+
+#include <gtest/gtest.h>
+#include <grpc/grpc.h>
+#include <grpcpp/support/channel_arguments.h>
+
+#include <cstring>
+#include <optional>
+
+using namespace velocitas;
+
+namespace {
+
+std::optional<int> getIntArgument(const grpc::ChannelArguments& args, const char* name) {
+    const auto cArgs = args.c_channel_args();
+    for (size_t i = 0; i < cArgs.num_args; ++i) {
+        if (std::strcmp(cArgs.args[i].key, name) == 0) {
+            return cArgs.args[i].value.integer;
+        }
+    }
+    return std::nullopt;
+}
+
+} // namespace
+
+TEST(Test_ChannelConfiguration, applyTransportDefaults_unixDomainSocket_addsDefaults) {
+    grpc::ChannelArguments args;
+
+    applyTransportDefaults("unix:///run/databroker.sock", args);
+
+    EXPECT_EQ(100, getIntArgument(args, GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS));
+    EXPECT_EQ(1000, getIntArgument(args, GRPC_ARG_MAX_RECONNECT_BACKOFF_MS));
+    EXPECT_EQ(0, getIntArgument(args, GRPC_ARG_HTTP2_BDP_PROBE));
+}
+
+TEST(Test_ChannelConfiguration, applyTransportDefaults_configuredArgument_keepsIt) {
+    grpc::ChannelArguments args;
+    args.SetInt(GRPC_ARG_MAX_RECONNECT_BACKOFF_MS, 5000);
+
+    applyTransportDefaults("unix-abstract:databroker", args);
+
+    EXPECT_EQ(5000, getIntArgument(args, GRPC_ARG_MAX_RECONNECT_BACKOFF_MS));
+    EXPECT_EQ(0, getIntArgument(args, GRPC_ARG_HTTP2_BDP_PROBE));
+}
+
+TEST(Test_ChannelConfiguration, applyTransportDefaults_tcpAddress_addsNothing) {
+    grpc::ChannelArguments args;
+    const auto             numArgs = args.c_channel_args().num_args;
+
+    applyTransportDefaults("localhost:55555", args);
+
+    EXPECT_EQ(numArgs, args.c_channel_args().num_args);
+}
+
+TEST(Test_ChannelConfiguration, getMaxMessageSize_noLimitsConfigured_returnsDefault) {
+    grpc::ChannelArguments args;
+    args.SetInt(GRPC_ARG_MAX_SEND_MESSAGE_LENGTH, -1);
+
+    EXPECT_EQ(DEFAULT_MAX_MESSAGE_SIZE, getMaxMessageSize(args));
+}
+
+TEST(Test_ChannelConfiguration, getMaxMessageSize_limitsConfigured_returnsSmallerOne) {
+    grpc::ChannelArguments args;
+    args.SetInt(GRPC_ARG_MAX_SEND_MESSAGE_LENGTH, 1024);
+    args.SetInt(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH, 16 * 1024 * 1024);
+
+    EXPECT_EQ(1024, getMaxMessageSize(args));
+}
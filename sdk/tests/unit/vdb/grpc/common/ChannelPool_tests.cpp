@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/vdb/grpc/common/ChannelPool.h"
+
+#include <gtest/gtest.h>
+#include <grpcpp/channel.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+std::shared_ptr<ChannelPool> createPool(size_t numChannels, ChannelSelection selection,
+                                        size_t numEndpoints = 1) {
+    std::vector<std::shared_ptr<grpc::Channel>> channels;
+    for (size_t i = 0; i < numChannels; ++i) {
+        channels.push_back(
+            grpc::CreateChannel("localhost:55555", grpc::InsecureChannelCredentials()));
+    }
+    return ChannelPool::create(std::move(channels), selection, DEFAULT_MAX_MESSAGE_SIZE,
+                               numEndpoints);
+}
+
+} // namespace
+
+TEST(Test_ChannelPool, create_noChannels_throws) {
+    EXPECT_THROW(ChannelPool::create({}, ChannelSelection::ROUND_ROBIN), std::invalid_argument);
+}
+
+TEST(Test_ChannelPool, getShared_sameAddressAndConfig_returnsSamePool) {
+    const ChannelPoolConfig config{2, ChannelSelection::ROUND_ROBIN};
+
+    auto pool  = ChannelPool::getShared("localhost:55555", config);
+    auto other = ChannelPool::getShared("localhost:55555", config);
+
+    EXPECT_EQ(pool, other);
+    EXPECT_EQ(2, pool->getSize());
+    EXPECT_NE(pool->getChannel(0), pool->getChannel(1));
+}
+
+TEST(Test_ChannelPool, getShared_differentAddressOrConfig_returnsDifferentPools) {
+    auto pool = ChannelPool::getShared("localhost:55555", {1, ChannelSelection::ROUND_ROBIN});
+
+    EXPECT_NE(pool, ChannelPool::getShared("localhost:55556", {1, ChannelSelection::ROUND_ROBIN}));
+    EXPECT_NE(pool, ChannelPool::getShared("localhost:55555", {2, ChannelSelection::ROUND_ROBIN}));
+    EXPECT_NE(pool,
+              ChannelPool::getShared("localhost:55555", {1, ChannelSelection::LEAST_LOADED}));
+}
+
+TEST(Test_ChannelPool, getShared_poolReleasedByAllClients_createsNewPool) {
+    const ChannelPoolConfig config{1, ChannelSelection::ROUND_ROBIN};
+
+    std::weak_ptr<ChannelPool> released = ChannelPool::getShared("localhost:55557", config);
+    ASSERT_TRUE(released.expired());
+
+    EXPECT_NE(nullptr, ChannelPool::getShared("localhost:55557", config));
+}
+
+TEST(Test_ChannelPool, acquire_roundRobin_cyclesThroughChannels) {
+    auto pool = createPool(3, ChannelSelection::ROUND_ROBIN);
+
+    std::vector<size_t> indices;
+    for (int i = 0; i < 6; ++i) {
+        indices.push_back(pool->acquire()->getIndex());
+    }
+
+    EXPECT_EQ((std::vector<size_t>{0, 1, 2, 0, 1, 2}), indices);
+}
+
+TEST(Test_ChannelPool, acquire_leastLoaded_selectsChannelWithFewestLeases) {
+    auto pool = createPool(3, ChannelSelection::LEAST_LOADED);
+
+    auto first  = pool->acquire();
+    auto second = pool->acquire();
+    auto third  = pool->acquire();
+    EXPECT_EQ(0, first->getIndex());
+    EXPECT_EQ(1, second->getIndex());
+    EXPECT_EQ(2, third->getIndex());
+
+    second.reset();
+    auto fourth = pool->acquire();
+    EXPECT_EQ(1, fourth->getIndex());
+}
+
+TEST(Test_ChannelPool, lease_destroyed_releasesLoad) {
+    auto pool = createPool(1, ChannelSelection::ROUND_ROBIN);
+
+    auto lease = pool->acquire();
+    EXPECT_EQ(1, pool->getLoad(0));
+
+    lease.reset();
+    EXPECT_EQ(0, pool->getLoad(0));
+}
+
+TEST(Test_ChannelPool, lease_outlivesPool_keepsPoolAlive) {
+    auto                       pool = createPool(1, ChannelSelection::ROUND_ROBIN);
+    std::weak_ptr<ChannelPool> weakPool{pool};
+
+    auto lease = pool->acquire();
+    pool.reset();
+    EXPECT_FALSE(weakPool.expired());
+
+    lease.reset();
+    EXPECT_TRUE(weakPool.expired());
+}
+
+TEST(Test_ChannelPool, create_channelsNotSplitEvenlyAmongEndpoints_throws) {
+    EXPECT_THROW(createPool(3, ChannelSelection::ROUND_ROBIN, 2), std::invalid_argument);
+}
+
+TEST(Test_ChannelPool, getShared_addressList_channelsPerEndpoint) {
+    auto pool = ChannelPool::getShared("localhost:55558,localhost:55559",
+                                       {2, ChannelSelection::ROUND_ROBIN});
+
+    EXPECT_EQ(2, pool->getNumEndpoints());
+    EXPECT_EQ(4, pool->getSize());
+    EXPECT_EQ(0, pool->getActiveEndpoint());
+}
+
+TEST(Test_ChannelPool, acquire_severalEndpoints_channelsOfActiveEndpointOnly) {
+    auto pool = createPool(4, ChannelSelection::LEAST_LOADED, 2);
+
+    auto first  = pool->acquire();
+    auto second = pool->acquire();
+    auto third  = pool->acquire();
+
+    EXPECT_EQ(0, first->getIndex());
+    EXPECT_EQ(1, second->getIndex());
+    EXPECT_GT(2, third->getIndex());
+    EXPECT_EQ(pool->getChannel(0), pool->getPrimaryChannel());
+}
+
+TEST(Test_ChannelPool, reportUnavailable_channelNotConnected_failsOverOnce) {
+    auto pool = createPool(4, ChannelSelection::ROUND_ROBIN, 2);
+
+    pool->acquire()->reportUnavailable();
+    EXPECT_EQ(1, pool->getActiveEndpoint());
+    EXPECT_EQ(pool->getChannel(2), pool->getPrimaryChannel());
+    EXPECT_LE(2, pool->acquire()->getIndex());
+
+    // calls failed on the previous endpoint do not fail over again
+    pool->reportUnavailable(1);
+    EXPECT_EQ(1, pool->getActiveEndpoint());
+
+    pool->reportUnavailable(3);
+    EXPECT_EQ(0, pool->getActiveEndpoint());
+}
+
+TEST(Test_ChannelPool, reportUnavailable_singleEndpoint_keepsEndpoint) {
+    auto pool = createPool(2, ChannelSelection::ROUND_ROBIN);
+
+    pool->reportUnavailable(0);
+
+    EXPECT_EQ(0, pool->getActiveEndpoint());
+}
+
+TEST(Test_ChannelPool, acquireAlternative_singleEndpoint_otherChannel) {
+    auto pool = createPool(3, ChannelSelection::ROUND_ROBIN);
+
+    for (int i = 0; i < 6; ++i) {
+        EXPECT_NE(1, pool->acquireAlternative(1)->getIndex());
+    }
+    EXPECT_EQ(nullptr, createPool(1, ChannelSelection::ROUND_ROBIN)->acquireAlternative(0));
+}
+
+TEST(Test_ChannelPool, acquireAlternative_severalEndpoints_channelOfNextEndpoint) {
+    auto pool = createPool(4, ChannelSelection::ROUND_ROBIN, 2);
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_LE(2, pool->acquireAlternative(1)->getIndex());
+        EXPECT_GT(2, pool->acquireAlternative(3)->getIndex());
+    }
+}
@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/grpc/common/ChannelPrewarmer.h"
+
+#include "sdk/Exceptions.h"
+#include "sdk/vdb/grpc/common/ChannelPool.h"
+
+#include <gtest/gtest.h>
+#include <grpcpp/channel.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/generic/async_generic_service.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+std::shared_ptr<ChannelPool> createPool(const std::string& address, size_t numChannels) {
+    std::vector<std::shared_ptr<grpc::Channel>> channels;
+    for (size_t i = 0; i < numChannels; ++i) {
+        // distinct arguments, so the channels do not share their connection
+        grpc::ChannelArguments args;
+        args.SetInt("velocitas.test.channel_index", static_cast<int>(i));
+        channels.push_back(
+            grpc::CreateCustomChannel(address, grpc::InsecureChannelCredentials(), args));
+    }
+    return ChannelPool::create(std::move(channels), ChannelSelection::ROUND_ROBIN);
+}
+
+// a server without any service of its own, just accepting connections
+class TestServer {
+public:
+    TestServer() {
+        grpc::ServerBuilder builder;
+        builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &m_port);
+        builder.RegisterCallbackGenericService(&m_service);
+        m_server = builder.BuildAndStart();
+        if (!m_server) {
+            throw std::runtime_error("Failed to start the test server");
+        }
+    }
+
+    ~TestServer() { stop(); }
+
+    TestServer(const TestServer&)            = delete;
+    TestServer(TestServer&&)                 = delete;
+    TestServer& operator=(const TestServer&) = delete;
+    TestServer& operator=(TestServer&&)      = delete;
+
+    void stop() {
+        if (m_server) {
+            m_server->Shutdown(std::chrono::system_clock::now());
+            m_server->Wait();
+            m_server.reset();
+        }
+    }
+
+    [[nodiscard]] std::string getAddress() const {
+        return "127.0.0.1:" + std::to_string(m_port);
+    }
+
+private:
+    int                           m_port{0};
+    grpc::CallbackGenericService  m_service;
+    std::unique_ptr<grpc::Server> m_server;
+};
+
+} // namespace
+
+TEST(Test_ChannelPrewarmer, whenReady_serverListening_allChannelsConnected) {
+    TestServer server;
+    auto       pool = createPool(server.getAddress(), 2);
+
+    auto prewarmer = ChannelPrewarmer::start(*pool, std::chrono::seconds{5});
+
+    EXPECT_TRUE(prewarmer->whenReady()->await().ok());
+    EXPECT_EQ(GRPC_CHANNEL_READY, pool->getChannel(0)->GetState(false));
+    EXPECT_EQ(GRPC_CHANNEL_READY, pool->getChannel(1)->GetState(false));
+    // completed results are returned to later callers as well
+    EXPECT_TRUE(prewarmer->whenReady()->await().ok());
+}
+
+TEST(Test_ChannelPrewarmer, whenReady_nothingListening_failsAfterTimeout) {
+    // the port of a stopped server is not listening anymore
+    TestServer server;
+    server.stop();
+    auto pool = createPool(server.getAddress(), 1);
+
+    const auto start     = std::chrono::steady_clock::now();
+    auto       prewarmer = ChannelPrewarmer::start(*pool, std::chrono::milliseconds{100});
+
+    EXPECT_THROW(prewarmer->whenReady()->await(), AsyncException);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds{100});
+    EXPECT_THROW(prewarmer->whenReady()->await(), AsyncException);
+}
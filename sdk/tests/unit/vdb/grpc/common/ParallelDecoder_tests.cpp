@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/grpc/common/ParallelDecoder.h"
+
+#include "sdk/ThreadPool.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+ParallelDecoderConfig createConfig() {
+    ParallelDecoderConfig config;
+    config.m_splitThreshold = std::chrono::microseconds{100};
+    config.m_minChunkSize   = 10;
+    return config;
+}
+
+} // namespace
+
+class Test_ParallelDecoder : public ::testing::Test {
+protected:
+    std::shared_ptr<ThreadPool> m_threadPool{std::make_shared<ThreadPool>(3)};
+    ParallelDecoder             m_decoder{createConfig(), m_threadPool};
+};
+
+TEST_F(Test_ParallelDecoder, decode_noObservedDecodeTime_decodedByCallingThread) {
+    std::set<std::thread::id> threads;
+
+    const auto numChunks = m_decoder.decode(1000, [&threads](size_t begin, size_t end) {
+        EXPECT_EQ(0, begin);
+        EXPECT_EQ(1000, end);
+        threads.insert(std::this_thread::get_id());
+    });
+
+    EXPECT_EQ(1, numChunks);
+    EXPECT_EQ(std::set<std::thread::id>{std::this_thread::get_id()}, threads);
+    EXPECT_EQ(0, m_decoder.getNumSplitUpdates());
+}
+
+TEST_F(Test_ParallelDecoder, getNumChunks_slowEntries_wideUpdatesSplitOnly) {
+    // 1 µs per entry
+    m_decoder.recordDecode(1000, std::chrono::milliseconds{1});
+
+    EXPECT_EQ(1, m_decoder.getNumChunks(100));
+    EXPECT_EQ(2, m_decoder.getNumChunks(150));
+    // limited by the number of workers plus the calling thread
+    EXPECT_EQ(4, m_decoder.getNumChunks(10000));
+    // limited by the minimum chunk size
+    m_decoder.recordDecode(1000, std::chrono::seconds{1});
+    EXPECT_EQ(2, m_decoder.getNumChunks(20));
+}
+
+TEST_F(Test_ParallelDecoder, decode_wideUpdate_allEntriesDecodedOnceInChunks) {
+    m_decoder.recordDecode(1000, std::chrono::milliseconds{1});
+    std::vector<int> numDecodes(10000, 0);
+    std::mutex       mutex;
+    size_t           numRanges{0};
+
+    const auto numChunks = m_decoder.decode(numDecodes.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            ++numDecodes[i];
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        ++numRanges;
+    });
+
+    EXPECT_EQ(4, numChunks);
+    EXPECT_EQ(4, numRanges);
+    EXPECT_EQ(std::vector<int>(numDecodes.size(), 1), numDecodes);
+    EXPECT_EQ(1, m_decoder.getNumSplitUpdates());
+}
+
+TEST_F(Test_ParallelDecoder, decode_chunkThrows_rethrownAfterAllChunksDone) {
+    m_decoder.recordDecode(1000, std::chrono::milliseconds{1});
+    std::vector<int> numDecodes(1000, 0);
+
+    EXPECT_THROW(m_decoder.decode(numDecodes.size(),
+                                  [&numDecodes](size_t begin, size_t end) {
+                                      for (size_t i = begin; i < end; ++i) {
+                                          ++numDecodes[i];
+                                      }
+                                      if (begin == 0) {
+                                          throw std::runtime_error("malformed entry");
+                                      }
+                                  }),
+                 std::runtime_error);
+    EXPECT_EQ(std::vector<int>(numDecodes.size(), 1), numDecodes);
+}
+
+TEST_F(Test_ParallelDecoder, getNumChunks_zeroThreshold_neverSplit) {
+    ParallelDecoderConfig config;
+    config.m_splitThreshold = std::chrono::microseconds{0};
+    ParallelDecoder decoder(config, m_threadPool);
+    decoder.recordDecode(1000, std::chrono::seconds{1});
+
+    EXPECT_EQ(1, decoder.getNumChunks(100000));
+}
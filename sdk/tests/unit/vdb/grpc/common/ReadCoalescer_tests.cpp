@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/grpc/common/ReadCoalescer.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+class Test_ReadCoalescer : public ::testing::Test {
+protected:
+    Test_ReadCoalescer()
+        : m_coalescer([this](const std::vector<std::string>& signalPaths) {
+            m_requestedPaths.push_back(signalPaths);
+            m_requests.push_back(std::make_shared<AsyncResult<DataPointReply>>());
+            return m_requests.back();
+        }) {}
+
+    static DataPointReply createReply(const std::map<std::string, int32_t>& values) {
+        DataPointReply reply;
+        for (const auto& [path, value] : values) {
+            reply.set(path, DataPointSample(value));
+        }
+        return reply;
+    }
+
+    std::vector<std::vector<std::string>>         m_requestedPaths;
+    std::vector<AsyncResultPtr_t<DataPointReply>> m_requests;
+    ReadCoalescer                                 m_coalescer;
+};
+
+} // namespace
+
+TEST_F(Test_ReadCoalescer, read_subsetOfReadInFlight_sharesRequest) {
+    auto result1 = m_coalescer.read({"Coalesce.Share.A", "Coalesce.Share.B"});
+    auto result2 = m_coalescer.read({"Coalesce.Share.B"});
+    ASSERT_EQ(1, m_requests.size());
+    EXPECT_EQ(1, m_coalescer.getNumReadsInFlight());
+
+    m_requests[0]->insertResult(createReply({{"Coalesce.Share.A", 1}, {"Coalesce.Share.B", 2}}));
+
+    auto reply1 = result1->await();
+    EXPECT_EQ(2, reply1.size());
+    auto reply2 = result2->await();
+    ASSERT_EQ(1, reply2.size());
+    EXPECT_EQ(2, reply2.getSample("Coalesce.Share.B").get<int32_t>());
+    EXPECT_EQ(0, m_coalescer.getNumReadsInFlight());
+}
+
+TEST_F(Test_ReadCoalescer, read_signalsNotInFlight_issuesOwnRequest) {
+    auto result1 = m_coalescer.read({"Coalesce.Own.A"});
+    auto result2 = m_coalescer.read({"Coalesce.Own.A", "Coalesce.Own.B"});
+
+    ASSERT_EQ(2, m_requests.size());
+    EXPECT_EQ(2, m_requestedPaths[1].size());
+}
+
+TEST_F(Test_ReadCoalescer, read_sharedRequestFails_failsAllReaders) {
+    auto result1 = m_coalescer.read({"Coalesce.Fail.A"});
+    auto result2 = m_coalescer.read({"Coalesce.Fail.A"});
+
+    m_requests[0]->insertError(Status("failed"));
+
+    EXPECT_THROW(result1->await(), AsyncException);
+    EXPECT_THROW(result2->await(), AsyncException);
+}
+
+TEST_F(Test_ReadCoalescer, read_afterReadCompleted_issuesNewRequest) {
+    auto result1 = m_coalescer.read({"Coalesce.Again.A"});
+    m_requests[0]->insertResult(createReply({{"Coalesce.Again.A", 1}}));
+
+    auto result2 = m_coalescer.read({"Coalesce.Again.A"});
+
+    EXPECT_EQ(2, m_requests.size());
+}
+
+TEST_F(Test_ReadCoalescer, cancel_allReadersOfSharedRequest_cancelsRequest) {
+    auto result1 = m_coalescer.read({"Coalesce.Cancel.A", "Coalesce.Cancel.B"});
+    auto result2 = m_coalescer.read({"Coalesce.Cancel.A"});
+    ASSERT_EQ(1, m_requests.size());
+
+    result1->cancel();
+    EXPECT_FALSE(m_requests[0]->isCancelled());
+    result2->cancel();
+
+    EXPECT_TRUE(m_requests[0]->isCancelled());
+    EXPECT_EQ(0, m_coalescer.getNumReadsInFlight());
+}
+
+TEST_F(Test_ReadCoalescer, cancel_oneOfTwoReaders_otherReaderCompleted) {
+    auto result1 = m_coalescer.read({"Coalesce.CancelOne.A"});
+    auto result2 = m_coalescer.read({"Coalesce.CancelOne.A"});
+
+    result1->cancel();
+    m_requests[0]->insertResult(createReply({{"Coalesce.CancelOne.A", 1}}));
+
+    EXPECT_THROW(result1->await(), AsyncException);
+    EXPECT_EQ(1, result2->await().size());
+}
@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/grpc/common/RequestChunker.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <numeric>
+
+using namespace velocitas;
+
+namespace {
+
+RequestChunkerConfig createConfig(size_t maxMessageSize = 1024 * 1024) {
+    RequestChunkerConfig config{maxMessageSize};
+    config.m_minChunkSize  = 10;
+    config.m_maxChunkSize  = 100;
+    config.m_targetLatency = std::chrono::milliseconds{10};
+    return config;
+}
+
+} // namespace
+
+TEST(Test_RequestChunker, split_requestFittingIntoChunk_notSplit) {
+    RequestChunker chunker(createConfig());
+
+    EXPECT_EQ(std::vector<size_t>{100}, chunker.split(100));
+}
+
+TEST(Test_RequestChunker, split_largeRequest_chunksOfAboutEqualSize) {
+    RequestChunker chunker(createConfig());
+
+    const auto chunkSizes = chunker.split(250);
+
+    EXPECT_EQ((std::vector<size_t>{84, 83, 83}), chunkSizes);
+}
+
+TEST(Test_RequestChunker, split_largeElements_limitedByMessageSize) {
+    RequestChunker chunker(createConfig(4000));
+
+    const auto chunkSizes = chunker.split(100, 200);
+
+    // 3/4 of the message size fits 15 elements
+    EXPECT_EQ(7, chunkSizes.size());
+    EXPECT_EQ(100, std::accumulate(chunkSizes.cbegin(), chunkSizes.cend(), size_t{0}));
+}
+
+TEST(Test_RequestChunker, getChunkSize_largeResponsesObserved_shrinks) {
+    RequestChunker chunker(createConfig(4000));
+
+    chunker.recordResponse(10, std::chrono::microseconds{1}, 1000);
+
+    EXPECT_EQ(30, chunker.getChunkSize());
+}
+
+TEST(Test_RequestChunker, getChunkSize_slowResponsesObserved_limitedByTargetLatency) {
+    RequestChunker chunker(createConfig());
+
+    chunker.recordResponse(50, std::chrono::milliseconds{25}, 50);
+
+    // 0.5ms per element within 10ms target latency
+    EXPECT_EQ(20, chunker.getChunkSize());
+}
+
+TEST(Test_RequestChunker, getChunkSize_verySlowResponsesObserved_notBelowMinimum) {
+    RequestChunker chunker(createConfig());
+
+    chunker.recordResponse(10, std::chrono::seconds{1}, 10);
+
+    EXPECT_EQ(10, chunker.getChunkSize());
+}
@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#include "sdk/vdb/grpc/common/RequestHedger.h"
+
+#include "sdk/grpc/GrpcCall.h"
+
+#include <gtest/gtest.h>
+#include <grpcpp/channel.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace velocitas;
+
+namespace {
+
+std::shared_ptr<ChannelPool> createPool(size_t numChannels) {
+    std::vector<std::shared_ptr<grpc::Channel>> channels;
+    for (size_t i = 0; i < numChannels; ++i) {
+        channels.push_back(
+            grpc::CreateChannel("localhost:55555", grpc::InsecureChannelCredentials()));
+    }
+    return ChannelPool::create(std::move(channels), ChannelSelection::ROUND_ROBIN);
+}
+
+RequestHedgingConfig createConfig() {
+    RequestHedgingConfig config;
+    config.m_percentile = 50.0;
+    config.m_minDelay   = std::chrono::milliseconds{5};
+    return config;
+}
+
+/**
+ * @brief Records the attempts issued by a hedger, which are completed by the test.
+ */
+class AttemptRecorder {
+public:
+    struct Attempt {
+        size_t                    m_channelIndex;
+        bool                      m_isHedge;
+        RequestHedger::Complete_t m_complete;
+    };
+
+    RequestHedger::Issue_t getIssuer() {
+        return [this](auto lease, bool isHedge, auto complete) {
+            std::lock_guard lock(m_mutex);
+            m_attempts.push_back(Attempt{lease->getIndex(), isHedge, std::move(complete)});
+            m_condition.notify_all();
+            return std::make_shared<GrpcCall>();
+        };
+    }
+
+    bool waitForAttempts(size_t numAttempts) {
+        std::unique_lock lock(m_mutex);
+        return m_condition.wait_for(lock, std::chrono::seconds(5), [this, numAttempts]() {
+            return m_attempts.size() >= numAttempts;
+        });
+    }
+
+    Attempt getAttempt(size_t index) {
+        std::lock_guard lock(m_mutex);
+        return m_attempts.at(index);
+    }
+
+    size_t getNumAttempts() {
+        std::lock_guard lock(m_mutex);
+        return m_attempts.size();
+    }
+
+private:
+    std::mutex              m_mutex;
+    std::condition_variable m_condition;
+    std::vector<Attempt>    m_attempts;
+};
+
+} // namespace
+
+class Test_RequestHedger : public ::testing::Test {
+protected:
+    void observeLatencies(std::chrono::milliseconds latency) {
+        for (size_t i = 0; i < RequestHedger::MIN_OBSERVATIONS; ++i) {
+            m_hedger->recordLatency(latency);
+        }
+    }
+
+    std::shared_ptr<RequestHedger> m_hedger{RequestHedger::create(createConfig(), createPool(2))};
+    AttemptRecorder                m_recorder;
+};
+
+TEST_F(Test_RequestHedger, create_disabledOrSingleChannel_null) {
+    EXPECT_EQ(nullptr, RequestHedger::create(RequestHedgingConfig{}, createPool(2)));
+    EXPECT_EQ(nullptr, RequestHedger::create(createConfig(), createPool(1)));
+}
+
+TEST_F(Test_RequestHedger, getDelay_observedLatencies_percentileNotBelowMinDelay) {
+    for (size_t i = 1; i < RequestHedger::MIN_OBSERVATIONS; ++i) {
+        m_hedger->recordLatency(std::chrono::milliseconds(i));
+    }
+    EXPECT_FALSE(m_hedger->getDelay().has_value());
+
+    m_hedger->recordLatency(std::chrono::milliseconds(RequestHedger::MIN_OBSERVATIONS));
+    ASSERT_TRUE(m_hedger->getDelay().has_value());
+    EXPECT_EQ(std::chrono::milliseconds(10), *m_hedger->getDelay());
+
+    auto hedger = RequestHedger::create(createConfig(), createPool(2));
+    for (size_t i = 0; i < RequestHedger::MIN_OBSERVATIONS; ++i) {
+        hedger->recordLatency(std::chrono::microseconds(100));
+    }
+    EXPECT_EQ(std::chrono::milliseconds(5), *hedger->getDelay());
+}
+
+TEST_F(Test_RequestHedger, issue_noDelayKnown_notHedged) {
+    m_hedger->issue(m_recorder.getIssuer());
+    ASSERT_EQ(1, m_recorder.getNumAttempts());
+
+    EXPECT_TRUE(m_recorder.getAttempt(0).m_complete(true));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(1, m_recorder.getNumAttempts());
+    EXPECT_EQ(0, m_hedger->getNumHedges());
+}
+
+TEST_F(Test_RequestHedger, issue_noReplyWithinDelay_hedgeOnOtherChannelWins) {
+    observeLatencies(std::chrono::milliseconds(1));
+
+    m_hedger->issue(m_recorder.getIssuer());
+    ASSERT_TRUE(m_recorder.waitForAttempts(2));
+    const auto primary = m_recorder.getAttempt(0);
+    const auto hedge   = m_recorder.getAttempt(1);
+    EXPECT_FALSE(primary.m_isHedge);
+    EXPECT_TRUE(hedge.m_isHedge);
+    EXPECT_NE(primary.m_channelIndex, hedge.m_channelIndex);
+
+    EXPECT_TRUE(hedge.m_complete(true));
+    // the cancelled primary attempt completes with an error, which is not handled anymore
+    EXPECT_FALSE(primary.m_complete(false));
+    EXPECT_EQ(1, m_hedger->getNumHedges());
+    EXPECT_EQ(1, m_hedger->getNumHedgeWins());
+}
+
+TEST_F(Test_RequestHedger, issue_attemptFailsWhileOtherPending_lastFailureHandled) {
+    observeLatencies(std::chrono::milliseconds(1));
+
+    m_hedger->issue(m_recorder.getIssuer());
+    ASSERT_TRUE(m_recorder.waitForAttempts(2));
+
+    EXPECT_FALSE(m_recorder.getAttempt(0).m_complete(false));
+    EXPECT_TRUE(m_recorder.getAttempt(1).m_complete(false));
+    EXPECT_EQ(0, m_hedger->getNumHedgeWins());
+}
+
+TEST_F(Test_RequestHedger, issue_replyBeforeDelay_hedgeNotSent) {
+    observeLatencies(std::chrono::milliseconds(50));
+
+    m_hedger->issue(m_recorder.getIssuer());
+    EXPECT_TRUE(m_recorder.getAttempt(0).m_complete(true));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(1, m_recorder.getNumAttempts());
+}
+
+TEST_F(Test_RequestHedger, issue_cancelled_hedgeNotSent) {
+    observeLatencies(std::chrono::milliseconds(20));
+
+    auto cancel = m_hedger->issue(m_recorder.getIssuer());
+    cancel();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    EXPECT_EQ(1, m_recorder.getNumAttempts());
+    EXPECT_TRUE(m_recorder.getAttempt(0).m_complete(false));
+}
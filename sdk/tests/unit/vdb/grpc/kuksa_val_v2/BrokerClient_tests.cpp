@@ -0,0 +1,165 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "FakeDatabroker.h"
+#include "sdk/DataPointValue.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/BrokerAsyncGrpcFacade.h"
+#include "sdk/vdb/grpc/kuksa_val_v2/BrokerClient.h"
+
+#include <grpcpp/channel.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+
+using namespace velocitas;
+using namespace velocitas::kuksa_val_v2;
+
+namespace {
+
+constexpr auto SERVICE_NAME = "vehicledatabroker";
+
+float getFloatValue(const DataPointReply& reply, const std::string& path) {
+    const auto value = std::dynamic_pointer_cast<TypedDataPointValue<float>>(reply.getUntyped(path));
+    EXPECT_NE(value, nullptr);
+    return value ? value->value() : 0.0F;
+}
+
+} // namespace
+
+TEST(Test_kuksa_val_v2_BrokerClient, getDatapoints_servedSignals_returnsTheirValues) {
+    FakeDatabroker broker(FakeDatabrokerConfig{{}, 3});
+    BrokerClient   client(broker.getAddress(), SERVICE_NAME);
+
+    const auto paths = broker.getSignalPaths();
+    const auto reply = client.getDatapoints(paths)->await();
+
+    for (const auto& path : paths) {
+        EXPECT_FLOAT_EQ(getFloatValue(reply, path), 0.0F);
+    }
+    EXPECT_GE(broker.getNumGetValuesCalls(), 1);
+}
+
+TEST(Test_kuksa_val_v2_BrokerClient, setDatapoints_servedSignals_updatesTheBroker) {
+    FakeDatabroker broker(FakeDatabrokerConfig{{"Vehicle.Speed", "Vehicle.Cabin.Temperature"}});
+    BrokerClient   client(broker.getAddress(), SERVICE_NAME);
+
+    std::vector<std::unique_ptr<DataPointValue>> datapoints;
+    datapoints.push_back(std::make_unique<TypedDataPointValue<float>>("Vehicle.Speed", 42.0F));
+    const auto errors = client.setDatapoints(datapoints)->await();
+
+    EXPECT_TRUE(errors.empty());
+    EXPECT_FLOAT_EQ(broker.getValue("Vehicle.Speed"), 42.0F);
+    EXPECT_FLOAT_EQ(broker.getValue("Vehicle.Cabin.Temperature"), 0.0F);
+    EXPECT_EQ(broker.getNumBatchActuateCalls(), 1);
+}
+
+TEST(Test_kuksa_val_v2_BrokerClient, setDatapoints_repeatedly_addressesSignalsByIdOnceResolved) {
+    FakeDatabroker broker(FakeDatabrokerConfig{{"Vehicle.Speed"}});
+    BrokerClient   client(broker.getAddress(), SERVICE_NAME);
+
+    std::vector<std::unique_ptr<DataPointValue>> datapoints;
+    datapoints.push_back(std::make_unique<TypedDataPointValue<float>>("Vehicle.Speed", 1.0F));
+    EXPECT_TRUE(client.setDatapoints(datapoints)->await().empty());
+    EXPECT_EQ(broker.getNumActuationsByPath(), 1);
+
+    // the id is resolved in the background after the first actuation
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+    while (broker.getNumActuationsByPath() == broker.getNumBatchActuateCalls() &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        EXPECT_TRUE(client.setDatapoints(datapoints)->await().empty());
+    }
+    EXPECT_LT(broker.getNumActuationsByPath(), broker.getNumBatchActuateCalls());
+}
+
+TEST(Test_kuksa_val_v2_BrokerClient, prepareSet_appliedRepeatedly_updatesTheBroker) {
+    FakeDatabroker broker(FakeDatabrokerConfig{{"Vehicle.Speed", "Vehicle.Cabin.Temperature"}});
+    BrokerClient   client(broker.getAddress(), SERVICE_NAME);
+    const std::vector<std::string> paths{"Vehicle.Speed", "Vehicle.Cabin.Temperature"};
+    ASSERT_TRUE(client.prepare(paths, std::chrono::seconds{5})->await().ok());
+
+    auto preparedSet = client.prepareSet(paths);
+    std::vector<std::unique_ptr<DataPointValue>> values;
+    values.push_back(std::make_unique<TypedDataPointValue<float>>(paths[0], 1.0F));
+    values.push_back(std::make_unique<TypedDataPointValue<float>>(paths[1], 2.0F));
+    EXPECT_TRUE(preparedSet->apply(values, SetMode::ACTUATE)->await().empty());
+    static_cast<TypedDataPointValue<float>&>(*values[0]).setValue(42.0F);
+    EXPECT_TRUE(preparedSet->apply(values, SetMode::ACTUATE)->await().empty());
+
+    EXPECT_FLOAT_EQ(broker.getValue("Vehicle.Speed"), 42.0F);
+    EXPECT_FLOAT_EQ(broker.getValue("Vehicle.Cabin.Temperature"), 2.0F);
+    EXPECT_EQ(broker.getNumBatchActuateCalls(), 2);
+}
+
+TEST(Test_kuksa_val_v2_BrokerClient, subscribe_servedSignals_receivesIncrementingUpdates) {
+    FakeDatabrokerConfig config;
+    config.m_numSignals       = 4;
+    config.m_updateInterval   = std::chrono::milliseconds{1};
+    config.m_signalsPerUpdate = 1;
+    FakeDatabroker broker(config);
+    BrokerClient   client(broker.getAddress(), SERVICE_NAME);
+
+    const auto              path = FakeDatabroker::getGeneratedSignalPath(0);
+    std::mutex              mutex;
+    std::condition_variable condition;
+    float                   lastValue{-1.0F};
+    auto                    subscription = client.subscribe("SELECT " + path);
+    subscription->onItem([&](const DataPointReply& reply) {
+        std::lock_guard lock(mutex);
+        lastValue = getFloatValue(reply, path);
+        condition.notify_all();
+    });
+
+    std::unique_lock lock(mutex);
+    EXPECT_TRUE(condition.wait_for(lock, std::chrono::seconds{5}, [&]() { return lastValue >= 3; }));
+}
+
+TEST(Test_kuksa_val_v2_BrokerAsyncGrpcFacade, GetValues_unknownSignal_failsWithNotFound) {
+    FakeDatabroker        broker;
+    BrokerAsyncGrpcFacade facade(broker.createInProcessChannel());
+
+    kuksa::val::v2::GetValuesRequest request;
+    request.add_signal_ids()->set_path("Vehicle.Unknown");
+    std::promise<grpc::StatusCode> statusCode;
+    const auto                     call = facade.GetValues(
+        request, [&](const auto& /*reply*/) { statusCode.set_value(grpc::StatusCode::OK); },
+        [&](const auto& status) { statusCode.set_value(status.error_code()); });
+
+    EXPECT_EQ(statusCode.get_future().get(), grpc::StatusCode::NOT_FOUND);
+}
+
+TEST(Test_kuksa_val_v2_FakeDatabroker, destruction_withActiveSubscription_finishesTheStream) {
+    auto broker = std::make_unique<FakeDatabroker>();
+    BrokerAsyncGrpcFacade facade(broker->createInProcessChannel());
+
+    kuksa::val::v2::SubscribeByIdRequest request;
+    request.add_signal_ids(1);
+    std::promise<void> isUpdated;
+    std::promise<void> isFinished;
+    std::once_flag     updateFlag;
+    const auto         call = facade.SubscribeById(
+        request,
+        [&](auto& /*update*/) { std::call_once(updateFlag, [&]() { isUpdated.set_value(); }); },
+        [&](const auto& /*status*/) { isFinished.set_value(); });
+    isUpdated.get_future().wait();
+    EXPECT_EQ(broker->getNumActiveSubscriptions(), 1);
+
+    broker.reset();
+    EXPECT_EQ(isFinished.get_future().wait_for(std::chrono::seconds{5}), std::future_status::ready);
+}
@@ -0,0 +1,357 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/vdb/grpc/kuksa_val_v2/Metadata.h"
+
+#include <grpcpp/support/status.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+using namespace velocitas;
+using namespace velocitas::kuksa_val_v2;
+
+namespace {
+
+struct ListMetadataCall {
+    kuksa::val::v2::ListMetadataRequest                              m_request;
+    std::function<void(const kuksa::val::v2::ListMetadataResponse&)> m_onResponse;
+    std::function<void(const grpc::Status&)>                         m_onError;
+};
+
+class Test_MetadataAgent : public ::testing::Test {
+protected:
+    void TearDown() override {
+        if (!m_cacheFile.empty()) {
+            std::remove(m_cacheFile.c_str());
+        }
+    }
+
+    void
+    createAgent(size_t maxParallelRequests = MetadataAgentConfig::DEFAULT_MAX_PARALLEL_REQUESTS) {
+        MetadataAgentConfig config;
+        config.m_maxParallelRequests = maxParallelRequests;
+        createAgent(config);
+    }
+
+    void createPersistentAgent(const std::string& brokerIdentity = "localhost:55555") {
+        if (m_cacheFile.empty()) {
+            m_cacheFile = ::testing::TempDir() + "metadata_cache_" +
+                          ::testing::UnitTest::GetInstance()->current_test_info()->name();
+            std::remove(m_cacheFile.c_str());
+        }
+        MetadataAgentConfig config;
+        config.m_persistentCacheFile = m_cacheFile;
+        config.m_brokerIdentity      = brokerIdentity;
+        createAgent(config);
+        m_agent->setChangeHandler([this]() { ++m_numChanges; });
+    }
+
+    void createAgent(const MetadataAgentConfig& config) {
+        m_agent = MetadataAgent::create(
+            [this](auto request, auto onResponse, auto onError) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_calls.push_back(ListMetadataCall{std::move(request), std::move(onResponse),
+                                                   std::move(onError)});
+            },
+            config);
+    }
+
+    void query(const SignalPathList_t& signalPaths) {
+        m_agent->query(
+            signalPaths, [this](MetadataList_t&& metadataList) { m_result = metadataList; },
+            [](const grpc::Status&) {});
+    }
+
+    bool waitForNumCalls(size_t numCalls) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{2};
+        while (std::chrono::steady_clock::now() < deadline) {
+            if (getNumCalls() >= numCalls) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds{5});
+        }
+        return false;
+    }
+
+    size_t getNumCalls() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_calls.size();
+    }
+
+    ListMetadataCall getCall(size_t index) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_calls.at(index);
+    }
+
+    static kuksa::val::v2::ListMetadataResponse
+    createResponse(const std::vector<std::pair<std::string, numeric_id_t>>& signals) {
+        kuksa::val::v2::ListMetadataResponse response;
+        for (const auto& [path, id] : signals) {
+            auto* metadata = response.add_metadata();
+            metadata->set_path(path);
+            metadata->set_id(id);
+        }
+        return response;
+    }
+
+    std::shared_ptr<MetadataAgent> m_agent;
+    std::mutex                     m_mutex;
+    std::vector<ListMetadataCall>  m_calls;
+    std::optional<MetadataList_t>  m_result;
+    std::string                    m_cacheFile;
+    std::atomic_int                m_numChanges{0};
+};
+
+} // namespace
+
+TEST_F(Test_MetadataAgent, query_moreSignalsThanParallelLimit_limitsRequestsInFlight) {
+    createAgent(2);
+    query({"Meta.Limit.A", "Meta.Limit.B", "Meta.Limit.C"});
+
+    ASSERT_TRUE(waitForNumCalls(2));
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_EQ(2, getNumCalls());
+
+    auto call = getCall(0);
+    call.m_onResponse(createResponse({{call.m_request.root(), 1}}));
+    ASSERT_TRUE(waitForNumCalls(3));
+    getCall(1).m_onResponse(createResponse({{getCall(1).m_request.root(), 2}}));
+    getCall(2).m_onResponse(createResponse({{getCall(2).m_request.root(), 3}}));
+
+    ASSERT_TRUE(m_result.has_value());
+    EXPECT_EQ(3, m_result->size());
+}
+
+TEST_F(Test_MetadataAgent, prefetch_branch_fulfillsQueriesWithSingleRequest) {
+    createAgent();
+    m_agent->prefetch("Meta.Prefetch");
+    ASSERT_EQ(1, getNumCalls());
+    EXPECT_EQ("Meta.Prefetch", getCall(0).m_request.root());
+
+    query({"Meta.Prefetch.A", "Meta.Prefetch.B"});
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_EQ(1, getNumCalls());
+    EXPECT_FALSE(m_result.has_value());
+
+    getCall(0).m_onResponse(createResponse(
+        {{"Meta.Prefetch.A", 11}, {"Meta.Prefetch.B", 12}, {"Meta.Prefetch.C", 13}}));
+
+    ASSERT_TRUE(m_result.has_value());
+    ASSERT_EQ(2, m_result->size());
+    EXPECT_TRUE((*m_result)[0]->m_isKnown);
+    ASSERT_NE(nullptr, m_agent->getByNumericId(13));
+    EXPECT_EQ("Meta.Prefetch.C", m_agent->getByNumericId(13)->m_signalPath);
+
+    m_result.reset();
+    query({"Meta.Prefetch.C"});
+    ASSERT_TRUE(m_result.has_value());
+    EXPECT_EQ(13, (*m_result)[0]->m_id);
+    EXPECT_EQ(1, getNumCalls());
+}
+
+TEST_F(Test_MetadataAgent, query_signalWithDataType_typeAndDecoderBound) {
+    createAgent();
+    query({"Meta.Typed.A"});
+    ASSERT_TRUE(waitForNumCalls(1));
+
+    auto response = createResponse({{"Meta.Typed.A", 21}});
+    response.mutable_metadata(0)->set_data_type(kuksa::val::v2::DATA_TYPE_FLOAT);
+    getCall(0).m_onResponse(response);
+
+    ASSERT_TRUE(m_result.has_value());
+    const auto& metadata = *(*m_result)[0];
+    EXPECT_EQ(DataPointValue::Type::FLOAT, metadata.m_type);
+    EXPECT_EQ(getDataPointDecoder(DataPointValue::Type::FLOAT), metadata.m_decoder);
+}
+
+TEST_F(Test_MetadataAgent, prefetch_signalMissingInResponse_requestedIndividually) {
+    createAgent();
+    m_agent->prefetch("Meta.Missing");
+    query({"Meta.Missing.A", "Meta.Missing.B"});
+
+    getCall(0).m_onResponse(createResponse({{"Meta.Missing.A", 21}}));
+    ASSERT_TRUE(waitForNumCalls(2));
+    EXPECT_EQ("Meta.Missing.B", getCall(1).m_request.root());
+    EXPECT_FALSE(m_result.has_value());
+
+    getCall(1).m_onError(grpc::Status(grpc::StatusCode::NOT_FOUND, ""));
+    ASSERT_TRUE(m_result.has_value());
+    EXPECT_EQ(2, m_result->size());
+}
+
+TEST_F(Test_MetadataAgent, prefetch_failed_signalsRequestedIndividually) {
+    createAgent();
+    m_agent->prefetch("Meta.Failed");
+    query({"Meta.Failed.A"});
+
+    getCall(0).m_onError(grpc::Status(grpc::StatusCode::UNIMPLEMENTED, ""));
+    ASSERT_TRUE(waitForNumCalls(2));
+    EXPECT_EQ("Meta.Failed.A", getCall(1).m_request.root());
+}
+
+TEST_F(Test_MetadataAgent, invalidate_afterPrefetch_prefetchesAgainOnNextQuery) {
+    createAgent();
+    m_agent->prefetch("Meta.Again");
+    getCall(0).m_onResponse(createResponse({{"Meta.Again.A", 31}}));
+
+    m_agent->invalidate(grpc::StatusCode::UNAVAILABLE);
+    query({"Meta.Again.A"});
+    ASSERT_EQ(2, getNumCalls());
+    EXPECT_EQ("Meta.Again", getCall(1).m_request.root());
+
+    getCall(1).m_onResponse(createResponse({{"Meta.Again.A", 32}}));
+    ASSERT_TRUE(m_result.has_value());
+    EXPECT_EQ(32, (*m_result)[0]->m_id);
+}
+
+TEST_F(Test_MetadataAgent, query_persistedMetadata_fulfilledImmediatelyAndVerified) {
+    createPersistentAgent();
+    query({"Meta.Warm.A"});
+    ASSERT_TRUE(waitForNumCalls(1));
+    getCall(0).m_onResponse(createResponse({{"Meta.Warm.A", 41}}));
+    ASSERT_TRUE(m_result.has_value());
+
+    m_result.reset();
+    createPersistentAgent();
+    query({"Meta.Warm.A"});
+    ASSERT_TRUE(m_result.has_value());
+    EXPECT_EQ(41, (*m_result)[0]->m_id);
+    ASSERT_TRUE(waitForNumCalls(2));
+    EXPECT_EQ("Meta.Warm.A", getCall(1).m_request.root());
+
+    getCall(1).m_onResponse(createResponse({{"Meta.Warm.A", 41}}));
+    EXPECT_EQ(0, m_numChanges);
+}
+
+TEST_F(Test_MetadataAgent, query_persistedMetadataChanged_callsChangeHandler) {
+    createPersistentAgent();
+    query({"Meta.Changed.A"});
+    ASSERT_TRUE(waitForNumCalls(1));
+    getCall(0).m_onResponse(createResponse({{"Meta.Changed.A", 51}}));
+
+    createPersistentAgent();
+    query({"Meta.Changed.A"});
+    ASSERT_TRUE(waitForNumCalls(2));
+    getCall(1).m_onResponse(createResponse({{"Meta.Changed.A", 52}}));
+
+    EXPECT_EQ(1, m_numChanges);
+    EXPECT_EQ(nullptr, m_agent->getByNumericId(51));
+    ASSERT_NE(nullptr, m_agent->getByNumericId(52));
+    EXPECT_EQ("Meta.Changed.A", m_agent->getByNumericId(52)->m_signalPath);
+}
+
+TEST_F(Test_MetadataAgent, create_cacheOfOtherBroker_ignored) {
+    createPersistentAgent("localhost:55555");
+    query({"Meta.Other.A"});
+    ASSERT_TRUE(waitForNumCalls(1));
+    getCall(0).m_onResponse(createResponse({{"Meta.Other.A", 61}}));
+
+    m_result.reset();
+    createPersistentAgent("otherhost:55555");
+    EXPECT_EQ(nullptr, m_agent->getByNumericId(61));
+    query({"Meta.Other.A"});
+    EXPECT_FALSE(m_result.has_value());
+    ASSERT_TRUE(waitForNumCalls(2));
+}
+
+TEST_F(Test_MetadataAgent, invalidate_persistentCache_keepsMetadata) {
+    createPersistentAgent();
+    query({"Meta.Keep.A"});
+    ASSERT_TRUE(waitForNumCalls(1));
+    getCall(0).m_onResponse(createResponse({{"Meta.Keep.A", 71}}));
+
+    m_agent->invalidate(grpc::StatusCode::UNAVAILABLE);
+
+    ASSERT_NE(nullptr, m_agent->getByNumericId(71));
+    m_result.reset();
+    query({"Meta.Keep.A"});
+    ASSERT_TRUE(m_result.has_value());
+    EXPECT_EQ(71, (*m_result)[0]->m_id);
+    ASSERT_TRUE(waitForNumCalls(2));
+}
+
+TEST_F(Test_MetadataAgent, invalidateSignals_cachedSignal_onlyThatOneRequestedAgain) {
+    createAgent();
+    m_agent->setChangeHandler([this]() { ++m_numChanges; });
+    m_agent->prefetch("Meta.Partial");
+    getCall(0).m_onResponse(createResponse({{"Meta.Partial.A", 91}, {"Meta.Partial.B", 92}}));
+    auto&      registry = SignalPathRegistry::getInstance();
+    const auto signalA  = registry.intern("Meta.Partial.A");
+    const auto signalB  = registry.intern("Meta.Partial.B");
+
+    m_agent->invalidateSignals({signalA, registry.intern("Meta.Partial.Uncached")});
+
+    EXPECT_EQ(nullptr, m_agent->getByHandle(signalA));
+    EXPECT_NE(nullptr, m_agent->getByHandle(signalB));
+    // queries are still served from the cache meanwhile
+    query({"Meta.Partial.A"});
+    ASSERT_TRUE(m_result.has_value());
+    ASSERT_TRUE(waitForNumCalls(2));
+    EXPECT_EQ("Meta.Partial.A", getCall(1).m_request.root());
+
+    getCall(1).m_onResponse(createResponse({{"Meta.Partial.A", 93}}));
+    ASSERT_NE(nullptr, m_agent->getByHandle(signalA));
+    EXPECT_EQ(93, m_agent->getByHandle(signalA)->m_id);
+    EXPECT_EQ(1, m_numChanges);
+    EXPECT_EQ(2, getNumCalls());
+}
+
+TEST_F(Test_MetadataAgent, resolve_uncachedSignals_requestedWithoutQuery) {
+    createAgent();
+    auto&      registry = SignalPathRegistry::getInstance();
+    const auto signal   = registry.intern("Meta.Resolve.A");
+
+    m_agent->resolve({signal});
+    ASSERT_TRUE(waitForNumCalls(1));
+    EXPECT_EQ("Meta.Resolve.A", getCall(0).m_request.root());
+    getCall(0).m_onResponse(createResponse({{"Meta.Resolve.A", 101}}));
+    ASSERT_NE(nullptr, m_agent->getByHandle(signal));
+    EXPECT_EQ(101, m_agent->getByHandle(signal)->m_id);
+
+    // cached ones are not requested again
+    m_agent->resolve({signal});
+    EXPECT_EQ(1, getNumCalls());
+}
+
+TEST_F(Test_MetadataAgent, getByNumericId_denseAndSparseIds_found) {
+    createAgent();
+    m_agent->prefetch("Meta.Index");
+    getCall(0).m_onResponse(
+        createResponse({{"Meta.Index.A", 1}, {"Meta.Index.B", 2}, {"Meta.Index.C", 1000000}}));
+
+    ASSERT_NE(nullptr, m_agent->getByNumericId(2));
+    EXPECT_EQ("Meta.Index.B", m_agent->getByNumericId(2)->m_signalPath);
+    ASSERT_NE(nullptr, m_agent->getByNumericId(1000000));
+    EXPECT_EQ("Meta.Index.C", m_agent->getByNumericId(1000000)->m_signalPath);
+    EXPECT_EQ(nullptr, m_agent->getByNumericId(3));
+    EXPECT_EQ(nullptr, m_agent->getByNumericId(-1));
+}
+
+TEST_F(Test_MetadataAgent, getByNumericId_otherThreadAfterModification_seesNewMetadata) {
+    createAgent();
+    m_agent->prefetch("Meta.Thread");
+    std::thread([this]() { EXPECT_EQ(nullptr, m_agent->getByNumericId(81)); }).join();
+
+    getCall(0).m_onResponse(createResponse({{"Meta.Thread.A", 81}}));
+
+    std::thread([this]() { EXPECT_NE(nullptr, m_agent->getByNumericId(81)); }).join();
+    EXPECT_NE(nullptr, m_agent->getByNumericId(81));
+}
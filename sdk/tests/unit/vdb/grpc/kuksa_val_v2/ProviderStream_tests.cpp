@@ -0,0 +1,254 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/grpc/kuksa_val_v2/ProviderStream.h"
+
+#include "sdk/DataPointValue.h"
+#include "sdk/Exceptions.h"
+#include "sdk/SignalPathRegistry.h"
+
+#include <grpcpp/support/status.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+using namespace velocitas::kuksa_val_v2;
+
+namespace {
+
+class FakeMetadataAgent : public MetadataAgent {
+public:
+    void query(const SignalPathList_t&                    signalPaths,
+               std::function<void(MetadataList_t&&)>&&    onSuccess,
+               std::function<void(const grpc::Status&)>&& onError) override {
+        std::ignore = onError;
+        MetadataList_t metadataList;
+        for (const auto& path : signalPaths) {
+            auto& metadata = m_metadata[path];
+            if (!metadata) {
+                metadata = std::make_shared<Metadata>(
+                    Metadata{path, m_nextId++, path.find("Unknown") == std::string::npos,
+                             SignalPathRegistry::getInstance().intern(path)});
+            }
+            metadataList.push_back(metadata);
+        }
+        onSuccess(std::move(metadataList));
+    }
+
+    void invalidate(grpc::StatusCode statusCode) override { std::ignore = statusCode; }
+
+    void invalidateSignals(const std::vector<SignalHandle_t>& signalHandles) override {
+        std::ignore = signalHandles;
+    }
+
+    void resolve(const std::vector<SignalHandle_t>& signalHandles) override {
+        std::ignore = signalHandles;
+    }
+
+    void prefetch(const std::string& branch) override { std::ignore = branch; }
+
+    void setChangeHandler(std::function<void()> changeHandler) override {
+        std::ignore = changeHandler;
+    }
+
+    void setExecutor(ExecutorPtr_t executor) override { std::ignore = executor; }
+
+    [[nodiscard]] MetadataPtr_t getByNumericId(numeric_id_t numericId) const override {
+        std::ignore = numericId;
+        return {};
+    }
+
+    [[nodiscard]] MetadataPtr_t getByHandle(SignalHandle_t signalHandle) const override {
+        std::ignore = signalHandle;
+        return {};
+    }
+
+    int32_t getId(const std::string& path) const {
+        return static_cast<int32_t>(m_metadata.at(path)->m_id);
+    }
+
+private:
+    std::map<std::string, MetadataPtr_t> m_metadata;
+    numeric_id_t                         m_nextId{1};
+};
+
+class FakeProviderCall : public ProviderStream::ProviderCall_t {
+public:
+    void write(kuksa::val::v2::OpenProviderStreamRequest request) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_writtenRequests.push_back(std::move(request));
+    }
+
+    std::vector<kuksa::val::v2::OpenProviderStreamRequest> getWrittenRequests() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_writtenRequests;
+    }
+
+    ProviderStream::ResponseHandler_t  m_responseHandler;
+    ProviderStream::WriteDoneHandler_t m_writeDoneHandler;
+    ProviderStream::FinishHandler_t    m_finishHandler;
+
+private:
+    std::mutex                                             m_mutex;
+    std::vector<kuksa::val::v2::OpenProviderStreamRequest> m_writtenRequests;
+};
+
+class Test_ProviderStream : public ::testing::Test {
+protected:
+    void createStream(ProviderStreamConfig config) {
+        m_metadataAgent  = std::make_shared<FakeMetadataAgent>();
+        m_providerStream = ProviderStream::create(
+            [this](auto responseHandler, auto writeDoneHandler, auto finishHandler) {
+                auto call                = std::make_shared<FakeProviderCall>();
+                call->m_responseHandler  = std::move(responseHandler);
+                call->m_writeDoneHandler = std::move(writeDoneHandler);
+                call->m_finishHandler    = std::move(finishHandler);
+                m_calls.push_back(call);
+                return call;
+            },
+            m_metadataAgent, config);
+    }
+
+    static ProviderStreamConfig createConfig(std::chrono::milliseconds acknowledgeDelay,
+                                             size_t maxInFlightRequests = 16,
+                                             size_t maxQueuedRequests   = 16) {
+        ProviderStreamConfig config;
+        config.m_acknowledgeDelay    = acknowledgeDelay;
+        config.m_maxInFlightRequests = maxInFlightRequests;
+        config.m_maxQueuedRequests   = maxQueuedRequests;
+        return config;
+    }
+
+    AsyncResultPtr_t<IVehicleDataBrokerClient::SetErrorMap_t> publish(const std::string& path,
+                                                                       float             value) {
+        std::vector<std::unique_ptr<DataPointValue>> values;
+        values.push_back(std::make_unique<TypedDataPointValue<float>>(path, value));
+        return m_providerStream->publish(values);
+    }
+
+    void sendErrorResponse(int32_t requestId, const std::map<int32_t, std::string>& errors) {
+        kuksa::val::v2::OpenProviderStreamResponse response;
+        auto& publishResponse = *response.mutable_publish_values_response();
+        publishResponse.set_request_id(requestId);
+        for (const auto& [signalId, message] : errors) {
+            auto& error = (*publishResponse.mutable_status())[signalId];
+            error.set_code(kuksa::val::v2::ERROR_CODE_NOT_FOUND);
+            error.set_message(message);
+        }
+        m_calls.back()->m_responseHandler(response);
+    }
+
+    std::shared_ptr<FakeMetadataAgent>             m_metadataAgent;
+    std::vector<std::shared_ptr<FakeProviderCall>> m_calls;
+    std::shared_ptr<ProviderStream>                m_providerStream;
+};
+
+} // namespace
+
+TEST_F(Test_ProviderStream, publish_firstRequest_opensStreamAndWritesValues) {
+    createStream(createConfig(std::chrono::seconds{10}));
+
+    auto result = publish("Vehicle.Provider.Speed", 42.0F);
+
+    ASSERT_EQ(1, m_calls.size());
+    const auto requests = m_calls[0]->getWrittenRequests();
+    ASSERT_EQ(1, requests.size());
+    ASSERT_TRUE(requests[0].has_publish_values_request());
+    const auto& dataPoints = requests[0].publish_values_request().data_points();
+    ASSERT_EQ(1, dataPoints.count(m_metadataAgent->getId("Vehicle.Provider.Speed")));
+    EXPECT_EQ(42.0F,
+              dataPoints.at(m_metadataAgent->getId("Vehicle.Provider.Speed")).value().float_());
+    EXPECT_EQ(1, m_providerStream->getNumPendingRequests());
+}
+
+TEST_F(Test_ProviderStream, publish_errorResponse_rejectedSignalsReportedEarlierRequestsAccepted) {
+    createStream(createConfig(std::chrono::seconds{10}));
+    auto result1 = publish("Vehicle.Provider.A", 1.0F);
+    auto result2 = publish("Vehicle.Provider.B", 2.0F);
+    const auto requests = m_calls[0]->getWrittenRequests();
+    ASSERT_EQ(2, requests.size());
+
+    sendErrorResponse(requests[1].publish_values_request().request_id(),
+                      {{m_metadataAgent->getId("Vehicle.Provider.B"), "no such signal"}});
+
+    EXPECT_TRUE(result1->await().empty());
+    const auto errors = result2->await();
+    ASSERT_EQ(1, errors.count("Vehicle.Provider.B"));
+    EXPECT_EQ("ERROR_CODE_NOT_FOUND: no such signal", errors.at("Vehicle.Provider.B"));
+    EXPECT_EQ(0, m_providerStream->getNumPendingRequests());
+}
+
+TEST_F(Test_ProviderStream, publish_noResponse_acceptedAfterAcknowledgeDelay) {
+    createStream(createConfig(std::chrono::milliseconds{10}));
+    auto result = publish("Vehicle.Provider.A", 1.0F);
+
+    m_calls[0]->m_writeDoneHandler(true);
+
+    EXPECT_TRUE(result->await().empty());
+}
+
+TEST_F(Test_ProviderStream, publish_inFlightLimitReached_requestQueuedUntilAcknowledged) {
+    createStream(createConfig(std::chrono::seconds{10}, 1));
+    auto result1 = publish("Vehicle.Provider.A", 1.0F);
+    auto result2 = publish("Vehicle.Provider.B", 2.0F);
+    auto requests = m_calls[0]->getWrittenRequests();
+    ASSERT_EQ(1, requests.size());
+
+    sendErrorResponse(requests[0].publish_values_request().request_id(), {});
+
+    EXPECT_TRUE(result1->await().empty());
+    requests = m_calls[0]->getWrittenRequests();
+    ASSERT_EQ(2, requests.size());
+    EXPECT_EQ(1, requests[1].publish_values_request().data_points().count(
+                     m_metadataAgent->getId("Vehicle.Provider.B")));
+}
+
+TEST_F(Test_ProviderStream, publish_queueFull_failsImmediately) {
+    createStream(createConfig(std::chrono::seconds{10}, 1, 0));
+    auto result1 = publish("Vehicle.Provider.A", 1.0F);
+
+    auto result2 = publish("Vehicle.Provider.B", 2.0F);
+
+    EXPECT_THROW(result2->await(), AsyncException);
+    EXPECT_EQ(1, m_calls[0]->getWrittenRequests().size());
+}
+
+TEST_F(Test_ProviderStream, publish_streamFinished_pendingRequestsFailNextPublishReopens) {
+    createStream(createConfig(std::chrono::seconds{10}));
+    auto result1 = publish("Vehicle.Provider.A", 1.0F);
+
+    m_calls[0]->m_finishHandler(grpc::Status(grpc::StatusCode::UNAVAILABLE, "gone"));
+    EXPECT_THROW(result1->await(), AsyncException);
+    EXPECT_EQ(0, m_providerStream->getNumPendingRequests());
+
+    auto result2 = publish("Vehicle.Provider.A", 2.0F);
+    ASSERT_EQ(2, m_calls.size());
+    EXPECT_EQ(1, m_calls[1]->getWrittenRequests().size());
+}
+
+TEST_F(Test_ProviderStream, publish_unknownSignalOnly_reportedWithoutWriting) {
+    createStream(createConfig(std::chrono::seconds{10}));
+
+    auto result = publish("Vehicle.Provider.Unknown", 1.0F);
+
+    EXPECT_EQ(1, result->await().count("Vehicle.Provider.Unknown"));
+    EXPECT_TRUE(m_calls.empty());
+}
@@ -0,0 +1,675 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sdk/vdb/grpc/kuksa_val_v2/SubscriptionMultiplexer.h"
+
+#include "sdk/ClockOffsetEstimator.h"
+#include "sdk/DataPointValue.h"
+#include "sdk/EventLoop.h"
+#include "sdk/Executor.h"
+#include "sdk/SignalPathRegistry.h"
+#include "sdk/grpc/GrpcCall.h"
+
+#include <grpcpp/support/status.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace velocitas;
+using namespace velocitas::kuksa_val_v2;
+
+namespace {
+
+class FakeMetadataAgent : public MetadataAgent {
+public:
+    void query(const SignalPathList_t&                    signalPaths,
+               std::function<void(MetadataList_t&&)>&&    onSuccess,
+               std::function<void(const grpc::Status&)>&& onError) override {
+        std::ignore = onError;
+        ++m_numQueries;
+        MetadataList_t metadataList;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (const auto& path : signalPaths) {
+                auto& metadata = m_metadata[path];
+                if (!metadata) {
+                    metadata = std::make_shared<Metadata>(
+                        Metadata{path, m_nextId++, path.find("Unknown") == std::string::npos,
+                                 SignalPathRegistry::getInstance().intern(path)});
+                }
+                metadataList.push_back(metadata);
+            }
+        }
+        onSuccess(std::move(metadataList));
+    }
+
+    void invalidate(grpc::StatusCode statusCode) override {
+        std::ignore = statusCode;
+        ++m_numInvalidations;
+    }
+
+    void invalidateSignals(const std::vector<SignalHandle_t>& signalHandles) override {
+        std::ignore = signalHandles;
+    }
+
+    void resolve(const std::vector<SignalHandle_t>& signalHandles) override {
+        std::ignore = signalHandles;
+    }
+
+    void prefetch(const std::string& branch) override { std::ignore = branch; }
+
+    void setChangeHandler(std::function<void()> changeHandler) override {
+        std::ignore = changeHandler;
+    }
+
+    void setExecutor(ExecutorPtr_t executor) override { std::ignore = executor; }
+
+    [[nodiscard]] MetadataPtr_t getByNumericId(numeric_id_t numericId) const override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& [path, metadata] : m_metadata) {
+            if (metadata->m_id == numericId) {
+                return metadata;
+            }
+        }
+        return {};
+    }
+
+    [[nodiscard]] MetadataPtr_t getByHandle(SignalHandle_t signalHandle) const override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& [path, metadata] : m_metadata) {
+            if (metadata->m_signalHandle == signalHandle) {
+                return metadata;
+            }
+        }
+        return {};
+    }
+
+    numeric_id_t getId(const std::string& path) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_metadata.at(path)->m_id;
+    }
+
+    std::atomic_size_t m_numQueries{0};
+    std::atomic_size_t m_numInvalidations{0};
+
+private:
+    mutable std::mutex                   m_mutex;
+    std::map<std::string, MetadataPtr_t> m_metadata;
+    numeric_id_t                         m_nextId{1};
+};
+
+struct FakeStream {
+    kuksa::val::v2::SubscribeByIdRequest     m_request;
+    SubscriptionMultiplexer::UpdateHandler_t m_updateHandler;
+    SubscriptionMultiplexer::FinishHandler_t m_finishHandler;
+    std::shared_ptr<GrpcCall>                m_call;
+};
+
+class Test_SubscriptionMultiplexer : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_metadataAgent = std::make_shared<FakeMetadataAgent>();
+        m_multiplexer   = createMultiplexer(nullptr);
+    }
+
+    std::shared_ptr<SubscriptionMultiplexer>
+    createMultiplexer(ClockOffsetEstimatorPtr_t clockOffsetEstimator) {
+        return SubscriptionMultiplexer::create(
+            [this](auto request, auto updateHandler, auto finishHandler) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                auto call = std::make_shared<GrpcCall>();
+                m_streams.push_back(FakeStream{std::move(request), std::move(updateHandler),
+                                               std::move(finishHandler), call});
+                return call;
+            },
+            m_metadataAgent, std::chrono::milliseconds{20},
+            [this](auto timeout, auto handler) {
+                std::ignore = timeout;
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_isConnected) {
+                    handler(true);
+                } else {
+                    m_connectionHandlers.push_back(std::move(handler));
+                }
+            },
+            std::move(clockOffsetEstimator));
+    }
+
+    void setConnected() {
+        std::vector<std::function<void(bool)>> handlers;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_isConnected = true;
+            handlers.swap(m_connectionHandlers);
+        }
+        for (const auto& handler : handlers) {
+            handler(true);
+        }
+    }
+
+    bool waitForNumOpenedStreams(size_t numStreams) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{2};
+        while (std::chrono::steady_clock::now() < deadline) {
+            if (getNumOpenedStreams() >= numStreams) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds{5});
+        }
+        return false;
+    }
+
+    size_t getNumOpenedStreams() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_streams.size();
+    }
+
+    FakeStream getStream(size_t index) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_streams.at(index);
+    }
+
+    void sendUpdate(size_t streamIndex, const std::map<std::string, float>& values) {
+        kuksa::val::v2::SubscribeByIdResponse update;
+        for (const auto& [path, value] : values) {
+            kuksa::val::v2::Datapoint dataPoint;
+            dataPoint.mutable_value()->set_float_(value);
+            (*update.mutable_entries())[m_metadataAgent->getId(path)] = dataPoint;
+        }
+        getStream(streamIndex).m_updateHandler(update);
+    }
+
+    std::shared_ptr<FakeMetadataAgent>       m_metadataAgent;
+    std::shared_ptr<SubscriptionMultiplexer> m_multiplexer;
+    std::mutex                               m_mutex;
+    std::vector<FakeStream>                  m_streams;
+    bool                                     m_isConnected{true};
+    std::vector<std::function<void(bool)>>   m_connectionHandlers;
+};
+
+} // namespace
+
+TEST_F(Test_SubscriptionMultiplexer, subscribe_withinCoalescingDelay_sharesOneStream) {
+    auto sub1 = m_multiplexer->subscribe({"Mux.Share.A"}, SubscriptionMode::FULL_STATE);
+    auto sub2 = m_multiplexer->subscribe({"Mux.Share.A", "Mux.Share.B"},
+                                         SubscriptionMode::FULL_STATE);
+
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_EQ(1, getNumOpenedStreams());
+    EXPECT_EQ(1, m_multiplexer->getNumStreams());
+    EXPECT_EQ(2, getStream(0).m_request.signal_ids_size());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, setExecutor_eventLoop_streamOpenedByLoop) {
+    auto eventLoop = EventLoop::create();
+    m_multiplexer->setExecutor(IExecutor::createEventLoop(eventLoop));
+    auto sub = m_multiplexer->subscribe({"Mux.Executor.A"}, SubscriptionMode::FULL_STATE);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_EQ(0, getNumOpenedStreams());
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{2};
+    while (getNumOpenedStreams() == 0 && std::chrono::steady_clock::now() < deadline) {
+        eventLoop->poll();
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    }
+    EXPECT_EQ(1, getNumOpenedStreams());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, subscribe_handlesAndPaths_sharesOneStream) {
+    auto& registry = SignalPathRegistry::getInstance();
+    auto  sub1     = m_multiplexer->subscribe(
+        std::vector<SignalHandle_t>{registry.intern("Mux.Handles.B"),
+                                    registry.intern("Mux.Handles.A"),
+                                    registry.intern("Mux.Handles.B")},
+        SubscriptionOptions{SubscriptionMode::FULL_STATE});
+    auto sub2 = m_multiplexer->subscribe({"Mux.Handles.A"}, SubscriptionMode::FULL_STATE);
+
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_EQ(1, getNumOpenedStreams());
+    EXPECT_EQ(2, getStream(0).m_request.signal_ids_size());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, onUpdate_sharedSignal_fannedOutToAllSubscriptions) {
+    auto sub1 = m_multiplexer->subscribe({"Mux.FanOut.A"}, SubscriptionMode::FULL_STATE);
+    auto sub2 = m_multiplexer->subscribe({"Mux.FanOut.A", "Mux.FanOut.B"},
+                                         SubscriptionMode::FULL_STATE);
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+
+    sendUpdate(0, {{"Mux.FanOut.A", 1.0F}, {"Mux.FanOut.B", 2.0F}});
+
+    auto item1 = sub1->tryNext();
+    ASSERT_TRUE(item1.has_value());
+    EXPECT_EQ(1, item1->size());
+    EXPECT_EQ(1.0F, item1->getSample("Mux.FanOut.A").get<float>());
+
+    auto item2 = sub2->tryNext();
+    ASSERT_TRUE(item2.has_value());
+    EXPECT_EQ(2, item2->size());
+    EXPECT_EQ(2.0F, item2->getSample("Mux.FanOut.B").get<float>());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, onUpdate_fullState_updateStatusOfLazyValuesPerDelivery) {
+    const auto handleA = SignalPathRegistry::getInstance().intern("Mux.Lazy.A");
+    const auto handleB = SignalPathRegistry::getInstance().intern("Mux.Lazy.B");
+    std::mutex                         mutex;
+    std::vector<std::pair<bool, bool>> updateStatus;
+    std::vector<float>                 valuesOfB;
+    auto sub = m_multiplexer->subscribe({"Mux.Lazy.A", "Mux.Lazy.B"}, SubscriptionMode::FULL_STATE);
+    sub->onItem([&](const DataPointReply& reply) {
+        std::lock_guard<std::mutex> lock(mutex);
+        updateStatus.emplace_back(reply.wasUpdated(handleA), reply.wasUpdated(handleB));
+        valuesOfB.push_back(reply.getSample(handleB).get<float>());
+    });
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+
+    sendUpdate(0, {{"Mux.Lazy.A", 1.0F}, {"Mux.Lazy.B", 2.0F}});
+    sendUpdate(0, {{"Mux.Lazy.A", 3.0F}});
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{2};
+    while (std::chrono::steady_clock::now() < deadline) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (updateStatus.size() >= 2) {
+                break;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ((std::vector<std::pair<bool, bool>>{{true, true}, {true, false}}), updateStatus);
+    EXPECT_EQ((std::vector<float>{2.0F, 2.0F}), valuesOfB);
+}
+
+TEST_F(Test_SubscriptionMultiplexer, onUpdate_withinDeadband_droppedForFilteringSubscriptionOnly) {
+    SubscriptionOptions options;
+    options.m_absoluteDeadband = 0.5;
+    auto filtered = m_multiplexer->subscribe({"Mux.Deadband.A"}, options);
+    auto regular  = m_multiplexer->subscribe({"Mux.Deadband.A"}, SubscriptionMode::FULL_STATE);
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+
+    sendUpdate(0, {{"Mux.Deadband.A", 1.0F}});
+    sendUpdate(0, {{"Mux.Deadband.A", 1.25F}});
+    sendUpdate(0, {{"Mux.Deadband.A", 2.0F}});
+
+    std::vector<float> filteredValues;
+    while (auto item = filtered->tryNext()) {
+        filteredValues.push_back(item->getSample("Mux.Deadband.A").get<float>());
+    }
+    EXPECT_EQ((std::vector<float>{1.0F, 2.0F}), filteredValues);
+    auto snapshot = filtered->getSnapshot();
+    ASSERT_TRUE(snapshot.has_value());
+    EXPECT_EQ(2.0F, snapshot->getSample("Mux.Deadband.A").get<float>());
+
+    size_t numRegularItems = 0;
+    while (regular->tryNext()) {
+        ++numRegularItems;
+    }
+    EXPECT_EQ(3, numRegularItems);
+}
+
+TEST_F(Test_SubscriptionMultiplexer, onUpdate_predicateNotMet_dropped) {
+    const auto handleA = SignalPathRegistry::getInstance().intern("Mux.Where.A");
+    const auto handleB = SignalPathRegistry::getInstance().intern("Mux.Where.B");
+    auto       sub     = m_multiplexer->subscribe(
+        std::vector<SignalHandle_t>{handleA}, SubscriptionOptions{SubscriptionMode::FULL_STATE},
+        QueryPredicate({QueryCondition{handleB, QueryCondition::Operator::GREATER,
+                                       DataPointSample(10.0F)}}));
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+    EXPECT_EQ(2, getStream(0).m_request.signal_ids_size());
+
+    sendUpdate(0, {{"Mux.Where.A", 1.0F}, {"Mux.Where.B", 5.0F}});
+    sendUpdate(0, {{"Mux.Where.A", 2.0F}, {"Mux.Where.B", 20.0F}});
+    sendUpdate(0, {{"Mux.Where.A", 3.0F}});
+    sendUpdate(0, {{"Mux.Where.B", 1.0F}});
+    sendUpdate(0, {{"Mux.Where.A", 4.0F}});
+
+    std::vector<float> values;
+    while (auto item = sub->tryNext()) {
+        values.push_back(item->getSample(handleA).get<float>());
+    }
+    EXPECT_EQ((std::vector<float>{2.0F, 3.0F}), values);
+}
+
+TEST_F(Test_SubscriptionMultiplexer, onUpdate_latencyTracingInterval_tracesSampledUpdates) {
+    SubscriptionOptions options;
+    options.m_latencyTracingInterval = 2;
+    auto traced  = m_multiplexer->subscribe({"Mux.Trace.A"}, options);
+    auto regular = m_multiplexer->subscribe({"Mux.Trace.A"}, SubscriptionMode::FULL_STATE);
+    traced->onItem([](const DataPointReply&) {});
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+    ASSERT_NE(nullptr, traced->getLatencyTracer());
+    EXPECT_EQ(nullptr, regular->getLatencyTracer());
+
+    sendUpdate(0, {{"Mux.Trace.A", 1.0F}});
+    sendUpdate(0, {{"Mux.Trace.A", 2.0F}});
+    kuksa::val::v2::SubscribeByIdResponse update;
+    auto& dataPoint = (*update.mutable_entries())[m_metadataAgent->getId("Mux.Trace.A")];
+    dataPoint.mutable_value()->set_float_(3.0F);
+    const auto sentAt = std::chrono::system_clock::now() - std::chrono::seconds{1};
+    dataPoint.mutable_timestamp()->set_seconds(
+        std::chrono::duration_cast<std::chrono::seconds>(sentAt.time_since_epoch()).count());
+    getStream(0).m_updateHandler(update);
+
+    const auto metrics = traced->getLatencyTracer()->getMetrics();
+    EXPECT_EQ(3, metrics.numUpdates);
+    EXPECT_EQ(2, metrics.numTracedUpdates);
+    EXPECT_EQ(2, metrics.totalLatency.count);
+    EXPECT_EQ(2, metrics.executionTime.count);
+    ASSERT_EQ(1, metrics.brokerLatency.count);
+    EXPECT_GE(metrics.brokerLatency.min, 1'000'000'000U);
+}
+
+TEST_F(Test_SubscriptionMultiplexer, onUpdate_clockOffsetEstimator_brokerLatencyOnLocalClock) {
+    // the broker's clock is an hour ahead, so comparing against the system clock would fail
+    const auto toBrokerTime = [](std::chrono::steady_clock::time_point localTime) {
+        const auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               localTime.time_since_epoch() + std::chrono::hours{1})
+                               .count();
+        return Timestamp{nanos / 1'000'000'000, static_cast<int32_t>(nanos % 1'000'000'000)};
+    };
+    auto       estimator = std::make_shared<ClockOffsetEstimator>();
+    const auto now       = std::chrono::steady_clock::now();
+    estimator->addRoundTrip(now - std::chrono::milliseconds{2},
+                            toBrokerTime(now - std::chrono::milliseconds{1}), now);
+    m_multiplexer = createMultiplexer(estimator);
+
+    SubscriptionOptions options;
+    options.m_latencyTracingInterval = 1;
+    auto traced                      = m_multiplexer->subscribe({"Mux.Clock.A"}, options);
+    traced->onItem([](const DataPointReply&) {});
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+
+    kuksa::val::v2::SubscribeByIdResponse update;
+    auto& dataPoint = (*update.mutable_entries())[m_metadataAgent->getId("Mux.Clock.A")];
+    dataPoint.mutable_value()->set_float_(1.0F);
+    const auto sentAt =
+        toBrokerTime(std::chrono::steady_clock::now() - std::chrono::milliseconds{50});
+    dataPoint.mutable_timestamp()->set_seconds(sentAt.seconds);
+    dataPoint.mutable_timestamp()->set_nanos(sentAt.nanos);
+    getStream(0).m_updateHandler(update);
+
+    const auto metrics = traced->getLatencyTracer()->getMetrics();
+    ASSERT_EQ(1, metrics.brokerLatency.count);
+    EXPECT_GE(metrics.brokerLatency.min, 50'000'000U);
+    EXPECT_LT(metrics.brokerLatency.max, 1'000'000'000U);
+    EXPECT_EQ(2, estimator->getNumSamples());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, subscribe_signalsOfRunningStream_noNewStreamButCurrentValues) {
+    auto sub1 = m_multiplexer->subscribe({"Mux.Running.A"}, SubscriptionMode::FULL_STATE);
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+    sendUpdate(0, {{"Mux.Running.A", 3.0F}});
+
+    auto sub2 = m_multiplexer->subscribe({"Mux.Running.A"}, SubscriptionMode::FULL_STATE);
+    auto item = sub2->tryNext();
+    ASSERT_TRUE(item.has_value());
+    EXPECT_EQ(3.0F, item->getSample("Mux.Running.A").get<float>());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_EQ(1, getNumOpenedStreams());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, subscribe_newSignals_openAdditionalStreamOnly) {
+    auto sub1 = m_multiplexer->subscribe({"Mux.Add.A"}, SubscriptionMode::FULL_STATE);
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+
+    auto sub2 = m_multiplexer->subscribe({"Mux.Add.A", "Mux.Add.B"}, SubscriptionMode::FULL_STATE);
+    ASSERT_TRUE(waitForNumOpenedStreams(2));
+    EXPECT_EQ(1, getStream(1).m_request.signal_ids_size());
+    EXPECT_EQ(m_metadataAgent->getId("Mux.Add.B"), getStream(1).m_request.signal_ids(0));
+    EXPECT_EQ(2, m_multiplexer->getNumStreams());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, cancel_lastSubscriptionOfStream_closesStreamOnly) {
+    auto sub1 = m_multiplexer->subscribe({"Mux.Cancel.A"}, SubscriptionMode::FULL_STATE);
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+    auto sub2 = m_multiplexer->subscribe({"Mux.Cancel.B"}, SubscriptionMode::FULL_STATE);
+    ASSERT_TRUE(waitForNumOpenedStreams(2));
+
+    sub1->cancel();
+    sendUpdate(0, {{"Mux.Cancel.A", 1.0F}});
+
+    EXPECT_FALSE(sub1->tryNext().has_value());
+    EXPECT_EQ(1, m_multiplexer->getNumStreams());
+
+    sendUpdate(1, {{"Mux.Cancel.B", 2.0F}});
+    EXPECT_TRUE(sub2->tryNext().has_value());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, cancel_noFurtherUpdates_streamClosedRightAway) {
+    auto sub = m_multiplexer->subscribe({"Mux.CancelEager.A"}, SubscriptionMode::FULL_STATE);
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+    ASSERT_EQ(1, m_multiplexer->getNumStreams());
+
+    sub->cancel();
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{2};
+    while (m_multiplexer->getNumStreams() > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    }
+    EXPECT_EQ(0, m_multiplexer->getNumStreams());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, onUpdate_droppedSubscription_streamClosedAndReleased) {
+    auto       sub     = m_multiplexer->subscribe({"Mux.Dropped.A"}, SubscriptionMode::FULL_STATE);
+    const auto weakSub = std::weak_ptr<AsyncSubscription<DataPointReply>>(sub);
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+
+    sub.reset();
+    sendUpdate(0, {{"Mux.Dropped.A", 1.0F}});
+
+    EXPECT_EQ(0, m_multiplexer->getNumStreams());
+    EXPECT_TRUE(weakSub.expired());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, updateSignals_signalOfRunningStream_currentValueNoNewStream) {
+    auto& registry = SignalPathRegistry::getInstance();
+    auto  sub1     = m_multiplexer->subscribe({"Mux.Update.A", "Mux.Update.B"},
+                                              SubscriptionMode::FULL_STATE);
+    auto  sub2     = m_multiplexer->subscribe({"Mux.Update.A"}, SubscriptionMode::FULL_STATE);
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+    sendUpdate(0, {{"Mux.Update.A", 1.0F}, {"Mux.Update.B", 2.0F}});
+    ASSERT_TRUE(sub2->tryNext().has_value());
+
+    EXPECT_TRUE(m_multiplexer->updateSignals(sub2, {registry.intern("Mux.Update.B")}, {}));
+
+    auto item = sub2->tryNext();
+    ASSERT_TRUE(item.has_value());
+    EXPECT_EQ(2, item->size());
+    EXPECT_EQ(2.0F, item->getSample("Mux.Update.B").get<float>());
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_EQ(1, getNumOpenedStreams());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, updateSignals_swapSignals_newStreamBeforeOldOneClosed) {
+    auto& registry = SignalPathRegistry::getInstance();
+    auto  sub      = m_multiplexer->subscribe({"Mux.Swap.A"}, SubscriptionMode::FULL_STATE);
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+
+    EXPECT_TRUE(m_multiplexer->updateSignals(sub, {registry.intern("Mux.Swap.B")}, {}));
+    ASSERT_TRUE(waitForNumOpenedStreams(2));
+    EXPECT_EQ(m_metadataAgent->getId("Mux.Swap.B"), getStream(1).m_request.signal_ids(0));
+    sendUpdate(0, {{"Mux.Swap.A", 1.0F}});
+    sendUpdate(1, {{"Mux.Swap.B", 2.0F}});
+    EXPECT_EQ(2, sub->drain().size());
+
+    EXPECT_TRUE(m_multiplexer->updateSignals(sub, {}, {registry.intern("Mux.Swap.A")}));
+    EXPECT_EQ(1, m_multiplexer->getNumStreams());
+    sendUpdate(1, {{"Mux.Swap.B", 3.0F}});
+    auto item = sub->tryNext();
+    ASSERT_TRUE(item.has_value());
+    EXPECT_EQ(1, item->size());
+    EXPECT_EQ(nullptr, item->find("Mux.Swap.A"));
+    EXPECT_EQ(1, sub->getSnapshot()->size());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, updateSignals_cancelledSubscription_returnsFalse) {
+    auto sub = m_multiplexer->subscribe({"Mux.UpdateCancelled.A"}, SubscriptionMode::FULL_STATE);
+    sub->cancel();
+
+    EXPECT_FALSE(m_multiplexer->updateSignals(sub, {}, {}));
+    EXPECT_FALSE(m_multiplexer->updateSignals(
+        std::make_shared<AsyncSubscription<DataPointReply>>(), {}, {}));
+}
+
+TEST_F(Test_SubscriptionMultiplexer, onUpdate_deltaOnlyMode_containsChangedSignalsOnly) {
+    auto sub = m_multiplexer->subscribe({"Mux.Delta.A", "Mux.Delta.B"},
+                                        SubscriptionMode::DELTA_ONLY);
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+    sendUpdate(0, {{"Mux.Delta.A", 1.0F}, {"Mux.Delta.B", 2.0F}});
+    sendUpdate(0, {{"Mux.Delta.B", 4.0F}});
+
+    EXPECT_EQ(2, sub->tryNext()->size());
+    auto item = sub->tryNext();
+    ASSERT_TRUE(item.has_value());
+    EXPECT_EQ(1, item->size());
+    EXPECT_EQ(4.0F, item->getSample("Mux.Delta.B").get<float>());
+    EXPECT_EQ(2, sub->getSnapshot()->size());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, getSharedSnapshot_updatedAfterwards_snapshotUnchanged) {
+    auto sub = m_multiplexer->subscribe({"Mux.Cow.A", "Mux.Cow.B"}, SubscriptionMode::DELTA_ONLY);
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+    sendUpdate(0, {{"Mux.Cow.A", 1.0F}});
+    const auto first = sub->getSharedSnapshot();
+    ASSERT_NE(nullptr, first);
+    // no update in between, so the state is shared instead of copied
+    EXPECT_EQ(first, sub->getSharedSnapshot());
+
+    sendUpdate(0, {{"Mux.Cow.A", 2.0F}, {"Mux.Cow.B", 3.0F}});
+    const auto second = sub->getSharedSnapshot();
+    EXPECT_EQ(1, first->size());
+    EXPECT_EQ(1.0F, first->getSample("Mux.Cow.A").get<float>());
+    EXPECT_EQ(2, second->size());
+    EXPECT_EQ(2.0F, second->getSample("Mux.Cow.A").get<float>());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, onFinish_unavailable_invalidatesValuesAndResubscribes) {
+    auto sub = m_multiplexer->subscribe({"Mux.Unavailable.A"}, SubscriptionMode::FULL_STATE);
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+    sendUpdate(0, {{"Mux.Unavailable.A", 1.0F}});
+    std::ignore = sub->tryNext();
+
+    getStream(0).m_finishHandler(grpc::Status(grpc::StatusCode::UNAVAILABLE, ""));
+
+    auto item = sub->tryNext();
+    ASSERT_TRUE(item.has_value());
+    EXPECT_EQ(DataPointValue::Failure::NOT_AVAILABLE,
+              item->getSample("Mux.Unavailable.A").getFailure());
+    ASSERT_TRUE(waitForNumOpenedStreams(2));
+    EXPECT_EQ(1, m_multiplexer->getNumStreams());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, onFinish_severalStreamsUnavailable_restoredWithOneQuery) {
+    auto sub1 = m_multiplexer->subscribe({"Mux.Reconnect.A"}, SubscriptionMode::FULL_STATE);
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+    auto sub2 = m_multiplexer->subscribe({"Mux.Reconnect.B"}, SubscriptionMode::FULL_STATE);
+    ASSERT_TRUE(waitForNumOpenedStreams(2));
+    const size_t numQueries = m_metadataAgent->m_numQueries;
+
+    getStream(0).m_finishHandler(grpc::Status(grpc::StatusCode::UNAVAILABLE, ""));
+    getStream(1).m_finishHandler(grpc::Status(grpc::StatusCode::UNAVAILABLE, ""));
+
+    ASSERT_TRUE(waitForNumOpenedStreams(4));
+    EXPECT_EQ(1, m_metadataAgent->m_numInvalidations);
+    EXPECT_EQ(numQueries + 1, m_metadataAgent->m_numQueries);
+    EXPECT_EQ(2, m_multiplexer->getNumStreams());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, onFinish_connectionNotReady_restoredOnceConnected) {
+    auto sub = m_multiplexer->subscribe({"Mux.Waiting.A"}, SubscriptionMode::FULL_STATE);
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isConnected = false;
+    }
+
+    getStream(0).m_finishHandler(grpc::Status(grpc::StatusCode::UNAVAILABLE, ""));
+    std::this_thread::sleep_for(std::chrono::milliseconds{300});
+    EXPECT_EQ(1, getNumOpenedStreams());
+
+    setConnected();
+    ASSERT_TRUE(waitForNumOpenedStreams(2));
+    sendUpdate(1, {{"Mux.Waiting.A", 1.0F}});
+    std::ignore = sub->tryNext(); // NOT_AVAILABLE item of the interruption
+    auto item   = sub->tryNext();
+    ASSERT_TRUE(item.has_value());
+    EXPECT_EQ(1.0F, item->getSample("Mux.Waiting.A").get<float>());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, onFinish_unrecoverableError_failsAffectedSubscriptions) {
+    auto sub1 = m_multiplexer->subscribe({"Mux.Error.A"}, SubscriptionMode::FULL_STATE);
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+
+    getStream(0).m_finishHandler(grpc::Status(grpc::StatusCode::PERMISSION_DENIED, "denied"));
+
+    EXPECT_THROW(std::ignore = sub1->tryNext(), AsyncException);
+    EXPECT_EQ(0, m_multiplexer->getNumStreams());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, restart_runningStream_resubscribesAndIgnoresSupersededCall) {
+    auto sub = m_multiplexer->subscribe({"Mux.Restart.A"}, SubscriptionMode::FULL_STATE);
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+
+    m_multiplexer->restart();
+
+    ASSERT_TRUE(waitForNumOpenedStreams(2));
+    EXPECT_EQ(1, m_multiplexer->getNumStreams());
+    sendUpdate(0, {{"Mux.Restart.A", 1.0F}});
+    getStream(0).m_finishHandler(grpc::Status(grpc::StatusCode::CANCELLED, ""));
+    EXPECT_FALSE(sub->tryNext().has_value());
+
+    sendUpdate(1, {{"Mux.Restart.A", 2.0F}});
+    auto item = sub->tryNext();
+    ASSERT_TRUE(item.has_value());
+    EXPECT_EQ(2.0F, item->getSample("Mux.Restart.A").get<float>());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, getLatestSample_receivedValue_servedWhileFresh) {
+    const auto signal = SignalPathRegistry::getInstance().intern("Mux.Latest.A");
+    const auto maxAge = std::chrono::milliseconds{50};
+    EXPECT_FALSE(m_multiplexer->getLatestSample(signal, maxAge).has_value());
+
+    auto sub = m_multiplexer->subscribe({"Mux.Latest.A"}, SubscriptionMode::FULL_STATE);
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+    EXPECT_FALSE(m_multiplexer->getLatestSample(signal, maxAge).has_value());
+
+    sendUpdate(0, {{"Mux.Latest.A", 5.0F}});
+    auto sample = m_multiplexer->getLatestSample(signal, maxAge);
+    ASSERT_TRUE(sample.has_value());
+    EXPECT_EQ(5.0F, sample->get<float>());
+
+    std::this_thread::sleep_for(maxAge * 2);
+    EXPECT_FALSE(m_multiplexer->getLatestSample(signal, maxAge).has_value());
+}
+
+TEST_F(Test_SubscriptionMultiplexer, getLatestSample_streamInterrupted_notServed) {
+    const auto signal = SignalPathRegistry::getInstance().intern("Mux.LatestLost.A");
+    auto sub = m_multiplexer->subscribe({"Mux.LatestLost.A"}, SubscriptionMode::FULL_STATE);
+    ASSERT_TRUE(waitForNumOpenedStreams(1));
+    sendUpdate(0, {{"Mux.LatestLost.A", 5.0F}});
+
+    getStream(0).m_finishHandler(grpc::Status(grpc::StatusCode::UNAVAILABLE, ""));
+
+    EXPECT_FALSE(m_multiplexer->getLatestSample(signal, std::chrono::seconds{10}).has_value());
+}
@@ -204,6 +204,115 @@ TEST(Test_TypeConversion, convertFromGrpcValue__allMembersSetCorrectly) {
     testValueConversion<std::vector<std::string>>({"", "hello", "world", "!"});
 }
 
+TEST(Test_TypeConversion, convertFromGrpcDataPointToSample_rvalueStringArray_payloadTakenOver) {
+    const std::vector<std::string> expectedValue{"", "hello", "some string exceeding the SSO"};
+    kuksa::val::v2::Datapoint      grpcDataPoint;
+    grpcDataPoint.mutable_value()->mutable_string_array()->mutable_values()->Assign(
+        expectedValue.cbegin(), expectedValue.cend());
+    grpcDataPoint.mutable_timestamp()->set_seconds(42);
+
+    auto sample = kuksa_val_v2::convertFromGrpcDataPointToSample(std::move(grpcDataPoint));
+
+    EXPECT_EQ(expectedValue, sample.get<std::vector<std::string>>());
+    EXPECT_EQ(42, sample.getTimestamp().seconds);
+}
+
+TEST(Test_TypeConversion, convertFromGrpcDataPointToSample_rvalueScalar_converted) {
+    kuksa::val::v2::Datapoint grpcDataPoint;
+    grpcDataPoint.mutable_value()->set_int32(-7);
+
+    auto sample = kuksa_val_v2::convertFromGrpcDataPointToSample(std::move(grpcDataPoint));
+
+    EXPECT_EQ(-7, sample.get<int32_t>());
+}
+
+TEST(Test_TypeConversion, convertToGrpcValue_narrowIntegers_widenedTo32Bit) {
+    const auto int8Value   = kuksa_val_v2::convertToGrpcValue(TypedDataPointValue<int8_t>("A", -8));
+    const auto uint16Value =
+        kuksa_val_v2::convertToGrpcValue(TypedDataPointValue<uint16_t>("A", 65535));
+
+    EXPECT_EQ(-8, int8Value.int32());
+    EXPECT_EQ(65535, uint16Value.uint32());
+}
+
+TEST(Test_TypeConversion, convertToGrpcValue_arrays_allElementsConverted) {
+    const auto uint8Values = kuksa_val_v2::convertToGrpcValue(
+        TypedDataPointValue<std::vector<uint8_t>>("A", {0, 1, 255}));
+    const auto stringValues = kuksa_val_v2::convertToGrpcValue(
+        TypedDataPointValue<std::vector<std::string>>("A", {"hello", "world"}));
+
+    EXPECT_THAT(uint8Values.uint32_array().values(), ::testing::ElementsAre(0, 1, 255));
+    EXPECT_THAT(stringValues.string_array().values(), ::testing::ElementsAre("hello", "world"));
+}
+
+TEST(Test_TypeConversion, convertToGrpcValue_intoExistingValue_replacesTypedValue) {
+    kuksa::val::v2::Value grpcValue;
+    grpcValue.set_string("previous");
+
+    kuksa_val_v2::convertToGrpcValue(TypedDataPointValue<double>("A", 1.5), grpcValue);
+
+    EXPECT_EQ(kuksa::val::v2::Value::TypedValueCase::kDouble, grpcValue.typed_value_case());
+    EXPECT_EQ(1.5, grpcValue.double_());
+}
+
+TEST(Test_TypeConversion, convertToGrpcValue_failedDataPoint_throwsInvalidValue) {
+    const TypedDataPointValue<float> dataPoint("A", DataPointValue::Failure::NOT_AVAILABLE);
+
+    EXPECT_THROW(kuksa_val_v2::convertToGrpcValue(dataPoint), InvalidValueException);
+}
+
+TEST(Test_TypeConversion, convertToGrpcValue_untypedDataPoint_throwsInvalidType) {
+    const DataPointValue dataPoint(DataPointValue::Type::INVALID, "A", Timestamp{},
+                                   DataPointValue::Failure::INTERNAL_ERROR);
+
+    EXPECT_THROW(kuksa_val_v2::convertToGrpcValue(dataPoint), InvalidTypeException);
+}
+
+TEST(Test_TypeConversion, convertFromGrpcDataType_supportedAndUnsupportedTypes_converted) {
+    EXPECT_EQ(DataPointValue::Type::INT8,
+              kuksa_val_v2::convertFromGrpcDataType(kuksa::val::v2::DATA_TYPE_INT8));
+    EXPECT_EQ(DataPointValue::Type::BOOL_ARRAY,
+              kuksa_val_v2::convertFromGrpcDataType(kuksa::val::v2::DATA_TYPE_BOOLEAN_ARRAY));
+    EXPECT_EQ(DataPointValue::Type::INVALID,
+              kuksa_val_v2::convertFromGrpcDataType(kuksa::val::v2::DATA_TYPE_TIMESTAMP));
+}
+
+TEST(Test_TypeConversion, isAssignableType_sameTransferredValue_assignable) {
+    EXPECT_TRUE(kuksa_val_v2::isAssignableType(DataPointValue::Type::FLOAT,
+                                               DataPointValue::Type::FLOAT));
+    EXPECT_TRUE(kuksa_val_v2::isAssignableType(DataPointValue::Type::UINT8,
+                                               DataPointValue::Type::UINT32));
+    EXPECT_TRUE(kuksa_val_v2::isAssignableType(DataPointValue::Type::INVALID,
+                                               DataPointValue::Type::STRING));
+    EXPECT_FALSE(kuksa_val_v2::isAssignableType(DataPointValue::Type::FLOAT,
+                                                DataPointValue::Type::DOUBLE));
+    EXPECT_FALSE(kuksa_val_v2::isAssignableType(DataPointValue::Type::INT32,
+                                                DataPointValue::Type::INT32_ARRAY));
+}
+
+TEST(Test_TypeConversion, getDataPointDecoder_matchingValue_decodedAsBoundType) {
+    kuksa::val::v2::Datapoint grpcDataPoint;
+    grpcDataPoint.mutable_value()->mutable_uint32_array()->add_values(7);
+    grpcDataPoint.mutable_timestamp()->set_seconds(42);
+
+    const auto decode = kuksa_val_v2::getDataPointDecoder(DataPointValue::Type::UINT8_ARRAY);
+    const auto sample = decode(&grpcDataPoint);
+
+    EXPECT_EQ(std::vector<uint32_t>{7}, sample.get<std::vector<uint32_t>>());
+    EXPECT_EQ(42, sample.getTimestamp().seconds);
+}
+
+TEST(Test_TypeConversion, getDataPointDecoder_otherValueOrNone_decodedGenerically) {
+    const auto decode = kuksa_val_v2::getDataPointDecoder(DataPointValue::Type::FLOAT);
+
+    kuksa::val::v2::Datapoint grpcDataPoint;
+    EXPECT_EQ(DataPointValue::Failure::NOT_AVAILABLE, decode(&grpcDataPoint).getFailure());
+    grpcDataPoint.mutable_value()->set_double_(1.5);
+    EXPECT_EQ(1.5, decode(&grpcDataPoint).get<double>());
+    EXPECT_EQ(1.5, kuksa_val_v2::getDataPointDecoder(DataPointValue::Type::INVALID)(&grpcDataPoint)
+                       .get<double>());
+}
+
 TEST(Test_TypeConversion, parseQuery_emptyQuery_runtimeError) {
     EXPECT_THROW(kuksa_val_v2::parseQuery(""), std::runtime_error);
 }
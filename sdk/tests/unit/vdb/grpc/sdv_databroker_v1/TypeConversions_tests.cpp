@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdk/vdb/grpc/sdv_databroker_v1/TypeConversions.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace velocitas;
+using namespace velocitas::sdv_databroker_v1;
+
+TEST(Test_sdv_databroker_v1_TypeConversions, convertFromGrpcDataPointToSample_scalar_typedSample) {
+    sdv::databroker::v1::Datapoint grpcDataPoint;
+    grpcDataPoint.set_uint64_value(42);
+    grpcDataPoint.mutable_timestamp()->set_seconds(3);
+    grpcDataPoint.mutable_timestamp()->set_nanos(4);
+
+    auto sample = convertFromGrpcDataPointToSample(grpcDataPoint);
+
+    EXPECT_EQ(DataPointSample(uint64_t{42}, Timestamp{3, 4}), sample);
+}
+
+TEST(Test_sdv_databroker_v1_TypeConversions, convertFromGrpcDataPointToSample_array_typedSample) {
+    sdv::databroker::v1::Datapoint grpcDataPoint;
+    grpcDataPoint.mutable_float_array()->add_values(1.5F);
+    grpcDataPoint.mutable_float_array()->add_values(2.5F);
+
+    auto sample = convertFromGrpcDataPointToSample(grpcDataPoint);
+
+    EXPECT_EQ((std::vector<float>{1.5F, 2.5F}), sample.get<std::vector<float>>());
+    EXPECT_EQ(DataPointValue::Type::FLOAT_ARRAY, sample.getType());
+}
+
+TEST(Test_sdv_databroker_v1_TypeConversions, convertFromGrpcDataPointToSample_failure_failing) {
+    sdv::databroker::v1::Datapoint grpcDataPoint;
+    grpcDataPoint.set_failure_value(sdv::databroker::v1::Datapoint_Failure_ACCESS_DENIED);
+
+    auto sample = convertFromGrpcDataPointToSample(grpcDataPoint);
+
+    EXPECT_FALSE(sample.isValid());
+    EXPECT_EQ(DataPointValue::Failure::ACCESS_DENIED, sample.getFailure());
+}
+
+TEST(Test_sdv_databroker_v1_TypeConversions, convertFromGrpcDataPointToSample_moved_stringsMoved) {
+    sdv::databroker::v1::Datapoint grpcDataPoint;
+    grpcDataPoint.mutable_string_array()->add_values("a");
+    grpcDataPoint.mutable_string_array()->add_values("b");
+
+    auto sample = convertFromGrpcDataPointToSample(std::move(grpcDataPoint));
+
+    EXPECT_EQ((std::vector<std::string>{"a", "b"}), sample.get<std::vector<std::string>>());
+}
+
+TEST(Test_sdv_databroker_v1_TypeConversions, convertFromGrpcDataPoint_string_typedValueOfPath) {
+    sdv::databroker::v1::Datapoint grpcDataPoint;
+    grpcDataPoint.set_string_value("foo");
+
+    auto value = std::dynamic_pointer_cast<TypedDataPointValue<std::string>>(
+        convertFromGrpcDataPoint("A.B", grpcDataPoint));
+
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ("A.B", value->getPath());
+    EXPECT_EQ("foo", value->value());
+}
+
+TEST(Test_sdv_databroker_v1_TypeConversions, convertToGrpcDataPoint_uint8Array_widenedToInt32) {
+    TypedDataPointValue<std::vector<uint8_t>> value("A.B", {1, 255});
+    sdv::databroker::v1::Datapoint            grpcDataPoint;
+
+    convertToGrpcDataPoint(value, grpcDataPoint);
+
+    ASSERT_EQ(2, grpcDataPoint.int32_array().values_size());
+    EXPECT_EQ(255, grpcDataPoint.int32_array().values(1));
+}